@@ -1,35 +0,0 @@
-/*
- * Copyright (C) 2019 Alibaba Inc. All rights reserved.
- * Author: Kraken Team.
- */
-
-#ifndef KRAKENBRIDGE_DOCUMENT_H
-#define KRAKENBRIDGE_DOCUMENT_H
-
-#include "all_collection.h"
-#include "bindings/jsc/js_context_internal.h"
-#include "element.h"
-#include "node.h"
-
-
-#include "bindings/jsc/DOM/elements/anchor_element.h"
-#include "bindings/jsc/DOM/elements/canvas_element.h"
-#include "bindings/jsc/DOM/elements/image_element.h"
-#include "bindings/jsc/DOM/elements/input_element.h"
-#include "bindings/jsc/DOM/elements/object_element.h"
-#include "bindings/jsc/DOM/events/input_event.h"
-#include "bindings/jsc/DOM/events/media_error_event.h"
-#include "bindings/jsc/DOM/events/message_event.h"
-#include "bindings/jsc/DOM/events/close_event.h"
-#include "bindings/jsc/DOM/events/intersection_change_event.h"
-#include "bindings/jsc/DOM/events/touch_event.h"
-#include "bindings/jsc/DOM/gesture_event.h"
-#include "bindings/jsc/DOM/custom_event.h"
-
-namespace kraken::binding::jsc {
-
-void bindDocument(std::unique_ptr<JSContext> &context);
-
-} // namespace kraken::binding::jsc
-
-#endif // KRAKENBRIDGE_DOCUMENT_H
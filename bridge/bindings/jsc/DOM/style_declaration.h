@@ -1,27 +0,0 @@
-/*
- * Copyright (C) 2020 Alibaba Inc. All rights reserved.
- * Author: Kraken Team.
- */
-
-#ifndef KRAKENBRIDGE_STYLE_DECLARATION_H
-#define KRAKENBRIDGE_STYLE_DECLARATION_H
-
-#include "bindings/jsc/DOM/event_target.h"
-#include "bindings/jsc/host_class.h"
-#include "bindings/jsc/js_context_internal.h"
-#include <map>
-
-namespace kraken::binding::jsc {
-
-void bindCSSStyleDeclaration(std::unique_ptr<JSContext> &context);
-
-template <typename CharacterType> inline bool isASCIILower(CharacterType character) {
-  return character >= 'a' && character <= 'z';
-}
-
-template <typename CharacterType> inline CharacterType toASCIIUpper(CharacterType character) {
-  return character & ~(isASCIILower(character) << 5);
-}
-} // namespace kraken::binding::jsc
-
-#endif // KRAKENBRIDGE_STYLE_DECLARATION_H
@@ -7,12 +7,14 @@
 #include "bridge_jsc.h"
 #include "dart_methods.h"
 #include "foundation/bridge_callback.h"
+#include "foundation/trace_event.h"
 
 namespace kraken::binding::jsc {
 
 using namespace kraken::foundation;
 
 void handleTimerCallback(BridgeCallback::Context *callbackContext, const char *errmsg) {
+  TRACE_EVENT("timer", "timerCallback");
   auto &_context = callbackContext->_context;
   JSValueRef exception = nullptr;
   if (callbackContext->_callback == nullptr) {
@@ -38,23 +40,24 @@ void handleTimerCallback(BridgeCallback::Context *callbackContext, const char *e
   _context.handleException(exception);
 }
 
-void handlePersistentCallback(void *ptr, int32_t contextId, const char *errmsg) {
-  auto *callbackContext = static_cast<BridgeCallback::Context *>(ptr);
+void handlePersistentCallback(void *handle, int32_t contextId, const char *errmsg) {
+  auto *callbackContext = getBridgeCallbackContext(contextId, handle);
+  if (callbackContext == nullptr) return;
   JSContext &_context = callbackContext->_context;
-  if (!checkContext(contextId, &_context)) return;
 
   if (!_context.isValid()) return;
 
   handleTimerCallback(callbackContext, errmsg);
 }
 
-void handleRAFTransientCallback(void *ptr, int32_t contextId, double highResTimeStamp, const char *errmsg) {
-  auto *callbackContext = static_cast<BridgeCallback::Context *>(ptr);
+void handleRAFTransientCallback(void *handle, int32_t contextId, double highResTimeStamp, const char *errmsg) {
+  auto *callbackContext = getBridgeCallbackContext(contextId, handle);
+  if (callbackContext == nullptr) return;
   JSContext &_context = callbackContext->_context;
-  if (!checkContext(contextId, &_context)) return;
 
   if (!_context.isValid()) return;
 
+  TRACE_EVENT("timer", "animationFrameCallback");
   JSValueRef exception = nullptr;
 
   if (callbackContext->_callback == nullptr) {
@@ -83,18 +86,17 @@ void handleRAFTransientCallback(void *ptr, int32_t contextId, double highResTime
   JSObjectCallAsFunction(_context.context(), callbackObjectRef, _context.global(), 1, args, &exception);
   _context.handleException(exception);
   auto bridge = static_cast<JSBridge *>(callbackContext->_context.getOwner());
-  bridge->bridgeCallback->freeBridgeCallbackContext(callbackContext);
+  bridge->bridgeCallback->freeBridgeCallbackContext(handle);
 }
 
-void handleTransientCallback(void *ptr, int32_t contextId, const char *errmsg) {
-  auto *callbackContext = static_cast<BridgeCallback::Context *>(ptr);
-  JSContext &_context = callbackContext->_context;
-  if (!checkContext(contextId, &_context)) return;
+void handleTransientCallback(void *handle, int32_t contextId, const char *errmsg) {
+  auto *callbackContext = getBridgeCallbackContext(contextId, handle);
+  if (callbackContext == nullptr) return;
 
   handleTimerCallback(callbackContext, errmsg);
 
   auto bridge = static_cast<JSBridge *>(callbackContext->_context.getOwner());
-  bridge->bridgeCallback->freeBridgeCallbackContext(callbackContext);
+  bridge->bridgeCallback->freeBridgeCallbackContext(handle);
 }
 
 JSValueRef setTimeout(JSContextRef ctx, JSObjectRef function, JSObjectRef thisObject, size_t argumentCount,
@@ -141,8 +143,8 @@ JSValueRef setTimeout(JSContextRef ctx, JSObjectRef function, JSObjectRef thisOb
   auto callbackContext = std::make_unique<BridgeCallback::Context>(*context, callbackObjectRef, exception);
   auto bridge = static_cast<JSBridge *>(context->getOwner());
   auto timerId = bridge->bridgeCallback->registerCallback<int32_t>(
-    std::move(callbackContext), [&timeout](BridgeCallback::Context *callbackContext, int32_t contextId) {
-      return getDartMethod()->setTimeout(callbackContext, contextId, handleTransientCallback, timeout);
+    std::move(callbackContext), [&timeout](BridgeCallback::Handle handle, int32_t contextId) {
+      return getDartMethod()->setTimeout(handle, contextId, handleTransientCallback, timeout);
     });
 
   // `-1` represents ffi error occurred.
@@ -199,8 +201,8 @@ JSValueRef setInterval(JSContextRef ctx, JSObjectRef function, JSObjectRef thisO
   auto callbackContext = std::make_unique<BridgeCallback::Context>(*context, callbackObjectRef, exception);
   auto bridge = static_cast<JSBridge *>(context->getOwner());
   auto timerId = bridge->bridgeCallback->registerCallback<int32_t>(
-    std::move(callbackContext), [&timeout](BridgeCallback::Context *callbackContext, int32_t contextId) {
-      return getDartMethod()->setInterval(callbackContext, contextId, handlePersistentCallback, timeout);
+    std::move(callbackContext), [&timeout](BridgeCallback::Handle handle, int32_t contextId) {
+      return getDartMethod()->setInterval(handle, contextId, handlePersistentCallback, timeout);
     });
 
   if (timerId == -1) {
@@ -313,8 +315,8 @@ JSValueRef requestAnimationFrame(JSContextRef ctx, JSObjectRef function, JSObjec
 
   auto bridge = static_cast<JSBridge *>(context->getOwner());
   int32_t requestId = bridge->bridgeCallback->registerCallback<int32_t>(
-    std::move(callbackContext), [](BridgeCallback::Context *callbackContext, int32_t contextId) {
-      return getDartMethod()->requestAnimationFrame(callbackContext, contextId, handleRAFTransientCallback);
+    std::move(callbackContext), [](BridgeCallback::Handle handle, int32_t contextId) {
+      return getDartMethod()->requestAnimationFrame(handle, contextId, handleRAFTransientCallback);
     });
 
   // `-1` represents some error occurred.
@@ -1,16 +0,0 @@
-/*
- * Copyright (C) 2020 Alibaba Inc. All rights reserved.
- * Author: Kraken Team.
- */
-
-#ifndef KRAKENBRIDGE_HOST_OBJECT_INTERNAL_H
-#define KRAKENBRIDGE_HOST_OBJECT_INTERNAL_H
-
-#include "js_context_internal.h"
-#include <unordered_map>
-
-namespace kraken::binding::jsc {
-
-} // namespace kraken::binding::jsc
-
-#endif // KRAKENBRIDGE_HOST_OBJECT_INTERNAL_H
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/host_class.h"
+
+namespace kraken::binding {
+
+class HostObjectBinding {
+public:
+  static JSValueRef getProperty(JSContextRef ctx, JSObjectRef object, JSStringRef propertyName,
+                                JSValueRef *exception) {
+    auto hostObject = static_cast<HostObject *>(JSObjectGetPrivate(object));
+    if (hostObject == nullptr) return nullptr;
+
+    ScriptValue error;
+    ScriptValue result = hostObject->getProperty(jsc::JSStringToStdString(propertyName), &error);
+    if (!error.empty()) {
+      *exception = error.raw();
+      return nullptr;
+    }
+    // Returning nullptr leaves the property to own properties and the prototype.
+    return result.raw();
+  }
+
+  static bool setProperty(JSContextRef ctx, JSObjectRef object, JSStringRef propertyName, JSValueRef value,
+                          JSValueRef *exception) {
+    auto hostObject = static_cast<HostObject *>(JSObjectGetPrivate(object));
+    if (hostObject == nullptr) return false;
+
+    ScriptValue error;
+    bool handled = hostObject->setProperty(jsc::JSStringToStdString(propertyName),
+                                           ScriptValue(hostObject->context, value), &error);
+    if (!error.empty()) {
+      *exception = error.raw();
+      return true;
+    }
+    return handled;
+  }
+
+  static void getPropertyNames(JSContextRef ctx, JSObjectRef object, JSPropertyNameAccumulatorRef accumulator) {
+    auto hostObject = static_cast<HostObject *>(JSObjectGetPrivate(object));
+    if (hostObject == nullptr) return;
+
+    std::vector<std::string> names;
+    hostObject->getPropertyNames(names);
+    for (auto &name : names) {
+      JSStringRef nameRef = JSStringCreateWithUTF8CString(name.c_str());
+      JSPropertyNameAccumulatorAddName(accumulator, nameRef);
+      JSStringRelease(nameRef);
+    }
+  }
+
+  static void finalize(JSObjectRef object) {
+    auto hostObject = static_cast<HostObject *>(JSObjectGetPrivate(object));
+    JSObjectSetPrivate(object, nullptr);
+    delete hostObject;
+  }
+
+  static void dispose(HostObject *hostObject) {
+    JSObjectSetPrivate(const_cast<JSObjectRef>(hostObject->object_), nullptr);
+    delete hostObject;
+  }
+
+  // Classes are not bound to a context, every host object shares one class.
+  static JSClassRef objectClass() {
+    static JSClassRef classRef = [] {
+      JSClassDefinition definition = kJSClassDefinitionEmpty;
+      definition.className = "HostObject";
+      definition.getProperty = getProperty;
+      definition.setProperty = setProperty;
+      definition.getPropertyNames = getPropertyNames;
+      definition.finalize = finalize;
+      return JSClassCreate(&definition);
+    }();
+    return classRef;
+  }
+
+  static void setHiddenProperty(JSContextRef ctx, JSObjectRef object, const char *name, JSValueRef value,
+                                JSPropertyAttributes attributes) {
+    JSStringRef nameRef = JSStringCreateWithUTF8CString(name);
+    JSObjectSetProperty(ctx, object, nameRef, value, attributes | kJSPropertyAttributeDontEnum, nullptr);
+    JSStringRelease(nameRef);
+  }
+};
+
+class HostClassBinding {
+public:
+  // The C API doesn't pass new.target, instances of subclasses defined by scripts get the prototype of this class.
+  static JSObjectRef callAsConstructor(JSContextRef ctx, JSObjectRef constructor, size_t argumentCount,
+                                       const JSValueRef arguments[], JSValueRef *exception) {
+    auto hostClass = static_cast<HostClass *>(JSObjectGetPrivate(constructor));
+    if (hostClass == nullptr) return nullptr;
+
+    ScriptValue error;
+    ScriptValue instance =
+      hostClass->construct(ScriptValue(), ScriptArguments(hostClass->context, argumentCount, arguments), &error);
+    if (instance.empty()) {
+      *exception = error.raw();
+      return nullptr;
+    }
+    return JSValueToObject(ctx, instance.raw(), nullptr);
+  }
+
+  static JSValueRef callAsFunction(JSContextRef ctx, JSObjectRef function, JSObjectRef thisObject,
+                                   size_t argumentCount, const JSValueRef arguments[], JSValueRef *exception) {
+    auto hostClass = static_cast<HostClass *>(JSObjectGetPrivate(function));
+    if (hostClass == nullptr) return nullptr;
+
+    ScriptContext *context = hostClass->context;
+    ScriptValue subclassObject =
+      thisObject == nullptr ? ScriptValue::undefined(context) : ScriptValue(context, thisObject);
+    ScriptValue error;
+    ScriptValue result =
+      hostClass->construct(subclassObject, ScriptArguments(context, argumentCount, arguments), &error);
+    if (result.empty()) {
+      *exception = error.raw();
+      return nullptr;
+    }
+    return result.raw();
+  }
+
+  static bool hasInstance(JSContextRef ctx, JSObjectRef constructor, JSValueRef possibleInstance,
+                          JSValueRef *exception) {
+    auto hostClass = static_cast<HostClass *>(JSObjectGetPrivate(constructor));
+    if (hostClass == nullptr) return false;
+    return hostClass->hasInstance(ScriptValue(hostClass->context, possibleInstance));
+  }
+
+  static JSClassRef constructorClass() {
+    static JSClassRef classRef = [] {
+      JSClassDefinition definition = kJSClassDefinitionEmpty;
+      definition.className = "Function";
+      definition.getProperty = HostObjectBinding::getProperty;
+      definition.setProperty = HostObjectBinding::setProperty;
+      definition.getPropertyNames = HostObjectBinding::getPropertyNames;
+      definition.finalize = HostObjectBinding::finalize;
+      definition.callAsConstructor = callAsConstructor;
+      definition.callAsFunction = callAsFunction;
+      definition.hasInstance = hasInstance;
+      return JSClassCreate(&definition);
+    }();
+    return classRef;
+  }
+};
+
+HostObject::HostObject(ScriptContext *context, std::string name, ObjectType type, const ScriptValue &prototype)
+  : name(std::move(name)), context(context), contextId(context->getContextId()) {
+  JSContextRef ctx = context->context();
+  bool isConstructor = type == ObjectType::kConstructor;
+  JSObjectRef object =
+    JSObjectMake(ctx, isConstructor ? HostClassBinding::constructorClass() : HostObjectBinding::objectClass(), this);
+  object_ = object;
+  link();
+
+  if (isConstructor) {
+    // Objects of a class are plain objects, call and apply come from Function.prototype.
+    ScriptValue parent =
+      prototype.empty() ? globalObject(context).getProperty("Function", nullptr).getProperty("prototype", nullptr)
+                        : prototype;
+    JSObjectSetPrototype(ctx, object, parent.raw());
+    JSStringRef nameRef = JSStringCreateWithUTF8CString(this->name.c_str());
+    HostObjectBinding::setHiddenProperty(ctx, object, "name", JSValueMakeString(ctx, nameRef),
+                                         kJSPropertyAttributeReadOnly);
+    JSStringRelease(nameRef);
+  } else if (!prototype.empty()) {
+    JSObjectSetPrototype(ctx, object, prototype.raw());
+  }
+}
+
+void HostObject::disposeAll(ScriptContext *context) {
+  while (context->lastHostObject != nullptr) {
+    HostObjectBinding::dispose(context->lastHostObject);
+  }
+}
+
+HostObject *ScriptValue::hostObject() const {
+  if (!isObject()) return nullptr;
+  JSContextRef ctx = context_->context();
+  if (!JSValueIsObjectOfClass(ctx, value_, HostObjectBinding::objectClass()) &&
+      !JSValueIsObjectOfClass(ctx, value_, HostClassBinding::constructorClass())) {
+    return nullptr;
+  }
+  return static_cast<HostObject *>(JSObjectGetPrivate(JSValueToObject(ctx, value_, nullptr)));
+}
+
+} // namespace kraken::binding
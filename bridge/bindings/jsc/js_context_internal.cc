@@ -6,7 +6,13 @@
 #include "js_context_internal.h"
 #include "bindings/jsc/KOM/timer.h"
 #include "bindings/jsc/kraken.h"
+#include "bindings/script/host_object.h"
 #include "dart_methods.h"
+#include "foundation/cookie_jar.h"
+#include "foundation/monotonic_clock.h"
+#include "foundation/trace_event.h"
+#include <JavaScriptCore/JSHeapFinalizerPrivate.h>
+#include <JavaScriptCore/JSMarkingConstraintPrivate.h>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -18,8 +24,32 @@ std::vector<JSStaticValue> JSContext::globalValue{};
 
 static std::atomic<int32_t> context_unique_id{0};
 
+namespace {
+
+// JavaScriptCore runs marking constraints when a collection starts marking, again on later fixpoint iterations and
+// possibly from several marker threads, and heap finalizers once the collection is done. The first constraint and
+// the finalizer bound the span of a collection.
+void traceCollectionStart(JSMarkerRef marker, void *userData) {
+  if (!::foundation::Tracing::isEnabled()) return;
+  auto gcStart = static_cast<std::atomic<int64_t> *>(userData);
+  int64_t none = -1;
+  gcStart->compare_exchange_strong(none, ::foundation::Tracing::now(), std::memory_order_relaxed);
+}
+
+void traceCollectionEnd(JSContextGroupRef group, void *userData) {
+  auto gcStart = static_cast<std::atomic<int64_t> *>(userData);
+  int64_t start = gcStart->exchange(-1, std::memory_order_relaxed);
+  if (start < 0 || !::foundation::Tracing::isEnabled()) return;
+  ::foundation::Tracing::record("gc", "collect", start, ::foundation::Tracing::now() - start);
+}
+
+} // namespace
+
 JSContext::JSContext(int32_t contextId, const JSExceptionHandler &handler, void *owner)
-  : contextId(contextId), _handler(handler), owner(owner), ctxInvalid_(false), uniqueId(context_unique_id++) {
+  : contextId(contextId), _handler(handler), owner(owner), ctxInvalid_(false), uniqueId(context_unique_id++),
+    uiCommandQueue_(foundation::UICommandTaskMessageQueue::instance(contextId)),
+    cookieJar_(std::make_unique<::foundation::CookieJar>()),
+    clock_(std::make_unique<::foundation::MonotonicClock>()) {
 
   JSClassDefinition contextDefinition = kJSClassDefinitionEmpty;
 
@@ -38,6 +68,11 @@ JSContext::JSContext(int32_t contextId, const JSExceptionHandler &handler, void
 
   ctx_ = JSGlobalContextCreateInGroup(nullptr, contextClass);
 
+  // The group is owned by this context, it's gone with ctx_ so the callbacks never outlive gcStart_.
+  JSContextGroupRef group = JSContextGetGroup(ctx_);
+  JSContextGroupAddMarkingConstraint(group, traceCollectionStart, &gcStart_);
+  JSContextGroupAddHeapFinalizer(group, traceCollectionEnd, &gcStart_);
+
   JSObjectRef global = JSContextGetGlobalObject(ctx_);
   JSObjectSetPrivate(global, this);
 
@@ -49,11 +84,13 @@ JSContext::JSContext(int32_t contextId, const JSExceptionHandler &handler, void
   JSStringRelease(windowName);
   JSStringRelease(globalThis);
 
-  timeOrigin = std::chrono::system_clock::now();
+  clock_->resetTimeOrigin();
 }
 
 JSContext::~JSContext() {
   ctxInvalid_ = true;
+  // Objects are finalized at the discretion of the collector, host objects are deleted while the context is alive.
+  binding::HostObject::disposeAll(this);
   JSGlobalContextRelease(ctx_);
 }
 
@@ -107,6 +144,20 @@ void *JSContext::getOwner() {
   return owner;
 }
 
+foundation::UICommandTaskMessageQueue *JSContext::getUICommandQueue() {
+  // Should be available when context is releasing, eventTargets need to dispose their dart side objects.
+  if (standbyCommandQueue_ != nullptr) return standbyCommandQueue_.get();
+  return uiCommandQueue_;
+}
+
+::foundation::CookieJar *JSContext::getCookieJar() {
+  return cookieJar_.get();
+}
+
+::foundation::MonotonicClock *JSContext::getClock() {
+  return clock_.get();
+}
+
 bool JSContext::handleException(JSValueRef exc) {
   if (JSC_UNLIKELY(exc)) {
     HANDLE_JSC_EXCEPTION(ctx_, exc, _handler);
@@ -128,6 +179,38 @@ void JSContext::reportError(const char *errmsg) {
   _handler(contextId, errmsg);
 }
 
+void JSContext::enterStandby() {
+  standby_ = true;
+  // The page running with the same contextId keeps its queue, commands of the warm-up are held back until activation.
+  standbyCommandQueue_ = std::make_unique<foundation::UICommandTaskMessageQueue>(contextId, true);
+}
+
+bool JSContext::isStandby() {
+  return standby_;
+}
+
+void JSContext::activate() {
+  if (!standby_) return;
+  standby_ = false;
+  // Page time starts when the context is handed out, not when it was pre-warmed.
+  clock_->resetTimeOrigin();
+  // Window, document and body are announced to dart first, the commands of the warm-up refer to them.
+  for (auto &task : activateTasks_) {
+    task();
+  }
+  activateTasks_.clear();
+  uiCommandQueue_->append(*standbyCommandQueue_);
+  standbyCommandQueue_.reset();
+}
+
+void JSContext::runWhenActive(const std::function<void()> &task) {
+  if (standby_) {
+    activateTasks_.emplace_back(task);
+    return;
+  }
+  task();
+}
+
 void throwJSError(JSContextRef ctx, const char *msg, JSValueRef *exception) {
   JSStringRef _errmsg = JSStringCreateWithUTF8CString(msg);
   const JSValueRef args[] = {JSValueMakeString(ctx, _errmsg), nullptr};
@@ -169,51 +252,39 @@ JSObjectRef JSObjectMakePromise(JSContext *context, void *data, JSObjectCallAsFu
 }
 
 namespace {
-const JSChar *cloneString(const JSChar *string, size_t length) {
-  auto *newString = new JSChar[length];
-  for (size_t i = 0; i < length; i++) {
-    newString[i] = string[i];
-  }
-  return newString;
-};
+// registerCommand() copies the args into the arena of UICommandTaskMessageQueue, so the args only need to live until
+// the command is registered and can share a per-thread buffer instead of allocating for each command.
+thread_local std::u16string uiCommandArgsBuffer[2];
+
+void assignUICommandArgs(std::u16string &buffer, const JSChar *string, size_t length, NativeString &args) {
+  buffer.assign(reinterpret_cast<const char16_t *>(string), length);
+  args.string = reinterpret_cast<const uint16_t *>(buffer.data());
+  args.length = buffer.size();
+}
+
+void assignUICommandArgs(std::u16string &buffer, const std::string &string, NativeString &args) {
+  JSStringRef stringRef = JSStringCreateWithUTF8CString(string.c_str());
+  assignUICommandArgs(buffer, JSStringGetCharactersPtr(stringRef), JSStringGetLength(stringRef), args);
+  JSStringRelease(stringRef);
+}
 } // namespace
 
 void buildUICommandArgs(JSStringRef key, NativeString &args_01) {
-  args_01.length = JSStringGetLength(key);
-  args_01.string = cloneString(JSStringGetCharactersPtr(key), args_01.length);
+  assignUICommandArgs(uiCommandArgsBuffer[0], JSStringGetCharactersPtr(key), JSStringGetLength(key), args_01);
 }
 
 void buildUICommandArgs(std::string &key, NativeString &args_01) {
-  JSStringRef keyStringRef = JSStringCreateWithUTF8CString(key.c_str());
-  args_01.length = JSStringGetLength(keyStringRef);
-  args_01.string = cloneString(JSStringGetCharactersPtr(keyStringRef), args_01.length);
-  JSStringRelease(keyStringRef);
+  assignUICommandArgs(uiCommandArgsBuffer[0], key, args_01);
 }
 
 void buildUICommandArgs(std::string &key, JSStringRef value, NativeString &args_01, NativeString &args_02) {
-  JSStringRef keyStringRef = JSStringCreateWithUTF8CString(key.c_str());
-
-  args_01.length = JSStringGetLength(keyStringRef);
-  args_01.string = cloneString(JSStringGetCharactersPtr(keyStringRef), args_01.length);
-
-  args_02.length = JSStringGetLength(value);
-  args_02.string = cloneString(JSStringGetCharactersPtr(value), args_02.length);
-
-  JSStringRelease(keyStringRef);
+  assignUICommandArgs(uiCommandArgsBuffer[0], key, args_01);
+  assignUICommandArgs(uiCommandArgsBuffer[1], JSStringGetCharactersPtr(value), JSStringGetLength(value), args_02);
 }
 
 void buildUICommandArgs(std::string &key, std::string &value, NativeString &args_01, NativeString &args_02) {
-  JSStringRef keyStringRef = JSStringCreateWithUTF8CString(key.c_str());
-  JSStringRef valueStringRef = JSStringCreateWithUTF8CString(value.c_str());
-
-  args_01.length = JSStringGetLength(keyStringRef);
-  args_01.string = cloneString(JSStringGetCharactersPtr(keyStringRef), args_01.length);
-
-  args_02.length = JSStringGetLength(valueStringRef);
-  args_02.string = cloneString(JSStringGetCharactersPtr(valueStringRef), args_02.length);
-
-  JSStringRelease(keyStringRef);
-  JSStringRelease(valueStringRef);
+  assignUICommandArgs(uiCommandArgsBuffer[0], key, args_01);
+  assignUICommandArgs(uiCommandArgsBuffer[1], value, args_02);
 }
 
 NativeString *stringToNativeString(std::string &string) {
@@ -314,8 +385,13 @@ JSValueRef JSValueHolder::value() {
 }
 
 void JSValueHolder::setValue(JSValueRef value) {
+  if (m_value != nullptr) {
+    JSValueUnprotect(m_context->context(), m_value);
+  }
   m_value = value;
-  JSValueProtect(m_context->context(), m_value);
+  if (m_value != nullptr) {
+    JSValueProtect(m_context->context(), m_value);
+  }
 }
 
 } // namespace kraken::binding::jsc
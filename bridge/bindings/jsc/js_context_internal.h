@@ -50,6 +50,18 @@ inline bool objectHasProperty(JSContextRef ctx, const std::string key, JSObjectR
   return result;
 }
 
+inline std::u16string JSStringToU16String(JSStringRef string) {
+  return std::u16string(reinterpret_cast<const char16_t *>(JSStringGetCharactersPtr(string)),
+                        JSStringGetLength(string));
+}
+
+inline JSValueRef makeU16StringValue(JSContextRef ctx, const std::u16string &string) {
+  JSStringRef stringRef = JSStringCreateWithCharacters(reinterpret_cast<const JSChar *>(string.data()), string.size());
+  JSValueRef result = JSValueMakeString(ctx, stringRef);
+  JSStringRelease(stringRef);
+  return result;
+}
+
 template <typename T> std::string toUTF8(const std::basic_string<T, std::char_traits<T>, std::allocator<T>> &source) {
   std::string result;
 
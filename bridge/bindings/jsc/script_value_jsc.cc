@@ -0,0 +1,474 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/script_value.h"
+#include "bridge_jsc.h"
+#include <pthread.h>
+
+namespace kraken::binding {
+
+namespace {
+
+struct FunctionData {
+  ScriptContext *context;
+  NativeFunction function;
+  void *data;
+};
+
+ScriptValue takeResult(ScriptContext *context, JSValueRef result, JSValueRef error, ScriptValue *exception) {
+  if (JSC_UNLIKELY(error != nullptr)) {
+    if (exception != nullptr) {
+      *exception = ScriptValue(context, error);
+    } else {
+      context->handleException(error);
+    }
+    return ScriptValue();
+  }
+  return ScriptValue(context, result);
+}
+
+JSValueRef callNativeFunction(JSContextRef ctx, JSObjectRef function, JSObjectRef thisObject, size_t argumentCount,
+                              const JSValueRef arguments[], JSValueRef *exception) {
+  auto data = static_cast<FunctionData *>(JSObjectGetPrivate(function));
+  ScriptContext *context = data->context;
+
+  ScriptValue error;
+  ScriptValue result = data->function(context, ScriptValue(context, thisObject),
+                                      ScriptArguments(context, argumentCount, arguments), data->data, &error);
+  if (!error.empty()) {
+    *exception = error.raw();
+    return nullptr;
+  }
+  return result.empty() ? JSValueMakeUndefined(ctx) : result.raw();
+}
+
+void finalizeNativeFunction(JSObjectRef function) {
+  delete static_cast<FunctionData *>(JSObjectGetPrivate(function));
+}
+
+// Classes are not bound to a context, one class is shared by all native functions.
+JSClassRef nativeFunctionClass() {
+  static JSClassRef functionClass = [] {
+    JSClassDefinition definition = kJSClassDefinitionEmpty;
+    definition.className = "Function";
+    definition.callAsFunction = callNativeFunction;
+    definition.finalize = finalizeNativeFunction;
+    return JSClassCreate(&definition);
+  }();
+  return functionClass;
+}
+
+JSObjectRef getGlobalObject(ScriptContext *context, const char *name) {
+  JSValueRef value = jsc::getObjectPropertyValue(context->context(), name, context->global(), nullptr);
+  return JSValueToObject(context->context(), value, nullptr);
+}
+
+ScriptValue makeErrorOf(ScriptContext *context, const char *constructorName, const std::string &message) {
+  JSContextRef ctx = context->context();
+  JSStringRef messageRef = JSStringCreateWithUTF8CString(message.c_str());
+  const JSValueRef arguments[] = {JSValueMakeString(ctx, messageRef)};
+  JSValueRef exception = nullptr;
+  JSObjectRef error =
+    JSObjectCallAsConstructor(ctx, getGlobalObject(context, constructorName), 1, arguments, &exception);
+  JSStringRelease(messageRef);
+  return takeResult(context, error, exception, nullptr);
+}
+
+void freeBytes(void *bytes, void *deallocatorContext) {
+  free(bytes);
+}
+
+uint8_t *copyBytes(const uint8_t *bytes, size_t length) {
+  auto buffer = static_cast<uint8_t *>(malloc(length == 0 ? 1 : length));
+  if (length > 0) memcpy(buffer, bytes, length);
+  return buffer;
+}
+
+JSStringRef toJSString(JSContextRef ctx, JSValueRef value) {
+  JSValueRef exception = nullptr;
+  JSStringRef string = JSValueToStringCopy(ctx, value, &exception);
+  return exception == nullptr ? string : nullptr;
+}
+
+// The highest address of the native stack of the current thread, the stack grows down from it.
+uintptr_t currentStackOrigin() {
+#if defined(__APPLE__)
+  return reinterpret_cast<uintptr_t>(pthread_get_stackaddr_np(pthread_self()));
+#else
+  pthread_attr_t attributes;
+  void *address = nullptr;
+  size_t size = 0;
+  pthread_getattr_np(pthread_self(), &attributes);
+  pthread_attr_getstack(&attributes, &address, &size);
+  pthread_attr_destroy(&attributes);
+  return reinterpret_cast<uintptr_t>(address) + size;
+#endif
+}
+
+// Whether address is in a frame of the native stack, which JavaScriptCore scans conservatively during collection.
+// Not inlined, so the frame of this function is below the frame of every caller.
+__attribute__((noinline)) bool isOnStack(const void *address) {
+  thread_local uintptr_t stackOrigin = currentStackOrigin();
+  auto value = reinterpret_cast<uintptr_t>(address);
+  return value >= reinterpret_cast<uintptr_t>(__builtin_frame_address(0)) && value < stackOrigin;
+}
+
+} // namespace
+
+// Constructors run where values are stored, copy elision included, so arguments, this objects and returned values
+// held in locals are never protected, and values copied or moved off the stack are.
+void ScriptValue::retain() {
+  if (empty() || isOnStack(this)) return;
+  JSValueProtect(context_->context(), value_);
+  protected_ = true;
+}
+
+void ScriptValue::release() {
+  // Host objects release their values in finalizers, which are called after the context is released.
+  if (protected_ && context_->isValid()) JSValueUnprotect(context_->context(), value_);
+  context_ = nullptr;
+  value_ = nullptr;
+  protected_ = false;
+}
+
+void ScriptValue::takeOver(ScriptValue &other) {
+  context_ = other.context_;
+  value_ = other.value_;
+  protected_ = other.protected_;
+  other.context_ = nullptr;
+  other.value_ = nullptr;
+  other.protected_ = false;
+  // A borrowed value moved off the stack.
+  if (!protected_) retain();
+}
+
+ScriptValue ScriptValue::adopt(ScriptContext *context, RawScriptValue value) {
+  return ScriptValue(context, value);
+}
+
+ScriptValue ScriptValue::undefined(ScriptContext *context) {
+  return ScriptValue(context, JSValueMakeUndefined(context->context()));
+}
+
+ScriptValue ScriptValue::null(ScriptContext *context) {
+  return ScriptValue(context, JSValueMakeNull(context->context()));
+}
+
+ScriptValue ScriptValue::makeBoolean(ScriptContext *context, bool value) {
+  return ScriptValue(context, JSValueMakeBoolean(context->context(), value));
+}
+
+ScriptValue ScriptValue::makeNumber(ScriptContext *context, double value) {
+  return ScriptValue(context, JSValueMakeNumber(context->context(), value));
+}
+
+ScriptValue ScriptValue::makeString(ScriptContext *context, const std::string &string) {
+  JSStringRef stringRef = JSStringCreateWithUTF8CString(string.c_str());
+  ScriptValue result(context, JSValueMakeString(context->context(), stringRef));
+  JSStringRelease(stringRef);
+  return result;
+}
+
+ScriptValue ScriptValue::makeString(ScriptContext *context, const std::u16string &string) {
+  return ScriptValue(context, jsc::makeU16StringValue(context->context(), string));
+}
+
+ScriptValue ScriptValue::makeObject(ScriptContext *context) {
+  return ScriptValue(context, JSObjectMake(context->context(), nullptr, nullptr));
+}
+
+ScriptValue ScriptValue::makeArray(ScriptContext *context, const std::vector<ScriptValue> &elements) {
+  std::vector<JSValueRef> values;
+  values.reserve(elements.size());
+  for (auto &element : elements) {
+    values.emplace_back(element.raw());
+  }
+  JSValueRef exception = nullptr;
+  JSObjectRef array = JSObjectMakeArray(context->context(), values.size(), values.data(), &exception);
+  return takeResult(context, array, exception, nullptr);
+}
+
+ScriptValue ScriptValue::makeError(ScriptContext *context, const std::string &message) {
+  return makeErrorOf(context, "TypeError", message);
+}
+
+ScriptValue ScriptValue::makeRangeError(ScriptContext *context, const std::string &message) {
+  return makeErrorOf(context, "RangeError", message);
+}
+
+ScriptValue ScriptValue::makeArrayBuffer(ScriptContext *context, const uint8_t *bytes, size_t length) {
+  JSValueRef exception = nullptr;
+  JSObjectRef buffer = JSObjectMakeArrayBufferWithBytesNoCopy(context->context(), copyBytes(bytes, length), length,
+                                                              freeBytes, nullptr, &exception);
+  return takeResult(context, buffer, exception, nullptr);
+}
+
+ScriptValue ScriptValue::makeUint8Array(ScriptContext *context, const uint8_t *bytes, size_t length) {
+  JSValueRef exception = nullptr;
+  JSObjectRef array =
+    JSObjectMakeTypedArrayWithBytesNoCopy(context->context(), kJSTypedArrayTypeUint8Array, copyBytes(bytes, length),
+                                          length, freeBytes, nullptr, &exception);
+  return takeResult(context, array, exception, nullptr);
+}
+
+ScriptValue ScriptValue::makeFunction(ScriptContext *context, const char *name, NativeFunction function,
+                                      void *data) {
+  JSContextRef ctx = context->context();
+  JSObjectRef result = JSObjectMake(ctx, nativeFunctionClass(), new FunctionData{context, function, data});
+  // Objects of a class are plain objects, call and apply come from Function.prototype.
+  JSValueRef functionPrototype =
+    jsc::getObjectPropertyValue(ctx, "prototype", getGlobalObject(context, "Function"), nullptr);
+  JSObjectSetPrototype(ctx, result, functionPrototype);
+
+  JSStringRef nameKey = JSStringCreateWithUTF8CString("name");
+  JSStringRef nameRef = JSStringCreateWithUTF8CString(name);
+  JSObjectSetProperty(ctx, result, nameKey, JSValueMakeString(ctx, nameRef),
+                      kJSPropertyAttributeReadOnly | kJSPropertyAttributeDontEnum, nullptr);
+  JSStringRelease(nameRef);
+  JSStringRelease(nameKey);
+  return ScriptValue(context, result);
+}
+
+ScriptValue ScriptValue::parseJSON(ScriptContext *context, const std::u16string &json) {
+  JSStringRef jsonRef = JSStringCreateWithCharacters(reinterpret_cast<const JSChar *>(json.c_str()), json.size());
+  JSValueRef result = JSValueMakeFromJSONString(context->context(), jsonRef);
+  JSStringRelease(jsonRef);
+  return result == nullptr ? ScriptValue() : ScriptValue(context, result);
+}
+
+bool ScriptValue::empty() const {
+  return value_ == nullptr;
+}
+
+bool ScriptValue::isUndefined() const {
+  return !empty() && JSValueIsUndefined(context_->context(), value_);
+}
+
+bool ScriptValue::isNull() const {
+  return !empty() && JSValueIsNull(context_->context(), value_);
+}
+
+bool ScriptValue::isBoolean() const {
+  return !empty() && JSValueIsBoolean(context_->context(), value_);
+}
+
+bool ScriptValue::isNumber() const {
+  return !empty() && JSValueIsNumber(context_->context(), value_);
+}
+
+bool ScriptValue::isString() const {
+  return !empty() && JSValueIsString(context_->context(), value_);
+}
+
+bool ScriptValue::isSymbol() const {
+  return !empty() && JSValueGetType(context_->context(), value_) == kJSTypeSymbol;
+}
+
+bool ScriptValue::isObject() const {
+  return !empty() && JSValueIsObject(context_->context(), value_);
+}
+
+bool ScriptValue::isFunction() const {
+  return isObject() && JSObjectIsFunction(context_->context(), JSValueToObject(context_->context(), value_, nullptr));
+}
+
+bool ScriptValue::isArray() const {
+  return !empty() && JSValueIsArray(context_->context(), value_);
+}
+
+bool ScriptValue::toBoolean() const {
+  return !empty() && JSValueToBoolean(context_->context(), value_);
+}
+
+double ScriptValue::toNumber() const {
+  if (empty()) return 0;
+  JSValueRef exception = nullptr;
+  double result = JSValueToNumber(context_->context(), value_, &exception);
+  return exception == nullptr ? result : 0;
+}
+
+std::string ScriptValue::toString() const {
+  if (empty()) return "";
+  JSStringRef string = toJSString(context_->context(), value_);
+  if (string == nullptr) return "";
+  std::string result = jsc::JSStringToStdString(string);
+  JSStringRelease(string);
+  return result;
+}
+
+std::u16string ScriptValue::toU16String() const {
+  if (empty()) return u"";
+  JSStringRef string = toJSString(context_->context(), value_);
+  if (string == nullptr) return u"";
+  std::u16string result = jsc::JSStringToU16String(string);
+  JSStringRelease(string);
+  return result;
+}
+
+uint8_t *ScriptValue::uint8ArrayBytes(size_t *length) const {
+  if (!isObject()) return nullptr;
+  JSContextRef ctx = context_->context();
+  if (JSValueGetTypedArrayType(ctx, value_, nullptr) != kJSTypedArrayTypeUint8Array) return nullptr;
+
+  JSObjectRef array = JSValueToObject(ctx, value_, nullptr);
+  // The pointer is already moved by the byte offset of the array.
+  auto bytes = static_cast<uint8_t *>(JSObjectGetTypedArrayBytesPtr(ctx, array, nullptr));
+  if (bytes == nullptr) return nullptr;
+  *length = JSObjectGetTypedArrayByteLength(ctx, array, nullptr);
+  return bytes;
+}
+
+uint8_t *ScriptValue::bufferSourceBytes(size_t *length) const {
+  if (!isObject()) return nullptr;
+  JSContextRef ctx = context_->context();
+  JSTypedArrayType type = JSValueGetTypedArrayType(ctx, value_, nullptr);
+  if (type == kJSTypedArrayTypeNone) return nullptr;
+
+  JSObjectRef object = JSValueToObject(ctx, value_, nullptr);
+  void *bytes;
+  if (type == kJSTypedArrayTypeArrayBuffer) {
+    *length = JSObjectGetArrayBufferByteLength(ctx, object, nullptr);
+    bytes = JSObjectGetArrayBufferBytesPtr(ctx, object, nullptr);
+  } else {
+    // The pointer is already moved by the byte offset of the array.
+    *length = JSObjectGetTypedArrayByteLength(ctx, object, nullptr);
+    bytes = JSObjectGetTypedArrayBytesPtr(ctx, object, nullptr);
+  }
+  // Empty buffers may have no storage, they are buffer sources all the same.
+  static uint8_t emptyStorage;
+  return bytes != nullptr ? static_cast<uint8_t *>(bytes) : &emptyStorage;
+}
+
+ScriptValue ScriptValue::toJSON(ScriptValue *exception) const {
+  JSValueRef error = nullptr;
+  JSStringRef json = JSValueCreateJSONString(context_->context(), value_, 0, &error);
+  if (error != nullptr) return takeResult(context_, nullptr, error, exception);
+  if (json == nullptr) return undefined(context_);
+  ScriptValue result(context_, JSValueMakeString(context_->context(), json));
+  JSStringRelease(json);
+  return result;
+}
+
+ScriptValue ScriptValue::getProperty(const std::string &name, ScriptValue *exception) const {
+  JSValueRef error = nullptr;
+  JSObjectRef object = JSValueToObject(context_->context(), value_, &error);
+  if (error != nullptr) return takeResult(context_, nullptr, error, exception);
+  JSValueRef result = jsc::getObjectPropertyValue(context_->context(), name, object, &error);
+  return takeResult(context_, result, error, exception);
+}
+
+void ScriptValue::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) const {
+  JSValueRef error = nullptr;
+  JSObjectRef object = JSValueToObject(context_->context(), value_, &error);
+  if (error == nullptr) {
+    JSStringRef key = JSStringCreateWithUTF8CString(name.c_str());
+    JSObjectSetProperty(context_->context(), object, key, value.raw(), kJSPropertyAttributeNone, &error);
+    JSStringRelease(key);
+  }
+  if (error != nullptr) takeResult(context_, nullptr, error, exception);
+}
+
+ScriptValue ScriptValue::getIndex(uint32_t index, ScriptValue *exception) const {
+  JSValueRef error = nullptr;
+  JSObjectRef object = JSValueToObject(context_->context(), value_, &error);
+  if (error != nullptr) return takeResult(context_, nullptr, error, exception);
+  JSValueRef result = JSObjectGetPropertyAtIndex(context_->context(), object, index, &error);
+  return takeResult(context_, result, error, exception);
+}
+
+bool ScriptValue::hasProperty(const std::string &name) const {
+  if (!isObject()) return false;
+  JSContextRef ctx = context_->context();
+  return jsc::objectHasProperty(ctx, name, JSValueToObject(ctx, value_, nullptr));
+}
+
+void ScriptValue::deleteProperty(const std::string &name, ScriptValue *exception) const {
+  JSValueRef error = nullptr;
+  JSObjectRef object = JSValueToObject(context_->context(), value_, &error);
+  if (error == nullptr) {
+    JSStringRef key = JSStringCreateWithUTF8CString(name.c_str());
+    JSObjectDeleteProperty(context_->context(), object, key, &error);
+    JSStringRelease(key);
+  }
+  if (error != nullptr) takeResult(context_, nullptr, error, exception);
+}
+
+void ScriptValue::defineHiddenProperty(const std::string &name, const ScriptValue &value) const {
+  JSContextRef ctx = context_->context();
+  JSObjectRef object = JSValueToObject(ctx, value_, nullptr);
+  if (object == nullptr) return;
+  JSStringRef key = JSStringCreateWithUTF8CString(name.c_str());
+  JSObjectSetProperty(ctx, object, key, value.raw(), kJSPropertyAttributeDontEnum, nullptr);
+  JSStringRelease(key);
+}
+
+ScriptValue ScriptValue::getPrototype() const {
+  if (!isObject()) return null(context_);
+  JSContextRef ctx = context_->context();
+  return ScriptValue(context_, JSObjectGetPrototype(ctx, JSValueToObject(ctx, value_, nullptr)));
+}
+
+void ScriptValue::setPrototype(const ScriptValue &prototype, ScriptValue *exception) const {
+  JSValueRef error = nullptr;
+  JSObjectRef object = JSValueToObject(context_->context(), value_, &error);
+  if (error != nullptr) {
+    takeResult(context_, nullptr, error, exception);
+    return;
+  }
+  JSObjectSetPrototype(context_->context(), object, prototype.raw());
+}
+
+bool ScriptValue::strictEquals(const ScriptValue &other) const {
+  if (empty() || other.empty()) return empty() && other.empty();
+  return JSValueIsStrictEqual(context_->context(), value_, other.value_);
+}
+
+ScriptValue ScriptValue::call(const ScriptValue &thisObject, const std::vector<ScriptValue> &arguments,
+                              ScriptValue *exception) const {
+  JSContextRef ctx = context_->context();
+  std::vector<JSValueRef> argv;
+  argv.reserve(arguments.size());
+  for (auto &argument : arguments) {
+    argv.emplace_back(argument.raw());
+  }
+
+  JSValueRef error = nullptr;
+  JSObjectRef function = JSValueToObject(ctx, value_, &error);
+  if (error != nullptr) return takeResult(context_, nullptr, error, exception);
+  JSObjectRef thisValue = thisObject.isObject() ? JSValueToObject(ctx, thisObject.raw(), nullptr) : nullptr;
+  JSValueRef result = JSObjectCallAsFunction(ctx, function, thisValue, argv.size(), argv.data(), &error);
+  return takeResult(context_, result, error, exception);
+}
+
+ScriptValue ScriptValue::construct(const std::vector<ScriptValue> &arguments, ScriptValue *exception) const {
+  JSContextRef ctx = context_->context();
+  std::vector<JSValueRef> argv;
+  argv.reserve(arguments.size());
+  for (auto &argument : arguments) {
+    argv.emplace_back(argument.raw());
+  }
+
+  JSValueRef error = nullptr;
+  JSObjectRef constructor = JSValueToObject(ctx, value_, &error);
+  if (error == nullptr && !JSObjectIsConstructor(ctx, constructor)) {
+    error = makeError(context_, "Value is not a constructor").raw();
+  }
+  if (error != nullptr) return takeResult(context_, nullptr, error, exception);
+  JSObjectRef result = JSObjectCallAsConstructor(ctx, constructor, argv.size(), argv.data(), &error);
+  return takeResult(context_, result, error, exception);
+}
+
+ScriptValue globalObject(ScriptContext *context) {
+  return ScriptValue(context, context->global());
+}
+
+void addModuleListener(ScriptContext *context, const std::u16string &moduleName, const ScriptValue &listener) {
+  // The bridge unprotects its listeners when it's disposed.
+  JSValueProtect(context->context(), listener.raw());
+  auto bridge = static_cast<JSBridge *>(context->getOwner());
+  bridge->addModuleListener(moduleName, JSValueToObject(context->context(), listener.raw(), nullptr));
+}
+
+} // namespace kraken::binding
@@ -5,8 +5,14 @@
 
 #include "ui_manager.h"
 #include "bridge_jsc.h"
+#include "bindings/script/KOM/blob.h"
+#include "bindings/script/KOM/cookie.h"
 #include "dart_methods.h"
 #include "foundation/bridge_callback.h"
+#include "foundation/trace_event.h"
+#include <cstdlib>
+#include <cstring>
+#include <memory>
 
 namespace kraken::binding::jsc {
 using namespace foundation;
@@ -19,17 +25,30 @@ JSValueRef krakenModuleListener(JSContextRef ctx, JSObjectRef function, JSObject
     return nullptr;
   }
 
-  const JSValueRef &callbackValue = arguments[0];
-  if (!JSValueIsObject(ctx, callbackValue)) {
-    throwJSError(ctx, "Failed to execute '__kraken_module_listener__': parameter 1 (callback) must be a function.",
-                 exception);
+  // __kraken_module_listener__(moduleName, callback) subscribes to a single module,
+  // __kraken_module_listener__(callback) subscribes to all modules.
+  JSStringRef moduleNameStringRef = nullptr;
+  const JSValueRef *callbackValue = &arguments[0];
+  if (JSValueIsString(ctx, arguments[0])) {
+    if (argumentCount < 2) {
+      throwJSError(ctx, "Failed to execute '__kraken_module_listener__': 2 parameters required, but only 1 present.",
+                   exception);
+      return nullptr;
+    }
+    moduleNameStringRef = JSValueToStringCopy(ctx, arguments[0], exception);
+    callbackValue = &arguments[1];
+  }
+
+  if (!JSValueIsObject(ctx, *callbackValue)) {
+    if (moduleNameStringRef != nullptr) JSStringRelease(moduleNameStringRef);
+    throwJSError(ctx, "Failed to execute '__kraken_module_listener__': callback must be a function.", exception);
     return nullptr;
   }
 
-  JSObjectRef callbackObject = JSValueToObject(ctx, callbackValue, exception);
+  JSObjectRef callbackObject = JSValueToObject(ctx, *callbackValue, exception);
   if (!JSObjectIsFunction(ctx, callbackObject)) {
-    throwJSError(ctx, "Failed to execute '__kraken_module_listener__': parameter 1 (callback) must be a function.",
-                 exception);
+    if (moduleNameStringRef != nullptr) JSStringRelease(moduleNameStringRef);
+    throwJSError(ctx, "Failed to execute '__kraken_module_listener__': callback must be a function.", exception);
     return nullptr;
   }
 
@@ -37,18 +56,26 @@ JSValueRef krakenModuleListener(JSContextRef ctx, JSObjectRef function, JSObject
   auto bridge = static_cast<JSBridge *>(context->getOwner());
 
   JSValueProtect(ctx, callbackObject);
-  bridge->krakenModuleListenerList.push_back(callbackObject);
+  if (moduleNameStringRef == nullptr) {
+    bridge->addModuleListener(callbackObject);
+  } else {
+    std::u16string moduleName(reinterpret_cast<const char16_t *>(JSStringGetCharactersPtr(moduleNameStringRef)),
+                              JSStringGetLength(moduleNameStringRef));
+    JSStringRelease(moduleNameStringRef);
+    bridge->addModuleListener(moduleName, callbackObject);
+  }
 
   return nullptr;
 }
 
 void handleInvokeModuleTransientCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
-                                         NativeString *json) {
-  auto *obj = static_cast<BridgeCallback::Context *>(callbackContext);
+                                         NativeString *json, uint8_t *bytes, int32_t length) {
+  // The bridge owns the bytes dart handed over, they're freed here unless an ArrayBuffer takes them.
+  std::unique_ptr<uint8_t, decltype(&free)> payload(bytes, free);
+  auto *obj = getBridgeCallbackContext(contextId, callbackContext);
+  if (obj == nullptr) return;
   JSContext &_context = obj->_context;
 
-  if (!checkContext(contextId, &_context)) return;
-
   if (!_context.isValid()) return;
 
   JSValueRef exception = nullptr;
@@ -75,20 +102,62 @@ void handleInvokeModuleTransientCallback(void *callbackContext, int32_t contextI
   } else {
     JSStringRef argumentsString = JSStringCreateWithCharacters(json->string, json->length);
     JSValueRef jsonValue = JSValueMakeFromJSONString(ctx, argumentsString);
+    JSStringRelease(argumentsString);
+
+    // Binary payload are passed as an ArrayBuffer in the third argument, which wraps the bytes without copying.
+    JSValueRef bytesValue = JSValueMakeUndefined(ctx);
+    if (length >= 0) {
+      bytesValue = JSObjectMakeArrayBufferWithBytesNoCopy(
+        ctx, payload.release(), length, [](void *bytes, void *deallocatorContext) { free(bytes); }, nullptr,
+        &exception);
+    }
 
-    const JSValueRef arguments[] = {JSValueMakeNull(ctx), jsonValue};
+    const JSValueRef arguments[] = {JSValueMakeNull(ctx), jsonValue, bytesValue};
 
-    JSObjectCallAsFunction(ctx, callback, obj->_context.global(), 2, arguments, &exception);
+    JSObjectCallAsFunction(ctx, callback, obj->_context.global(), 3, arguments, &exception);
   }
 
   _context.handleException(exception);
 
   auto bridge = static_cast<JSBridge *>(obj->_context.getOwner());
-  bridge->bridgeCallback->freeBridgeCallbackContext(obj);
+  bridge->bridgeCallback->freeBridgeCallbackContext(callbackContext);
+}
+
+namespace {
+
+// Fetch responses go through here before the callback of the page, which never sees their Set-Cookie headers.
+struct FetchCallbackContext : BridgeCallback::Context {
+  FetchCallbackContext(JSContext &context, JSValueRef callback, JSValueRef *exception)
+    : BridgeCallback::Context(context, callback, exception) {}
+  std::string url;
+  FetchCredentials credentials{FetchCredentials::sameOrigin};
+};
+
+void handleFetchTransientCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
+                                  NativeString *json, uint8_t *bytes, int32_t length) {
+  // Only fetch requests are registered with this callback.
+  auto *fetch = static_cast<FetchCallbackContext *>(getBridgeCallbackContext(contextId, callbackContext));
+  if (fetch == nullptr || !fetch->_context.isValid()) {
+    free(bytes);
+    return;
+  }
+
+  if (errmsg != nullptr || json == nullptr) {
+    handleInvokeModuleTransientCallback(callbackContext, contextId, errmsg, json, bytes, length);
+    return;
+  }
+
+  std::u16string stripped =
+    storeFetchCookies(&fetch->_context, fetch->url, fetch->credentials,
+                      std::u16string(reinterpret_cast<const char16_t *>(json->string), json->length));
+  NativeString response{reinterpret_cast<const uint16_t *>(stripped.c_str()), static_cast<int32_t>(stripped.size())};
+  handleInvokeModuleTransientCallback(callbackContext, contextId, nullptr, &response, bytes, length);
 }
 
+} // namespace
+
 void handleInvokeModuleUnexpectedCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
-                                          NativeString *json) {
+                                          NativeString *json, uint8_t *bytes, int32_t length) {
   static_assert("Unexpected module callback, please check your invokeModule implementation on the dart side.");
 }
 
@@ -108,46 +177,69 @@ JSValueRef krakenInvokeModule(JSContextRef ctx, JSObjectRef function, JSObjectRe
     paramsStringRef = JSValueCreateJSONString(ctx, arguments[2], 0, exception);
   }
 
+  auto context = static_cast<JSContext *>(JSObjectGetPrivate(function));
+
+  // Cookies of fetch requests never pass through the page, see attachFetchCookies().
+  bool isFetch = JSStringIsEqualToUTF8CString(moduleNameStringRef, "Fetch");
+  std::string fetchUrl;
+  FetchCredentials credentials{FetchCredentials::sameOrigin};
+  if (isFetch) {
+    fetchUrl = JSStringToStdString(methodStringRef);
+    std::u16string fetchParams =
+      attachFetchCookies(context, fetchUrl, paramsStringRef == nullptr ? u"" : JSStringToU16String(paramsStringRef),
+                         &credentials);
+    if (paramsStringRef != nullptr) JSStringRelease(paramsStringRef);
+    paramsStringRef =
+      JSStringCreateWithCharacters(reinterpret_cast<const JSChar *>(fetchParams.c_str()), fetchParams.size());
+  }
+
   if (argumentCount > 3 && JSValueIsObject(ctx, arguments[3])) {
     callbackValueRef = JSValueToObject(ctx, arguments[3], exception);
   }
 
+  // Binary payload are passed by pointer, dart side copy the bytes before invokeModule returns.
+  uint8_t *bytes = nullptr;
+  int32_t length = -1;
+  if (argumentCount > 4 && JSValueIsObject(ctx, arguments[4]) &&
+      !getBinaryPayload(ScriptValue(context, arguments[4]), &bytes, &length)) {
+    throwJSError(ctx,
+                 "Failed to execute '__kraken_invoke_module__': parameter 5 (data) must be an ArrayBuffer, "
+                 "ArrayBufferView or Blob.",
+                 exception);
+    return nullptr;
+  }
+
   if (getDartMethod()->invokeModule == nullptr) {
     throwJSError(ctx, "Failed to execute '__kraken_invoke_module__': dart method (invokeModule) is not registered.",
                  exception);
     return nullptr;
   }
 
-  std::unique_ptr<BridgeCallback::Context> callbackContext = nullptr;
-  auto context = static_cast<JSContext *>(JSObjectGetPrivate(function));
-
   NativeString *moduleName = stringRefToNativeString(moduleNameStringRef);
   NativeString *method = stringRefToNativeString(methodStringRef);
   NativeString *params = paramsStringRef == nullptr ? nullptr : stringRefToNativeString(paramsStringRef);
 
-  if (callbackValueRef == nullptr) {
-    JSObjectCallAsFunctionCallback emptyCallback = [](JSContextRef ctx, JSObjectRef function, JSObjectRef thisObject,
-                                                      size_t argumentCount, const JSValueRef arguments[],
-                                                      JSValueRef *exception) -> JSValueRef { return nullptr; };
-    JSObjectRef callbackValue =
-      JSObjectMakeFunctionWithCallback(ctx, JSStringCreateWithUTF8CString("f"), emptyCallback);
-    callbackContext = std::make_unique<BridgeCallback::Context>(*context, callbackValue, exception);
-  } else {
-    callbackContext = std::make_unique<BridgeCallback::Context>(*context, callbackValueRef, exception);
-  }
-
   auto bridge = static_cast<JSBridge *>(context->getOwner());
   NativeString *result;
   if (callbackValueRef != nullptr) {
+    std::unique_ptr<BridgeCallback::Context> callbackContext;
+    AsyncModuleCallback callback = handleInvokeModuleTransientCallback;
+    if (isFetch) {
+      auto fetch = std::make_unique<FetchCallbackContext>(*context, callbackValueRef, exception);
+      fetch->url = std::move(fetchUrl);
+      fetch->credentials = credentials;
+      callbackContext = std::move(fetch);
+      callback = handleFetchTransientCallback;
+    } else {
+      callbackContext = std::make_unique<BridgeCallback::Context>(*context, callbackValueRef, exception);
+    }
     result = bridge->bridgeCallback->registerCallback<NativeString *>(
       std::move(callbackContext),
-      [moduleName, method, params](BridgeCallback::Context *bridgeContext, int32_t contextId) {
-        NativeString *response = getDartMethod()->invokeModule(bridgeContext, contextId, moduleName, method, params,
-                                                               handleInvokeModuleTransientCallback);
-        return response;
+      [moduleName, method, params, bytes, length, callback](BridgeCallback::Handle handle, int32_t contextId) {
+        return getDartMethod()->invokeModule(handle, contextId, moduleName, method, params, bytes, length, callback);
       });
   } else {
-    result = getDartMethod()->invokeModule(callbackContext.get(), context->getContextId(), moduleName, method, params,
+    result = getDartMethod()->invokeModule(nullptr, context->getContextId(), moduleName, method, params, bytes, length,
                                            handleInvokeModuleUnexpectedCallback);
   }
 
@@ -175,6 +267,7 @@ JSValueRef flushUICommand(JSContextRef ctx, JSObjectRef function, JSObjectRef th
                  exception);
     return nullptr;
   }
+  TRACE_EVENT("bridge", "flushUICommand");
   getDartMethod()->flushUICommand();
   return nullptr;
 }
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "timer.h"
+#include "bridge_qjs.h"
+#include "dart_methods.h"
+#include "foundation/bridge_callback.h"
+#include "foundation/trace_event.h"
+
+namespace kraken::binding::qjs {
+
+using namespace kraken::foundation;
+
+namespace {
+
+void callTimerCallback(BridgeCallback::Context *callbackContext, const char *errmsg, int argc, JSValueConst *argv) {
+  JSContext &_context = callbackContext->_context;
+  ::JSContext *ctx = _context.context();
+
+  if (errmsg != nullptr) {
+    // throw JSError inside of dart function callback will directly cause crash
+    // so we handle it instead of throw
+    _context.handleException(throwJSError(ctx, errmsg));
+    return;
+  }
+
+  if (!JS_IsFunction(ctx, callbackContext->_callback)) return;
+
+  JSValue result = _context.callFunction(callbackContext->_callback, JS_UNDEFINED, argc, argv);
+  _context.handleException(result);
+  JS_FreeValue(ctx, result);
+  _context.drainPendingPromiseJobs();
+}
+
+void freeCallbackContext(BridgeCallback::Context *callbackContext, BridgeCallback::Handle handle) {
+  auto bridge = static_cast<JSBridge *>(callbackContext->_context.getOwner());
+  bridge->bridgeCallback->freeBridgeCallbackContext(handle);
+}
+
+void handlePersistentCallback(void *handle, int32_t contextId, const char *errmsg) {
+  auto *callbackContext = getBridgeCallbackContext(contextId, handle);
+  if (callbackContext == nullptr || !callbackContext->_context.isValid()) return;
+
+  TRACE_EVENT("timer", "timerCallback");
+  callTimerCallback(callbackContext, errmsg, 0, nullptr);
+}
+
+void handleTransientCallback(void *handle, int32_t contextId, const char *errmsg) {
+  auto *callbackContext = getBridgeCallbackContext(contextId, handle);
+  if (callbackContext == nullptr || !callbackContext->_context.isValid()) return;
+
+  TRACE_EVENT("timer", "timerCallback");
+  callTimerCallback(callbackContext, errmsg, 0, nullptr);
+  freeCallbackContext(callbackContext, handle);
+}
+
+void handleRAFTransientCallback(void *handle, int32_t contextId, double highResTimeStamp, const char *errmsg) {
+  auto *callbackContext = getBridgeCallbackContext(contextId, handle);
+  if (callbackContext == nullptr || !callbackContext->_context.isValid()) return;
+
+  TRACE_EVENT("timer", "animationFrameCallback");
+  JSValue args[]{JS_NewFloat64(callbackContext->_context.context(), highResTimeStamp)};
+  callTimerCallback(callbackContext, errmsg, 1, args);
+  freeCallbackContext(callbackContext, handle);
+}
+
+// setTimeout and setInterval only differ in the dart method they call and how their callback context is freed.
+JSValue scheduleTimer(::JSContext *ctx, int argc, JSValueConst *argv, const char *name, bool repeat) {
+  std::string method = std::string("Failed to execute '") + name + "': ";
+  if (argc < 1) {
+    return throwJSError(ctx, (method + "1 argument required, but only 0 present.").c_str());
+  }
+
+  if (!JS_IsFunction(ctx, argv[0])) {
+    return throwJSError(ctx, (method + "parameter 1 (callback) must be a function.").c_str());
+  }
+
+  int32_t timeout = 0;
+  if (argc >= 2 && !JS_IsUndefined(argv[1])) {
+    if (!JS_IsNumber(argv[1])) {
+      return throwJSError(ctx, (method + "parameter 2 (timeout) only can be a number or undefined.").c_str());
+    }
+    JS_ToInt32(ctx, &timeout, argv[1]);
+  }
+
+  auto dartMethod = repeat ? getDartMethod()->setInterval : getDartMethod()->setTimeout;
+  if (dartMethod == nullptr) {
+    return throwJSError(ctx, (method + "dart method (" + name + ") is not registered.").c_str());
+  }
+
+  JSContext *context = getContext(ctx);
+  auto callbackContext = std::make_unique<BridgeCallback::Context>(*context, argv[0]);
+  auto bridge = static_cast<JSBridge *>(context->getOwner());
+  auto timerId = bridge->bridgeCallback->registerCallback<int32_t>(
+    std::move(callbackContext),
+    [dartMethod, repeat, timeout](BridgeCallback::Handle handle, int32_t contextId) {
+      return dartMethod(handle, contextId, repeat ? handlePersistentCallback : handleTransientCallback, timeout);
+    });
+
+  // `-1` represents ffi error occurred.
+  if (timerId == -1) {
+    return throwJSError(ctx, (method + "dart method (" + name + ") execute failed").c_str());
+  }
+
+  return JS_NewInt32(ctx, timerId);
+}
+
+JSValue setTimeout(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  return scheduleTimer(ctx, argc, argv, "setTimeout", false);
+}
+
+JSValue setInterval(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  return scheduleTimer(ctx, argc, argv, "setInterval", true);
+}
+
+JSValue clearTimeout(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (argc <= 0) {
+    return throwJSError(ctx, "Failed to execute 'clearTimeout': 1 argument required, but only 0 present.");
+  }
+
+  if (!JS_IsNumber(argv[0])) return JS_UNDEFINED;
+
+  int32_t id;
+  JS_ToInt32(ctx, &id, argv[0]);
+
+  if (getDartMethod()->clearTimeout == nullptr) {
+    return throwJSError(ctx, "Failed to execute 'clearTimeout': dart method (clearTimeout) is not registered.");
+  }
+
+  getDartMethod()->clearTimeout(getContext(ctx)->getContextId(), id);
+  return JS_UNDEFINED;
+}
+
+JSValue requestAnimationFrame(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (argc <= 0) {
+    return throwJSError(ctx, "Failed to execute 'requestAnimationFrame': 1 argument required, but only 0 present.");
+  }
+
+  if (!JS_IsFunction(ctx, argv[0])) {
+    return throwJSError(ctx, "Failed to execute 'requestAnimationFrame': parameter 1 (callback) must be a function.");
+  }
+
+  if (getDartMethod()->flushUICommand == nullptr) {
+    return throwJSError(
+      ctx, "Failed to execute '__kraken_flush_ui_command__': dart method (flushUICommand) is not registered.");
+  }
+  // Flush all pending ui messages.
+  getDartMethod()->flushUICommand();
+
+  if (getDartMethod()->requestAnimationFrame == nullptr) {
+    return throwJSError(
+      ctx, "Failed to execute 'requestAnimationFrame': dart method (requestAnimationFrame) is not registered.");
+  }
+
+  JSContext *context = getContext(ctx);
+  auto callbackContext = std::make_unique<BridgeCallback::Context>(*context, argv[0]);
+  auto bridge = static_cast<JSBridge *>(context->getOwner());
+  int32_t requestId = bridge->bridgeCallback->registerCallback<int32_t>(
+    std::move(callbackContext), [](BridgeCallback::Handle handle, int32_t contextId) {
+      return getDartMethod()->requestAnimationFrame(handle, contextId, handleRAFTransientCallback);
+    });
+
+  // `-1` represents some error occurred.
+  if (requestId == -1) {
+    return throwJSError(ctx, "Failed to execute 'requestAnimationFrame': dart method (requestAnimationFrame) "
+                             "executed with unexpected error.");
+  }
+
+  return JS_NewInt32(ctx, requestId);
+}
+
+JSValue cancelAnimationFrame(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (argc <= 0) {
+    return throwJSError(ctx, "Failed to execute 'cancelAnimationFrame': 1 argument required, but only 0 present.");
+  }
+
+  if (!JS_IsNumber(argv[0])) {
+    return throwJSError(ctx, "Failed to execute 'cancelAnimationFrame': parameter 1 (timer) is not a timer kind.");
+  }
+
+  int32_t id;
+  JS_ToInt32(ctx, &id, argv[0]);
+
+  if (getDartMethod()->cancelAnimationFrame == nullptr) {
+    return throwJSError(
+      ctx, "Failed to execute 'cancelAnimationFrame': dart method (cancelAnimationFrame) is not registered.");
+  }
+
+  getDartMethod()->cancelAnimationFrame(getContext(ctx)->getContextId(), id);
+  return JS_UNDEFINED;
+}
+
+} // namespace
+
+void bindTimer(JSContext *context) {
+  bindGlobalFunction(context, "setTimeout", setTimeout, 2);
+  bindGlobalFunction(context, "setInterval", setInterval, 2);
+  bindGlobalFunction(context, "requestAnimationFrame", requestAnimationFrame, 1);
+  bindGlobalFunction(context, "clearTimeout", clearTimeout, 1);
+  bindGlobalFunction(context, "clearInterval", clearTimeout, 1);
+  bindGlobalFunction(context, "cancelAnimationFrame", cancelAnimationFrame, 1);
+}
+
+} // namespace kraken::binding::qjs
@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_QJS_TIMER_H
+#define KRAKENBRIDGE_QJS_TIMER_H
+
+#include "bindings/qjs/js_context_internal.h"
+
+namespace kraken::binding::qjs {
+
+void bindTimer(JSContext *context);
+
+} // namespace kraken::binding::qjs
+
+#endif // KRAKENBRIDGE_QJS_TIMER_H
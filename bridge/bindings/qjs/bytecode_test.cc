@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/qjs/js_context_internal.h"
+#include "polyfill.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace kraken::binding::qjs;
+
+namespace {
+
+std::vector<uint8_t> compile(const std::string &source) {
+  JSRuntime *runtime = JS_NewRuntime();
+  ::JSContext *ctx = JS_NewContext(runtime);
+  JSValue function = JS_Eval(ctx, source.c_str(), source.size(), "internal://",
+                             JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+  size_t size;
+  uint8_t *bytes = JS_WriteObject(ctx, &size, function, JS_WRITE_OBJ_BYTECODE);
+  std::vector<uint8_t> result(bytes, bytes + size);
+  js_free(ctx, bytes);
+  JS_FreeValue(ctx, function);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+  return result;
+}
+
+std::string globalString(kraken::binding::qjs::JSContext *context, const char *name) {
+  ::JSContext *ctx = context->context();
+  JSValue global = context->global();
+  JSValue value = JS_GetPropertyStr(ctx, global, name);
+  std::string result = jsValueToStdString(ctx, value);
+  JS_FreeValue(ctx, value);
+  JS_FreeValue(ctx, global);
+  return result;
+}
+
+} // namespace
+
+TEST(ByteCode, polyfillIsCompiledByBundledQuickJS) {
+  EXPECT_STREQ(krakenPolyFillByteCodeVersion, QUICKJS_VERSION);
+
+  JSRuntime *runtime = JS_NewRuntime();
+  ::JSContext *ctx = JS_NewContext(runtime);
+  JSValue function = JS_ReadObject(ctx, krakenPolyFillByteCode, krakenPolyFillByteCodeLength, JS_READ_OBJ_BYTECODE);
+  EXPECT_FALSE(JS_IsException(function));
+  JS_FreeValue(ctx, function);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(ByteCode, evaluateByteCode) {
+  std::vector<std::string> errors;
+  auto context = createJSContext(0, [&](int32_t contextId, const char *errmsg) { errors.emplace_back(errmsg); },
+                                 nullptr);
+  std::vector<uint8_t> bytes = compile("var answer = 'answer is ' + (6 * 7);");
+
+  EXPECT_TRUE(context->evaluateByteCode(bytes.data(), bytes.size()));
+  EXPECT_EQ(globalString(context.get(), "answer"), "answer is 42");
+  EXPECT_TRUE(errors.empty());
+}
+
+TEST(ByteCode, reportsErrorsThrownByByteCode) {
+  std::vector<std::string> errors;
+  auto context = createJSContext(0, [&](int32_t contextId, const char *errmsg) { errors.emplace_back(errmsg); },
+                                 nullptr);
+  std::vector<uint8_t> bytes = compile("throw new Error('failed');");
+
+  EXPECT_FALSE(context->evaluateByteCode(bytes.data(), bytes.size()));
+  ASSERT_EQ(errors.size(), 1);
+  EXPECT_EQ(errors[0].find("Error: failed"), 0);
+}
+
+TEST(ByteCode, rejectsByteCodeOfAnotherVersion) {
+  std::vector<std::string> errors;
+  auto context = createJSContext(0, [&](int32_t contextId, const char *errmsg) { errors.emplace_back(errmsg); },
+                                 nullptr);
+  std::vector<uint8_t> bytes = compile("var answer = 42;");
+  // The first byte is the bytecode format version of QuickJS.
+  bytes[0]++;
+
+  EXPECT_FALSE(context->evaluateByteCode(bytes.data(), bytes.size()));
+  ASSERT_EQ(errors.size(), 1);
+  EXPECT_NE(errors[0].find("invalid version"), std::string::npos);
+}
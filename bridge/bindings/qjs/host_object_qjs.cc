@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/host_class.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+namespace {
+
+// Class ids are shared by all runtimes, classes are registered to each runtime when they are first used in it.
+JSClassID hostObjectClassId{0};
+JSClassID hostClassClassId{0};
+
+JSValue getGlobalPrototype(::JSContext *ctx, const char *constructorName) {
+  JSValue global = JS_GetGlobalObject(ctx);
+  JSValue constructor = JS_GetPropertyStr(ctx, global, constructorName);
+  JSValue prototype = JS_GetPropertyStr(ctx, constructor, "prototype");
+  JS_FreeValue(ctx, constructor);
+  JS_FreeValue(ctx, global);
+  return prototype;
+}
+
+// Symbols are left to the engine, host objects only see string keys.
+bool atomToName(::JSContext *ctx, JSAtom atom, std::string &name) {
+  JSValue key = JS_AtomToValue(ctx, atom);
+  bool isString = JS_IsString(key);
+  if (isString) name = qjs::jsValueToStdString(ctx, key);
+  JS_FreeValue(ctx, key);
+  return isString;
+}
+
+int throwException(::JSContext *ctx, const ScriptValue &exception) {
+  JS_Throw(ctx, JS_DupValue(ctx, exception.raw()));
+  return -1;
+}
+
+HostObject *getHostObject(JSValueConst object) {
+  void *hostObject = JS_GetOpaque(object, hostObjectClassId);
+  if (hostObject == nullptr) hostObject = JS_GetOpaque(object, hostClassClassId);
+  return static_cast<HostObject *>(hostObject);
+}
+
+int exoticGetOwnProperty(::JSContext *ctx, JSPropertyDescriptor *desc, JSValueConst object, JSAtom atom) {
+  HostObject *hostObject = getHostObject(object);
+  std::string name;
+  if (hostObject == nullptr || !atomToName(ctx, atom, name)) return false;
+
+  ScriptValue exception;
+  ScriptValue result = hostObject->getProperty(name, &exception);
+  if (!exception.empty()) return throwException(ctx, exception);
+  if (result.empty()) return false;
+
+  if (desc != nullptr) {
+    desc->flags = JS_PROP_ENUMERABLE | JS_PROP_CONFIGURABLE | JS_PROP_WRITABLE;
+    desc->value = JS_DupValue(ctx, result.raw());
+    desc->getter = JS_UNDEFINED;
+    desc->setter = JS_UNDEFINED;
+  }
+  return true;
+}
+
+int exoticGetOwnPropertyNames(::JSContext *ctx, JSPropertyEnum **ptab, uint32_t *plen, JSValueConst object) {
+  HostObject *hostObject = getHostObject(object);
+  std::vector<std::string> names;
+  if (hostObject != nullptr) hostObject->getPropertyNames(names);
+
+  // QuickJS frees the table with js_free, it must not be empty.
+  size_t tableSize = sizeof(JSPropertyEnum) * std::max<size_t>(names.size(), 1);
+  auto table = static_cast<JSPropertyEnum *>(js_malloc(ctx, tableSize));
+  if (table == nullptr) return -1;
+  for (size_t i = 0; i < names.size(); i++) {
+    table[i].is_enumerable = true;
+    table[i].atom = JS_NewAtomLen(ctx, names[i].c_str(), names[i].size());
+  }
+  *ptab = table;
+  *plen = names.size();
+  return 0;
+}
+
+int exoticSetProperty(::JSContext *ctx, JSValueConst object, JSAtom atom, JSValueConst value, JSValueConst receiver,
+                      int flags) {
+  HostObject *hostObject = getHostObject(object);
+  std::string name;
+  if (hostObject != nullptr && atomToName(ctx, atom, name)) {
+    ScriptValue exception;
+    bool handled = hostObject->setProperty(name, ScriptValue(hostObject->context, value), &exception);
+    if (!exception.empty()) return throwException(ctx, exception);
+    if (handled) return true;
+  }
+  // Properties not taken by the host object are stored by the engine, later reads and writes find them as own
+  // properties before asking the host object.
+  return JS_DefinePropertyValue(ctx, receiver, atom, JS_DupValue(ctx, value), JS_PROP_C_W_E | JS_PROP_THROW);
+}
+
+JSClassExoticMethods hostObjectExoticMethods{};
+
+void registerClass(JSRuntime *runtime, JSClassID &classId, const JSClassDef &classDef) {
+  if (classId == 0) JS_NewClassID(&classId);
+  if (!JS_IsRegisteredClass(runtime, classId)) JS_NewClass(runtime, classId, &classDef);
+}
+
+} // namespace
+
+class HostObjectBinding {
+public:
+  static void finalize(JSRuntime *rt, JSValue value) {
+    delete getHostObject(value);
+  }
+
+  static void dispose(HostObject *hostObject) {
+    JS_SetOpaque(hostObject->object_, nullptr);
+    delete hostObject;
+  }
+};
+
+class HostClassBinding {
+public:
+  static JSValue call(::JSContext *ctx, JSValueConst constructor, JSValueConst thisObject, int argc,
+                      JSValueConst *argv, int flags) {
+    auto hostClass = static_cast<HostClass *>(JS_GetOpaque(constructor, hostClassClassId));
+    if (hostClass == nullptr) return JS_ThrowTypeError(ctx, "Illegal constructor");
+
+    ScriptContext *context = hostClass->context;
+    bool isConstructorCall = flags & JS_CALL_FLAG_CONSTRUCTOR;
+    ScriptValue exception;
+    // thisObject of a constructor call is new.target.
+    ScriptValue result =
+      hostClass->construct(isConstructorCall ? ScriptValue() : ScriptValue(context, thisObject),
+                           ScriptArguments(context, argc, argv), &exception);
+    if (result.empty()) return JS_Throw(ctx, JS_DupValue(ctx, exception.raw()));
+
+    // Subclasses defined by scripts construct with their own prototype.
+    if (isConstructorCall && JS_VALUE_GET_PTR(thisObject) != JS_VALUE_GET_PTR(constructor)) {
+      JSValue prototype = JS_GetPropertyStr(ctx, thisObject, "prototype");
+      if (JS_IsException(prototype)) return prototype;
+      if (JS_IsObject(prototype)) JS_SetPrototype(ctx, result.raw(), prototype);
+      JS_FreeValue(ctx, prototype);
+    }
+    return JS_DupValue(ctx, result.raw());
+  }
+};
+
+HostObject::HostObject(ScriptContext *context, std::string name, ObjectType type, const ScriptValue &prototype)
+  : name(std::move(name)), context(context), contextId(context->getContextId()) {
+  ::JSContext *ctx = context->context();
+  JSRuntime *runtime = context->runtime();
+  hostObjectExoticMethods.get_own_property = exoticGetOwnProperty;
+  hostObjectExoticMethods.get_own_property_names = exoticGetOwnPropertyNames;
+  hostObjectExoticMethods.set_property = exoticSetProperty;
+
+  JSClassDef classDef{};
+  classDef.finalizer = HostObjectBinding::finalize;
+  classDef.exotic = &hostObjectExoticMethods;
+  bool isConstructor = type == ObjectType::kConstructor;
+  if (isConstructor) {
+    classDef.class_name = "Function";
+    classDef.call = HostClassBinding::call;
+    registerClass(runtime, hostClassClassId, classDef);
+  } else {
+    classDef.class_name = "HostObject";
+    registerClass(runtime, hostObjectClassId, classDef);
+  }
+
+  JSValue proto;
+  if (!prototype.empty()) {
+    proto = JS_DupValue(ctx, prototype.raw());
+  } else {
+    proto = getGlobalPrototype(ctx, isConstructor ? "Function" : "Object");
+  }
+  JSValue object = JS_NewObjectProtoClass(ctx, proto, isConstructor ? hostClassClassId : hostObjectClassId);
+  JS_FreeValue(ctx, proto);
+  JS_SetOpaque(object, this);
+  object_ = object;
+  link();
+
+  if (isConstructor) {
+    JS_SetConstructorBit(ctx, object, true);
+    JS_DefinePropertyValueStr(ctx, object, "name", JS_NewString(ctx, this->name.c_str()), JS_PROP_CONFIGURABLE);
+  } else {
+    // The object is created with a reference, which is kept until native code returns to the outermost script, or to
+    // dart. Scripts and other objects referencing the object by then keep it alive.
+    context->autorelease(object);
+  }
+}
+
+void HostObject::disposeAll(ScriptContext *context) {
+  while (context->lastHostObject != nullptr) {
+    HostObjectBinding::dispose(context->lastHostObject);
+  }
+}
+
+HostObject *ScriptValue::hostObject() const {
+  if (!isObject()) return nullptr;
+  return getHostObject(value_);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "js_context_internal.h"
+#include "bindings/qjs/KOM/timer.h"
+#include "bindings/script/host_object.h"
+#include "foundation/cookie_jar.h"
+#include "foundation/monotonic_clock.h"
+#include "foundation/trace_event.h"
+#include "foundation/ui_command_queue.h"
+
+namespace kraken::binding::qjs {
+
+static std::atomic<int32_t> context_unique_id{0};
+
+namespace {
+
+void trackPromiseRejection(::JSContext *ctx, JSValueConst promise, JSValueConst reason, JS_BOOL isHandled,
+                           void *opaque) {
+  if (isHandled) return;
+  auto context = static_cast<JSContext *>(opaque);
+  std::string message = "Uncaught (in promise) " + jsValueToStdString(ctx, reason);
+  JSValue stack = JS_GetPropertyStr(ctx, reason, "stack");
+  if (JS_IsString(stack)) message += '\n' + jsValueToStdString(ctx, stack);
+  JS_FreeValue(ctx, stack);
+  while (!message.empty() && message.back() == '\n') message.pop_back();
+  context->reportError(message.c_str());
+}
+
+// QuickJS frees most objects by reference counting, collections only free cycles. They run on the JS thread, when
+// allocations cross the threshold of the runtime and when it's freed.
+void traceCollection(JSRuntime *runtime, JS_BOOL done, void *opaque) {
+  auto gcStart = static_cast<int64_t *>(opaque);
+  if (!done) {
+    *gcStart = ::foundation::Tracing::isEnabled() ? ::foundation::Tracing::now() : -1;
+    return;
+  }
+  if (*gcStart < 0) return;
+  ::foundation::Tracing::record("gc", "collect", *gcStart, ::foundation::Tracing::now() - *gcStart);
+  *gcStart = -1;
+}
+
+} // namespace
+
+JSContext::EntryScope::EntryScope(JSContext *context) : context_(context) {
+  if (context_->entryDepth_++ == 0) JS_UpdateStackTop(context_->runtime_);
+}
+
+JSContext::EntryScope::~EntryScope() {
+  if (--context_->entryDepth_ == 0) context_->releaseAutoreleased();
+}
+
+JSContext::JSContext(int32_t contextId, const JSExceptionHandler &handler, void *owner)
+  : contextId(contextId), _handler(handler), owner(owner), ctxInvalid_(false), uniqueId(context_unique_id++),
+    uiCommandQueue_(foundation::UICommandTaskMessageQueue::instance(contextId)),
+    cookieJar_(std::make_unique<::foundation::CookieJar>()),
+    clock_(std::make_unique<::foundation::MonotonicClock>()) {
+  runtime_ = JS_NewRuntime();
+  ctx_ = JS_NewContext(runtime_);
+  JS_SetContextOpaque(ctx_, this);
+  JS_SetHostPromiseRejectionTracker(runtime_, trackPromiseRejection, this);
+  JS_SetGCObserver(runtime_, traceCollection, &gcStart_);
+
+  JSValue globalObject = JS_GetGlobalObject(ctx_);
+  JS_SetPropertyStr(ctx_, globalObject, "window", JS_DupValue(ctx_, globalObject));
+  JS_FreeValue(ctx_, globalObject);
+
+  bindTimer(this);
+
+  clock_->resetTimeOrigin();
+}
+
+JSContext::~JSContext() {
+  ctxInvalid_ = true;
+  releaseAutoreleased();
+  // QuickJS checks every object is freed with the runtime, host objects release the values they hold.
+  binding::HostObject::disposeAll(this);
+  JS_FreeContext(ctx_);
+  JS_FreeRuntime(runtime_);
+}
+
+bool JSContext::evaluateJavaScript(const uint16_t *code, size_t codeLength, const char *sourceURL, int startLine) {
+  return evaluateJavaScript(reinterpret_cast<const char16_t *>(code), codeLength, sourceURL, startLine);
+}
+
+bool JSContext::evaluateJavaScript(const char16_t *code, size_t length, const char *sourceURL, int startLine) {
+  // JS_Eval reads a null terminated UTF-8 buffer, and lines are counted from the start of the source.
+  std::string utf8Code = toUTF8(std::u16string(code, length));
+  EntryScope scope(this);
+  JSValue result = JS_Eval(ctx_, utf8Code.c_str(), utf8Code.size(), sourceURL == nullptr ? "" : sourceURL,
+                           JS_EVAL_TYPE_GLOBAL);
+  bool succeed = handleException(result);
+  JS_FreeValue(ctx_, result);
+  drainPendingPromiseJobs();
+  return succeed;
+}
+
+bool JSContext::evaluateByteCode(const uint8_t *bytes, size_t byteLength) {
+  EntryScope scope(this);
+  JSValue function = JS_ReadObject(ctx_, bytes, byteLength, JS_READ_OBJ_BYTECODE);
+  if (!handleException(function)) return false;
+  return evaluateFunction(function);
+}
+
+bool JSContext::evaluateFunction(JSValue function) {
+  // JS_EvalFunction takes the ownership of function.
+  JSValue result = JS_EvalFunction(ctx_, function);
+  bool succeed = handleException(result);
+  JS_FreeValue(ctx_, result);
+  drainPendingPromiseJobs();
+  return succeed;
+}
+
+bool JSContext::isValid() {
+  return !ctxInvalid_;
+}
+
+int32_t JSContext::getContextId() {
+  assert(!ctxInvalid_ && "context has been released");
+  return contextId;
+}
+
+void *JSContext::getOwner() {
+  assert(!ctxInvalid_ && "context has been released");
+  return owner;
+}
+
+foundation::UICommandTaskMessageQueue *JSContext::getUICommandQueue() {
+  // Should be available when context is releasing, eventTargets need to dispose their dart side objects.
+  if (standbyCommandQueue_ != nullptr) return standbyCommandQueue_.get();
+  return uiCommandQueue_;
+}
+
+::foundation::CookieJar *JSContext::getCookieJar() {
+  return cookieJar_.get();
+}
+
+::foundation::MonotonicClock *JSContext::getClock() {
+  return clock_.get();
+}
+
+JSValue JSContext::callFunction(JSValueConst function, JSValueConst thisObject, int argc, JSValueConst *argv) {
+  EntryScope scope(this);
+  return JS_Call(ctx_, function, thisObject, argc, argv);
+}
+
+void JSContext::autorelease(JSValue value) {
+  autoreleased_.emplace_back(value);
+}
+
+void JSContext::releaseAutoreleased() {
+  // Releasing a value may finalize objects which autorelease values of their own.
+  while (!autoreleased_.empty()) {
+    std::vector<JSValue> values;
+    values.swap(autoreleased_);
+    for (JSValue value : values) {
+      JS_FreeValueRT(runtime_, value);
+    }
+  }
+}
+
+bool JSContext::handleException(JSValueConst value) {
+  if (QJS_LIKELY(!JS_IsException(value))) return true;
+  JSValue error = JS_GetException(ctx_);
+  reportException(error);
+  JS_FreeValue(ctx_, error);
+  return false;
+}
+
+void JSContext::reportException(JSValueConst error) {
+  std::string message = jsValueToStdString(ctx_, error);
+  if (JS_IsError(ctx_, error)) {
+    JSValue stack = JS_GetPropertyStr(ctx_, error, "stack");
+    if (JS_IsString(stack)) message += '\n' + jsValueToStdString(ctx_, stack);
+    JS_FreeValue(ctx_, stack);
+  }
+  // Stack of QuickJS ends with a line break.
+  while (!message.empty() && message.back() == '\n') message.pop_back();
+  _handler(contextId, message.c_str());
+}
+
+void JSContext::drainPendingPromiseJobs() {
+  EntryScope scope(this);
+  ::JSContext *jobContext;
+  int result;
+  while ((result = JS_ExecutePendingJob(runtime_, &jobContext)) != 0) {
+    if (result < 0) {
+      JSValue error = JS_GetException(jobContext);
+      reportException(error);
+      JS_FreeValue(jobContext, error);
+    }
+  }
+}
+
+JSValue JSContext::global() {
+  return JS_GetGlobalObject(ctx_);
+}
+
+::JSContext *JSContext::context() {
+  assert(!ctxInvalid_ && "context has been released");
+  return ctx_;
+}
+
+JSRuntime *JSContext::runtime() {
+  return runtime_;
+}
+
+void JSContext::reportError(const char *errmsg) {
+  _handler(contextId, errmsg);
+}
+
+void JSContext::enterStandby() {
+  standby_ = true;
+  // The page running with the same contextId keeps its queue, commands of the warm-up are held back until activation.
+  standbyCommandQueue_ = std::make_unique<foundation::UICommandTaskMessageQueue>(contextId, true);
+}
+
+bool JSContext::isStandby() {
+  return standby_;
+}
+
+void JSContext::activate() {
+  if (!standby_) return;
+  standby_ = false;
+  // Page time starts when the context is handed out, not when it was pre-warmed.
+  clock_->resetTimeOrigin();
+  // Window, document and body are announced to dart first, the commands of the warm-up refer to them.
+  for (auto &task : activateTasks_) {
+    task();
+  }
+  activateTasks_.clear();
+  uiCommandQueue_->append(*standbyCommandQueue_);
+  standbyCommandQueue_.reset();
+}
+
+void JSContext::runWhenActive(const std::function<void()> &task) {
+  if (standby_) {
+    activateTasks_.emplace_back(task);
+    return;
+  }
+  task();
+}
+
+// Strings cross the QuickJS API as CESU-8, which encodes each UTF-16 code unit on its own. Unlike UTF-8 it keeps lone
+// surrogates, so conversions are lossless and never fail.
+JSValue newU16String(::JSContext *ctx, const uint16_t *string, size_t length) {
+  std::string cesu8;
+  cesu8.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    uint16_t c = string[i];
+    if (c < 0x80) {
+      cesu8 += static_cast<char>(c);
+    } else if (c < 0x800) {
+      cesu8 += static_cast<char>(0xC0 | (c >> 6));
+      cesu8 += static_cast<char>(0x80 | (c & 0x3F));
+    } else {
+      cesu8 += static_cast<char>(0xE0 | (c >> 12));
+      cesu8 += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+      cesu8 += static_cast<char>(0x80 | (c & 0x3F));
+    }
+  }
+  return JS_NewStringLen(ctx, cesu8.c_str(), cesu8.size());
+}
+
+std::string jsValueToStdString(::JSContext *ctx, JSValueConst value) {
+  size_t length;
+  const char *string = JS_ToCStringLen(ctx, &length, value);
+  if (string == nullptr) {
+    // Converting objects may throw, the exception is dropped as there is nothing to print instead.
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return "";
+  }
+  std::string result(string, length);
+  JS_FreeCString(ctx, string);
+  return result;
+}
+
+std::u16string jsValueToU16String(::JSContext *ctx, JSValueConst value) {
+  size_t length;
+  std::u16string result;
+  auto string = reinterpret_cast<const uint8_t *>(JS_ToCStringLen2(ctx, &length, value, true));
+  if (string == nullptr) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return result;
+  }
+  result.reserve(length);
+  for (size_t i = 0; i < length;) {
+    uint8_t c = string[i];
+    if (c < 0x80) {
+      result += c;
+      i += 1;
+    } else if (c < 0xE0) {
+      result += ((c & 0x1F) << 6) | (string[i + 1] & 0x3F);
+      i += 2;
+    } else {
+      result += ((c & 0x0F) << 12) | ((string[i + 1] & 0x3F) << 6) | (string[i + 2] & 0x3F);
+      i += 3;
+    }
+  }
+  JS_FreeCString(ctx, reinterpret_cast<const char *>(string));
+  return result;
+}
+
+NativeString *jsValueToNativeString(::JSContext *ctx, JSValueConst value) {
+  std::u16string utf16 = jsValueToU16String(ctx, value);
+  NativeString tmp{};
+  tmp.string = reinterpret_cast<const uint16_t *>(utf16.c_str());
+  tmp.length = utf16.size();
+  return tmp.clone();
+}
+
+JSValue throwJSError(::JSContext *ctx, const char *msg) {
+  return JS_ThrowTypeError(ctx, "%s", msg);
+}
+
+void bindGlobalFunction(JSContext *context, const char *name, JSCFunction *function, int length) {
+  ::JSContext *ctx = context->context();
+  JSValue globalObject = context->global();
+  JS_SetPropertyStr(ctx, globalObject, name, JS_NewCFunction(ctx, function, name, length));
+  JS_FreeValue(ctx, globalObject);
+}
+
+std::unique_ptr<JSContext> createJSContext(int32_t contextId, const JSExceptionHandler &handler, void *owner) {
+  return std::make_unique<JSContext>(contextId, handler, owner);
+}
+
+} // namespace kraken::binding::qjs
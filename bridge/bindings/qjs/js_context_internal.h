@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_QJS_JS_CONTEXT_INTERNAL_H
+#define KRAKENBRIDGE_QJS_JS_CONTEXT_INTERNAL_H
+
+#include "include/kraken_bridge.h"
+#include "third_party/quickjs/quickjs.h"
+#include <atomic>
+#include <codecvt>
+#include <functional>
+#include <locale>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef __has_builtin
+#define __has_builtin(x) 0
+#endif
+
+#if __has_builtin(__builtin_expect) || defined(__GNUC__)
+#define QJS_LIKELY(EXPR) __builtin_expect((bool)(EXPR), true)
+#define QJS_UNLIKELY(EXPR) __builtin_expect((bool)(EXPR), false)
+#else
+#define QJS_LIKELY(EXPR) (EXPR)
+#define QJS_UNLIKELY(EXPR) (EXPR)
+#endif
+
+using JSExceptionHandler = std::function<void(int32_t contextId, const char *errmsg)>;
+
+namespace foundation {
+class UICommandTaskMessageQueue;
+class CookieJar;
+class MonotonicClock;
+} // namespace foundation
+
+namespace kraken::binding {
+class HostObject;
+} // namespace kraken::binding
+
+namespace kraken::binding::qjs {
+
+// Owns the QuickJS runtime and context of a page. Every page gets a runtime of its own, so the heap of a page is
+// measured and freed with it.
+class JSContext {
+public:
+  JSContext() = delete;
+  JSContext(int32_t contextId, const JSExceptionHandler &handler, void *owner);
+  ~JSContext();
+
+  bool evaluateJavaScript(const uint16_t *code, size_t codeLength, const char *sourceURL, int startLine);
+  bool evaluateJavaScript(const char16_t *code, size_t length, const char *sourceURL, int startLine);
+  // Evaluate a script precompiled by JS_WriteObject, which skips parsing. Bytecode written by another QuickJS version
+  // is rejected and reported as an error.
+  bool evaluateByteCode(const uint8_t *bytes, size_t byteLength);
+
+  bool isValid();
+
+  // A new reference of the global object, free it with JS_FreeValue.
+  JSValue global();
+  ::JSContext *context();
+  JSRuntime *runtime();
+
+  int32_t getContextId();
+
+  void *getOwner();
+
+  // The ui command queue of this context, hold by context to avoid looking up queue for every commands.
+  foundation::UICommandTaskMessageQueue *getUICommandQueue();
+
+  // Cookies of document.cookie and network requests made by this context.
+  ::foundation::CookieJar *getCookieJar();
+  // Monotonic time anchored at the time origin of this context, which performance and events are timed with.
+  ::foundation::MonotonicClock *getClock();
+
+  // Call into JavaScript from native. Dart calls back from frames above the one the runtime was created in, so the
+  // stack top is anchored again when entering, otherwise QuickJS reports a stack overflow.
+  JSValue callFunction(JSValueConst function, JSValueConst thisObject, int argc, JSValueConst *argv);
+
+  // Report and clear the pending exception when value is JS_EXCEPTION. The value itself is not freed.
+  bool handleException(JSValueConst value);
+
+  // QuickJS doesn't run promise jobs by itself, they are drained each time native code has called into JavaScript.
+  void drainPendingPromiseJobs();
+
+  void reportError(const char *errmsg);
+
+  // Pre-warmed contexts are kept in standby until they are handed out by the context pool. Notifications to dart
+  // which are keyed by contextId are deferred with runWhenActive() so a standby context never replaces the native
+  // pointers of the page currently running with the same contextId. UI commands of a standby context are kept in a
+  // queue of its own, they are replayed into the queue of the contextId when the context is activated.
+  void enterStandby();
+  bool isStandby();
+  void activate();
+  void runWhenActive(const std::function<void()> &task);
+
+  // Anchor the stack top of the runtime when entering JavaScript from native code. Nested entries, such as module
+  // callbacks dart calls synchronously, keep the anchor of the outermost entry which still has frames running.
+  // Values given to autorelease() are released when the outermost scope is left.
+  class EntryScope {
+  public:
+    explicit EntryScope(JSContext *context);
+    ~EntryScope();
+
+  private:
+    JSContext *context_;
+  };
+
+  // Release the reference of value when native code returns to the outermost script or to dart, for objects created
+  // natively which nothing has referenced yet.
+  void autorelease(JSValue value);
+
+  int32_t uniqueId;
+
+  // Objects and bytes held natively by this context. Instances update them when they are created and finalized, so
+  // reading them costs nothing.
+  struct MemoryCounters {
+    int64_t eventTargetCount{0};
+    int64_t nodeCount{0};
+    int64_t blobBytes{0};
+  };
+  MemoryCounters memoryCounters;
+
+  // The newest host object alive in this context, see HostObject::disposeAll().
+  binding::HostObject *lastHostObject{nullptr};
+
+private:
+  void releaseAutoreleased();
+  void reportException(JSValueConst error);
+  // Evaluate a function read from bytecode, the function is freed.
+  bool evaluateFunction(JSValue function);
+
+  int32_t contextId;
+  JSExceptionHandler _handler;
+  void *owner;
+  std::atomic<bool> ctxInvalid_{false};
+  foundation::UICommandTaskMessageQueue *uiCommandQueue_;
+  std::unique_ptr<::foundation::CookieJar> cookieJar_;
+  std::unique_ptr<::foundation::MonotonicClock> clock_;
+  bool standby_{false};
+  std::unique_ptr<foundation::UICommandTaskMessageQueue> standbyCommandQueue_;
+  std::vector<std::function<void()>> activateTasks_;
+  JSRuntime *runtime_{nullptr};
+  ::JSContext *ctx_{nullptr};
+  int entryDepth_{0};
+  std::vector<JSValue> autoreleased_;
+  // Start of the collection in progress for tracing, -1 when there's none.
+  int64_t gcStart_{-1};
+};
+
+template <typename T> std::string toUTF8(const std::basic_string<T, std::char_traits<T>, std::allocator<T>> &source) {
+  std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
+  return convertor.to_bytes(source);
+}
+
+template <typename T>
+void fromUTF8(const std::string &source, std::basic_string<T, std::char_traits<T>, std::allocator<T>> &result) {
+  std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
+  result = convertor.from_bytes(source);
+}
+
+// QuickJS strings are UTF-8 at its API, NativeString and the UI commands are UTF-16.
+JSValue newU16String(::JSContext *ctx, const uint16_t *string, size_t length);
+std::u16string jsValueToU16String(::JSContext *ctx, JSValueConst value);
+std::string jsValueToStdString(::JSContext *ctx, JSValueConst value);
+NativeString *jsValueToNativeString(::JSContext *ctx, JSValueConst value);
+
+// Throw a TypeError with msg and return JS_EXCEPTION, for returning from function callbacks.
+JSValue throwJSError(::JSContext *ctx, const char *msg);
+
+// The kraken context a QuickJS context belongs to, it's kept as the opaque pointer of the QuickJS context.
+inline JSContext *getContext(::JSContext *ctx) {
+  return static_cast<JSContext *>(JS_GetContextOpaque(ctx));
+}
+
+void bindGlobalFunction(JSContext *context, const char *name, JSCFunction *function, int length);
+
+std::unique_ptr<JSContext> createJSContext(int32_t contextId, const JSExceptionHandler &handler, void *owner);
+
+} // namespace kraken::binding::qjs
+
+#endif // KRAKENBRIDGE_QJS_JS_CONTEXT_INTERNAL_H
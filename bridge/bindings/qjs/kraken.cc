@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "kraken.h"
+#include "kraken_bridge.h"
+
+namespace kraken::binding::qjs {
+
+void bindKraken(std::unique_ptr<JSContext> &context) {
+  ::JSContext *ctx = context->context();
+  JSValue kraken = JS_NewObject(ctx);
+  KrakenInfo *krakenInfo = getKrakenInfo();
+
+  // Other properties are injected by dart.
+  JS_SetPropertyStr(ctx, kraken, "userAgent", JS_NewString(ctx, krakenInfo->getUserAgent(krakenInfo)));
+
+  JSValue globalObject = context->global();
+  JS_SetPropertyStr(ctx, globalObject, "__kraken__", kraken);
+  JS_FreeValue(ctx, globalObject);
+}
+
+} // namespace kraken::binding::qjs
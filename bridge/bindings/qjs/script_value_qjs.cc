@@ -0,0 +1,397 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/script_value.h"
+#include "bridge_qjs.h"
+
+namespace kraken::binding {
+
+namespace {
+
+// Native functions keep their callback in an ArrayBuffer of their function data, which is freed with the function.
+struct FunctionData {
+  NativeFunction function;
+  void *data;
+};
+
+ScriptValue takeResult(ScriptContext *context, JSValue result, ScriptValue *exception) {
+  if (QJS_UNLIKELY(JS_IsException(result))) {
+    if (exception != nullptr) {
+      *exception = ScriptValue::adopt(context, JS_GetException(context->context()));
+    } else {
+      context->handleException(result);
+    }
+    return ScriptValue();
+  }
+  return ScriptValue::adopt(context, result);
+}
+
+JSValue callNativeFunction(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv, int magic,
+                           JSValue *functionData) {
+  size_t size;
+  auto data = reinterpret_cast<FunctionData *>(JS_GetArrayBuffer(ctx, &size, functionData[0]));
+  ScriptContext *context = qjs::getContext(ctx);
+
+  ScriptValue exception;
+  ScriptValue result = data->function(context, ScriptValue(context, thisVal), ScriptArguments(context, argc, argv),
+                                      data->data, &exception);
+  if (!exception.empty()) {
+    return JS_Throw(ctx, JS_DupValue(ctx, exception.raw()));
+  }
+  return result.empty() ? JS_UNDEFINED : JS_DupValue(ctx, result.raw());
+}
+
+JSValue getGlobalProperty(ScriptContext *context, const char *name) {
+  ::JSContext *ctx = context->context();
+  JSValue global = context->global();
+  JSValue value = JS_GetPropertyStr(ctx, global, name);
+  JS_FreeValue(ctx, global);
+  return value;
+}
+
+ScriptValue makeErrorOf(ScriptContext *context, const char *constructorName, const std::string &message) {
+  ::JSContext *ctx = context->context();
+  JSValue constructor = getGlobalProperty(context, constructorName);
+  JSValue messageValue = JS_NewStringLen(ctx, message.c_str(), message.size());
+  JSValue error = JS_CallConstructor(ctx, constructor, 1, &messageValue);
+  JS_FreeValue(ctx, messageValue);
+  JS_FreeValue(ctx, constructor);
+  return takeResult(context, error, nullptr);
+}
+
+} // namespace
+
+void ScriptValue::retain() {
+  if (!empty()) JS_DupValueRT(context_->runtime(), value_);
+}
+
+void ScriptValue::release() {
+  // Host objects release their values in finalizers, which are called after the context is marked as released.
+  if (!empty()) JS_FreeValueRT(context_->runtime(), value_);
+  context_ = nullptr;
+  value_ = JS_UNINITIALIZED;
+}
+
+void ScriptValue::takeOver(ScriptValue &other) {
+  context_ = other.context_;
+  value_ = other.value_;
+  other.context_ = nullptr;
+  other.value_ = JS_UNINITIALIZED;
+}
+
+ScriptValue ScriptValue::adopt(ScriptContext *context, RawScriptValue value) {
+  ScriptValue result;
+  result.context_ = context;
+  result.value_ = value;
+  return result;
+}
+
+ScriptValue ScriptValue::undefined(ScriptContext *context) {
+  return adopt(context, JS_UNDEFINED);
+}
+
+ScriptValue ScriptValue::null(ScriptContext *context) {
+  return adopt(context, JS_NULL);
+}
+
+ScriptValue ScriptValue::makeBoolean(ScriptContext *context, bool value) {
+  return adopt(context, JS_NewBool(context->context(), value));
+}
+
+ScriptValue ScriptValue::makeNumber(ScriptContext *context, double value) {
+  return adopt(context, JS_NewFloat64(context->context(), value));
+}
+
+ScriptValue ScriptValue::makeString(ScriptContext *context, const std::string &string) {
+  return adopt(context, JS_NewStringLen(context->context(), string.c_str(), string.size()));
+}
+
+ScriptValue ScriptValue::makeString(ScriptContext *context, const std::u16string &string) {
+  auto characters = reinterpret_cast<const uint16_t *>(string.c_str());
+  return adopt(context, qjs::newU16String(context->context(), characters, string.size()));
+}
+
+ScriptValue ScriptValue::makeObject(ScriptContext *context) {
+  return adopt(context, JS_NewObject(context->context()));
+}
+
+ScriptValue ScriptValue::makeArray(ScriptContext *context, const std::vector<ScriptValue> &elements) {
+  ::JSContext *ctx = context->context();
+  JSValue array = JS_NewArray(ctx);
+  for (uint32_t i = 0; i < elements.size(); i++) {
+    JS_SetPropertyUint32(ctx, array, i, JS_DupValue(ctx, elements[i].raw()));
+  }
+  return adopt(context, array);
+}
+
+ScriptValue ScriptValue::makeError(ScriptContext *context, const std::string &message) {
+  return makeErrorOf(context, "TypeError", message);
+}
+
+ScriptValue ScriptValue::makeRangeError(ScriptContext *context, const std::string &message) {
+  return makeErrorOf(context, "RangeError", message);
+}
+
+ScriptValue ScriptValue::makeArrayBuffer(ScriptContext *context, const uint8_t *bytes, size_t length) {
+  return takeResult(context, JS_NewArrayBufferCopy(context->context(), bytes, length), nullptr);
+}
+
+ScriptValue ScriptValue::makeUint8Array(ScriptContext *context, const uint8_t *bytes, size_t length) {
+  ::JSContext *ctx = context->context();
+  JSValue constructor = getGlobalProperty(context, "Uint8Array");
+  JSValue buffer = JS_NewArrayBufferCopy(ctx, bytes, length);
+  JSValue array = JS_CallConstructor(ctx, constructor, 1, &buffer);
+  JS_FreeValue(ctx, buffer);
+  JS_FreeValue(ctx, constructor);
+  return takeResult(context, array, nullptr);
+}
+
+ScriptValue ScriptValue::makeFunction(ScriptContext *context, const char *name, NativeFunction function,
+                                      void *data) {
+  ::JSContext *ctx = context->context();
+  FunctionData functionData{function, data};
+  JSValue dataBuffer = JS_NewArrayBufferCopy(ctx, reinterpret_cast<uint8_t *>(&functionData), sizeof(functionData));
+  JSValue result = JS_NewCFunctionData(ctx, callNativeFunction, 0, 0, 1, &dataBuffer);
+  JS_FreeValue(ctx, dataBuffer);
+  JS_DefinePropertyValueStr(ctx, result, "name", JS_NewString(ctx, name), JS_PROP_CONFIGURABLE);
+  return adopt(context, result);
+}
+
+ScriptValue ScriptValue::parseJSON(ScriptContext *context, const std::u16string &json) {
+  ::JSContext *ctx = context->context();
+  std::string utf8 = qjs::toUTF8(json);
+  JSValue result = JS_ParseJSON(ctx, utf8.c_str(), utf8.size(), "");
+  if (JS_IsException(result)) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return ScriptValue();
+  }
+  return adopt(context, result);
+}
+
+bool ScriptValue::empty() const {
+  return JS_IsUninitialized(value_);
+}
+
+bool ScriptValue::isUndefined() const {
+  return JS_IsUndefined(value_);
+}
+
+bool ScriptValue::isNull() const {
+  return JS_IsNull(value_);
+}
+
+bool ScriptValue::isBoolean() const {
+  return JS_IsBool(value_);
+}
+
+bool ScriptValue::isNumber() const {
+  return JS_IsNumber(value_);
+}
+
+bool ScriptValue::isString() const {
+  return JS_IsString(value_);
+}
+
+bool ScriptValue::isSymbol() const {
+  return JS_IsSymbol(value_);
+}
+
+bool ScriptValue::isObject() const {
+  return JS_IsObject(value_);
+}
+
+bool ScriptValue::isFunction() const {
+  return !empty() && JS_IsFunction(context_->context(), value_);
+}
+
+bool ScriptValue::isArray() const {
+  return !empty() && JS_IsArray(context_->context(), value_) == 1;
+}
+
+bool ScriptValue::toBoolean() const {
+  return !empty() && JS_ToBool(context_->context(), value_) == 1;
+}
+
+double ScriptValue::toNumber() const {
+  double result = 0;
+  if (!empty() && JS_ToFloat64(context_->context(), &result, value_) < 0) {
+    JS_FreeValue(context_->context(), JS_GetException(context_->context()));
+  }
+  return result;
+}
+
+std::string ScriptValue::toString() const {
+  if (empty()) return "";
+  return qjs::jsValueToStdString(context_->context(), value_);
+}
+
+std::u16string ScriptValue::toU16String() const {
+  if (empty()) return u"";
+  return qjs::jsValueToU16String(context_->context(), value_);
+}
+
+uint8_t *ScriptValue::uint8ArrayBytes(size_t *length) const {
+  if (!isObject()) return nullptr;
+  ::JSContext *ctx = context_->context();
+  JSValue constructor = getGlobalProperty(context_, "Uint8Array");
+  int isUint8Array = JS_IsInstanceOf(ctx, value_, constructor);
+  JS_FreeValue(ctx, constructor);
+  if (isUint8Array != 1) {
+    if (isUint8Array < 0) JS_FreeValue(ctx, JS_GetException(ctx));
+    return nullptr;
+  }
+
+  size_t byteOffset;
+  size_t byteLength;
+  size_t bufferSize;
+  JSValue buffer = JS_GetTypedArrayBuffer(ctx, value_, &byteOffset, &byteLength, nullptr);
+  if (JS_IsException(buffer)) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return nullptr;
+  }
+  // The buffer is kept alive by the array.
+  uint8_t *bytes = JS_GetArrayBuffer(ctx, &bufferSize, buffer);
+  JS_FreeValue(ctx, buffer);
+  if (bytes == nullptr) return nullptr;
+  *length = byteLength;
+  return bytes + byteOffset;
+}
+
+uint8_t *ScriptValue::bufferSourceBytes(size_t *length) const {
+  if (!isObject()) return nullptr;
+  ::JSContext *ctx = context_->context();
+  size_t bufferSize;
+  uint8_t *bytes = JS_GetArrayBuffer(ctx, &bufferSize, value_);
+  if (bytes != nullptr) {
+    *length = bufferSize;
+    return bytes;
+  }
+  JS_FreeValue(ctx, JS_GetException(ctx));
+
+  size_t byteOffset;
+  size_t byteLength;
+  JSValue buffer = JS_GetTypedArrayBuffer(ctx, value_, &byteOffset, &byteLength, nullptr);
+  if (JS_IsException(buffer)) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return nullptr;
+  }
+  // The buffer is kept alive by the array.
+  bytes = JS_GetArrayBuffer(ctx, &bufferSize, buffer);
+  JS_FreeValue(ctx, buffer);
+  if (bytes == nullptr) return nullptr;
+  *length = byteLength;
+  return bytes + byteOffset;
+}
+
+ScriptValue ScriptValue::toJSON(ScriptValue *exception) const {
+  return takeResult(context_, JS_JSONStringify(context_->context(), value_, JS_UNDEFINED, JS_UNDEFINED), exception);
+}
+
+ScriptValue ScriptValue::getProperty(const std::string &name, ScriptValue *exception) const {
+  return takeResult(context_, JS_GetPropertyStr(context_->context(), value_, name.c_str()), exception);
+}
+
+void ScriptValue::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) const {
+  ::JSContext *ctx = context_->context();
+  if (JS_SetPropertyStr(ctx, value_, name.c_str(), JS_DupValue(ctx, value.raw())) < 0) {
+    takeResult(context_, JS_EXCEPTION, exception);
+  }
+}
+
+ScriptValue ScriptValue::getIndex(uint32_t index, ScriptValue *exception) const {
+  return takeResult(context_, JS_GetPropertyUint32(context_->context(), value_, index), exception);
+}
+
+bool ScriptValue::hasProperty(const std::string &name) const {
+  if (!isObject()) return false;
+  ::JSContext *ctx = context_->context();
+  JSAtom atom = JS_NewAtomLen(ctx, name.c_str(), name.size());
+  int result = JS_HasProperty(ctx, value_, atom);
+  JS_FreeAtom(ctx, atom);
+  if (result < 0) JS_FreeValue(ctx, JS_GetException(ctx));
+  return result == 1;
+}
+
+void ScriptValue::deleteProperty(const std::string &name, ScriptValue *exception) const {
+  ::JSContext *ctx = context_->context();
+  JSAtom atom = JS_NewAtomLen(ctx, name.c_str(), name.size());
+  int result = JS_DeleteProperty(ctx, value_, atom, 0);
+  JS_FreeAtom(ctx, atom);
+  if (result < 0) takeResult(context_, JS_EXCEPTION, exception);
+}
+
+void ScriptValue::defineHiddenProperty(const std::string &name, const ScriptValue &value) const {
+  ::JSContext *ctx = context_->context();
+  if (!isObject()) return;
+  JS_DefinePropertyValueStr(ctx, value_, name.c_str(), JS_DupValue(ctx, value.raw()),
+                            JS_PROP_CONFIGURABLE | JS_PROP_WRITABLE);
+}
+
+ScriptValue ScriptValue::getPrototype() const {
+  if (!isObject()) return null(context_);
+  return adopt(context_, JS_GetPrototype(context_->context(), value_));
+}
+
+void ScriptValue::setPrototype(const ScriptValue &prototype, ScriptValue *exception) const {
+  if (JS_SetPrototype(context_->context(), value_, prototype.raw()) < 0) {
+    takeResult(context_, JS_EXCEPTION, exception);
+  }
+}
+
+bool ScriptValue::strictEquals(const ScriptValue &other) const {
+  if (empty() || other.empty()) return empty() && other.empty();
+  ::JSContext *ctx = context_->context();
+  if (JS_IsNumber(value_) && JS_IsNumber(other.value_)) return toNumber() == other.toNumber();
+  int tag = JS_VALUE_GET_TAG(value_);
+  if (tag != JS_VALUE_GET_TAG(other.value_)) return false;
+  switch (tag) {
+  case JS_TAG_NULL:
+  case JS_TAG_UNDEFINED:
+    return true;
+  case JS_TAG_BOOL:
+    return JS_VALUE_GET_BOOL(value_) == JS_VALUE_GET_BOOL(other.value_);
+  case JS_TAG_STRING:
+    return qjs::jsValueToU16String(ctx, value_) == qjs::jsValueToU16String(ctx, other.value_);
+  default:
+    return JS_VALUE_GET_PTR(value_) == JS_VALUE_GET_PTR(other.value_);
+  }
+}
+
+ScriptValue ScriptValue::call(const ScriptValue &thisObject, const std::vector<ScriptValue> &arguments,
+                              ScriptValue *exception) const {
+  std::vector<JSValue> argv;
+  argv.reserve(arguments.size());
+  for (auto &argument : arguments) {
+    argv.emplace_back(argument.raw());
+  }
+  JSValue thisValue = thisObject.empty() ? JS_UNDEFINED : thisObject.raw();
+  JSValue result = context_->callFunction(value_, thisValue, argv.size(), argv.data());
+  ScriptValue value = takeResult(context_, result, exception);
+  context_->drainPendingPromiseJobs();
+  return value;
+}
+
+ScriptValue ScriptValue::construct(const std::vector<ScriptValue> &arguments, ScriptValue *exception) const {
+  std::vector<JSValue> argv;
+  argv.reserve(arguments.size());
+  for (auto &argument : arguments) {
+    argv.emplace_back(argument.raw());
+  }
+  // Constructors run scripts as well, the stack top is anchored the same as calls.
+  ScriptScope scope(context_);
+  return takeResult(context_, JS_CallConstructor(context_->context(), value_, argv.size(), argv.data()), exception);
+}
+
+ScriptValue globalObject(ScriptContext *context) {
+  return ScriptValue::adopt(context, context->global());
+}
+
+void addModuleListener(ScriptContext *context, const std::u16string &moduleName, const ScriptValue &listener) {
+  // The bridge frees its listeners when it's disposed.
+  auto bridge = static_cast<JSBridge *>(context->getOwner());
+  bridge->addModuleListener(moduleName, JS_DupValue(context->context(), listener.raw()));
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "ui_manager.h"
+#include "bindings/script/KOM/blob.h"
+#include "bridge_qjs.h"
+#include "dart_methods.h"
+#include "foundation/bridge_callback.h"
+#include "foundation/trace_event.h"
+#include <cstdlib>
+#include <memory>
+
+namespace kraken::binding::qjs {
+using namespace foundation;
+
+namespace {
+
+JSValue krakenModuleListener(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (argc < 1) {
+    return throwJSError(ctx,
+                        "Failed to execute '__kraken_module_listener__': 1 parameter required, but only 0 present.");
+  }
+
+  // __kraken_module_listener__(moduleName, callback) subscribes to a single module,
+  // __kraken_module_listener__(callback) subscribes to all modules.
+  bool isModuleListener = JS_IsString(argv[0]);
+  if (isModuleListener && argc < 2) {
+    return throwJSError(ctx,
+                        "Failed to execute '__kraken_module_listener__': 2 parameters required, but only 1 present.");
+  }
+
+  JSValueConst callback = isModuleListener ? argv[1] : argv[0];
+  if (!JS_IsFunction(ctx, callback)) {
+    return throwJSError(ctx, "Failed to execute '__kraken_module_listener__': callback must be a function.");
+  }
+
+  auto bridge = static_cast<JSBridge *>(getContext(ctx)->getOwner());
+  if (isModuleListener) {
+    bridge->addModuleListener(jsValueToU16String(ctx, argv[0]), JS_DupValue(ctx, callback));
+  } else {
+    bridge->addModuleListener(JS_DupValue(ctx, callback));
+  }
+
+  return JS_UNDEFINED;
+}
+
+void handleInvokeModuleTransientCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
+                                         NativeString *json, uint8_t *bytes, int32_t length) {
+  // The bridge owns the bytes dart handed over, they're freed here unless an ArrayBuffer takes them.
+  std::unique_ptr<uint8_t, decltype(&free)> payload(bytes, free);
+  auto *obj = getBridgeCallbackContext(contextId, callbackContext);
+  if (obj == nullptr) return;
+  JSContext &_context = obj->_context;
+
+  if (!_context.isValid()) return;
+
+  ::JSContext *ctx = _context.context();
+  if (!JS_IsFunction(ctx, obj->_callback)) {
+    _context.handleException(throwJSError(ctx, "Failed to execute '__kraken_invoke_module__': callback is null."));
+    return;
+  }
+
+  JSValue result;
+  if (errmsg != nullptr) {
+    JSValue error = JS_NewError(ctx);
+    JS_SetPropertyStr(ctx, error, "message", newU16String(ctx, errmsg->string, errmsg->length));
+    result = _context.callFunction(obj->_callback, JS_UNDEFINED, 1, &error);
+    JS_FreeValue(ctx, error);
+  } else {
+    std::string jsonString = toUTF8(std::u16string(reinterpret_cast<const char16_t *>(json->string), json->length));
+    JSValue jsonValue = JS_ParseJSON(ctx, jsonString.c_str(), jsonString.size(), "");
+    if (JS_IsException(jsonValue)) {
+      JS_FreeValue(ctx, JS_GetException(ctx));
+      jsonValue = JS_NULL;
+    }
+
+    // Binary payload are passed as an ArrayBuffer in the third argument, which wraps the bytes without copying.
+    JSValue bytesValue = JS_UNDEFINED;
+    if (length >= 0) {
+      bytesValue = JS_NewArrayBuffer(
+        ctx, payload.release(), length, [](JSRuntime *rt, void *opaque, void *bytes) { free(bytes); }, nullptr, false);
+    }
+
+    JSValue arguments[] = {JS_NULL, jsonValue, bytesValue};
+    result = _context.callFunction(obj->_callback, JS_UNDEFINED, 3, arguments);
+    JS_FreeValue(ctx, jsonValue);
+    JS_FreeValue(ctx, bytesValue);
+  }
+
+  _context.handleException(result);
+  JS_FreeValue(ctx, result);
+  _context.drainPendingPromiseJobs();
+
+  auto bridge = static_cast<JSBridge *>(obj->_context.getOwner());
+  bridge->bridgeCallback->freeBridgeCallbackContext(callbackContext);
+}
+
+void handleInvokeModuleUnexpectedCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
+                                          NativeString *json, uint8_t *bytes, int32_t length) {
+  static_assert("Unexpected module callback, please check your invokeModule implementation on the dart side.");
+}
+
+JSValue krakenInvokeModule(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (argc < 2) {
+    return throwJSError(ctx, "Failed to execute 'kraken.invokeModule()': 2 arguments required.");
+  }
+
+  JSValue paramsValue = JS_UNDEFINED;
+  if (argc > 2 && !JS_IsNull(argv[2])) {
+    paramsValue = JS_JSONStringify(ctx, argv[2], JS_UNDEFINED, JS_UNDEFINED);
+    if (JS_IsException(paramsValue)) return paramsValue;
+  }
+
+  bool hasCallback = argc > 3 && JS_IsFunction(ctx, argv[3]);
+
+  // Binary payload are passed by pointer, dart side copy the bytes before invokeModule returns.
+  uint8_t *bytes = nullptr;
+  int32_t length = -1;
+  JSContext *context = getContext(ctx);
+  if (argc > 4 && JS_IsObject(argv[4]) && !getBinaryPayload(ScriptValue(context, argv[4]), &bytes, &length)) {
+    JS_FreeValue(ctx, paramsValue);
+    return throwJSError(ctx, "Failed to execute '__kraken_invoke_module__': parameter 5 (data) must be an "
+                             "ArrayBuffer, ArrayBufferView or Blob.");
+  }
+
+  if (getDartMethod()->invokeModule == nullptr) {
+    JS_FreeValue(ctx, paramsValue);
+    return throwJSError(ctx,
+                        "Failed to execute '__kraken_invoke_module__': dart method (invokeModule) is not registered.");
+  }
+
+  NativeString *moduleName = jsValueToNativeString(ctx, argv[0]);
+  NativeString *method = jsValueToNativeString(ctx, argv[1]);
+  NativeString *params = JS_IsUndefined(paramsValue) ? nullptr : jsValueToNativeString(ctx, paramsValue);
+  JS_FreeValue(ctx, paramsValue);
+
+  auto bridge = static_cast<JSBridge *>(context->getOwner());
+  NativeString *result;
+  if (hasCallback) {
+    auto callbackContext = std::make_unique<BridgeCallback::Context>(*context, argv[3]);
+    result = bridge->bridgeCallback->registerCallback<NativeString *>(
+      std::move(callbackContext),
+      [moduleName, method, params, bytes, length](BridgeCallback::Handle handle, int32_t contextId) {
+        return getDartMethod()->invokeModule(handle, contextId, moduleName, method, params, bytes, length,
+                                             handleInvokeModuleTransientCallback);
+      });
+  } else {
+    result = getDartMethod()->invokeModule(nullptr, context->getContextId(), moduleName, method, params, bytes, length,
+                                           handleInvokeModuleUnexpectedCallback);
+  }
+
+  moduleName->free();
+  method->free();
+  if (params != nullptr) {
+    params->free();
+  }
+
+  if (result == nullptr) {
+    return JS_NULL;
+  }
+
+  JSValue resultValue = newU16String(ctx, result->string, result->length);
+  result->free();
+  return resultValue;
+}
+
+JSValue flushUICommand(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (getDartMethod()->flushUICommand == nullptr) {
+    return throwJSError(
+      ctx, "Failed to execute '__kraken_flush_ui_command__': dart method (flushUICommand) is not registered.");
+  }
+  TRACE_EVENT("bridge", "flushUICommand");
+  getDartMethod()->flushUICommand();
+  return JS_UNDEFINED;
+}
+
+} // namespace
+
+void bindUIManager(std::unique_ptr<JSContext> &context) {
+  bindGlobalFunction(context.get(), "__kraken_module_listener__", krakenModuleListener, 2);
+  bindGlobalFunction(context.get(), "__kraken_invoke_module__", krakenInvokeModule, 5);
+  bindGlobalFunction(context.get(), "__kraken_flush_ui_command__", flushUICommand, 0);
+}
+
+} // namespace kraken::binding::qjs
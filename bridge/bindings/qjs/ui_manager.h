@@ -0,0 +1,15 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_QJS_UI_MANAGER_H
+#define KRAKENBRIDGE_QJS_UI_MANAGER_H
+
+#include "bindings/qjs/js_context_internal.h"
+
+namespace kraken::binding::qjs {
+void bindUIManager(std::unique_ptr<JSContext> &context);
+}
+
+#endif // KRAKENBRIDGE_QJS_UI_MANAGER_H
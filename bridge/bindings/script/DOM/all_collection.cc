@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "all_collection.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+ScriptValue JSAllCollection::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getAllCollectionPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case AllCollectionProperty::add:
+    case AllCollectionProperty::item:
+    case AllCollectionProperty::remove:
+      // Functions are own properties of the collection.
+      return ScriptValue();
+    case AllCollectionProperty::length:
+      return ScriptValue::makeNumber(context, m_nodes.size());
+    }
+  }
+
+  return HostObject::getProperty(name, exception);
+}
+
+ScriptValue JSAllCollection::item(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    return ScriptValue::null(context);
+  }
+
+  size_t index = arguments[0].toNumber();
+  auto collection = static_cast<JSAllCollection *>(data);
+
+  if (index >= collection->m_nodes.size()) {
+    return ScriptValue::null(context);
+  }
+
+  auto node = collection->m_nodes[index];
+  return node->value();
+}
+
+ScriptValue JSAllCollection::add(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(context, "Failed to execute add() on HTMLAllCollection: 1 arguments required.");
+    return ScriptValue();
+  }
+
+  auto nodeInstance = HostClass::instanceOf<NodeInstance>(arguments[0], JSNode::instance(context));
+  if (nodeInstance == nullptr) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute add() on HTMLAllCollection: first arguments should be a object.");
+    return ScriptValue();
+  }
+
+  NodeInstance *beforeInstance = nullptr;
+  if (arguments.size() == 2) {
+    beforeInstance = HostClass::instanceOf<NodeInstance>(arguments[1], JSNode::instance(context));
+  }
+
+  auto collection = static_cast<JSAllCollection *>(data);
+  collection->internalAdd(nodeInstance, beforeInstance);
+
+  return ScriptValue();
+}
+
+ScriptValue JSAllCollection::remove(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute remove() on HTMLAllCollection: 1 arguments required.");
+    return ScriptValue();
+  }
+
+  size_t index = arguments[0].toNumber();
+  auto collection = static_cast<JSAllCollection *>(data);
+
+  if (index < collection->m_nodes.size()) {
+    collection->m_nodes.erase(collection->m_nodes.begin() + index);
+  }
+
+  return ScriptValue();
+}
+
+void JSAllCollection::internalAdd(NodeInstance *node, NodeInstance *before) {
+  auto it = before == nullptr ? m_nodes.end() : std::find(m_nodes.begin(), m_nodes.end(), before);
+  if (it != m_nodes.end()) {
+    *it = node;
+  } else {
+    m_nodes.emplace_back(node);
+  }
+}
+
+void JSAllCollection::getPropertyNames(std::vector<std::string> &names) {
+  HostObject::getPropertyNames(names);
+
+  for (auto &property : getAllCollectionPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
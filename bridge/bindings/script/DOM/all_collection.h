@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_ALL_COLLECTION_H
+#define KRAKENBRIDGE_SCRIPT_ALL_COLLECTION_H
+
+#include "bindings/script/DOM/node.h"
+#include <vector>
+
+namespace kraken::binding {
+
+class JSAllCollection : public HostObject {
+public:
+  JSAllCollection() = delete;
+  explicit JSAllCollection(ScriptContext *context) : HostObject(context, "HTMLAllCollection"){};
+  DEFINE_OBJECT_PROPERTY(AllCollection, 4, length, item, add, remove)
+
+  static ScriptValue item(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+
+  static ScriptValue add(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                         void *data, ScriptValue *exception);
+
+  static ScriptValue remove(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+  void internalAdd(NodeInstance *node, NodeInstance *before);
+
+private:
+  std::vector<NodeInstance *> m_nodes;
+  FunctionHolder m_item{context, value(), this, "item", item};
+  FunctionHolder m_add{context, value(), this, "add", add};
+  FunctionHolder m_remove{context, value(), this, "remove", remove};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_ALL_COLLECTION_H
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "comment_node.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+
+namespace kraken::binding {
+
+void bindCommentNode(ScriptContext *context) {
+  auto commentNode = JSCommentNode::instance(context);
+  bindGlobalValue(context, "CommentNode", commentNode->classObject);
+}
+
+JSCommentNode::JSCommentNode(ScriptContext *context) : JSNode(context, "CommentNode") {}
+
+std::unordered_map<ScriptContext *, JSCommentNode *> JSCommentNode::instanceMap{};
+
+JSCommentNode::~JSCommentNode() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSCommentNode::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  std::string commentData;
+
+  if (arguments.size() > 0) {
+    commentData = arguments[0].toString();
+  }
+
+  auto textNode = new CommentNodeInstance(this, commentData);
+  return textNode->value();
+}
+
+JSCommentNode::CommentNodeInstance::CommentNodeInstance(JSCommentNode *jsCommentNode, const std::string &data)
+  : NodeInstance(jsCommentNode, NodeType::COMMENT_NODE), nativeComment(new NativeComment(nativeNode)), m_data(data) {
+  NativeString args_01{};
+  buildUICommandArgs(m_data, args_01);
+
+  jsCommentNode->context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createComment, args_01,
+                                                               nativeComment);
+}
+
+bool JSCommentNode::CommentNodeInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                     ScriptValue *exception) {
+  return NodeInstance::setProperty(name, value, exception);
+}
+
+ScriptValue JSCommentNode::CommentNodeInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getCommentNodePropertyMap();
+
+  if (propertyMap.count(name) == 0) return NodeInstance::getProperty(name, exception);
+
+  CommentNodeProperty property = propertyMap[name];
+
+  switch (property) {
+  case CommentNodeProperty::data:
+    return ScriptValue::makeString(context, m_data);
+  case CommentNodeProperty::nodeName: {
+    return ScriptValue::makeString(context, "#comment");
+  }
+  case CommentNodeProperty::length:
+    // Length counts UTF-16 code units like the string of data does.
+    return ScriptValue::makeNumber(context, ScriptValue::makeString(context, m_data).toU16String().size());
+  }
+
+  return ScriptValue();
+}
+
+void JSCommentNode::CommentNodeInstance::getPropertyNames(std::vector<std::string> &names) {
+  NodeInstance::getPropertyNames(names);
+
+  for (auto &property : getCommentNodePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+std::string JSCommentNode::CommentNodeInstance::internalGetTextContent() {
+  return m_data;
+}
+
+JSCommentNode::CommentNodeInstance::~CommentNodeInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeComment *>(ptr); }, nativeComment);
+}
+
+void JSCommentNode::CommentNodeInstance::internalSetTextContent(const std::string &content, ScriptValue *exception) {
+  m_data = content;
+}
+
+} // namespace kraken::binding
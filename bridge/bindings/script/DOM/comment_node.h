@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_COMMENT_NODE_H
+#define KRAKENBRIDGE_SCRIPT_COMMENT_NODE_H
+
+#include "bindings/script/DOM/node.h"
+
+namespace kraken::binding {
+
+void bindCommentNode(ScriptContext *context);
+
+struct NativeComment;
+
+class JSCommentNode : public JSNode {
+public:
+  static std::unordered_map<ScriptContext *, JSCommentNode *> instanceMap;
+  OBJECT_INSTANCE(JSCommentNode)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class CommentNodeInstance : public NodeInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(CommentNode, 3, data, nodeName, length)
+
+    CommentNodeInstance() = delete;
+    explicit CommentNodeInstance(JSCommentNode *jsCommentNode, const std::string &data);
+    ~CommentNodeInstance() override;
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+    std::string internalGetTextContent() override;
+    void internalSetTextContent(const std::string &content, ScriptValue *exception) override;
+
+    NativeComment *nativeComment;
+
+  private:
+    std::string m_data;
+  };
+
+protected:
+  JSCommentNode() = delete;
+  explicit JSCommentNode(ScriptContext *context);
+  ~JSCommentNode() override;
+};
+
+struct NativeComment {
+  NativeComment() = delete;
+  NativeComment(NativeNode *nativeNode) : nativeNode(nativeNode){};
+
+  NativeNode *nativeNode;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_COMMENT_NODE_H
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "custom_event.h"
+#include "bindings/script/native_string_utils.h"
+
+namespace kraken::binding {
+
+void bindCustomEvent(ScriptContext *context) {
+  auto CustomEvent = JSCustomEvent::instance(context);
+  bindGlobalValue(context, "CustomEvent", CustomEvent->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSCustomEvent *> JSCustomEvent::instanceMap{};
+
+JSCustomEvent::~JSCustomEvent() {
+  instanceMap.erase(context);
+}
+
+JSCustomEvent::JSCustomEvent(ScriptContext *context) : JSEvent(context, "CustomEvent") {}
+
+ScriptValue JSCustomEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to construct 'CustomEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string customEventType = arguments[0].toString();
+  ScriptValue customEventInit;
+  if (arguments.size() == 2) {
+    customEventInit = arguments[1];
+  }
+  auto customEvent = new CustomEventInstance(this, customEventType, customEventInit, exception);
+  return customEvent->value();
+}
+
+CustomEventInstance::CustomEventInstance(JSCustomEvent *jsCustomEvent, const std::string &eventType,
+                                         const ScriptValue &eventInit, ScriptValue *exception)
+  : EventInstance(jsCustomEvent, eventType, eventInit, exception) {
+  if (eventInit.isObject() && eventInit.hasProperty("detail")) {
+    m_detail = eventInit.getProperty("detail", exception);
+  }
+}
+
+CustomEventInstance::CustomEventInstance(JSCustomEvent *jsCustomEvent, NativeCustomEvent *nativeCustomEvent)
+  : nativeCustomEvent(nativeCustomEvent), EventInstance(jsCustomEvent, nativeCustomEvent->nativeEvent) {
+  m_detail = ScriptValue::makeString(context, nativeStringToU16String(nativeCustomEvent->detail));
+  nativeCustomEvent->detail->free();
+}
+
+ScriptValue CustomEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSCustomEvent::getCustomEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+  auto property = propertyMap[name];
+
+  switch (property) {
+  case JSCustomEvent::CustomEventProperty::detail:
+    return m_detail;
+  }
+
+  return ScriptValue();
+}
+
+bool CustomEventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSCustomEvent::getCustomEventPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    if (property == JSCustomEvent::CustomEventProperty::detail) {
+      m_detail = value;
+    }
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+ScriptValue JSCustomEvent::initCustomEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventInstance = HostClass::instanceOf<CustomEventInstance>(thisObject, static_cast<JSCustomEvent *>(data));
+  if (eventInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'initCustomEvent' on 'CustomEvent': 1 argument required, but only 0 present");
+    return ScriptValue();
+  }
+
+  if (eventInstance->_dispatchFlag) {
+    return ScriptValue();
+  }
+
+  eventInstance->nativeEvent->type->free();
+  eventInstance->nativeEvent->type = stringToNativeString(arguments[0].toU16String());
+
+  if (arguments.size() > 1) {
+    eventInstance->nativeEvent->bubbles = arguments[1].toBoolean() ? 1 : 0;
+  }
+
+  if (arguments.size() > 2) {
+    eventInstance->nativeEvent->cancelable = arguments[2].toBoolean() ? 1 : 0;
+  }
+
+  if (arguments.size() > 3) {
+    eventInstance->m_detail = arguments[3];
+  }
+
+  return ScriptValue();
+}
+
+CustomEventInstance::~CustomEventInstance() {}
+
+void CustomEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSCustomEvent::getCustomEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : JSCustomEvent::getCustomEventPrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
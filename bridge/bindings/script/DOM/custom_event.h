@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_CUSTOM_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_CUSTOM_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <vector>
+
+namespace kraken::binding {
+
+void bindCustomEvent(ScriptContext *context);
+
+class CustomEventInstance;
+
+struct NativeCustomEvent {
+  NativeCustomEvent() = delete;
+  explicit NativeCustomEvent(NativeEvent *nativeEvent) : nativeEvent(nativeEvent){};
+
+  NativeEvent *nativeEvent;
+
+  NativeString *detail;
+};
+
+class JSCustomEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(CustomEvent, 1, detail)
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(CustomEvent, 1, initCustomEvent)
+
+  static std::unordered_map<ScriptContext *, JSCustomEvent *> instanceMap;
+  OBJECT_INSTANCE(JSCustomEvent)
+
+  static ScriptValue initCustomEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                     const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSCustomEvent() = delete;
+  explicit JSCustomEvent(ScriptContext *context);
+  ~JSCustomEvent() override;
+
+private:
+  FunctionHolder m_initCustomEvent{context, prototypeObject, this, "initCustomEvent", initCustomEvent};
+  friend CustomEventInstance;
+};
+
+class CustomEventInstance : public EventInstance {
+public:
+  CustomEventInstance() = delete;
+  explicit CustomEventInstance(JSCustomEvent *jsCustomEvent, const std::string &customEventType,
+                               const ScriptValue &eventInit, ScriptValue *exception);
+  explicit CustomEventInstance(JSCustomEvent *jsCustomEvent, NativeCustomEvent *nativeCustomEvent);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~CustomEventInstance() override;
+
+private:
+  friend JSCustomEvent;
+  ScriptValue m_detail;
+  NativeCustomEvent *nativeCustomEvent{nullptr};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_CUSTOM_EVENT_H
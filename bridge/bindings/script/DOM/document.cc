@@ -0,0 +1,378 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "document.h"
+#include "bindings/script/KOM/cookie.h"
+#include "bindings/script/native_string_utils.h"
+#include "comment_node.h"
+#include "element.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "text_node.h"
+#include <algorithm>
+#include <atomic>
+
+namespace kraken::binding {
+
+void bindDocument(ScriptContext *context) {
+  auto document = JSDocument::instance(context);
+  bindGlobalValue(context, "Document", document->classObject);
+  auto documentObject = document->instanceConstructor(ScriptArguments(context, 0, nullptr), nullptr);
+  bindGlobalValue(context, "document", documentObject);
+}
+
+std::unordered_map<ScriptContext *, JSDocument *> JSDocument::instanceMap{};
+
+JSDocument::~JSDocument() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSDocument::createEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto document = HostClass::instanceOf<DocumentInstance>(thisObject, static_cast<JSDocument *>(data));
+  if (document == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(context, "Failed to argumentCount: 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  const ScriptValue eventTypeValue = arguments[0];
+  if (!eventTypeValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to createEvent: type should be a string.");
+    return ScriptValue();
+  }
+  std::string eventType = eventTypeValue.toString();
+
+  if (eventType == "Event") {
+    auto e = JSEvent::createEvent(eventType, document->context);
+    return e->value();
+  } else {
+    return ScriptValue::null(context);
+  }
+}
+
+ScriptValue JSDocument::createElement(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto document = HostClass::instanceOf<DocumentInstance>(thisObject, static_cast<JSDocument *>(data));
+  if (document == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(context, "Failed to createElement: 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  const ScriptValue tagNameValue = arguments[0];
+  if (!tagNameValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to createElement: tagName should be a string.");
+    return ScriptValue();
+  }
+
+  std::string tagName = tagNameValue.toString();
+  auto element = JSElement::buildElementInstance(document->context, tagName);
+  element->document = document;
+  return element->value();
+}
+
+ScriptValue JSDocument::createTextNode(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto document = HostClass::instanceOf<DocumentInstance>(thisObject, static_cast<JSDocument *>(data));
+  if (document == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'createTextNode' on 'Document': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  auto TextNode = JSTextNode::instance(document->context);
+  auto textNode = new JSTextNode::TextNodeInstance(TextNode, arguments[0].toString());
+  textNode->document = document;
+  return textNode->value();
+}
+
+ScriptValue JSDocument::createComment(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto document = HostClass::instanceOf<DocumentInstance>(thisObject, static_cast<JSDocument *>(data));
+  if (document == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  std::string commentData;
+  if (arguments.size() > 0) {
+    commentData = arguments[0].toString();
+  }
+
+  auto CommentNode = JSCommentNode::instance(document->context);
+  auto commentNode = new JSCommentNode::CommentNodeInstance(CommentNode, commentData);
+  commentNode->document = document;
+  return commentNode->value();
+}
+
+static std::atomic<bool> event_registered = false;
+static std::atomic<bool> document_registered = false;
+
+JSDocument::JSDocument(ScriptContext *context) : JSNode(context, "Document") {
+  if (!event_registered) {
+    event_registered = true;
+    JSEvent::defineEvent(EVENT_INPUT, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new InputEventInstance(JSInputEvent::instance(context), reinterpret_cast<NativeInputEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_MEDIA_ERROR, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new MediaErrorEventInstance(JSMediaErrorEvent::instance(context),
+                                         reinterpret_cast<NativeMediaErrorEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_MESSAGE, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new MessageEventInstance(JSMessageEvent::instance(context),
+                                      reinterpret_cast<NativeMessageEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_CLOSE, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new CloseEventInstance(JSCloseEvent::instance(context), reinterpret_cast<NativeCloseEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_INTERSECTION_CHANGE, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new IntersectionChangeEventInstance(JSIntersectionChangeEvent::instance(context),
+                                                 reinterpret_cast<NativeIntersectionChangeEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_TOUCH_START, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new TouchEventInstance(JSTouchEvent::instance(context), reinterpret_cast<NativeTouchEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_TOUCH_END, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new TouchEventInstance(JSTouchEvent::instance(context), reinterpret_cast<NativeTouchEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_TOUCH_MOVE, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new TouchEventInstance(JSTouchEvent::instance(context), reinterpret_cast<NativeTouchEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_TOUCH_CANCEL, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new TouchEventInstance(JSTouchEvent::instance(context), reinterpret_cast<NativeTouchEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_SWIPE, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new GestureEventInstance(JSGestureEvent::instance(context),
+                                      reinterpret_cast<NativeGestureEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_PAN, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new GestureEventInstance(JSGestureEvent::instance(context),
+                                      reinterpret_cast<NativeGestureEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_LONG_PRESS, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new GestureEventInstance(JSGestureEvent::instance(context),
+                                      reinterpret_cast<NativeGestureEvent *>(nativeEvent));
+    });
+    JSEvent::defineEvent(EVENT_SCALE, [](ScriptContext *context, void *nativeEvent) -> EventInstance * {
+      return new GestureEventInstance(JSGestureEvent::instance(context),
+                                      reinterpret_cast<NativeGestureEvent *>(nativeEvent));
+    });
+  }
+  if (!document_registered) {
+    document_registered = true;
+
+    JSElement::defineElement("img", [](ScriptContext *context) -> ElementInstance * {
+      return new JSImageElement::ImageElementInstance(JSImageElement::instance(context));
+    });
+    JSElement::defineElement("a", [](ScriptContext *context) -> ElementInstance * {
+      return new JSAnchorElement::AnchorElementInstance(JSAnchorElement::instance(context));
+    });
+    JSElement::defineElement("canvas", [](ScriptContext *context) -> ElementInstance * {
+      return new JSCanvasElement::CanvasElementInstance(JSCanvasElement::instance(context));
+    });
+    JSElement::defineElement("input", [](ScriptContext *context) -> ElementInstance * {
+      return new JSInputElement::InputElementInstance(JSInputElement::instance(context));
+    });
+    JSElement::defineElement("object", [](ScriptContext *context) -> ElementInstance * {
+      return new JSObjectElement::ObjectElementInstance(JSObjectElement::instance(context));
+    });
+  }
+}
+
+ScriptValue JSDocument::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new DocumentInstance(this);
+  return instance->value();
+}
+
+static std::unordered_map<ScriptContext *, DocumentInstance *> instanceMap{};
+
+std::string DocumentCookie::getCookie() {
+  return context->getCookieJar()->getCookies(getDocumentCookieURL(), false);
+}
+
+void DocumentCookie::setCookie(const std::string &cookieStr) {
+  context->getCookieJar()->setCookie(getDocumentCookieURL(), cookieStr, false);
+}
+
+DocumentInstance *DocumentInstance::instance(ScriptContext *context) {
+  return instanceMap[context];
+}
+
+DocumentInstance::DocumentInstance(JSDocument *document)
+  : NodeInstance(document, NodeType::DOCUMENT_NODE, DOCUMENT_TARGET_ID),
+    nativeDocument(new NativeDocument(nativeNode)) {
+  auto Element = JSElement::instance(document->context);
+  body = new ElementInstance(Element, std::string("BODY"), BODY_TARGET_ID);
+  body->document = this;
+  m_body = body->value();
+  instanceMap[document->context] = this;
+  int32_t contextId = this->contextId;
+  NativeDocument *nativeDocument = this->nativeDocument;
+  context->runWhenActive([contextId, nativeDocument]() { getDartMethod()->initDocument(contextId, nativeDocument); });
+}
+
+ScriptValue DocumentInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getDocumentPropertyMap();
+
+  if (propertyMap.count(name) == 0) {
+    return NodeInstance::getProperty(name, exception);
+  }
+
+  DocumentProperty property = propertyMap[name];
+
+  switch (property) {
+  case DocumentProperty::documentElement:
+  case DocumentProperty::body: {
+    return m_body;
+  }
+  case DocumentProperty::all: {
+    auto all = new JSAllCollection(context);
+
+    traverseNode(body, [&all](NodeInstance *node) {
+      all->internalAdd(node, nullptr);
+      return false;
+    });
+
+    return all->value();
+  }
+  case DocumentProperty::cookie: {
+    std::string cookie = m_cookie.getCookie();
+    return ScriptValue::makeString(context, cookie);
+  }
+  case DocumentProperty::nodeName: {
+    return ScriptValue::makeString(context, "#document");
+  }
+  }
+
+  return ScriptValue();
+}
+
+DocumentInstance::~DocumentInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeDocument *>(ptr); }, nativeDocument);
+  instanceMap.erase(context);
+}
+
+void DocumentInstance::getPropertyNames(std::vector<std::string> &names) {
+  NodeInstance::getPropertyNames(names);
+
+  for (auto &property : getDocumentPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+void DocumentInstance::removeElementById(const std::string &id, ElementInstance *element) {
+  if (elementMapById.count(id) > 0) {
+    auto &list = elementMapById[id];
+    auto it = std::find(list.begin(), list.end(), element);
+    if (it != list.end()) list.erase(it);
+  }
+}
+
+void DocumentInstance::addElementById(const std::string &id, ElementInstance *element) {
+  if (elementMapById.count(id) == 0) {
+    elementMapById[id] = std::vector<ElementInstance *>();
+  }
+
+  auto &list = elementMapById[id];
+  auto it = std::find(list.begin(), list.end(), element);
+
+  if (it == list.end()) {
+    elementMapById[id].emplace_back(element);
+  }
+}
+
+ScriptValue JSDocument::getElementById(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto document = HostClass::instanceOf<DocumentInstance>(thisObject, static_cast<JSDocument *>(data));
+  if (document == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'getElementById' on 'Document': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string id = arguments[0].toString();
+  if (id.empty()) return ScriptValue::null(context);
+
+  if (document->elementMapById.count(id) == 0) {
+    return ScriptValue::null(context);
+  }
+
+  auto &targetElementList = document->elementMapById[id];
+
+  for (auto &element : targetElementList) {
+    if (element->isConnected()) return element->value();
+  }
+
+  return ScriptValue::null(context);
+}
+
+ScriptValue JSDocument::getElementsByTagName(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto document = HostClass::instanceOf<DocumentInstance>(thisObject, static_cast<JSDocument *>(data));
+  if (document == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'getElementsByTagName' on 'Document': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string tagName = arguments[0].toString();
+  std::transform(tagName.begin(), tagName.end(), tagName.begin(), ::toupper);
+
+  std::vector<ScriptValue> elements;
+
+  traverseNode(document->body, [&tagName, &elements](NodeInstance *node) {
+    if (node->nodeType == NodeType::ELEMENT_NODE) {
+      auto element = static_cast<ElementInstance *>(node);
+      if (element->tagName() == tagName) {
+        elements.emplace_back(element->value());
+      }
+    }
+
+    return false;
+  });
+
+  return ScriptValue::makeArray(context, elements);
+}
+
+bool DocumentInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = getDocumentPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    if (property == DocumentProperty::cookie) {
+      m_cookie.setCookie(value.toString());
+    }
+    return true;
+  } else {
+    return NodeInstance::setProperty(name, value, exception);
+  }
+}
+
+} // namespace kraken::binding
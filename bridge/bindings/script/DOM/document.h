@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_DOCUMENT_H
+#define KRAKENBRIDGE_SCRIPT_DOCUMENT_H
+
+#include "all_collection.h"
+#include "element.h"
+#include "node.h"
+
+#include "bindings/script/DOM/custom_event.h"
+#include "bindings/script/DOM/elements/anchor_element.h"
+#include "bindings/script/DOM/elements/canvas_element.h"
+#include "bindings/script/DOM/elements/image_element.h"
+#include "bindings/script/DOM/elements/input_element.h"
+#include "bindings/script/DOM/elements/object_element.h"
+#include "bindings/script/DOM/events/close_event.h"
+#include "bindings/script/DOM/events/input_event.h"
+#include "bindings/script/DOM/events/intersection_change_event.h"
+#include "bindings/script/DOM/events/media_error_event.h"
+#include "bindings/script/DOM/events/message_event.h"
+#include "bindings/script/DOM/events/touch_event.h"
+#include "bindings/script/DOM/gesture_event.h"
+
+namespace kraken::binding {
+
+void bindDocument(ScriptContext *context);
+
+class DocumentInstance;
+
+class JSDocument : public JSNode {
+public:
+  static std::unordered_map<ScriptContext *, JSDocument *> instanceMap;
+  OBJECT_INSTANCE(JSDocument)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  static ScriptValue createEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue createElement(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue createTextNode(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue createComment(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue getElementById(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue getElementsByTagName(ScriptContext *context, const ScriptValue &thisObject,
+                                          const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+protected:
+  JSDocument() = delete;
+  explicit JSDocument(ScriptContext *context);
+  ~JSDocument() override;
+
+private:
+  FunctionHolder m_createEvent{context, prototypeObject, this, "createEvent", createEvent};
+  FunctionHolder m_createElement{context, prototypeObject, this, "createElement", createElement};
+  FunctionHolder m_createTextNode{context, prototypeObject, this, "createTextNode", createTextNode};
+  FunctionHolder m_createComment{context, prototypeObject, this, "createComment", createComment};
+  FunctionHolder m_getElementById{context, prototypeObject, this, "getElementById", getElementById};
+  FunctionHolder m_getElementsByTagName{context, prototypeObject, this, "getElementsByTagName",
+                                        getElementsByTagName};
+};
+
+// document.cookie, cookies are kept in the cookie jar of context which is shared with network requests.
+class DocumentCookie {
+public:
+  DocumentCookie() = delete;
+  KRAKEN_EXPORT explicit DocumentCookie(ScriptContext *context) : context(context){};
+
+  KRAKEN_EXPORT std::string getCookie();
+  KRAKEN_EXPORT void setCookie(const std::string &str);
+
+private:
+  ScriptContext *context;
+};
+
+struct NativeDocument {
+  NativeDocument() = delete;
+  KRAKEN_EXPORT explicit NativeDocument(NativeNode *nativeNode) : nativeNode(nativeNode){};
+
+  NativeNode *nativeNode;
+};
+
+class DocumentInstance : public NodeInstance {
+public:
+  DEFINE_OBJECT_PROPERTY(Document, 5, nodeName, all, cookie, body, documentElement);
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(Document, 6, createElement, createTextNode, createComment, getElementById,
+                                   getElementsByTagName, createEvent);
+
+  static DocumentInstance *instance(ScriptContext *context);
+
+  DocumentInstance() = delete;
+  KRAKEN_EXPORT explicit DocumentInstance(JSDocument *document);
+  KRAKEN_EXPORT ~DocumentInstance() override;
+  KRAKEN_EXPORT ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  KRAKEN_EXPORT bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  KRAKEN_EXPORT void getPropertyNames(std::vector<std::string> &names) override;
+
+  void removeElementById(const std::string &id, ElementInstance *element);
+  void addElementById(const std::string &id, ElementInstance *element);
+
+  NativeDocument *nativeDocument;
+  std::unordered_map<std::string, std::vector<ElementInstance *>> elementMapById;
+
+  ElementInstance *body;
+
+private:
+  DocumentCookie m_cookie{context};
+  // Body lives as long as the document does.
+  ScriptValue m_body;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_DOCUMENT_H
@@ -0,0 +1,848 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "element.h"
+#include "bindings/script/KOM/blob.h"
+#include "bindings/script/native_string_utils.h"
+#include "bridge.h"
+#include "dart_methods.h"
+#include "document.h"
+#include "event_target.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+#include "text_node.h"
+#include <algorithm>
+
+namespace kraken::binding {
+using namespace foundation;
+
+void bindElement(ScriptContext *context) {
+  auto element = JSElement::instance(context);
+  bindGlobalValue(context, "Element", element->classObject);
+}
+
+std::vector<std::string> &JSElementAttributes::getAttributePropertyNames() {
+  static std::vector<std::string> propertyNames{"length"};
+  return propertyNames;
+}
+const std::unordered_map<std::string, JSElementAttributes::AttributeProperty> &
+JSElementAttributes::getAttributePropertyMap() {
+  static std::unordered_map<std::string, AttributeProperty> propertyMap{{"length", AttributeProperty::kLength}};
+  return propertyMap;
+}
+
+ScriptValue JSElementAttributes::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getAttributePropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap.at(name);
+    switch (property) {
+    case AttributeProperty::kLength:
+      return ScriptValue::makeNumber(context, m_attributes.size());
+    }
+  } else if (hasAttribute(name)) {
+    return ScriptValue::makeString(context, getAttribute(name));
+  }
+  return ScriptValue();
+}
+
+bool JSElementAttributes::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  setAttribute(name, value.toString());
+  return true;
+}
+
+void JSElementAttributes::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getAttributePropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : v_attributes) {
+    names.emplace_back(property);
+  }
+}
+
+JSElementAttributes::~JSElementAttributes() {}
+
+std::string JSElementAttributes::getAttribute(const std::string &name) {
+  if (isNumberIndex(name)) {
+    size_t index = std::stoul(name);
+    if (index >= v_attributes.size()) return "";
+    return m_attributes[v_attributes[index]];
+  }
+
+  if (m_attributes.count(name) == 0) return "";
+  return m_attributes[name];
+}
+
+void JSElementAttributes::setAttribute(const std::string &name, const std::string &value) {
+  if (isNumberIndex(name)) {
+    size_t index = std::stoul(name);
+    if (index < v_attributes.size()) {
+      m_attributes[v_attributes[index]] = value;
+    }
+    return;
+  }
+
+  if (m_attributes.count(name) == 0) {
+    v_attributes.emplace_back(name);
+  }
+
+  m_attributes[name] = value;
+}
+
+bool JSElementAttributes::hasAttribute(const std::string &name) {
+  if (isNumberIndex(name)) {
+    size_t index = std::stoul(name);
+    return index < v_attributes.size();
+  }
+
+  return m_attributes.count(name) > 0;
+}
+
+void JSElementAttributes::removeAttribute(const std::string &name) {
+  auto index = std::find(v_attributes.begin(), v_attributes.end(), name);
+  if (index != v_attributes.end()) v_attributes.erase(index);
+
+  m_attributes.erase(name);
+}
+
+std::map<std::string, std::string> &JSElementAttributes::getAttributesMap() {
+  return m_attributes;
+}
+
+void JSElementAttributes::setAttributesMap(const std::map<std::string, std::string> &attributes) {
+  m_attributes = attributes;
+}
+
+std::vector<std::string> &JSElementAttributes::getAttributesVector() {
+  return v_attributes;
+}
+
+void JSElementAttributes::setAttributesVector(const std::vector<std::string> &attributes) {
+  v_attributes.assign(attributes.begin(), attributes.end());
+}
+
+std::unordered_map<ScriptContext *, JSElement *> JSElement::instanceMap{};
+std::unordered_map<std::string, ElementCreator> JSElement::elementCreatorMap{};
+
+JSElement::JSElement(ScriptContext *context) : JSNode(context, "Element") {}
+JSElement::JSElement(ScriptContext *context, const char *name)
+  : JSNode(context, JSElement::instance(context), name) {}
+
+JSElement::~JSElement() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSElement::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(context, "Failed to new Element(): at least 1 parameter required.");
+    return ScriptValue();
+  }
+
+  std::string tagName = arguments[0].toString();
+  auto instance = new ElementInstance(this, tagName.c_str(), true);
+  return instance->value();
+}
+
+ElementInstance::ElementInstance(JSElement *element, const char *tagName, bool sendUICommand)
+  : NodeInstance(element, NodeType::ELEMENT_NODE), nativeElement(new NativeElement(nativeNode)), m_tagName(tagName) {
+
+  if (sendUICommand) {
+    NativeString args_01{};
+    buildUICommandArgs(m_tagName, args_01);
+    element->context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createElement, args_01,
+                                                           nativeElement);
+  }
+}
+
+ElementInstance::ElementInstance(JSElement *element, const std::string &tagName, int64_t targetId)
+  : NodeInstance(element, NodeType::ELEMENT_NODE, targetId), nativeElement(new NativeElement(nativeNode)),
+    m_tagName(tagName) {
+  NativeString args_01{};
+  buildUICommandArgs(m_tagName, args_01);
+
+  // No needs to send create element for BODY element.
+  if (targetId == BODY_TARGET_ID) {
+    assert_m(getDartMethod()->initBody != nullptr, "Failed to execute initBody(): dart method is nullptr.");
+    int32_t contextId = element->contextId;
+    NativeElement *nativeElement = this->nativeElement;
+    context->runWhenActive([contextId, nativeElement]() { getDartMethod()->initBody(contextId, nativeElement); });
+  } else {
+    element->context->getUICommandQueue()->registerCommand(targetId, UICommand::createElement, args_01, nativeElement);
+  }
+}
+
+ElementInstance::~ElementInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeElement *>(ptr); }, nativeElement);
+}
+
+ScriptValue JSElement::getBoundingClientRect(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeElement->getBoundingClientRect != nullptr,
+           "Failed to execute getBoundingClientRect(): dart method is nullptr.");
+  NativeBoundingClientRect *nativeBoundingClientRect =
+    elementInstance->nativeElement->getBoundingClientRect(elementInstance->nativeElement);
+  auto boundingClientRect = new BoundingClientRect(elementInstance->context, nativeBoundingClientRect);
+  return boundingClientRect->value();
+}
+
+ScriptValue ElementInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSElement::getElementPropertyMap();
+
+  if (propertyMap.count(name) == 0) {
+    return NodeInstance::getProperty(name, exception);
+  }
+
+  JSElement::ElementProperty property = propertyMap[name];
+
+  switch (property) {
+  case JSElement::ElementProperty::nodeName:
+  case JSElement::ElementProperty::tagName: {
+    return ScriptValue::makeString(context, tagName());
+  }
+  case JSElement::ElementProperty::attributes:
+    return m_attributes;
+  case JSElement::ElementProperty::style:
+    return m_style;
+  case JSElement::ElementProperty::offsetLeft: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::offsetLeft)));
+  }
+  case JSElement::ElementProperty::offsetTop: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::offsetTop)));
+  }
+  case JSElement::ElementProperty::offsetWidth: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::offsetWidth)));
+  }
+  case JSElement::ElementProperty::offsetHeight: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::offsetHeight)));
+  }
+  case JSElement::ElementProperty::clientWidth: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::clientWidth)));
+  }
+  case JSElement::ElementProperty::clientHeight: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::clientHeight)));
+  }
+  case JSElement::ElementProperty::clientTop: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::clientTop)));
+  }
+  case JSElement::ElementProperty::clientLeft: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::clientLeft)));
+  }
+  case JSElement::ElementProperty::scrollTop: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::scrollTop)));
+  }
+  case JSElement::ElementProperty::scrollLeft: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::scrollLeft)));
+  }
+  case JSElement::ElementProperty::scrollHeight: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::scrollHeight)));
+  }
+  case JSElement::ElementProperty::scrollWidth: {
+    getDartMethod()->flushUICommand();
+    assert_m(nativeElement->getViewModuleProperty != nullptr,
+             "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+    return ScriptValue::makeNumber(context, nativeElement->getViewModuleProperty(
+                                              nativeElement, static_cast<int64_t>(ViewModuleProperty::scrollWidth)));
+  }
+  case JSElement::ElementProperty::children: {
+    std::vector<ScriptValue> elements;
+    for (auto &childNode : childNodes) {
+      if (childNode->nodeType == NodeType::ELEMENT_NODE) {
+        elements.emplace_back(childNode->value());
+      }
+    }
+
+    return ScriptValue::makeArray(context, elements);
+  }
+  }
+
+  return ScriptValue();
+}
+
+bool ElementInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSElement::getElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case JSElement::ElementProperty::style:
+    case JSElement::ElementProperty::attributes:
+      // Both are read only.
+      return true;
+    case JSElement::ElementProperty::scrollTop: {
+      getDartMethod()->flushUICommand();
+      assert_m(nativeElement->setViewModuleProperty != nullptr,
+               "Failed to execute setScrollTop(): dart method is nullptr.");
+      nativeElement->setViewModuleProperty(nativeElement, static_cast<int64_t>(ViewModuleProperty::scrollTop),
+                                           value.toNumber());
+      break;
+    }
+    case JSElement::ElementProperty::scrollLeft: {
+      getDartMethod()->flushUICommand();
+      assert_m(nativeElement->setViewModuleProperty != nullptr,
+               "Failed to execute setScrollLeft(): dart method is nullptr.");
+      nativeElement->setViewModuleProperty(nativeElement, static_cast<int64_t>(ViewModuleProperty::scrollLeft),
+                                           value.toNumber());
+      break;
+    }
+    default:
+      break;
+    }
+    return NodeInstance::setProperty(name, value, exception);
+  } else {
+    return NodeInstance::setProperty(name, value, exception);
+  }
+}
+
+void ElementInstance::getPropertyNames(std::vector<std::string> &names) {
+  NodeInstance::getPropertyNames(names);
+
+  for (auto &property : JSElement::getElementPropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : JSElement::getElementPrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+std::string ElementInstance::internalGetTextContent() {
+  std::string buffer;
+
+  for (auto &node : childNodes) {
+    std::string nodeText = node->internalGetTextContent();
+    buffer += nodeText;
+  }
+
+  return buffer;
+}
+
+ScriptValue JSElement::setAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 2) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'setAttribute' on 'Element': 2 arguments required, "
+                                                 "but only " +
+                                                   std::to_string(arguments.size()) + " present");
+    return ScriptValue();
+  }
+
+  const ScriptValue nameValue = arguments[0];
+  const ScriptValue attributeValue = arguments[1];
+
+  if (!nameValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'setAttribute' on 'Element': name attribute is not valid.");
+    return ScriptValue();
+  }
+
+  std::string name = nameValue.toString();
+  std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+  std::string valueString = attributeValue.toString();
+
+  getDartMethod()->flushUICommand();
+
+  auto attributes = elementInstance->getAttributes();
+
+  if (attributes->hasAttribute(name)) {
+    std::string oldValue = attributes->getAttribute(name);
+    attributes->setAttribute(name, valueString);
+    elementInstance->_didModifyAttribute(name, oldValue, valueString);
+  } else {
+    attributes->setAttribute(name, valueString);
+    std::string empty;
+    elementInstance->_didModifyAttribute(name, empty, valueString);
+  }
+
+  NativeString args_01{};
+  NativeString args_02{};
+  buildUICommandArgs(name, valueString, args_01, args_02);
+
+  elementInstance->context->getUICommandQueue()->registerCommand(elementInstance->eventTargetId,
+                                                                 UICommand::setProperty, args_01, args_02, nullptr);
+
+  return ScriptValue();
+}
+
+ScriptValue JSElement::getAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'getAttribute' on 'Element': 1 argument required, but only 0 present");
+    return ScriptValue();
+  }
+
+  const ScriptValue nameValue = arguments[0];
+
+  if (!nameValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'setAttribute' on 'Element': name attribute is not valid.");
+    return ScriptValue();
+  }
+
+  std::string name = nameValue.toString();
+  auto attributes = elementInstance->getAttributes();
+
+  if (attributes->hasAttribute(name)) {
+    return ScriptValue::makeString(context, attributes->getAttribute(name));
+  }
+
+  return ScriptValue::null(context);
+}
+
+ScriptValue JSElement::hasAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'hasAttribute' on 'Element': 1 argument required, but only 0 present");
+    return ScriptValue();
+  }
+
+  const ScriptValue nameValue = arguments[0];
+
+  if (!nameValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'setAttribute' on 'Element': name attribute is not valid.");
+    return ScriptValue();
+  }
+
+  std::string name = nameValue.toString();
+  auto attributes = elementInstance->getAttributes();
+
+  return ScriptValue::makeBoolean(context, attributes->hasAttribute(name));
+}
+
+ScriptValue JSElement::removeAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto element = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (element == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'removeAttribute' on 'Element': 1 argument required, but only 0 present");
+    return ScriptValue();
+  }
+
+  const ScriptValue nameValue = arguments[0];
+
+  if (!nameValue.isString()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'removeAttribute' on 'Element': name attribute is not valid.");
+    return ScriptValue();
+  }
+
+  std::string name = nameValue.toString();
+  auto attributes = element->getAttributes();
+
+  if (attributes->hasAttribute(name)) {
+    std::string id = attributes->getAttribute(name);
+    std::string empty;
+
+    attributes->removeAttribute(name);
+    element->_didModifyAttribute(name, id, empty);
+
+    NativeString args_01{};
+    buildUICommandArgs(name, args_01);
+    element->context->getUICommandQueue()->registerCommand(element->eventTargetId, UICommand::removeProperty, args_01,
+                                                           nullptr);
+  }
+
+  return ScriptValue();
+}
+
+struct ToBlobPromiseContext {
+  int32_t id;
+  double devicePixelRatio;
+};
+
+ScriptValue JSElement::toBlob(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  const ScriptValue devicePixelRatioValue = arguments[0];
+
+  if (!devicePixelRatioValue.isNumber()) {
+    *exception = ScriptValue::makeError(context, "Failed to export blob: parameter 2 (devicePixelRatio) is not an number.");
+    return ScriptValue();
+  }
+
+  if (getDartMethod()->toBlob == nullptr) {
+    *exception = ScriptValue::makeError(context, "Failed to export blob: dart method (toBlob) is not registered.");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+
+  // The executor runs before the Promise constructor returns, the context on the stack is alive by then.
+  ToBlobPromiseContext toBlobPromiseContext{elementInstance->eventTargetId, devicePixelRatioValue.toNumber()};
+
+  NativeFunction executor = [](ScriptContext *context, const ScriptValue &thisObject,
+                               const ScriptArguments &arguments, void *data, ScriptValue *exception) -> ScriptValue {
+    auto toBlobPromiseContext = static_cast<ToBlobPromiseContext *>(data);
+    auto bridge = static_cast<JSBridge *>(context->getOwner());
+    auto callbackContext =
+      std::make_unique<BridgeCallback::Context>(*context, arguments[0].raw(), arguments[1].raw());
+
+    auto handleTransientToBlobCallback = [](void *handle, int32_t contextId, const char *error, uint8_t *bytes,
+                                            int32_t length) {
+      auto callbackContext = getBridgeCallbackContext(contextId, handle);
+      if (callbackContext == nullptr) return;
+      ScriptContext *context = &callbackContext->_context;
+      ScriptScope scope(context);
+
+      if (error != nullptr) {
+        ScriptValue reject(context, callbackContext->_secondaryCallback);
+        reject.call(ScriptValue(), {ScriptValue::makeString(context, error)}, nullptr);
+      } else {
+        std::vector<uint8_t> vec(bytes, bytes + length);
+        auto blob = new JSBlob::BlobInstance(JSBlob::instance(context), std::move(vec));
+        ScriptValue resolve(context, callbackContext->_callback);
+        resolve.call(ScriptValue(), {blob->value()}, nullptr);
+      }
+      auto bridge = static_cast<JSBridge *>(context->getOwner());
+      bridge->bridgeCallback->freeBridgeCallbackContext(handle);
+    };
+
+    int32_t id = toBlobPromiseContext->id;
+    double devicePixelRatio = toBlobPromiseContext->devicePixelRatio;
+    bridge->bridgeCallback->registerCallback<void>(
+      std::move(callbackContext),
+      [id, devicePixelRatio, handleTransientToBlobCallback](BridgeCallback::Handle handle, int32_t contextId) {
+        getDartMethod()->toBlob(handle, contextId, handleTransientToBlobCallback, id, devicePixelRatio);
+      });
+
+    return ScriptValue();
+  };
+
+  return ScriptValue::makePromise(context, executor, &toBlobPromiseContext, exception);
+}
+
+ScriptValue JSElement::click(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeElement->click != nullptr, "Failed to execute click(): dart method is nullptr.");
+  elementInstance->nativeElement->click(elementInstance->nativeElement);
+
+  return ScriptValue();
+}
+
+ScriptValue JSElement::scroll(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  const ScriptValue xValue = arguments[0];
+  const ScriptValue yValue = arguments[1];
+
+  double x = 0.0;
+  double y = 0.0;
+
+  if (xValue.isNumber()) {
+    x = xValue.toNumber();
+  }
+
+  if (yValue.isNumber()) {
+    y = yValue.toNumber();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeElement->scroll != nullptr, "Failed to execute scroll(): dart method is nullptr.");
+  elementInstance->nativeElement->scroll(elementInstance->nativeElement, x, y);
+
+  return ScriptValue();
+}
+
+ScriptValue JSElement::scrollBy(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance = HostClass::instanceOf<ElementInstance>(thisObject, static_cast<JSElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  const ScriptValue xValue = arguments[0];
+  const ScriptValue yValue = arguments[1];
+
+  double x = 0.0;
+  double y = 0.0;
+
+  if (xValue.isNumber()) {
+    x = xValue.toNumber();
+  }
+
+  if (yValue.isNumber()) {
+    y = yValue.toNumber();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeElement->scrollBy != nullptr,
+           "Failed to execute scrollBy(): dart method is nullptr.");
+  elementInstance->nativeElement->scrollBy(elementInstance->nativeElement, x, y);
+
+  return ScriptValue();
+}
+
+ElementInstance *JSElement::buildElementInstance(ScriptContext *context, const std::string &name) {
+  ElementInstance *elementInstance;
+  if (elementCreatorMap.count(name) > 0) {
+    elementInstance = elementCreatorMap[name](context);
+  } else {
+    // Fallback to default Element class
+    elementInstance = new ElementInstance(JSElement::instance(context), name.c_str(), true);
+  }
+  return elementInstance;
+}
+
+void JSElement::defineElement(std::string tagName, ElementCreator creator) {
+  if (elementCreatorMap.count(tagName) > 0) return;
+
+  elementCreatorMap[tagName] = creator;
+}
+
+void ElementInstance::_notifyNodeRemoved(NodeInstance *insertionNode) {
+  if (insertionNode->isConnected()) {
+    traverseNode(this, [](NodeInstance *node) {
+      auto Element = JSElement::instance(node->context);
+      if (node->_hostClass->isSubclassOf(Element)) {
+        auto element = static_cast<ElementInstance *>(node);
+        element->_notifyChildRemoved();
+      }
+
+      return false;
+    });
+  }
+}
+void ElementInstance::_notifyChildRemoved() {
+  auto attributes = getAttributes();
+  std::string idString = "id";
+  if (attributes->hasAttribute(idString)) {
+    std::string id = attributes->getAttribute(idString);
+    document->removeElementById(id, this);
+  }
+}
+void ElementInstance::_notifyNodeInsert(NodeInstance *insertNode) {
+  if (insertNode->isConnected()) {
+    traverseNode(this, [](NodeInstance *node) {
+      auto Element = JSElement::instance(node->context);
+      if (node->_hostClass->isSubclassOf(Element)) {
+        auto element = static_cast<ElementInstance *>(node);
+        element->_notifyChildInsert();
+      }
+
+      return false;
+    });
+  }
+}
+void ElementInstance::_notifyChildInsert() {
+  std::string idKey = "id";
+  auto attributes = getAttributes();
+  if (attributes->hasAttribute(idKey)) {
+    std::string id = attributes->getAttribute(idKey);
+    document->addElementById(id, this);
+  }
+}
+void ElementInstance::_didModifyAttribute(const std::string &name, const std::string &oldId,
+                                          const std::string &newId) {
+  if (name == "id") {
+    _beforeUpdateId(oldId, newId);
+  }
+}
+void ElementInstance::_beforeUpdateId(const std::string &oldId, const std::string &newId) {
+  if (oldId == newId) return;
+
+  if (!oldId.empty()) {
+    document->removeElementById(oldId, this);
+  }
+
+  if (!newId.empty()) {
+    document->addElementById(newId, this);
+  }
+}
+
+std::string ElementInstance::tagName() {
+  std::string tagName = m_tagName;
+  std::transform(tagName.begin(), tagName.end(), tagName.begin(), ::toupper);
+  return tagName;
+}
+
+JSElementAttributes *ElementInstance::getAttributes() {
+  return m_attributes.hostObject<JSElementAttributes>();
+}
+
+StyleDeclarationInstance *ElementInstance::getStyle() {
+  return m_style.hostObject<StyleDeclarationInstance>();
+}
+
+void ElementInstance::internalSetTextContent(const std::string &content, ScriptValue *exception) {
+  auto node = firstChild();
+  while (node != nullptr) {
+    internalRemoveChild(node, exception);
+    node = firstChild();
+  }
+
+  auto TextNode = JSTextNode::instance(context);
+  auto textNode = new JSTextNode::TextNodeInstance(TextNode, content);
+  internalAppendChild(textNode);
+}
+
+BoundingClientRect::BoundingClientRect(ScriptContext *context, NativeBoundingClientRect *boundingClientRect)
+  : HostObject(context, "BoundingClientRect"), nativeBoundingClientRect(boundingClientRect) {}
+
+ScriptValue ElementInstance::getStringValueProperty(const std::string &name) {
+  NativeString *nativeString = stringToNativeString(name);
+  NativeString *returnedString = nativeElement->getStringValueProperty(nativeElement, nativeString);
+  ScriptValue result = ScriptValue::makeString(context, nativeStringToU16String(returnedString));
+  returnedString->free();
+  nativeString->free();
+  return result;
+}
+
+ScriptValue BoundingClientRect::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getPropertyMap();
+
+  if (propertyMap.count(name) == 0) return ScriptValue();
+  auto property = propertyMap.at(name);
+
+  switch (property) {
+  case kX:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->x);
+  case kY:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->y);
+  case kWidth:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->width);
+  case kHeight:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->height);
+  case kLeft:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->left);
+  case kTop:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->top);
+  case kRight:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->right);
+  case kBottom:
+    return ScriptValue::makeNumber(context, nativeBoundingClientRect->bottom);
+  }
+
+  return ScriptValue();
+}
+
+std::array<std::string, 8> &BoundingClientRect::getBoundingClientRectPropertyNames() {
+  static std::array<std::string, 8> propertyNames{"x", "y", "width", "height", "top", "right", "bottom", "left"};
+  return propertyNames;
+}
+
+const std::unordered_map<std::string, BoundingClientRect::BoundingClientRectProperty> &
+BoundingClientRect::getPropertyMap() {
+  static const std::unordered_map<std::string, BoundingClientRectProperty> propertyMap{
+    {"x", BoundingClientRectProperty::kX},         {"y", BoundingClientRectProperty::kY},
+    {"width", BoundingClientRectProperty::kWidth}, {"height", BoundingClientRectProperty::kHeight},
+    {"top", BoundingClientRectProperty::kTop},     {"left", BoundingClientRectProperty::kLeft},
+    {"right", BoundingClientRectProperty::kRight}, {"bottom", BoundingClientRectProperty::kBottom}};
+  return propertyMap;
+}
+
+void BoundingClientRect::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getBoundingClientRectPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+BoundingClientRect::~BoundingClientRect() {
+  delete nativeBoundingClientRect;
+}
+
+void traverseNode(NodeInstance *node, TraverseHandler handler) {
+  bool shouldExit = handler(node);
+  if (shouldExit) return;
+
+  if (!node->childNodes.empty()) {
+    for (auto &n : node->childNodes) {
+      traverseNode(n, handler);
+    }
+  }
+}
+
+} // namespace kraken::binding
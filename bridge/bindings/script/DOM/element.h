@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_ELEMENT_H
+#define KRAKENBRIDGE_SCRIPT_ELEMENT_H
+
+#include "bindings/script/DOM/node.h"
+#include "bindings/script/DOM/style_declaration.h"
+#include "include/kraken_bridge.h"
+#include <array>
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindElement(ScriptContext *context);
+
+class ElementInstance;
+struct NativeElement;
+
+using TraverseHandler = std::function<bool(NodeInstance *)>;
+void traverseNode(NodeInstance *node, TraverseHandler handler);
+
+class JSElementAttributes : public HostObject {
+public:
+  JSElementAttributes() = delete;
+  JSElementAttributes(ScriptContext *context) : HostObject(context, "NamedNodeMap") {}
+  ~JSElementAttributes() override;
+
+  enum class AttributeProperty { kLength };
+
+  static std::vector<std::string> &getAttributePropertyNames();
+  static const std::unordered_map<std::string, AttributeProperty> &getAttributePropertyMap();
+
+  KRAKEN_EXPORT std::string getAttribute(const std::string &name);
+  KRAKEN_EXPORT void setAttribute(const std::string &name, const std::string &value);
+  KRAKEN_EXPORT bool hasAttribute(const std::string &name);
+  KRAKEN_EXPORT void removeAttribute(const std::string &name);
+
+  KRAKEN_EXPORT std::map<std::string, std::string> &getAttributesMap();
+  KRAKEN_EXPORT void setAttributesMap(const std::map<std::string, std::string> &attributes);
+
+  KRAKEN_EXPORT std::vector<std::string> &getAttributesVector();
+  KRAKEN_EXPORT void setAttributesVector(const std::vector<std::string> &attributes);
+
+  KRAKEN_EXPORT ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  KRAKEN_EXPORT bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  KRAKEN_EXPORT void getPropertyNames(std::vector<std::string> &names) override;
+
+private:
+  std::map<std::string, std::string> m_attributes;
+  // Names of attributes in the order they are set, for index access.
+  std::vector<std::string> v_attributes;
+};
+
+struct NativeBoundingClientRect {
+  double x;
+  double y;
+  double width;
+  double height;
+  double top;
+  double right;
+  double bottom;
+  double left;
+};
+
+using ElementCreator = ElementInstance *(*)(ScriptContext *context);
+
+class KRAKEN_EXPORT JSElement : public JSNode {
+public:
+  DEFINE_OBJECT_PROPERTY(Element, 17, style, attributes, nodeName, tagName, offsetLeft, offsetTop, offsetWidth,
+                         offsetHeight, clientWidth, clientHeight, clientTop, clientLeft, scrollTop, scrollLeft,
+                         scrollHeight, scrollWidth, children);
+
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(Element, 10, getBoundingClientRect, getAttribute, setAttribute, hasAttribute,
+                                   removeAttribute, toBlob, click, scroll, scrollBy, scrollTo);
+
+  enum class ElementTagName {
+    kDiv,
+    kSpan,
+    kAnchor,
+    kAnimationPlayer,
+    kAudio,
+    kVideo,
+    kStrong,
+    kPre,
+    kParagraph,
+    kIframe,
+    kObject,
+    kImage,
+    kCanvas,
+    kInput,
+  };
+
+  static std::unordered_map<ScriptContext *, JSElement *> instanceMap;
+  static std::unordered_map<std::string, ElementCreator> elementCreatorMap;
+  OBJECT_INSTANCE(JSElement)
+
+  static ElementInstance *buildElementInstance(ScriptContext *context, const std::string &tagName);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  static void defineElement(std::string tagName, ElementCreator creator);
+
+protected:
+  JSElement() = delete;
+  explicit JSElement(ScriptContext *context);
+  // Classes of subclasses inherit Element.
+  explicit JSElement(ScriptContext *context, const char *name);
+  ~JSElement() override;
+
+private:
+  friend ElementInstance;
+
+  static ScriptValue getBoundingClientRect(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue hasAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue setAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue removeAttribute(ScriptContext *context, const ScriptValue &thisObject,
+                                     const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue toBlob(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue click(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue scroll(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue scrollBy(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception);
+  FunctionHolder m_getBoundingClientRect{context, prototypeObject, this, "getBoundingClientRect",
+                                         getBoundingClientRect};
+  FunctionHolder m_setAttribute{context, prototypeObject, this, "setAttribute", setAttribute};
+  FunctionHolder m_getAttribute{context, prototypeObject, this, "getAttribute", getAttribute};
+  FunctionHolder m_hasAttribute{context, prototypeObject, this, "hasAttribute", hasAttribute};
+  FunctionHolder m_removeAttribute{context, prototypeObject, this, "removeAttribute", removeAttribute};
+  FunctionHolder m_toBlob{context, prototypeObject, this, "toBlob", toBlob};
+  FunctionHolder m_click{context, prototypeObject, this, "click", click};
+  FunctionHolder m_scroll{context, prototypeObject, this, "scroll", scroll};
+  FunctionHolder m_scrollTo{context, prototypeObject, this, "scrollTo", scroll};
+  FunctionHolder m_scrollBy{context, prototypeObject, this, "scrollBy", scrollBy};
+};
+
+class KRAKEN_EXPORT ElementInstance : public NodeInstance {
+public:
+  ElementInstance() = delete;
+  explicit ElementInstance(JSElement *element, const char *tagName, bool sendUICommand);
+  // Elements created by dart, such as body, which have their target id already.
+  explicit ElementInstance(JSElement *element, const std::string &tagName, int64_t targetId);
+  ~ElementInstance() override;
+
+  ScriptValue getStringValueProperty(const std::string &name);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  std::string internalGetTextContent() override;
+  void internalSetTextContent(const std::string &content, ScriptValue *exception) override;
+  JSElementAttributes *getAttributes();
+  StyleDeclarationInstance *getStyle();
+
+  NativeElement *nativeElement{nullptr};
+
+  std::string tagName();
+
+private:
+  friend JSElement;
+  std::string m_tagName;
+
+  KRAKEN_EXPORT void _notifyNodeRemoved(NodeInstance *node) override;
+  void _notifyChildRemoved();
+  KRAKEN_EXPORT void _notifyNodeInsert(NodeInstance *insertNode) override;
+  void _notifyChildInsert();
+  void _didModifyAttribute(const std::string &name, const std::string &oldId, const std::string &newId);
+  void _beforeUpdateId(const std::string &oldId, const std::string &newId);
+  ScriptValue m_attributes{(new JSElementAttributes(context))->value()};
+  ScriptValue m_style{(new StyleDeclarationInstance(CSSStyleDeclaration::instance(context), this))->value()};
+};
+
+enum class ViewModuleProperty {
+  offsetTop,
+  offsetLeft,
+  offsetWidth,
+  offsetHeight,
+  clientWidth,
+  clientHeight,
+  clientTop,
+  clientLeft,
+  scrollTop,
+  scrollLeft,
+  scrollHeight,
+  scrollWidth
+};
+using GetViewModuleProperty = double (*)(NativeElement *nativeElement, int64_t property);
+using SetViewModuleProperty = void (*)(NativeElement *nativeElement, int64_t property, double value);
+using GetBoundingClientRect = NativeBoundingClientRect *(*)(NativeElement *nativeElement);
+using GetStringValueProperty = NativeString *(*)(NativeElement *nativeElement, NativeString *property);
+using Click = void (*)(NativeElement *nativeElement);
+using Scroll = void (*)(NativeElement *nativeElement, int32_t x, int32_t y);
+using ScrollBy = void (*)(NativeElement *nativeElement, int32_t x, int32_t y);
+
+class BoundingClientRect : public HostObject {
+public:
+  enum BoundingClientRectProperty { kX, kY, kWidth, kHeight, kLeft, kTop, kRight, kBottom };
+
+  static std::array<std::string, 8> &getBoundingClientRectPropertyNames();
+  static const std::unordered_map<std::string, BoundingClientRectProperty> &getPropertyMap();
+
+  BoundingClientRect() = delete;
+  ~BoundingClientRect() override;
+  BoundingClientRect(ScriptContext *context, NativeBoundingClientRect *boundingClientRect);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+private:
+  NativeBoundingClientRect *nativeBoundingClientRect;
+};
+
+// An struct represent Element object from dart side.
+struct NativeElement {
+  NativeElement() = delete;
+  explicit NativeElement(NativeNode *nativeNode) : nativeNode(nativeNode){};
+
+  const NativeNode *nativeNode;
+
+  GetViewModuleProperty getViewModuleProperty{nullptr};
+  SetViewModuleProperty setViewModuleProperty{nullptr};
+  GetBoundingClientRect getBoundingClientRect{nullptr};
+  GetStringValueProperty getStringValueProperty{nullptr};
+  Click click{nullptr};
+  Scroll scroll{nullptr};
+  ScrollBy scrollBy{nullptr};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_ELEMENT_H
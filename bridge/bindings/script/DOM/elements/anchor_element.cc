@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "anchor_element.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+
+namespace kraken::binding {
+
+JSAnchorElement::JSAnchorElement(ScriptContext *context) : JSElement(context, "HTMLAnchorElement") {}
+
+std::unordered_map<ScriptContext *, JSAnchorElement *> JSAnchorElement::instanceMap{};
+
+JSAnchorElement::~JSAnchorElement() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSAnchorElement::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new AnchorElementInstance(this);
+  return instance->value();
+}
+
+JSAnchorElement::AnchorElementInstance::AnchorElementInstance(JSAnchorElement *jsAnchorElement)
+  : ElementInstance(jsAnchorElement, "a", false), nativeAnchorElement(new NativeAnchorElement(nativeElement)) {
+  std::string tagName = "a";
+  NativeString args_01{};
+  buildUICommandArgs(tagName, args_01);
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createElement, args_01, nativeAnchorElement);
+}
+
+ScriptValue JSAnchorElement::AnchorElementInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getAnchorElementPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case AnchorElementProperty::href:
+      return ScriptValue::makeString(context, _href);
+    case AnchorElementProperty::target:
+      return ScriptValue::makeString(context, _target);
+    }
+  }
+
+  return ElementInstance::getProperty(name, exception);
+}
+
+bool JSAnchorElement::AnchorElementInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                         ScriptValue *exception) {
+  auto &propertyMap = getAnchorElementPropertyMap();
+
+  if (propertyMap.count(name) == 0) return ElementInstance::setProperty(name, value, exception);
+
+  auto property = propertyMap[name];
+
+  if (property == AnchorElementProperty::href) {
+    _href = value.toU16String();
+    NativeString args_01{};
+    NativeString args_02{};
+    buildUICommandArgs(name, _href, args_01, args_02);
+    context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+  } else if (property == AnchorElementProperty::target) {
+    _target = value.toU16String();
+    NativeString args_01{};
+    NativeString args_02{};
+    buildUICommandArgs(name, _target, args_01, args_02);
+    context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+  }
+
+  return true;
+}
+
+void JSAnchorElement::AnchorElementInstance::getPropertyNames(std::vector<std::string> &names) {
+  ElementInstance::getPropertyNames(names);
+
+  for (auto &property : getAnchorElementPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+JSAnchorElement::AnchorElementInstance::~AnchorElementInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeAnchorElement *>(ptr); }, nativeAnchorElement);
+}
+
+} // namespace kraken::binding
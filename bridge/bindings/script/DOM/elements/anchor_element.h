@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_ANCHOR_ELEMENT_H
+#define KRAKENBRIDGE_SCRIPT_ANCHOR_ELEMENT_H
+
+#include "bindings/script/DOM/element.h"
+
+namespace kraken::binding {
+
+struct NativeAnchorElement;
+
+class JSAnchorElement : public JSElement {
+public:
+  static std::unordered_map<ScriptContext *, JSAnchorElement *> instanceMap;
+  OBJECT_INSTANCE(JSAnchorElement)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class AnchorElementInstance : public ElementInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(AnchorElement, 2, href, target)
+
+    AnchorElementInstance() = delete;
+    AnchorElementInstance(JSAnchorElement *jsAnchorElement);
+    ~AnchorElementInstance() override;
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    NativeAnchorElement *nativeAnchorElement{nullptr};
+
+  private:
+    std::u16string _href;
+    std::u16string _target;
+  };
+
+protected:
+  JSAnchorElement() = delete;
+  ~JSAnchorElement() override;
+  explicit JSAnchorElement(ScriptContext *context);
+};
+
+struct NativeAnchorElement {
+  NativeAnchorElement() = delete;
+  explicit NativeAnchorElement(NativeElement *nativeElement) : nativeElement(nativeElement){};
+
+  NativeElement *nativeElement;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_ANCHOR_ELEMENT_H
@@ -0,0 +1,1061 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "canvas_element.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+#include <cmath>
+
+namespace kraken::binding {
+
+std::unordered_map<ScriptContext *, JSCanvasElement *> JSCanvasElement::instanceMap{};
+
+JSCanvasElement::~JSCanvasElement() {
+  instanceMap.erase(context);
+}
+
+JSCanvasElement::JSCanvasElement(ScriptContext *context) : JSElement(context, "HTMLCanvasElement") {}
+
+ScriptValue JSCanvasElement::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new CanvasElementInstance(this);
+  return instance->value();
+}
+
+JSCanvasElement::CanvasElementInstance::CanvasElementInstance(JSCanvasElement *jsCanvasElement)
+  : ElementInstance(jsCanvasElement, "canvas", false), nativeCanvasElement(new NativeCanvasElement(nativeElement)) {
+
+  std::string tagName = "canvas";
+  NativeString args_01{};
+  buildUICommandArgs(tagName, args_01);
+
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createElement, args_01, nativeCanvasElement);
+}
+
+JSCanvasElement::CanvasElementInstance::~CanvasElementInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeCanvasElement *>(ptr); }, nativeCanvasElement);
+}
+
+ScriptValue JSCanvasElement::CanvasElementInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getCanvasElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case CanvasElementProperty::width: {
+      return ScriptValue::makeNumber(context, _width);
+    }
+    case CanvasElementProperty::height:
+      return ScriptValue::makeNumber(context, _height);
+    }
+  }
+
+  return ElementInstance::getProperty(name, exception);
+}
+
+bool JSCanvasElement::CanvasElementInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                         ScriptValue *exception) {
+  auto &propertyMap = getCanvasElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case CanvasElementProperty::width: {
+      _width = value.toNumber();
+
+      std::string widthString = std::to_string(_width);
+
+      NativeString args_01{};
+      NativeString args_02{};
+
+      buildUICommandArgs(name, widthString, args_01, args_02);
+
+      context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+      break;
+    }
+    case CanvasElementProperty::height: {
+      _height = value.toNumber();
+
+      std::string heightString = std::to_string(_height);
+
+      NativeString args_01{};
+      NativeString args_02{};
+
+      buildUICommandArgs(name, heightString, args_01, args_02);
+      context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+      break;
+    }
+    default:
+      break;
+    }
+    return true;
+  } else {
+    return ElementInstance::setProperty(name, value, exception);
+  }
+}
+
+void JSCanvasElement::CanvasElementInstance::getPropertyNames(std::vector<std::string> &names) {
+  ElementInstance::getPropertyNames(names);
+
+  for (auto &property : getCanvasElementPropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : getCanvasElementPrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+ScriptValue JSCanvasElement::getContext(ScriptContext *context, const ScriptValue &thisObject,
+                                        const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'getContext' on 'CanvasRenderingContext2D': 1 argument required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  auto elementInstance =
+    HostClass::instanceOf<JSCanvasElement::CanvasElementInstance>(thisObject, static_cast<JSCanvasElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  std::u16string contextIdString = arguments[0].toU16String();
+  NativeString contextId{};
+  contextId.string = reinterpret_cast<const uint16_t *>(contextIdString.c_str());
+  contextId.length = contextIdString.size();
+
+  getDartMethod()->flushUICommand();
+
+  assert_m(elementInstance->nativeCanvasElement->getContext != nullptr,
+           "Failed to call getContext(): dart method is nullptr");
+  NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D =
+    elementInstance->nativeCanvasElement->getContext(elementInstance->nativeCanvasElement, &contextId);
+  auto canvasRenderContext2d = CanvasRenderingContext2D::instance(elementInstance->context);
+  auto canvasRenderContext2dInstance = new CanvasRenderingContext2D::CanvasRenderingContext2DInstance(
+    canvasRenderContext2d, nativeCanvasRenderingContext2D);
+  return canvasRenderContext2dInstance->value();
+}
+
+std::unordered_map<ScriptContext *, CanvasRenderingContext2D *> CanvasRenderingContext2D::instanceMap{};
+
+CanvasRenderingContext2D::CanvasRenderingContext2D(ScriptContext *context)
+  : HostClass(context, "CanvasRenderingContext2D") {}
+
+CanvasRenderingContext2D::~CanvasRenderingContext2D() {
+  instanceMap.erase(context);
+}
+
+CanvasRenderingContext2D::CanvasRenderingContext2DInstance::CanvasRenderingContext2DInstance(
+  CanvasRenderingContext2D *canvasRenderContext2D, NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D)
+  : Instance(canvasRenderContext2D), nativeCanvasRenderingContext2D(nativeCanvasRenderingContext2D) {}
+
+CanvasRenderingContext2D::CanvasRenderingContext2DInstance::~CanvasRenderingContext2DInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeCanvasRenderingContext2D *>(ptr); }, nativeCanvasRenderingContext2D);
+}
+
+ScriptValue CanvasRenderingContext2D::CanvasRenderingContext2DInstance::getProperty(const std::string &name,
+                                                                                    ScriptValue *exception) {
+  auto &propertyMap = getCanvasRenderingContext2DPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+    switch (property) {
+    case CanvasRenderingContext2DProperty::direction: {
+      return ScriptValue::makeString(context, m_direction);
+    }
+    case CanvasRenderingContext2DProperty::font: {
+      return ScriptValue::makeString(context, m_font);
+    }
+    case CanvasRenderingContext2DProperty::fillStyle: {
+      return ScriptValue::makeString(context, m_fillStyle);
+    }
+    case CanvasRenderingContext2DProperty::lineCap: {
+      return ScriptValue::makeString(context, m_lineCap);
+    }
+    case CanvasRenderingContext2DProperty::lineDashOffset: {
+      return ScriptValue::makeString(context, m_lineDashOffset);
+    }
+    case CanvasRenderingContext2DProperty::lineJoin: {
+      return ScriptValue::makeString(context, m_lineJoin);
+    }
+    case CanvasRenderingContext2DProperty::lineWidth: {
+      return ScriptValue::makeString(context, m_lineWidth);
+    }
+    case CanvasRenderingContext2DProperty::miterLimit: {
+      return ScriptValue::makeString(context, m_miterLimit);
+    }
+    case CanvasRenderingContext2DProperty::strokeStyle: {
+      return ScriptValue::makeString(context, m_strokeStyle);
+    }
+    case CanvasRenderingContext2DProperty::textAlign: {
+      return ScriptValue::makeString(context, m_textAlign);
+    }
+    case CanvasRenderingContext2DProperty::textBaseline: {
+      return ScriptValue::makeString(context, m_textBaseline);
+    }
+    }
+  }
+
+  return Instance::getProperty(name, exception);
+}
+
+bool CanvasRenderingContext2D::CanvasRenderingContext2DInstance::setProperty(const std::string &name,
+                                                                             const ScriptValue &value,
+                                                                             ScriptValue *exception) {
+  auto &propertyMap = getCanvasRenderingContext2DPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    getDartMethod()->flushUICommand();
+
+    switch (property) {
+    case CanvasRenderingContext2DProperty::direction: {
+      m_direction = value.toU16String();
+
+      NativeString nativeDirection{};
+      nativeDirection.string = reinterpret_cast<const uint16_t *>(m_direction.c_str());
+      nativeDirection.length = m_direction.size();
+      assert_m(nativeCanvasRenderingContext2D->setDirection != nullptr,
+               "Failed to execute setDirection(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setDirection(nativeCanvasRenderingContext2D, &nativeDirection);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::font: {
+      m_font = value.toU16String();
+
+      NativeString nativeFont{};
+      nativeFont.string = reinterpret_cast<const uint16_t *>(m_font.c_str());
+      nativeFont.length = m_font.size();
+      assert_m(nativeCanvasRenderingContext2D->setFont != nullptr,
+               "Failed to execute setFont(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setFont(nativeCanvasRenderingContext2D, &nativeFont);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::fillStyle: {
+      m_fillStyle = value.toU16String();
+
+      NativeString nativeFillStyle{};
+      nativeFillStyle.string = reinterpret_cast<const uint16_t *>(m_fillStyle.c_str());
+      nativeFillStyle.length = m_fillStyle.size();
+      assert_m(nativeCanvasRenderingContext2D->setFillStyle != nullptr,
+               "Failed to execute setFillStyle(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setFillStyle(nativeCanvasRenderingContext2D, &nativeFillStyle);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::strokeStyle: {
+      m_strokeStyle = value.toU16String();
+
+      NativeString nativeStrokeStyle{};
+      nativeStrokeStyle.string = reinterpret_cast<const uint16_t *>(m_strokeStyle.c_str());
+      nativeStrokeStyle.length = m_strokeStyle.size();
+      assert_m(nativeCanvasRenderingContext2D->setStrokeStyle != nullptr,
+               "Failed to execute setStrokeStyle(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setStrokeStyle(nativeCanvasRenderingContext2D, &nativeStrokeStyle);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::lineCap: {
+      m_lineCap = value.toU16String();
+
+      NativeString nativeLineCap{};
+      nativeLineCap.string = reinterpret_cast<const uint16_t *>(m_lineCap.c_str());
+      nativeLineCap.length = m_lineCap.size();
+      assert_m(nativeCanvasRenderingContext2D->setLineCap != nullptr,
+               "Failed to execute setLineCap(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setLineCap(nativeCanvasRenderingContext2D, &nativeLineCap);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::lineDashOffset: {
+      m_lineDashOffset = value.toU16String();
+
+      NativeString nativeLineDashOffset{};
+      nativeLineDashOffset.string = reinterpret_cast<const uint16_t *>(m_lineDashOffset.c_str());
+      nativeLineDashOffset.length = m_lineDashOffset.size();
+      assert_m(nativeCanvasRenderingContext2D->setLineDashOffset != nullptr,
+               "Failed to execute setLineDashOffset(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setLineDashOffset(nativeCanvasRenderingContext2D, &nativeLineDashOffset);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::lineJoin: {
+      m_lineJoin = value.toU16String();
+
+      NativeString nativeLineJoin{};
+      nativeLineJoin.string = reinterpret_cast<const uint16_t *>(m_lineJoin.c_str());
+      nativeLineJoin.length = m_lineJoin.size();
+      assert_m(nativeCanvasRenderingContext2D->setLineJoin != nullptr,
+               "Failed to execute setLineJoin(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setLineJoin(nativeCanvasRenderingContext2D, &nativeLineJoin);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::lineWidth: {
+      m_lineWidth = value.toU16String();
+
+      NativeString nativeLineWidth{};
+      nativeLineWidth.string = reinterpret_cast<const uint16_t *>(m_lineWidth.c_str());
+      nativeLineWidth.length = m_lineWidth.size();
+      assert_m(nativeCanvasRenderingContext2D->setLineWidth != nullptr,
+               "Failed to execute setLineWidth(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setLineWidth(nativeCanvasRenderingContext2D, &nativeLineWidth);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::miterLimit: {
+      m_miterLimit = value.toU16String();
+
+      NativeString nativeMiterLimit{};
+      nativeMiterLimit.string = reinterpret_cast<const uint16_t *>(m_miterLimit.c_str());
+      nativeMiterLimit.length = m_miterLimit.size();
+      assert_m(nativeCanvasRenderingContext2D->setMiterLimit != nullptr,
+               "Failed to execute setMiterLimit(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setMiterLimit(nativeCanvasRenderingContext2D, &nativeMiterLimit);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::textAlign: {
+      m_textAlign = value.toU16String();
+
+      NativeString nativeTextAlign{};
+      nativeTextAlign.string = reinterpret_cast<const uint16_t *>(m_textAlign.c_str());
+      nativeTextAlign.length = m_textAlign.size();
+      assert_m(nativeCanvasRenderingContext2D->setTextAlign != nullptr,
+               "Failed to execute setTextAlign(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setTextAlign(nativeCanvasRenderingContext2D, &nativeTextAlign);
+      break;
+    }
+    case CanvasRenderingContext2DProperty::textBaseline: {
+      m_textBaseline = value.toU16String();
+
+      NativeString nativeTextBaseline{};
+      nativeTextBaseline.string = reinterpret_cast<const uint16_t *>(m_textBaseline.c_str());
+      nativeTextBaseline.length = m_textBaseline.size();
+      assert_m(nativeCanvasRenderingContext2D->setTextBaseline != nullptr,
+               "Failed to execute setTextBaseline(): dart method is nullptr.");
+      nativeCanvasRenderingContext2D->setTextBaseline(nativeCanvasRenderingContext2D, &nativeTextBaseline);
+      break;
+    }
+    default:
+      break;
+    }
+    return true;
+  } else {
+    return Instance::setProperty(name, value, exception);
+  }
+}
+
+ScriptValue CanvasRenderingContext2D::arc(ScriptContext *context, const ScriptValue &thisObject,
+                                          const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 5 && arguments.size() != 6) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'arc' on 'CanvasRenderingContext2D': 5 or 6 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+  double radius = arguments[2].toNumber();
+  double startAngle = arguments[3].toNumber();
+  double endAngle = arguments[4].toNumber();
+  // An optional Boolean. If true, draws the arc counter-clockwise between the start and end angles.
+  // The default is false (clockwise).
+  // 0 will become false, and 1 for true
+  bool counterclockwise = false;
+  if (arguments.size() == 6) {
+    counterclockwise = arguments[5].toBoolean();
+  }
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->arc != nullptr,
+           "Failed to execute arc(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->arc(instance->nativeCanvasRenderingContext2D, x, y, radius, startAngle, endAngle, counterclockwise ? 1 : 0);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::arcTo(ScriptContext *context, const ScriptValue &thisObject,
+                                            const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 5) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'arcTo' on 'CanvasRenderingContext2D': 5 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x1 = arguments[0].toNumber();
+  double y1 = arguments[1].toNumber();
+  double x2 = arguments[2].toNumber();
+  double y2 = arguments[3].toNumber();
+  double radius = arguments[4].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->arcTo != nullptr,
+           "Failed to execute arcTo(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->arcTo(instance->nativeCanvasRenderingContext2D, x1, y1, x2, y2, radius);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::beginPath(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->beginPath != nullptr,
+           "Failed to execute beginPath(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->beginPath(instance->nativeCanvasRenderingContext2D);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::bezierCurveTo(ScriptContext *context, const ScriptValue &thisObject,
+                                                    const ScriptArguments &arguments, void *data,
+                                                    ScriptValue *exception) {
+  if (arguments.size() != 6) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'bezierCurveTo' on 'CanvasRenderingContext2D': 6 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double cp1x = arguments[0].toNumber();
+  double cp1y = arguments[1].toNumber();
+  double cp2x = arguments[2].toNumber();
+  double cp2y = arguments[3].toNumber();
+  double x = arguments[4].toNumber();
+  double y = arguments[5].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->bezierCurveTo != nullptr,
+           "Failed to execute bezierCurveTo(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->bezierCurveTo(instance->nativeCanvasRenderingContext2D, cp1x, cp1y, cp2x, cp2y, x, y);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::closePath(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->closePath != nullptr,
+           "Failed to execute closePath(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->closePath(instance->nativeCanvasRenderingContext2D);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::clip(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 0 && arguments.size() != 1)  {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'clip' on 'CanvasRenderingContext2D': 0 or 1 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  std::u16string fillRule;
+  if (arguments.size() == 1) {
+    fillRule = arguments[0].toU16String();
+  }
+  NativeString fillRuleNativeString{};
+  fillRuleNativeString.string = reinterpret_cast<const uint16_t *>(fillRule.c_str());
+  fillRuleNativeString.length = fillRule.size();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->clip != nullptr,
+           "Failed to execute clip(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->clip(instance->nativeCanvasRenderingContext2D, &fillRuleNativeString);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::ellipse(ScriptContext *context, const ScriptValue &thisObject,
+                                              const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 7 && arguments.size() != 8) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'ellipse' on 'CanvasRenderingContext2D': 7 or 8 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+  double radiusX = arguments[2].toNumber();
+  double radiusY = arguments[3].toNumber();
+  double rotation = arguments[4].toNumber();
+  double startAngle = arguments[5].toNumber();
+  double endAngle = arguments[6].toNumber();
+  // An optional Boolean which, if true, draws the ellipse counterclockwise (anticlockwise).
+  // The default value is false (clockwise).
+  // 0 will become false, and 1 for true
+  bool counterclockwise = false;
+  if (arguments.size() == 8) {
+    counterclockwise = arguments[7].toBoolean();
+  }
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->ellipse != nullptr,
+           "Failed to execute ellipse(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->ellipse(instance->nativeCanvasRenderingContext2D, x, y, radiusX, radiusY, rotation, startAngle, endAngle, counterclockwise ? 1 : 0);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::fill(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 0 && arguments.size() != 1)  {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'fill' on 'CanvasRenderingContext2D': 0 or 1 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  std::u16string fillRule;
+  if (arguments.size() == 1) {
+    fillRule = arguments[0].toU16String();
+  }
+  NativeString fillRuleNativeString{};
+  fillRuleNativeString.string = reinterpret_cast<const uint16_t *>(fillRule.c_str());
+  fillRuleNativeString.length = fillRule.size();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->fill != nullptr,
+           "Failed to execute fill(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->fill(instance->nativeCanvasRenderingContext2D, &fillRuleNativeString);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::translate(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 2) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'translate' on 'CanvasRenderingContext2D': 2 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->translate != nullptr,
+           "Failed to execute translate(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->translate(instance->nativeCanvasRenderingContext2D, x, y);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::fillRect(ScriptContext *context, const ScriptValue &thisObject,
+                                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 4) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'fillRect' on 'CanvasRenderingContext2D': 4 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+  double width = arguments[2].toNumber();
+  double height = arguments[3].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->fillRect != nullptr,
+           "Failed to execute fillRect(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->fillRect(instance->nativeCanvasRenderingContext2D, x, y, width, height);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::rect(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 4) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'rect' on 'CanvasRenderingContext2D': 4 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+  double width = arguments[2].toNumber();
+  double height = arguments[3].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->rect != nullptr,
+           "Failed to execute rect(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->rect(instance->nativeCanvasRenderingContext2D, x, y, width, height);
+  return ScriptValue();
+}
+
+// https://developer.mozilla.org/en-US/docs/Web/API/CanvasRenderingContext2D/rotate
+ScriptValue CanvasRenderingContext2D::rotate(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'rotate' on 'CanvasRenderingContext2D': 1 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double angle = arguments[0].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->rotate != nullptr,
+           "Failed to execute rotate(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->rotate(instance->nativeCanvasRenderingContext2D, angle);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::clearRect(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 4) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'clearRect' on 'CanvasRenderingContext2D': 4 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+  double width = arguments[2].toNumber();
+  double height = arguments[3].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->clearRect != nullptr,
+           "Failed to execute clearRect(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->clearRect(instance->nativeCanvasRenderingContext2D, x, y, width, height);
+
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::strokeRect(ScriptContext *context, const ScriptValue &thisObject,
+                                                 const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 4) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'strokeRect' on 'CanvasRenderingContext2D': 4 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+  double width = arguments[2].toNumber();
+  double height = arguments[3].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->strokeRect != nullptr,
+           "Failed to execute strokeRect(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->strokeRect(instance->nativeCanvasRenderingContext2D, x, y, width, height);
+
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::fillText(ScriptContext *context, const ScriptValue &thisObject,
+                                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 3 && arguments.size() != 4) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'fillText' on 'CanvasRenderingContext2D': 3 or 4 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  std::u16string textString = arguments[0].toU16String();
+  NativeString text{};
+  text.string = reinterpret_cast<const uint16_t *>(textString.c_str());
+  text.length = textString.size();
+
+  double x = arguments[1].toNumber();
+  double y = arguments[2].toNumber();
+  double maxWidth = NAN;
+
+  if (arguments.size() == 4) {
+    maxWidth = arguments[3].toNumber();
+  }
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->fillText != nullptr,
+           "Failed to execute fillText(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->fillText(instance->nativeCanvasRenderingContext2D, &text, x, y, maxWidth);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::lineTo(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 2) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'lineTo' on 'CanvasRenderingContext2D': 2 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->lineTo != nullptr,
+           "Failed to execute lineTo(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->lineTo(instance->nativeCanvasRenderingContext2D, x, y);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::moveTo(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 2) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'moveTo' on 'CanvasRenderingContext2D': 2 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->moveTo != nullptr,
+           "Failed to execute moveTo(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->moveTo(instance->nativeCanvasRenderingContext2D, x, y);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::quadraticCurveTo(ScriptContext *context, const ScriptValue &thisObject,
+                                                       const ScriptArguments &arguments, void *data,
+                                                       ScriptValue *exception) {
+  if (arguments.size() != 4) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'quadraticCurveTo' on 'CanvasRenderingContext2D': 4 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double cpx = arguments[0].toNumber();
+  double cpy = arguments[1].toNumber();
+  double x = arguments[2].toNumber();
+  double y = arguments[3].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->quadraticCurveTo != nullptr,
+           "Failed to execute quadraticCurveTo(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->quadraticCurveTo(instance->nativeCanvasRenderingContext2D, cpx, cpy, x, y);
+
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::strokeText(ScriptContext *context, const ScriptValue &thisObject,
+                                                 const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() < 3) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'strokeText' on 'CanvasRenderingContext2D': 3 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  std::u16string textString = arguments[0].toU16String();
+  NativeString text{};
+  text.string = reinterpret_cast<const uint16_t *>(textString.c_str());
+  text.length = textString.size();
+
+  double x = arguments[1].toNumber();
+  double y = arguments[2].toNumber();
+  double maxWidth = NAN; // optional value
+
+  if (arguments.size() == 4) {
+    maxWidth = arguments[3].toNumber();
+  }
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->strokeText != nullptr,
+           "Failed to execute strokeText(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->strokeText(instance->nativeCanvasRenderingContext2D, &text, x, y, maxWidth);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::save(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->save != nullptr,
+           "Failed to execute save(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->save(instance->nativeCanvasRenderingContext2D);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::stroke(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->stroke != nullptr,
+           "Failed to execute stroke(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->stroke(instance->nativeCanvasRenderingContext2D);
+  return ScriptValue();
+}
+
+// https://developer.mozilla.org/en-US/docs/Web/API/CanvasRenderingContext2D/scale
+ScriptValue CanvasRenderingContext2D::scale(ScriptContext *context, const ScriptValue &thisObject,
+                                            const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 2) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'scale' on 'CanvasRenderingContext2D': 2 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double x = arguments[0].toNumber();
+  double y = arguments[1].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->scale != nullptr,
+           "Failed to execute scale(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->scale(instance->nativeCanvasRenderingContext2D, x, y);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::restore(ScriptContext *context, const ScriptValue &thisObject,
+                                              const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->restore != nullptr,
+           "Failed to execute restore(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->restore(instance->nativeCanvasRenderingContext2D);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::resetTransform(ScriptContext *context, const ScriptValue &thisObject,
+                                                     const ScriptArguments &arguments, void *data,
+                                                     ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->resetTransform != nullptr,
+           "Failed to execute resetTransform(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->resetTransform(instance->nativeCanvasRenderingContext2D);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::setTransform(ScriptContext *context, const ScriptValue &thisObject,
+                                                   const ScriptArguments &arguments, void *data,
+                                                   ScriptValue *exception) {
+  if (arguments.size() != 6) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'setTransform' on 'CanvasRenderingContext2D': 6 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double a = arguments[0].toNumber();
+  double b = arguments[1].toNumber();
+  double c = arguments[2].toNumber();
+  double d = arguments[3].toNumber();
+  double e = arguments[4].toNumber();
+  double f = arguments[5].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->setTransform != nullptr,
+           "Failed to execute setTransform(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->setTransform(instance->nativeCanvasRenderingContext2D, a, b, c, d, e, f);
+  return ScriptValue();
+}
+
+ScriptValue CanvasRenderingContext2D::transform(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 6) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'transform' on 'CanvasRenderingContext2D': 6 arguments required, but " +
+                 std::to_string(arguments.size()) + " present.");
+    return ScriptValue();
+  }
+
+  double a = arguments[0].toNumber();
+  double b = arguments[1].toNumber();
+  double c = arguments[2].toNumber();
+  double d = arguments[3].toNumber();
+  double e = arguments[4].toNumber();
+  double f = arguments[5].toNumber();
+
+  auto instance = HostClass::instanceOf<CanvasRenderingContext2D::CanvasRenderingContext2DInstance>(
+    thisObject, static_cast<CanvasRenderingContext2D *>(data));
+  if (instance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(instance->nativeCanvasRenderingContext2D->transform != nullptr,
+           "Failed to execute transform(): dart method is nullptr.");
+  instance->nativeCanvasRenderingContext2D->transform(instance->nativeCanvasRenderingContext2D, a, b, c, d, e, f);
+  return ScriptValue();
+}
+
+void CanvasRenderingContext2D::CanvasRenderingContext2DInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getCanvasRenderingContext2DPropertyNames()) {
+    names.emplace_back(property);
+  }
+  for (auto &property : getCanvasRenderingContext2DPrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
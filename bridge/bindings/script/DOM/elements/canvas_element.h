@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_CANVAS_ELEMENT_H
+#define KRAKENBRIDGE_SCRIPT_CANVAS_ELEMENT_H
+
+#include "bindings/script/DOM/element.h"
+
+namespace kraken::binding {
+
+struct NativeCanvasRenderingContext2D;
+struct NativeCanvasElement;
+
+using GetContext = NativeCanvasRenderingContext2D *(*)(NativeCanvasElement *nativeCanvasElement,
+                                                       NativeString *contextId);
+
+struct NativeCanvasElement {
+  NativeCanvasElement() = delete;
+  NativeCanvasElement(NativeElement *nativeElement) : nativeElement(nativeElement){};
+
+  NativeElement *nativeElement;
+
+  GetContext getContext{nullptr};
+};
+
+class JSCanvasElement : public JSElement {
+public:
+  static std::unordered_map<ScriptContext *, JSCanvasElement *> instanceMap;
+  OBJECT_INSTANCE(JSCanvasElement)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class CanvasElementInstance : public ElementInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(CanvasElement, 2, width, height);
+    DEFINE_PROTOTYPE_OBJECT_PROPERTY(CanvasElement, 1, getContext);
+
+    CanvasElementInstance() = delete;
+    explicit CanvasElementInstance(JSCanvasElement *jsCanvasElement);
+    ~CanvasElementInstance() override;
+
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    NativeCanvasElement *nativeCanvasElement;
+
+  private:
+    double _width{300};
+    double _height{150};
+  };
+
+private:
+  JSCanvasElement() = delete;
+  ~JSCanvasElement() override;
+  explicit JSCanvasElement(ScriptContext *context);
+
+  static ScriptValue getContext(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                                void *data, ScriptValue *exception);
+  FunctionHolder m_getContext{context, prototypeObject, this, "getContext", getContext};
+};
+
+using SetProperty = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, NativeString *value);
+using Arc = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y,
+                    double radius, double startAngle, double endAngle, double counterclockwise);
+using ArcTo = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x1, double y1,
+                      double x2, double y2, double radius);
+using BeginPath = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D);
+using BezierCurveTo = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x1, double y1,
+                              double x2, double y2, double x, double y);
+using ClearRect = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y,
+                           double width, double height);
+using Clip = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, NativeString *fillRule);
+using ClosePath = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D);
+using Ellipse = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y,
+                        double radiusX, double radiusY, double rotation, double startAngle, double endAngle, double counterclockwise);
+using Fill = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, NativeString *fillRule);
+using FillRect = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y,
+                          double width, double height);
+using FillText = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, NativeString *text, double x,
+                          double y, double maxWidth);
+using LineTo = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y);
+using MoveTo = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y);
+using QuadraticCurveTo = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double cpx, double cpy,
+                           double x, double y);
+using Rect = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y,
+                           double width, double height);
+using Rotate = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double angle);
+using Restore = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D);
+using ResetTransform = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderinContext2D);
+using Save = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D);
+using Scale = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y);
+using Stroke = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D);
+using StrokeRect = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y,
+                            double width, double height);
+using StrokeText = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, NativeString *text,
+                            double x, double y, double maxWidth);
+using SetTransform = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double a, double b, double c, double d, double e, double f);
+using Transform = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double a, double b, double c, double d, double e, double f);
+using Translate = void (*)(NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D, double x, double y);
+
+// Function pointer's order must be as same as the NativeCanvasRenderingContext2D class of dart side.
+struct NativeCanvasRenderingContext2D {
+  SetProperty setDirection{nullptr};
+  SetProperty setFont{nullptr};
+  SetProperty setFillStyle{nullptr};
+  SetProperty setStrokeStyle{nullptr};
+  SetProperty setLineCap{nullptr};
+  SetProperty setLineDashOffset{nullptr};
+  SetProperty setLineJoin{nullptr};
+  SetProperty setLineWidth{nullptr};
+  SetProperty setMiterLimit{nullptr};
+  SetProperty setTextAlign{nullptr};
+  SetProperty setTextBaseline{nullptr};
+  Arc arc{nullptr};
+  ArcTo arcTo{nullptr};
+  BeginPath beginPath{nullptr};
+  BezierCurveTo bezierCurveTo{nullptr};
+  ClearRect clearRect{nullptr};
+  Clip clip{nullptr};
+  ClosePath closePath{nullptr};
+  Ellipse ellipse{nullptr};
+  Fill fill{nullptr};
+  FillRect fillRect{nullptr};
+  FillText fillText{nullptr};
+  LineTo lineTo{nullptr};
+  MoveTo moveTo{nullptr};
+  QuadraticCurveTo quadraticCurveTo{nullptr};
+  Rect rect{nullptr};
+  Restore restore{nullptr};
+  Rotate rotate{nullptr};
+  ResetTransform resetTransform{nullptr};
+  Save save{nullptr};
+  Scale scale{nullptr};
+  Stroke stroke{nullptr};
+  StrokeRect strokeRect{nullptr};
+  StrokeText strokeText{nullptr};
+  SetTransform setTransform{nullptr};
+  Transform transform{nullptr};
+  Translate translate{nullptr};
+};
+
+class CanvasRenderingContext2D : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, CanvasRenderingContext2D *> instanceMap;
+  OBJECT_INSTANCE(CanvasRenderingContext2D)
+  // 2D
+  static ScriptValue arc(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                         void *data, ScriptValue *exception);
+  static ScriptValue arcTo(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue beginPath(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception);
+  static ScriptValue bezierCurveTo(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue closePath(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception);
+  static ScriptValue clip(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue clearRect(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception);
+  static ScriptValue ellipse(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+  static ScriptValue fill(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue fillText(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception);
+  static ScriptValue fillRect(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception);
+  static ScriptValue lineTo(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue moveTo(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue quadraticCurveTo(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue restore(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+  static ScriptValue rotate(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue rect(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue resetTransform(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue stroke(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue strokeText(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                                void *data, ScriptValue *exception);
+  static ScriptValue strokeRect(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                                void *data, ScriptValue *exception);
+  static ScriptValue save(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue scale(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue setTransform(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue transform(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception);
+  static ScriptValue translate(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception);
+
+  class CanvasRenderingContext2DInstance : public Instance {
+  public:
+    DEFINE_OBJECT_PROPERTY(CanvasRenderingContext2D, 11,
+                          direction, font, fillStyle, strokeStyle, lineCap,
+                          lineDashOffset, lineJoin, lineWidth, miterLimit, textAlign,
+                          textBaseline);
+    DEFINE_PROTOTYPE_OBJECT_PROPERTY(CanvasRenderingContext2D, 26,
+                                    arc, arcTo, beginPath, bezierCurveTo, clearRect,
+                                    closePath, clip, ellipse, fill, fillRect,
+                                    fillText, lineTo, moveTo, rect, restore, 
+                                    resetTransform, rotate, quadraticCurveTo, stroke, strokeRect,
+                                    save, scale, strokeText, setTransform, transform,
+                                    translate);
+
+    CanvasRenderingContext2DInstance() = delete;
+    explicit CanvasRenderingContext2DInstance(CanvasRenderingContext2D *canvasRenderContext2D,
+                                              NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D);
+    ~CanvasRenderingContext2DInstance() override;
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    NativeCanvasRenderingContext2D *nativeCanvasRenderingContext2D;
+
+  private:
+    std::u16string m_direction;
+    std::u16string m_font;
+    std::u16string m_fillStyle;
+    std::u16string m_lineCap;
+    std::u16string m_lineDashOffset;
+    std::u16string m_lineJoin;
+    std::u16string m_lineWidth;
+    std::u16string m_miterLimit;
+    std::u16string m_strokeStyle;
+    std::u16string m_textAlign;
+    std::u16string m_textBaseline;
+  };
+
+protected:
+  CanvasRenderingContext2D() = delete;
+  explicit CanvasRenderingContext2D(ScriptContext *context);
+  ~CanvasRenderingContext2D() override;
+
+  FunctionHolder m_arc{context, prototypeObject, this, "arc", arc};
+  FunctionHolder m_arcTo{context, prototypeObject, this, "arcTo", arcTo};
+  FunctionHolder m_beginPath{context, prototypeObject, this, "beginPath", beginPath};
+  FunctionHolder m_bezierCurveTo{context, prototypeObject, this, "bezierCurveTo", bezierCurveTo};
+  FunctionHolder m_closePath{context, prototypeObject, this, "closePath", closePath};
+  FunctionHolder m_clearRect{context, prototypeObject, this, "clearRect", clearRect};
+  FunctionHolder m_clip{context, prototypeObject, this, "clip", clip};
+  FunctionHolder m_ellipse{context, prototypeObject, this, "ellipse", ellipse};
+  FunctionHolder m_fill{context, prototypeObject, this, "fill", fill};
+  FunctionHolder m_fillText{context, prototypeObject, this, "fillText", fillText};
+  FunctionHolder m_fillRect{context, prototypeObject, this, "fillRect", fillRect};
+  FunctionHolder m_lineTo{context, prototypeObject, this, "lineTo", lineTo};
+  FunctionHolder m_moveTo{context, prototypeObject, this, "moveTo", moveTo};
+  FunctionHolder m_quadraticCurveTo{context, prototypeObject, this, "quadraticCurveTo", quadraticCurveTo};
+  FunctionHolder m_rect{context, prototypeObject, this, "rect", rect};
+  FunctionHolder m_rotate{context, prototypeObject, this, "rotate", rotate};
+  FunctionHolder m_restore{context, prototypeObject, this, "restore", restore};
+  FunctionHolder m_resetTransform{context, prototypeObject, this, "resetTransform", resetTransform};
+  FunctionHolder m_save{context, prototypeObject, this, "save", save};
+  FunctionHolder m_scale{context, prototypeObject, this, "scale", scale};
+  FunctionHolder m_stroke{context, prototypeObject, this, "stroke", stroke};
+  FunctionHolder m_strokeRect{context, prototypeObject, this, "strokeRect", strokeRect};
+  FunctionHolder m_strokeText{context, prototypeObject, this, "strokeText", strokeText};
+  FunctionHolder m_setTransform{context, prototypeObject, this, "setTransform", setTransform};
+  FunctionHolder m_transform{context, prototypeObject, this, "transform", transform};
+  FunctionHolder m_translate{context, prototypeObject, this, "translate", translate};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_CANVAS_ELEMENT_H
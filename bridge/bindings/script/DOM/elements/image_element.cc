@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "image_element.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+
+namespace kraken::binding {
+
+void bindImageElement(ScriptContext *context) {
+  auto ImageElement = JSImageElement::instance(context);
+  bindGlobalValue(context, "Image", ImageElement->classObject);
+  bindGlobalValue(context, "HTMLImageElement", ImageElement->classObject);
+}
+
+std::unordered_map<ScriptContext *, JSImageElement *> JSImageElement::instanceMap{};
+
+JSImageElement::~JSImageElement() {
+  instanceMap.erase(context);
+}
+
+JSImageElement::JSImageElement(ScriptContext *context) : JSElement(context, "HTMLImageElement") {}
+
+ScriptValue JSImageElement::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new ImageElementInstance(this);
+  return instance->value();
+}
+
+JSImageElement::ImageElementInstance::ImageElementInstance(JSImageElement *jsAnchorElement)
+  : ElementInstance(jsAnchorElement, "img", false), nativeImageElement(new NativeImageElement(nativeElement)) {
+  std::string tagName = "img";
+  NativeString args_01{};
+  buildUICommandArgs(tagName, args_01);
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createElement, args_01, nativeImageElement);
+}
+
+ScriptValue JSImageElement::ImageElementInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getImageElementPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case ImageElementProperty::width: {
+      getDartMethod()->flushUICommand();
+      return ScriptValue::makeNumber(context, nativeImageElement->getImageWidth(nativeImageElement));
+    }
+    case ImageElementProperty::height: {
+      getDartMethod()->flushUICommand();
+      return ScriptValue::makeNumber(context, nativeImageElement->getImageHeight(nativeImageElement));
+    }
+    case ImageElementProperty::naturalWidth: {
+      getDartMethod()->flushUICommand();
+      return ScriptValue::makeNumber(context, nativeImageElement->getImageNaturalWidth(nativeImageElement));
+    }
+    case ImageElementProperty::naturalHeight: {
+      getDartMethod()->flushUICommand();
+      return ScriptValue::makeNumber(context, nativeImageElement->getImageNaturalHeight(nativeImageElement));
+    }
+    case ImageElementProperty::src: {
+      return ScriptValue::makeString(context, m_src);
+    }
+    case ImageElementProperty::loading: {
+      return ScriptValue::makeString(context, m_loading);
+    }
+    }
+  }
+
+  return ElementInstance::getProperty(name, exception);
+}
+
+bool JSImageElement::ImageElementInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                       ScriptValue *exception) {
+  auto &propertyMap = getImageElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case ImageElementProperty::width:
+    case ImageElementProperty::height: {
+      std::u16string string = value.toU16String();
+      NativeString args_01{};
+      NativeString args_02{};
+      buildUICommandArgs(name, string, args_01, args_02);
+      context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+      break;
+    }
+    case ImageElementProperty::src: {
+      m_src = value.toU16String();
+      NativeString args_01{};
+      NativeString args_02{};
+      buildUICommandArgs(name, m_src, args_01, args_02);
+      context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+      break;
+    }
+    case ImageElementProperty::loading: {
+      m_loading = value.toU16String();
+      NativeString args_01{};
+      NativeString args_02{};
+      buildUICommandArgs(name, m_loading, args_01, args_02);
+      context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+      break;
+    }
+    default:
+      break;
+    }
+    return true;
+  } else {
+    return ElementInstance::setProperty(name, value, exception);
+  }
+}
+
+void JSImageElement::ImageElementInstance::getPropertyNames(std::vector<std::string> &names) {
+  ElementInstance::getPropertyNames(names);
+
+  for (auto &property : getImageElementPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+JSImageElement::ImageElementInstance::~ImageElementInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeImageElement *>(ptr); }, nativeImageElement);
+}
+
+} // namespace kraken::binding
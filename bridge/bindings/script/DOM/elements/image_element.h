@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_IMAGE_ELEMENT_H
+#define KRAKENBRIDGE_SCRIPT_IMAGE_ELEMENT_H
+
+#include "bindings/script/DOM/element.h"
+
+namespace kraken::binding {
+
+struct NativeImageElement;
+
+void bindImageElement(ScriptContext *context);
+
+class JSImageElement : public JSElement {
+public:
+  static std::unordered_map<ScriptContext *, JSImageElement *> instanceMap;
+  OBJECT_INSTANCE(JSImageElement)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class ImageElementInstance : public ElementInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(ImageElement, 6, width, height, naturalWidth, naturalHeight, src, loading)
+
+    ImageElementInstance() = delete;
+    ~ImageElementInstance() override;
+    explicit ImageElementInstance(JSImageElement *JSImageElement);
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    NativeImageElement *nativeImageElement;
+
+  private:
+    std::u16string m_src;
+    std::u16string m_loading;
+  };
+
+protected:
+  JSImageElement() = delete;
+  explicit JSImageElement(ScriptContext *context);
+  ~JSImageElement() override;
+};
+
+using GetImageWidth = double (*)(NativeImageElement *nativeImageElement);
+using GetImageHeight = double (*)(NativeImageElement *nativeImageElement);
+using GetImageNaturalWidth = double (*)(NativeImageElement *nativeImageElement);
+using GetImageNaturalHeight = double (*)(NativeImageElement *nativeImageElement);
+
+struct NativeImageElement {
+  NativeImageElement() = delete;
+  explicit NativeImageElement(NativeElement *nativeElement) : nativeElement(nativeElement){};
+
+  NativeElement *nativeElement;
+
+  GetImageWidth getImageWidth;
+  GetImageHeight getImageHeight;
+  GetImageNaturalWidth getImageNaturalWidth;
+  GetImageNaturalHeight getImageNaturalHeight;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_IMAGE_ELEMENT_H
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "input_element.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+
+namespace kraken::binding {
+
+void bindInputElement(ScriptContext *context) {
+  auto InputElement = JSInputElement::instance(context);
+  bindGlobalValue(context, "HTMLInputElement", InputElement->classObject);
+}
+
+std::unordered_map<ScriptContext *, JSInputElement *> JSInputElement::instanceMap{};
+
+JSInputElement::~JSInputElement() {
+  instanceMap.erase(context);
+}
+
+JSInputElement::JSInputElement(ScriptContext *context) : JSElement(context, "HTMLInputElement") {}
+
+ScriptValue JSInputElement::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new InputElementInstance(this);
+  return instance->value();
+}
+
+ScriptValue JSInputElement::focus(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance =
+    HostClass::instanceOf<JSInputElement::InputElementInstance>(thisObject, static_cast<JSInputElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeInputElement->focus != nullptr, "Failed to call dart method: focus() is nullptr");
+  elementInstance->nativeInputElement->focus(elementInstance->nativeInputElement);
+  return ScriptValue();
+}
+
+ScriptValue JSInputElement::blur(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance =
+    HostClass::instanceOf<JSInputElement::InputElementInstance>(thisObject, static_cast<JSInputElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeInputElement->blur != nullptr, "Failed to call dart method: blur() is nullptr");
+  elementInstance->nativeInputElement->blur(elementInstance->nativeInputElement);
+  return ScriptValue();
+}
+
+JSInputElement::InputElementInstance::InputElementInstance(JSInputElement *jsAnchorElement)
+  : ElementInstance(jsAnchorElement, "input", false), nativeInputElement(new NativeInputElement(nativeElement)) {
+  std::string tagName = "input";
+  NativeString args_01{};
+  buildUICommandArgs(tagName, args_01);
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createElement, args_01, nativeInputElement);
+}
+
+ScriptValue JSInputElement::InputElementInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getInputElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    getDartMethod()->flushUICommand();
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case InputElementProperty::width: {
+      return ScriptValue::makeNumber(context, nativeInputElement->getInputWidth(nativeInputElement));
+    }
+    case InputElementProperty::height: {
+      return ScriptValue::makeNumber(context, nativeInputElement->getInputHeight(nativeInputElement));
+    }
+    default: {
+      return ElementInstance::getStringValueProperty(name);
+    }
+    }
+  }
+
+  return ElementInstance::getProperty(name, exception);
+}
+
+bool JSInputElement::InputElementInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                       ScriptValue *exception) {
+  auto &propertyMap = getInputElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    std::u16string string = value.toU16String();
+    NativeString args_01{};
+    NativeString args_02{};
+    buildUICommandArgs(name, string, args_01, args_02);
+    context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+    return true;
+  } else {
+    return ElementInstance::setProperty(name, value, exception);
+  }
+}
+
+void JSInputElement::InputElementInstance::getPropertyNames(std::vector<std::string> &names) {
+  ElementInstance::getPropertyNames(names);
+
+  for (auto &property : getInputElementPropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : getInputElementPrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+JSInputElement::InputElementInstance::~InputElementInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeInputElement *>(ptr); }, nativeInputElement);
+}
+
+} // namespace kraken::binding
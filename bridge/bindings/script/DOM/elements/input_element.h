@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_INPUT_ELEMENT_H
+#define KRAKENBRIDGE_SCRIPT_INPUT_ELEMENT_H
+
+#include "bindings/script/DOM/element.h"
+
+namespace kraken::binding {
+
+struct NativeInputElement;
+
+void bindInputElement(ScriptContext *context);
+
+class JSInputElement : public JSElement {
+public:
+  static std::unordered_map<ScriptContext *, JSInputElement *> instanceMap;
+  OBJECT_INSTANCE(JSInputElement)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  static ScriptValue focus(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue blur(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+
+  class InputElementInstance : public ElementInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(InputElement, 21, width, height, value, accept, autocomplete, autofocus, checked, disabled,
+                           min, max, minlength, maxlength, size, multiple, name, step, pattern, required, readonly,
+                           placeholder, type);
+
+    DEFINE_PROTOTYPE_OBJECT_PROPERTY(InputElement, 2, focus, blur);
+
+    InputElementInstance() = delete;
+    ~InputElementInstance() override;
+    explicit InputElementInstance(JSInputElement *JSInputElement);
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    NativeInputElement *nativeInputElement;
+  };
+
+protected:
+  JSInputElement() = delete;
+  explicit JSInputElement(ScriptContext *context);
+  ~JSInputElement() override;
+
+  FunctionHolder m_focus{context, prototypeObject, this, "focus", focus};
+  FunctionHolder m_blur{context, prototypeObject, this, "blur", blur};
+};
+
+using GetInputWidth = double (*)(NativeInputElement *nativeInputElement);
+using GetInputHeight = double (*)(NativeInputElement *nativeInputElement);
+using InputVoidCallback = void (*)(NativeInputElement *nativeInputElement);
+
+struct NativeInputElement {
+  NativeInputElement() = delete;
+  explicit NativeInputElement(NativeElement *nativeElement) : nativeElement(nativeElement){};
+
+  NativeElement *nativeElement;
+
+  GetInputWidth getInputWidth;
+  GetInputHeight getInputHeight;
+  InputVoidCallback focus;
+  InputVoidCallback blur;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_INPUT_ELEMENT_H
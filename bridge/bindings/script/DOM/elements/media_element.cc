@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "media_element.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+
+namespace kraken::binding {
+
+std::unordered_map<ScriptContext *, JSMediaElement *> JSMediaElement::instanceMap{};
+
+JSMediaElement::~JSMediaElement() {
+  instanceMap.erase(context);
+}
+
+JSMediaElement::JSMediaElement(ScriptContext *context) : JSElement(context, "HTMLMediaElement") {}
+
+JSMediaElement::MediaElementInstance::MediaElementInstance(JSMediaElement *jsMediaElement, const char *tagName)
+  : ElementInstance(jsMediaElement, tagName, false), nativeMediaElement(new NativeMediaElement(nativeElement)) {}
+
+JSMediaElement::MediaElementInstance::~MediaElementInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeMediaElement *>(ptr); }, nativeMediaElement);
+}
+
+ScriptValue JSMediaElement::play(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance =
+    HostClass::instanceOf<JSMediaElement::MediaElementInstance>(thisObject, static_cast<JSMediaElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeMediaElement->play != nullptr, "Failed to execute play(): dart method is nullptr.");
+  elementInstance->nativeMediaElement->play(elementInstance->nativeMediaElement);
+  return ScriptValue();
+}
+
+ScriptValue JSMediaElement::pause(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance =
+    HostClass::instanceOf<JSMediaElement::MediaElementInstance>(thisObject, static_cast<JSMediaElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeMediaElement->pause != nullptr,
+           "Failed to execute pause(): dart method is nullptr.");
+  elementInstance->nativeMediaElement->pause(elementInstance->nativeMediaElement);
+  return ScriptValue();
+}
+
+ScriptValue JSMediaElement::fastSeek(ScriptContext *context, const ScriptValue &thisObject,
+                                     const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto elementInstance =
+    HostClass::instanceOf<JSMediaElement::MediaElementInstance>(thisObject, static_cast<JSMediaElement *>(data));
+  if (elementInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute fastSeek() on MediaElement: 1 arguments is required but got 0.");
+    return ScriptValue();
+  }
+
+  if (!arguments[0].isNumber()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute fastSeek() on MediaElement: duration must be an number.");
+    return ScriptValue();
+  }
+
+  double duration = arguments[0].toNumber();
+
+  getDartMethod()->flushUICommand();
+  assert_m(elementInstance->nativeMediaElement->fastSeek != nullptr,
+           "Failed to execute fastSeek(): dart method is nullptr.");
+  elementInstance->nativeMediaElement->fastSeek(elementInstance->nativeMediaElement, duration);
+  return ScriptValue();
+}
+
+ScriptValue JSMediaElement::MediaElementInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getMediaElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+    switch (property) {
+    case MediaElementProperty::currentSrc:
+    case MediaElementProperty::src:
+      return ScriptValue::makeString(context, _src);
+    case MediaElementProperty::autoPlay:
+      return ScriptValue::makeBoolean(context, _autoPlay);
+    case MediaElementProperty::loop:
+      return ScriptValue::makeBoolean(context, _loop);
+    }
+  }
+
+  return ElementInstance::getProperty(name, exception);
+}
+
+bool JSMediaElement::MediaElementInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                       ScriptValue *exception) {
+  auto &propertyMap = getMediaElementPropertyMap();
+
+  if (propertyMap.count(name) > 0 && propertyMap[name] == MediaElementProperty::src) {
+    _src = value.toU16String();
+    NativeString args_01{};
+    NativeString args_02{};
+    buildUICommandArgs(name, _src, args_01, args_02);
+    context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+    return true;
+  }
+
+  return ElementInstance::setProperty(name, value, exception);
+}
+
+void JSMediaElement::MediaElementInstance::getPropertyNames(std::vector<std::string> &names) {
+  ElementInstance::getPropertyNames(names);
+
+  for (auto &property : getMediaElementPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_MEDIA_ELEMENT_H
+#define KRAKENBRIDGE_SCRIPT_MEDIA_ELEMENT_H
+
+#include "bindings/script/DOM/element.h"
+
+namespace kraken::binding {
+
+struct NativeMediaElement;
+using Play = void (*)(NativeMediaElement *mediaElement);
+using Pause = void (*)(NativeMediaElement *mediaElement);
+using FastSeek = void (*)(NativeMediaElement *mediaElement, double duration);
+
+class JSMediaElement : public JSElement {
+public:
+  static std::unordered_map<ScriptContext *, JSMediaElement *> instanceMap;
+  OBJECT_INSTANCE(JSMediaElement)
+
+  class MediaElementInstance : public ElementInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(MediaElement, 4, src, autoPlay, loop, currentSrc);
+    DEFINE_PROTOTYPE_OBJECT_PROPERTY(MediaElement, 3, play, pause, fastSeek);
+
+    MediaElementInstance() = delete;
+    explicit MediaElementInstance(JSMediaElement *jsMediaElement, const char *tagName);
+    ~MediaElementInstance() override;
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    NativeMediaElement *nativeMediaElement;
+
+  private:
+    std::u16string _src;
+    bool _autoPlay{false};
+    bool _loop{false};
+  };
+
+protected:
+  JSMediaElement() = delete;
+  ~JSMediaElement() override;
+  explicit JSMediaElement(ScriptContext *context);
+
+  static ScriptValue play(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue pause(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue fastSeek(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception);
+
+  FunctionHolder m_play{context, prototypeObject, this, "play", play};
+  FunctionHolder m_pause{context, prototypeObject, this, "pause", pause};
+  FunctionHolder m_fastSeek{context, prototypeObject, this, "fastSeek", fastSeek};
+};
+
+struct NativeMediaElement {
+  NativeMediaElement() = delete;
+  NativeMediaElement(NativeElement *nativeElement) : nativeElement(nativeElement){};
+
+  NativeElement *nativeElement;
+
+  Play play;
+  Pause pause;
+  FastSeek fastSeek;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_MEDIA_ELEMENT_H
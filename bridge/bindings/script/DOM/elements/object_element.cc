@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "object_element.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+
+namespace kraken::binding {
+
+std::unordered_map<ScriptContext *, JSObjectElement *> JSObjectElement::instanceMap{};
+
+JSObjectElement::~JSObjectElement() {
+  instanceMap.erase(context);
+}
+
+JSObjectElement::JSObjectElement(ScriptContext *context) : JSElement(context, "HTMLObjectElement") {}
+
+ScriptValue JSObjectElement::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new ObjectElementInstance(this);
+  return instance->value();
+}
+
+JSObjectElement::ObjectElementInstance::ObjectElementInstance(JSObjectElement *jsAnchorElement)
+  : ElementInstance(jsAnchorElement, "object", false), nativeObjectElement(new NativeObjectElement(nativeElement)) {
+  std::string tagName = "object";
+  NativeString args_01{};
+  buildUICommandArgs(tagName, args_01);
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createElement, args_01, nativeObjectElement);
+}
+
+ScriptValue JSObjectElement::ObjectElementInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getObjectElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case ObjectElementProperty::type:
+    case ObjectElementProperty::currentType: {
+      return ScriptValue::makeString(context, m_type);
+    }
+    case ObjectElementProperty::data:
+    case ObjectElementProperty::currentData: {
+      return ScriptValue::makeString(context, m_data);
+    }
+    }
+  }
+
+  return ElementInstance::getProperty(name, exception);
+}
+
+bool JSObjectElement::ObjectElementInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                         ScriptValue *exception) {
+  auto &propertyMap = getObjectElementPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case ObjectElementProperty::data: {
+      m_data = value.toU16String();
+      NativeString args_01{};
+      NativeString args_02{};
+      buildUICommandArgs(name, m_data, args_01, args_02);
+      context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+      break;
+    }
+    case ObjectElementProperty::type: {
+      m_type = value.toU16String();
+      NativeString args_01{};
+      NativeString args_02{};
+      buildUICommandArgs(name, m_type, args_01, args_02);
+      context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+      break;
+    }
+    default:
+      break;
+    }
+    return true;
+  } else {
+    return ElementInstance::setProperty(name, value, exception);
+  }
+}
+
+void JSObjectElement::ObjectElementInstance::getPropertyNames(std::vector<std::string> &names) {
+  ElementInstance::getPropertyNames(names);
+
+  for (auto &property : getObjectElementPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+JSObjectElement::ObjectElementInstance::~ObjectElementInstance() {
+  ::foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeObjectElement *>(ptr); }, nativeObjectElement);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_OBJECT_ELEMENT_H
+#define KRAKENBRIDGE_SCRIPT_OBJECT_ELEMENT_H
+
+#include "bindings/script/DOM/element.h"
+
+namespace kraken::binding {
+
+struct NativeObjectElement;
+
+class JSObjectElement : public JSElement {
+public:
+  static std::unordered_map<ScriptContext *, JSObjectElement *> instanceMap;
+  OBJECT_INSTANCE(JSObjectElement)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class ObjectElementInstance : public ElementInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(ObjectElement, 4, type, data, currentData, currentType)
+
+    ObjectElementInstance() = delete;
+    ~ObjectElementInstance() override;
+    explicit ObjectElementInstance(JSObjectElement *JSObjectElement);
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    NativeObjectElement *nativeObjectElement;
+
+  private:
+    std::u16string m_data;
+    std::u16string m_type;
+  };
+
+protected:
+  ~JSObjectElement() override;
+  JSObjectElement() = delete;
+  explicit JSObjectElement(ScriptContext *context);
+};
+
+struct NativeObjectElement {
+  NativeObjectElement() = delete;
+  explicit NativeObjectElement(NativeElement *nativeElement) : nativeElement(nativeElement){};
+
+  NativeElement *nativeElement;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_OBJECT_ELEMENT_H
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "event.h"
+#include "bindings/script/DOM/custom_event.h"
+#include "bindings/script/native_string_utils.h"
+#include "event_target.h"
+#include "foundation/monotonic_clock.h"
+#include <cmath>
+
+namespace kraken::binding {
+
+void bindEvent(ScriptContext *context) {
+  auto event = JSEvent::instance(context);
+  bindGlobalValue(context, "Event", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSEvent *> JSEvent::instanceMap{};
+std::unordered_map<std::string, EventCreator> JSEvent::eventCreatorMap{};
+
+JSEvent::~JSEvent() {
+  instanceMap.erase(context);
+}
+
+JSEvent::JSEvent(ScriptContext *context) : HostClass(context, "Event") {}
+JSEvent::JSEvent(ScriptContext *context, const char *name) : HostClass(context, JSEvent::instance(context), name) {}
+
+ScriptValue JSEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(context, "Failed to construct 'Event': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string eventType = arguments[0].toString();
+  auto event = JSEvent::createEvent(eventType, context);
+
+  return event->value();
+}
+
+ScriptValue JSEvent::initWithNativeEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                         const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 2) {
+    *exception = ScriptValue::makeError(context, "Failed to execute Event.initWithNativeEvent(): invalid arguments.");
+    return ScriptValue();
+  }
+
+  std::string eventType = arguments[0].toString();
+  double address = arguments[1].toNumber();
+  auto nativeEvent = reinterpret_cast<NativeEvent *>(static_cast<int64_t>(address));
+  auto event = JSEvent::buildEventInstance(eventType, context, nativeEvent, false);
+  return event->value();
+}
+
+EventInstance *JSEvent::createEvent(const std::string &eventType, ScriptContext *context) {
+  auto clock = context->getClock();
+  double now = clock->now();
+  auto nativeEvent = new NativeEvent(stringToNativeString(eventType));
+  nativeEvent->timeStamp = std::llround(clock->timeOriginSinceEpoch() + now);
+  auto event = JSEvent::buildEventInstance(eventType, context, nativeEvent, false);
+  // Keep the sub-millisecond precision which is lost by the epoch milliseconds of nativeEvent.
+  event->timeStamp = now;
+  return event;
+}
+
+void JSEvent::defineEvent(std::string eventType, EventCreator creator) {
+  if (eventCreatorMap.count(eventType) > 0) {
+    return;
+  }
+
+  eventCreatorMap[eventType] = creator;
+}
+
+EventInstance::EventInstance(JSEvent *jsEvent, NativeEvent *nativeEvent)
+  : Instance(jsEvent), nativeEvent(nativeEvent) {
+  // Events from dart are stamped with the wall clock in milliseconds since epoch.
+  auto clock = context->getClock();
+  timeStamp = clock->toHighResTime(clock->fromEpochMicroseconds(nativeEvent->timeStamp * 1000));
+}
+
+EventInstance::EventInstance(JSEvent *jsEvent, const std::string &eventType, const ScriptValue &eventInit,
+                             ScriptValue *exception)
+  : Instance(jsEvent) {
+  nativeEvent = new NativeEvent(stringToNativeString(eventType));
+  auto clock = context->getClock();
+  timeStamp = clock->now();
+  nativeEvent->timeStamp = std::llround(clock->timeOriginSinceEpoch() + timeStamp);
+
+  if (eventInit.isObject()) {
+    if (eventInit.hasProperty("bubbles")) {
+      nativeEvent->bubbles = eventInit.getProperty("bubbles", exception).toBoolean() ? 1 : 0;
+    }
+    if (eventInit.hasProperty("cancelable")) {
+      nativeEvent->cancelable = eventInit.getProperty("cancelable", exception).toBoolean() ? 1 : 0;
+    }
+  }
+}
+
+ScriptValue EventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSEvent::getEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return Instance::getProperty(name, exception);
+
+  auto property = propertyMap.at(name);
+  switch (property) {
+  case JSEvent::EventProperty::type:
+    return ScriptValue::makeString(context, nativeStringToU16String(nativeEvent->type));
+  case JSEvent::EventProperty::bubbles:
+    return ScriptValue::makeBoolean(context, nativeEvent->bubbles);
+  case JSEvent::EventProperty::cancelable:
+    return ScriptValue::makeBoolean(context, nativeEvent->cancelable);
+  case JSEvent::EventProperty::timeStamp:
+    return ScriptValue::makeNumber(context, timeStamp);
+  case JSEvent::EventProperty::defaultPrevented:
+    return ScriptValue::makeBoolean(context, _canceledFlag);
+  case JSEvent::EventProperty::target:
+  case JSEvent::EventProperty::srcElement:
+    if (nativeEvent->target != nullptr) {
+      auto instance = reinterpret_cast<EventTargetInstance *>(nativeEvent->target);
+      return instance->value();
+    }
+    return ScriptValue::null(context);
+  case JSEvent::EventProperty::currentTarget:
+    if (nativeEvent->currentTarget != nullptr) {
+      auto instance = reinterpret_cast<EventTargetInstance *>(nativeEvent->currentTarget);
+      return instance->value();
+    }
+    return ScriptValue::null(context);
+  case JSEvent::EventProperty::returnValue:
+    return ScriptValue::makeBoolean(context, !_canceledFlag);
+  case JSEvent::EventProperty::cancelBubble:
+    return ScriptValue::makeBoolean(context, _stopPropagationFlag);
+  }
+  return ScriptValue();
+}
+
+ScriptValue JSEvent::initEvent(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception) {
+  auto eventInstance = HostClass::instanceOf<EventInstance>(thisObject, static_cast<JSEvent *>(data));
+  if (eventInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(context, "Failed to initEvent required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  if (!arguments[0].isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to createElement: type should be a string.");
+    return ScriptValue();
+  }
+
+  eventInstance->nativeEvent->type->free();
+  eventInstance->nativeEvent->type = stringToNativeString(arguments[0].toU16String());
+  eventInstance->nativeEvent->bubbles = arguments[1].toBoolean() ? 1 : 0;
+  eventInstance->nativeEvent->cancelable = arguments[2].toBoolean() ? 1 : 0;
+
+  return ScriptValue();
+}
+
+ScriptValue JSEvent::stopPropagation(ScriptContext *context, const ScriptValue &thisObject,
+                                     const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventInstance = HostClass::instanceOf<EventInstance>(thisObject, static_cast<JSEvent *>(data));
+  if (eventInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  eventInstance->_stopPropagationFlag = true;
+  return ScriptValue();
+}
+
+ScriptValue JSEvent::stopImmediatePropagation(ScriptContext *context, const ScriptValue &thisObject,
+                                              const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventInstance = HostClass::instanceOf<EventInstance>(thisObject, static_cast<JSEvent *>(data));
+  if (eventInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  eventInstance->_stopPropagationFlag = true;
+  eventInstance->_stopImmediatePropagationFlag = true;
+  return ScriptValue();
+}
+
+ScriptValue JSEvent::preventDefault(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventInstance = HostClass::instanceOf<EventInstance>(thisObject, static_cast<JSEvent *>(data));
+  if (eventInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (eventInstance->nativeEvent->cancelable && !eventInstance->_inPassiveListenerFlag) {
+    eventInstance->_canceledFlag = true;
+  }
+  return ScriptValue();
+}
+
+bool EventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSEvent::getEventPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap.at(name);
+
+    if (property == JSEvent::EventProperty::cancelBubble) {
+      if (value.toBoolean()) {
+        _stopPropagationFlag = true;
+      }
+    }
+    return true;
+  } else {
+    return Instance::setProperty(name, value, exception);
+  }
+}
+
+EventInstance::~EventInstance() {
+  nativeEvent->type->free();
+  delete nativeEvent;
+}
+
+void EventInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : JSEvent::getEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : JSEvent::getEventPrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+EventInstance *JSEvent::buildEventInstance(const std::string &eventType, ScriptContext *context, void *nativeEvent,
+                                           bool isCustomEvent) {
+  EventInstance *eventInstance;
+  if (isCustomEvent) {
+    eventInstance = new CustomEventInstance(JSCustomEvent::instance(context),
+                                            reinterpret_cast<NativeCustomEvent *>(nativeEvent));
+  } else if (eventCreatorMap.count(eventType) > 0) {
+    eventInstance = eventCreatorMap[eventType](context, nativeEvent);
+  } else {
+    eventInstance = new EventInstance(JSEvent::instance(context), reinterpret_cast<NativeEvent *>(nativeEvent));
+  }
+
+  return eventInstance;
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_EVENT_H
+
+#include "bindings/script/host_class.h"
+#include <unordered_map>
+
+#define EVENT_CLICK "click"
+#define EVENT_INPUT "input"
+#define EVENT_APPEAR "appear"
+#define EVENT_DISAPPEAR "disappear"
+#define EVENT_COLOR_SCHEME_CHANGE "colorschemechange"
+#define EVENT_ERROR "error"
+#define EVENT_MEDIA_ERROR "mediaerror"
+#define EVENT_TOUCH_START "touchstart"
+#define EVENT_TOUCH_MOVE "touchmove"
+#define EVENT_TOUCH_END "touchend"
+#define EVENT_TOUCH_CANCEL "touchcancel"
+#define EVENT_MESSAGE "message"
+#define EVENT_CLOSE "close"
+#define EVENT_OPEN "open"
+#define EVENT_INTERSECTION_CHANGE "intersectionchange"
+#define EVENT_CANCEL "cancel"
+#define EVENT_FINISH "finish"
+#define EVENT_TRANSITION_RUN "transitionrun"
+#define EVENT_TRANSITION_CANCEL "transitioncancel"
+#define EVENT_TRANSITION_START "transitionstart"
+#define EVENT_TRANSITION_END "transitionend"
+#define EVENT_FOCUS "focus"
+#define EVENT_LOAD "load"
+#define EVENT_UNLOAD "unload"
+#define EVENT_CHANGE "change"
+#define EVENT_CAN_PLAY "canplay"
+#define EVENT_CAN_PLAY_THROUGH "canplaythrough"
+#define EVENT_ENDED "ended"
+#define EVENT_PAUSE "pause"
+#define EVENT_PLAY "play"
+#define EVENT_SEEKED "seeked"
+#define EVENT_SEEKING "seeking"
+#define EVENT_VOLUME_CHANGE "volumechange"
+#define EVENT_SCROLL "scroll"
+#define EVENT_SWIPE "swipe"
+#define EVENT_PAN "pan"
+#define EVENT_LONG_PRESS "longpress"
+#define EVENT_SCALE "scale"
+
+namespace kraken::binding {
+
+void bindEvent(ScriptContext *context);
+
+class EventInstance;
+struct NativeEvent;
+
+using EventCreator = EventInstance *(*)(ScriptContext *context, void *nativeEvent);
+
+class JSEvent : public HostClass {
+public:
+  DEFINE_OBJECT_PROPERTY(Event, 10, type, bubbles, cancelable, timeStamp, defaultPrevented, target, srcElement,
+                         currentTarget, returnValue, cancelBubble)
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(Event, 4, stopImmediatePropagation, stopPropagation, preventDefault, initEvent)
+
+  static std::unordered_map<ScriptContext *, JSEvent *> instanceMap;
+  static std::unordered_map<std::string, EventCreator> eventCreatorMap;
+  OBJECT_INSTANCE(JSEvent)
+  // Create an Event Object from an nativeEvent address which allocated by dart side.
+  static ScriptValue initWithNativeEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                         const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue stopPropagation(ScriptContext *context, const ScriptValue &thisObject,
+                                     const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue initEvent(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception);
+
+  static ScriptValue stopImmediatePropagation(ScriptContext *context, const ScriptValue &thisObject,
+                                              const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue preventDefault(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static EventInstance *buildEventInstance(const std::string &eventType, ScriptContext *context, void *nativeEvent,
+                                           bool isCustomEvent);
+
+  // Create an event from script, stamped with the current time of the context clock.
+  static EventInstance *createEvent(const std::string &eventType, ScriptContext *context);
+
+  static void defineEvent(std::string eventType, EventCreator creator);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSEvent() = delete;
+  // Event classes of subclasses inherit Event.
+  explicit JSEvent(ScriptContext *context, const char *name);
+  explicit JSEvent(ScriptContext *context);
+  ~JSEvent() override;
+
+private:
+  friend EventInstance;
+  FunctionHolder m_initWithNativeEvent{context, classObject, this, "__initWithNativeEvent__", initWithNativeEvent};
+  FunctionHolder m_stopImmediatePropagation{context, prototypeObject, this, "stopImmediatePropagation",
+                                            stopImmediatePropagation};
+  FunctionHolder m_stopPropagation{context, prototypeObject, this, "stopPropagation", stopPropagation};
+  FunctionHolder m_initEvent{context, prototypeObject, this, "initEvent", initEvent};
+  FunctionHolder m_preventDefault{context, prototypeObject, this, "preventDefault", preventDefault};
+};
+
+class EventInstance : public HostClass::Instance {
+public:
+  EventInstance() = delete;
+
+  explicit EventInstance(JSEvent *jsEvent, NativeEvent *nativeEvent);
+  explicit EventInstance(JSEvent *jsEvent, const std::string &eventType, const ScriptValue &eventInit,
+                         ScriptValue *exception);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~EventInstance() override;
+  NativeEvent *nativeEvent;
+  // DOMHighResTimeStamp of the event creation.
+  double timeStamp{0};
+  bool _dispatchFlag{false};
+  bool _canceledFlag{false};
+  bool _initializedFlag{true};
+  bool _stopPropagationFlag{false};
+  bool _stopImmediatePropagationFlag{false};
+  bool _inPassiveListenerFlag{false};
+
+private:
+  friend JSEvent;
+};
+
+struct NativeEvent {
+  NativeEvent() = delete;
+  explicit KRAKEN_EXPORT NativeEvent(NativeString *eventType) : type(eventType){};
+  NativeString *type;
+  int64_t bubbles{0};
+  int64_t cancelable{0};
+  int64_t timeStamp{0};
+  int64_t defaultPrevented{0};
+  // The pointer address of target EventTargetInstance object.
+  void *target{nullptr};
+  // The pointer address of current target EventTargetInstance object.
+  void *currentTarget{nullptr};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_EVENT_H
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+#include "event_target.h"
+#include "bindings/script/native_string_utils.h"
+#include "dart_methods.h"
+#include "event.h"
+#include "foundation/trace_event.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+#include "node.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+static std::atomic<int64_t> globalEventTargetId{0};
+
+void bindEventTarget(ScriptContext *context) {
+  auto eventTarget = JSEventTarget::instance(context);
+  bindGlobalValue(context, "EventTarget", eventTarget->classObject);
+}
+
+std::unordered_map<ScriptContext *, JSEventTarget *> JSEventTarget::instanceMap{};
+
+JSEventTarget *JSEventTarget::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSEventTarget(context);
+  }
+  return instanceMap[context];
+}
+
+JSEventTarget::~JSEventTarget() {
+  instanceMap.erase(context);
+}
+
+JSEventTarget::JSEventTarget(ScriptContext *context, const char *name)
+  : HostClass(context, JSEventTarget::instance(context), name) {}
+JSEventTarget::JSEventTarget(ScriptContext *context, HostClass *parent, const char *name)
+  : HostClass(context, parent, name) {}
+JSEventTarget::JSEventTarget(ScriptContext *context) : HostClass(context, "EventTarget") {}
+
+ScriptValue JSEventTarget::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() == 1) {
+    const ScriptValue jsOnlyEvents = arguments[0];
+
+    if (!jsOnlyEvents.isArray()) {
+      *exception = ScriptValue::makeError(context, "Failed to new Event: jsOnlyEvents is not an array.");
+      return ScriptValue();
+    }
+
+    auto length = static_cast<size_t>(jsOnlyEvents.getProperty("length", exception).toNumber());
+
+    for (size_t i = 0; i < length; i++) {
+      m_jsOnlyEvents.emplace_back(jsOnlyEvents.getIndex(i, exception).toString());
+    }
+  }
+
+  auto eventTarget = new EventTargetInstance(this);
+  return eventTarget->value();
+}
+
+EventTargetInstance::EventTargetInstance(JSEventTarget *eventTarget) : Instance(eventTarget) {
+  eventTargetId = globalEventTargetId;
+  globalEventTargetId++;
+  nativeEventTarget = new NativeEventTarget(this);
+  context->memoryCounters.eventTargetCount++;
+}
+
+EventTargetInstance::EventTargetInstance(JSEventTarget *eventTarget, int64_t id)
+  : Instance(eventTarget), eventTargetId(id) {
+  nativeEventTarget = new NativeEventTarget(this);
+  context->memoryCounters.eventTargetCount++;
+}
+
+EventTargetInstance::~EventTargetInstance() {
+  context->memoryCounters.eventTargetCount--;
+  // Recycle eventTarget object could be triggered by hosting JSContext been released or reference count set to 0.
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::disposeEventTarget, nullptr, false);
+
+  foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeEventTarget *>(ptr); }, nativeEventTarget);
+}
+
+ScriptValue JSEventTarget::addEventListener(ScriptContext *context, const ScriptValue &thisObject,
+                                            const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventTargetInstance =
+    HostClass::instanceOf<EventTargetInstance>(thisObject, static_cast<JSEventTarget *>(data));
+  if (eventTargetInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 2) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to addEventListener: eventName and function parameter are required.");
+    return ScriptValue();
+  }
+
+  const ScriptValue eventNameValue = arguments[0];
+  const ScriptValue callback = arguments[1];
+
+  if (!eventNameValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to addEventListener: eventName should be an string.");
+    return ScriptValue();
+  }
+
+  if (!callback.isFunction()) {
+    *exception = ScriptValue::makeError(context, "Failed to addEventListener: callback should be an function.");
+    return ScriptValue();
+  }
+
+  std::string eventType = eventNameValue.toString();
+
+  // this is an bargain optimize for addEventListener which send `addEvent` message to kraken Dart side only once and
+  // no one can stop element to trigger event from dart side. this can led to significant performance improvement when
+  // using Front-End frameworks such as Rax, or cause some overhead performance issue when some event trigger more
+  // frequently.
+  if (eventTargetInstance->_eventHandlers.count(eventType) == 0 ||
+      eventTargetInstance->eventTargetId == BODY_TARGET_ID) {
+    eventTargetInstance->_eventHandlers[eventType] = std::deque<ScriptValue>();
+    NativeString args_01{};
+    buildUICommandArgs(eventType, args_01);
+
+    auto EventTarget = static_cast<JSEventTarget *>(eventTargetInstance->_hostClass);
+    auto isJsOnlyEvent = std::find(EventTarget->m_jsOnlyEvents.begin(), EventTarget->m_jsOnlyEvents.end(),
+                                   eventType) != EventTarget->m_jsOnlyEvents.end();
+
+    if (!isJsOnlyEvent) {
+      eventTargetInstance->context->getUICommandQueue()->registerCommand(eventTargetInstance->eventTargetId,
+                                                                         UICommand::addEvent, args_01, nullptr);
+    };
+  }
+  std::deque<ScriptValue> &handlers = eventTargetInstance->_eventHandlers[eventType];
+  handlers.emplace_back(callback);
+
+  return ScriptValue();
+}
+
+ScriptValue JSEventTarget::removeEventListener(ScriptContext *context, const ScriptValue &thisObject,
+                                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventTargetInstance =
+    HostClass::instanceOf<EventTargetInstance>(thisObject, static_cast<JSEventTarget *>(data));
+  if (eventTargetInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 2) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to removeEventListener: eventName and function parameter are required.");
+    return ScriptValue();
+  }
+
+  const ScriptValue eventNameValue = arguments[0];
+  const ScriptValue callback = arguments[1];
+
+  if (!eventNameValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to removeEventListener: eventName should be an string.");
+    return ScriptValue();
+  }
+
+  if (!callback.isFunction()) {
+    *exception = ScriptValue::makeError(context, "Failed to removeEventListener: callback should be an function.");
+    return ScriptValue();
+  }
+
+  std::string eventType = eventNameValue.toString();
+
+  if (eventTargetInstance->_eventHandlers.count(eventType) == 0) {
+    return ScriptValue();
+  }
+
+  std::deque<ScriptValue> &handlers = eventTargetInstance->_eventHandlers[eventType];
+
+  for (auto it = handlers.begin(); it != handlers.end();) {
+    if (it->strictEquals(callback)) {
+      it = handlers.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  return ScriptValue();
+}
+
+ScriptValue JSEventTarget::dispatchEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                         const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventTargetInstance =
+    HostClass::instanceOf<EventTargetInstance>(thisObject, static_cast<JSEventTarget *>(data));
+  if (eventTargetInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  auto eventInstance = HostClass::instanceOf<EventInstance>(arguments[0], JSEvent::instance(context));
+  if (arguments.size() != 1 || eventInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Failed to dispatchEvent: first arguments should be an event object");
+    return ScriptValue();
+  }
+
+  TRACE_EVENT("event", "dispatchEvent");
+  return ScriptValue::makeBoolean(context, eventTargetInstance->dispatchEvent(eventInstance));
+}
+
+bool EventTargetInstance::dispatchEvent(EventInstance *event) {
+  std::string eventType = nativeStringToStdString(event->nativeEvent->type);
+
+  if (_eventHandlers.count(eventType) == 0) {
+    return false;
+  }
+
+  event->nativeEvent->target = event->nativeEvent->currentTarget = this;
+
+  // event has been dispatched, then do not dispatch
+  event->_dispatchFlag = true;
+  bool cancelled = internalDispatchEvent(event);
+
+  // Only nodes have parents to bubble to.
+  if (event->nativeEvent->bubbles == 1 && !cancelled && !event->_stopPropagationFlag &&
+      _hostClass->isSubclassOf(JSNode::instance(context))) {
+    auto node = reinterpret_cast<NodeInstance *>(event->nativeEvent->currentTarget);
+    event->nativeEvent->currentTarget = node->parentNode;
+
+    auto parent = reinterpret_cast<NodeInstance *>(event->nativeEvent->currentTarget);
+    if (parent != nullptr) {
+      parent->dispatchEvent(event);
+    }
+  }
+
+  event->_dispatchFlag = false;
+  return event->_canceledFlag;
+}
+
+ScriptValue JSEventTarget::clearListeners(ScriptContext *context, const ScriptValue &thisObject,
+                                          const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventTargetInstance =
+    HostClass::instanceOf<EventTargetInstance>(thisObject, static_cast<JSEventTarget *>(data));
+  if (eventTargetInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  eventTargetInstance->_eventHandlers.clear();
+  return ScriptValue();
+}
+
+ScriptValue EventTargetInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSEventTarget::getEventTargetPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case JSEventTarget::EventTargetProperty::eventTargetId: {
+      return ScriptValue::makeNumber(context, eventTargetId);
+    }
+    }
+  } else if (name.substr(0, 2) == "on") {
+    return getPropertyHandler(name, exception);
+  }
+
+  return Instance::getProperty(name, exception);
+}
+
+bool EventTargetInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  if (name.substr(0, 2) == "on") {
+    setPropertyHandler(name, value, exception);
+    return true;
+  } else {
+    return Instance::setProperty(name, value, exception);
+  }
+}
+
+ScriptValue EventTargetInstance::getPropertyHandler(const std::string &name, ScriptValue *exception) {
+  std::string eventType = name.substr(2);
+
+  if (_eventHandlers.count(eventType) == 0 || _eventHandlers[eventType].empty()) {
+    return ScriptValue::null(context);
+  }
+  return _eventHandlers[eventType].front();
+}
+
+void EventTargetInstance::setPropertyHandler(const std::string &name, const ScriptValue &value,
+                                             ScriptValue *exception) {
+  std::string eventType = name.substr(2);
+
+  if (_eventHandlers.count(eventType) == 0) {
+    _eventHandlers[eventType] = std::deque<ScriptValue>();
+  }
+
+  // Handlers are called as functions, other values would only be dropped when the event fires.
+  if (!value.isFunction()) return;
+  _eventHandlers[eventType].emplace_back(value);
+
+  auto EventTarget = static_cast<JSEventTarget *>(_hostClass);
+  auto isJsOnlyEvent = std::find(EventTarget->m_jsOnlyEvents.begin(), EventTarget->m_jsOnlyEvents.end(),
+                                 eventType) != EventTarget->m_jsOnlyEvents.end();
+
+  if (isJsOnlyEvent) return;
+
+  NativeString args_01{};
+  buildUICommandArgs(eventType, args_01);
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::addEvent, args_01, nullptr);
+}
+
+void EventTargetInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &propertyName : JSEventTarget::getEventTargetPropertyNames()) {
+    names.emplace_back(propertyName);
+  }
+
+  for (auto &propertyName : JSEventTarget::getEventTargetPrototypePropertyNames()) {
+    names.emplace_back(propertyName);
+  }
+}
+
+bool EventTargetInstance::internalDispatchEvent(EventInstance *eventInstance) {
+  std::string eventType = nativeStringToStdString(eventInstance->nativeEvent->type);
+  auto stack = _eventHandlers[eventType];
+  ScriptValue event = eventInstance->value();
+
+  for (auto &handler : stack) {
+    if (eventInstance->_stopImmediatePropagationFlag) break;
+    // Exceptions of handlers are reported to the context, the rest of handlers still run.
+    handler.call(handler, {event}, nullptr);
+  }
+
+  // do not dispatch event when event has been canceled
+  // true is prevented.
+  return eventInstance->_canceledFlag;
+}
+
+// This function will be called back by dart side when trigger events.
+void NativeEventTarget::dispatchEventImpl(NativeEventTarget *nativeEventTarget, NativeString *nativeEventType,
+                                          void *nativeEvent, int32_t isCustomEvent) {
+  assert_m(nativeEventTarget->instance != nullptr, "NativeEventTarget should have owner");
+  TRACE_EVENT("event", "dispatchNativeEvent");
+  EventTargetInstance *eventTargetInstance = nativeEventTarget->instance;
+  ScriptContext *context = eventTargetInstance->context;
+  ScriptScope scope(context);
+  std::string eventType = nativeStringToStdString(nativeEventType);
+  EventInstance *eventInstance = JSEvent::buildEventInstance(eventType, context, nativeEvent, isCustomEvent == 1);
+  eventTargetInstance->dispatchEvent(eventInstance);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_EVENT_TARGET_H
+#define KRAKENBRIDGE_SCRIPT_EVENT_TARGET_H
+
+#include "bindings/script/DOM/event.h"
+#include "dart_methods.h"
+#include "foundation/logging.h"
+#include "foundation/ui_command_queue.h"
+#include "foundation/ui_task_queue.h"
+#include "include/kraken_bridge.h"
+#include <atomic>
+#include <deque>
+#include <unordered_map>
+
+namespace kraken::binding {
+
+void bindEventTarget(ScriptContext *context);
+
+class EventTargetInstance;
+struct NativeEventTarget;
+
+class JSEventTarget : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, JSEventTarget *> instanceMap;
+  static JSEventTarget *instance(ScriptContext *context);
+  DEFINE_OBJECT_PROPERTY(EventTarget, 1, eventTargetId);
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(EventTarget, 4, addEventListener, removeEventListener, dispatchEvent,
+                                   __clearListeners__);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSEventTarget() = delete;
+  friend EventTargetInstance;
+  // Classes of subclasses inherit EventTarget.
+  KRAKEN_EXPORT explicit JSEventTarget(ScriptContext *context, const char *name);
+  // Classes deeper in the hierarchy inherit parent, which inherits EventTarget.
+  KRAKEN_EXPORT explicit JSEventTarget(ScriptContext *context, HostClass *parent, const char *name);
+  KRAKEN_EXPORT explicit JSEventTarget(ScriptContext *context);
+  ~JSEventTarget() override;
+
+  // Events which are dispatched by the bridge or JS only, listening to them don't notify dart side.
+  std::vector<std::string> m_jsOnlyEvents;
+
+private:
+  static ScriptValue addEventListener(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue removeEventListener(ScriptContext *context, const ScriptValue &thisObject,
+                                         const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue dispatchEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue clearListeners(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  FunctionHolder m_removeEventListener{context, prototypeObject, this, "removeEventListener", removeEventListener};
+  FunctionHolder m_dispatchEvent{context, prototypeObject, this, "dispatchEvent", dispatchEvent};
+  FunctionHolder m_clearListeners{context, prototypeObject, this, "__clearListeners__", clearListeners};
+  FunctionHolder m_addEventListener{context, prototypeObject, this, "addEventListener", addEventListener};
+};
+
+class EventTargetInstance : public HostClass::Instance {
+public:
+  EventTargetInstance() = delete;
+  KRAKEN_EXPORT explicit EventTargetInstance(JSEventTarget *eventTarget);
+  KRAKEN_EXPORT explicit EventTargetInstance(JSEventTarget *eventTarget, int64_t targetId);
+  KRAKEN_EXPORT ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  KRAKEN_EXPORT bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  KRAKEN_EXPORT void getPropertyNames(std::vector<std::string> &names) override;
+  ScriptValue getPropertyHandler(const std::string &name, ScriptValue *exception);
+  void setPropertyHandler(const std::string &name, const ScriptValue &value, ScriptValue *exception);
+  bool dispatchEvent(EventInstance *event);
+
+  ~EventTargetInstance() override;
+  int32_t eventTargetId;
+  NativeEventTarget *nativeEventTarget{nullptr};
+
+private:
+  friend JSEventTarget;
+  // TODO: use std::u16string for better performance.
+  std::unordered_map<std::string, std::deque<ScriptValue>> _eventHandlers;
+  bool internalDispatchEvent(EventInstance *eventInstance);
+};
+
+using NativeDispatchEvent = void (*)(NativeEventTarget *nativeEventTarget, NativeString *eventType, void *nativeEvent,
+                                     int32_t isCustomEvent);
+
+struct NativeEventTarget {
+  NativeEventTarget() = delete;
+  NativeEventTarget(EventTargetInstance *_instance)
+    : instance(_instance), dispatchEvent(NativeEventTarget::dispatchEventImpl){};
+
+  KRAKEN_EXPORT static void dispatchEventImpl(NativeEventTarget *nativeEventTarget, NativeString *eventType,
+                                              void *nativeEvent, int32_t isCustomEvent);
+
+  EventTargetInstance *instance;
+  NativeDispatchEvent dispatchEvent;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_EVENT_TARGET_H
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "close_event.h"
+#include "bindings/script/native_string_utils.h"
+
+namespace kraken::binding {
+
+void bindCloseEvent(ScriptContext *context) {
+  auto event = JSCloseEvent::instance(context);
+  bindGlobalValue(context, "CloseEvent", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSCloseEvent *> JSCloseEvent::instanceMap{};
+
+JSCloseEvent::~JSCloseEvent() {
+  instanceMap.erase(context);
+}
+
+JSCloseEvent::JSCloseEvent(ScriptContext *context) : JSEvent(context, "CloseEvent") {}
+
+ScriptValue JSCloseEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to construct 'JSCloseEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string eventType = arguments[0].toString();
+  ScriptValue closeEventInit;
+  if (arguments.size() == 2) {
+    closeEventInit = arguments[1];
+  }
+
+  auto event = new CloseEventInstance(this, eventType, closeEventInit, exception);
+  return event->value();
+}
+
+CloseEventInstance::CloseEventInstance(JSCloseEvent *jsCloseEvent, NativeCloseEvent *nativeCloseEvent)
+  : EventInstance(jsCloseEvent, nativeCloseEvent->nativeEvent), nativeCloseEvent(nativeCloseEvent) {
+  code = nativeCloseEvent->code;
+  m_reason = nativeStringToU16String(nativeCloseEvent->reason);
+  wasClean = nativeCloseEvent->wasClean == 1;
+}
+
+CloseEventInstance::CloseEventInstance(JSCloseEvent *jsCloseEvent, const std::string &eventType,
+                                       const ScriptValue &closeEventInit, ScriptValue *exception)
+  : EventInstance(jsCloseEvent, eventType, closeEventInit, exception) {
+  nativeCloseEvent = new NativeCloseEvent(nativeEvent);
+  nativeCloseEvent->reason = nullptr;
+
+  if (closeEventInit.isObject()) {
+    if (closeEventInit.hasProperty("wasClean")) {
+      wasClean = closeEventInit.getProperty("wasClean", exception).toBoolean();
+    }
+    if (closeEventInit.hasProperty("code")) {
+      code = closeEventInit.getProperty("code", exception).toNumber();
+    }
+    if (closeEventInit.hasProperty("reason")) {
+      m_reason = closeEventInit.getProperty("reason", exception).toU16String();
+    }
+  }
+  nativeCloseEvent->code = code;
+  nativeCloseEvent->wasClean = wasClean ? 1 : 0;
+}
+
+ScriptValue CloseEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSCloseEvent::getCloseEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+  switch (property) {
+  case JSCloseEvent::CloseEventProperty::code:
+    return ScriptValue::makeNumber(context, code);
+  case JSCloseEvent::CloseEventProperty::reason:
+    return ScriptValue::makeString(context, m_reason);
+  case JSCloseEvent::CloseEventProperty::wasClean:
+    return ScriptValue::makeBoolean(context, wasClean);
+  }
+
+  return ScriptValue();
+}
+
+bool CloseEventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSCloseEvent::getCloseEventPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case JSCloseEvent::CloseEventProperty::code: {
+      code = value.toNumber();
+      break;
+    }
+    case JSCloseEvent::CloseEventProperty::reason: {
+      m_reason = value.toU16String();
+      break;
+    }
+    case JSCloseEvent::CloseEventProperty::wasClean: {
+      wasClean = value.toBoolean();
+      break;
+    }
+    }
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+CloseEventInstance::~CloseEventInstance() {
+  if (nativeCloseEvent->reason != nullptr) nativeCloseEvent->reason->free();
+  delete nativeCloseEvent;
+}
+
+void CloseEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSCloseEvent::getCloseEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_CLOSE_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_CLOSE_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <unordered_map>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindCloseEvent(ScriptContext *context);
+
+struct NativeCloseEvent;
+
+class JSCloseEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(CloseEvent, 3, code, reason, wasClean)
+
+  static std::unordered_map<ScriptContext *, JSCloseEvent *> instanceMap;
+  OBJECT_INSTANCE(JSCloseEvent)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSCloseEvent() = delete;
+  ~JSCloseEvent() override;
+  explicit JSCloseEvent(ScriptContext *context);
+};
+
+class CloseEventInstance : public EventInstance {
+public:
+  CloseEventInstance() = delete;
+  explicit CloseEventInstance(JSCloseEvent *jsCloseEvent, NativeCloseEvent *nativeCloseEvent);
+  explicit CloseEventInstance(JSCloseEvent *jsCloseEvent, const std::string &eventType,
+                              const ScriptValue &closeEventInit, ScriptValue *exception);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~CloseEventInstance() override;
+
+  NativeCloseEvent *nativeCloseEvent;
+
+private:
+  double code{0};
+  bool wasClean{false};
+  std::u16string m_reason;
+};
+
+struct NativeCloseEvent {
+  NativeCloseEvent() = delete;
+  explicit NativeCloseEvent(NativeEvent *nativeEvent) : nativeEvent(nativeEvent){};
+
+  NativeEvent *nativeEvent;
+  int64_t code;
+  NativeString *reason;
+  int64_t wasClean;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_CLOSE_EVENT_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "input_event.h"
+#include "bindings/script/native_string_utils.h"
+
+namespace kraken::binding {
+
+void bindInputEvent(ScriptContext *context) {
+  auto event = JSInputEvent::instance(context);
+  bindGlobalValue(context, "InputEvent", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSInputEvent *> JSInputEvent::instanceMap{};
+
+JSInputEvent::~JSInputEvent() {
+  instanceMap.erase(context);
+}
+
+JSInputEvent::JSInputEvent(ScriptContext *context) : JSEvent(context, "InputEvent") {}
+
+ScriptValue JSInputEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to construct 'JSInputEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string eventType = arguments[0].toString();
+  ScriptValue inputEventInit;
+  if (arguments.size() == 2) {
+    inputEventInit = arguments[1];
+  }
+
+  auto event = new InputEventInstance(this, eventType, inputEventInit, exception);
+  return event->value();
+}
+
+InputEventInstance::InputEventInstance(JSInputEvent *jsInputEvent, NativeInputEvent *nativeInputEvent)
+  : EventInstance(jsInputEvent, nativeInputEvent->nativeEvent), nativeInputEvent(nativeInputEvent) {
+  if (nativeInputEvent->data != nullptr) m_data = nativeStringToU16String(nativeInputEvent->data);
+  if (nativeInputEvent->inputType != nullptr) m_inputType = nativeStringToU16String(nativeInputEvent->inputType);
+}
+
+InputEventInstance::InputEventInstance(JSInputEvent *jsInputEvent, const std::string &eventType,
+                                       const ScriptValue &inputEventInit, ScriptValue *exception)
+  : EventInstance(jsInputEvent, eventType, inputEventInit, exception) {
+  nativeInputEvent = new NativeInputEvent(nativeEvent);
+  nativeInputEvent->inputType = nullptr;
+  nativeInputEvent->data = nullptr;
+
+  if (inputEventInit.isObject()) {
+    if (inputEventInit.hasProperty("inputType")) {
+      m_inputType = inputEventInit.getProperty("inputType", exception).toU16String();
+    }
+    if (inputEventInit.hasProperty("data")) {
+      m_data = inputEventInit.getProperty("data", exception).toU16String();
+    }
+  }
+}
+
+ScriptValue InputEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSInputEvent::getInputEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+
+  if (property == JSInputEvent::InputEventProperty::inputType) {
+    return ScriptValue::makeString(context, m_inputType);
+  } else if (property == JSInputEvent::InputEventProperty::data) {
+    return ScriptValue::makeString(context, m_data);
+  }
+
+  return ScriptValue();
+}
+
+bool InputEventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSInputEvent::getInputEventPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case JSInputEvent::InputEventProperty::inputType: {
+      m_inputType = value.toU16String();
+      break;
+    }
+    case JSInputEvent::InputEventProperty::data: {
+      m_data = value.toU16String();
+      break;
+    }
+    }
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+InputEventInstance::~InputEventInstance() {
+  if (nativeInputEvent->data != nullptr) nativeInputEvent->data->free();
+  if (nativeInputEvent->inputType != nullptr) nativeInputEvent->inputType->free();
+  delete nativeInputEvent;
+}
+
+void InputEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSInputEvent::getInputEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_INPUT_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_INPUT_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <unordered_map>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindInputEvent(ScriptContext *context);
+
+struct NativeInputEvent;
+
+class JSInputEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(InputEvent, 2, inputType, data)
+
+  static std::unordered_map<ScriptContext *, JSInputEvent *> instanceMap;
+  OBJECT_INSTANCE(JSInputEvent)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSInputEvent() = delete;
+  ~JSInputEvent() override;
+  explicit JSInputEvent(ScriptContext *context);
+};
+
+class InputEventInstance : public EventInstance {
+public:
+  InputEventInstance() = delete;
+  explicit InputEventInstance(JSInputEvent *jsInputEvent, NativeInputEvent *nativeInputEvent);
+  explicit InputEventInstance(JSInputEvent *jsInputEvent, const std::string &eventType,
+                              const ScriptValue &inputEventInit, ScriptValue *exception);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~InputEventInstance() override;
+
+  NativeInputEvent *nativeInputEvent;
+
+private:
+  std::u16string m_data;
+  std::u16string m_inputType;
+};
+
+struct NativeInputEvent {
+  NativeInputEvent() = delete;
+  explicit NativeInputEvent(NativeEvent *nativeEvent) : nativeEvent(nativeEvent){};
+
+  NativeEvent *nativeEvent;
+  NativeString *inputType;
+  NativeString *data;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_INPUT_EVENT_H
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "intersection_change_event.h"
+
+namespace kraken::binding {
+
+void bindIntersectionChangeEvent(ScriptContext *context) {
+  auto event = JSIntersectionChangeEvent::instance(context);
+  bindGlobalValue(context, "IntersectionChangeEvent", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSIntersectionChangeEvent *> JSIntersectionChangeEvent::instanceMap{};
+
+JSIntersectionChangeEvent::~JSIntersectionChangeEvent() {
+  instanceMap.erase(context);
+}
+
+JSIntersectionChangeEvent::JSIntersectionChangeEvent(ScriptContext *context)
+  : JSEvent(context, "IntersectionChangeEvent") {}
+
+ScriptValue JSIntersectionChangeEvent::instanceConstructor(const ScriptArguments &arguments,
+                                                           ScriptValue *exception) {
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to construct 'JSIntersectionChangeEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  auto event = new IntersectionChangeEventInstance(this, arguments[0].toString(), exception);
+  return event->value();
+}
+
+IntersectionChangeEventInstance::IntersectionChangeEventInstance(
+  JSIntersectionChangeEvent *jsIntersectionChangeEvent, NativeIntersectionChangeEvent *nativeIntersectionChangeEvent)
+  : EventInstance(jsIntersectionChangeEvent, nativeIntersectionChangeEvent->nativeEvent),
+    nativeIntersectionChangeEvent(nativeIntersectionChangeEvent) {
+  intersectionRatio = nativeIntersectionChangeEvent->intersectionRatio;
+}
+
+IntersectionChangeEventInstance::IntersectionChangeEventInstance(JSIntersectionChangeEvent *jsIntersectionChangeEvent,
+                                                                 const std::string &eventType,
+                                                                 ScriptValue *exception)
+  : EventInstance(jsIntersectionChangeEvent, eventType, ScriptValue(), exception) {
+  nativeIntersectionChangeEvent = new NativeIntersectionChangeEvent(nativeEvent);
+  nativeIntersectionChangeEvent->intersectionRatio = 0;
+}
+
+ScriptValue IntersectionChangeEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSIntersectionChangeEvent::getIntersectionChangePropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+
+  if (property == JSIntersectionChangeEvent::IntersectionChangeProperty::intersectionRatio) {
+    return ScriptValue::makeNumber(context, intersectionRatio);
+  }
+
+  return ScriptValue();
+}
+
+bool IntersectionChangeEventInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                                  ScriptValue *exception) {
+  auto &propertyMap = JSIntersectionChangeEvent::getIntersectionChangePropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    if (property == JSIntersectionChangeEvent::IntersectionChangeProperty::intersectionRatio) {
+      intersectionRatio = value.toNumber();
+    }
+
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+IntersectionChangeEventInstance::~IntersectionChangeEventInstance() {
+  delete nativeIntersectionChangeEvent;
+}
+
+void IntersectionChangeEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSIntersectionChangeEvent::getIntersectionChangePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_INTERSECTION_CHANGE_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_INTERSECTION_CHANGE_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <unordered_map>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindIntersectionChangeEvent(ScriptContext *context);
+
+struct NativeIntersectionChangeEvent;
+
+class JSIntersectionChangeEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(IntersectionChange, 1, intersectionRatio)
+
+  static std::unordered_map<ScriptContext *, JSIntersectionChangeEvent *> instanceMap;
+  OBJECT_INSTANCE(JSIntersectionChangeEvent)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSIntersectionChangeEvent() = delete;
+  ~JSIntersectionChangeEvent() override;
+  explicit JSIntersectionChangeEvent(ScriptContext *context);
+};
+
+class IntersectionChangeEventInstance : public EventInstance {
+public:
+  IntersectionChangeEventInstance() = delete;
+  explicit IntersectionChangeEventInstance(JSIntersectionChangeEvent *jsIntersectionChangeEvent,
+                                           NativeIntersectionChangeEvent *nativeIntersectionChangeEvent);
+  explicit IntersectionChangeEventInstance(JSIntersectionChangeEvent *jsIntersectionChangeEvent,
+                                           const std::string &eventType, ScriptValue *exception);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~IntersectionChangeEventInstance() override;
+
+  NativeIntersectionChangeEvent *nativeIntersectionChangeEvent;
+
+private:
+  double intersectionRatio{0};
+};
+
+struct NativeIntersectionChangeEvent {
+  NativeIntersectionChangeEvent() = delete;
+  explicit NativeIntersectionChangeEvent(NativeEvent *nativeEvent) : nativeEvent(nativeEvent){};
+
+  NativeEvent *nativeEvent;
+
+  double intersectionRatio;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_INTERSECTION_CHANGE_EVENT_H
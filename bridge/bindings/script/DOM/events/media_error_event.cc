@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "media_error_event.h"
+#include "bindings/script/native_string_utils.h"
+
+namespace kraken::binding {
+
+void bindMediaErrorEvent(ScriptContext *context) {
+  auto event = JSMediaErrorEvent::instance(context);
+  bindGlobalValue(context, "MediaErrorEvent", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSMediaErrorEvent *> JSMediaErrorEvent::instanceMap{};
+
+JSMediaErrorEvent::~JSMediaErrorEvent() {
+  instanceMap.erase(context);
+}
+
+JSMediaErrorEvent::JSMediaErrorEvent(ScriptContext *context) : JSEvent(context, "MediaErrorEvent") {}
+
+ScriptValue JSMediaErrorEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to construct 'JSMediaErrorEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  auto event = new MediaErrorEventInstance(this, arguments[0].toString(), exception);
+  return event->value();
+}
+
+MediaErrorEventInstance::MediaErrorEventInstance(JSMediaErrorEvent *jsMediaErrorEvent,
+                                                 NativeMediaErrorEvent *nativeMediaErrorEvent)
+  : EventInstance(jsMediaErrorEvent, nativeMediaErrorEvent->nativeEvent),
+    nativeMediaErrorEvent(nativeMediaErrorEvent) {
+  if (nativeMediaErrorEvent->code != 0) code = nativeMediaErrorEvent->code;
+  if (nativeMediaErrorEvent->message != nullptr) m_message = nativeStringToU16String(nativeMediaErrorEvent->message);
+}
+
+MediaErrorEventInstance::MediaErrorEventInstance(JSMediaErrorEvent *jsMediaErrorEvent, const std::string &eventType,
+                                                 ScriptValue *exception)
+  : EventInstance(jsMediaErrorEvent, eventType, ScriptValue(), exception) {
+  nativeMediaErrorEvent = new NativeMediaErrorEvent(nativeEvent);
+}
+
+ScriptValue MediaErrorEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSMediaErrorEvent::getMediaErrorPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+
+  if (property == JSMediaErrorEvent::MediaErrorProperty::code) {
+    return ScriptValue::makeNumber(context, code);
+  } else if (property == JSMediaErrorEvent::MediaErrorProperty::message) {
+    return ScriptValue::makeString(context, m_message);
+  }
+
+  return ScriptValue();
+}
+
+bool MediaErrorEventInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                          ScriptValue *exception) {
+  auto &propertyMap = JSMediaErrorEvent::getMediaErrorPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case JSMediaErrorEvent::MediaErrorProperty::message: {
+      m_message = value.toU16String();
+      break;
+    }
+    case JSMediaErrorEvent::MediaErrorProperty::code: {
+      code = value.toNumber();
+      break;
+    }
+    }
+
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+MediaErrorEventInstance::~MediaErrorEventInstance() {
+  if (nativeMediaErrorEvent->message != nullptr) nativeMediaErrorEvent->message->free();
+  delete nativeMediaErrorEvent;
+}
+
+void MediaErrorEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSMediaErrorEvent::getMediaErrorPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
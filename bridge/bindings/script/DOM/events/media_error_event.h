@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_MEDIA_ERROR_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_MEDIA_ERROR_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <unordered_map>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindMediaErrorEvent(ScriptContext *context);
+
+struct NativeMediaErrorEvent;
+
+class JSMediaErrorEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(MediaError, 2, code, message)
+
+  static std::unordered_map<ScriptContext *, JSMediaErrorEvent *> instanceMap;
+  OBJECT_INSTANCE(JSMediaErrorEvent)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSMediaErrorEvent() = delete;
+  ~JSMediaErrorEvent() override;
+  explicit JSMediaErrorEvent(ScriptContext *context);
+};
+
+class MediaErrorEventInstance : public EventInstance {
+public:
+  MediaErrorEventInstance() = delete;
+  explicit MediaErrorEventInstance(JSMediaErrorEvent *jSMediaErrorEvent, NativeMediaErrorEvent *nativeMediaErrorEvent);
+  explicit MediaErrorEventInstance(JSMediaErrorEvent *jsMediaErrorEvent, const std::string &eventType,
+                                   ScriptValue *exception);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~MediaErrorEventInstance() override;
+
+  NativeMediaErrorEvent *nativeMediaErrorEvent;
+
+private:
+  std::u16string m_message;
+  int64_t code{0};
+};
+
+struct NativeMediaErrorEvent {
+  NativeMediaErrorEvent() = delete;
+  explicit NativeMediaErrorEvent(NativeEvent *nativeEvent) : nativeEvent(nativeEvent){};
+
+  NativeEvent *nativeEvent;
+  int64_t code{0};
+  NativeString *message{nullptr};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_MEDIA_ERROR_EVENT_H
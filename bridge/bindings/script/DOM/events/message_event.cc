@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "message_event.h"
+#include "bindings/script/native_string_utils.h"
+#include <cstdlib>
+
+namespace kraken::binding {
+
+void bindMessageEvent(ScriptContext *context) {
+  auto event = JSMessageEvent::instance(context);
+  bindGlobalValue(context, "MessageEvent", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSMessageEvent *> JSMessageEvent::instanceMap{};
+
+JSMessageEvent::~JSMessageEvent() {
+  instanceMap.erase(context);
+}
+
+JSMessageEvent::JSMessageEvent(ScriptContext *context) : JSEvent(context, "MessageEvent") {}
+
+ScriptValue JSMessageEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() != 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to construct 'JSMessageEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  auto event = new MessageEventInstance(this, arguments[0].toString(), exception);
+  return event->value();
+}
+
+MessageEventInstance::MessageEventInstance(JSMessageEvent *jsMessageEvent, NativeMessageEvent *nativeMessageEvent)
+  : EventInstance(jsMessageEvent, nativeMessageEvent->nativeEvent), nativeMessageEvent(nativeMessageEvent) {
+  if (nativeMessageEvent->bytes != nullptr) {
+    // The bytes allocated by dart side are released once the ArrayBuffer has its copy.
+    m_data = ScriptValue::makeArrayBuffer(context, nativeMessageEvent->bytes, nativeMessageEvent->length);
+    free(nativeMessageEvent->bytes);
+    nativeMessageEvent->bytes = nullptr;
+  } else if (nativeMessageEvent->data != nullptr) {
+    m_data = ScriptValue::makeString(context, nativeStringToU16String(nativeMessageEvent->data));
+  } else {
+    m_data = ScriptValue::makeString(context, "");
+  }
+  if (nativeMessageEvent->origin != nullptr) m_origin = nativeStringToU16String(nativeMessageEvent->origin);
+}
+
+MessageEventInstance::MessageEventInstance(JSMessageEvent *jsMessageEvent, const std::string &data,
+                                           ScriptValue *exception)
+  : EventInstance(jsMessageEvent, "message", ScriptValue(), exception) {
+  nativeMessageEvent = new NativeMessageEvent(nativeEvent);
+  m_data = ScriptValue::makeString(context, data);
+}
+
+ScriptValue MessageEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSMessageEvent::getMessageEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+
+  switch (property) {
+  case JSMessageEvent::MessageEventProperty::data:
+    return m_data;
+  case JSMessageEvent::MessageEventProperty::origin:
+    return ScriptValue::makeString(context, m_origin);
+  }
+
+  return ScriptValue();
+}
+
+bool MessageEventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSMessageEvent::getMessageEventPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case JSMessageEvent::MessageEventProperty::data: {
+      m_data = value;
+      break;
+    }
+    case JSMessageEvent::MessageEventProperty::origin: {
+      m_origin = value.toU16String();
+      break;
+    }
+    }
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+MessageEventInstance::~MessageEventInstance() {
+  if (nativeMessageEvent->data != nullptr) nativeMessageEvent->data->free();
+  if (nativeMessageEvent->origin != nullptr) nativeMessageEvent->origin->free();
+  delete nativeMessageEvent;
+}
+
+void MessageEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSMessageEvent::getMessageEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
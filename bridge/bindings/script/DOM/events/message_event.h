@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_MESSAGE_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_MESSAGE_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <unordered_map>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindMessageEvent(ScriptContext *context);
+
+struct NativeMessageEvent;
+
+class JSMessageEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(MessageEvent, 2, data, origin)
+
+  static std::unordered_map<ScriptContext *, JSMessageEvent *> instanceMap;
+  OBJECT_INSTANCE(JSMessageEvent)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSMessageEvent() = delete;
+  ~JSMessageEvent() override;
+  explicit JSMessageEvent(ScriptContext *context);
+};
+
+class MessageEventInstance : public EventInstance {
+public:
+  MessageEventInstance() = delete;
+  explicit MessageEventInstance(JSMessageEvent *jsMessageEvent, NativeMessageEvent *nativeMessageEvent);
+  explicit MessageEventInstance(JSMessageEvent *jsMessageEvent, const std::string &data, ScriptValue *exception);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~MessageEventInstance() override;
+
+  NativeMessageEvent *nativeMessageEvent;
+
+private:
+  ScriptValue m_data;
+  std::u16string m_origin;
+};
+
+struct NativeMessageEvent {
+  NativeMessageEvent() = delete;
+  explicit NativeMessageEvent(NativeEvent *nativeEvent) : nativeEvent(nativeEvent){};
+
+  NativeEvent *nativeEvent;
+  NativeString *data{nullptr};
+  NativeString *origin{nullptr};
+  // Binary message payload, data is ignored when bytes is not null. The bytes are owned by the bridge after dispatch.
+  uint8_t *bytes{nullptr};
+  int32_t length{0};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_MESSAGE_EVENT_H
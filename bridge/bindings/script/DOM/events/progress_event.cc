@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "progress_event.h"
+
+namespace kraken::binding {
+
+void bindProgressEvent(ScriptContext *context) {
+  auto event = JSProgressEvent::instance(context);
+  bindGlobalValue(context, "ProgressEvent", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSProgressEvent *> JSProgressEvent::instanceMap{};
+
+JSProgressEvent::~JSProgressEvent() {
+  instanceMap.erase(context);
+}
+
+JSProgressEvent::JSProgressEvent(ScriptContext *context) : JSEvent(context, "ProgressEvent") {}
+
+ScriptValue JSProgressEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to construct 'ProgressEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string type = arguments[0].toString();
+  ScriptValue eventInit;
+  if (arguments.size() > 1 && arguments[1].isObject()) {
+    eventInit = arguments[1];
+  }
+
+  auto event = new ProgressEventInstance(this, type, eventInit, exception);
+  return event->value();
+}
+
+ProgressEventInstance::ProgressEventInstance(JSProgressEvent *jsProgressEvent, const std::string &type,
+                                             const ScriptValue &eventInit, ScriptValue *exception)
+  : EventInstance(jsProgressEvent, type, eventInit, exception) {
+  if (!eventInit.isObject()) return;
+
+  if (eventInit.hasProperty("lengthComputable")) {
+    lengthComputable = eventInit.getProperty("lengthComputable", exception).toBoolean();
+  }
+  if (eventInit.hasProperty("loaded")) {
+    loaded = eventInit.getProperty("loaded", exception).toNumber();
+  }
+  if (eventInit.hasProperty("total")) {
+    total = eventInit.getProperty("total", exception).toNumber();
+  }
+}
+
+ProgressEventInstance::ProgressEventInstance(JSProgressEvent *jsProgressEvent, const std::string &type,
+                                             bool lengthComputable, double loaded, double total)
+  : EventInstance(jsProgressEvent, type, ScriptValue(), nullptr), lengthComputable(lengthComputable), loaded(loaded),
+    total(total) {}
+
+ScriptValue ProgressEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSProgressEvent::getProgressEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+
+  switch (property) {
+  case JSProgressEvent::ProgressEventProperty::lengthComputable:
+    return ScriptValue::makeBoolean(context, lengthComputable);
+  case JSProgressEvent::ProgressEventProperty::loaded:
+    return ScriptValue::makeNumber(context, loaded);
+  case JSProgressEvent::ProgressEventProperty::total:
+    return ScriptValue::makeNumber(context, total);
+  }
+
+  return ScriptValue();
+}
+
+bool ProgressEventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSProgressEvent::getProgressEventPropertyMap();
+  // ProgressEvent attributes are readonly.
+  if (propertyMap.count(name) > 0) return true;
+  return EventInstance::setProperty(name, value, exception);
+}
+
+void ProgressEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSProgressEvent::getProgressEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_PROGRESS_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_PROGRESS_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <unordered_map>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindProgressEvent(ScriptContext *context);
+
+class JSProgressEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(ProgressEvent, 3, lengthComputable, loaded, total)
+
+  static std::unordered_map<ScriptContext *, JSProgressEvent *> instanceMap;
+  OBJECT_INSTANCE(JSProgressEvent)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSProgressEvent() = delete;
+  ~JSProgressEvent() override;
+  explicit JSProgressEvent(ScriptContext *context);
+};
+
+// ProgressEvent are only fired by the bridge (XMLHttpRequest) or created by JS, dart side never create them.
+class ProgressEventInstance : public EventInstance {
+public:
+  ProgressEventInstance() = delete;
+  explicit ProgressEventInstance(JSProgressEvent *jsProgressEvent, const std::string &type,
+                                 const ScriptValue &eventInit, ScriptValue *exception);
+  explicit ProgressEventInstance(JSProgressEvent *jsProgressEvent, const std::string &type, bool lengthComputable,
+                                 double loaded, double total);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+private:
+  bool lengthComputable{false};
+  double loaded{0};
+  double total{0};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_PROGRESS_EVENT_H
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "touch_event.h"
+
+namespace kraken::binding {
+
+void bindTouchEvent(ScriptContext *context) {
+  auto event = JSTouchEvent::instance(context);
+  bindGlobalValue(context, "TouchEvent", event->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSTouchEvent *> JSTouchEvent::instanceMap{};
+
+JSTouchEvent::~JSTouchEvent() {
+  instanceMap.erase(context);
+}
+
+JSTouchEvent::JSTouchEvent(ScriptContext *context) : JSEvent(context, "TouchEvent") {}
+
+ScriptValue JSTouchEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to construct 'JSTouchEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  auto event = new TouchEventInstance(this, arguments[0].toString(), exception);
+  return event->value();
+}
+
+TouchEventInstance::TouchEventInstance(JSTouchEvent *jsTouchEvent, NativeTouchEvent *nativeTouchEvent)
+  : EventInstance(jsTouchEvent, nativeTouchEvent->nativeEvent), nativeTouchEvent(nativeTouchEvent) {
+  m_touches =
+    (new JSTouchList(jsTouchEvent->context, nativeTouchEvent->touches, nativeTouchEvent->touchLength))->value();
+  m_targetTouches =
+    (new JSTouchList(jsTouchEvent->context, nativeTouchEvent->targetTouches, nativeTouchEvent->targetTouchesLength))
+      ->value();
+  m_changedTouches =
+    (new JSTouchList(jsTouchEvent->context, nativeTouchEvent->changedTouches, nativeTouchEvent->changedTouchesLength))
+      ->value();
+}
+
+TouchEventInstance::TouchEventInstance(JSTouchEvent *jsTouchEvent, const std::string &eventType,
+                                       ScriptValue *exception)
+  : EventInstance(jsTouchEvent, eventType, ScriptValue(), exception) {
+  nativeTouchEvent = new NativeTouchEvent(nativeEvent);
+  nativeTouchEvent->touches = nullptr;
+  nativeTouchEvent->touchLength = 0;
+  nativeTouchEvent->targetTouches = nullptr;
+  nativeTouchEvent->targetTouchesLength = 0;
+  nativeTouchEvent->changedTouches = nullptr;
+  nativeTouchEvent->changedTouchesLength = 0;
+  nativeTouchEvent->altKey = 0;
+  nativeTouchEvent->metaKey = 0;
+  nativeTouchEvent->ctrlKey = 0;
+  nativeTouchEvent->shiftKey = 0;
+  m_touches = (new JSTouchList(context, nullptr, 0))->value();
+  m_targetTouches = (new JSTouchList(context, nullptr, 0))->value();
+  m_changedTouches = (new JSTouchList(context, nullptr, 0))->value();
+}
+
+ScriptValue TouchEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSTouchEvent::getTouchEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+
+  switch (property) {
+  case JSTouchEvent::TouchEventProperty::touches:
+    return m_touches;
+  case JSTouchEvent::TouchEventProperty::targetTouches:
+    return m_targetTouches;
+  case JSTouchEvent::TouchEventProperty::changedTouches:
+    return m_changedTouches;
+  case JSTouchEvent::TouchEventProperty::altKey:
+    return ScriptValue::makeBoolean(context, nativeTouchEvent->altKey == 1);
+  case JSTouchEvent::TouchEventProperty::metaKey:
+    return ScriptValue::makeBoolean(context, nativeTouchEvent->metaKey == 1);
+  case JSTouchEvent::TouchEventProperty::ctrlKey:
+    return ScriptValue::makeBoolean(context, nativeTouchEvent->ctrlKey == 1);
+  case JSTouchEvent::TouchEventProperty::shiftKey:
+    return ScriptValue::makeBoolean(context, nativeTouchEvent->shiftKey == 1);
+  }
+
+  return ScriptValue();
+}
+
+bool TouchEventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSTouchEvent::getTouchEventPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+TouchEventInstance::~TouchEventInstance() {
+  delete nativeTouchEvent;
+}
+
+void TouchEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSTouchEvent::getTouchEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+JSTouchList::JSTouchList(ScriptContext *context, NativeTouch **touches, int64_t length)
+  : HostObject(context, "TouchList") {
+  m_touchList.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    auto touch = new JSTouch(context, touches[i]);
+    m_touchList.emplace_back(touch->value());
+  }
+}
+
+ScriptValue JSTouchList::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getTouchListPropertyMap();
+
+  if (isNumberIndex(name)) {
+    size_t index = std::stoul(name);
+    if (index >= m_touchList.size()) return ScriptValue::undefined(context);
+    return m_touchList[index];
+  } else if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    if (property == TouchListProperty::length) {
+      return ScriptValue::makeNumber(context, m_touchList.size());
+    }
+  }
+
+  return HostObject::getProperty(name, exception);
+}
+
+void JSTouchList::getPropertyNames(std::vector<std::string> &names) {
+  HostObject::getPropertyNames(names);
+
+  for (auto &property : getTouchListPropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (size_t i = 0; i < m_touchList.size(); i++) {
+    names.emplace_back(std::to_string(i));
+  }
+}
+
+JSTouch::JSTouch(ScriptContext *context, NativeTouch *touch) : HostObject(context, "Touch"), m_nativeTouch(touch) {}
+
+ScriptValue JSTouch::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getTouchPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case TouchProperty::identifier:
+      return ScriptValue::makeNumber(context, m_nativeTouch->identifier);
+    case TouchProperty::target:
+      return m_nativeTouch->target->instance->value();
+    case TouchProperty::clientX:
+      return ScriptValue::makeNumber(context, m_nativeTouch->clientX);
+    case TouchProperty::clientY:
+      return ScriptValue::makeNumber(context, m_nativeTouch->clientY);
+    case TouchProperty::screenX:
+      return ScriptValue::makeNumber(context, m_nativeTouch->screenX);
+    case TouchProperty::screenY:
+      return ScriptValue::makeNumber(context, m_nativeTouch->screenY);
+    case TouchProperty::pageX:
+      return ScriptValue::makeNumber(context, m_nativeTouch->pageX);
+    case TouchProperty::pageY:
+      return ScriptValue::makeNumber(context, m_nativeTouch->pageY);
+    case TouchProperty::radiusX:
+      return ScriptValue::makeNumber(context, m_nativeTouch->radiusX);
+    case TouchProperty::radiusY:
+      return ScriptValue::makeNumber(context, m_nativeTouch->radiusY);
+    case TouchProperty::rotationAngle:
+      return ScriptValue::makeNumber(context, m_nativeTouch->rotationAngle);
+    case TouchProperty::force:
+      return ScriptValue::makeNumber(context, m_nativeTouch->force);
+    case TouchProperty::altitudeAngle:
+      return ScriptValue::makeNumber(context, m_nativeTouch->altitudeAngle);
+    case TouchProperty::azimuthAngle:
+      return ScriptValue::makeNumber(context, m_nativeTouch->azimuthAngle);
+    case TouchProperty::touchType:
+      return ScriptValue::makeNumber(context, m_nativeTouch->touchType);
+    }
+  }
+
+  return HostObject::getProperty(name, exception);
+}
+
+JSTouch::~JSTouch() {
+  delete m_nativeTouch;
+}
+
+void JSTouch::getPropertyNames(std::vector<std::string> &names) {
+  HostObject::getPropertyNames(names);
+
+  for (auto &property : getTouchPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
@@ -3,20 +3,17 @@
  * Author: Kraken Team.
  */
 
-#ifndef KRAKENBRIDGE_TOUCH_EVENT_H
-#define KRAKENBRIDGE_TOUCH_EVENT_H
-
-#include "bindings/jsc/DOM/event.h"
-#include "bindings/jsc/DOM/event_target.h"
-#include "bindings/jsc/host_class.h"
-#include "bindings/jsc/host_object_internal.h"
-#include "bindings/jsc/js_context_internal.h"
+#ifndef KRAKENBRIDGE_SCRIPT_TOUCH_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_TOUCH_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include "bindings/script/DOM/event_target.h"
 #include <unordered_map>
 #include <vector>
 
-namespace kraken::binding::jsc {
+namespace kraken::binding {
 
-void bindTouchEvent(std::unique_ptr<JSContext> &context);
+void bindTouchEvent(ScriptContext *context);
 
 struct NativeTouchEvent;
 struct NativeTouch;
@@ -27,36 +24,33 @@ class JSTouchEvent : public JSEvent {
 public:
   DEFINE_OBJECT_PROPERTY(TouchEvent, 7, touches, targetTouches, changedTouches, altKey, metaKey, ctrlKey, shiftKey)
 
-  static std::unordered_map<JSContext *, JSTouchEvent *> instanceMap;
+  static std::unordered_map<ScriptContext *, JSTouchEvent *> instanceMap;
   OBJECT_INSTANCE(JSTouchEvent)
 
-  JSObjectRef instanceConstructor(JSContextRef ctx, JSObjectRef constructor, size_t argumentCount,
-                                  const JSValueRef *arguments, JSValueRef *exception) override;
-
-  JSValueRef getProperty(std::string &name, JSValueRef *exception) override;
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
 
 protected:
   JSTouchEvent() = delete;
-  ~JSTouchEvent();
-  explicit JSTouchEvent(JSContext *context);
+  ~JSTouchEvent() override;
+  explicit JSTouchEvent(ScriptContext *context);
 };
 
 class TouchEventInstance : public EventInstance {
 public:
   TouchEventInstance() = delete;
   explicit TouchEventInstance(JSTouchEvent *jsTouchEvent, NativeTouchEvent *nativeTouchEvent);
-  explicit TouchEventInstance(JSTouchEvent *jsTouchEvent, JSStringRef data);
-  JSValueRef getProperty(std::string &name, JSValueRef *exception) override;
-  bool setProperty(std::string &name, JSValueRef value, JSValueRef *exception) override;
-  void getPropertyNames(JSPropertyNameAccumulatorRef accumulator) override;
+  explicit TouchEventInstance(JSTouchEvent *jsTouchEvent, const std::string &eventType, ScriptValue *exception);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
   ~TouchEventInstance() override;
 
   NativeTouchEvent *nativeTouchEvent;
 
 private:
-  JSTouchList *m_touches;
-  JSTouchList *m_targetTouches;
-  JSTouchList *m_changedTouches;
+  ScriptValue m_touches;
+  ScriptValue m_targetTouches;
+  ScriptValue m_changedTouches;
 };
 
 class JSTouchList : public HostObject {
@@ -64,12 +58,12 @@ public:
   DEFINE_OBJECT_PROPERTY(TouchList, 1, length)
 
   JSTouchList() = delete;
-  explicit JSTouchList(JSContext *context, NativeTouch **touches, int64_t length);
-  JSValueRef getProperty(std::string &name, JSValueRef *exception) override;
-  void getPropertyNames(JSPropertyNameAccumulatorRef accumulator) override;
+  explicit JSTouchList(ScriptContext *context, NativeTouch **touches, int64_t length);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
 
 private:
-  std::vector<JSTouch *> m_touchList;
+  std::vector<ScriptValue> m_touchList;
 };
 
 class JSTouch : public HostObject {
@@ -78,11 +72,11 @@ public:
                          radiusY, rotationAngle, force, altitudeAngle, azimuthAngle, touchType)
 
   JSTouch() = delete;
-  explicit JSTouch(JSContext *context, NativeTouch *touch);
+  explicit JSTouch(ScriptContext *context, NativeTouch *touch);
   ~JSTouch() override;
 
-  JSValueRef getProperty(std::string &name, JSValueRef *exception) override;
-  void getPropertyNames(JSPropertyNameAccumulatorRef accumulator) override;
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
 
 private:
   NativeTouch *m_nativeTouch;
@@ -127,6 +121,6 @@ struct NativeTouchEvent {
   int64_t shiftKey;
 };
 
-} // namespace kraken::binding::jsc
+} // namespace kraken::binding
 
-#endif // KRAKENBRIDGE_TOUCH_EVENT_H
+#endif // KRAKENBRIDGE_SCRIPT_TOUCH_EVENT_H
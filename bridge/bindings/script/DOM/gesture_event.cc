@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "gesture_event.h"
+#include "bindings/script/native_string_utils.h"
+
+namespace kraken::binding {
+
+void bindGestureEvent(ScriptContext *context) {
+  auto GestureEvent = JSGestureEvent::instance(context);
+  bindGlobalValue(context, "GestureEvent", GestureEvent->classObject);
+};
+
+std::unordered_map<ScriptContext *, JSGestureEvent *> JSGestureEvent::instanceMap{};
+
+JSGestureEvent::~JSGestureEvent() {
+  instanceMap.erase(context);
+}
+
+JSGestureEvent::JSGestureEvent(ScriptContext *context) : JSEvent(context, "GestureEvent") {}
+
+ScriptValue JSGestureEvent::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to construct 'GestureEvent': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string gestureEventType = arguments[0].toString();
+  ScriptValue gestureEventInit;
+  if (arguments.size() == 2) {
+    gestureEventInit = arguments[1];
+  }
+  auto gestureEvent = new GestureEventInstance(this, gestureEventType, gestureEventInit, exception);
+  return gestureEvent->value();
+}
+
+GestureEventInstance::GestureEventInstance(JSGestureEvent *jsGestureEvent, const std::string &eventType,
+                                           const ScriptValue &eventInit, ScriptValue *exception)
+  : EventInstance(jsGestureEvent, eventType, eventInit, exception) {
+  if (eventInit.isObject()) {
+    if (eventInit.hasProperty("state")) {
+      m_state = eventInit.getProperty("state", exception);
+    }
+    if (eventInit.hasProperty("direction")) {
+      m_direction = eventInit.getProperty("direction", exception);
+    }
+    if (eventInit.hasProperty("deltaX")) {
+      m_deltaX = eventInit.getProperty("deltaX", exception);
+    }
+    if (eventInit.hasProperty("deltaY")) {
+      m_deltaY = eventInit.getProperty("deltaY", exception);
+    }
+    if (eventInit.hasProperty("velocityX")) {
+      m_velocityX = eventInit.getProperty("velocityX", exception);
+    }
+    if (eventInit.hasProperty("velocityY")) {
+      m_velocityY = eventInit.getProperty("velocityY", exception);
+    }
+    if (eventInit.hasProperty("scale")) {
+      m_scale = eventInit.getProperty("scale", exception);
+    }
+    if (eventInit.hasProperty("rotation")) {
+      m_rotation = eventInit.getProperty("rotation", exception);
+    }
+  }
+}
+
+GestureEventInstance::GestureEventInstance(JSGestureEvent *jsGestureEvent, NativeGestureEvent *nativeGestureEvent)
+  : nativeGestureEvent(nativeGestureEvent), EventInstance(jsGestureEvent, nativeGestureEvent->nativeEvent) {
+  m_state = ScriptValue::makeString(context, nativeStringToU16String(nativeGestureEvent->state));
+  nativeGestureEvent->state->free();
+  m_direction = ScriptValue::makeString(context, nativeStringToU16String(nativeGestureEvent->direction));
+  nativeGestureEvent->direction->free();
+
+  m_deltaX = ScriptValue::makeNumber(context, nativeGestureEvent->deltaX);
+  m_deltaY = ScriptValue::makeNumber(context, nativeGestureEvent->deltaY);
+  m_velocityX = ScriptValue::makeNumber(context, nativeGestureEvent->velocityX);
+  m_velocityY = ScriptValue::makeNumber(context, nativeGestureEvent->velocityY);
+  m_scale = ScriptValue::makeNumber(context, nativeGestureEvent->scale);
+  m_rotation = ScriptValue::makeNumber(context, nativeGestureEvent->rotation);
+}
+
+ScriptValue GestureEventInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSGestureEvent::getGestureEventPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventInstance::getProperty(name, exception);
+  auto property = propertyMap[name];
+
+  switch (property) {
+  case JSGestureEvent::GestureEventProperty::state:
+    return m_state;
+  case JSGestureEvent::GestureEventProperty::direction:
+    return m_direction;
+  case JSGestureEvent::GestureEventProperty::deltaX:
+    return m_deltaX;
+  case JSGestureEvent::GestureEventProperty::deltaY:
+    return m_deltaY;
+  case JSGestureEvent::GestureEventProperty::velocityX:
+    return m_velocityX;
+  case JSGestureEvent::GestureEventProperty::velocityY:
+    return m_velocityY;
+  case JSGestureEvent::GestureEventProperty::scale:
+    return m_scale;
+  case JSGestureEvent::GestureEventProperty::rotation:
+    return m_rotation;
+  }
+
+  return ScriptValue();
+}
+
+bool GestureEventInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSGestureEvent::getGestureEventPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case JSGestureEvent::GestureEventProperty::state:
+      m_state = value;
+      break;
+    case JSGestureEvent::GestureEventProperty::direction:
+      m_direction = value;
+      break;
+    case JSGestureEvent::GestureEventProperty::deltaX:
+      m_deltaX = value;
+      break;
+    case JSGestureEvent::GestureEventProperty::deltaY:
+      m_deltaY = value;
+      break;
+    case JSGestureEvent::GestureEventProperty::velocityX:
+      m_velocityX = value;
+      break;
+    case JSGestureEvent::GestureEventProperty::velocityY:
+      m_velocityY = value;
+      break;
+    case JSGestureEvent::GestureEventProperty::scale:
+      m_scale = value;
+      break;
+    case JSGestureEvent::GestureEventProperty::rotation:
+      m_rotation = value;
+      break;
+    }
+    return true;
+  } else {
+    return EventInstance::setProperty(name, value, exception);
+  }
+}
+
+ScriptValue JSGestureEvent::initGestureEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto eventInstance = HostClass::instanceOf<GestureEventInstance>(thisObject, static_cast<JSGestureEvent *>(data));
+  if (eventInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'initGestureEvent' on 'GestureEvent': 1 argument required, but only 0 present");
+    return ScriptValue();
+  }
+
+  if (eventInstance->_dispatchFlag) {
+    return ScriptValue();
+  }
+
+  eventInstance->nativeEvent->type->free();
+  eventInstance->nativeEvent->type = stringToNativeString(arguments[0].toU16String());
+
+  if (arguments.size() > 1) {
+    eventInstance->nativeEvent->bubbles = arguments[1].toBoolean() ? 1 : 0;
+  }
+
+  if (arguments.size() > 2) {
+    eventInstance->nativeEvent->cancelable = arguments[2].toBoolean() ? 1 : 0;
+  }
+
+  ScriptValue *values[] = {&eventInstance->m_state,     &eventInstance->m_direction, &eventInstance->m_deltaX,
+                           &eventInstance->m_deltaY,    &eventInstance->m_velocityX, &eventInstance->m_velocityY,
+                           &eventInstance->m_scale,     &eventInstance->m_rotation};
+  for (size_t i = 3; i < arguments.size() && i - 3 < 8; i++) {
+    *values[i - 3] = arguments[i];
+  }
+
+  return ScriptValue();
+}
+
+GestureEventInstance::~GestureEventInstance() {}
+
+void GestureEventInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventInstance::getPropertyNames(names);
+
+  for (auto &property : JSGestureEvent::getGestureEventPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_GESTURE_EVENT_H
+#define KRAKENBRIDGE_SCRIPT_GESTURE_EVENT_H
+
+#include "bindings/script/DOM/event.h"
+#include <cmath>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindGestureEvent(ScriptContext *context);
+
+class GestureEventInstance;
+
+struct NativeGestureEvent {
+  NativeGestureEvent() = delete;
+  explicit NativeGestureEvent(NativeEvent *nativeEvent) : nativeEvent(nativeEvent){};
+
+  NativeEvent *nativeEvent;
+
+  NativeString *state;
+
+  NativeString *direction;
+
+  double_t deltaX;
+
+  double_t deltaY;
+
+  double_t velocityX;
+
+  double_t velocityY;
+
+  double_t scale;
+
+  double_t rotation;
+};
+
+class JSGestureEvent : public JSEvent {
+public:
+  DEFINE_OBJECT_PROPERTY(GestureEvent, 8, state, direction, deltaX, deltaY, velocityX, velocityY, scale, rotation);
+
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(GestureEvent, 1, initGestureEvent);
+
+  static std::unordered_map<ScriptContext *, JSGestureEvent *> instanceMap;
+  OBJECT_INSTANCE(JSGestureEvent)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSGestureEvent() = delete;
+  explicit JSGestureEvent(ScriptContext *context);
+  ~JSGestureEvent() override;
+
+private:
+  friend GestureEventInstance;
+
+  FunctionHolder m_initGestureEvent{context, prototypeObject, this, "initGestureEvent", initGestureEvent};
+
+  static ScriptValue initGestureEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+};
+
+class GestureEventInstance : public EventInstance {
+public:
+  GestureEventInstance() = delete;
+  explicit GestureEventInstance(JSGestureEvent *jsGestureEvent, const std::string &gestureEventType,
+                                const ScriptValue &eventInit, ScriptValue *exception);
+  explicit GestureEventInstance(JSGestureEvent *jsGestureEvent, NativeGestureEvent *nativeGestureEvent);
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  ~GestureEventInstance() override;
+
+private:
+  friend JSGestureEvent;
+  ScriptValue m_state;
+  ScriptValue m_direction;
+  ScriptValue m_deltaX;
+  ScriptValue m_deltaY;
+  ScriptValue m_velocityX;
+  ScriptValue m_velocityY;
+  ScriptValue m_scale;
+  ScriptValue m_rotation;
+  NativeGestureEvent *nativeGestureEvent{nullptr};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_GESTURE_EVENT_H
@@ -0,0 +1,639 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "node.h"
+#include "bindings/script/native_string_utils.h"
+#include "document.h"
+#include "element.h"
+#include "foundation/instance_tracker.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+#include "text_node.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+void bindNode(ScriptContext *context) {
+  auto node = JSNode::instance(context);
+  bindGlobalValue(context, "Node", node->classObject);
+}
+
+JSNode::JSNode(ScriptContext *context) : JSEventTarget(context, "Node") {}
+JSNode::JSNode(ScriptContext *context, const char *name)
+  : JSEventTarget(context, JSNode::instance(context), name) {}
+JSNode::JSNode(ScriptContext *context, HostClass *parent, const char *name) : JSEventTarget(context, parent, name) {}
+
+std::unordered_map<ScriptContext *, JSNode *> JSNode::instanceMap{};
+
+JSNode *JSNode::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSNode(context);
+  }
+  return instanceMap[context];
+}
+
+JSNode::~JSNode() {
+  instanceMap.erase(context);
+}
+
+NodeInstance::~NodeInstance() {
+  context->memoryCounters.nodeCount--;
+  // Protected nodes are only finalized when the context is released.
+  if (_referenceCount > 0) KRAKEN_UNTRACK_INSTANCE(this);
+  // The this node is finalized, should tell all children this parent will no longer protecting them.
+  if (context->isValid()) {
+    for (auto &node : childNodes) {
+      node->parentNode = nullptr;
+      node->unrefer();
+      assert(node->_referenceCount <= 0 &&
+             ("Node recycled with a dangling node " + std::to_string(node->eventTargetId)).c_str());
+    }
+  }
+
+  foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeNode *>(ptr); }, nativeNode);
+}
+
+NodeInstance::NodeInstance(JSNode *node, NodeType nodeType)
+  : EventTargetInstance(node), nativeNode(new NativeNode(nativeEventTarget)), nodeType(nodeType) {
+  context->memoryCounters.nodeCount++;
+}
+
+NodeInstance::NodeInstance(JSNode *node, NodeType nodeType, int64_t targetId)
+  : EventTargetInstance(node, targetId), nativeNode(new NativeNode(nativeEventTarget)), nodeType(nodeType) {
+  context->memoryCounters.nodeCount++;
+}
+
+// Returns true if node is connected and false otherwise.
+bool NodeInstance::isConnected() {
+  bool _isConnected = eventTargetId == BODY_TARGET_ID;
+  auto parent = parentNode;
+
+  while (parent != nullptr && !_isConnected) {
+    _isConnected = parent->eventTargetId == BODY_TARGET_ID;
+    parent = parent->parentNode;
+  }
+
+  return _isConnected;
+}
+
+// The ownerDocument attribute’s getter must return null,
+// if this is a document, and this’s node document otherwise.
+// https://dom.spec.whatwg.org/#dom-node-ownerdocument
+DocumentInstance *NodeInstance::ownerDocument() {
+  if (nodeType == NodeType::DOCUMENT_NODE) {
+    return nullptr;
+  }
+
+  return document;
+}
+
+NodeInstance *NodeInstance::firstChild() {
+  if (childNodes.empty()) {
+    return nullptr;
+  }
+  return childNodes.front();
+}
+
+NodeInstance *NodeInstance::lastChild() {
+  if (childNodes.empty()) {
+    return nullptr;
+  }
+  return childNodes.back();
+}
+
+NodeInstance *NodeInstance::previousSibling() {
+  if (parentNode == nullptr) return nullptr;
+
+  auto &&parentChildNodes = parentNode->childNodes;
+  auto it = std::find(parentChildNodes.begin(), parentChildNodes.end(), this);
+
+  if (parentChildNodes.size() < 2) {
+    return nullptr;
+  }
+
+  if (it != parentChildNodes.begin()) {
+    return *(it - 1);
+  }
+
+  return nullptr;
+}
+
+NodeInstance *NodeInstance::nextSibling() {
+  if (parentNode == nullptr) return nullptr;
+
+  auto &&parentChildNodes = parentNode->childNodes;
+  auto it = std::find(parentChildNodes.begin(), parentChildNodes.end(), this);
+
+  if ((it + 1) != parentChildNodes.end()) {
+    return *(it + 1);
+  }
+
+  return nullptr;
+}
+
+void NodeInstance::ensureDetached(NodeInstance *node) {
+  if (node->parentNode != nullptr) {
+    auto it = std::find(node->parentNode->childNodes.begin(), node->parentNode->childNodes.end(), node);
+    if (it != node->parentNode->childNodes.end()) {
+      node->_notifyNodeRemoved(node->parentNode);
+      node->parentNode->childNodes.erase(it);
+      node->parentNode = nullptr;
+      node->unrefer();
+    }
+  }
+}
+
+ScriptValue JSNode::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  *exception = ScriptValue::makeError(context, "Illegal constructor");
+  return ScriptValue();
+}
+
+NodeInstance *JSNode::copyNodeValue(NodeInstance *node) {
+  if (node->nodeType == NodeType::ELEMENT_NODE) {
+    auto element = static_cast<ElementInstance *>(node);
+
+    /* createElement */
+    std::string tagName = element->tagName();
+    auto newElement = JSElement::buildElementInstance(element->context, tagName);
+    newElement->document = element->document;
+
+    /* copy attributes */
+    newElement->getAttributes()->setAttributesMap(element->getAttributes()->getAttributesMap());
+    newElement->getAttributes()->setAttributesVector(element->getAttributes()->getAttributesVector());
+
+    /* copy style */
+    newElement->getStyle()->copyProperties(element->getStyle());
+
+    std::string newNodeEventTargetId = std::to_string(newElement->eventTargetId);
+
+    NativeString args_01{};
+    buildUICommandArgs(newNodeEventTargetId, args_01);
+
+    newElement->context->getUICommandQueue()->registerCommand(element->eventTargetId, UICommand::cloneNode, args_01,
+                                                              nullptr);
+
+    return newElement;
+  } else if (node->nodeType == TEXT_NODE) {
+    auto textNode = static_cast<JSTextNode::TextNodeInstance *>(node);
+
+    std::string content = textNode->internalGetTextContent();
+    auto newTextNodeInstance = new JSTextNode::TextNodeInstance(JSTextNode::instance(textNode->context), content);
+    newTextNodeInstance->document = textNode->document;
+
+    return newTextNodeInstance;
+  }
+
+  return nullptr;
+}
+
+void JSNode::traverseCloneNode(NodeInstance *element, NodeInstance *parentElement) {
+  for (auto iter : element->childNodes) {
+    auto newNodeInstance = copyNodeValue(iter);
+    // Only elements and text nodes are cloned.
+    if (newNodeInstance == nullptr) continue;
+    parentElement->internalAppendChild(newNodeInstance);
+    // element node needs recursive child nodes.
+    if (iter->nodeType == NodeType::ELEMENT_NODE) {
+      traverseCloneNode(iter, newNodeInstance);
+    }
+  }
+}
+
+ScriptValue JSNode::cloneNode(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception) {
+  auto selfInstance = HostClass::instanceOf<NodeInstance>(thisObject, static_cast<JSNode *>(data));
+  if (selfInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  const ScriptValue deepValue = arguments[0];
+  if (!deepValue.isBoolean()) {
+    *exception = ScriptValue::makeError(context, "Failed to cloneNode: deep should be a Boolean.");
+    return ScriptValue();
+  }
+  bool deep = deepValue.toBoolean();
+
+  if (selfInstance->nodeType == NodeType::ELEMENT_NODE) {
+    auto rootNodeInstance = copyNodeValue(selfInstance);
+
+    if (deep) {
+      traverseCloneNode(selfInstance, rootNodeInstance);
+    }
+
+    return rootNodeInstance->value();
+  } else if (selfInstance->nodeType == NodeType::TEXT_NODE) {
+    auto newTextNodeInstance = copyNodeValue(selfInstance);
+    return newTextNodeInstance->value();
+  } else {
+    return ScriptValue::null(context);
+  }
+}
+
+ScriptValue JSNode::appendChild(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto selfInstance = HostClass::instanceOf<NodeInstance>(thisObject, static_cast<JSNode *>(data));
+  if (selfInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 1) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'appendChild' on 'Node': first argument is required.");
+    return ScriptValue();
+  }
+
+  const ScriptValue nodeValue = arguments[0];
+  auto nodeInstance = HostClass::instanceOf<NodeInstance>(nodeValue, JSNode::instance(context));
+
+  if (nodeInstance == nullptr || nodeInstance->document != selfInstance->document) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'appendChild' on 'Node': first arguments should be an Node "
+                                      "type.");
+    return ScriptValue();
+  }
+
+  if (nodeInstance->eventTargetId == BODY_TARGET_ID || nodeInstance == selfInstance) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'appendChild' on 'Node': The new child element contains the parent.");
+    return ScriptValue();
+  }
+
+  selfInstance->internalAppendChild(nodeInstance);
+
+  return nodeValue;
+}
+
+ScriptValue JSNode::insertBefore(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto selfInstance = HostClass::instanceOf<NodeInstance>(thisObject, static_cast<JSNode *>(data));
+  if (selfInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 2) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'insertBefore' on 'Node': 2 arguments is required.");
+    return ScriptValue();
+  }
+
+  const ScriptValue nodeValue = arguments[0];
+  const ScriptValue referenceNodeValue = arguments[1];
+
+  if (!nodeValue.isObject()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'insertBefore' on 'Node': the node element is not object.");
+    return ScriptValue();
+  }
+
+  NodeInstance *referenceInstance = nullptr;
+
+  if (referenceNodeValue.isObject()) {
+    referenceInstance = HostClass::instanceOf<NodeInstance>(referenceNodeValue, JSNode::instance(context));
+  } else if (!referenceNodeValue.isNull()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'insertBefore' on 'Node': parameter 2 is not of type 'Node'");
+    return ScriptValue();
+  }
+
+  auto nodeInstance = HostClass::instanceOf<NodeInstance>(nodeValue, JSNode::instance(context));
+
+  if (nodeInstance == nullptr || nodeInstance->document != selfInstance->document) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'insertBefore' on 'Node': parameter 1 is not of type 'Node'");
+    return ScriptValue();
+  }
+
+  selfInstance->internalInsertBefore(nodeInstance, referenceInstance, exception);
+
+  return ScriptValue();
+}
+
+ScriptValue JSNode::replaceChild(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto selfInstance = HostClass::instanceOf<NodeInstance>(thisObject, static_cast<JSNode *>(data));
+  if (selfInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 2) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'replaceChild' on 'Node': 2 arguments required");
+    return ScriptValue();
+  }
+
+  const ScriptValue newChildValue = arguments[0];
+  const ScriptValue oldChildValue = arguments[1];
+
+  if (!newChildValue.isObject()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'replaceChild' on 'Node': 1 arguments is not object");
+    return ScriptValue();
+  }
+
+  if (!oldChildValue.isObject()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'replaceChild' on 'Node': 2 arguments is not object.");
+    return ScriptValue();
+  }
+
+  auto newChildInstance = HostClass::instanceOf<NodeInstance>(newChildValue, JSNode::instance(context));
+  auto oldChildInstance = HostClass::instanceOf<NodeInstance>(oldChildValue, JSNode::instance(context));
+
+  if (oldChildInstance == nullptr || oldChildInstance->parentNode != selfInstance ||
+      oldChildInstance->document != selfInstance->document) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'replaceChild' on 'Node': The node to be replaced is not a child of this node.");
+    return ScriptValue();
+  }
+
+  if (newChildInstance == nullptr || newChildInstance->document != selfInstance->document) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'replaceChild' on 'Node': The new node is not a type of "
+                                      "node.");
+    return ScriptValue();
+  }
+
+  selfInstance->internalReplaceChild(newChildInstance, oldChildInstance, exception);
+
+  return ScriptValue();
+}
+
+void NodeInstance::internalInsertBefore(NodeInstance *node, NodeInstance *referenceNode, ScriptValue *exception) {
+  if (referenceNode == nullptr) {
+    internalAppendChild(node);
+  } else {
+    if (referenceNode->parentNode != this) {
+      *exception = ScriptValue::makeError(
+        context, "Failed to execute 'insertBefore' on 'Node': reference node is not a child of this node.");
+      return;
+    }
+
+    ensureDetached(node);
+    auto parent = referenceNode->parentNode;
+    if (parent != nullptr) {
+      auto &&parentChildNodes = parent->childNodes;
+      auto it = std::find(parentChildNodes.begin(), parentChildNodes.end(), referenceNode);
+
+      if (it == parentChildNodes.end()) {
+        *exception = ScriptValue::makeError(
+          context, "Failed to execute 'insertBefore' on 'Node': reference node is not a child of this node.");
+        return;
+      }
+
+      parentChildNodes.insert(it, node);
+      node->parentNode = parent;
+      node->refer();
+      node->_notifyNodeInsert(parent);
+
+      std::string nodeEventTargetId = std::to_string(node->eventTargetId);
+      std::string position = std::string("beforebegin");
+
+      NativeString args_01{};
+      NativeString args_02{};
+      buildUICommandArgs(nodeEventTargetId, position, args_01, args_02);
+
+      context->getUICommandQueue()->registerCommand(referenceNode->eventTargetId, UICommand::insertAdjacentNode,
+                                                    args_01, args_02, nullptr);
+    }
+  }
+}
+
+ScriptValue JSNode::remove(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception) {
+  auto selfInstance = HostClass::instanceOf<NodeInstance>(thisObject, static_cast<JSNode *>(data));
+  if (selfInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  selfInstance->internalRemove(exception);
+  return ScriptValue();
+}
+
+ScriptValue JSNode::removeChild(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto selfInstance = HostClass::instanceOf<NodeInstance>(thisObject, static_cast<JSNode *>(data));
+  if (selfInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'removeChild' on 'Node': 1 arguments required");
+    return ScriptValue();
+  }
+
+  const ScriptValue nodeValue = arguments[0];
+
+  if (!nodeValue.isObject()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'removeChild' on 'Node': 1st arguments is not object");
+    return ScriptValue();
+  }
+
+  auto nodeInstance = HostClass::instanceOf<NodeInstance>(nodeValue, JSNode::instance(context));
+
+  if (nodeInstance == nullptr || nodeInstance->document != selfInstance->document) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'removeChild' on 'Node': 1st arguments is not a Node object.");
+    return ScriptValue();
+  }
+
+  auto removedNode = selfInstance->internalRemoveChild(nodeInstance, exception);
+
+  return removedNode->value();
+}
+
+void NodeInstance::internalAppendChild(NodeInstance *node) {
+  ensureDetached(node);
+  childNodes.emplace_back(node);
+  node->parentNode = this;
+  node->refer();
+
+  node->_notifyNodeInsert(this);
+
+  std::string nodeEventTargetId = std::to_string(node->eventTargetId);
+  std::string position = std::string("beforeend");
+
+  NativeString args_01{};
+  NativeString args_02{};
+
+  buildUICommandArgs(nodeEventTargetId, position, args_01, args_02);
+
+  node->context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::insertAdjacentNode, args_01, args_02,
+                                                      nullptr);
+}
+
+void NodeInstance::internalRemove(ScriptValue *exception) {
+  if (parentNode == nullptr) return;
+  parentNode->internalRemoveChild(this, exception);
+}
+
+NodeInstance *NodeInstance::internalRemoveChild(NodeInstance *node, ScriptValue *exception) {
+  auto it = std::find(childNodes.begin(), childNodes.end(), node);
+
+  if (it != childNodes.end()) {
+    childNodes.erase(it);
+    node->parentNode = nullptr;
+    node->unrefer();
+    node->_notifyNodeRemoved(this);
+    node->context->getUICommandQueue()->registerCommand(node->eventTargetId, UICommand::removeNode, nullptr);
+  }
+
+  return node;
+}
+
+NodeInstance *NodeInstance::internalReplaceChild(NodeInstance *newChild, NodeInstance *oldChild,
+                                                 ScriptValue *exception) {
+  ensureDetached(newChild);
+  assert_m(newChild->parentNode == nullptr, "ReplaceChild Error: newChild was not detached.");
+
+  auto childIndex = std::find(childNodes.begin(), childNodes.end(), oldChild);
+  if (childIndex == childNodes.end()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'replaceChild' on 'Node': old child is not exist on "
+                                      "childNodes.");
+    return nullptr;
+  }
+
+  oldChild->parentNode = nullptr;
+  oldChild->unrefer();
+
+  newChild->parentNode = this;
+  childIndex = childNodes.erase(childIndex);
+  childNodes.insert(childIndex, newChild);
+  newChild->refer();
+
+  oldChild->_notifyNodeRemoved(this);
+  newChild->_notifyNodeInsert(this);
+
+  std::string newChildEventTargetId = std::to_string(newChild->eventTargetId);
+  std::string position = std::string("afterend");
+
+  NativeString args_01{};
+  NativeString args_02{};
+
+  buildUICommandArgs(newChildEventTargetId, position, args_01, args_02);
+
+  context->getUICommandQueue()->registerCommand(oldChild->eventTargetId, UICommand::insertAdjacentNode, args_01,
+                                                args_02, nullptr);
+
+  context->getUICommandQueue()->registerCommand(oldChild->eventTargetId, UICommand::removeNode, nullptr);
+
+  return oldChild;
+}
+
+ScriptValue NodeInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = JSNode::getNodePropertyMap();
+
+  if (propertyMap.count(name) == 0) {
+    return EventTargetInstance::getProperty(name, exception);
+  }
+
+  auto property = propertyMap[name];
+
+  switch (property) {
+  case JSNode::NodeProperty::isConnected:
+    return ScriptValue::makeBoolean(context, isConnected());
+  case JSNode::NodeProperty::ownerDocument: {
+    auto instance = ownerDocument();
+    return instance != nullptr ? instance->value() : ScriptValue::null(context);
+  }
+  case JSNode::NodeProperty::firstChild: {
+    auto instance = firstChild();
+    return instance != nullptr ? instance->value() : ScriptValue::null(context);
+  }
+  case JSNode::NodeProperty::parentNode: {
+    if (parentNode == nullptr) return ScriptValue::null(context);
+    return parentNode->value();
+  }
+  case JSNode::NodeProperty::lastChild: {
+    auto instance = lastChild();
+    return instance != nullptr ? instance->value() : ScriptValue::null(context);
+  }
+  case JSNode::NodeProperty::previousSibling: {
+    auto instance = previousSibling();
+    return instance != nullptr ? instance->value() : ScriptValue::null(context);
+  }
+  case JSNode::NodeProperty::nextSibling: {
+    auto instance = nextSibling();
+    return instance != nullptr ? instance->value() : ScriptValue::null(context);
+  }
+  case JSNode::NodeProperty::childNodes: {
+    std::vector<ScriptValue> elements;
+    elements.reserve(childNodes.size());
+
+    for (auto &node : childNodes) {
+      elements.emplace_back(node->value());
+    }
+
+    return ScriptValue::makeArray(context, elements);
+  }
+  case JSNode::NodeProperty::nodeType:
+    return ScriptValue::makeNumber(context, nodeType);
+  case JSNode::NodeProperty::textContent:
+    return ScriptValue::makeString(context, internalGetTextContent());
+  }
+
+  return ScriptValue();
+}
+
+bool NodeInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = JSNode::getNodePropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    if (property == JSNode::NodeProperty::textContent) {
+      internalSetTextContent(value.toString(), exception);
+    }
+
+    return true;
+  } else {
+    return EventTargetInstance::setProperty(name, value, exception);
+  }
+}
+
+void NodeInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventTargetInstance::getPropertyNames(names);
+
+  for (auto &property : JSNode::getNodePropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : JSNode::getNodePrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+std::string NodeInstance::internalGetTextContent() {
+  return "";
+}
+
+void NodeInstance::refer() {
+  if (_referenceCount == 0) {
+    m_self = value();
+    KRAKEN_TRACK_INSTANCE(this, contextId, "ProtectedNode");
+  }
+  _referenceCount++;
+}
+
+void NodeInstance::unrefer() {
+  _referenceCount--;
+  if (_referenceCount != 0) return;
+  KRAKEN_UNTRACK_INSTANCE(this);
+  // Released last, the node may be collected once nothing else references it.
+  m_self = ScriptValue();
+}
+
+void NodeInstance::_notifyNodeRemoved(NodeInstance *node) {}
+void NodeInstance::_notifyNodeInsert(NodeInstance *node) {}
+void NodeInstance::internalSetTextContent(const std::string &content, ScriptValue *exception) {}
+
+} // namespace kraken::binding
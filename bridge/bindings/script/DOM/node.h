@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_NODE_H
+#define KRAKENBRIDGE_SCRIPT_NODE_H
+
+#include "bindings/script/DOM/event_target.h"
+#include "include/kraken_bridge.h"
+#include <vector>
+
+namespace kraken::binding {
+
+void bindNode(ScriptContext *context);
+
+class NodeInstance;
+class DocumentInstance;
+struct NativeNode;
+
+enum NodeType {
+  ELEMENT_NODE = 1,
+  TEXT_NODE = 3,
+  COMMENT_NODE = 8,
+  DOCUMENT_NODE = 9,
+  DOCUMENT_TYPE_NODE = 10,
+  DOCUMENT_FRAGMENT_NODE = 11
+};
+
+class JSNode : public JSEventTarget {
+public:
+  static std::unordered_map<ScriptContext *, JSNode *> instanceMap;
+  static JSNode *instance(ScriptContext *context);
+  DEFINE_OBJECT_PROPERTY(Node, 10, isConnected, ownerDocument, firstChild, lastChild, parentNode, childNodes,
+                         previousSibling, nextSibling, nodeType, textContent);
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(Node, 6, appendChild, remove, removeChild, insertBefore, replaceChild, cloneNode);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  static ScriptValue cloneNode(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception);
+
+  static ScriptValue appendChild(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  /**
+   * The ChildNode.remove() method removes the object
+   * from the tree it belongs to.
+   * reference: https://dom.spec.whatwg.org/#dom-childnode-remove
+   */
+  static ScriptValue remove(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+
+  static ScriptValue removeChild(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue insertBefore(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  static ScriptValue replaceChild(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+protected:
+  JSNode() = delete;
+  explicit JSNode(ScriptContext *context);
+  // Classes of subclasses inherit Node.
+  explicit JSNode(ScriptContext *context, const char *name);
+  // Classes of subclasses of Element and the like inherit parent.
+  explicit JSNode(ScriptContext *context, HostClass *parent, const char *name);
+  ~JSNode() override;
+
+private:
+  FunctionHolder m_cloneNode{context, prototypeObject, this, "cloneNode", cloneNode};
+  FunctionHolder m_removeChild{context, prototypeObject, this, "removeChild", removeChild};
+  FunctionHolder m_appendChild{context, prototypeObject, this, "appendChild", appendChild};
+  FunctionHolder m_remove{context, prototypeObject, this, "remove", remove};
+  FunctionHolder m_insertBefore{context, prototypeObject, this, "insertBefore", insertBefore};
+  FunctionHolder m_replaceChild{context, prototypeObject, this, "replaceChild", replaceChild};
+  static void traverseCloneNode(NodeInstance *element, NodeInstance *parentElement);
+  static NodeInstance *copyNodeValue(NodeInstance *node);
+};
+
+class NodeInstance : public EventTargetInstance {
+public:
+  NodeInstance() = delete;
+  NodeInstance(JSNode *node, NodeType nodeType);
+  NodeInstance(JSNode *node, NodeType nodeType, int64_t targetId);
+  ~NodeInstance() override;
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+  bool isConnected();
+  DocumentInstance *ownerDocument();
+  NodeInstance *firstChild();
+  NodeInstance *lastChild();
+  NodeInstance *previousSibling();
+  NodeInstance *nextSibling();
+  void internalAppendChild(NodeInstance *node);
+  void internalRemove(ScriptValue *exception);
+  NodeInstance *internalRemoveChild(NodeInstance *node, ScriptValue *exception);
+  void internalInsertBefore(NodeInstance *node, NodeInstance *referenceNode, ScriptValue *exception);
+  virtual std::string internalGetTextContent();
+  virtual void internalSetTextContent(const std::string &content, ScriptValue *exception);
+  NodeInstance *internalReplaceChild(NodeInstance *newChild, NodeInstance *oldChild, ScriptValue *exception);
+
+  NodeType nodeType;
+  NodeInstance *parentNode{nullptr};
+  std::vector<NodeInstance *> childNodes;
+
+  NativeNode *nativeNode{nullptr};
+
+  void refer();
+  void unrefer();
+
+  int32_t _referenceCount{0};
+
+  DocumentInstance *document{nullptr};
+  virtual void _notifyNodeRemoved(NodeInstance *node);
+  virtual void _notifyNodeInsert(NodeInstance *node);
+
+private:
+  void ensureDetached(NodeInstance *node);
+  // Nodes in a tree are kept alive by their parents, a referenced node holds its own script object.
+  ScriptValue m_self;
+};
+
+struct NativeNode {
+  NativeNode() = delete;
+  KRAKEN_EXPORT NativeNode(NativeEventTarget *nativeEventTarget) : nativeEventTarget(nativeEventTarget){};
+  NativeEventTarget *nativeEventTarget;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_NODE_H
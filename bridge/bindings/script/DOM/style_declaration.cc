@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "style_declaration.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_queue.h"
+#include <vector>
+
+namespace kraken::binding {
+
+void bindCSSStyleDeclaration(ScriptContext *context) {
+  auto style = CSSStyleDeclaration::instance(context);
+  bindGlobalValue(context, "CSSStyleDeclaration", style->classObject);
+}
+
+namespace {
+
+static std::string parseJavaScriptCSSPropertyName(const std::string &propertyName) {
+  static std::unordered_map<std::string, std::string> propertyCache{};
+
+  if (propertyCache.count(propertyName) > 0) {
+    return propertyCache[propertyName];
+  }
+
+  std::vector<char> buffer(propertyName.size() + 1);
+
+  size_t hyphen = 0;
+  for (size_t i = 0; i < propertyName.size(); ++i) {
+    char c = propertyName[i + hyphen];
+    if (!c) break;
+    if (c == '-') {
+      hyphen++;
+      buffer[i] = toASCIIUpper(propertyName[i + hyphen]);
+    } else {
+      buffer[i] = c;
+    }
+  }
+
+  buffer.emplace_back('\0');
+
+  std::string result = std::string(buffer.data());
+
+  propertyCache[propertyName] = result;
+  return result;
+}
+
+} // namespace
+
+CSSStyleDeclaration::CSSStyleDeclaration(ScriptContext *context) : HostClass(context, "CSSStyleDeclaration") {}
+
+std::unordered_map<ScriptContext *, CSSStyleDeclaration *> CSSStyleDeclaration::instanceMap{};
+
+CSSStyleDeclaration *CSSStyleDeclaration::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new CSSStyleDeclaration(context);
+  }
+  return instanceMap[context];
+}
+
+CSSStyleDeclaration::~CSSStyleDeclaration() {
+  instanceMap.erase(context);
+}
+
+ScriptValue CSSStyleDeclaration::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto eventTargetInstance = HostClass::instanceOf<EventTargetInstance>(arguments[0], JSEventTarget::instance(context));
+  if (arguments.size() != 1 || eventTargetInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal constructor");
+    return ScriptValue();
+  }
+
+  auto style = new StyleDeclarationInstance(this, eventTargetInstance);
+  return style->value();
+}
+
+StyleDeclarationInstance::StyleDeclarationInstance(CSSStyleDeclaration *cssStyleDeclaration,
+                                                   EventTargetInstance *ownerEventTarget)
+  : Instance(cssStyleDeclaration), ownerEventTarget(ownerEventTarget) {}
+
+StyleDeclarationInstance::~StyleDeclarationInstance() = default;
+
+ScriptValue StyleDeclarationInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &prototypePropertyMap = getCSSStyleDeclarationPrototypePropertyMap();
+
+  if (prototypePropertyMap.count(name) > 0) {
+    return Instance::getProperty(name, exception);
+  }
+
+  if (properties.count(name) > 0) {
+    return ScriptValue::makeString(context, properties[name]);
+  }
+
+  return ScriptValue::makeString(context, "");
+}
+
+bool StyleDeclarationInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                           ScriptValue *exception) {
+  return internalSetProperty(name, value, exception);
+}
+
+bool StyleDeclarationInstance::internalSetProperty(const std::string &name, const ScriptValue &value,
+                                                   ScriptValue *exception) {
+  auto &prototypePropertyMap = getCSSStyleDeclarationPrototypePropertyMap();
+  if (prototypePropertyMap.count(name) > 0) return false;
+
+  std::u16string valueString;
+  if (!value.isNull()) {
+    valueString = value.toU16String();
+  }
+
+  std::string propertyName = parseJavaScriptCSSPropertyName(name);
+
+  properties[propertyName] = valueString;
+
+  NativeString args_01{};
+  NativeString args_02{};
+  buildUICommandArgs(propertyName, valueString, args_01, args_02);
+  context->getUICommandQueue()->registerCommand(ownerEventTarget->eventTargetId, UICommand::setStyle, args_01,
+                                                args_02, nullptr);
+
+  return true;
+}
+
+void StyleDeclarationInstance::internalRemoveProperty(const std::string &name, ScriptValue *exception) {
+  std::string propertyName = parseJavaScriptCSSPropertyName(name);
+
+  if (properties.count(propertyName) == 0) {
+    return;
+  }
+
+  std::u16string emptyString;
+  properties[propertyName] = emptyString;
+
+  NativeString args_01{};
+  NativeString args_02{};
+
+  buildUICommandArgs(propertyName, emptyString, args_01, args_02);
+
+  context->getUICommandQueue()->registerCommand(ownerEventTarget->eventTargetId, UICommand::setStyle, args_01,
+                                                args_02, nullptr);
+}
+
+ScriptValue StyleDeclarationInstance::internalGetPropertyValue(const std::string &name, ScriptValue *exception) {
+  std::string propertyName = parseJavaScriptCSSPropertyName(name);
+
+  if (properties.count(propertyName) == 0) {
+    return ScriptValue::makeString(context, "");
+  }
+
+  return ScriptValue::makeString(context, properties[propertyName]);
+}
+
+void StyleDeclarationInstance::copyProperties(const StyleDeclarationInstance *style) {
+  properties = style->properties;
+}
+
+ScriptValue CSSStyleDeclaration::setProperty(ScriptContext *context, const ScriptValue &thisObject,
+                                             const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto styleInstance = HostClass::instanceOf<StyleDeclarationInstance>(thisObject, static_cast<CSSStyleDeclaration *>(data));
+  if (styleInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 2) {
+    *exception = ScriptValue::makeError(context, "Failed to execute setProperty: 2 arguments is required.");
+    return ScriptValue();
+  }
+
+  const ScriptValue propertyValue = arguments[0];
+  const ScriptValue valueValue = arguments[1];
+
+  if (!propertyValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to execute setProperty: property value type is not a string.");
+    return ScriptValue();
+  }
+
+  if (!valueValue.isString()) {
+    *exception = ScriptValue::makeError(context, "Failed to execute setProperty: value type is not a string.");
+    return ScriptValue();
+  }
+
+  styleInstance->internalSetProperty(propertyValue.toString(), valueValue, exception);
+
+  return ScriptValue();
+}
+
+ScriptValue CSSStyleDeclaration::removeProperty(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data,
+                                                ScriptValue *exception) {
+  auto styleInstance = HostClass::instanceOf<StyleDeclarationInstance>(thisObject, static_cast<CSSStyleDeclaration *>(data));
+  if (styleInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(context, "Failed to execute removeProperty: 1 arguments is required.");
+    return ScriptValue();
+  }
+
+  const ScriptValue propertyValue = arguments[0];
+
+  if (!propertyValue.isString()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute removeProperty: property value type is not a string.");
+    return ScriptValue();
+  }
+
+  styleInstance->internalRemoveProperty(propertyValue.toString(), exception);
+  return ScriptValue();
+}
+
+ScriptValue CSSStyleDeclaration::getPropertyValue(ScriptContext *context, const ScriptValue &thisObject,
+                                                  const ScriptArguments &arguments, void *data,
+                                                  ScriptValue *exception) {
+  auto styleInstance = HostClass::instanceOf<StyleDeclarationInstance>(thisObject, static_cast<CSSStyleDeclaration *>(data));
+  if (styleInstance == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(context, "Failed to execute getPropertyValue: 1 arguments is required.");
+    return ScriptValue();
+  }
+
+  const ScriptValue propertyValue = arguments[0];
+
+  if (!propertyValue.isString()) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute getPropertyValue: property value type is not a string.");
+    return ScriptValue();
+  }
+
+  return styleInstance->internalGetPropertyValue(propertyValue.toString(), exception);
+}
+
+void StyleDeclarationInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &prop : properties) {
+    names.emplace_back(prop.first);
+  }
+
+  for (auto &prop : getCSSStyleDeclarationPrototypePropertyNames()) {
+    names.emplace_back(prop);
+  }
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_STYLE_DECLARATION_H
+#define KRAKENBRIDGE_SCRIPT_STYLE_DECLARATION_H
+
+#include "bindings/script/DOM/event_target.h"
+#include "bindings/script/host_class.h"
+#include <unordered_map>
+
+namespace kraken::binding {
+
+void bindCSSStyleDeclaration(ScriptContext *context);
+
+template <typename CharacterType> inline bool isASCIILower(CharacterType character) {
+  return character >= 'a' && character <= 'z';
+}
+
+template <typename CharacterType> inline CharacterType toASCIIUpper(CharacterType character) {
+  return character & ~(isASCIILower(character) << 5);
+}
+
+class CSSStyleDeclaration : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, CSSStyleDeclaration *> instanceMap;
+  static CSSStyleDeclaration *instance(ScriptContext *context);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  static ScriptValue setProperty(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue removeProperty(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getPropertyValue(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+protected:
+  CSSStyleDeclaration() = delete;
+  ~CSSStyleDeclaration() override;
+  explicit CSSStyleDeclaration(ScriptContext *context);
+
+  FunctionHolder m_setProperty{context, prototypeObject, this, "setProperty", setProperty};
+  FunctionHolder m_getPropertyValue{context, prototypeObject, this, "getPropertyValue", getPropertyValue};
+  FunctionHolder m_removeProperty{context, prototypeObject, this, "removeProperty", removeProperty};
+};
+
+class StyleDeclarationInstance : public HostClass::Instance {
+public:
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(CSSStyleDeclaration, 3, setProperty, removeProperty, getPropertyValue);
+
+  StyleDeclarationInstance() = delete;
+  StyleDeclarationInstance(CSSStyleDeclaration *cssStyleDeclaration, EventTargetInstance *ownerEventTarget);
+  ~StyleDeclarationInstance() override;
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+  bool internalSetProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception);
+  void internalRemoveProperty(const std::string &name, ScriptValue *exception);
+  ScriptValue internalGetPropertyValue(const std::string &name, ScriptValue *exception);
+  // Take the properties of style without sending them to dart, cloned elements are styled by dart already.
+  void copyProperties(const StyleDeclarationInstance *style);
+
+private:
+  std::unordered_map<std::string, std::u16string> properties;
+  const EventTargetInstance *ownerEventTarget;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_STYLE_DECLARATION_H
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "text_node.h"
+#include "bindings/script/native_string_utils.h"
+#include "foundation/ui_command_callback_queue.h"
+#include "foundation/ui_command_queue.h"
+
+namespace kraken::binding {
+
+void bindTextNode(ScriptContext *context) {
+  auto textNode = JSTextNode::instance(context);
+  bindGlobalValue(context, "TextNode", textNode->classObject);
+}
+
+std::unordered_map<ScriptContext *, JSTextNode *> JSTextNode::instanceMap{};
+
+JSTextNode::~JSTextNode() {
+  instanceMap.erase(context);
+}
+
+JSTextNode::JSTextNode(ScriptContext *context) : JSNode(context, "TextNode") {}
+
+ScriptValue JSTextNode::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  const ScriptValue dataValue = arguments[0];
+  auto textNode = new TextNodeInstance(this, dataValue.toString());
+  return textNode->value();
+}
+
+JSTextNode::TextNodeInstance::TextNodeInstance(JSTextNode *jsTextNode, const std::string &data)
+  : NodeInstance(jsTextNode, NodeType::TEXT_NODE), nativeTextNode(new NativeTextNode(nativeNode)), m_data(data) {
+  NativeString args_01{};
+  buildUICommandArgs(m_data, args_01);
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::createTextNode, args_01, nativeTextNode);
+}
+
+ScriptValue JSTextNode::TextNodeInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getTextNodePropertyMap();
+
+  if (propertyMap.count(name) == 0) {
+    return NodeInstance::getProperty(name, exception);
+  }
+
+  auto property = propertyMap[name];
+  switch (property) {
+  case TextNodeProperty::textContent:
+  case TextNodeProperty::data: {
+    return ScriptValue::makeString(context, m_data);
+  }
+  case TextNodeProperty::nodeName: {
+    return ScriptValue::makeString(context, "#text");
+  }
+  }
+
+  return ScriptValue();
+}
+
+bool JSTextNode::TextNodeInstance::setProperty(const std::string &name, const ScriptValue &value,
+                                               ScriptValue *exception) {
+  if (name == "data") {
+    m_data = value.toString();
+
+    NativeString args_01{};
+    NativeString args_02{};
+    buildUICommandArgs(name, m_data, args_01, args_02);
+    context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+    return true;
+  } else {
+    return NodeInstance::setProperty(name, value, exception);
+  }
+}
+
+void JSTextNode::TextNodeInstance::getPropertyNames(std::vector<std::string> &names) {
+  NodeInstance::getPropertyNames(names);
+
+  for (auto &property : getTextNodePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+std::string JSTextNode::TextNodeInstance::internalGetTextContent() {
+  return m_data;
+}
+
+JSTextNode::TextNodeInstance::~TextNodeInstance() {
+  foundation::UICommandCallbackQueue::instance()->registerCallback(
+    [](void *ptr) { delete reinterpret_cast<NativeTextNode *>(ptr); }, nativeTextNode);
+}
+
+void JSTextNode::TextNodeInstance::internalSetTextContent(const std::string &content, ScriptValue *exception) {
+  m_data = content;
+
+  std::string key = "data";
+  NativeString args_01{};
+  NativeString args_02{};
+  buildUICommandArgs(key, content, args_01, args_02);
+  context->getUICommandQueue()->registerCommand(eventTargetId, UICommand::setProperty, args_01, args_02, nullptr);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_TEXT_NODE_H
+#define KRAKENBRIDGE_SCRIPT_TEXT_NODE_H
+
+#include "bindings/script/DOM/node.h"
+
+namespace kraken::binding {
+
+void bindTextNode(ScriptContext *context);
+
+struct NativeTextNode;
+
+class JSTextNode : public JSNode {
+public:
+  static std::unordered_map<ScriptContext *, JSTextNode *> instanceMap;
+  OBJECT_INSTANCE(JSTextNode)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class TextNodeInstance : public NodeInstance {
+  public:
+    DEFINE_OBJECT_PROPERTY(TextNode, 3, data, textContent, nodeName)
+
+    TextNodeInstance() = delete;
+    ~TextNodeInstance() override;
+    explicit TextNodeInstance(JSTextNode *jsTextNode, const std::string &data);
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+    std::string internalGetTextContent() override;
+    void internalSetTextContent(const std::string &content, ScriptValue *exception) override;
+
+    NativeTextNode *nativeTextNode{nullptr};
+
+  private:
+    std::string m_data;
+  };
+
+protected:
+  JSTextNode() = delete;
+  ~JSTextNode() override;
+  explicit JSTextNode(ScriptContext *context);
+};
+
+struct NativeTextNode {
+  NativeTextNode() = delete;
+  NativeTextNode(NativeNode *nativeNode) : nativeNode(nativeNode){};
+
+  NativeNode *nativeNode;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_TEXT_NODE_H
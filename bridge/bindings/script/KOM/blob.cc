@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "blob.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+void BlobBuilder::append(const std::string &text) {
+  _data.reserve(_data.size() + text.size());
+  _data.insert(_data.end(), text.begin(), text.end());
+}
+
+void BlobBuilder::append(JSBlob::BlobInstance *blob) {
+  _data.reserve(_data.size() + blob->_data.size());
+  _data.insert(_data.end(), blob->_data.begin(), blob->_data.end());
+}
+
+void BlobBuilder::append(const ScriptValue &value, ScriptValue *exception) {
+  if (value.isString()) {
+    append(value.toString());
+  } else if (value.isArray()) {
+    auto length = static_cast<size_t>(value.getProperty("length", exception).toNumber());
+    for (size_t i = 0; i < length; i++) {
+      append(value.getIndex(i, exception), exception);
+    }
+  } else if (value.isObject()) {
+    size_t length = 0;
+    uint8_t *bytes = value.bufferSourceBytes(&length);
+    if (bytes != nullptr) {
+      _data.insert(_data.end(), bytes, bytes + length);
+      return;
+    }
+
+    auto blob = JSBlob::blobOf(value);
+    if (blob != nullptr) append(blob);
+  }
+}
+
+std::vector<uint8_t> BlobBuilder::finalize() {
+  return std::move(_data);
+}
+
+std::unordered_map<ScriptContext *, JSBlob *> JSBlob::instanceMap{};
+
+JSBlob *JSBlob::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSBlob(context);
+  }
+  return instanceMap[context];
+}
+
+JSBlob::~JSBlob() {
+  instanceMap.erase(context);
+}
+
+JSBlob::BlobInstance *JSBlob::blobOf(const ScriptValue &value) {
+  auto instance = HostClass::instanceOf(value);
+  if (instance == nullptr || instance->_hostClass->name != JSBlobName) return nullptr;
+  return static_cast<BlobInstance *>(instance);
+}
+
+ScriptValue JSBlob::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  BlobBuilder builder;
+  if (arguments.size() == 0) {
+    auto blob = new JSBlob::BlobInstance(this);
+    return blob->value();
+  }
+
+  const ScriptValue arrayValue = arguments[0];
+  const ScriptValue optionValue = arguments[1];
+
+  if (!arrayValue.isArray()) {
+    *exception = ScriptValue::makeError(context, "Failed to construct 'Blob': The provided value cannot be converted "
+                                                 "to a sequence");
+    return ScriptValue();
+  }
+
+  if (arguments.size() == 1 || optionValue.isUndefined()) {
+    builder.append(arrayValue, exception);
+    auto blob = new JSBlob::BlobInstance(this, builder.finalize());
+    return blob->value();
+  }
+
+  if (!optionValue.isObject()) {
+    *exception = ScriptValue::makeError(context, "Failed to construct 'Blob': parameter 2 ('options') "
+                                                 "is not an object");
+    return ScriptValue();
+  }
+
+  std::string mimeType = optionValue.getProperty("type", exception).toString();
+  builder.append(arrayValue, exception);
+  auto blob = new JSBlob::BlobInstance(this, builder.finalize(), mimeType);
+  return blob->value();
+}
+
+ScriptValue JSBlob::slice(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception) {
+  auto blob = HostClass::instanceOf<JSBlob::BlobInstance>(thisObject);
+  if (blob == nullptr || blob->_hostClass != data) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  size_t start = 0;
+  size_t end = blob->_data.size();
+  std::string mimeType = blob->mimeType;
+
+  if (arguments.size() > 0 && !arguments[0].isUndefined()) {
+    start = arguments[0].toNumber();
+  }
+
+  if (arguments.size() > 1 && !arguments[1].isUndefined()) {
+    end = arguments[1].toNumber();
+  }
+
+  if (arguments.size() > 2 && !arguments[2].isUndefined()) {
+    mimeType = arguments[2].toString();
+  }
+
+  end = std::min(end, blob->_data.size());
+  start = std::min(start, end);
+  std::vector<uint8_t> newData(blob->_data.begin() + start, blob->_data.begin() + end);
+
+  auto newBlob = new JSBlob::BlobInstance(static_cast<JSBlob *>(blob->_hostClass), std::move(newData), mimeType);
+  return newBlob->value();
+}
+
+ScriptValue JSBlob::text(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                         void *data, ScriptValue *exception) {
+  auto blob = HostClass::instanceOf<JSBlob::BlobInstance>(thisObject);
+  if (blob == nullptr || blob->_hostClass != data) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  // The executor runs before the Promise constructor returns, the blob is alive by then.
+  NativeFunction executor = [](ScriptContext *context, const ScriptValue &thisObject,
+                               const ScriptArguments &arguments, void *data, ScriptValue *exception) -> ScriptValue {
+    auto blob = static_cast<JSBlob::BlobInstance *>(data);
+    std::string newString(reinterpret_cast<const char *>(blob->_data.data()), blob->_data.size());
+    arguments[0].call(ScriptValue(), {ScriptValue::makeString(context, newString)}, exception);
+    return ScriptValue();
+  };
+
+  return ScriptValue::makePromise(context, executor, blob, exception);
+}
+
+ScriptValue JSBlob::arrayBuffer(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto blob = HostClass::instanceOf<JSBlob::BlobInstance>(thisObject);
+  if (blob == nullptr || blob->_hostClass != data) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  NativeFunction executor = [](ScriptContext *context, const ScriptValue &thisObject,
+                               const ScriptArguments &arguments, void *data, ScriptValue *exception) -> ScriptValue {
+    auto blob = static_cast<JSBlob::BlobInstance *>(data);
+    ScriptValue buffer = ScriptValue::makeArrayBuffer(context, blob->bytes(), blob->size());
+    arguments[0].call(ScriptValue(), {buffer}, exception);
+    return ScriptValue();
+  };
+
+  return ScriptValue::makePromise(context, executor, blob, exception);
+}
+
+JSBlob::BlobInstance::~BlobInstance() {
+  // Subtract the size the blob was created with.
+  context->memoryCounters.blobBytes -= _size;
+}
+
+uint8_t *JSBlob::BlobInstance::bytes() {
+  return _data.data();
+}
+
+int32_t JSBlob::BlobInstance::size() {
+  return _data.size();
+}
+
+ScriptValue JSBlob::BlobInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto propertyMap = getBlobPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+    switch (property) {
+    case BlobProperty::type:
+      return ScriptValue::makeString(context, mimeType);
+    case BlobProperty::size:
+      return ScriptValue::makeNumber(context, _size);
+    }
+  }
+
+  return Instance::getProperty(name, exception);
+}
+
+void JSBlob::BlobInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getBlobPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+void bindBlob(ScriptContext *context) {
+  auto Blob = JSBlob::instance(context);
+  bindGlobalValue(context, JSBlobName, Blob->classObject);
+}
+
+bool getBinaryPayload(const ScriptValue &value, uint8_t **bytes, int32_t *length) {
+  size_t byteLength = 0;
+  uint8_t *buffer = value.bufferSourceBytes(&byteLength);
+  if (buffer != nullptr) {
+    *bytes = buffer;
+    *length = static_cast<int32_t>(byteLength);
+    return true;
+  }
+
+  auto blob = JSBlob::blobOf(value);
+  if (blob != nullptr) {
+    *bytes = blob->bytes();
+    *length = blob->size();
+    return true;
+  }
+
+  return false;
+}
+
+} // namespace kraken::binding
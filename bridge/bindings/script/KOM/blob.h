@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+#ifndef KRAKENBRIDGE_SCRIPT_BLOB_H
+#define KRAKENBRIDGE_SCRIPT_BLOB_H
+
+#include "bindings/script/host_class.h"
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#define JSBlobName "Blob"
+
+namespace kraken::binding {
+
+void bindBlob(ScriptContext *context);
+
+// Read the raw bytes of an ArrayBuffer, ArrayBufferView or Blob without copying, the bytes are only valid until
+// the value been collected.
+bool getBinaryPayload(const ScriptValue &value, uint8_t **bytes, int32_t *length);
+
+class JSBlob;
+class BlobBuilder;
+
+class KRAKEN_EXPORT JSBlob : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, JSBlob *> instanceMap;
+  static JSBlob *instance(ScriptContext *context);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class BlobInstance : public Instance {
+  public:
+    DEFINE_OBJECT_PROPERTY(Blob, 2, type, size);
+
+    BlobInstance() = delete;
+    explicit BlobInstance(JSBlob *jsBlob) : _size(0), Instance(jsBlob){};
+    explicit BlobInstance(JSBlob *jsBlob, std::vector<uint8_t> &&data)
+      : _size(data.size()), _data(std::move(data)), Instance(jsBlob) {
+      context->memoryCounters.blobBytes += _size;
+    };
+    explicit BlobInstance(JSBlob *jsBlob, std::vector<uint8_t> &&data, std::string &mime)
+      : mimeType(mime), _size(data.size()), _data(std::move(data)), Instance(jsBlob) {
+      context->memoryCounters.blobBytes += _size;
+    };
+
+    ~BlobInstance() override;
+
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    /// get an pointer of bytes data from JSBlob
+    uint8_t *bytes();
+
+    /// get bytes data's length
+    int32_t size();
+
+  private:
+    size_t _size;
+    std::string mimeType{""};
+    std::vector<uint8_t> _data;
+    friend BlobBuilder;
+    friend JSBlob;
+  };
+
+  // The Blob instance of value, nullptr for other values.
+  static BlobInstance *blobOf(const ScriptValue &value);
+
+protected:
+  friend BlobInstance;
+  JSBlob() = delete;
+  ~JSBlob() override;
+  explicit JSBlob(ScriptContext *context) : HostClass(context, JSBlobName){};
+
+  static ScriptValue slice(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue text(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue arrayBuffer(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  FunctionHolder m_arrayBuffer{context, prototypeObject, this, "arrayBuffer", arrayBuffer};
+  FunctionHolder m_slice{context, prototypeObject, this, "slice", slice};
+  FunctionHolder m_text{context, prototypeObject, this, "text", text};
+};
+
+class BlobBuilder {
+public:
+  void append(const ScriptValue &value, ScriptValue *exception);
+  void append(JSBlob::BlobInstance *blob);
+  void append(const std::string &text);
+
+  std::vector<uint8_t> finalize();
+
+private:
+  friend JSBlob;
+  std::vector<uint8_t> _data;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_BLOB_H
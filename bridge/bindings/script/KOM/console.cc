@@ -0,0 +1,866 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "console.h"
+#include "foundation/logging.h"
+#include "foundation/monotonic_clock.h"
+#include "foundation/text_codec.h"
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+namespace kraken::binding {
+namespace {
+
+// Formats console arguments the same as the polyfill did in JavaScript, https://console.spec.whatwg.org/#formatter.
+// Objects are walked natively, nesting, the number of items of a collection and cycles are limited so logging a
+// large object graph stays cheap.
+class ConsoleFormatter {
+public:
+  // Arrays, maps and sets nested deeper are elided.
+  static constexpr int kMaxDepth = 6;
+  // Items of a collection or properties of an object after the first kMaxLength are elided.
+  static constexpr size_t kMaxLength = 100;
+  // Nesting of console.dir().
+  static constexpr int kDirDepth = 3;
+
+  explicit ConsoleFormatter(ScriptContext *context);
+
+  // console.log(), the first argument may be a format string.
+  std::u16string formatLog(const ScriptArguments &arguments, size_t begin = 0);
+  // Arguments from begin separated by spaces, without a format string.
+  std::u16string formatValues(const ScriptArguments &arguments, size_t begin = 0);
+  // console.dir(), objects are listed one property per line.
+  std::u16string formatDir(const ScriptArguments &arguments);
+  // console.table(), rows are the own enumerable properties of data, columns those of the rows limited to filter.
+  std::u16string formatTable(const ScriptValue &data, const ScriptValue &filter);
+
+private:
+  struct Property {
+    std::u16string name;
+    // The name to look the property up with.
+    std::string key;
+  };
+
+  std::u16string formatValue(const ScriptValue &value);
+  void inspect(const ScriptValue &value, bool within, int depth, std::u16string &output);
+  void inspectObject(const ScriptValue &object, bool within, int depth, std::u16string &output);
+  void inspectElement(const ScriptValue &element, std::u16string &output);
+  void inspectList(const ScriptValue &list, const std::u16string &kind, int depth, std::u16string &output);
+  void dir(const ScriptValue &value, int limit, std::u16string &output);
+  void interpolate(char16_t specifier, const ScriptValue &value, std::u16string &output);
+
+  std::u16string toString(const ScriptValue &value);
+  std::u16string toString(double number);
+  std::u16string getKind(const ScriptValue &object);
+  // Exceptions thrown by getters and functions are ignored, an empty value is returned instead.
+  ScriptValue getProperty(const ScriptValue &object, const std::string &name);
+  ScriptValue getIndex(const ScriptValue &object, uint32_t index);
+  ScriptValue callGlobalFunction(const ScriptValue &function, const ScriptValue &argument);
+  // Own property names, including non-enumerable ones unless enumerableOnly.
+  std::vector<Property> getOwnProperties(const ScriptValue &object, bool enumerableOnly = false);
+  size_t getLength(const ScriptValue &object);
+  bool isVisiting(const ScriptValue &object);
+
+  ScriptContext *context;
+  ScriptValue m_objectToString;
+  ScriptValue m_getOwnPropertyNames;
+  ScriptValue m_objectKeys;
+  ScriptValue m_arrayFrom;
+  ScriptValue m_string;
+  // Objects being formatted, from the outermost one.
+  std::vector<ScriptValue> m_visiting;
+};
+
+inline bool isFormatSpecifier(char16_t c) {
+  return c == 's' || c == 'd' || c == 'i' || c == 'f' || c == 'o' || c == 'O' || c == 'c';
+}
+
+inline bool isDigit(char16_t c) {
+  return c >= '0' && c <= '9';
+}
+
+inline bool isWhitespace(char16_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v' || c == 0xA0 || c == 0xFEFF;
+}
+
+// The integer prefix which parseInt(string, 10) reads, empty when there is none.
+std::string parseIntLiteral(const std::u16string &string) {
+  size_t i = 0;
+  while (i < string.size() && isWhitespace(string[i])) i++;
+  std::string literal;
+  if (i < string.size() && (string[i] == '+' || string[i] == '-')) literal.push_back(static_cast<char>(string[i++]));
+  size_t start = i;
+  while (i < string.size() && isDigit(string[i])) literal.push_back(static_cast<char>(string[i++]));
+  return i == start ? "" : literal;
+}
+
+// The decimal literal prefix which parseFloat(string) reads, empty when there is none.
+std::string parseFloatLiteral(const std::u16string &string) {
+  size_t i = 0;
+  while (i < string.size() && isWhitespace(string[i])) i++;
+  size_t start = i;
+  if (i < string.size() && (string[i] == '+' || string[i] == '-')) i++;
+  if (string.compare(i, 8, u"Infinity") == 0) return string[start] == '-' ? "-inf" : "inf";
+
+  size_t digits = 0;
+  while (i < string.size() && isDigit(string[i])) i++, digits++;
+  if (i < string.size() && string[i] == '.') {
+    i++;
+    while (i < string.size() && isDigit(string[i])) i++, digits++;
+  }
+  if (digits == 0) return "";
+
+  size_t end = i;
+  if (i < string.size() && (string[i] == 'e' || string[i] == 'E')) {
+    i++;
+    if (i < string.size() && (string[i] == '+' || string[i] == '-')) i++;
+    if (i < string.size() && isDigit(string[i])) {
+      while (i < string.size() && isDigit(string[i])) i++;
+      end = i;
+    }
+  }
+
+  std::string literal;
+  for (size_t k = start; k < end; k++) literal.push_back(static_cast<char>(string[k]));
+  return literal;
+}
+
+ConsoleFormatter::ConsoleFormatter(ScriptContext *context) : context(context) {
+  ScriptValue global = globalObject(context);
+  auto getObject = [this](const ScriptValue &object, const char *name) -> ScriptValue {
+    if (!object.isObject()) return ScriptValue();
+    ScriptValue value = getProperty(object, name);
+    return value.isObject() ? value : ScriptValue();
+  };
+
+  ScriptValue objectConstructor = getObject(global, "Object");
+  m_objectToString = getObject(getObject(objectConstructor, "prototype"), "toString");
+  m_getOwnPropertyNames = getObject(objectConstructor, "getOwnPropertyNames");
+  m_objectKeys = getObject(objectConstructor, "keys");
+  m_arrayFrom = getObject(getObject(global, "Array"), "from");
+  m_string = getObject(global, "String");
+}
+
+std::u16string ConsoleFormatter::formatLog(const ScriptArguments &arguments, size_t begin) {
+  std::u16string output;
+  size_t index = begin;
+
+  if (arguments.size() > begin && arguments[begin].isString()) {
+    std::u16string format = toString(arguments[begin]);
+    bool hasSpecifier = false;
+    for (size_t i = 0; i + 1 < format.size(); i++) {
+      if (format[i] == '%' && isFormatSpecifier(format[i + 1])) {
+        hasSpecifier = true;
+        break;
+      }
+    }
+
+    if (hasSpecifier) {
+      index = begin + 1;
+      for (size_t i = 0; i < format.size(); i++) {
+        // Specifiers without a matching argument are kept as is.
+        if (format[i] == '%' && i + 1 < format.size() && isFormatSpecifier(format[i + 1]) &&
+            index < arguments.size()) {
+          interpolate(format[++i], arguments[index++], output);
+        } else {
+          output.push_back(format[i]);
+        }
+      }
+    }
+  }
+
+  if (index > begin && index < arguments.size()) output.push_back(' ');
+  output.append(formatValues(arguments, index));
+  return output;
+}
+
+std::u16string ConsoleFormatter::formatValues(const ScriptArguments &arguments, size_t begin) {
+  std::u16string output;
+  for (size_t i = begin; i < arguments.size(); i++) {
+    if (i > begin) output.push_back(' ');
+    inspect(arguments[i], false, 0, output);
+  }
+  return output;
+}
+
+std::u16string ConsoleFormatter::formatValue(const ScriptValue &value) {
+  std::u16string output;
+  inspect(value, false, 0, output);
+  return output;
+}
+
+std::u16string ConsoleFormatter::formatDir(const ScriptArguments &arguments) {
+  std::u16string output;
+  for (size_t i = 0; i < arguments.size(); i++) {
+    if (i > 0) output.push_back(' ');
+    dir(arguments[i], kDirDepth, output);
+  }
+  return output;
+}
+
+std::u16string ConsoleFormatter::formatTable(const ScriptValue &data, const ScriptValue &filter) {
+  if (!data.isObject()) return formatValue(data);
+
+  static const std::u16string indexColumn = u"(index)";
+  static const std::u16string valueColumn = u"(value)";
+  // Rows which are neither objects nor arrays go to the value column.
+  auto isRecord = [](const ScriptValue &value) { return value.isObject() && !value.isFunction(); };
+
+  std::vector<std::u16string> filterColumns;
+  if (filter.isArray()) {
+    size_t count = getLength(filter);
+    for (size_t i = 0; i < count; i++) {
+      filterColumns.emplace_back(toString(getIndex(filter, i)));
+    }
+  }
+
+  std::vector<Property> keys = getOwnProperties(data, true);
+  std::vector<ScriptValue> rows;
+  std::vector<std::u16string> columns{indexColumn};
+  bool hasValueColumn = false;
+
+  rows.reserve(keys.size());
+  for (auto &key : keys) {
+    ScriptValue row = getProperty(data, key.key);
+    if (row.empty()) row = ScriptValue::undefined(context);
+    rows.emplace_back(row);
+
+    if (!isRecord(row)) {
+      hasValueColumn = true;
+      continue;
+    }
+    for (auto &rowKey : getOwnProperties(row, true)) {
+      if (std::find(columns.begin() + 1, columns.end(), rowKey.name) != columns.end()) continue;
+      if (!filterColumns.empty() &&
+          std::find(filterColumns.begin(), filterColumns.end(), rowKey.name) == filterColumns.end())
+        continue;
+      columns.emplace_back(rowKey.name);
+    }
+  }
+  if (hasValueColumn) columns.emplace_back(valueColumn);
+
+  std::vector<std::vector<std::u16string>> cells(rows.size(), std::vector<std::u16string>(columns.size()));
+  std::vector<size_t> widths(columns.size());
+  for (size_t column = 0; column < columns.size(); column++) {
+    widths[column] = columns[column].size();
+    std::string columnKey;
+    foundation::encodeUTF8(columns[column].data(), columns[column].size(), columnKey);
+    for (size_t row = 0; row < rows.size(); row++) {
+      std::u16string &cell = cells[row][column];
+      if (column == 0) {
+        cell = keys[row].name;
+      } else {
+        ScriptValue value;
+        if (rows[row].isObject()) value = getProperty(rows[row], columnKey);
+
+        if (!value.empty() && !value.isUndefined()) {
+          cell = formatValue(value);
+        } else if (columns[column] == valueColumn && !isRecord(rows[row])) {
+          cell = formatValue(rows[row]);
+        } else {
+          cell = u" ";
+        }
+      }
+      widths[column] = std::max(widths[column], cell.size());
+    }
+  }
+
+  // Cells are padded to the width of their column, in UTF-16 code units the same as String.length.
+  auto joinRow = [&widths](const std::vector<std::u16string> &row, char16_t space, char16_t separator) {
+    std::u16string line;
+    for (size_t i = 0; i < row.size(); i++) {
+      if (i > 0) {
+        line.push_back(space);
+        line.push_back(separator);
+        line.push_back(space);
+      }
+      line.append(row[i]);
+      line.append(widths[i] - row[i].size(), u' ');
+    }
+    return line;
+  };
+
+  std::vector<std::u16string> separators;
+  for (size_t width : widths) {
+    separators.emplace_back(width, u'─');
+  }
+
+  std::u16string border = joinRow(separators, u'─', u'─');
+  std::u16string output = border;
+  output.push_back('\n');
+  output.append(joinRow(columns, u' ', u'│'));
+  output.push_back('\n');
+  output.append(joinRow(separators, u'─', u'│'));
+  for (auto &row : cells) {
+    output.push_back('\n');
+    output.append(joinRow(row, u' ', u'│'));
+  }
+  output.push_back('\n');
+  output.append(border);
+  return output;
+}
+
+void ConsoleFormatter::interpolate(char16_t specifier, const ScriptValue &value, std::u16string &output) {
+  switch (specifier) {
+  case 'd':
+  case 'i':
+  case 'f': {
+    std::u16string string = toString(value);
+    std::string literal = specifier == 'f' ? parseFloatLiteral(string) : parseIntLiteral(string);
+    if (literal.empty()) {
+      output.append(u"NaN");
+    } else {
+      output.append(toString(std::strtod(literal.c_str(), nullptr)));
+    }
+    break;
+  }
+  case 'c':
+    // CSS can't be applied to native logs.
+    break;
+  default:
+    inspect(value, false, 0, output);
+  }
+}
+
+void ConsoleFormatter::inspect(const ScriptValue &value, bool within, int depth, std::u16string &output) {
+  if (value.isUndefined()) {
+    output.append(u"undefined");
+  } else if (value.isNull()) {
+    output.append(u"null");
+  } else if (value.isString()) {
+    if (within) output.push_back('\'');
+    output.append(toString(value));
+    if (within) output.push_back('\'');
+  } else if (value.isObject()) {
+    inspectObject(value, within, depth, output);
+  } else {
+    output.append(toString(value));
+  }
+}
+
+void ConsoleFormatter::inspectObject(const ScriptValue &object, bool within, int depth, std::u16string &output) {
+  ScriptValue nodeType = getProperty(object, "nodeType");
+  if (nodeType.isNumber() && nodeType.toNumber() == 1) {
+    inspectElement(object, output);
+    return;
+  }
+
+  std::u16string kind = getKind(object);
+  if (kind == u"Function") {
+    output.append(u"ƒ ()");
+  } else if (kind == u"Number" || kind == u"Boolean" || kind == u"Date" || kind == u"RegExp") {
+    output.append(toString(object));
+  } else if (kind == u"String") {
+    if (within) output.push_back('\'');
+    output.append(toString(object));
+    if (within) output.push_back('\'');
+  } else if (kind == u"Array" || kind == u"Map" || kind == u"Set") {
+    inspectList(object, kind, depth, output);
+  } else if (object.isFunction()) {
+    // Such as async functions, which print their source.
+    output.append(toString(object));
+  } else {
+    if (kind != u"Object") {
+      output.append(kind);
+      output.push_back(' ');
+    }
+    if (within) {
+      output.append(u"{...}");
+      return;
+    }
+
+    std::vector<Property> properties = getOwnProperties(object);
+    std::sort(properties.begin(), properties.end(),
+              [](const Property &a, const Property &b) { return a.name < b.name; });
+    output.push_back('{');
+    size_t count = 0;
+    for (auto &property : properties) {
+      if (count == kMaxLength) {
+        output.append(u", ... ");
+        output.append(toString(properties.size() - kMaxLength));
+        output.append(u" more properties");
+        break;
+      }
+      ScriptValue value = getProperty(object, property.key);
+      // Properties whose getter throws are skipped.
+      if (value.empty()) continue;
+      if (count++ > 0) output.append(u", ");
+      output.append(property.name);
+      output.append(u": ");
+      inspect(value, true, depth + 1, output);
+    }
+    output.push_back('}');
+  }
+}
+
+void ConsoleFormatter::inspectElement(const ScriptValue &element, std::u16string &output) {
+  output.push_back('<');
+  ScriptValue tagName = getProperty(element, "tagName");
+  if (!tagName.empty()) {
+    for (char16_t c : toString(tagName)) {
+      output.push_back(c >= 'A' && c <= 'Z' ? static_cast<char16_t>(c - 'A' + 'a') : c);
+    }
+  }
+
+  ScriptValue childNodes = getProperty(element, "childNodes");
+  if (childNodes.isObject()) {
+    ScriptValue length = getProperty(childNodes, "length");
+    if (length.isNumber() && length.toNumber() == 0) {
+      output.push_back('/');
+    }
+  }
+  output.push_back('>');
+}
+
+void ConsoleFormatter::inspectList(const ScriptValue &list, const std::u16string &kind, int depth,
+                                   std::u16string &output) {
+  bool isArray = kind == u"Array";
+  bool isMap = kind == u"Map";
+  if (!isArray) {
+    output.append(kind);
+    output.append(isMap ? u" {" : u" { ");
+  } else {
+    output.push_back('[');
+  }
+  const char16_t *close = isArray ? u"]" : u"}";
+
+  if (isVisiting(list)) {
+    output.append(u"Circular");
+    output.append(close);
+    return;
+  }
+  if (depth >= kMaxDepth) {
+    output.append(u"...");
+    output.append(close);
+    return;
+  }
+
+  ScriptValue items = isArray ? list : callGlobalFunction(m_arrayFrom, list);
+  size_t length = items.isObject() ? getLength(items) : 0;
+
+  m_visiting.emplace_back(list);
+  for (size_t i = 0; i < length; i++) {
+    if (i == kMaxLength) {
+      output.append(u", ... ");
+      output.append(toString(length - kMaxLength));
+      output.append(u" more items");
+      break;
+    }
+    if (i > 0) output.append(u", ");
+
+    ScriptValue item = getIndex(items, i);
+    if (item.empty()) continue;
+
+    if (isMap) {
+      if (!item.isObject()) continue;
+      output.append(toString(getIndex(item, 0)));
+      output.append(u" => ");
+      ScriptValue value = getIndex(item, 1);
+      inspect(value.empty() ? ScriptValue::undefined(context) : value, true, depth + 1, output);
+    } else if (isArray && item.isUndefined() && !items.hasProperty(std::to_string(i))) {
+      // Holes of a sparse array are left empty.
+      continue;
+    } else {
+      inspect(item, true, depth + 1, output);
+    }
+  }
+  m_visiting.pop_back();
+  output.append(close);
+}
+
+void ConsoleFormatter::dir(const ScriptValue &value, int limit, std::u16string &output) {
+  if (value.isString()) {
+    output.push_back('\'');
+    output.append(toString(value));
+    output.push_back('\'');
+    return;
+  }
+  if (value.isNull()) {
+    output.append(u"null");
+    return;
+  }
+  if (!value.isObject()) {
+    output.append(toString(value));
+    return;
+  }
+
+  std::u16string kind = getKind(value);
+  if (kind != u"Object") {
+    output.append(kind);
+    output.push_back(' ');
+  }
+  if (limit == 0) {
+    output.append(u"{...}");
+    return;
+  }
+  if (isVisiting(value)) {
+    // Replaces the whole prefix, as the polyfill did.
+    output.resize(output.size() - (kind != u"Object" ? kind.size() + 1 : 0));
+    output.push_back('#');
+    return;
+  }
+
+  m_visiting.emplace_back(value);
+  std::u16string indent;
+  for (size_t i = 0; i < m_visiting.size(); i++) indent.append(u"  ");
+
+  std::vector<Property> properties = getOwnProperties(value);
+  output.push_back('{');
+  for (size_t i = 0; i < properties.size(); i++) {
+    if (i > 0) output.append(u", ");
+    output.push_back('\n');
+    output.append(indent);
+    if (i == kMaxLength) {
+      output.append(u"... ");
+      output.append(toString(properties.size() - kMaxLength));
+      output.append(u" more properties");
+      break;
+    }
+    output.append(properties[i].name);
+    output.append(u": ");
+    ScriptValue propertyValue = getProperty(value, properties[i].key);
+    dir(propertyValue.empty() ? ScriptValue::undefined(context) : propertyValue, limit - 1, output);
+  }
+  if (!properties.empty()) {
+    output.push_back('\n');
+    output.append(indent, 0, indent.size() - 2);
+  }
+  output.push_back('}');
+  m_visiting.pop_back();
+}
+
+std::u16string ConsoleFormatter::toString(const ScriptValue &value) {
+  if (value.isSymbol()) {
+    // Symbols can't be converted implicitly, String() gives their description.
+    ScriptValue described = callGlobalFunction(m_string, value);
+    return described.isString() ? described.toU16String() : u"";
+  }
+  return value.toU16String();
+}
+
+std::u16string ConsoleFormatter::toString(double number) {
+  return ScriptValue::makeNumber(context, number).toU16String();
+}
+
+std::u16string ConsoleFormatter::getKind(const ScriptValue &object) {
+  if (m_objectToString.empty()) return u"Object";
+  ScriptValue exception;
+  ScriptValue tag = m_objectToString.call(object, {}, &exception);
+  if (tag.empty()) return u"Object";
+  // "[object Kind]"
+  std::u16string string = toString(tag);
+  if (string.size() < 9) return u"Object";
+  return string.substr(8, string.size() - 9);
+}
+
+ScriptValue ConsoleFormatter::getProperty(const ScriptValue &object, const std::string &name) {
+  ScriptValue exception;
+  return object.getProperty(name, &exception);
+}
+
+ScriptValue ConsoleFormatter::getIndex(const ScriptValue &object, uint32_t index) {
+  ScriptValue exception;
+  return object.getIndex(index, &exception);
+}
+
+ScriptValue ConsoleFormatter::callGlobalFunction(const ScriptValue &function, const ScriptValue &argument) {
+  if (function.empty()) return ScriptValue();
+  ScriptValue exception;
+  return function.call(ScriptValue::undefined(context), {argument}, &exception);
+}
+
+std::vector<ConsoleFormatter::Property> ConsoleFormatter::getOwnProperties(const ScriptValue &object,
+                                                                           bool enumerableOnly) {
+  std::vector<Property> properties;
+  ScriptValue names = callGlobalFunction(enumerableOnly ? m_objectKeys : m_getOwnPropertyNames, object);
+  if (!names.isObject()) return properties;
+
+  size_t count = getLength(names);
+  properties.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    ScriptValue name = getIndex(names, i);
+    if (!name.isString()) continue;
+    properties.push_back({name.toU16String(), name.toString()});
+  }
+  return properties;
+}
+
+size_t ConsoleFormatter::getLength(const ScriptValue &object) {
+  ScriptValue length = getProperty(object, "length");
+  return length.isNumber() ? static_cast<size_t>(length.toNumber()) : 0;
+}
+
+bool ConsoleFormatter::isVisiting(const ScriptValue &object) {
+  return std::any_of(m_visiting.begin(), m_visiting.end(),
+                     [&object](const ScriptValue &visiting) { return visiting.strictEquals(object); });
+}
+
+// The label of console.time() and console.count(), https://console.spec.whatwg.org/#timing.
+std::u16string getLabel(const ScriptArguments &arguments) {
+  if (arguments.size() == 0 || arguments[0].isUndefined()) return u"default";
+  return arguments[0].toU16String();
+}
+
+// Milliseconds with up to 3 fractional digits and no trailing zeros, "12.5ms".
+std::u16string formatMilliseconds(int64_t microseconds) {
+  if (microseconds < 0) microseconds = 0;
+  std::string result = std::to_string(microseconds / 1000);
+  std::string fraction = std::to_string(1000 + microseconds % 1000).substr(1);
+  while (!fraction.empty() && fraction.back() == '0') fraction.pop_back();
+  if (!fraction.empty()) result += "." + fraction;
+  result += "ms";
+  return std::u16string(result.begin(), result.end());
+}
+
+ScriptValue print(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments, void *data,
+                  ScriptValue *exception) {
+  std::string logLevel = "log";
+  if (arguments.size() > 1 && arguments[1].isString()) {
+    logLevel = arguments[1].toString();
+  }
+
+  // Skip converting messages which won't be logged.
+  NativeConsole *console = NativeConsole::instance(context);
+  if (!console->isPrinted(logLevel)) {
+    return ScriptValue();
+  }
+
+  if (!arguments[0].isString()) {
+    KRAKEN_LOG(ERROR) << "Failed to execute 'print': log must be string.";
+    return ScriptValue();
+  }
+
+  console->print(arguments[0].toU16String(), logLevel);
+  return ScriptValue();
+}
+
+ScriptValue formatLog(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                      void *data, ScriptValue *exception) {
+  ConsoleFormatter formatter(context);
+  return ScriptValue::makeString(context, formatter.formatLog(arguments));
+}
+
+ScriptValue formatDir(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                      void *data, ScriptValue *exception) {
+  ConsoleFormatter formatter(context);
+  return ScriptValue::makeString(context, formatter.formatDir(arguments));
+}
+
+} // namespace
+
+////////////////
+
+std::unordered_map<int32_t, NativeConsole *> NativeConsole::instanceMap{};
+NativeConsole *NativeConsole::instance(ScriptContext *context) {
+  int32_t uniqueId = context->uniqueId;
+  if (instanceMap.count(uniqueId) == 0) {
+    instanceMap[uniqueId] = new NativeConsole(context);
+  }
+
+  return instanceMap[uniqueId];
+}
+
+void NativeConsole::disposeInstance(int32_t uniqueId) {
+  auto it = instanceMap.find(uniqueId);
+  if (it == instanceMap.end()) return;
+  delete it->second;
+  instanceMap.erase(it);
+}
+
+bool NativeConsole::isPrinted(const std::string &level) const {
+  return m_capturing || foundation::shouldLog(foundation::getConsoleLogSeverity(level));
+}
+
+void NativeConsole::print(const std::u16string &message, const std::string &level) {
+  if (!isPrinted(level)) return;
+
+  std::u16string indented;
+  if (m_groupLevel > 0) {
+    std::u16string indent(m_groupLevel * 2, u' ');
+    indented.reserve(indent.size() + message.size());
+    indented.append(indent);
+    for (char16_t c : message) {
+      indented.push_back(c);
+      if (c == '\n') indented.append(indent);
+    }
+  }
+  const std::u16string &output = m_groupLevel > 0 ? indented : message;
+
+  if (m_capturing) {
+    m_captured.emplace_back(level, output);
+    return;
+  }
+
+  std::string utf8;
+  foundation::encodeUTF8(output.data(), output.size(), utf8);
+  std::stringstream stream;
+  stream << utf8;
+  foundation::printLog(stream, level);
+}
+
+bool NativeConsole::startTimer(const std::u16string &label) {
+  return m_timers.emplace(label, m_context->getClock()->nowMicroseconds()).second;
+}
+
+bool NativeConsole::elapsed(const std::u16string &label, int64_t &microseconds) {
+  auto it = m_timers.find(label);
+  if (it == m_timers.end()) return false;
+  microseconds = m_context->getClock()->nowMicroseconds() - it->second;
+  return true;
+}
+
+bool NativeConsole::endTimer(const std::u16string &label, int64_t &microseconds) {
+  if (!elapsed(label, microseconds)) return false;
+  m_timers.erase(label);
+  return true;
+}
+
+uint32_t NativeConsole::count(const std::u16string &label) {
+  return ++m_counts[label];
+}
+
+bool NativeConsole::resetCount(const std::u16string &label) {
+  auto it = m_counts.find(label);
+  if (it == m_counts.end()) return false;
+  it->second = 0;
+  return true;
+}
+
+void NativeConsole::beginGroup() {
+  m_groupLevel++;
+}
+
+void NativeConsole::endGroup() {
+  if (m_groupLevel > 0) m_groupLevel--;
+}
+
+void NativeConsole::startCapture() {
+  m_captured.clear();
+  m_capturing = true;
+}
+
+std::vector<std::pair<std::string, std::u16string>> NativeConsole::stopCapture() {
+  m_capturing = false;
+  return std::move(m_captured);
+}
+
+ScriptValue JSConsole::time(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  std::u16string label = getLabel(arguments);
+
+  if (!console->startTimer(label)) {
+    console->print(u"Timer '" + label + u"' already exists", "warn");
+  }
+  return ScriptValue();
+}
+
+ScriptValue JSConsole::timeLog(ScriptContext *context, const ScriptValue &thisObject,
+                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  std::u16string label = getLabel(arguments);
+
+  int64_t microseconds;
+  if (!console->elapsed(label, microseconds)) {
+    console->print(u"Timer '" + label + u"' does not exist", "warn");
+    return ScriptValue();
+  }
+  if (!console->isPrinted("log")) return ScriptValue();
+
+  // The data after label is printed as is, it is not a format string.
+  std::u16string message = label + u": " + formatMilliseconds(microseconds);
+  if (arguments.size() > 1) {
+    ConsoleFormatter formatter(context);
+    message.push_back(' ');
+    message.append(formatter.formatValues(arguments, 1));
+  }
+  console->print(message, "log");
+  return ScriptValue();
+}
+
+ScriptValue JSConsole::timeEnd(ScriptContext *context, const ScriptValue &thisObject,
+                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  std::u16string label = getLabel(arguments);
+
+  int64_t microseconds;
+  if (!console->endTimer(label, microseconds)) {
+    console->print(u"Timer '" + label + u"' does not exist", "warn");
+    return ScriptValue();
+  }
+  console->print(label + u": " + formatMilliseconds(microseconds), "info");
+  return ScriptValue();
+}
+
+ScriptValue JSConsole::count(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  std::u16string label = getLabel(arguments);
+
+  std::string count = std::to_string(console->count(label));
+  console->print(label + u": " + std::u16string(count.begin(), count.end()), "info");
+  return ScriptValue();
+}
+
+ScriptValue JSConsole::countReset(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  std::u16string label = getLabel(arguments);
+
+  if (!console->resetCount(label)) {
+    console->print(u"Count for '" + label + u"' does not exist", "warn");
+  }
+  return ScriptValue();
+}
+
+ScriptValue JSConsole::group(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  // The group label is printed at the outer level.
+  if (arguments.size() > 0 && console->isPrinted("log")) {
+    ConsoleFormatter formatter(context);
+    console->print(formatter.formatLog(arguments), "log");
+  }
+  console->beginGroup();
+  return ScriptValue();
+}
+
+ScriptValue JSConsole::groupCollapsed(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  // Logs are plain text, there is nothing to collapse.
+  return group(context, thisObject, arguments, data, exception);
+}
+
+ScriptValue JSConsole::groupEnd(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  console->endGroup();
+  return ScriptValue();
+}
+
+ScriptValue JSConsole::table(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception) {
+  auto console = static_cast<JSConsole *>(data)->nativeConsole;
+  if (!console->isPrinted("log")) return ScriptValue();
+
+  ConsoleFormatter formatter(context);
+  console->print(formatter.formatTable(arguments[0], arguments[1]), "log");
+  return ScriptValue();
+}
+
+void bindConsole(ScriptContext *context) {
+  bindGlobalValue(context, "__kraken_print__", ScriptValue::makeFunction(context, "__kraken_print__", print, nullptr));
+  bindGlobalValue(context, "__kraken_format_log__",
+                  ScriptValue::makeFunction(context, "__kraken_format_log__", formatLog, nullptr));
+  bindGlobalValue(context, "__kraken_format_dir__",
+                  ScriptValue::makeFunction(context, "__kraken_format_dir__", formatDir, nullptr));
+
+  auto console = new JSConsole(context, NativeConsole::instance(context));
+  bindGlobalValue(context, "__kraken_console__", console->value());
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_CONSOLE_H
+#define KRAKENBRIDGE_SCRIPT_CONSOLE_H
+
+#include "bindings/script/host_object.h"
+#include "foundation/logging.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace kraken::binding {
+
+void bindConsole(ScriptContext *context);
+
+// Timers, counters and the group indentation of a context, https://console.spec.whatwg.org/#timing. Timers read the
+// monotonic clock of the context and are kept in microseconds.
+class NativeConsole {
+public:
+  static std::unordered_map<int32_t, NativeConsole *> instanceMap;
+  static NativeConsole *instance(ScriptContext *context);
+  static void disposeInstance(int32_t uniqueId);
+
+  explicit NativeConsole(ScriptContext *context) : m_context(context){};
+
+  // Whether messages of level are logged, checked before formatting them.
+  bool isPrinted(const std::string &level) const;
+  // Print message at level, every line of it is indented by the current group.
+  void print(const std::u16string &message, const std::string &level);
+
+  // Returns false when a timer of label already exists.
+  bool startTimer(const std::u16string &label);
+  // Microseconds since the timer of label started, returns false when it doesn't exist.
+  bool elapsed(const std::u16string &label, int64_t &microseconds);
+  // Same as elapsed() and removes the timer.
+  bool endTimer(const std::u16string &label, int64_t &microseconds);
+
+  uint32_t count(const std::u16string &label);
+  // Returns false when label wasn't counted.
+  bool resetCount(const std::u16string &label);
+
+  void beginGroup();
+  void endGroup();
+
+  // Messages printed while capturing are kept with their level instead of logged, tests read them back.
+  void startCapture();
+  std::vector<std::pair<std::string, std::u16string>> stopCapture();
+
+private:
+  ScriptContext *m_context;
+  std::unordered_map<std::u16string, int64_t> m_timers;
+  std::unordered_map<std::u16string, uint32_t> m_counts;
+  size_t m_groupLevel{0};
+  bool m_capturing{false};
+  std::vector<std::pair<std::string, std::u16string>> m_captured;
+};
+
+// The parts of console kept natively, the polyfill forwards to them.
+class JSConsole : public HostObject {
+public:
+  static ScriptValue time(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue timeLog(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+  static ScriptValue timeEnd(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+  static ScriptValue count(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue countReset(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue group(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue groupCollapsed(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue groupEnd(ScriptContext *context, const ScriptValue &thisObject,
+                              const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue table(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+
+  JSConsole(ScriptContext *context, NativeConsole *nativeConsole)
+    : HostObject(context, "Console"), nativeConsole(nativeConsole) {}
+
+  NativeConsole *nativeConsole;
+
+private:
+  FunctionHolder m_time{context, value(), this, "time", time};
+  FunctionHolder m_timeLog{context, value(), this, "timeLog", timeLog};
+  FunctionHolder m_timeEnd{context, value(), this, "timeEnd", timeEnd};
+  FunctionHolder m_count{context, value(), this, "count", count};
+  FunctionHolder m_countReset{context, value(), this, "countReset", countReset};
+  FunctionHolder m_group{context, value(), this, "group", group};
+  FunctionHolder m_groupCollapsed{context, value(), this, "groupCollapsed", groupCollapsed};
+  FunctionHolder m_groupEnd{context, value(), this, "groupEnd", groupEnd};
+  FunctionHolder m_table{context, value(), this, "table", table};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_CONSOLE_H
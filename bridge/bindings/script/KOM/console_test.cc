@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/KOM/console.h"
+#include "foundation/monotonic_clock.h"
+#include "test/bridge_fixture.h"
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace kraken::binding;
+
+namespace {
+
+using Messages = std::vector<std::pair<std::string, std::u16string>>;
+
+// Messages printed by the console of a context, with the clock of the context frozen by setTime().
+class ConsoleTest : public kraken::test::BridgeFixture {
+protected:
+  void SetUp() override {
+    BridgeFixture::SetUp();
+    console = NativeConsole::instance(context());
+    console->startCapture();
+  }
+
+  void TearDown() override {
+    console->stopCapture();
+    BridgeFixture::TearDown();
+  }
+
+  // Freeze the context clock at the given milliseconds since time origin.
+  void setTime(double milliseconds) {
+    auto clock = context()->getClock();
+    auto time = std::chrono::microseconds(std::llround(milliseconds * 1000));
+    auto timeOrigin = clock->timeOrigin();
+    clock->setTimeSource([timeOrigin, time]() { return timeOrigin + time; });
+  }
+
+  Messages messages() {
+    Messages captured = console->stopCapture();
+    console->startCapture();
+    return captured;
+  }
+
+  std::vector<std::u16string> texts() {
+    std::vector<std::u16string> result;
+    for (auto &message : messages()) result.emplace_back(message.second);
+    return result;
+  }
+
+  NativeConsole *console;
+};
+
+} // namespace
+
+TEST_F(ConsoleTest, timePrintsTheElapsedMillisecondsOfTheMonotonicClock) {
+  setTime(10);
+  evaluate(u"console.time('load');");
+  setTime(22.5);
+  evaluate(u"console.timeLog('load');");
+  setTime(1244.567);
+  evaluate(u"console.timeEnd('load');");
+  EXPECT_EQ(messages(), Messages({{"log", u"load: 12.5ms"}, {"info", u"load: 1234.567ms"}}));
+}
+
+TEST_F(ConsoleTest, timeUsesTheDefaultLabel) {
+  setTime(0);
+  evaluate(u"console.time();");
+  setTime(3);
+  evaluate(u"console.timeEnd();");
+  EXPECT_EQ(messages(), Messages({{"info", u"default: 3ms"}}));
+}
+
+TEST_F(ConsoleTest, timeLogPrintsItsDataAsIs) {
+  setTime(0);
+  evaluate(u"console.time('parse');"
+           u"console.timeLog('parse', '%s', {bytes: 1}, [1, 2]);"
+           u"console.timeEnd('parse');");
+  EXPECT_EQ(messages()[0], Messages::value_type("log", u"parse: 0ms %s {bytes: 1} [1, 2]"));
+}
+
+TEST_F(ConsoleTest, timeWarnsAboutMissingAndExistingTimers) {
+  evaluate(u"console.timeLog('missing');"
+           u"console.timeEnd('missing');"
+           u"console.time('twice');"
+           u"console.time('twice');"
+           u"console.timeEnd('twice');");
+  Messages captured = messages();
+  ASSERT_EQ(captured.size(), 4);
+  EXPECT_EQ(Messages(captured.begin(), captured.begin() + 3),
+            Messages({{"warn", u"Timer 'missing' does not exist"},
+                      {"warn", u"Timer 'missing' does not exist"},
+                      {"warn", u"Timer 'twice' already exists"}}));
+}
+
+TEST_F(ConsoleTest, timeStartsAgainAfterTimeEnd) {
+  setTime(1);
+  evaluate(u"console.time('again'); console.timeEnd('again');");
+  setTime(5);
+  evaluate(u"console.time('again');");
+  setTime(7);
+  evaluate(u"console.timeEnd('again');");
+  EXPECT_EQ(texts(), std::vector<std::u16string>({u"again: 0ms", u"again: 2ms"}));
+}
+
+TEST_F(ConsoleTest, countCountsPerLabel) {
+  evaluate(u"console.count('a');"
+           u"console.count('a');"
+           u"console.count('b');"
+           u"console.count();"
+           u"console.countReset('a');"
+           u"console.count('a');"
+           u"console.countReset('never');"
+           u"console.countReset('b');"
+           u"console.countReset();");
+  EXPECT_EQ(messages(), Messages({{"info", u"a: 1"},
+                                  {"info", u"a: 2"},
+                                  {"info", u"b: 1"},
+                                  {"info", u"default: 1"},
+                                  {"info", u"a: 1"},
+                                  {"warn", u"Count for 'never' does not exist"}}));
+}
+
+TEST_F(ConsoleTest, countConvertsLabelsToStrings) {
+  evaluate(u"console.count(42); console.count('42'); console.countReset(42);");
+  EXPECT_EQ(texts(), std::vector<std::u16string>({u"42: 1", u"42: 2"}));
+}
+
+TEST_F(ConsoleTest, groupIndentsEveryLine) {
+  evaluate(u"console.group('outer', 1);"
+           u"console.log('a');"
+           u"console.groupCollapsed();"
+           u"console.warn('b\\nc');"
+           u"console.groupEnd();"
+           u"console.groupEnd();"
+           u"console.groupEnd();"
+           u"console.log('d');");
+  EXPECT_EQ(messages(),
+            Messages({{"log", u"outer 1"}, {"log", u"  a"}, {"warn", u"    b\n    c"}, {"log", u"d"}}));
+}
+
+TEST_F(ConsoleTest, groupIndentsTimersAndCounters) {
+  evaluate(u"console.group();"
+           u"console.count('nested');"
+           u"console.countReset('nested-missing');"
+           u"console.groupEnd();");
+  EXPECT_EQ(texts(), std::vector<std::u16string>({u"  nested: 1", u"  Count for 'nested-missing' does not exist"}));
+}
+
+TEST_F(ConsoleTest, tableLaysOutRowsOfObjects) {
+  evaluate(u"console.table([{a: 1, b: 'x'}, {a: 22}]);");
+  std::u16string rule(16, u'\u2500');
+  std::u16string separator = std::u16string(8, u'\u2500') + u'\u2502' + std::u16string(4, u'\u2500') + u'\u2502' +
+                             std::u16string(2, u'\u2500');
+  std::u16string table = rule + u"\n" +
+                         u"(index) \u2502 a  \u2502 b\n" +
+                         separator + u"\n" +
+                         u"0       \u2502 1  \u2502 x\n" +
+                         u"1       \u2502 22 \u2502  \n" +
+                         rule;
+  EXPECT_EQ(messages(), Messages({{"log", table}}));
+}
+
+TEST_F(ConsoleTest, tablePutsPrimitiveRowsInTheValueColumnAndFiltersColumns) {
+  evaluate(u"console.table({first: {a: 1, b: 2}, second: 3}, ['b']);");
+  Messages captured = messages();
+  ASSERT_EQ(captured.size(), 1);
+  std::vector<std::u16string> lines;
+  std::u16string &table = captured[0].second;
+  for (size_t begin = 0, end; begin <= table.size(); begin = end + 1) {
+    end = table.find(u'\n', begin);
+    if (end == std::u16string::npos) end = table.size();
+    lines.emplace_back(table.substr(begin, end - begin));
+  }
+  ASSERT_GE(lines.size(), 5);
+  EXPECT_EQ(lines[1], u"(index) \u2502 b \u2502 (value)");
+  EXPECT_EQ(lines[3], u"first   \u2502 2 \u2502        ");
+  EXPECT_EQ(lines[4], u"second  \u2502   \u2502 3      ");
+}
+
+TEST_F(ConsoleTest, tableLogsValuesWhichAreNotObjects) {
+  evaluate(u"console.table('text'); console.table(1);");
+  EXPECT_EQ(texts(), std::vector<std::u16string>({u"text", u"1"}));
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "cookie.h"
+#include "location.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+using ::foundation::URLParser;
+using ::foundation::URLRecord;
+
+namespace {
+
+bool parseURL(const std::string &input, const URLRecord *base, URLRecord &url) {
+  return URLParser::parse(::foundation::decodeUTF8(input), base, url);
+}
+
+// Relative request URLs are resolved against the document, the same as the network modules do.
+bool resolveRequestURL(const std::string &input, URLRecord &url) {
+  URLRecord document;
+  bool hasBase = parseURL(getLocationHref(), nullptr, document);
+  return parseURL(input, hasBase ? &document : nullptr, url);
+}
+
+bool shouldIncludeCredentials(const URLRecord &url, bool withCredentials) {
+  if (withCredentials) return true;
+  URLRecord document;
+  if (!parseURL(getLocationHref(), nullptr, document)) return false;
+  std::string origin = document.origin();
+  return origin != "null" && origin == url.origin();
+}
+
+FetchCredentials parseFetchCredentials(const ScriptValue &init, ScriptValue *exception) {
+  ScriptValue credentials = init.getProperty("credentials", exception);
+  if (!credentials.isString()) return FetchCredentials::sameOrigin;
+  std::string value = credentials.toString();
+  if (value == "omit") return FetchCredentials::omit;
+  if (value == "include") return FetchCredentials::include;
+  return FetchCredentials::sameOrigin;
+}
+
+// Headers lowercases names, but kraken.invokeModule is open to the page, so a Cookie header of any case is removed.
+void removeCookieHeader(const ScriptValue &headers, ScriptValue *exception) {
+  for (auto &name : headers.keys(exception)) {
+    std::string header = name;
+    std::transform(header.begin(), header.end(), header.begin(), ::tolower);
+    if (header == "cookie") headers.deleteProperty(name, exception);
+  }
+}
+
+// JSON of value, or an empty string when it has none.
+std::u16string stringifyJSON(const ScriptValue &value, ScriptValue *exception) {
+  ScriptValue json = value.toJSON(exception);
+  return json.isString() ? json.toU16String() : u"";
+}
+
+} // namespace
+
+URLRecord getDocumentCookieURL() {
+  URLRecord url;
+  if (!parseURL(getLocationHref(), nullptr, url)) return URLRecord();
+  return url;
+}
+
+std::string getRequestCookies(ScriptContext *context, const std::string &url, bool withCredentials) {
+  URLRecord requestURL;
+  if (!resolveRequestURL(url, requestURL) || !shouldIncludeCredentials(requestURL, withCredentials)) return "";
+  return context->getCookieJar()->getCookies(requestURL, true);
+}
+
+void storeResponseCookies(ScriptContext *context, const std::string &url, bool withCredentials,
+                          const std::vector<std::string> &setCookies) {
+  URLRecord responseURL;
+  if (!resolveRequestURL(url, responseURL) || !shouldIncludeCredentials(responseURL, withCredentials)) return;
+  for (auto &setCookie : setCookies) {
+    context->getCookieJar()->setCookie(responseURL, setCookie, true);
+  }
+}
+
+std::u16string attachFetchCookies(ScriptContext *context, const std::string &url, const std::u16string &params,
+                                  FetchCredentials *credentials) {
+  ScriptValue exception;
+  ScriptValue init = params.empty() ? ScriptValue() : ScriptValue::parseJSON(context, params);
+  if (!init.isObject()) init = ScriptValue::makeObject(context);
+  *credentials = parseFetchCredentials(init, &exception);
+
+  ScriptValue headers = init.getProperty("headers", &exception);
+  if (headers.isObject()) {
+    removeCookieHeader(headers, &exception);
+  } else {
+    headers = ScriptValue::makeObject(context);
+    init.setProperty("headers", headers, &exception);
+  }
+
+  if (*credentials != FetchCredentials::omit) {
+    std::string cookies = getRequestCookies(context, url, *credentials == FetchCredentials::include);
+    if (!cookies.empty()) {
+      headers.setProperty("cookie", ScriptValue::makeString(context, cookies), &exception);
+    }
+  }
+
+  return stringifyJSON(init, &exception);
+}
+
+std::u16string storeFetchCookies(ScriptContext *context, const std::string &url, FetchCredentials credentials,
+                                 const std::u16string &response) {
+  ScriptValue exception;
+  ScriptValue data = ScriptValue::parseJSON(context, response);
+  if (!data.isArray()) {
+    return response;
+  }
+
+  ScriptValue setCookiesValue = data.getIndex(4, &exception);
+  if (setCookiesValue.isArray() && credentials != FetchCredentials::omit) {
+    auto length = static_cast<unsigned>(setCookiesValue.getProperty("length", &exception).toNumber());
+    std::vector<std::string> setCookies;
+    setCookies.reserve(length);
+    for (unsigned i = 0; i < length; i++) {
+      ScriptValue setCookie = setCookiesValue.getIndex(i, &exception);
+      if (!setCookie.isString()) continue;
+      setCookies.emplace_back(setCookie.toString());
+    }
+    storeResponseCookies(context, url, credentials == FetchCredentials::include, setCookies);
+  }
+
+  data.setProperty("length", ScriptValue::makeNumber(context, 4), &exception);
+  return stringifyJSON(data, &exception);
+}
+
+} // namespace kraken::binding
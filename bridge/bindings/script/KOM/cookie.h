@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_COOKIE_H
+#define KRAKENBRIDGE_SCRIPT_COOKIE_H
+
+#include "bindings/script/script_value.h"
+#include "foundation/cookie_jar.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace kraken::binding {
+
+// URL of the document which cookies of document.cookie belong to. Pages evaluated without a valid URL share an
+// empty host, so their cookies still work in the same context.
+::foundation::URLRecord getDocumentCookieURL();
+
+// The Cookie header of a request to url, cookies are only included for requests to the origin of the document unless
+// withCredentials is true. Returns an empty string for invalid url.
+std::string getRequestCookies(ScriptContext *context, const std::string &url, bool withCredentials);
+
+// Store Set-Cookie headers of a response from url, following the same credentials rule as requests.
+void storeResponseCookies(ScriptContext *context, const std::string &url, bool withCredentials,
+                          const std::vector<std::string> &setCookies);
+
+// Fetch requests carry credentials by the `credentials` member of their RequestInit. Their Cookie header is always
+// taken from the jar and Set-Cookie headers of the response are stored here, the page can neither forge the former
+// nor read the latter, HttpOnly cookies included.
+enum class FetchCredentials { omit, sameOrigin, include };
+
+// Rewrite params of a Fetch module call, the JSON of its RequestInit which is empty when there's none, with the
+// Cookie header of the jar.
+std::u16string attachFetchCookies(ScriptContext *context, const std::string &url, const std::u16string &params,
+                                  FetchCredentials *credentials);
+
+// Store Set-Cookie headers of a Fetch module response, [error, status, body, contentType, setCookies], and strip them
+// from the response handed to the page.
+std::u16string storeFetchCookies(ScriptContext *context, const std::string &url, FetchCredentials credentials,
+                                 const std::u16string &response);
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_COOKIE_H
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "location.h"
+#include "dart_methods.h"
+
+namespace kraken::binding {
+
+std::string href = "";
+
+void updateLocation(std::string url = "") {
+  href = url;
+}
+
+const std::string &getLocationHref() {
+  return href;
+}
+
+ScriptValue JSLocation::getProperty(const std::string &name, ScriptValue *exception) {
+  if (name == "href") {
+    return ScriptValue::makeString(context, href);
+  }
+
+  return HostObject::getProperty(name, exception);
+}
+
+void JSLocation::getPropertyNames(std::vector<std::string> &names) {
+  names.emplace_back("href");
+}
+
+ScriptValue JSLocation::reload(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                               void *data, ScriptValue *exception) {
+  auto jsLocation = static_cast<JSLocation *>(data);
+
+  if (getDartMethod()->reloadApp == nullptr) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'reload': dart method (reloadApp) is not registered.");
+    return ScriptValue();
+  }
+
+  getDartMethod()->flushUICommand();
+  getDartMethod()->reloadApp(jsLocation->contextId);
+
+  return ScriptValue();
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_LOCATION_H
+#define KRAKENBRIDGE_SCRIPT_LOCATION_H
+
+#include "bindings/script/host_object.h"
+
+namespace kraken::binding {
+
+#define JSLocationName "Location"
+
+KRAKEN_EXPORT
+void updateLocation(std::string url);
+
+// URL of the current document, cookies and requests are resolved against it.
+const std::string &getLocationHref();
+
+class JSLocation : public HostObject {
+public:
+  static ScriptValue reload(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+
+  explicit JSLocation(ScriptContext *context) : HostObject(context, JSLocationName) {}
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+private:
+  FunctionHolder m_reload{context, value(), this, "reload", reload};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_LOCATION_H
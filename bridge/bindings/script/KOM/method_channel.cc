@@ -0,0 +1,12 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "method_channel.h"
+
+namespace kraken::binding {
+
+JSMethodChannel::JSMethodChannel(ScriptContext *context) : HostObject(context, "methodChannel") {}
+
+} // namespace kraken::binding
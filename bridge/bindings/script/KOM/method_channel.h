@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_METHOD_CHANNEL_H
+#define KRAKENBRIDGE_SCRIPT_METHOD_CHANNEL_H
+
+#include "bindings/script/host_object.h"
+
+namespace kraken::binding {
+
+class JSMethodChannel : public HostObject {
+public:
+  DEFINE_OBJECT_PROPERTY(MethodChannel, 1, invokeMethod);
+
+  JSMethodChannel() = delete;
+  explicit JSMethodChannel(ScriptContext *context);
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_METHOD_CHANNEL_H
@@ -0,0 +1,797 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "performance.h"
+#include "bridge.h"
+#include "dart_methods.h"
+#include "foundation/logging.h"
+#include <algorithm>
+#include <cmath>
+
+#define PERFORMANCE_ENTRY_NONE_UNIQUE_ID -1024
+
+namespace kraken::binding {
+
+std::unordered_map<int32_t, NativePerformance *> NativePerformance::instanceMap{};
+NativePerformance *NativePerformance::instance(ScriptContext *context) {
+  int32_t uniqueId = context->uniqueId;
+  if (instanceMap.count(uniqueId) == 0) {
+    instanceMap[uniqueId] = new NativePerformance(context);
+  }
+
+  return instanceMap[uniqueId];
+}
+
+void NativePerformance::disposeInstance(int32_t uniqueId) {
+  auto it = instanceMap.find(uniqueId);
+  if (it == instanceMap.end()) return;
+  delete it->second;
+  instanceMap.erase(it);
+}
+
+NativePerformance::~NativePerformance() {
+  for (auto observer : m_observers) {
+    observer->detach();
+  }
+}
+
+void NativePerformance::mark(const std::string &markName) {
+  mark(markName, m_context->getClock()->nowMicroseconds());
+}
+
+void NativePerformance::mark(const std::string &markName, int64_t startTime) {
+  addEntry(std::make_shared<NativePerformanceEntry>(markName, PERFORMANCE_ENTRY_TYPE_MARK, startTime, 0,
+                                                    PERFORMANCE_ENTRY_NONE_UNIQUE_ID));
+}
+
+void NativePerformance::addEntry(std::shared_ptr<NativePerformanceEntry> entry) {
+  bool queued = false;
+  for (auto observer : m_observers) {
+    queued = observer->queueEntry(entry) || queued;
+  }
+  entries.add(std::move(entry));
+  if (queued) queueObserverDelivery();
+}
+
+void NativePerformance::addObserver(PerformanceEntryObserver *observer) {
+  if (std::find(m_observers.begin(), m_observers.end(), observer) == m_observers.end()) {
+    m_observers.emplace_back(observer);
+  }
+}
+
+void NativePerformance::removeObserver(PerformanceEntryObserver *observer) {
+  m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+void NativePerformance::queueObserverDelivery() {
+  if (m_deliveryQueued) return;
+  m_deliveryQueued = true;
+
+  ScriptScope scope(m_context);
+  if (m_deliveryCallback.empty()) {
+    m_deliveryCallback =
+      ScriptValue::makeFunction(m_context, "deliverPerformanceObservations", deliverObservations, this);
+  }
+
+  // Promise.resolve().then(deliverObservations), exceptions are reported to the context.
+  ScriptValue promiseConstructor = globalObject(m_context).getProperty("Promise", nullptr);
+  if (promiseConstructor.empty()) return;
+  ScriptValue promise = promiseConstructor.getProperty("resolve", nullptr).call(promiseConstructor, {}, nullptr);
+  if (promise.empty()) return;
+  promise.getProperty("then", nullptr).call(promise, {m_deliveryCallback}, nullptr);
+}
+
+ScriptValue NativePerformance::deliverObservations(ScriptContext *context, const ScriptValue &thisObject,
+                                                   const ScriptArguments &arguments, void *data,
+                                                   ScriptValue *exception) {
+  auto performance = static_cast<NativePerformance *>(data);
+  performance->m_deliveryQueued = false;
+
+  // Callbacks may observe or disconnect, entries they add are delivered in the next microtask.
+  std::vector<PerformanceEntryObserver *> observers = performance->m_observers;
+  for (auto observer : observers) {
+    auto &current = performance->m_observers;
+    if (std::find(current.begin(), current.end(), observer) == current.end()) continue;
+    observer->deliver();
+  }
+  return ScriptValue();
+}
+
+PerformanceEntryBuffer::PerformanceEntryBuffer(size_t capacity) : m_capacity(capacity) {}
+
+void PerformanceEntryBuffer::add(std::shared_ptr<NativePerformanceEntry> entry) {
+  // A buffer without room is always full, the entry added to it is the one dropped and counted as such. This keeps
+  // droppedCount() the number of entries which were added but can't be read back, whatever the capacity is.
+  if (m_capacity == 0) {
+    m_droppedCount++;
+    return;
+  }
+  if (size() == m_capacity) dropOldest();
+
+  uint64_t sequence = m_end++;
+  m_nameIndex[entry->name].emplace_back(sequence);
+  m_typeIndex[entry->entryType].emplace_back(sequence);
+  if (m_slots.size() < m_capacity) {
+    m_slots.emplace_back(std::move(entry));
+  } else {
+    m_slots[sequence % m_capacity] = std::move(entry);
+  }
+}
+
+void PerformanceEntryBuffer::dropOldest() {
+  auto &entry = m_slots[m_begin % m_capacity];
+  // The oldest entry is always at the front of its indexes.
+  auto removeFromIndex = [](Index &index, const std::string &key) {
+    auto it = index.find(key);
+    it->second.pop_front();
+    if (it->second.empty()) index.erase(it);
+  };
+  removeFromIndex(m_nameIndex, entry->name);
+  removeFromIndex(m_typeIndex, entry->entryType);
+  entry.reset();
+  m_begin++;
+  m_droppedCount++;
+}
+
+PerformanceEntryList PerformanceEntryBuffer::entries() const {
+  PerformanceEntryList result;
+  result.reserve(size());
+  for (uint64_t sequence = m_begin; sequence < m_end; sequence++) {
+    result.emplace_back(at(sequence));
+  }
+  return result;
+}
+
+PerformanceEntryList PerformanceEntryBuffer::collect(const Index &index, const std::string &key) const {
+  PerformanceEntryList result;
+  auto it = index.find(key);
+  if (it == index.end()) return result;
+  result.reserve(it->second.size());
+  for (uint64_t sequence : it->second) {
+    result.emplace_back(at(sequence));
+  }
+  return result;
+}
+
+PerformanceEntryList PerformanceEntryBuffer::entriesByName(const std::string &name) const {
+  return collect(m_nameIndex, name);
+}
+
+PerformanceEntryList PerformanceEntryBuffer::entriesByType(const std::string &entryType) const {
+  return collect(m_typeIndex, entryType);
+}
+
+void PerformanceEntryBuffer::clear(const std::string &entryType, const std::string *name) {
+  // Clearing only needs the entries of entryType, the buffer is compacted so removed entries free their slots.
+  size_t removed = name == nullptr ? entriesByType(entryType).size() : 0;
+  if (name != nullptr) {
+    for (auto &entry : entriesByName(*name)) {
+      if (entry->entryType == entryType) removed++;
+    }
+  }
+  if (removed == 0) return;
+
+  PerformanceEntryList remaining;
+  remaining.reserve(size() - removed);
+  for (auto &entry : entries()) {
+    if (entry->entryType == entryType && (name == nullptr || entry->name == *name)) continue;
+    remaining.emplace_back(entry);
+  }
+  rebuild(remaining);
+}
+
+void PerformanceEntryBuffer::setCapacity(size_t capacity) {
+  PerformanceEntryList current = entries();
+  m_capacity = capacity;
+  if (current.size() > capacity) {
+    m_droppedCount += current.size() - capacity;
+    current.erase(current.begin(), current.end() - capacity);
+  }
+  rebuild(current);
+}
+
+void PerformanceEntryBuffer::rebuild(const PerformanceEntryList &entries) {
+  m_begin = m_end = 0;
+  m_slots.clear();
+  m_slots.shrink_to_fit();
+  m_nameIndex.clear();
+  m_typeIndex.clear();
+  for (auto &entry : entries) {
+    add(entry);
+  }
+}
+
+ScriptValue buildPerformanceEntry(const std::string &entryType, ScriptContext *context,
+                                  const std::shared_ptr<NativePerformanceEntry> &nativePerformanceEntry) {
+  if (entryType == PERFORMANCE_ENTRY_TYPE_MARK) {
+    auto *mark = new JSPerformanceMark(context, nativePerformanceEntry);
+    return mark->value();
+  } else if (entryType == PERFORMANCE_ENTRY_TYPE_MEASURE) {
+    auto *measure = new JSPerformanceMeasure(context, nativePerformanceEntry);
+    return measure->value();
+  }
+
+  return ScriptValue::null(context);
+}
+
+ScriptValue buildPerformanceEntryList(ScriptContext *context, const PerformanceEntryList &entries) {
+  std::vector<ScriptValue> values;
+  values.reserve(entries.size());
+  for (auto &entry : entries) {
+    values.emplace_back(buildPerformanceEntry(entry->entryType, context, entry));
+  }
+  return ScriptValue::makeArray(context, values);
+}
+
+JSPerformanceEntry::JSPerformanceEntry(ScriptContext *context,
+                                       std::shared_ptr<NativePerformanceEntry> nativePerformanceEntry)
+  : HostObject(context, "PerformanceEntry"), m_nativePerformanceEntry(std::move(nativePerformanceEntry)) {}
+
+ScriptValue JSPerformanceEntry::getProperty(const std::string &name, ScriptValue *exception) {
+  auto propertyMap = getPerformanceEntryPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+    switch (property) {
+    case PerformanceEntryProperty::name:
+      return ScriptValue::makeString(context, m_nativePerformanceEntry->name);
+    case PerformanceEntryProperty::entryType:
+      return ScriptValue::makeString(context, m_nativePerformanceEntry->entryType);
+    case PerformanceEntryProperty::startTime:
+      return ScriptValue::makeNumber(context, context->getClock()->toHighResTime(m_nativePerformanceEntry->startTime));
+    case PerformanceEntryProperty::duration:
+      return ScriptValue::makeNumber(context, m_nativePerformanceEntry->duration / 1000.0);
+    }
+  }
+  return HostObject::getProperty(name, exception);
+}
+
+JSPerformanceMark::JSPerformanceMark(ScriptContext *context, std::string &name, int64_t startTime)
+  : JSPerformanceEntry(context, std::make_shared<NativePerformanceEntry>(name, PERFORMANCE_ENTRY_TYPE_MARK, startTime,
+                                                                         0, PERFORMANCE_ENTRY_NONE_UNIQUE_ID)) {}
+JSPerformanceMark::JSPerformanceMark(ScriptContext *context,
+                                     std::shared_ptr<NativePerformanceEntry> nativePerformanceEntry)
+  : JSPerformanceEntry(context, std::move(nativePerformanceEntry)) {}
+
+JSPerformanceMeasure::JSPerformanceMeasure(ScriptContext *context, std::string &name, int64_t startTime,
+                                           int64_t duration)
+  : JSPerformanceEntry(context,
+                       std::make_shared<NativePerformanceEntry>(name, PERFORMANCE_ENTRY_TYPE_MEASURE, startTime,
+                                                                duration, PERFORMANCE_ENTRY_NONE_UNIQUE_ID)) {}
+JSPerformanceMeasure::JSPerformanceMeasure(ScriptContext *context,
+                                           std::shared_ptr<NativePerformanceEntry> nativePerformanceEntry)
+  : JSPerformanceEntry(context, std::move(nativePerformanceEntry)) {}
+
+ScriptValue JSPerformance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto propertyMap = getPerformancePropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case PerformanceProperty::timeOrigin:
+      return ScriptValue::makeNumber(context, context->getClock()->timeOriginSinceEpoch());
+    case PerformanceProperty::memory: {
+      // A snapshot of the counters, in the style of Chrome's performance.memory.
+      ContextMemoryStats stats{};
+      static_cast<JSBridge *>(context->getOwner())->getMemoryStats(&stats);
+      auto object = ScriptValue::makeObject(context);
+      auto setNumber = [&](const char *key, double number) {
+        object.setProperty(key, ScriptValue::makeNumber(context, number), exception);
+      };
+      setNumber("usedJSHeapSize", stats.jsHeapSize);
+      setNumber("totalJSHeapSize", stats.jsHeapCapacity);
+      setNumber("eventTargetCount", stats.eventTargetCount);
+      setNumber("nodeCount", stats.nodeCount);
+      setNumber("pendingUICommandBytes", stats.pendingUICommandBytes);
+      setNumber("blobBytes", stats.blobBytes);
+      setNumber("bridgeCallbackCount", stats.bridgeCallbackCount);
+      return object;
+    }
+    default:
+      break;
+    }
+  }
+
+  return HostObject::getProperty(name, exception);
+}
+
+void JSPerformanceEntry::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getPerformanceEntryPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+JSPerformance::~JSPerformance() {}
+
+void JSPerformance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getPerformancePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+double JSPerformance::internalNow() {
+  return context->getClock()->now();
+}
+
+ScriptValue JSPerformance::now(ScriptContext *context, const ScriptValue &thisObject,
+                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = static_cast<JSPerformance *>(data);
+  return ScriptValue::makeNumber(context, instance->internalNow());
+}
+
+ScriptValue JSPerformance::toJSON(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = static_cast<JSPerformance *>(data);
+  double now = instance->internalNow();
+  double timeOrigin = context->getClock()->timeOriginSinceEpoch();
+
+  auto object = ScriptValue::makeObject(context);
+  object.setProperty("now", ScriptValue::makeNumber(context, now), exception);
+  object.setProperty("timeOrigin", ScriptValue::makeNumber(context, timeOrigin), exception);
+  return object;
+}
+
+void JSPerformance::clearEntries(const std::string &entryType, const ScriptArguments &arguments) {
+  auto &entries = nativePerformance->entries;
+  if (arguments.size() == 0 || arguments[0].isUndefined()) {
+    entries.clear(entryType, nullptr);
+    return;
+  }
+
+  std::string name = arguments[0].toString();
+  entries.clear(entryType, &name);
+}
+
+ScriptValue JSPerformance::clearMarks(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto performance = static_cast<JSPerformance *>(data);
+  performance->clearEntries(PERFORMANCE_ENTRY_TYPE_MARK, arguments);
+  return ScriptValue();
+}
+
+ScriptValue JSPerformance::clearMeasures(ScriptContext *context, const ScriptValue &thisObject,
+                                         const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto performance = static_cast<JSPerformance *>(data);
+  performance->clearEntries(PERFORMANCE_ENTRY_TYPE_MEASURE, arguments);
+  return ScriptValue();
+}
+
+ScriptValue JSPerformance::getEntries(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto performance = static_cast<JSPerformance *>(data);
+  return buildPerformanceEntryList(context, performance->getFullEntries());
+}
+
+ScriptValue JSPerformance::getEntriesByName(ScriptContext *context, const ScriptValue &thisObject,
+                                            const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() == 0) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'getEntriesByName' on 'Performance': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string targetName = arguments[0].toString();
+  std::string entryType;
+  if (arguments.size() > 1 && !arguments[1].isUndefined()) {
+    entryType = arguments[1].toString();
+  }
+
+  auto performance = static_cast<JSPerformance *>(data);
+  PerformanceEntryList entries = performance->nativePerformance->entries.entriesByName(targetName);
+#if ENABLE_PROFILE
+  for (auto &entry : performance->getDartEntries()) {
+    if (entry->name == targetName) entries.emplace_back(entry);
+  }
+#endif
+
+  if (!entryType.empty()) {
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [&entryType](auto &entry) { return entry->entryType != entryType; }),
+                  entries.end());
+  }
+
+  return buildPerformanceEntryList(context, entries);
+}
+
+ScriptValue JSPerformance::getEntriesByType(ScriptContext *context, const ScriptValue &thisObject,
+                                            const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() == 0) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'getEntriesByType' on 'Performance': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string entryType = arguments[0].toString();
+
+  auto performance = static_cast<JSPerformance *>(data);
+  PerformanceEntryList entries = performance->nativePerformance->entries.entriesByType(entryType);
+#if ENABLE_PROFILE
+  for (auto &entry : performance->getDartEntries()) {
+    if (entry->entryType == entryType) entries.emplace_back(entry);
+  }
+#endif
+
+  return buildPerformanceEntryList(context, entries);
+}
+
+ScriptValue JSPerformance::setEntryBufferSize(ScriptContext *context, const ScriptValue &thisObject,
+                                              const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() == 0) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'setEntryBufferSize' on 'Performance': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  double maxSize = arguments[0].toNumber();
+  if (std::isnan(maxSize) || maxSize < 0) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'setEntryBufferSize' on 'Performance': maxSize must be a positive number.");
+    return ScriptValue();
+  }
+
+  auto performance = static_cast<JSPerformance *>(data);
+  performance->nativePerformance->entries.setCapacity(static_cast<size_t>(std::min(maxSize, 4294967295.0)));
+  return ScriptValue();
+}
+
+ScriptValue JSPerformance::mark(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() != 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'mark' on 'Performance': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  auto performance = static_cast<JSPerformance *>(data);
+  performance->nativePerformance->mark(arguments[0].toString());
+  return ScriptValue();
+}
+
+#if ENABLE_PROFILE
+
+PerformanceEntryList findAllMeasures(const PerformanceEntryList &entries,
+                                                      const std::string &targetName) {
+  PerformanceEntryList resultEntries;
+
+  for (auto entry : entries) {
+    if (entry->name == targetName) {
+      resultEntries.emplace_back(entry);
+    }
+  }
+
+  return resultEntries;
+};
+
+double getMeasureTotalDuration(const PerformanceEntryList &measures) {
+  double duration = 0.0;
+  for (auto entry : measures) {
+    duration += entry->duration;
+  }
+  return duration / 1000;
+}
+
+ScriptValue JSPerformance::__kraken_navigation_summary__(ScriptContext *context, const ScriptValue &thisObject,
+                                                         const ScriptArguments &arguments, void *data,
+                                                         ScriptValue *exception) {
+  auto performance = static_cast<JSPerformance *>(data);
+  performance->measureSummary();
+
+  PerformanceEntryList entries = performance->getFullEntries();
+  PerformanceEntryList measures;
+  for (auto &m_entries : entries) {
+    if (std::string(m_entries->entryType) == "measure") {
+      measures.emplace_back(m_entries);
+    }
+  }
+
+#define GET_COST(NAME, MACRO)                                                                                          \
+  auto NAME##Measures = findAllMeasures(measures, MACRO);                                                              \
+  size_t NAME##Count = NAME##Measures.size();                                                                          \
+  double NAME##Cost = getMeasureTotalDuration(NAME##Measures);                                                         \
+  auto NAME##Avg = NAME##Measures.empty() ? 0 : NAME##Cost / NAME##Measures.size();
+
+  GET_COST(widgetCreation, PERF_WIDGET_CREATION_COST);
+  GET_COST(controllerPropertiesInit, PERF_CONTROLLER_PROPERTIES_INIT_COST);
+  GET_COST(viewControllerPropertiesInit, PERF_VIEW_CONTROLLER_PROPERTIES_INIT_COST);
+  GET_COST(bridgeInit, PERF_BRIDGE_INIT_COST);
+  GET_COST(bridgeRegisterDartMethod, PERF_BRIDGE_REGISTER_DART_METHOD_COST);
+  GET_COST(createViewport, PERF_CREATE_VIEWPORT_COST);
+  GET_COST(elementManagerInit, PERF_ELEMENT_MANAGER_INIT_COST);
+  GET_COST(elementManagerPropertiesInit, PERF_ELEMENT_MANAGER_PROPERTIES_INIT_COST);
+  GET_COST(bodyElementInit, PERF_BODY_ELEMENT_INIT_COST);
+  GET_COST(bodyElementPropertiesInit, PERF_BODY_ELEMENT_PROPERTIES_INIT_COST);
+  GET_COST(jsContextInit, PERF_JS_CONTEXT_INIT_COST);
+  GET_COST(jsNativeMethodInit, PERF_JS_NATIVE_METHOD_INIT_COST);
+  GET_COST(jsPolyfillInit, PERF_JS_POLYFILL_INIT_COST);
+  GET_COST(jsBundleLoad, PERF_JS_BUNDLE_LOAD_COST);
+  GET_COST(jsBundleEval, PERF_JS_BUNDLE_EVAL_COST);
+  GET_COST(flushUiCommand, PERF_FLUSH_UI_COMMAND_COST);
+  GET_COST(createElement, PERF_CREATE_ELEMENT_COST);
+  GET_COST(createTextNode, PERF_CREATE_TEXT_NODE_COST);
+  GET_COST(createComment, PERF_CREATE_COMMENT_COST);
+  GET_COST(disposeEventTarget, PERF_DISPOSE_EVENT_TARGET_COST);
+  GET_COST(addEvent, PERF_ADD_EVENT_COST);
+  GET_COST(insertAdjacentNode, PERF_INSERT_ADJACENT_NODE_COST);
+  GET_COST(removeNode, PERF_REMOVE_NODE_COST);
+  GET_COST(setStyle, PERF_SET_STYLE_COST);
+  GET_COST(setProperties, PERF_SET_PROPERTIES_COST);
+  GET_COST(removeProperties, PERF_REMOVE_PROPERTIES_COST);
+  GET_COST(flexLayout, PERF_FLEX_LAYOUT_COST);
+  GET_COST(flowLayout, PERF_FLOW_LAYOUT_COST);
+  GET_COST(intrinsicLayout, PERF_INTRINSIC_LAYOUT_COST);
+  GET_COST(silverLayout, PERF_SILVER_LAYOUT_COST);
+  GET_COST(paint, PERF_PAINT_COST);
+
+  double initBundleCost = jsBundleLoadCost + jsBundleEvalCost + flushUiCommandCost + createElementCost +
+                          createTextNodeCost + createCommentCost + disposeEventTargetCost + addEventCost +
+                          insertAdjacentNodeCost + removeNodeCost + setStyleCost + setPropertiesCost +
+                          removePropertiesCost;
+  double renderingCost = flexLayoutCost + flowLayoutCost + intrinsicLayoutCost + silverLayoutCost + paintCost;
+  double totalCost = widgetCreationCost + initBundleCost + renderingCost;
+
+  char buffer[5000];
+  // clang-format off
+  sprintf(buffer, R"(
+Total time cost: %.*fms
+
++ %s %.*fms
+  + %s %.*fms
+  + %s %.*fms
+  + %s %.*fms
+  + %s %.*fms
+  + %s %.*fms
+  + %s %.*fms
+  + %s %.*fms
+  + %s %.*fms
+    + %s %.*fms
+    + %s %.*fms
+    + %s %.*fms
+    + %s %.*fms
+First Bundle Load: %.*fms
+  + %s %.*fms
+  + %s %.*fms
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+Rendering: %.*fms
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+  + %s %.*fms avg: %.*fms count: %zu
+)",
+  2, totalCost,
+    PERF_WIDGET_CREATION_COST, 2, widgetCreationCost,
+      PERF_CONTROLLER_PROPERTIES_INIT_COST, 2, controllerPropertiesInitCost,
+      PERF_VIEW_CONTROLLER_PROPERTIES_INIT_COST, 2, viewControllerPropertiesInitCost,
+      PERF_ELEMENT_MANAGER_INIT_COST, 2, elementManagerInitCost,
+      PERF_ELEMENT_MANAGER_PROPERTY_INIT, 2, elementManagerPropertiesInitCost,
+      PERF_BODY_ELEMENT_PROPERTIES_INIT_COST, 2, bodyElementPropertiesInitCost,
+      PERF_BODY_ELEMENT_INIT_COST, 2, bodyElementInitCost,
+      PERF_CREATE_VIEWPORT_COST, 2, createViewportCost,
+      PERF_BRIDGE_INIT_COST, 2, bridgeInitCost,
+      PERF_BRIDGE_REGISTER_DART_METHOD_COST, 2, bridgeRegisterDartMethodCost,
+      PERF_JS_CONTEXT_INIT_COST, 2, jsContextInitCost,
+      PERF_JS_NATIVE_METHOD_INIT_COST, 2, jsNativeMethodInitCost,
+      PERF_JS_POLYFILL_INIT_COST, 2, jsPolyfillInitCost,
+  2, initBundleCost,
+    PERF_JS_BUNDLE_LOAD_COST, 2, jsBundleLoadCost,
+    PERF_JS_BUNDLE_EVAL_COST, 2, jsBundleEvalCost,
+    PERF_FLUSH_UI_COMMAND_COST, 2, flushUiCommandCost, 2, flushUiCommandAvg, flushUiCommandCount,
+    PERF_CREATE_ELEMENT_COST, 2, createElementCost, 2, createElementAvg, createElementCount,
+    PERF_CREATE_TEXT_NODE_COST, 2, createTextNodeCost, 2, createTextNodeAvg, createTextNodeCount,
+    PERF_CREATE_COMMENT_COST, 2, createCommentCost, 2, createCommentAvg, createCommentCount,
+    PERF_DISPOSE_EVENT_TARGET_COST, 2, disposeEventTargetCost, 2, disposeEventTargetAvg, disposeEventTargetCount,
+    PERF_ADD_EVENT_COST, 2, addEventCost, 2, addEventAvg, addEventCount,
+    PERF_INSERT_ADJACENT_NODE_COST, 2, insertAdjacentNodeCost, 2, insertAdjacentNodeAvg, insertAdjacentNodeCount,
+    PERF_REMOVE_NODE_COST, 2, removeNodeCost, 2, removeNodeAvg, removeNodeCount,
+    PERF_SET_STYLE_COST, 2, setStyleCost, 2, setStyleAvg, setStyleCount,
+    PERF_SET_PROPERTIES_COST, 2, setPropertiesCost, 2, setPropertiesAvg, setPropertiesCount,
+    PERF_REMOVE_PROPERTIES_COST, 2, removePropertiesCost, 2, removePropertiesAvg, removePropertiesCount,
+  2, renderingCost,
+    PERF_FLEX_LAYOUT_COST, 2, flexLayoutCost, 2, flexLayoutAvg, flexLayoutCount,
+    PERF_FLOW_LAYOUT_COST, 2, flowLayoutCost, 2, flowLayoutAvg, flowLayoutCount,
+    PERF_INTRINSIC_LAYOUT_COST, 2, intrinsicLayoutCost, 2, intrinsicLayoutAvg, intrinsicLayoutCount,
+    PERF_SILVER_LAYOUT_COST, 2, silverLayoutCost, 2, silverLayoutAvg, silverLayoutCount,
+    PERF_PAINT_COST, 2, paintCost, 2, paintAvg, paintCount
+);
+  // clang-format on
+
+  return ScriptValue::makeString(context, std::string(buffer));
+}
+
+void JSPerformance::measureSummary() {
+  internalMeasure(PERF_WIDGET_CREATION_COST, PERF_CONTROLLER_INIT_START, PERF_CONTROLLER_INIT_END, nullptr);
+  internalMeasure(PERF_CONTROLLER_PROPERTIES_INIT_COST, PERF_CONTROLLER_INIT_START, PERF_CONTROLLER_PROPERTY_INIT,
+                  nullptr);
+  internalMeasure(PERF_VIEW_CONTROLLER_PROPERTIES_INIT_COST, PERF_VIEW_CONTROLLER_INIT_START,
+                  PERF_VIEW_CONTROLLER_PROPERTY_INIT, nullptr);
+  internalMeasure(PERF_BRIDGE_INIT_COST, PERF_BRIDGE_INIT_START, PERF_BRIDGE_INIT_END, nullptr);
+  internalMeasure(PERF_BRIDGE_REGISTER_DART_METHOD_COST, PERF_BRIDGE_REGISTER_DART_METHOD_START,
+                  PERF_BRIDGE_REGISTER_DART_METHOD_END, nullptr);
+  internalMeasure(PERF_CREATE_VIEWPORT_COST, PERF_CREATE_VIEWPORT_START, PERF_CREATE_VIEWPORT_END, nullptr);
+  internalMeasure(PERF_ELEMENT_MANAGER_INIT_COST, PERF_ELEMENT_MANAGER_INIT_START, PERF_ELEMENT_MANAGER_INIT_END,
+                  nullptr);
+  internalMeasure(PERF_ELEMENT_MANAGER_PROPERTIES_INIT_COST, PERF_ELEMENT_MANAGER_INIT_START,
+                  PERF_ELEMENT_MANAGER_PROPERTY_INIT, nullptr);
+  internalMeasure(PERF_BODY_ELEMENT_INIT_COST, PERF_BODY_ELEMENT_INIT_START, PERF_BODY_ELEMENT_INIT_END, nullptr);
+  internalMeasure(PERF_BODY_ELEMENT_PROPERTIES_INIT_COST, PERF_BODY_ELEMENT_INIT_START, PERF_BODY_ELEMENT_PROPERTY_INIT,
+                  nullptr);
+  internalMeasure(PERF_JS_CONTEXT_INIT_COST, PERF_JS_CONTEXT_INIT_START, PERF_JS_CONTEXT_INIT_END, nullptr);
+  internalMeasure(PERF_JS_NATIVE_METHOD_INIT_COST, PERF_JS_NATIVE_METHOD_INIT_START, PERF_JS_NATIVE_METHOD_INIT_END,
+                  nullptr);
+  internalMeasure(PERF_JS_POLYFILL_INIT_COST, PERF_JS_POLYFILL_INIT_START, PERF_JS_POLYFILL_INIT_END, nullptr);
+  internalMeasure(PERF_JS_BUNDLE_LOAD_COST, PERF_JS_BUNDLE_LOAD_START, PERF_JS_BUNDLE_LOAD_END, nullptr);
+  internalMeasure(PERF_JS_BUNDLE_EVAL_COST, PERF_JS_BUNDLE_EVAL_START, PERF_JS_BUNDLE_EVAL_END, nullptr);
+  internalMeasure(PERF_FLUSH_UI_COMMAND_COST, PERF_FLUSH_UI_COMMAND_START, PERF_FLUSH_UI_COMMAND_END, nullptr);
+  internalMeasure(PERF_CREATE_ELEMENT_COST, PERF_CREATE_ELEMENT_START, PERF_CREATE_ELEMENT_END, nullptr);
+  internalMeasure(PERF_CREATE_TEXT_NODE_COST, PERF_CREATE_TEXT_NODE_START, PERF_CREATE_TEXT_NODE_END, nullptr);
+  internalMeasure(PERF_CREATE_COMMENT_COST, PERF_CREATE_COMMENT_START, PERF_CREATE_COMMENT_END, nullptr);
+  internalMeasure(PERF_DISPOSE_EVENT_TARGET_COST, PERF_DISPOSE_EVENT_TARGET_START, PERF_DISPOSE_EVENT_TARGET_END,
+                  nullptr);
+  internalMeasure(PERF_ADD_EVENT_COST, PERF_ADD_EVENT_START, PERF_ADD_EVENT_END, nullptr);
+  internalMeasure(PERF_INSERT_ADJACENT_NODE_COST, PERF_INSERT_ADJACENT_NODE_START, PERF_INSERT_ADJACENT_NODE_END,
+                  nullptr);
+  internalMeasure(PERF_REMOVE_NODE_COST, PERF_REMOVE_NODE_START, PERF_REMOVE_NODE_END, nullptr);
+  internalMeasure(PERF_SET_STYLE_COST, PERF_SET_STYLE_START, PERF_SET_STYLE_END, nullptr);
+  internalMeasure(PERF_SET_PROPERTIES_COST, PERF_SET_PROPERTIES_START, PERF_SET_PROPERTIES_END, nullptr);
+  internalMeasure(PERF_REMOVE_PROPERTIES_COST, PERF_REMOVE_PROPERTIES_START, PERF_REMOVE_PROPERTIES_END, nullptr);
+  internalMeasure(PERF_FLEX_LAYOUT_COST, PERF_FLEX_LAYOUT_START, PERF_FLEX_LAYOUT_END, nullptr);
+  internalMeasure(PERF_FLOW_LAYOUT_COST, PERF_FLOW_LAYOUT_START, PERF_FLOW_LAYOUT_END, nullptr);
+  internalMeasure(PERF_INTRINSIC_LAYOUT_COST, PERF_INTRINSIC_LAYOUT_START, PERF_INTRINSIC_LAYOUT_END, nullptr);
+  internalMeasure(PERF_SILVER_LAYOUT_COST, PERF_SILVER_LAYOUT_START, PERF_SILVER_LAYOUT_END, nullptr);
+  internalMeasure(PERF_PAINT_COST, PERF_PAINT_START, PERF_PAINT_END, nullptr);
+}
+
+#endif
+
+ScriptValue JSPerformance::measure(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() == 0) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'measure' on 'Performance': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  std::string name = arguments[0].toString();
+  std::string startMark;
+  std::string endMark;
+
+  if (arguments.size() > 1 && !arguments[1].isUndefined()) {
+    startMark = arguments[1].toString();
+  }
+
+  if (arguments.size() > 2) {
+    endMark = arguments[2].toString();
+  }
+
+  auto performance = static_cast<JSPerformance *>(data);
+  performance->internalMeasure(name, startMark, endMark, exception);
+
+  return ScriptValue();
+}
+
+PerformanceEntryList JSPerformance::getFullEntries() {
+  PerformanceEntryList entries = nativePerformance->entries.entries();
+#if ENABLE_PROFILE
+  PerformanceEntryList dartEntries = getDartEntries();
+  entries.insert(entries.end(), dartEntries.begin(), dartEntries.end());
+#endif
+  return entries;
+}
+
+#if ENABLE_PROFILE
+PerformanceEntryList JSPerformance::getDartEntries() {
+  PerformanceEntryList dartEntries;
+  if (getDartMethod()->getPerformanceEntries == nullptr) {
+    return dartEntries;
+  }
+  auto dartEntryList = getDartMethod()->getPerformanceEntries(context->getContextId());
+  auto dartEntityBytes = dartEntryList->entries;
+  dartEntries.reserve(dartEntryList->length);
+
+  for (size_t i = 0; i < dartEntryList->length * 3; i += 3) {
+    const char *name = reinterpret_cast<const char *>(dartEntityBytes[i]);
+    // Dart marks are wall clock times, they are mapped to the context clock to be measured with native marks.
+    int64_t startTime = context->getClock()->fromEpochMicroseconds(dartEntityBytes[i + 1]);
+    int64_t uniqueId = dartEntityBytes[i + 2];
+    dartEntries.emplace_back(
+      std::make_shared<NativePerformanceEntry>(name, PERFORMANCE_ENTRY_TYPE_MARK, startTime, 0, uniqueId));
+  }
+
+  delete[] dartEntryList->entries;
+  delete dartEntryList;
+  return dartEntries;
+}
+#endif
+
+void JSPerformance::internalMeasure(const std::string &name, const std::string &startMark, const std::string &endMark,
+                                    ScriptValue *exception) {
+  auto entries = getFullEntries();
+
+  if (!startMark.empty() && !endMark.empty()) {
+    size_t startMarkCount =
+      std::count_if(entries.begin(), entries.end(),
+                    [&startMark](auto &entry) -> bool { return entry->name == startMark; });
+
+    if (startMarkCount == 0) {
+      if (exception != nullptr) {
+        *exception = ScriptValue::makeError(
+          context, "Failed to execute 'measure' on 'Performance': The mark " + startMark + " does not exist.");
+      }
+      return;
+    }
+
+    size_t endMarkCount =
+      std::count_if(entries.begin(), entries.end(),
+                    [&endMark](auto &entry) -> bool { return entry->name == endMark; });
+
+    if (endMarkCount == 0) {
+      if (exception != nullptr) {
+        *exception = ScriptValue::makeError(
+          context, "Failed to execute 'measure' on 'Performance': The mark " + endMark + " does not exist.");
+      }
+      return;
+    }
+
+    if (startMarkCount != endMarkCount) {
+      if (exception != nullptr) {
+        *exception = ScriptValue::makeError(context, "Failed to execute 'measure' on 'Performance': The mark " +
+                                                       startMark + " and " + endMark +
+                                                       "does not appear the same number of times");
+      }
+      return;
+    }
+
+    auto startIt = std::begin(entries);
+    auto endIt = std::begin(entries);
+
+    for (size_t i = 0; i < startMarkCount; i++) {
+      auto startEntry = std::find_if(startIt, entries.end(), [&startMark](auto &entry) -> bool {
+        return entry->name == startMark;
+      });
+
+      bool isStartEntryHasUniqueId = (*startEntry)->uniqueId != PERFORMANCE_ENTRY_NONE_UNIQUE_ID;
+
+      auto endEntryComparator = [&endMark, &startEntry,
+                                 isStartEntryHasUniqueId](auto &entry) -> bool {
+        if (isStartEntryHasUniqueId) {
+          return entry->uniqueId == (*startEntry)->uniqueId && entry->name == endMark;
+        }
+        return entry->name == endMark;
+      };
+
+      auto endEntry = std::find_if(startEntry, entries.end(), endEntryComparator);
+
+      if (endEntry == entries.end()) {
+        size_t startIndex = startEntry - entries.begin();
+        assert_m(false, ("Can not get endEntry. startIndex: " + std::to_string(startIndex) +
+                         " startMark: " + startMark + " endMark: " + endMark));
+      }
+
+      int64_t duration = (*endEntry)->startTime - (*startEntry)->startTime;
+      int64_t startTime = (*startEntry)->startTime;
+      nativePerformance->addEntry(std::make_shared<NativePerformanceEntry>(
+        name, PERFORMANCE_ENTRY_TYPE_MEASURE, startTime, duration, PERFORMANCE_ENTRY_NONE_UNIQUE_ID));
+      startIt = ++startEntry;
+      endIt = ++endEntry;
+    }
+  }
+}
+
+void bindPerformance(ScriptContext *context) {
+  auto performance = new JSPerformance(context, NativePerformance::instance(context));
+  bindGlobalValue(context, "performance", performance->value());
+}
+
+} // namespace kraken::binding
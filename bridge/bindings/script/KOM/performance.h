@@ -0,0 +1,334 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_PERFORMANCE_H
+#define KRAKENBRIDGE_SCRIPT_PERFORMANCE_H
+
+#include "bindings/script/host_object.h"
+#include "foundation/monotonic_clock.h"
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace kraken::binding {
+
+#define JSPerformanceName "Performance"
+
+#if ENABLE_PROFILE
+#define PERF_WIDGET_CREATION_COST "widget_creation_cost"
+#define PERF_CONTROLLER_PROPERTIES_INIT_COST "controller_properties_init_cost"
+#define PERF_VIEW_CONTROLLER_PROPERTIES_INIT_COST "view_controller_properties_init_cost"
+#define PERF_BRIDGE_INIT_COST "bridge_init_cost"
+#define PERF_BRIDGE_REGISTER_DART_METHOD_COST "bridge_register_dart_method_cost"
+#define PERF_CREATE_VIEWPORT_COST "create_viewport"
+#define PERF_ELEMENT_MANAGER_INIT_COST "element_manager_init_cost"
+#define PERF_ELEMENT_MANAGER_PROPERTIES_INIT_COST "element_manager_property_init_cost"
+#define PERF_BODY_ELEMENT_INIT_COST "body_element_init_cost"
+#define PERF_BODY_ELEMENT_PROPERTIES_INIT_COST "body_element_property_init_cost"
+#define PERF_JS_CONTEXT_INIT_COST "js_context_init_cost"
+#define PERF_JS_NATIVE_METHOD_INIT_COST "native_method_init_cost"
+#define PERF_JS_POLYFILL_INIT_COST "polyfill_init_cost"
+#define PERF_JS_BUNDLE_LOAD_COST "js_bundle_load_cost"
+#define PERF_JS_BUNDLE_EVAL_COST "js_bundle_eval_cost"
+#define PERF_FLUSH_UI_COMMAND_COST "flush_ui_command_cost"
+#define PERF_CREATE_ELEMENT_COST "create_element_cost"
+#define PERF_CREATE_TEXT_NODE_COST "create_text_node_cost"
+#define PERF_CREATE_COMMENT_COST "create_comment_cost"
+#define PERF_DISPOSE_EVENT_TARGET_COST "dispose_event_target_cost"
+#define PERF_ADD_EVENT_COST "add_event_cost"
+#define PERF_INSERT_ADJACENT_NODE_COST "insert_adjacent_node_cost"
+#define PERF_REMOVE_NODE_COST "remove_node_cost"
+#define PERF_SET_STYLE_COST "set_style_cost"
+#define PERF_SET_PROPERTIES_COST "set_properties_cost"
+#define PERF_REMOVE_PROPERTIES_COST "remove_properties_cost"
+#define PERF_FLEX_LAYOUT_COST "flex_layout_cost"
+#define PERF_FLOW_LAYOUT_COST "flow_layout_cost"
+#define PERF_INTRINSIC_LAYOUT_COST "intrinsic_layout_cost"
+#define PERF_SILVER_LAYOUT_COST "silver_layout_cost"
+#define PERF_PAINT_COST "paint_cost"
+
+#define PERF_CONTROLLER_INIT_START "controller_init_start"
+#define PERF_CONTROLLER_INIT_END "controller_init_end"
+#define PERF_CONTROLLER_PROPERTY_INIT "controller_properties_init"
+#define PERF_VIEW_CONTROLLER_INIT_START "view_controller_init_start"
+#define PERF_VIEW_CONTROLLER_PROPERTY_INIT "view_controller_property_init"
+#define PERF_BRIDGE_INIT_START "bridge_init_start"
+#define PERF_BRIDGE_INIT_END "bridge_init_end"
+#define PERF_BRIDGE_REGISTER_DART_METHOD_START "bridge_register_dart_method_start"
+#define PERF_BRIDGE_REGISTER_DART_METHOD_END "bridge_register_dart_method_end"
+#define PERF_CREATE_VIEWPORT_START "create_viewport_start"
+#define PERF_CREATE_VIEWPORT_END "create_viewport_end"
+#define PERF_ELEMENT_MANAGER_INIT_START "element_manager_init_start"
+#define PERF_ELEMENT_MANAGER_INIT_END "element_manager_init_end"
+#define PERF_ELEMENT_MANAGER_PROPERTY_INIT "element_manager_property_init"
+#define PERF_BODY_ELEMENT_INIT_START "body_element_init_start"
+#define PERF_BODY_ELEMENT_INIT_END "body_element_init_end"
+#define PERF_BODY_ELEMENT_PROPERTY_INIT "body_element_property_init"
+#define PERF_JS_CONTEXT_INIT_START "js_context_start"
+#define PERF_JS_CONTEXT_INIT_END "js_context_end"
+#define PERF_JS_NATIVE_METHOD_INIT_START "init_native_method_start"
+#define PERF_JS_NATIVE_METHOD_INIT_END "init_native_method_end"
+#define PERF_JS_POLYFILL_INIT_START "init_js_polyfill_start"
+#define PERF_JS_POLYFILL_INIT_END "init_js_polyfill_end"
+#define PERF_JS_BUNDLE_LOAD_START "js_bundle_load_start"
+#define PERF_JS_BUNDLE_LOAD_END "js_bundle_load_end"
+#define PERF_JS_BUNDLE_EVAL_START "js_bundle_eval_start"
+#define PERF_JS_BUNDLE_EVAL_END "js_bundle_eval_end"
+#define PERF_FLUSH_UI_COMMAND_START "flush_ui_command_start"
+#define PERF_FLUSH_UI_COMMAND_END "flush_ui_command_end"
+#define PERF_CREATE_ELEMENT_START "create_element_start"
+#define PERF_CREATE_ELEMENT_END "create_element_end"
+#define PERF_CREATE_TEXT_NODE_START "create_text_node_start"
+#define PERF_CREATE_TEXT_NODE_END "create_text_node_end"
+#define PERF_CREATE_COMMENT_START "create_comment_start"
+#define PERF_CREATE_COMMENT_END "create_comment_end"
+#define PERF_DISPOSE_EVENT_TARGET_START "dispose_event_target_start"
+#define PERF_DISPOSE_EVENT_TARGET_END "dispose_event_target_end"
+#define PERF_ADD_EVENT_START "add_event_start"
+#define PERF_ADD_EVENT_END "add_event_end"
+#define PERF_INSERT_ADJACENT_NODE_START "insert_adjacent_node_start"
+#define PERF_INSERT_ADJACENT_NODE_END "insert_adjacent_node_end"
+#define PERF_REMOVE_NODE_START "remove_node_start"
+#define PERF_REMOVE_NODE_END "remove_node_end"
+#define PERF_SET_STYLE_START "set_style_start"
+#define PERF_SET_STYLE_END "set_style_end"
+#define PERF_SET_PROPERTIES_START "set_properties_start"
+#define PERF_SET_PROPERTIES_END "set_properties_end"
+#define PERF_REMOVE_PROPERTIES_START "remove_properties_start"
+#define PERF_REMOVE_PROPERTIES_END "remove_properties_end"
+#define PERF_FLEX_LAYOUT_START "flex_layout_start"
+#define PERF_FLEX_LAYOUT_END "flex_layout_end"
+#define PERF_FLOW_LAYOUT_START "flow_layout_start"
+#define PERF_FLOW_LAYOUT_END "flow_layout_end"
+#define PERF_INTRINSIC_LAYOUT_START "intrinsic_layout_start"
+#define PERF_INTRINSIC_LAYOUT_END "intrinsic_layout_end"
+#define PERF_SILVER_LAYOUT_START "silver_layout_start"
+#define PERF_SILVER_LAYOUT_END "silver_layout_end"
+#define PERF_PAINT_START "paint_start"
+#define PERF_PAINT_END "paint_end"
+#endif
+
+void bindPerformance(ScriptContext *context);
+
+#define PERFORMANCE_ENTRY_TYPE_MARK "mark"
+#define PERFORMANCE_ENTRY_TYPE_MEASURE "measure"
+
+// startTime is in microseconds of the context clock and duration in microseconds, JSPerformanceEntry converts them
+// to DOMHighResTimeStamp.
+struct NativePerformanceEntry {
+  NativePerformanceEntry(std::string name, std::string entryType, int64_t startTime, int64_t duration,
+                         int64_t uniqueId)
+    : name(std::move(name)), entryType(std::move(entryType)), startTime(startTime), duration(duration),
+      uniqueId(uniqueId){};
+  std::string name;
+  std::string entryType;
+  int64_t startTime;
+  int64_t duration;
+  int64_t uniqueId;
+};
+
+using PerformanceEntryList = std::vector<std::shared_ptr<NativePerformanceEntry>>;
+
+// A circular buffer of performance entries, the oldest entry is dropped when a new one is added to a full buffer.
+// Entries are indexed by name and type, lookups only visit the matching entries. Entries are shared with the
+// PerformanceEntry objects handed to JS, so they stay valid after they are dropped.
+class PerformanceEntryBuffer {
+public:
+  explicit PerformanceEntryBuffer(size_t capacity);
+
+  void add(std::shared_ptr<NativePerformanceEntry> entry);
+  // Entries in the order they were added.
+  PerformanceEntryList entries() const;
+  PerformanceEntryList entriesByName(const std::string &name) const;
+  PerformanceEntryList entriesByType(const std::string &entryType) const;
+  // Remove entries of entryType, only those named name when it is not null.
+  void clear(const std::string &entryType, const std::string *name);
+  // Shrinking the buffer drops the oldest entries.
+  void setCapacity(size_t capacity);
+
+  size_t size() const {
+    return m_end - m_begin;
+  }
+  size_t capacity() const {
+    return m_capacity;
+  }
+  // Number of entries dropped because the buffer was full.
+  uint64_t droppedCount() const {
+    return m_droppedCount;
+  }
+
+private:
+  using Index = std::unordered_map<std::string, std::deque<uint64_t>>;
+
+  const std::shared_ptr<NativePerformanceEntry> &at(uint64_t sequence) const {
+    return m_slots[sequence % m_capacity];
+  }
+  PerformanceEntryList collect(const Index &index, const std::string &key) const;
+  void dropOldest();
+  void rebuild(const PerformanceEntryList &entries);
+
+  size_t m_capacity;
+  // Entries are numbered in the order they were added, entries of [m_begin, m_end) are alive.
+  uint64_t m_begin{0};
+  uint64_t m_end{0};
+  uint64_t m_droppedCount{0};
+  std::vector<std::shared_ptr<NativePerformanceEntry>> m_slots;
+  Index m_nameIndex;
+  Index m_typeIndex;
+};
+
+class JSPerformance;
+
+class JSPerformanceEntry : public HostObject {
+public:
+  DEFINE_OBJECT_PROPERTY(PerformanceEntry, 4, name, entryType, startTime, duration)
+
+  JSPerformanceEntry() = delete;
+  explicit JSPerformanceEntry(ScriptContext *context, std::shared_ptr<NativePerformanceEntry> nativePerformanceEntry);
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+private:
+  friend JSPerformance;
+  std::shared_ptr<NativePerformanceEntry> m_nativePerformanceEntry;
+};
+
+class JSPerformanceMark : public JSPerformanceEntry {
+public:
+  JSPerformanceMark() = delete;
+  explicit JSPerformanceMark(ScriptContext *context, std::string &name, int64_t startTime);
+  explicit JSPerformanceMark(ScriptContext *context, std::shared_ptr<NativePerformanceEntry> nativePerformanceEntry);
+
+private:
+};
+
+class JSPerformanceMeasure : public JSPerformanceEntry {
+public:
+  JSPerformanceMeasure() = delete;
+  explicit JSPerformanceMeasure(ScriptContext *context, std::string &name, int64_t startTime, int64_t duration);
+  explicit JSPerformanceMeasure(ScriptContext *context,
+                                std::shared_ptr<NativePerformanceEntry> nativePerformanceEntry);
+};
+
+// Receives the entries added to NativePerformance, entries are shared with the buffer instead of copied.
+class PerformanceEntryObserver {
+public:
+  virtual ~PerformanceEntryObserver() = default;
+  // Returns false when the observer is not interested in the type of entry.
+  virtual bool queueEntry(const std::shared_ptr<NativePerformanceEntry> &entry) = 0;
+  // Hand the queued entries to the observer callback.
+  virtual void deliver() = 0;
+  // Performance is disposed with the bridge before the context finalizes its observers, which must not reach it
+  // afterwards.
+  virtual void detach() = 0;
+};
+
+class NativePerformance {
+public:
+  static std::unordered_map<int32_t, NativePerformance *> instanceMap;
+  static NativePerformance *instance(ScriptContext *context);
+  static void disposeInstance(int32_t uniqueId);
+
+  // Marks and measures kept for a context unless the page sets another size with setEntryBufferSize().
+  static constexpr size_t kDefaultEntryBufferSize = 10000;
+
+  explicit NativePerformance(ScriptContext *context) : m_context(context){};
+  ~NativePerformance();
+
+  void mark(const std::string &markName);
+  void mark(const std::string &markName, int64_t startTime);
+  // Store entry and queue it to the observers.
+  void addEntry(std::shared_ptr<NativePerformanceEntry> entry);
+
+  // Observers are delivered in the order they are added.
+  void addObserver(PerformanceEntryObserver *observer);
+  void removeObserver(PerformanceEntryObserver *observer);
+  // Deliver queued entries in a microtask, so entries added by the same task reach an observer in one callback.
+  void queueObserverDelivery();
+
+  PerformanceEntryBuffer entries{kDefaultEntryBufferSize};
+
+private:
+  static ScriptValue deliverObservations(ScriptContext *context, const ScriptValue &thisObject,
+                                         const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  ScriptContext *m_context;
+  std::vector<PerformanceEntryObserver *> m_observers;
+  bool m_deliveryQueued{false};
+  ScriptValue m_deliveryCallback;
+};
+
+ScriptValue buildPerformanceEntryList(ScriptContext *context, const PerformanceEntryList &entries);
+
+class JSPerformance : public HostObject {
+public:
+  DEFINE_OBJECT_PROPERTY(Performance, 2, timeOrigin, memory);
+
+  static ScriptValue now(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                         void *data, ScriptValue *exception);
+  static ScriptValue toJSON(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue clearMarks(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue clearMeasures(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getEntries(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getEntriesByName(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getEntriesByType(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue mark(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue measure(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+  static ScriptValue setEntryBufferSize(ScriptContext *context, const ScriptValue &thisObject,
+                                        const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+#if ENABLE_PROFILE
+  static ScriptValue __kraken_navigation_summary__(ScriptContext *context, const ScriptValue &thisObject,
+                                                   const ScriptArguments &arguments, void *data,
+                                                   ScriptValue *exception);
+#endif
+
+  JSPerformance(ScriptContext *context, NativePerformance *nativePerformance)
+    : HostObject(context, JSPerformanceName), nativePerformance(nativePerformance) {}
+  ~JSPerformance() override;
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+private:
+  friend JSPerformanceEntry;
+  FunctionHolder m_now{context, value(), this, "now", now};
+  FunctionHolder m_toJSON{context, value(), this, "toJSON", toJSON};
+  FunctionHolder m_clearMarks{context, value(), this, "clearMarks", clearMarks};
+  FunctionHolder m_clearMeasures{context, value(), this, "clearMeasures", clearMeasures};
+  FunctionHolder m_getEntries{context, value(), this, "getEntries", getEntries};
+  FunctionHolder m_getEntriesByName{context, value(), this, "getEntriesByName", getEntriesByName};
+  FunctionHolder m_getEntriesByType{context, value(), this, "getEntriesByType", getEntriesByType};
+  FunctionHolder m_mark{context, value(), this, "mark", mark};
+  FunctionHolder m_measure{context, value(), this, "measure", measure};
+  FunctionHolder m_setEntryBufferSize{context, value(), this, "setEntryBufferSize", setEntryBufferSize};
+
+#if ENABLE_PROFILE
+  FunctionHolder m_summary{context, value(), this, "__kraken_navigation_summary__", __kraken_navigation_summary__};
+  void measureSummary();
+#endif
+  void internalMeasure(const std::string &name, const std::string &startMark, const std::string &endMark,
+                       ScriptValue *exception);
+  void clearEntries(const std::string &entryType, const ScriptArguments &arguments);
+  double internalNow();
+  PerformanceEntryList getFullEntries();
+#if ENABLE_PROFILE
+  PerformanceEntryList getDartEntries();
+#endif
+  NativePerformance *nativePerformance{nullptr};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_PERFORMANCE_H
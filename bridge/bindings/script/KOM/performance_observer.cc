@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "performance_observer.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+namespace {
+
+const std::vector<std::string> &supportedEntryTypes() {
+  static const std::vector<std::string> entryTypes{PERFORMANCE_ENTRY_TYPE_MARK, PERFORMANCE_ENTRY_TYPE_MEASURE};
+  return entryTypes;
+}
+
+bool isSupportedEntryType(const std::string &entryType) {
+  auto &entryTypes = supportedEntryTypes();
+  return std::find(entryTypes.begin(), entryTypes.end(), entryType) != entryTypes.end();
+}
+
+} // namespace
+
+ScriptValue JSPerformanceObserverEntryList::getEntries(ScriptContext *context, const ScriptValue &thisObject,
+                                                       const ScriptArguments &arguments, void *data,
+                                                       ScriptValue *exception) {
+  auto entryList = static_cast<JSPerformanceObserverEntryList *>(data);
+  return buildPerformanceEntryList(context, entryList->m_entries);
+}
+
+ScriptValue JSPerformanceObserverEntryList::getEntriesByType(ScriptContext *context, const ScriptValue &thisObject,
+                                                             const ScriptArguments &arguments, void *data,
+                                                             ScriptValue *exception) {
+  if (arguments.size() == 0) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'getEntriesByType' on "
+                                                 "'PerformanceObserverEntryList': 1 argument required, but only 0 "
+                                                 "present.");
+    return ScriptValue();
+  }
+
+  std::string entryType = arguments[0].toString();
+
+  auto entryList = static_cast<JSPerformanceObserverEntryList *>(data);
+  PerformanceEntryList entries;
+  std::copy_if(entryList->m_entries.begin(), entryList->m_entries.end(), std::back_inserter(entries),
+               [&entryType](auto &entry) { return entry->entryType == entryType; });
+  return buildPerformanceEntryList(context, entries);
+}
+
+ScriptValue JSPerformanceObserverEntryList::getEntriesByName(ScriptContext *context, const ScriptValue &thisObject,
+                                                             const ScriptArguments &arguments, void *data,
+                                                             ScriptValue *exception) {
+  if (arguments.size() == 0) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'getEntriesByName' on "
+                                                 "'PerformanceObserverEntryList': 1 argument required, but only 0 "
+                                                 "present.");
+    return ScriptValue();
+  }
+
+  std::string name = arguments[0].toString();
+  std::string entryType;
+  if (arguments.size() > 1 && !arguments[1].isUndefined()) {
+    entryType = arguments[1].toString();
+  }
+
+  auto entryList = static_cast<JSPerformanceObserverEntryList *>(data);
+  PerformanceEntryList entries;
+  std::copy_if(entryList->m_entries.begin(), entryList->m_entries.end(), std::back_inserter(entries),
+               [&name, &entryType](auto &entry) {
+                 return entry->name == name && (entryType.empty() || entry->entryType == entryType);
+               });
+  return buildPerformanceEntryList(context, entries);
+}
+
+std::unordered_map<ScriptContext *, JSPerformanceObserver *> JSPerformanceObserver::instanceMap{};
+
+JSPerformanceObserver *JSPerformanceObserver::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSPerformanceObserver(context);
+  }
+  return instanceMap[context];
+}
+
+JSPerformanceObserver::~JSPerformanceObserver() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSPerformanceObserver::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (!arguments[0].isFunction()) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to construct 'PerformanceObserver': parameter 1 (callback) must be a function.");
+    return ScriptValue();
+  }
+
+  auto instance = new PerformanceObserverInstance(this, arguments[0]);
+  return instance->value();
+}
+
+ScriptValue JSPerformanceObserver::getProperty(const std::string &name, ScriptValue *exception) {
+  auto propertyMap = getPerformanceObserverPropertyMap();
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+    switch (property) {
+    case PerformanceObserverProperty::supportedEntryTypes: {
+      std::vector<ScriptValue> entryTypes;
+      for (auto &entryType : supportedEntryTypes()) {
+        entryTypes.emplace_back(ScriptValue::makeString(context, entryType));
+      }
+      return ScriptValue::makeArray(context, entryTypes);
+    }
+    }
+  }
+
+  return HostClass::getProperty(name, exception);
+}
+
+ScriptValue JSPerformanceObserver::observe(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<PerformanceObserverInstance>(thisObject);
+  if (instance == nullptr || instance->_hostClass != data) return ScriptValue();
+
+  const ScriptValue options = arguments[0];
+  if (!options.isObject()) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'observe' on 'PerformanceObserver': parameter 1 ('options') is not an object.");
+    return ScriptValue();
+  }
+
+  ScriptValue entryTypesValue = options.getProperty("entryTypes", exception);
+  if (entryTypesValue.empty()) return ScriptValue();
+  ScriptValue typeValue = options.getProperty("type", exception);
+  if (typeValue.empty()) return ScriptValue();
+  bool hasEntryTypes = !entryTypesValue.isUndefined();
+  bool hasType = !typeValue.isUndefined();
+
+  if (hasEntryTypes == hasType) {
+    *exception = ScriptValue::makeError(
+      context, hasType ? "Failed to execute 'observe' on 'PerformanceObserver': An observe() call must not include "
+                         "both entryTypes and type arguments."
+                       : "Failed to execute 'observe' on 'PerformanceObserver': An observe() call must include "
+                         "either entryTypes or type arguments.");
+    return ScriptValue();
+  }
+
+  using ObserverType = PerformanceObserverInstance::ObserverType;
+  ObserverType observerType = hasEntryTypes ? ObserverType::multiple : ObserverType::single;
+  if (instance->m_observerType != ObserverType::undefined && instance->m_observerType != observerType) {
+    *exception = ScriptValue::makeError(context, "InvalidModificationError: Failed to execute 'observe' on "
+                                                 "'PerformanceObserver': This observer has already been registered "
+                                                 "with a different type of observe() call.");
+    return ScriptValue();
+  }
+
+  if (hasEntryTypes) {
+    if (!entryTypesValue.isArray()) {
+      *exception = ScriptValue::makeError(context, "Failed to execute 'observe' on 'PerformanceObserver': The "
+                                                   "provided value cannot be converted to a sequence.");
+      return ScriptValue();
+    }
+
+    auto length = static_cast<uint32_t>(entryTypesValue.getProperty("length", exception).toNumber());
+    std::vector<std::string> entryTypes;
+    for (uint32_t i = 0; i < length; i++) {
+      ScriptValue entryTypeValue = entryTypesValue.getIndex(i, exception);
+      if (entryTypeValue.empty()) return ScriptValue();
+      std::string entryType = entryTypeValue.toString();
+      if (isSupportedEntryType(entryType) &&
+          std::find(entryTypes.begin(), entryTypes.end(), entryType) == entryTypes.end()) {
+        entryTypes.emplace_back(entryType);
+      }
+    }
+
+    // Unsupported entry types are ignored, an observer without any supported type is not registered.
+    if (entryTypes.empty()) return ScriptValue();
+    instance->m_observerType = observerType;
+    instance->m_entryTypes = std::move(entryTypes);
+    instance->registerObserver();
+    return ScriptValue();
+  }
+
+  std::string type = typeValue.toString();
+  if (!isSupportedEntryType(type)) return ScriptValue();
+
+  instance->m_observerType = observerType;
+  auto &entryTypes = instance->m_entryTypes;
+  if (std::find(entryTypes.begin(), entryTypes.end(), type) == entryTypes.end()) entryTypes.emplace_back(type);
+  instance->registerObserver();
+
+  bool buffered = options.getProperty("buffered", exception).toBoolean();
+  if (buffered && instance->m_performance != nullptr) {
+    PerformanceEntryList entries = instance->m_performance->entries.entriesByType(type);
+    if (!entries.empty()) {
+      instance->m_records.insert(instance->m_records.end(), entries.begin(), entries.end());
+      instance->m_performance->queueObserverDelivery();
+    }
+  }
+
+  return ScriptValue();
+}
+
+ScriptValue JSPerformanceObserver::disconnect(ScriptContext *context, const ScriptValue &thisObject,
+                                              const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<PerformanceObserverInstance>(thisObject);
+  if (instance == nullptr || instance->_hostClass != data) return ScriptValue();
+  instance->disconnect();
+  return ScriptValue();
+}
+
+ScriptValue JSPerformanceObserver::takeRecords(ScriptContext *context, const ScriptValue &thisObject,
+                                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<PerformanceObserverInstance>(thisObject);
+  if (instance == nullptr || instance->_hostClass != data) return ScriptValue();
+
+  PerformanceEntryList records;
+  records.swap(instance->m_records);
+  return buildPerformanceEntryList(context, records);
+}
+
+JSPerformanceObserver::PerformanceObserverInstance::PerformanceObserverInstance(
+  JSPerformanceObserver *jsPerformanceObserver, const ScriptValue &callback)
+  : Instance(jsPerformanceObserver), m_performance(NativePerformance::instance(jsPerformanceObserver->context)),
+    m_callback(callback) {}
+
+JSPerformanceObserver::PerformanceObserverInstance::~PerformanceObserverInstance() {
+  if (m_registered) m_performance->removeObserver(this);
+}
+
+void JSPerformanceObserver::PerformanceObserverInstance::registerObserver() {
+  if (m_registered || m_performance == nullptr) return;
+  m_registered = true;
+  m_performance->addObserver(this);
+  m_self = value();
+}
+
+void JSPerformanceObserver::PerformanceObserverInstance::disconnect() {
+  m_records.clear();
+  m_entryTypes.clear();
+  m_observerType = ObserverType::undefined;
+  if (!m_registered) return;
+  m_registered = false;
+  m_performance->removeObserver(this);
+  m_self = ScriptValue();
+}
+
+void JSPerformanceObserver::PerformanceObserverInstance::detach() {
+  // The context is being released, the observer is deleted with its other host objects.
+  m_registered = false;
+  m_performance = nullptr;
+}
+
+bool JSPerformanceObserver::PerformanceObserverInstance::queueEntry(
+  const std::shared_ptr<NativePerformanceEntry> &entry) {
+  if (std::find(m_entryTypes.begin(), m_entryTypes.end(), entry->entryType) == m_entryTypes.end()) return false;
+  m_records.emplace_back(entry);
+  return true;
+}
+
+void JSPerformanceObserver::PerformanceObserverInstance::deliver() {
+  if (m_records.empty()) return;
+
+  auto entryList = new JSPerformanceObserverEntryList(context, std::move(m_records));
+  m_records.clear();
+
+  ScriptValue object = value();
+  m_callback.call(object, {entryList->value(), object}, nullptr);
+}
+
+void bindPerformanceObserver(ScriptContext *context) {
+  auto PerformanceObserver = JSPerformanceObserver::instance(context);
+  bindGlobalValue(context, JSPerformanceObserverName, PerformanceObserver->classObject);
+}
+
+} // namespace kraken::binding
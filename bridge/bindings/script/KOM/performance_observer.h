@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_PERFORMANCE_OBSERVER_H
+#define KRAKENBRIDGE_SCRIPT_PERFORMANCE_OBSERVER_H
+
+#include "bindings/script/KOM/performance.h"
+#include "bindings/script/host_class.h"
+#include <unordered_map>
+
+#define JSPerformanceObserverName "PerformanceObserver"
+
+namespace kraken::binding {
+
+void bindPerformanceObserver(ScriptContext *context);
+
+// Entries handed to a PerformanceObserver callback.
+class JSPerformanceObserverEntryList : public HostObject {
+public:
+  JSPerformanceObserverEntryList() = delete;
+  explicit JSPerformanceObserverEntryList(ScriptContext *context, PerformanceEntryList entries)
+    : HostObject(context, "PerformanceObserverEntryList"), m_entries(std::move(entries)){};
+
+private:
+  static ScriptValue getEntries(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getEntriesByType(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getEntriesByName(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  FunctionHolder m_getEntries{context, value(), this, "getEntries", getEntries};
+  FunctionHolder m_getEntriesByType{context, value(), this, "getEntriesByType", getEntriesByType};
+  FunctionHolder m_getEntriesByName{context, value(), this, "getEntriesByName", getEntriesByName};
+  PerformanceEntryList m_entries;
+};
+
+class JSPerformanceObserver : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, JSPerformanceObserver *> instanceMap;
+  static JSPerformanceObserver *instance(ScriptContext *context);
+  DEFINE_OBJECT_PROPERTY(PerformanceObserver, 1, supportedEntryTypes);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+
+  class PerformanceObserverInstance : public Instance, public PerformanceEntryObserver {
+  public:
+    PerformanceObserverInstance() = delete;
+    explicit PerformanceObserverInstance(JSPerformanceObserver *jsPerformanceObserver, const ScriptValue &callback);
+    ~PerformanceObserverInstance() override;
+
+    bool queueEntry(const std::shared_ptr<NativePerformanceEntry> &entry) override;
+    void deliver() override;
+    void detach() override;
+
+  private:
+    friend JSPerformanceObserver;
+    // https://w3c.github.io/performance-timeline/#dfn-observer-type, an observer can't switch between observe()
+    // with entryTypes and with type.
+    enum class ObserverType { undefined, multiple, single };
+
+    void registerObserver();
+    void disconnect();
+
+    // Null once performance is disposed.
+    NativePerformance *m_performance;
+    ScriptValue m_callback;
+    // A registered observer is kept alive by performance until it disconnects.
+    ScriptValue m_self;
+    ObserverType m_observerType{ObserverType::undefined};
+    std::vector<std::string> m_entryTypes;
+    PerformanceEntryList m_records;
+    bool m_registered{false};
+  };
+
+protected:
+  JSPerformanceObserver() = delete;
+  explicit JSPerformanceObserver(ScriptContext *context) : HostClass(context, JSPerformanceObserverName){};
+  ~JSPerformanceObserver() override;
+
+private:
+  static ScriptValue observe(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+  static ScriptValue disconnect(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue takeRecords(ScriptContext *context, const ScriptValue &thisObject,
+                                 const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  FunctionHolder m_observe{context, prototypeObject, this, "observe", observe};
+  FunctionHolder m_disconnect{context, prototypeObject, this, "disconnect", disconnect};
+  FunctionHolder m_takeRecords{context, prototypeObject, this, "takeRecords", takeRecords};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_PERFORMANCE_OBSERVER_H
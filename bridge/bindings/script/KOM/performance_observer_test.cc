@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/KOM/performance.h"
+#include "test/bridge_fixture.h"
+
+using namespace kraken::binding;
+
+using PerformanceObserverTest = kraken::test::BridgeFixture;
+
+// Performance is disposed by the bridge before the context finalizes the observers registered to it.
+TEST_F(PerformanceObserverTest, disposingContextWithLiveObserver) {
+  evaluate(u"var observer = new PerformanceObserver(function() {});"
+           u"observer.observe({type: 'mark'});"
+           u"performance.mark('live');");
+  int32_t uniqueId = context()->uniqueId;
+  EXPECT_EQ(NativePerformance::instanceMap.count(uniqueId), 1);
+
+  disposeContext(contextId);
+  EXPECT_EQ(NativePerformance::instanceMap.count(uniqueId), 0);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/KOM/performance.h"
+#include "foundation/monotonic_clock.h"
+#include "test/bridge_fixture.h"
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace kraken::binding;
+
+namespace {
+
+std::shared_ptr<NativePerformanceEntry> makeMark(const std::string &name, int64_t startTime = 0) {
+  return std::make_shared<NativePerformanceEntry>(name, PERFORMANCE_ENTRY_TYPE_MARK, startTime, 0, -1);
+}
+
+std::shared_ptr<NativePerformanceEntry> makeMeasure(const std::string &name) {
+  return std::make_shared<NativePerformanceEntry>(name, PERFORMANCE_ENTRY_TYPE_MEASURE, 0, 0, -1);
+}
+
+std::vector<std::string> namesOf(const PerformanceEntryList &entries) {
+  std::vector<std::string> names;
+  for (auto &entry : entries) names.emplace_back(entry->name);
+  return names;
+}
+
+// Performance of a context whose clock is frozen by setTime().
+class PerformanceClockTest : public kraken::test::BridgeFixture {
+protected:
+  // Freeze the context clock at the given milliseconds since time origin.
+  void setTime(double milliseconds) {
+    auto clock = bridge->getContext()->getClock();
+    auto time = std::chrono::microseconds(std::llround(milliseconds * 1000));
+    auto timeOrigin = clock->timeOrigin();
+    clock->setTimeSource([timeOrigin, time]() { return timeOrigin + time; });
+  }
+
+  double evaluateNumber(const std::u16string &expression) {
+    evaluate(u"var result = " + expression + u";");
+    return globalObject(context()).getProperty("result", nullptr).toNumber();
+  }
+};
+
+} // namespace
+
+TEST(PerformanceEntryBuffer, dropsTheOldestEntryWhenFull) {
+  PerformanceEntryBuffer buffer(3);
+  for (int i = 0; i < 5; i++) buffer.add(makeMark(std::to_string(i)));
+  EXPECT_EQ(namesOf(buffer.entries()), std::vector<std::string>({"2", "3", "4"}));
+  EXPECT_EQ(buffer.droppedCount(), 2);
+  EXPECT_TRUE(buffer.entriesByName("0").empty());
+  EXPECT_EQ(buffer.entriesByType(PERFORMANCE_ENTRY_TYPE_MARK).size(), 3);
+}
+
+TEST(PerformanceEntryBuffer, indexesByNameAndType) {
+  PerformanceEntryBuffer buffer(10);
+  buffer.add(makeMark("a"));
+  buffer.add(makeMeasure("a"));
+  buffer.add(makeMark("b"));
+  EXPECT_EQ(buffer.entriesByName("a").size(), 2);
+  EXPECT_EQ(namesOf(buffer.entriesByType(PERFORMANCE_ENTRY_TYPE_MARK)), std::vector<std::string>({"a", "b"}));
+  EXPECT_TRUE(buffer.entriesByName("missing").empty());
+}
+
+TEST(PerformanceEntryBuffer, clearsByTypeAndName) {
+  PerformanceEntryBuffer buffer(10);
+  buffer.add(makeMark("a"));
+  buffer.add(makeMeasure("a"));
+  buffer.add(makeMark("b"));
+
+  std::string name = "a";
+  buffer.clear(PERFORMANCE_ENTRY_TYPE_MARK, &name);
+  EXPECT_EQ(namesOf(buffer.entriesByType(PERFORMANCE_ENTRY_TYPE_MARK)), std::vector<std::string>({"b"}));
+  EXPECT_EQ(buffer.entriesByName("a").size(), 1);
+
+  buffer.clear(PERFORMANCE_ENTRY_TYPE_MEASURE, nullptr);
+  EXPECT_EQ(namesOf(buffer.entries()), std::vector<std::string>({"b"}));
+  // Cleared entries are not dropped ones.
+  EXPECT_EQ(buffer.droppedCount(), 0);
+}
+
+TEST(PerformanceEntryBuffer, shrinkingDropsTheOldestEntries) {
+  PerformanceEntryBuffer buffer(4);
+  for (int i = 0; i < 4; i++) buffer.add(makeMark(std::to_string(i)));
+  buffer.setCapacity(2);
+  EXPECT_EQ(namesOf(buffer.entries()), std::vector<std::string>({"2", "3"}));
+  EXPECT_EQ(buffer.droppedCount(), 2);
+
+  buffer.add(makeMark("4"));
+  EXPECT_EQ(namesOf(buffer.entries()), std::vector<std::string>({"3", "4"}));
+  buffer.setCapacity(0);
+  EXPECT_EQ(buffer.droppedCount(), 5);
+}
+
+// A zero capacity buffer is full from the start, every entry added to it is dropped.
+TEST(PerformanceEntryBuffer, countsEntriesAddedWithoutRoomAsDropped) {
+  PerformanceEntryBuffer buffer(0);
+  buffer.add(makeMark("0"));
+  buffer.add(makeMeasure("1"));
+  EXPECT_EQ(buffer.size(), 0);
+  EXPECT_TRUE(buffer.entriesByName("0").empty());
+  EXPECT_EQ(buffer.droppedCount(), 2);
+
+  buffer.setCapacity(1);
+  buffer.add(makeMark("2"));
+  EXPECT_EQ(namesOf(buffer.entries()), std::vector<std::string>({"2"}));
+  EXPECT_EQ(buffer.droppedCount(), 2);
+}
+
+TEST_F(PerformanceClockTest, nowKeepsSubMillisecondPrecision) {
+  setTime(12.345);
+  EXPECT_EQ(evaluateNumber(u"performance.now()"), 12.345);
+}
+
+TEST_F(PerformanceClockTest, marksAndMeasuresUseTheSameClockAsNow) {
+  setTime(10);
+  evaluate(u"performance.mark('clock_start');");
+  setTime(25.5);
+  evaluate(u"performance.mark('clock_end');"
+           u"performance.measure('clock_cost', 'clock_start', 'clock_end');");
+  EXPECT_EQ(evaluateNumber(u"performance.getEntriesByName('clock_start')[0].startTime"), 10);
+  EXPECT_EQ(evaluateNumber(u"performance.getEntriesByName('clock_cost')[0].startTime"), 10);
+  EXPECT_EQ(evaluateNumber(u"performance.getEntriesByName('clock_cost')[0].duration"), 15.5);
+}
+
+TEST_F(PerformanceClockTest, eventTimeStampIsRelativeToTimeOrigin) {
+  setTime(42.5);
+  EXPECT_EQ(evaluateNumber(u"new Event('clock').timeStamp"), 42.5);
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2019 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "screen.h"
+#include "dart_methods.h"
+
+namespace kraken::binding {
+
+ScriptValue JSScreen::getProperty(const std::string &name, ScriptValue *exception) {
+  bool isWidth = name == "width" || name == "availWidth";
+  bool isHeight = name == "height" || name == "availHeight";
+  if (!isWidth && !isHeight) return HostObject::getProperty(name, exception);
+
+  if (getDartMethod()->getScreen == nullptr) {
+    *exception = ScriptValue::makeError(context, "Failed to read screen: dart method (getScreen) is not registered.");
+    return ScriptValue();
+  }
+
+  Screen *screen = getDartMethod()->getScreen(contextId);
+  return ScriptValue::makeNumber(context, isWidth ? screen->width : screen->height);
+}
+
+void JSScreen::getPropertyNames(std::vector<std::string> &names) {
+  names.insert(names.end(), {"width", "height", "availWidth", "availHeight"});
+}
+
+void bindScreen(ScriptContext *context) {
+  bindGlobalValue(context, "screen", (new JSScreen(context))->value());
+}
+
+} // namespace kraken::binding
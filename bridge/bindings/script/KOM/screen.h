@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_SCREEN_H
+#define KRAKENBRIDGE_SCRIPT_SCREEN_H
+
+#include "bindings/script/host_object.h"
+
+namespace kraken::binding {
+
+class JSScreen : public HostObject {
+public:
+  explicit JSScreen(ScriptContext *context) : HostObject(context, "Screen") {}
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+};
+
+void bindScreen(ScriptContext *context);
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_SCREEN_H
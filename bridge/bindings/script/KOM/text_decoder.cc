@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "text_decoder.h"
+
+namespace kraken::binding {
+
+namespace {
+
+bool getBooleanOption(const ScriptValue &options, const char *name, ScriptValue *exception) {
+  if (!options.isObject()) return false;
+  return options.getProperty(name, exception).toBoolean();
+}
+
+} // namespace
+
+std::unordered_map<ScriptContext *, JSTextDecoder *> JSTextDecoder::instanceMap{};
+
+JSTextDecoder *JSTextDecoder::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSTextDecoder(context);
+  }
+  return instanceMap[context];
+}
+
+JSTextDecoder::~JSTextDecoder() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSTextDecoder::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  std::string label = "utf-8";
+  if (!arguments[0].isUndefined()) {
+    label = arguments[0].toString();
+  }
+
+  ::foundation::TextEncoding encoding;
+  if (!::foundation::getTextEncoding(label, encoding)) {
+    std::string message =
+      "Failed to construct 'TextDecoder': The encoding label provided ('" + label + "') is invalid.";
+    *exception = ScriptValue::makeRangeError(context, message);
+    return ScriptValue();
+  }
+
+  bool fatal = getBooleanOption(arguments[1], "fatal", exception);
+  bool ignoreBOM = getBooleanOption(arguments[1], "ignoreBOM", exception);
+  auto instance = new TextDecoderInstance(this, encoding, fatal, ignoreBOM);
+  return instance->value();
+}
+
+ScriptValue JSTextDecoder::decode(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<TextDecoderInstance>(thisObject);
+  if (instance == nullptr || instance->_hostClass != data) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  uint8_t *bytes = nullptr;
+  size_t length = 0;
+  if (!arguments[0].isUndefined()) {
+    bytes = arguments[0].bufferSourceBytes(&length);
+    if (bytes == nullptr) {
+      *exception = ScriptValue::makeError(context, "Failed to execute 'decode' on 'TextDecoder': The provided value is "
+                                                   "not of type '(ArrayBuffer or ArrayBufferView)'.");
+      return ScriptValue();
+    }
+  }
+
+  bool stream = getBooleanOption(arguments[1], "stream", exception);
+
+  std::u16string result;
+  if (!instance->m_decoder.decode(bytes, length, stream, result)) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'decode' on 'TextDecoder': The encoded data was not valid.");
+    return ScriptValue();
+  }
+
+  return ScriptValue::makeString(context, result);
+}
+
+ScriptValue JSTextDecoder::TextDecoderInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto propertyMap = getTextDecoderPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+    switch (property) {
+    case TextDecoderProperty::encoding:
+      return ScriptValue::makeString(context, std::string(::foundation::getTextEncodingName(m_decoder.encoding())));
+    case TextDecoderProperty::fatal:
+      return ScriptValue::makeBoolean(context, m_decoder.fatal());
+    case TextDecoderProperty::ignoreBOM:
+      return ScriptValue::makeBoolean(context, m_decoder.ignoreBOM());
+    }
+  }
+
+  return Instance::getProperty(name, exception);
+}
+
+void JSTextDecoder::TextDecoderInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getTextDecoderPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+void bindTextDecoder(ScriptContext *context) {
+  auto TextDecoder = JSTextDecoder::instance(context);
+  bindGlobalValue(context, JSTextDecoderName, TextDecoder->classObject);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_TEXT_DECODER_H
+#define KRAKENBRIDGE_SCRIPT_TEXT_DECODER_H
+
+#include "bindings/script/host_class.h"
+#include "foundation/text_codec.h"
+#include <unordered_map>
+
+#define JSTextDecoderName "TextDecoder"
+
+namespace kraken::binding {
+
+void bindTextDecoder(ScriptContext *context);
+
+class JSTextDecoder : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, JSTextDecoder *> instanceMap;
+  static JSTextDecoder *instance(ScriptContext *context);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class TextDecoderInstance : public Instance {
+  public:
+    DEFINE_OBJECT_PROPERTY(TextDecoder, 3, encoding, fatal, ignoreBOM);
+
+    TextDecoderInstance() = delete;
+    explicit TextDecoderInstance(JSTextDecoder *jsTextDecoder, ::foundation::TextEncoding encoding, bool fatal,
+                                 bool ignoreBOM)
+      : Instance(jsTextDecoder), m_decoder(encoding, fatal, ignoreBOM){};
+
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+  private:
+    friend JSTextDecoder;
+    // Keeps incomplete sequences between decode() calls in stream mode.
+    ::foundation::TextDecoder m_decoder;
+  };
+
+protected:
+  JSTextDecoder() = delete;
+  explicit JSTextDecoder(ScriptContext *context) : HostClass(context, JSTextDecoderName){};
+  ~JSTextDecoder() override;
+
+private:
+  static ScriptValue decode(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+
+  FunctionHolder m_decode{context, prototypeObject, this, "decode", decode};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_TEXT_DECODER_H
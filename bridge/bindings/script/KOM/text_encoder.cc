@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "text_encoder.h"
+#include "foundation/text_codec.h"
+
+namespace kraken::binding {
+
+std::unordered_map<ScriptContext *, JSTextEncoder *> JSTextEncoder::instanceMap{};
+
+JSTextEncoder *JSTextEncoder::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSTextEncoder(context);
+  }
+  return instanceMap[context];
+}
+
+JSTextEncoder::~JSTextEncoder() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSTextEncoder::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new TextEncoderInstance(this);
+  return instance->value();
+}
+
+ScriptValue JSTextEncoder::encode(ScriptContext *context, const ScriptValue &thisObject,
+                                  const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  std::string bytes;
+  if (!arguments[0].isUndefined()) {
+    std::u16string input = arguments[0].toU16String();
+    ::foundation::encodeUTF8(input.c_str(), input.size(), bytes);
+  }
+  return ScriptValue::makeUint8Array(context, reinterpret_cast<const uint8_t *>(bytes.data()), bytes.size());
+}
+
+ScriptValue JSTextEncoder::encodeInto(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf(thisObject);
+  if (instance == nullptr || instance->_hostClass != data) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  if (arguments.size() < 2) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'encodeInto' on 'TextEncoder': 2 arguments required.");
+    return ScriptValue();
+  }
+
+  size_t capacity = 0;
+  uint8_t *destination = arguments[1].uint8ArrayBytes(&capacity);
+  if (destination == nullptr) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'encodeInto' on 'TextEncoder': parameter 2 is not of type 'Uint8Array'.");
+    return ScriptValue();
+  }
+
+  std::u16string source = arguments[0].toU16String();
+  size_t read = 0;
+  size_t written = 0;
+  ::foundation::encodeUTF8Into(source.c_str(), source.size(), destination, capacity, read, written);
+
+  ScriptValue result = ScriptValue::makeObject(context);
+  result.setProperty("read", ScriptValue::makeNumber(context, read), nullptr);
+  result.setProperty("written", ScriptValue::makeNumber(context, written), nullptr);
+  return result;
+}
+
+ScriptValue JSTextEncoder::TextEncoderInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  if (name == "encoding") return ScriptValue::makeString(context, std::string("utf-8"));
+  return Instance::getProperty(name, exception);
+}
+
+void JSTextEncoder::TextEncoderInstance::getPropertyNames(std::vector<std::string> &names) {
+  names.emplace_back("encoding");
+}
+
+void bindTextEncoder(ScriptContext *context) {
+  auto TextEncoder = JSTextEncoder::instance(context);
+  bindGlobalValue(context, JSTextEncoderName, TextEncoder->classObject);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_TEXT_ENCODER_H
+#define KRAKENBRIDGE_SCRIPT_TEXT_ENCODER_H
+
+#include "bindings/script/host_class.h"
+#include <unordered_map>
+
+#define JSTextEncoderName "TextEncoder"
+
+namespace kraken::binding {
+
+void bindTextEncoder(ScriptContext *context);
+
+class JSTextEncoder : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, JSTextEncoder *> instanceMap;
+  static JSTextEncoder *instance(ScriptContext *context);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class TextEncoderInstance : public Instance {
+  public:
+    TextEncoderInstance() = delete;
+    explicit TextEncoderInstance(JSTextEncoder *jsTextEncoder) : Instance(jsTextEncoder) {}
+
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+  };
+
+protected:
+  JSTextEncoder() = delete;
+  explicit JSTextEncoder(ScriptContext *context) : HostClass(context, JSTextEncoderName) {}
+  ~JSTextEncoder() override;
+
+private:
+  static ScriptValue encode(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue encodeInto(ScriptContext *context, const ScriptValue &thisObject,
+                                const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  FunctionHolder m_encode{context, prototypeObject, this, "encode", encode};
+  FunctionHolder m_encodeInto{context, prototypeObject, this, "encodeInto", encodeInto};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_TEXT_ENCODER_H
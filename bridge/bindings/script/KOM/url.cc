@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "url.h"
+
+namespace kraken::binding {
+
+using ::foundation::PercentEncodeSet;
+using ::foundation::URLParser;
+using ::foundation::URLParserState;
+using ::foundation::URLRecord;
+
+namespace {
+
+std::u32string toCodePoints(const ScriptValue &value) {
+  std::u16string units = value.toU16String();
+  return ::foundation::toCodePoints(units.c_str(), units.size());
+}
+
+} // namespace
+
+std::unordered_map<ScriptContext *, JSURL *> JSURL::instanceMap{};
+
+JSURL *JSURL::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSURL(context);
+  }
+  return instanceMap[context];
+}
+
+JSURL::JSURL(ScriptContext *context) : HostClass(context, JSURLName) {}
+
+JSURL::~JSURL() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSURL::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  if (arguments.size() == 0) {
+    *exception = ScriptValue::makeError(context, "Failed to construct 'URL': 1 argument required, but only 0 present.");
+    return ScriptValue();
+  }
+
+  URLRecord base;
+  bool hasBase = !arguments[1].isUndefined();
+  if (hasBase && !URLParser::parse(toCodePoints(arguments[1]), nullptr, base)) {
+    *exception = ScriptValue::makeError(context, "Failed to construct 'URL': Invalid base URL");
+    return ScriptValue();
+  }
+
+  auto url = std::make_shared<URLRecord>();
+  if (!URLParser::parse(toCodePoints(arguments[0]), hasBase ? &base : nullptr, *url)) {
+    *exception = ScriptValue::makeError(context, "Failed to construct 'URL': Invalid URL");
+    return ScriptValue();
+  }
+
+  auto instance = new URLInstance(this, std::move(url));
+  return instance->value();
+}
+
+ScriptValue JSURL::toString(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<URLInstance>(thisObject);
+  if (instance == nullptr || instance->_hostClass != data) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  return ScriptValue::makeString(context, instance->m_url->serialize());
+}
+
+JSURL::URLInstance::URLInstance(JSURL *jsURL, std::shared_ptr<URLRecord> url)
+  : Instance(jsURL), m_url(std::move(url)) {
+  m_searchParams = new JSURLSearchParams::URLSearchParamsInstance(JSURLSearchParams::instance(context), m_url);
+  m_searchParamsObject = m_searchParams->value();
+}
+
+JSURL::URLInstance::~URLInstance() = default;
+
+ScriptValue JSURL::URLInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto propertyMap = getURLPropertyMap();
+
+  if (propertyMap.count(name) == 0) return Instance::getProperty(name, exception);
+
+  std::string result;
+  switch (propertyMap[name]) {
+  case URLProperty::href:
+    result = m_url->serialize();
+    break;
+  case URLProperty::origin:
+    result = m_url->origin();
+    break;
+  case URLProperty::protocol:
+    result = m_url->scheme + ":";
+    break;
+  case URLProperty::username:
+    result = m_url->username;
+    break;
+  case URLProperty::password:
+    result = m_url->password;
+    break;
+  case URLProperty::host:
+    if (m_url->host) {
+      result = *m_url->host;
+      if (m_url->port) result += ":" + std::to_string(*m_url->port);
+    }
+    break;
+  case URLProperty::hostname:
+    result = m_url->host.value_or("");
+    break;
+  case URLProperty::port:
+    if (m_url->port) result = std::to_string(*m_url->port);
+    break;
+  case URLProperty::pathname:
+    result = m_url->serializePath();
+    break;
+  case URLProperty::search:
+    if (m_url->query && !m_url->query->empty()) result = "?" + *m_url->query;
+    break;
+  case URLProperty::searchParams:
+    return m_searchParamsObject;
+  case URLProperty::hash:
+    if (m_url->fragment && !m_url->fragment->empty()) result = "#" + *m_url->fragment;
+    break;
+  }
+
+  return ScriptValue::makeString(context, result);
+}
+
+// https://url.spec.whatwg.org/#urlutils-members, invalid values are ignored except for href.
+bool JSURL::URLInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto propertyMap = getURLPropertyMap();
+  if (propertyMap.count(name) == 0) return Instance::setProperty(name, value, exception);
+
+  std::u32string input = toCodePoints(value);
+  URLRecord &url = *m_url;
+
+  switch (propertyMap[name]) {
+  case URLProperty::href: {
+    URLRecord parsed;
+    if (!URLParser::parse(input, nullptr, parsed)) {
+      *exception = ScriptValue::makeError(context, "Failed to set the 'href' property on 'URL': Invalid URL");
+      return true;
+    }
+    url = std::move(parsed);
+    m_searchParams->resetList(url.query.value_or(""));
+    break;
+  }
+  case URLProperty::protocol:
+    URLParser::parse(input + U":", nullptr, url, URLParserState::SchemeStart);
+    break;
+  case URLProperty::username:
+    if (url.cannotHaveUsernamePasswordPort()) break;
+    url.username = ::foundation::percentEncode(input, PercentEncodeSet::Userinfo);
+    break;
+  case URLProperty::password:
+    if (url.cannotHaveUsernamePasswordPort()) break;
+    url.password = ::foundation::percentEncode(input, PercentEncodeSet::Userinfo);
+    break;
+  case URLProperty::host:
+    if (!url.hasOpaquePath) URLParser::parse(input, nullptr, url, URLParserState::Host);
+    break;
+  case URLProperty::hostname:
+    if (!url.hasOpaquePath) URLParser::parse(input, nullptr, url, URLParserState::Hostname);
+    break;
+  case URLProperty::port:
+    if (url.cannotHaveUsernamePasswordPort()) break;
+    if (input.empty()) {
+      url.port = std::nullopt;
+    } else {
+      URLParser::parse(input, nullptr, url, URLParserState::Port);
+    }
+    break;
+  case URLProperty::pathname:
+    if (url.hasOpaquePath) break;
+    url.path.clear();
+    URLParser::parse(input, nullptr, url, URLParserState::PathStart);
+    break;
+  case URLProperty::search:
+    if (input.empty()) {
+      url.query = std::nullopt;
+      m_searchParams->resetList("");
+      break;
+    }
+    if (input[0] == '?') input.erase(0, 1);
+    url.query = "";
+    URLParser::parse(input, nullptr, url, URLParserState::Query);
+    m_searchParams->resetList(*url.query);
+    break;
+  case URLProperty::hash:
+    if (input.empty()) {
+      url.fragment = std::nullopt;
+      break;
+    }
+    if (input[0] == '#') input.erase(0, 1);
+    url.fragment = "";
+    URLParser::parse(input, nullptr, url, URLParserState::Fragment);
+    break;
+  case URLProperty::origin:
+  case URLProperty::searchParams:
+    // Readonly attributes.
+    break;
+  }
+
+  return true;
+}
+
+void JSURL::URLInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getURLPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+void bindURL(ScriptContext *context) {
+  auto URL = JSURL::instance(context);
+  bindGlobalValue(context, JSURLName, URL->classObject);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_URL_H
+#define KRAKENBRIDGE_SCRIPT_URL_H
+
+#include "bindings/script/KOM/url_search_params.h"
+#include "bindings/script/host_class.h"
+#include "foundation/url_parser.h"
+#include <memory>
+#include <unordered_map>
+
+#define JSURLName "URL"
+
+namespace kraken::binding {
+
+void bindURL(ScriptContext *context);
+
+class JSURL : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, JSURL *> instanceMap;
+  static JSURL *instance(ScriptContext *context);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  class URLInstance : public Instance {
+  public:
+    DEFINE_OBJECT_PROPERTY(URL, 12, href, origin, protocol, username, password, host, hostname, port, pathname,
+                           search, searchParams, hash);
+
+    URLInstance() = delete;
+    explicit URLInstance(JSURL *jsURL, std::shared_ptr<::foundation::URLRecord> url);
+    ~URLInstance() override;
+
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+  private:
+    friend JSURL;
+    // Shared with searchParams, so that mutations of searchParams are reflected to the query.
+    std::shared_ptr<::foundation::URLRecord> m_url;
+    JSURLSearchParams::URLSearchParamsInstance *m_searchParams{nullptr};
+    ScriptValue m_searchParamsObject;
+  };
+
+protected:
+  JSURL() = delete;
+  explicit JSURL(ScriptContext *context);
+  ~JSURL() override;
+
+private:
+  static ScriptValue toString(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception);
+
+  FunctionHolder m_toString{context, prototypeObject, this, "toString", toString};
+  FunctionHolder m_toJSON{context, prototypeObject, this, "toJSON", toString};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_URL_H
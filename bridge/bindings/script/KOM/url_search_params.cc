@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "url_search_params.h"
+#include <algorithm>
+
+namespace kraken::binding {
+
+using ::foundation::FormURLEncodedList;
+
+namespace {
+
+enum class IteratorKind { keys, values, entries };
+
+JSURLSearchParams::URLSearchParamsInstance *toInstance(ScriptContext *context, void *data,
+                                                       const ScriptValue &thisObject, ScriptValue *exception) {
+  auto instance = HostClass::instanceOf<JSURLSearchParams::URLSearchParamsInstance>(thisObject);
+  if (instance == nullptr || instance->_hostClass != data) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return nullptr;
+  }
+  return instance;
+}
+
+bool checkArguments(ScriptContext *context, const char *method, size_t required, const ScriptArguments &arguments,
+                    ScriptValue *exception) {
+  if (arguments.size() >= required) return true;
+  std::string message = std::string("Failed to execute '") + method + "' on 'URLSearchParams': " +
+                        std::to_string(required) + " argument" + (required > 1 ? "s" : "") + " required, but only " +
+                        std::to_string(arguments.size()) + " present.";
+  *exception = ScriptValue::makeError(context, message);
+  return false;
+}
+
+// Create an iterator from an array of the current items, later mutations are not reflected.
+ScriptValue makeIterator(ScriptContext *context, const FormURLEncodedList &list, IteratorKind kind,
+                         ScriptValue *exception) {
+  std::vector<ScriptValue> items;
+  items.reserve(list.size());
+  for (auto &pair : list) {
+    if (kind == IteratorKind::keys) {
+      items.emplace_back(ScriptValue::makeString(context, pair.first));
+    } else if (kind == IteratorKind::values) {
+      items.emplace_back(ScriptValue::makeString(context, pair.second));
+    } else {
+      items.emplace_back(ScriptValue::makeArray(
+        context, {ScriptValue::makeString(context, pair.first), ScriptValue::makeString(context, pair.second)}));
+    }
+  }
+
+  ScriptValue array = ScriptValue::makeArray(context, items);
+  ScriptValue valuesFunction = array.getProperty("values", exception);
+  if (valuesFunction.empty()) return ScriptValue();
+  return valuesFunction.call(array, {}, exception);
+}
+
+} // namespace
+
+std::unordered_map<ScriptContext *, JSURLSearchParams *> JSURLSearchParams::instanceMap{};
+
+JSURLSearchParams *JSURLSearchParams::instance(ScriptContext *context) {
+  if (instanceMap.count(context) == 0) {
+    instanceMap[context] = new JSURLSearchParams(context);
+  }
+  return instanceMap[context];
+}
+
+JSURLSearchParams::JSURLSearchParams(ScriptContext *context) : HostClass(context, JSURLSearchParamsName) {
+  // URLSearchParams is iterable, the default iterator is entries().
+  ScriptValue global = globalObject(context);
+  ScriptValue object = global.getProperty("Object", nullptr);
+  ScriptValue iterator = global.getProperty("Symbol", nullptr).getProperty("iterator", nullptr);
+
+  ScriptValue descriptor = ScriptValue::makeObject(context);
+  descriptor.setProperty("value", prototypeObject.getProperty("entries", nullptr), nullptr);
+  descriptor.setProperty("writable", ScriptValue::makeBoolean(context, true), nullptr);
+  descriptor.setProperty("configurable", ScriptValue::makeBoolean(context, true), nullptr);
+  object.getProperty("defineProperty", nullptr).call(object, {prototypeObject, iterator, descriptor}, nullptr);
+}
+
+JSURLSearchParams::~JSURLSearchParams() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSURLSearchParams::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto instance = new URLSearchParamsInstance(this, nullptr);
+  const ScriptValue init = arguments[0];
+  if (init.isUndefined()) return instance->value();
+
+  FormURLEncodedList &list = instance->m_list;
+
+  if (init.isArray()) {
+    auto length = static_cast<uint32_t>(init.getProperty("length", exception).toNumber());
+    for (uint32_t i = 0; i < length; i++) {
+      ScriptValue pair = init.getIndex(i, exception);
+      if (!pair.isObject() || pair.getProperty("length", exception).toNumber() != 2) {
+        *exception = ScriptValue::makeError(
+          context, "Failed to construct 'URLSearchParams': Sequence initializer must only contain pair elements");
+        return ScriptValue();
+      }
+      list.emplace_back(pair.getIndex(0, exception).toU16String(), pair.getIndex(1, exception).toU16String());
+    }
+  } else if (init.isObject()) {
+    auto other = HostClass::instanceOf<URLSearchParamsInstance>(init);
+    if (other != nullptr && other->_hostClass == this) {
+      list = other->m_list;
+    } else {
+      for (auto &name : init.keys(exception)) {
+        list.emplace_back(ScriptValue::makeString(context, name).toU16String(),
+                          init.getProperty(name, exception).toU16String());
+      }
+    }
+  } else {
+    std::string query = init.toString();
+    if (!query.empty() && query[0] == '?') query.erase(0, 1);
+    list = ::foundation::parseFormURLEncoded(query);
+  }
+
+  return instance->value();
+}
+
+ScriptValue JSURLSearchParams::append(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr || !checkArguments(context, "append", 2, arguments, exception)) return ScriptValue();
+
+  instance->m_list.emplace_back(arguments[0].toU16String(), arguments[1].toU16String());
+  instance->update();
+  return ScriptValue();
+}
+
+ScriptValue JSURLSearchParams::remove(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr || !checkArguments(context, "delete", 1, arguments, exception)) return ScriptValue();
+
+  std::u16string name = arguments[0].toU16String();
+  auto &list = instance->m_list;
+  if (!arguments[1].isUndefined()) {
+    std::u16string value = arguments[1].toU16String();
+    list.erase(std::remove_if(list.begin(), list.end(),
+                              [&](auto &pair) { return pair.first == name && pair.second == value; }),
+               list.end());
+  } else {
+    list.erase(std::remove_if(list.begin(), list.end(), [&](auto &pair) { return pair.first == name; }), list.end());
+  }
+  instance->update();
+  return ScriptValue();
+}
+
+ScriptValue JSURLSearchParams::get(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr || !checkArguments(context, "get", 1, arguments, exception)) return ScriptValue();
+
+  std::u16string name = arguments[0].toU16String();
+  for (auto &pair : instance->m_list) {
+    if (pair.first == name) return ScriptValue::makeString(context, pair.second);
+  }
+  return ScriptValue::null(context);
+}
+
+ScriptValue JSURLSearchParams::getAll(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr || !checkArguments(context, "getAll", 1, arguments, exception)) return ScriptValue();
+
+  std::u16string name = arguments[0].toU16String();
+  std::vector<ScriptValue> values;
+  for (auto &pair : instance->m_list) {
+    if (pair.first == name) values.emplace_back(ScriptValue::makeString(context, pair.second));
+  }
+  return ScriptValue::makeArray(context, values);
+}
+
+ScriptValue JSURLSearchParams::has(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr || !checkArguments(context, "has", 1, arguments, exception)) return ScriptValue();
+
+  std::u16string name = arguments[0].toU16String();
+  bool matchValue = !arguments[1].isUndefined();
+  std::u16string value = matchValue ? arguments[1].toU16String() : u"";
+  for (auto &pair : instance->m_list) {
+    if (pair.first == name && (!matchValue || pair.second == value)) return ScriptValue::makeBoolean(context, true);
+  }
+  return ScriptValue::makeBoolean(context, false);
+}
+
+ScriptValue JSURLSearchParams::set(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr || !checkArguments(context, "set", 2, arguments, exception)) return ScriptValue();
+
+  std::u16string name = arguments[0].toU16String();
+  std::u16string value = arguments[1].toU16String();
+  auto &list = instance->m_list;
+  auto first = std::find_if(list.begin(), list.end(), [&](auto &pair) { return pair.first == name; });
+  if (first == list.end()) {
+    list.emplace_back(name, value);
+  } else {
+    first->second = value;
+    list.erase(std::remove_if(first + 1, list.end(), [&](auto &pair) { return pair.first == name; }), list.end());
+  }
+  instance->update();
+  return ScriptValue();
+}
+
+ScriptValue JSURLSearchParams::sort(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr) return ScriptValue();
+
+  // Stable sort by code units of names.
+  std::stable_sort(instance->m_list.begin(), instance->m_list.end(),
+                   [](auto &left, auto &right) { return left.first < right.first; });
+  instance->update();
+  return ScriptValue();
+}
+
+ScriptValue JSURLSearchParams::toString(ScriptContext *context, const ScriptValue &thisObject,
+                                        const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr) return ScriptValue();
+
+  return ScriptValue::makeString(context, ::foundation::serializeFormURLEncoded(instance->m_list));
+}
+
+ScriptValue JSURLSearchParams::forEach(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr || !checkArguments(context, "forEach", 1, arguments, exception)) return ScriptValue();
+
+  ScriptValue callback = arguments[0];
+  if (!callback.isFunction()) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'forEach' on 'URLSearchParams': parameter 1 is not "
+                                                 "a function.");
+    return ScriptValue();
+  }
+
+  ScriptValue callbackThis = arguments[1].isObject() ? arguments[1] : ScriptValue();
+
+  // The list may be mutated by callback, visit by index like the iterators of Web IDL.
+  for (size_t i = 0; i < instance->m_list.size(); i++) {
+    callback.call(callbackThis,
+                  {ScriptValue::makeString(context, instance->m_list[i].second),
+                   ScriptValue::makeString(context, instance->m_list[i].first), thisObject},
+                  exception);
+    if (!exception->empty()) break;
+  }
+  return ScriptValue();
+}
+
+ScriptValue JSURLSearchParams::keys(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr) return ScriptValue();
+  return makeIterator(context, instance->m_list, IteratorKind::keys, exception);
+}
+
+ScriptValue JSURLSearchParams::values(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr) return ScriptValue();
+  return makeIterator(context, instance->m_list, IteratorKind::values, exception);
+}
+
+ScriptValue JSURLSearchParams::entries(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto instance = toInstance(context, data, thisObject, exception);
+  if (instance == nullptr) return ScriptValue();
+  return makeIterator(context, instance->m_list, IteratorKind::entries, exception);
+}
+
+JSURLSearchParams::URLSearchParamsInstance::URLSearchParamsInstance(JSURLSearchParams *jsURLSearchParams,
+                                                                    std::shared_ptr<::foundation::URLRecord> url)
+  : Instance(jsURLSearchParams), m_url(std::move(url)) {
+  if (m_url != nullptr && m_url->query) resetList(*m_url->query);
+}
+
+JSURLSearchParams::URLSearchParamsInstance::~URLSearchParamsInstance() = default;
+
+void JSURLSearchParams::URLSearchParamsInstance::resetList(const std::string &query) {
+  m_list = ::foundation::parseFormURLEncoded(query);
+}
+
+void JSURLSearchParams::URLSearchParamsInstance::update() {
+  if (m_url == nullptr) return;
+  std::string query = ::foundation::serializeFormURLEncoded(m_list);
+  if (query.empty()) {
+    m_url->query = std::nullopt;
+  } else {
+    m_url->query = std::move(query);
+  }
+}
+
+ScriptValue JSURLSearchParams::URLSearchParamsInstance::getProperty(const std::string &name,
+                                                                    ScriptValue *exception) {
+  auto propertyMap = getURLSearchParamsPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+    switch (property) {
+    case URLSearchParamsProperty::size:
+      return ScriptValue::makeNumber(context, m_list.size());
+    }
+  }
+
+  return Instance::getProperty(name, exception);
+}
+
+void JSURLSearchParams::URLSearchParamsInstance::getPropertyNames(std::vector<std::string> &names) {
+  for (auto &property : getURLSearchParamsPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+void bindURLSearchParams(ScriptContext *context) {
+  auto URLSearchParams = JSURLSearchParams::instance(context);
+  bindGlobalValue(context, JSURLSearchParamsName, URLSearchParams->classObject);
+}
+
+} // namespace kraken::binding
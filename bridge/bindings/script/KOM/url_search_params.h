@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_URL_SEARCH_PARAMS_H
+#define KRAKENBRIDGE_SCRIPT_URL_SEARCH_PARAMS_H
+
+#include "bindings/script/host_class.h"
+#include "foundation/url_parser.h"
+#include <memory>
+#include <unordered_map>
+
+#define JSURLSearchParamsName "URLSearchParams"
+
+namespace kraken::binding {
+
+void bindURLSearchParams(ScriptContext *context);
+
+class JSURLSearchParams : public HostClass {
+public:
+  static std::unordered_map<ScriptContext *, JSURLSearchParams *> instanceMap;
+  static JSURLSearchParams *instance(ScriptContext *context);
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+  // Methods (`delete` can't be listed in a property enum) and Symbol.iterator are resolved through the prototype
+  // chain.
+  class URLSearchParamsInstance : public Instance {
+  public:
+    DEFINE_OBJECT_PROPERTY(URLSearchParams, 1, size);
+
+    URLSearchParamsInstance() = delete;
+    // The url is the record of the URL object which owns this instance, it's updated on every mutation.
+    explicit URLSearchParamsInstance(JSURLSearchParams *jsURLSearchParams,
+                                     std::shared_ptr<::foundation::URLRecord> url);
+    ~URLSearchParamsInstance() override;
+
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+    void getPropertyNames(std::vector<std::string> &names) override;
+
+    // Replace the list with the parsed query, called when the query of the owner URL changed.
+    void resetList(const std::string &query);
+
+  private:
+    friend JSURLSearchParams;
+    // https://url.spec.whatwg.org/#concept-urlsearchparams-update
+    void update();
+
+    ::foundation::FormURLEncodedList m_list;
+    std::shared_ptr<::foundation::URLRecord> m_url;
+  };
+
+protected:
+  JSURLSearchParams() = delete;
+  explicit JSURLSearchParams(ScriptContext *context);
+  ~JSURLSearchParams() override;
+
+private:
+  friend URLSearchParamsInstance;
+
+  static ScriptValue append(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue remove(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue get(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                         void *data, ScriptValue *exception);
+  static ScriptValue getAll(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue has(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                         void *data, ScriptValue *exception);
+  static ScriptValue set(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                         void *data, ScriptValue *exception);
+  static ScriptValue sort(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue toString(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception);
+  static ScriptValue forEach(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+  static ScriptValue keys(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue values(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue entries(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception);
+
+  FunctionHolder m_append{context, prototypeObject, this, "append", append};
+  FunctionHolder m_delete{context, prototypeObject, this, "delete", remove};
+  FunctionHolder m_get{context, prototypeObject, this, "get", get};
+  FunctionHolder m_getAll{context, prototypeObject, this, "getAll", getAll};
+  FunctionHolder m_has{context, prototypeObject, this, "has", has};
+  FunctionHolder m_set{context, prototypeObject, this, "set", set};
+  FunctionHolder m_sort{context, prototypeObject, this, "sort", sort};
+  FunctionHolder m_toString{context, prototypeObject, this, "toString", toString};
+  FunctionHolder m_forEach{context, prototypeObject, this, "forEach", forEach};
+  FunctionHolder m_keys{context, prototypeObject, this, "keys", keys};
+  FunctionHolder m_values{context, prototypeObject, this, "values", values};
+  FunctionHolder m_entries{context, prototypeObject, this, "entries", entries};
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_URL_SEARCH_PARAMS_H
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "window.h"
+#include "bindings/script/DOM/document.h"
+#include "bindings/script/native_string_utils.h"
+#include "dart_methods.h"
+#include "foundation/ui_command_queue.h"
+
+namespace kraken::binding {
+
+WindowInstance::WindowInstance(JSWindow *window)
+  : EventTargetInstance(window, WINDOW_TARGET_ID), nativeWindow(new NativeWindow(nativeEventTarget)) {
+  int32_t contextId = window->contextId;
+  NativeWindow *nativeWindow = this->nativeWindow;
+  context->runWhenActive([contextId, nativeWindow]() { getDartMethod()->initWindow(contextId, nativeWindow); });
+}
+
+WindowInstance::~WindowInstance() {
+  delete nativeWindow;
+}
+
+ScriptValue WindowInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getWindowPropertyMap();
+
+  if (propertyMap.count(name) > 0) {
+    auto property = propertyMap[name];
+
+    switch (property) {
+    case WindowProperty::devicePixelRatio: {
+      if (getDartMethod()->devicePixelRatio == nullptr) {
+        *exception = ScriptValue::makeError(
+          context, "Failed to read devicePixelRatio: dart method (devicePixelRatio) is not register.");
+        return ScriptValue();
+      }
+
+      double devicePixelRatio = getDartMethod()->devicePixelRatio(contextId);
+      return ScriptValue::makeNumber(context, devicePixelRatio);
+    }
+    case WindowProperty::colorScheme: {
+      if (getDartMethod()->platformBrightness == nullptr) {
+        *exception = ScriptValue::makeError(
+          context, "Failed to read colorScheme: dart method (platformBrightness) not register.");
+        return ScriptValue();
+      }
+      const NativeString *code = getDartMethod()->platformBrightness(contextId);
+      return ScriptValue::makeString(context, nativeStringToU16String(code));
+    }
+    case WindowProperty::__location__:
+      return m_location;
+    case WindowProperty::parent:
+    case WindowProperty::window:
+      return value();
+    case WindowProperty::history: {
+      return globalObject(context).getProperty("__history__", exception);
+    }
+    case WindowProperty::scrollX: {
+      getDartMethod()->flushUICommand();
+      auto document = DocumentInstance::instance(context);
+      assert_m(document->body->nativeElement->getViewModuleProperty != nullptr,
+               "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+      return ScriptValue::makeNumber(context, document->body->nativeElement->getViewModuleProperty(
+                                                document->body->nativeElement,
+                                                static_cast<int64_t>(ViewModuleProperty::scrollLeft)));
+    }
+    case WindowProperty::scrollY: {
+      getDartMethod()->flushUICommand();
+      auto document = DocumentInstance::instance(context);
+      assert_m(document->body->nativeElement->getViewModuleProperty != nullptr,
+               "Failed to execute getViewModuleProperty(): dart method is nullptr.");
+      return ScriptValue::makeNumber(context, document->body->nativeElement->getViewModuleProperty(
+                                                document->body->nativeElement,
+                                                static_cast<int64_t>(ViewModuleProperty::scrollTop)));
+    }
+    }
+  }
+
+  ScriptValue eventTargetRet = EventTargetInstance::getProperty(name, exception);
+  if (!eventTargetRet.empty()) return eventTargetRet;
+
+  ScriptValue global = globalObject(context);
+  if (global.hasProperty(name)) {
+    return global.getProperty(name, exception);
+  }
+
+  return ScriptValue();
+}
+
+bool WindowInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = getWindowPropertyMap();
+  auto &prototypePropertyMap = getWindowPrototypePropertyMap();
+
+  // Key is prototype property, return false to handled by engine itself.
+  if (prototypePropertyMap.count(name) > 0) {
+    return false;
+  }
+
+  // Key is window's built-in property. return true to do nothing because this properties are readonly.
+  if (propertyMap.count(name) > 0) {
+    return true;
+  }
+
+  globalObject(context).setProperty(name, value, exception);
+
+  return EventTargetInstance::setProperty(name, value, exception);
+}
+
+void WindowInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventTargetInstance::getPropertyNames(names);
+
+  for (auto &property : getWindowPropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+ScriptValue JSWindow::open(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception) {
+  auto window = HostClass::instanceOf<WindowInstance>(thisObject, static_cast<JSWindow *>(data));
+  if (window == nullptr) {
+    *exception = ScriptValue::makeError(context, "Illegal invocation");
+    return ScriptValue();
+  }
+
+  std::u16string url = arguments[0].toU16String();
+  window->nativeWindow->open(window->nativeWindow, stringToNativeString(url));
+  return ScriptValue();
+}
+
+ScriptValue JSWindow::scroll(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                             void *data, ScriptValue *exception) {
+  double x = 0.0;
+  double y = 0.0;
+
+  if (arguments[0].isNumber()) {
+    x = arguments[0].toNumber();
+  }
+
+  if (arguments[1].isNumber()) {
+    y = arguments[1].toNumber();
+  }
+
+  getDartMethod()->flushUICommand();
+  auto document = DocumentInstance::instance(context);
+  assert_m(document->body->nativeElement->scroll != nullptr, "Failed to execute scroll(): dart method is nullptr.");
+  document->body->nativeElement->scroll(document->body->nativeElement, x, y);
+
+  return ScriptValue();
+}
+
+ScriptValue JSWindow::scrollBy(ScriptContext *context, const ScriptValue &thisObject,
+                               const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  double x = 0.0;
+  double y = 0.0;
+
+  if (arguments[0].isNumber()) {
+    x = arguments[0].toNumber();
+  }
+
+  if (arguments[1].isNumber()) {
+    y = arguments[1].toNumber();
+  }
+
+  getDartMethod()->flushUICommand();
+  auto document = DocumentInstance::instance(context);
+  assert_m(document->body->nativeElement->scrollBy != nullptr, "Failed to execute scroll(): dart method is nullptr.");
+  document->body->nativeElement->scrollBy(document->body->nativeElement, x, y);
+
+  return ScriptValue();
+}
+
+JSWindow::~JSWindow() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSWindow::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto window = new WindowInstance(this);
+  return window->value();
+}
+
+std::unordered_map<ScriptContext *, JSWindow *> JSWindow::instanceMap{};
+
+void bindWindow(ScriptContext *context) {
+  auto window = JSWindow::instance(context);
+  bindGlobalValue(context, "Window", window->classObject);
+  auto windowInstance = window->instanceConstructor(ScriptArguments(context, 0, nullptr), nullptr);
+  bindGlobalValue(context, "window", windowInstance);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+#ifndef KRAKENBRIDGE_SCRIPT_WINDOW_H
+#define KRAKENBRIDGE_SCRIPT_WINDOW_H
+
+#include "bindings/script/DOM/event_target.h"
+#include "bindings/script/KOM/location.h"
+
+#include <array>
+#include <memory>
+
+#define JSWindowName "Window"
+
+namespace kraken::binding {
+
+struct NativeWindow;
+
+class JSWindow : public JSEventTarget {
+public:
+  static std::unordered_map<ScriptContext *, JSWindow *> instanceMap;
+  OBJECT_INSTANCE(JSWindow)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+  static ScriptValue open(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue scroll(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception);
+  static ScriptValue scrollBy(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception);
+
+private:
+  explicit JSWindow(ScriptContext *context) : JSEventTarget(context, JSWindowName){};
+  ~JSWindow() override;
+
+  FunctionHolder m_open{context, prototypeObject, this, "open", open};
+  FunctionHolder m_scroll{context, prototypeObject, this, "scroll", scroll};
+  FunctionHolder m_scrollTo{context, prototypeObject, this, "scrollTo", scroll};
+  FunctionHolder m_scrollBy{context, prototypeObject, this, "scrollBy", scrollBy};
+};
+
+class WindowInstance : public EventTargetInstance {
+public:
+  DEFINE_OBJECT_PROPERTY(Window, 8, devicePixelRatio, colorScheme, __location__, window, history, parent, scrollX,
+                         scrollY);
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(Window, 4, open, scroll, scrollBy, scrollTo);
+
+  WindowInstance() = delete;
+  explicit WindowInstance(JSWindow *window);
+  ~WindowInstance() override;
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+  NativeWindow *nativeWindow;
+
+private:
+  ScriptValue m_location{(new JSLocation(context))->value()};
+};
+
+using Open = void (*)(NativeWindow *nativeWindow, NativeString *url);
+
+struct NativeWindow {
+  NativeWindow() = delete;
+  NativeWindow(NativeEventTarget *nativeEventTarget) : nativeEventTarget(nativeEventTarget){};
+
+  NativeEventTarget *nativeEventTarget;
+  Open open;
+};
+
+void bindWindow(ScriptContext *context);
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_WINDOW_H
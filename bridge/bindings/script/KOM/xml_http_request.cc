@@ -0,0 +1,820 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "xml_http_request.h"
+#include "bindings/script/DOM/events/progress_event.h"
+#include "bindings/script/KOM/blob.h"
+#include "bindings/script/KOM/cookie.h"
+#include "bindings/script/native_string_utils.h"
+#include "dart_methods.h"
+#include "foundation/text_codec.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+
+namespace kraken::binding {
+
+// Request with these methods are rejected, method names are compared case-insensitively.
+static const char *forbiddenMethods[] = {"CONNECT", "TRACE", "TRACK"};
+// Method names which are normalized to uppercase.
+static const char *normalizedMethods[] = {"DELETE", "GET", "HEAD", "OPTIONS", "POST", "PUT"};
+// Headers which are controlled by the transport, user-agent and origin are allowed to set by page.
+static const char *forbiddenHeaders[] = {"accept-charset", "accept-encoding", "access-control-request-headers",
+                                         "access-control-request-method", "connection", "content-length",
+                                         "content-transfer-encoding", "cookie", "cookie2", "date", "dnt", "expect",
+                                         "host", "keep-alive", "referer", "te", "trailer", "transfer-encoding",
+                                         "upgrade", "via"};
+
+struct XMLHttpRequestTransportContext {
+  ScriptContext *context;
+  int64_t requestId;
+};
+
+static std::string toLowerCase(std::string str) {
+  std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return std::tolower(c); });
+  return str;
+}
+
+static std::string toUpperCase(std::string str) {
+  std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return std::toupper(c); });
+  return str;
+}
+
+// Decode response bytes as UTF-8, malformed sequences are replaced with U+FFFD instead of failing the whole
+// response, the leading BOM is removed.
+static std::u16string decodeUTF8(const uint8_t *bytes, size_t length) {
+  std::u16string result;
+  ::foundation::TextDecoder(::foundation::TextEncoding::UTF8, false, false).decode(bytes, length, false, result);
+  return result;
+}
+
+// The bridge owns the bytes of module responses.
+static void handleAbortTransportCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
+                                         NativeString *json, uint8_t *bytes, int32_t length) {
+  free(bytes);
+}
+
+static void invokeXMLHttpRequestModule(ScriptContext *context, const char *methodName,
+                                       const std::u16string &paramsString, uint8_t *bytes, int32_t length,
+                                       void *callbackContext, AsyncModuleCallback callback) {
+  std::string moduleNameString = JSXMLHttpRequestName;
+  std::string methodString = methodName;
+  NativeString *moduleName = stringToNativeString(moduleNameString);
+  NativeString *method = stringToNativeString(methodString);
+  NativeString *params = stringToNativeString(paramsString);
+
+  NativeString *result = getDartMethod()->invokeModule(callbackContext, context->getContextId(), moduleName, method,
+                                                       params, bytes, length, callback);
+
+  if (result != nullptr) result->free();
+  moduleName->free();
+  method->free();
+  params->free();
+}
+
+void bindXMLHttpRequest(ScriptContext *context) {
+  auto XMLHttpRequest = JSXMLHttpRequest::instance(context);
+  bindGlobalValue(context, "XMLHttpRequest", XMLHttpRequest->classObject);
+  auto XMLHttpRequestUpload = JSXMLHttpRequestUpload::instance(context);
+  bindGlobalValue(context, "XMLHttpRequestUpload", XMLHttpRequestUpload->classObject);
+
+  // Headers and progress of requests are emitted as module events of XMLHttpRequest module.
+  ScriptValue listener =
+    ScriptValue::makeFunction(context, "XMLHttpRequestListener", JSXMLHttpRequest::handleModuleEvent, nullptr);
+  addModuleListener(context, u"" JSXMLHttpRequestName, listener);
+}
+
+std::unordered_map<ScriptContext *, JSXMLHttpRequestUpload *> JSXMLHttpRequestUpload::instanceMap{};
+
+JSXMLHttpRequestUpload::JSXMLHttpRequestUpload(ScriptContext *context)
+  : JSEventTarget(context, JSXMLHttpRequestUploadName) {
+  m_jsOnlyEvents = {"loadstart", "progress", "abort", "error", "load", "timeout", "loadend"};
+}
+
+JSXMLHttpRequestUpload::~JSXMLHttpRequestUpload() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSXMLHttpRequestUpload::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  *exception = ScriptValue::makeError(context, "Failed to construct 'XMLHttpRequestUpload': Illegal constructor");
+  return ScriptValue();
+}
+
+std::unordered_map<ScriptContext *, JSXMLHttpRequest *> JSXMLHttpRequest::instanceMap{};
+
+JSXMLHttpRequest::JSXMLHttpRequest(ScriptContext *context) : JSEventTarget(context, JSXMLHttpRequestName) {
+  m_jsOnlyEvents = {"readystatechange", "loadstart", "progress", "abort", "error", "load", "timeout", "loadend"};
+}
+
+JSXMLHttpRequest::~JSXMLHttpRequest() {
+  instanceMap.erase(context);
+}
+
+ScriptValue JSXMLHttpRequest::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  auto request = new XMLHttpRequestInstance(this);
+  return request->value();
+}
+
+ScriptValue JSXMLHttpRequest::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = XMLHttpRequestInstance::getXMLHttpRequestPropertyMap();
+  if (propertyMap.count(name) == 0) return HostClass::getProperty(name, exception);
+
+  switch (propertyMap[name]) {
+  case XMLHttpRequestInstance::XMLHttpRequestProperty::UNSENT:
+    return ScriptValue::makeNumber(context, static_cast<double>(XMLHttpRequestState::UNSENT));
+  case XMLHttpRequestInstance::XMLHttpRequestProperty::OPENED:
+    return ScriptValue::makeNumber(context, static_cast<double>(XMLHttpRequestState::OPENED));
+  case XMLHttpRequestInstance::XMLHttpRequestProperty::HEADERS_RECEIVED:
+    return ScriptValue::makeNumber(context, static_cast<double>(XMLHttpRequestState::HEADERS_RECEIVED));
+  case XMLHttpRequestInstance::XMLHttpRequestProperty::LOADING:
+    return ScriptValue::makeNumber(context, static_cast<double>(XMLHttpRequestState::LOADING));
+  case XMLHttpRequestInstance::XMLHttpRequestProperty::DONE:
+    return ScriptValue::makeNumber(context, static_cast<double>(XMLHttpRequestState::DONE));
+  default:
+    return HostClass::getProperty(name, exception);
+  }
+}
+
+ScriptValue JSXMLHttpRequest::open(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  if (arguments.size() < 2) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'open' on 'XMLHttpRequest': 2 arguments required.");
+    return ScriptValue();
+  }
+
+  auto request = HostClass::instanceOf<XMLHttpRequestInstance>(thisObject, static_cast<JSXMLHttpRequest *>(data));
+  if (request == nullptr) {
+    *exception =
+      ScriptValue::makeError(context, "Failed to execute 'open' on 'XMLHttpRequest': Illegal invocation.");
+    return ScriptValue();
+  }
+
+  std::string method = arguments[0].toString();
+  std::string url = arguments[1].toString();
+
+  if (arguments.size() > 2 && !arguments[2].isUndefined() && !arguments[2].toBoolean()) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'open' on 'XMLHttpRequest': Synchronous requests are not supported.");
+    return ScriptValue();
+  }
+
+  std::string upperMethod = toUpperCase(method);
+  for (auto forbiddenMethod : forbiddenMethods) {
+    if (upperMethod == forbiddenMethod) {
+      std::string message = "Failed to execute 'open' on 'XMLHttpRequest': '" + method + "' HTTP method is unsupported.";
+      *exception = ScriptValue::makeError(context, message);
+      return ScriptValue();
+    }
+  }
+  for (auto normalizedMethod : normalizedMethods) {
+    if (upperMethod == normalizedMethod) {
+      method = upperMethod;
+      break;
+    }
+  }
+
+  // Terminate the ongoing request silently, events of it will never be fired.
+  if (request->m_requestId != 0) {
+    request->finishRequest(true);
+    request->m_self = ScriptValue();
+  }
+  request->m_sendFlag = false;
+  request->m_uploadComplete = true;
+  request->m_method = method;
+  request->m_url = url;
+  request->m_requestHeaders.clear();
+  request->resetResponse();
+
+  if (request->m_readyState != XMLHttpRequestState::OPENED) {
+    request->changeState(XMLHttpRequestState::OPENED);
+  }
+
+  return ScriptValue();
+}
+
+ScriptValue JSXMLHttpRequest::setRequestHeader(ScriptContext *context, const ScriptValue &thisObject,
+                                               const ScriptArguments &arguments, void *data,
+                                               ScriptValue *exception) {
+  if (arguments.size() < 2) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'setRequestHeader' on 'XMLHttpRequest': 2 arguments required.");
+    return ScriptValue();
+  }
+
+  auto request = HostClass::instanceOf<XMLHttpRequestInstance>(thisObject, static_cast<JSXMLHttpRequest *>(data));
+  if (request == nullptr || request->m_readyState != XMLHttpRequestState::OPENED || request->m_sendFlag) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'setRequestHeader' on 'XMLHttpRequest': The object's state must be OPENED.");
+    return ScriptValue();
+  }
+
+  std::string name = arguments[0].toString();
+  std::string value = arguments[1].toString();
+  std::string lowerName = toLowerCase(name);
+
+  if (lowerName.compare(0, 6, "proxy-") == 0 || lowerName.compare(0, 4, "sec-") == 0) return ScriptValue();
+  for (auto forbiddenHeader : forbiddenHeaders) {
+    if (lowerName == forbiddenHeader) return ScriptValue();
+  }
+
+  for (auto &header : request->m_requestHeaders) {
+    if (toLowerCase(header.first) == lowerName) {
+      header.second += ", " + value;
+      return ScriptValue();
+    }
+  }
+  request->m_requestHeaders.emplace_back(name, value);
+
+  return ScriptValue();
+}
+
+ScriptValue JSXMLHttpRequest::send(ScriptContext *context, const ScriptValue &thisObject,
+                                   const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto request = HostClass::instanceOf<XMLHttpRequestInstance>(thisObject, static_cast<JSXMLHttpRequest *>(data));
+  if (request == nullptr || request->m_readyState != XMLHttpRequestState::OPENED || request->m_sendFlag) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'send' on 'XMLHttpRequest': The object's state must be OPENED.");
+    return ScriptValue();
+  }
+
+  if (getDartMethod()->invokeModule == nullptr) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'send' on 'XMLHttpRequest': dart method (invokeModule) is not registered.");
+    return ScriptValue();
+  }
+
+  ScriptValue body;
+  if (!arguments[0].isNull() && !arguments[0].isUndefined() && request->m_method != "GET" &&
+      request->m_method != "HEAD") {
+    body = arguments[0];
+  }
+
+  bool hasContentType = false;
+  for (auto &header : request->m_requestHeaders) {
+    if (toLowerCase(header.first) == "content-type") hasContentType = true;
+  }
+
+  // Body other than binary payloads are sent as string.
+  uint8_t *bytes = nullptr;
+  int32_t length = -1;
+  ScriptValue bodyString;
+  request->m_uploadTotal = 0;
+  if (!body.empty()) {
+    if (!body.isObject() || !getBinaryPayload(body, &bytes, &length)) {
+      std::string bodyStdString = body.toString();
+      bodyString = ScriptValue::makeString(context, bodyStdString);
+      request->m_uploadTotal = bodyStdString.size();
+      if (!hasContentType) request->m_requestHeaders.emplace_back("Content-Type", "text/plain;charset=UTF-8");
+    } else {
+      request->m_uploadTotal = length;
+    }
+  }
+
+  auto XMLHttpRequest = request->prototype<JSXMLHttpRequest>();
+  int64_t requestId = XMLHttpRequest->nextRequestId++;
+  request->m_uploadComplete = body.empty();
+  request->m_sendFlag = true;
+  request->m_requestId = requestId;
+  request->resetResponse();
+  XMLHttpRequest->pendingRequests[requestId] = request;
+  request->m_self = request->value();
+
+  request->fireProgressEvent(request, "loadstart", 0, 0);
+  if (!request->m_uploadComplete) request->fireProgressEvent(request->m_upload, "loadstart", 0, request->m_uploadTotal);
+
+  // Request may be aborted or reopened by loadstart listeners.
+  if (request->m_requestId != requestId) return ScriptValue();
+
+  ScriptValue headers = ScriptValue::makeObject(context);
+  for (auto &header : request->m_requestHeaders) {
+    headers.setProperty(header.first, ScriptValue::makeString(context, header.second), exception);
+  }
+
+  std::string cookies = getRequestCookies(request->context, request->m_url, request->m_withCredentials);
+  if (!cookies.empty()) {
+    headers.setProperty("Cookie", ScriptValue::makeString(context, cookies), exception);
+  }
+
+  // Read the binary payload again since listeners may have detached or resized the buffer.
+  if (bytes != nullptr) getBinaryPayload(body, &bytes, &length);
+
+  std::vector<ScriptValue> params = {ScriptValue::makeNumber(context, requestId),
+                                     ScriptValue::makeString(context, request->m_method),
+                                     ScriptValue::makeString(context, request->m_url),
+                                     headers,
+                                     ScriptValue::makeNumber(context, request->m_timeout),
+                                     ScriptValue::makeBoolean(context, request->m_withCredentials)};
+  if (!bodyString.empty()) params.emplace_back(bodyString);
+
+  ScriptValue paramsJSON = ScriptValue::makeArray(context, params).toJSON(exception);
+
+  auto transportContext = new XMLHttpRequestTransportContext{request->context, requestId};
+  invokeXMLHttpRequestModule(request->context, "send", paramsJSON.toU16String(), bytes, length, transportContext,
+                             handleTransportCallback);
+
+  return ScriptValue();
+}
+
+ScriptValue JSXMLHttpRequest::abort(ScriptContext *context, const ScriptValue &thisObject,
+                                    const ScriptArguments &arguments, void *data, ScriptValue *exception) {
+  auto request = HostClass::instanceOf<XMLHttpRequestInstance>(thisObject, static_cast<JSXMLHttpRequest *>(data));
+  if (request == nullptr) return ScriptValue();
+
+  XMLHttpRequestState state = request->m_readyState;
+  if ((state == XMLHttpRequestState::OPENED && request->m_sendFlag) ||
+      state == XMLHttpRequestState::HEADERS_RECEIVED || state == XMLHttpRequestState::LOADING) {
+    request->handleError("abort");
+  }
+
+  // The state is changed without firing readystatechange.
+  if (request->m_readyState == XMLHttpRequestState::DONE) {
+    request->m_readyState = XMLHttpRequestState::UNSENT;
+    request->resetResponse();
+  }
+
+  return ScriptValue();
+}
+
+ScriptValue JSXMLHttpRequest::getResponseHeader(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data,
+                                                ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'getResponseHeader' on 'XMLHttpRequest': 1 argument required.");
+    return ScriptValue();
+  }
+
+  auto request = HostClass::instanceOf<XMLHttpRequestInstance>(thisObject, static_cast<JSXMLHttpRequest *>(data));
+  if (request == nullptr) return ScriptValue::null(context);
+
+  std::string name = toLowerCase(arguments[0].toString());
+  std::string value;
+  bool found = false;
+  for (auto &header : request->m_responseHeaders) {
+    if (toLowerCase(header.first) != name) continue;
+    if (found) value += ", ";
+    value += header.second;
+    found = true;
+  }
+
+  return found ? ScriptValue::makeString(context, value) : ScriptValue::null(context);
+}
+
+ScriptValue JSXMLHttpRequest::getAllResponseHeaders(ScriptContext *context, const ScriptValue &thisObject,
+                                                    const ScriptArguments &arguments, void *data,
+                                                    ScriptValue *exception) {
+  auto request = HostClass::instanceOf<XMLHttpRequestInstance>(thisObject, static_cast<JSXMLHttpRequest *>(data));
+  if (request == nullptr) return ScriptValue::makeString(context, "");
+
+  // Headers are lowercased, combined and sorted by name as browsers do.
+  std::map<std::string, std::string> headers;
+  for (auto &header : request->m_responseHeaders) {
+    std::string name = toLowerCase(header.first);
+    if (headers.count(name) > 0) {
+      headers[name] += ", " + header.second;
+    } else {
+      headers[name] = header.second;
+    }
+  }
+
+  std::string result;
+  for (auto &header : headers) {
+    result += header.first + ": " + header.second + "\r\n";
+  }
+
+  return ScriptValue::makeString(context, result);
+}
+
+ScriptValue JSXMLHttpRequest::overrideMimeType(ScriptContext *context, const ScriptValue &thisObject,
+                                               const ScriptArguments &arguments, void *data,
+                                               ScriptValue *exception) {
+  if (arguments.size() < 1) {
+    *exception = ScriptValue::makeError(
+      context, "Failed to execute 'overrideMimeType' on 'XMLHttpRequest': 1 argument required.");
+    return ScriptValue();
+  }
+
+  auto request = HostClass::instanceOf<XMLHttpRequestInstance>(thisObject, static_cast<JSXMLHttpRequest *>(data));
+  if (request == nullptr) return ScriptValue();
+
+  if (request->m_readyState == XMLHttpRequestState::LOADING || request->m_readyState == XMLHttpRequestState::DONE) {
+    *exception = ScriptValue::makeError(context, "Failed to execute 'overrideMimeType' on 'XMLHttpRequest': MimeType "
+                                                 "cannot be overridden when the state is LOADING or DONE.");
+    return ScriptValue();
+  }
+
+  request->m_mimeTypeOverride = arguments[0].toString();
+  return ScriptValue();
+}
+
+ScriptValue JSXMLHttpRequest::handleModuleEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                                const ScriptArguments &arguments, void *data,
+                                                ScriptValue *exception) {
+  // Module events are emitted with [requestId, type, ...payload].
+  if (arguments.size() < 3 || !arguments[2].isObject()) return ScriptValue();
+
+  auto XMLHttpRequest = JSXMLHttpRequest::instance(context);
+  ScriptValue event = arguments[2];
+
+  auto requestId = static_cast<int64_t>(event.getIndex(0, exception).toNumber());
+  if (XMLHttpRequest->pendingRequests.count(requestId) == 0) return ScriptValue();
+  XMLHttpRequestInstance *request = XMLHttpRequest->pendingRequests[requestId];
+
+  std::string type = event.getIndex(1, exception).toString();
+  auto numberAt = [&event, exception](uint32_t index) { return event.getIndex(index, exception).toNumber(); };
+
+  if (type == "headers") {
+    auto status = static_cast<int32_t>(numberAt(2));
+    std::string statusText = event.getIndex(3, exception).toString();
+    std::string url = event.getIndex(4, exception).toString();
+
+    std::vector<std::pair<std::string, std::string>> headers;
+    ScriptValue headersValue = event.getIndex(5, exception);
+    if (headersValue.isArray()) {
+      auto headerCount = static_cast<uint32_t>(headersValue.getProperty("length", exception).toNumber());
+      for (uint32_t i = 0; i < headerCount; i++) {
+        ScriptValue pair = headersValue.getIndex(i, exception);
+        if (!pair.isObject()) continue;
+        headers.emplace_back(pair.getIndex(0, exception).toString(), pair.getIndex(1, exception).toString());
+      }
+    }
+
+    request->handleHeaders(status, statusText, url, std::move(headers));
+  } else if (type == "progress") {
+    request->handleProgress(numberAt(2), numberAt(3));
+  } else if (type == "uploadprogress") {
+    request->handleUploadProgress(numberAt(2), numberAt(3));
+  }
+
+  return ScriptValue();
+}
+
+void JSXMLHttpRequest::handleTransportCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
+                                               NativeString *json, uint8_t *bytes, int32_t length) {
+  std::unique_ptr<uint8_t, decltype(&free)> payload(bytes, free);
+  auto transportContext = static_cast<XMLHttpRequestTransportContext *>(callbackContext);
+  ScriptContext *context = transportContext->context;
+  int64_t requestId = transportContext->requestId;
+  delete transportContext;
+
+  if (!checkContext(contextId, context)) return;
+  if (!context->isValid()) return;
+  ScriptScope scope(context);
+
+  auto XMLHttpRequest = JSXMLHttpRequest::instance(context);
+  // The request has been aborted or reopened.
+  if (XMLHttpRequest->pendingRequests.count(requestId) == 0) return;
+  XMLHttpRequestInstance *request = XMLHttpRequest->pendingRequests[requestId];
+
+  if (errmsg != nullptr || json == nullptr) {
+    request->handleError("error");
+    return;
+  }
+
+  // Transport results are ['load'] with the response body as bytes, or ['error' | 'timeout' | 'abort', message].
+  ScriptValue result = ScriptValue::parseJSON(context, nativeStringToU16String(json));
+
+  std::string type;
+  if (!result.empty() && result.isObject()) {
+    type = result.getIndex(0, nullptr).toString();
+  }
+
+  if (type == "load") {
+    request->handleLoad(bytes, length);
+  } else if (type == "timeout") {
+    request->handleError("timeout");
+  } else {
+    request->handleError("error");
+  }
+}
+
+XMLHttpRequestInstance::XMLHttpRequestInstance(JSXMLHttpRequest *jsXMLHttpRequest)
+  : EventTargetInstance(jsXMLHttpRequest) {
+  m_upload = new EventTargetInstance(JSXMLHttpRequestUpload::instance(context));
+  m_uploadObject = m_upload->value();
+}
+
+XMLHttpRequestInstance::~XMLHttpRequestInstance() {
+  if (m_requestId != 0) prototype<JSXMLHttpRequest>()->pendingRequests.erase(m_requestId);
+}
+
+ScriptValue XMLHttpRequestInstance::getProperty(const std::string &name, ScriptValue *exception) {
+  auto &propertyMap = getXMLHttpRequestPropertyMap();
+
+  if (propertyMap.count(name) == 0) return EventTargetInstance::getProperty(name, exception);
+
+  auto property = propertyMap[name];
+  switch (property) {
+  case XMLHttpRequestProperty::readyState:
+    return ScriptValue::makeNumber(context, static_cast<double>(m_readyState));
+  case XMLHttpRequestProperty::status:
+    return ScriptValue::makeNumber(context, m_status);
+  case XMLHttpRequestProperty::statusText:
+    return ScriptValue::makeString(context, m_statusText);
+  case XMLHttpRequestProperty::responseURL:
+    return ScriptValue::makeString(context, m_responseURL);
+  case XMLHttpRequestProperty::responseType: {
+    static const char *responseTypes[] = {"", "text", "json", "arraybuffer", "blob"};
+    return ScriptValue::makeString(context, responseTypes[static_cast<int>(m_responseType)]);
+  }
+  case XMLHttpRequestProperty::response:
+    return getResponse(exception);
+  case XMLHttpRequestProperty::responseText:
+    return getResponseText(exception);
+  case XMLHttpRequestProperty::responseXML:
+    return ScriptValue::null(context);
+  case XMLHttpRequestProperty::timeout:
+    return ScriptValue::makeNumber(context, m_timeout);
+  case XMLHttpRequestProperty::withCredentials:
+    return ScriptValue::makeBoolean(context, m_withCredentials);
+  case XMLHttpRequestProperty::upload:
+    return m_uploadObject;
+  default:
+    return prototype<JSXMLHttpRequest>()->getProperty(name, exception);
+  }
+}
+
+bool XMLHttpRequestInstance::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  auto &propertyMap = getXMLHttpRequestPropertyMap();
+  auto &prototypePropertyMap = getXMLHttpRequestPrototypePropertyMap();
+
+  if (prototypePropertyMap.count(name) > 0) return false;
+  if (propertyMap.count(name) == 0) return EventTargetInstance::setProperty(name, value, exception);
+
+  auto property = propertyMap[name];
+  switch (property) {
+  case XMLHttpRequestProperty::responseType: {
+    if (m_readyState == XMLHttpRequestState::LOADING || m_readyState == XMLHttpRequestState::DONE) {
+      *exception = ScriptValue::makeError(context, "Failed to set the 'responseType' property on 'XMLHttpRequest': "
+                                                   "The response type cannot be set if the object's state is "
+                                                   "LOADING or DONE.");
+      return true;
+    }
+
+    // Unknown values are ignored, document is not supported.
+    std::string responseType = value.toString();
+    if (responseType.empty()) {
+      m_responseType = XMLHttpRequestResponseType::empty;
+    } else if (responseType == "text") {
+      m_responseType = XMLHttpRequestResponseType::text;
+    } else if (responseType == "json") {
+      m_responseType = XMLHttpRequestResponseType::json;
+    } else if (responseType == "arraybuffer") {
+      m_responseType = XMLHttpRequestResponseType::arraybuffer;
+    } else if (responseType == "blob") {
+      m_responseType = XMLHttpRequestResponseType::blob;
+    }
+    break;
+  }
+  case XMLHttpRequestProperty::timeout: {
+    double timeout = value.toNumber();
+    m_timeout = timeout > 0 ? timeout : 0;
+    break;
+  }
+  case XMLHttpRequestProperty::withCredentials: {
+    if ((m_readyState != XMLHttpRequestState::UNSENT && m_readyState != XMLHttpRequestState::OPENED) || m_sendFlag) {
+      *exception = ScriptValue::makeError(context, "Failed to set the 'withCredentials' property on "
+                                                   "'XMLHttpRequest': The value may only be set if the object's "
+                                                   "state is UNSENT or OPENED.");
+      return true;
+    }
+    m_withCredentials = value.toBoolean();
+    break;
+  }
+  default:
+    // Other attributes are readonly.
+    break;
+  }
+
+  return true;
+}
+
+void XMLHttpRequestInstance::getPropertyNames(std::vector<std::string> &names) {
+  EventTargetInstance::getPropertyNames(names);
+
+  for (auto &property : getXMLHttpRequestPropertyNames()) {
+    names.emplace_back(property);
+  }
+
+  for (auto &property : getXMLHttpRequestPrototypePropertyNames()) {
+    names.emplace_back(property);
+  }
+}
+
+void XMLHttpRequestInstance::handleHeaders(int32_t status, std::string statusText, std::string url,
+                                           std::vector<std::pair<std::string, std::string>> headers) {
+  int64_t requestId = m_requestId;
+
+  // Response headers arrive after the whole request body been sent.
+  if (!m_uploadComplete) {
+    m_uploadComplete = true;
+    fireProgressEvent(m_upload, "progress", m_uploadTotal, m_uploadTotal);
+    fireProgressEvent(m_upload, "load", m_uploadTotal, m_uploadTotal);
+    fireProgressEvent(m_upload, "loadend", m_uploadTotal, m_uploadTotal);
+    if (m_requestId != requestId) return;
+  }
+
+  // Set-Cookie headers go to the cookie jar and are hidden from the page.
+  std::vector<std::string> setCookies;
+  for (auto it = headers.begin(); it != headers.end();) {
+    std::string name = toLowerCase(it->first);
+    if (name != "set-cookie" && name != "set-cookie2") {
+      it++;
+      continue;
+    }
+    if (name == "set-cookie") setCookies.emplace_back(std::move(it->second));
+    it = headers.erase(it);
+  }
+  if (!setCookies.empty()) storeResponseCookies(context, url, m_withCredentials, setCookies);
+
+  m_status = status;
+  m_statusText = std::move(statusText);
+  m_responseURL = std::move(url);
+  m_responseHeaders = std::move(headers);
+  changeState(XMLHttpRequestState::HEADERS_RECEIVED);
+}
+
+void XMLHttpRequestInstance::handleProgress(double loaded, double total) {
+  // Progress events before headers are unexpected from the transport.
+  if (m_readyState != XMLHttpRequestState::HEADERS_RECEIVED && m_readyState != XMLHttpRequestState::LOADING) return;
+
+  int64_t requestId = m_requestId;
+  m_loaded = loaded;
+  m_total = total;
+
+  // readystatechange is fired with every chunk of response body.
+  m_readyState = XMLHttpRequestState::LOADING;
+  fireEvent(this, "readystatechange");
+  if (m_requestId != requestId) return;
+
+  fireProgressEvent(this, "progress", loaded, total);
+}
+
+void XMLHttpRequestInstance::handleUploadProgress(double loaded, double total) {
+  if (m_uploadComplete) return;
+  fireProgressEvent(m_upload, "progress", loaded, total);
+}
+
+void XMLHttpRequestInstance::handleLoad(uint8_t *bytes, int32_t length) {
+  int64_t requestId = m_requestId;
+  if (requestId == 0) return;
+
+  if (!m_uploadComplete) {
+    m_uploadComplete = true;
+    fireProgressEvent(m_upload, "progress", m_uploadTotal, m_uploadTotal);
+    fireProgressEvent(m_upload, "load", m_uploadTotal, m_uploadTotal);
+    fireProgressEvent(m_upload, "loadend", m_uploadTotal, m_uploadTotal);
+    if (m_requestId != requestId) return;
+  }
+
+  finishRequest(false);
+
+  if (bytes != nullptr && length > 0) {
+    m_responseBytes.assign(bytes, bytes + length);
+  } else {
+    m_responseBytes.clear();
+  }
+  m_loaded = m_responseBytes.size();
+  if (m_total < m_loaded) m_total = m_loaded;
+
+  m_sendFlag = false;
+  changeState(XMLHttpRequestState::DONE);
+  fireProgressEvent(this, "progress", m_loaded, m_total);
+  fireProgressEvent(this, "load", m_loaded, m_total);
+  fireProgressEvent(this, "loadend", m_loaded, m_total);
+
+  // Release the request at last, object should be alive during the events been dispatched.
+  m_self = ScriptValue();
+}
+
+void XMLHttpRequestInstance::handleError(const char *eventType) {
+  if (m_requestId == 0) return;
+
+  finishRequest(std::strcmp(eventType, "abort") == 0);
+
+  m_sendFlag = false;
+  resetResponse();
+  changeState(XMLHttpRequestState::DONE);
+
+  if (!m_uploadComplete) {
+    m_uploadComplete = true;
+    fireProgressEvent(m_upload, eventType, 0, 0);
+    fireProgressEvent(m_upload, "loadend", 0, 0);
+  }
+
+  fireProgressEvent(this, eventType, 0, 0);
+  fireProgressEvent(this, "loadend", 0, 0);
+
+  m_self = ScriptValue();
+}
+
+void XMLHttpRequestInstance::changeState(XMLHttpRequestState state) {
+  m_readyState = state;
+  fireEvent(this, "readystatechange");
+}
+
+void XMLHttpRequestInstance::fireEvent(EventTargetInstance *target, const char *type) {
+  auto event = new EventInstance(JSEvent::instance(context), type, ScriptValue(), nullptr);
+  target->dispatchEvent(event);
+}
+
+void XMLHttpRequestInstance::fireProgressEvent(EventTargetInstance *target, const char *type, double loaded,
+                                               double total) {
+  auto event = new ProgressEventInstance(JSProgressEvent::instance(context), type, total > 0, loaded, total);
+  target->dispatchEvent(event);
+}
+
+void XMLHttpRequestInstance::finishRequest(bool cancelTransport) {
+  if (m_requestId == 0) return;
+
+  int64_t requestId = m_requestId;
+  m_requestId = 0;
+  prototype<JSXMLHttpRequest>()->pendingRequests.erase(requestId);
+
+  if (cancelTransport) {
+    ScriptValue paramsJSON =
+      ScriptValue::makeArray(context, {ScriptValue::makeNumber(context, requestId)}).toJSON(nullptr);
+    invokeXMLHttpRequestModule(context, "abort", paramsJSON.toU16String(), nullptr, -1, nullptr,
+                               handleAbortTransportCallback);
+  }
+}
+
+void XMLHttpRequestInstance::resetResponse() {
+  m_status = 0;
+  m_statusText.clear();
+  m_responseURL.clear();
+  m_responseHeaders.clear();
+  m_responseBytes.clear();
+  m_responseBytes.shrink_to_fit();
+  m_responseText = ScriptValue();
+  m_response = ScriptValue();
+  m_loaded = 0;
+  m_total = 0;
+}
+
+ScriptValue XMLHttpRequestInstance::getResponseText(ScriptValue *exception) {
+  if (m_responseType != XMLHttpRequestResponseType::empty && m_responseType != XMLHttpRequestResponseType::text) {
+    *exception = ScriptValue::makeError(context, "Failed to read the 'responseText' property from 'XMLHttpRequest': "
+                                                 "The value is only accessible if the object's 'responseType' is '' "
+                                                 "or 'text'.");
+    return ScriptValue();
+  }
+
+  // Response body is delivered at once, partial text is not available during LOADING.
+  if (m_readyState != XMLHttpRequestState::DONE) return ScriptValue::makeString(context, "");
+
+  if (m_responseText.empty()) {
+    m_responseText = ScriptValue::makeString(context, decodeUTF8(m_responseBytes.data(), m_responseBytes.size()));
+  }
+
+  return m_responseText;
+}
+
+ScriptValue XMLHttpRequestInstance::getResponse(ScriptValue *exception) {
+  if (m_responseType == XMLHttpRequestResponseType::empty || m_responseType == XMLHttpRequestResponseType::text) {
+    return getResponseText(exception);
+  }
+
+  if (m_readyState != XMLHttpRequestState::DONE) return ScriptValue::null(context);
+  if (!m_response.empty()) return m_response;
+
+  switch (m_responseType) {
+  case XMLHttpRequestResponseType::json: {
+    // Invalid json results in null response.
+    ScriptValue json = ScriptValue::parseJSON(context, decodeUTF8(m_responseBytes.data(), m_responseBytes.size()));
+    m_response = json.empty() ? ScriptValue::null(context) : json;
+    break;
+  }
+  case XMLHttpRequestResponseType::arraybuffer: {
+    m_response = ScriptValue::makeArrayBuffer(context, m_responseBytes.data(), m_responseBytes.size());
+    break;
+  }
+  case XMLHttpRequestResponseType::blob: {
+    std::string mimeType = getResponseMimeType();
+    auto blob = new JSBlob::BlobInstance(JSBlob::instance(context), std::vector<uint8_t>(m_responseBytes), mimeType);
+    m_response = blob->value();
+    break;
+  }
+  default:
+    break;
+  }
+
+  return m_response;
+}
+
+std::string XMLHttpRequestInstance::getResponseMimeType() {
+  if (!m_mimeTypeOverride.empty()) return toLowerCase(m_mimeTypeOverride);
+
+  for (auto &header : m_responseHeaders) {
+    if (toLowerCase(header.first) == "content-type") return toLowerCase(header.second);
+  }
+
+  return "";
+}
+
+} // namespace kraken::binding
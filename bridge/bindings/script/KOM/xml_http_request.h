@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_XML_HTTP_REQUEST_H
+#define KRAKENBRIDGE_SCRIPT_XML_HTTP_REQUEST_H
+
+#include "bindings/script/DOM/event_target.h"
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#define JSXMLHttpRequestName "XMLHttpRequest"
+#define JSXMLHttpRequestUploadName "XMLHttpRequestUpload"
+
+namespace kraken::binding {
+
+void bindXMLHttpRequest(ScriptContext *context);
+
+class XMLHttpRequestInstance;
+
+// The upload object of XMLHttpRequest, only receives progress events of the request body.
+class JSXMLHttpRequestUpload : public JSEventTarget {
+public:
+  static std::unordered_map<ScriptContext *, JSXMLHttpRequestUpload *> instanceMap;
+  OBJECT_INSTANCE(JSXMLHttpRequestUpload)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+
+protected:
+  JSXMLHttpRequestUpload() = delete;
+  explicit JSXMLHttpRequestUpload(ScriptContext *context);
+  ~JSXMLHttpRequestUpload() override;
+};
+
+class JSXMLHttpRequest : public JSEventTarget {
+public:
+  static std::unordered_map<ScriptContext *, JSXMLHttpRequest *> instanceMap;
+  OBJECT_INSTANCE(JSXMLHttpRequest)
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override;
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+
+  static ScriptValue open(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue setRequestHeader(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue send(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                          void *data, ScriptValue *exception);
+  static ScriptValue abort(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                           void *data, ScriptValue *exception);
+  static ScriptValue getResponseHeader(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue getAllResponseHeaders(ScriptContext *context, const ScriptValue &thisObject,
+                                           const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  static ScriptValue overrideMimeType(ScriptContext *context, const ScriptValue &thisObject,
+                                      const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+  // Receive the headers and progress events emitted by the XMLHttpRequest module.
+  static ScriptValue handleModuleEvent(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception);
+  // Receive the final result of a request from the XMLHttpRequest module.
+  static void handleTransportCallback(void *callbackContext, int32_t contextId, NativeString *errmsg,
+                                      NativeString *json, uint8_t *bytes, int32_t length);
+
+  // Requests waiting for events from the XMLHttpRequest module, keyed by request id.
+  std::unordered_map<int64_t, XMLHttpRequestInstance *> pendingRequests;
+  int64_t nextRequestId{1};
+
+protected:
+  JSXMLHttpRequest() = delete;
+  explicit JSXMLHttpRequest(ScriptContext *context);
+  ~JSXMLHttpRequest() override;
+
+  FunctionHolder m_open{context, prototypeObject, this, "open", open};
+  FunctionHolder m_setRequestHeader{context, prototypeObject, this, "setRequestHeader", setRequestHeader};
+  FunctionHolder m_send{context, prototypeObject, this, "send", send};
+  FunctionHolder m_abort{context, prototypeObject, this, "abort", abort};
+  FunctionHolder m_getResponseHeader{context, prototypeObject, this, "getResponseHeader", getResponseHeader};
+  FunctionHolder m_getAllResponseHeaders{context, prototypeObject, this, "getAllResponseHeaders",
+                                         getAllResponseHeaders};
+  FunctionHolder m_overrideMimeType{context, prototypeObject, this, "overrideMimeType", overrideMimeType};
+};
+
+enum class XMLHttpRequestState { UNSENT = 0, OPENED = 1, HEADERS_RECEIVED = 2, LOADING = 3, DONE = 4 };
+
+enum class XMLHttpRequestResponseType { empty, text, json, arraybuffer, blob };
+
+class XMLHttpRequestInstance : public EventTargetInstance {
+public:
+  DEFINE_OBJECT_PROPERTY(XMLHttpRequest, 16, readyState, status, statusText, responseURL, responseType, response,
+                         responseText, responseXML, timeout, withCredentials, upload, UNSENT, OPENED,
+                         HEADERS_RECEIVED, LOADING, DONE);
+  DEFINE_PROTOTYPE_OBJECT_PROPERTY(XMLHttpRequest, 7, open, setRequestHeader, send, abort, getResponseHeader,
+                                   getAllResponseHeaders, overrideMimeType);
+
+  XMLHttpRequestInstance() = delete;
+  explicit XMLHttpRequestInstance(JSXMLHttpRequest *jsXMLHttpRequest);
+  ~XMLHttpRequestInstance() override;
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override;
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override;
+  void getPropertyNames(std::vector<std::string> &names) override;
+
+  void handleHeaders(int32_t status, std::string statusText, std::string url,
+                     std::vector<std::pair<std::string, std::string>> headers);
+  void handleProgress(double loaded, double total);
+  void handleUploadProgress(double loaded, double total);
+  void handleLoad(uint8_t *bytes, int32_t length);
+  // Run the request error steps with event type of error, timeout or abort.
+  void handleError(const char *eventType);
+
+private:
+  friend JSXMLHttpRequest;
+
+  void changeState(XMLHttpRequestState state);
+  void fireEvent(EventTargetInstance *target, const char *type);
+  void fireProgressEvent(EventTargetInstance *target, const char *type, double loaded, double total);
+  void finishRequest(bool cancelTransport);
+  void resetResponse();
+  ScriptValue getResponseText(ScriptValue *exception);
+  ScriptValue getResponse(ScriptValue *exception);
+  std::string getResponseMimeType();
+
+  XMLHttpRequestState m_readyState{XMLHttpRequestState::UNSENT};
+  XMLHttpRequestResponseType m_responseType{XMLHttpRequestResponseType::empty};
+  std::string m_method;
+  std::string m_url;
+  std::vector<std::pair<std::string, std::string>> m_requestHeaders;
+  std::string m_mimeTypeOverride;
+  double m_timeout{0};
+  bool m_withCredentials{false};
+  bool m_sendFlag{false};
+  bool m_uploadComplete{true};
+  double m_uploadTotal{0};
+  double m_loaded{0};
+  double m_total{0};
+  int64_t m_requestId{0};
+
+  int32_t m_status{0};
+  std::string m_statusText;
+  std::string m_responseURL;
+  std::vector<std::pair<std::string, std::string>> m_responseHeaders;
+  std::vector<uint8_t> m_responseBytes;
+  // Decoded text and typed response are created lazily and cached until the next request.
+  ScriptValue m_responseText;
+  ScriptValue m_response;
+
+  EventTargetInstance *m_upload{nullptr};
+  ScriptValue m_uploadObject;
+  // Keep the request alive until it's finished even if page dropped the reference.
+  ScriptValue m_self;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_XML_HTTP_REQUEST_H
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "host_class.h"
+
+#define PRIVATE_PROTO_KEY "__private_proto__"
+
+namespace kraken::binding {
+
+HostClass::HostClass(ScriptContext *context, std::string name) : HostClass(context, nullptr, std::move(name)) {}
+
+HostClass::HostClass(ScriptContext *context, HostClass *parent, std::string name)
+  : HostObject(context, std::move(name), ObjectType::kConstructor,
+               parent == nullptr ? ScriptValue() : parent->classObject),
+    // The constructor holds itself, it's released with the context.
+    classObject(ScriptValue::adopt(context, object_)), prototypeObject(ScriptValue::makeObject(context)),
+    parent_(parent) {
+  if (parent != nullptr) prototypeObject.setPrototype(parent->prototypeObject, nullptr);
+  classObject.defineHiddenProperty("prototype", prototypeObject);
+  prototypeObject.defineHiddenProperty("constructor", classObject);
+}
+
+HostClass::~HostClass() = default;
+
+ScriptValue HostClass::instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) {
+  return ScriptValue();
+}
+
+ScriptValue HostClass::construct(const ScriptValue &subclassObject, const ScriptArguments &arguments,
+                                 ScriptValue *exception) {
+  if (!subclassObject.empty() && !hasInstance(subclassObject)) {
+    *exception = ScriptValue::makeError(context, "Class constructor " + name + " cannot be invoked without 'new'");
+    return ScriptValue();
+  }
+
+  ScriptValue instance = instanceConstructor(arguments, exception);
+  if (instance.empty()) {
+    if (exception->empty()) *exception = ScriptValue::makeError(context, "Illegal constructor");
+    return ScriptValue();
+  }
+  if (subclassObject.empty()) return instance;
+
+  subclassObject.defineHiddenProperty(PRIVATE_PROTO_KEY, instance);
+  return subclassObject;
+}
+
+bool HostClass::hasInstance(const ScriptValue &value) const {
+  if (!value.isObject()) return false;
+  for (ScriptValue prototype = value.getPrototype(); prototype.isObject(); prototype = prototype.getPrototype()) {
+    if (prototype.strictEquals(prototypeObject)) return true;
+  }
+  return false;
+}
+
+HostClass::Instance *HostClass::instanceOf(const ScriptValue &object) {
+  HostObject *hostObject = object.hostObject();
+  if (hostObject == nullptr && object.isObject()) {
+    ScriptValue exception;
+    hostObject = object.getProperty(PRIVATE_PROTO_KEY, &exception).hostObject();
+  }
+  if (hostObject == nullptr || !hostObject->isInstance()) return nullptr;
+  return static_cast<Instance *>(hostObject);
+}
+
+HostClass::Instance *HostClass::instanceOf(const ScriptValue &object, const HostClass *hostClass) {
+  Instance *instance = instanceOf(object);
+  if (instance == nullptr || !instance->_hostClass->isSubclassOf(hostClass)) return nullptr;
+  return instance;
+}
+
+bool HostClass::isSubclassOf(const HostClass *hostClass) const {
+  for (const HostClass *current = this; current != nullptr; current = current->parent_) {
+    if (current == hostClass) return true;
+  }
+  return false;
+}
+
+HostClass::Instance::Instance(HostClass *hostClass)
+  : HostObject(hostClass->context, hostClass->name, ObjectType::kObject, hostClass->prototypeObject),
+    _hostClass(hostClass) {
+  isInstance_ = true;
+}
+
+HostClass::Instance::~Instance() = default;
+
+} // namespace kraken::binding
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_HOST_CLASS_H
+#define KRAKENBRIDGE_SCRIPT_HOST_CLASS_H
+
+#include "host_object.h"
+
+namespace kraken::binding {
+
+// A constructor exposed to scripts. Instances created by `new` are HostClass::Instances, they inherit prototypeObject
+// so methods defined on it are shared by all of them. A class lives until its context is released.
+class HostClass : public HostObject {
+public:
+  HostClass() = delete;
+  HostClass(ScriptContext *context, std::string name);
+  // Instances inherit the prototype of parent as well, `instanceof` holds for both classes.
+  HostClass(ScriptContext *context, HostClass *parent, std::string name);
+  ~HostClass() override;
+
+  // Create the instance of `new`, return an empty value and set exception to throw.
+  virtual ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception);
+
+  class Instance : public HostObject {
+  public:
+    Instance() = delete;
+    explicit Instance(HostClass *hostClass);
+    ~Instance() override;
+
+    template <typename T> T *prototype() {
+      return static_cast<T *>(_hostClass);
+    }
+
+    HostClass *_hostClass;
+  };
+
+  // The instance of object, for methods to find their this object. Scripts compiled to ES5 call the constructor as a
+  // function from the constructor of their subclasses, objects of those subclasses have the instance created by the
+  // call instead.
+  static Instance *instanceOf(const ScriptValue &object);
+  template <typename T> static T *instanceOf(const ScriptValue &object) {
+    return static_cast<T *>(instanceOf(object));
+  }
+  // The instance of object when it's created by hostClass or by one of its subclasses, nullptr otherwise. Methods
+  // shared by a class hierarchy check their this object and arguments with it.
+  static Instance *instanceOf(const ScriptValue &object, const HostClass *hostClass);
+  template <typename T> static T *instanceOf(const ScriptValue &object, const HostClass *hostClass) {
+    return static_cast<T *>(instanceOf(object, hostClass));
+  }
+
+  // Whether this is hostClass or inherits it, without looking up any script object.
+  bool isSubclassOf(const HostClass *hostClass) const;
+
+  // Whether prototypeObject is on the prototype chain of value.
+  bool hasInstance(const ScriptValue &value) const;
+
+  // The constructor, it's the script object of this class.
+  ScriptValue classObject;
+  ScriptValue prototypeObject;
+
+private:
+  friend class HostClassBinding;
+  HostClass *parent_;
+  // `new` when subclassObject is empty, otherwise a call of the constructor as a function with subclassObject as
+  // this.
+  ScriptValue construct(const ScriptValue &subclassObject, const ScriptArguments &arguments, ScriptValue *exception);
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_HOST_CLASS_H
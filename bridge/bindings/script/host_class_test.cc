@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/host_class.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace kraken::binding;
+
+namespace {
+
+class HostClassTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    context = createJSContext(0, [this](int32_t contextId, const char *errmsg) { errors.emplace_back(errmsg); },
+                              nullptr);
+  }
+
+  bool evaluate(const std::u16string &code) {
+    return context->evaluateJavaScript(code.c_str(), code.size(), "vm://", 0);
+  }
+
+  ScriptValue global(const char *name) {
+    return globalObject(context.get()).getProperty(name, nullptr);
+  }
+
+  std::vector<std::string> errors;
+  std::unique_ptr<ScriptContext> context;
+};
+
+int instanceCount = 0;
+
+class Counter : public HostClass {
+public:
+  explicit Counter(ScriptContext *context) : HostClass(context, "Counter") {}
+  Counter(ScriptContext *context, HostClass *parent, std::string name) : HostClass(context, parent, std::move(name)) {}
+
+  ScriptValue instanceConstructor(const ScriptArguments &arguments, ScriptValue *exception) override {
+    if (arguments[0].isString()) {
+      *exception = ScriptValue::makeError(context, "count must be a number.");
+      return ScriptValue();
+    }
+    auto instance = new CounterInstance(this, static_cast<int>(arguments[0].toNumber()));
+    return instance->value();
+  }
+
+  class CounterInstance : public Instance {
+  public:
+    CounterInstance(Counter *counter, int count) : Instance(counter), count(count) {
+      instanceCount++;
+    }
+    ~CounterInstance() override {
+      instanceCount--;
+    }
+
+    ScriptValue getProperty(const std::string &name, ScriptValue *exception) override {
+      if (name == "count") return ScriptValue::makeNumber(context, count);
+      return Instance::getProperty(name, exception);
+    }
+
+    int count;
+  };
+
+private:
+  static ScriptValue increase(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                              void *data, ScriptValue *exception) {
+    auto instance = HostClass::instanceOf<CounterInstance>(thisObject);
+    if (instance == nullptr) {
+      *exception = ScriptValue::makeError(context, "Illegal invocation");
+      return ScriptValue();
+    }
+    return ScriptValue::makeNumber(context, ++instance->count);
+  }
+
+  FunctionHolder m_increase{context, prototypeObject, this, "increase", increase};
+};
+
+// Counting down is left to the parent, instances only differ by their class.
+class Countdown : public Counter {
+public:
+  Countdown(ScriptContext *context, Counter *counter) : Counter(context, counter, "Countdown") {}
+};
+
+} // namespace
+
+TEST_F(HostClassTest, construct) {
+  auto counter = new Counter(context.get());
+  EXPECT_EQ(counter->classObject.hostObject(), counter);
+  bindGlobalValue(context.get(), "Counter", counter->classObject);
+
+  ASSERT_TRUE(evaluate(u"var counter = new Counter(41); var result = counter.increase();"
+                       u"var isInstance = counter instanceof Counter && counter.constructor === Counter;"
+                       u"var keys = Object.keys(Counter.prototype).join() + ' ' + Counter.name;"
+                       u"var errors = [];"
+                       u"try { Counter(1); } catch (e) { errors.push(e.constructor.name); }"
+                       u"try { new Counter('1'); } catch (e) { errors.push(e.message); }"
+                       u"try { counter.increase.call({}); } catch (e) { errors.push(e.message); }"));
+  EXPECT_EQ(global("result").toNumber(), 42);
+  EXPECT_EQ(global("counter").getProperty("count", nullptr).toNumber(), 42);
+  EXPECT_TRUE(global("isInstance").toBoolean());
+  EXPECT_EQ(global("keys").toString(), "increase Counter");
+  EXPECT_EQ(global("errors").getProperty("length", nullptr).toNumber(), 3);
+  EXPECT_EQ(global("errors").getIndex(0, nullptr).toString(), "TypeError");
+  EXPECT_EQ(global("errors").getIndex(1, nullptr).toString(), "count must be a number.");
+  EXPECT_EQ(global("errors").getIndex(2, nullptr).toString(), "Illegal invocation");
+
+  auto instance = HostClass::instanceOf<Counter::CounterInstance>(global("counter"));
+  ASSERT_NE(instance, nullptr);
+  EXPECT_EQ(instance->prototype<Counter>(), counter);
+  EXPECT_TRUE(counter->hasInstance(global("counter")));
+  EXPECT_FALSE(counter->hasInstance(ScriptValue::makeObject(context.get())));
+  EXPECT_TRUE(errors.empty());
+}
+
+TEST_F(HostClassTest, inherit) {
+  auto counter = new Counter(context.get());
+  auto countdown = new Countdown(context.get(), counter);
+  bindGlobalValue(context.get(), "Counter", counter->classObject);
+  bindGlobalValue(context.get(), "Countdown", countdown->classObject);
+
+  ASSERT_TRUE(evaluate(u"var countdown = new Countdown(1); countdown.increase();"
+                       u"var result = countdown.count + ' ' + (countdown instanceof Countdown) + ' ' +"
+                       u"  (countdown instanceof Counter) + ' ' + (new Counter(0) instanceof Countdown) + ' ' +"
+                       u"  (Object.getPrototypeOf(Countdown) === Counter);"));
+  EXPECT_EQ(global("result").toString(), "2 true true false true");
+  EXPECT_TRUE(counter->isSubclassOf(counter));
+  EXPECT_TRUE(countdown->isSubclassOf(counter));
+  EXPECT_FALSE(counter->isSubclassOf(countdown));
+
+  ASSERT_TRUE(evaluate(u"var counter = new Counter(0);"));
+  EXPECT_NE(HostClass::instanceOf(global("countdown"), counter), nullptr);
+  EXPECT_EQ(HostClass::instanceOf(global("counter"), countdown), nullptr);
+  // Classes are host objects as well, but they are not instances.
+  EXPECT_EQ(HostClass::instanceOf(counter->classObject), nullptr);
+  EXPECT_TRUE(errors.empty());
+}
+
+// The polyfill is compiled to ES5, its classes extending host classes call the constructor as a function.
+TEST_F(HostClassTest, es5Subclass) {
+  bindGlobalValue(context.get(), "Counter", (new Counter(context.get()))->classObject);
+
+  ASSERT_TRUE(evaluate(u"function Clicks() { var _this = Counter.call(this, 10) || this; _this.label = 'clicks';"
+                       u"  return _this; }"
+                       u"Clicks.prototype = Object.create(Counter.prototype);"
+                       u"Clicks.prototype.constructor = Clicks;"
+                       u"var clicks = new Clicks(); clicks.increase();"
+                       u"var result = clicks.increase() + ' ' + clicks.label + ' ' + (clicks instanceof Counter);"
+                       u"var message; try { Counter.call({}, 1); } catch (e) { message = e.message; }"));
+  EXPECT_EQ(global("result").toString(), "12 clicks true");
+  EXPECT_EQ(HostClass::instanceOf<Counter::CounterInstance>(global("clicks"))->count, 12);
+  EXPECT_EQ(global("message").toString(), "Class constructor Counter cannot be invoked without 'new'");
+  EXPECT_TRUE(errors.empty());
+}
+
+TEST_F(HostClassTest, releasedWithContext) {
+  int count = instanceCount;
+  bindGlobalValue(context.get(), "Counter", (new Counter(context.get()))->classObject);
+  ASSERT_TRUE(evaluate(u"new Counter(1); var kept = new Counter(2);"));
+  EXPECT_GE(instanceCount, count + 1);
+
+  context.reset();
+  EXPECT_EQ(instanceCount, count);
+}
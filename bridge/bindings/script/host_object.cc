@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "host_object.h"
+#include "foundation/instance_tracker.h"
+
+namespace kraken::binding {
+
+HostObject::HostObject(ScriptContext *context, std::string name)
+  : HostObject(context, std::move(name), ObjectType::kObject, ScriptValue()) {}
+
+HostObject::~HostObject() {
+  unlink();
+  KRAKEN_UNTRACK_INSTANCE(this);
+}
+
+ScriptValue HostObject::getProperty(const std::string &name, ScriptValue *exception) {
+  return ScriptValue();
+}
+
+bool HostObject::setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) {
+  return false;
+}
+
+void HostObject::getPropertyNames(std::vector<std::string> &names) {}
+
+ScriptValue HostObject::value() const {
+  return ScriptValue(context, object_);
+}
+
+void HostObject::link() {
+  KRAKEN_TRACK_INSTANCE(this, contextId, name);
+  previous_ = context->lastHostObject;
+  if (previous_ != nullptr) previous_->next_ = this;
+  context->lastHostObject = this;
+}
+
+void HostObject::unlink() {
+  if (previous_ != nullptr) previous_->next_ = next_;
+  if (next_ != nullptr) {
+    next_->previous_ = previous_;
+  } else {
+    context->lastHostObject = previous_;
+  }
+  previous_ = next_ = nullptr;
+}
+
+FunctionHolder::FunctionHolder(ScriptContext *context, const ScriptValue &root, void *data, const char *name,
+                               NativeFunction function) {
+  root.setProperty(name, ScriptValue::makeFunction(context, name, function, data), nullptr);
+}
+
+} // namespace kraken::binding
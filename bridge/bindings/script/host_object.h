@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_HOST_OBJECT_H
+#define KRAKENBRIDGE_SCRIPT_HOST_OBJECT_H
+
+#include "script_value.h"
+#include <string>
+#include <vector>
+
+namespace kraken::binding {
+
+// A native object exposed to scripts. The script object is created with the host object and owns it, the host object
+// is deleted when the script object is collected or when its context is released, whichever comes first. Members
+// holding ScriptValues release them in the destructor, which runs while the context is still alive.
+class HostObject {
+public:
+  HostObject() = delete;
+  HostObject(ScriptContext *context, std::string name);
+  virtual ~HostObject();
+
+  // Return an empty value to leave the property to own properties of the script object and its prototype.
+  virtual ScriptValue getProperty(const std::string &name, ScriptValue *exception);
+  // Return false to store the value as an own property of the script object.
+  virtual bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception);
+  virtual void getPropertyNames(std::vector<std::string> &names);
+
+  // A new reference of the script object.
+  ScriptValue value() const;
+
+  // Whether this is an instance of a HostClass.
+  bool isInstance() const {
+    return isInstance_;
+  }
+
+  // Delete the host objects of context which are still alive, newest first so instances go before their classes.
+  // Contexts call it when they are released, script objects collected later don't call back into deleted objects.
+  static void disposeAll(ScriptContext *context);
+
+  std::string name;
+  ScriptContext *context;
+  int32_t contextId;
+
+protected:
+  enum class ObjectType { kObject, kConstructor };
+  // The script object of kObject inherits prototype, or Object.prototype when it's empty. kConstructor is a function
+  // object which constructs the instances of a HostClass.
+  HostObject(ScriptContext *context, std::string name, ObjectType type, const ScriptValue &prototype);
+
+  // The script object is weakly referenced, it's valid as long as this is alive.
+  RawScriptValue object_{};
+  bool isInstance_{false};
+
+private:
+  friend class HostObjectBinding;
+  void link();
+  void unlink();
+
+  // Host objects alive in a context are linked in the order they are created, the context points to the newest.
+  HostObject *previous_{nullptr};
+  HostObject *next_{nullptr};
+};
+
+// Whether name is the key of an index, such as `list[0]`.
+inline bool isNumberIndex(const std::string &name) {
+  if (name.empty()) return false;
+  char f = name[0];
+  return f >= '0' && f <= '9';
+}
+
+// Set name of root to a new function, which is called with data.
+class FunctionHolder {
+public:
+  FunctionHolder() = delete;
+  FunctionHolder(ScriptContext *context, const ScriptValue &root, void *data, const char *name,
+                 NativeFunction function);
+
+private:
+  FunctionHolder(const FunctionHolder &) = delete;
+  FunctionHolder &operator=(const FunctionHolder &) = delete;
+};
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_HOST_OBJECT_H
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "native_string_utils.h"
+#include <codecvt>
+#include <locale>
+
+namespace kraken::binding {
+
+namespace {
+thread_local std::u16string uiCommandArgsBuffer[2];
+
+std::u16string fromUTF8(const std::string &string) {
+  std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convertor;
+  return convertor.from_bytes(string);
+}
+
+void assignUICommandArgs(std::u16string &buffer, NativeString &args) {
+  args.string = reinterpret_cast<const uint16_t *>(buffer.data());
+  args.length = buffer.size();
+}
+} // namespace
+
+void buildUICommandArgs(const std::string &key, NativeString &args_01) {
+  uiCommandArgsBuffer[0] = fromUTF8(key);
+  assignUICommandArgs(uiCommandArgsBuffer[0], args_01);
+}
+
+void buildUICommandArgs(const std::string &key, const std::string &value, NativeString &args_01,
+                        NativeString &args_02) {
+  buildUICommandArgs(key, fromUTF8(value), args_01, args_02);
+}
+
+void buildUICommandArgs(const std::string &key, const std::u16string &value, NativeString &args_01,
+                        NativeString &args_02) {
+  uiCommandArgsBuffer[0] = fromUTF8(key);
+  uiCommandArgsBuffer[1] = value;
+  assignUICommandArgs(uiCommandArgsBuffer[0], args_01);
+  assignUICommandArgs(uiCommandArgsBuffer[1], args_02);
+}
+
+NativeString *stringToNativeString(const std::string &string) {
+  return stringToNativeString(fromUTF8(string));
+}
+
+NativeString *stringToNativeString(const std::u16string &string) {
+  NativeString tmp{};
+  tmp.string = reinterpret_cast<const uint16_t *>(string.c_str());
+  tmp.length = string.size();
+  return tmp.clone();
+}
+
+std::u16string nativeStringToU16String(const NativeString *string) {
+  return std::u16string(reinterpret_cast<const char16_t *>(string->string), string->length);
+}
+
+std::string nativeStringToStdString(const NativeString *string) {
+  std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convertor;
+  return convertor.to_bytes(nativeStringToU16String(string));
+}
+
+} // namespace kraken::binding
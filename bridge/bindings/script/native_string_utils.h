@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_NATIVE_STRING_UTILS_H
+#define KRAKENBRIDGE_SCRIPT_NATIVE_STRING_UTILS_H
+
+#include "include/kraken_bridge.h"
+#include <string>
+
+namespace kraken::binding {
+
+// UI command args only need to live until the command is registered, registerCommand() copies them. They borrow a
+// per-thread buffer, so args built by the next call replace them.
+void buildUICommandArgs(const std::string &key, NativeString &args_01);
+void buildUICommandArgs(const std::string &key, const std::string &value, NativeString &args_01,
+                        NativeString &args_02);
+void buildUICommandArgs(const std::string &key, const std::u16string &value, NativeString &args_01,
+                        NativeString &args_02);
+
+// A copy of string owned by the caller, dart frees the strings of structs it's given.
+NativeString *stringToNativeString(const std::string &string);
+NativeString *stringToNativeString(const std::u16string &string);
+
+std::u16string nativeStringToU16String(const NativeString *string);
+std::string nativeStringToStdString(const NativeString *string);
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_NATIVE_STRING_UTILS_H
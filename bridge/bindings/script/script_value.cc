@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "script_value.h"
+
+namespace kraken::binding {
+
+ScriptValue::ScriptValue(ScriptContext *context, RawScriptValue value) : context_(context), value_(value) {
+  retain();
+}
+
+ScriptValue::ScriptValue(const ScriptValue &other) : context_(other.context_), value_(other.value_) {
+  retain();
+}
+
+ScriptValue::ScriptValue(ScriptValue &&other) noexcept {
+  takeOver(other);
+}
+
+ScriptValue &ScriptValue::operator=(const ScriptValue &other) {
+  if (this == &other) return *this;
+  release();
+  context_ = other.context_;
+  value_ = other.value_;
+  retain();
+  return *this;
+}
+
+ScriptValue &ScriptValue::operator=(ScriptValue &&other) noexcept {
+  if (this == &other) return *this;
+  release();
+  takeOver(other);
+  return *this;
+}
+
+ScriptValue::~ScriptValue() {
+  release();
+}
+
+ScriptValue ScriptValue::makePromise(ScriptContext *context, NativeFunction executor, void *data,
+                                     ScriptValue *exception) {
+  ScriptValue promiseConstructor = globalObject(context).getProperty("Promise", exception);
+  if (promiseConstructor.empty()) return ScriptValue();
+  return promiseConstructor.construct({makeFunction(context, "executor", executor, data)}, exception);
+}
+
+std::vector<std::string> ScriptValue::keys(ScriptValue *exception) const {
+  std::vector<std::string> result;
+  ScriptValue objectConstructor = globalObject(context_).getProperty("Object", exception);
+  if (objectConstructor.empty()) return result;
+  ScriptValue objectKeys = objectConstructor.getProperty("keys", exception);
+  if (objectKeys.empty()) return result;
+  ScriptValue names = objectKeys.call(ScriptValue(), {*this}, exception);
+  if (names.empty()) return result;
+
+  auto length = static_cast<uint32_t>(names.getProperty("length", nullptr).toNumber());
+  result.reserve(length);
+  for (uint32_t i = 0; i < length; i++) {
+    result.emplace_back(names.getIndex(i, nullptr).toString());
+  }
+  return result;
+}
+
+ScriptValue ScriptArguments::operator[](size_t index) const {
+  if (index >= count_) return ScriptValue::undefined(context_);
+  return ScriptValue(context_, values_[index]);
+}
+
+void bindGlobalValue(ScriptContext *context, const char *name, const ScriptValue &value) {
+  globalObject(context).setProperty(name, value, nullptr);
+}
+
+} // namespace kraken::binding
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_SCRIPT_VALUE_H
+#define KRAKENBRIDGE_SCRIPT_VALUE_H
+
+#if KRAKEN_JSC_ENGINE
+#include "bindings/jsc/js_context_internal.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bindings/qjs/js_context_internal.h"
+#endif
+
+#include <string>
+#include <vector>
+
+// Bindings written against ScriptValue, HostObject and HostClass compile for every engine, the engine is picked at
+// build time so the layer adds no dispatch of its own.
+namespace kraken::binding {
+
+#if KRAKEN_JSC_ENGINE
+using ScriptContext = jsc::JSContext;
+using RawScriptValue = JSValueRef;
+using jsc::createJSContext;
+#elif KRAKEN_QUICK_JS_ENGINE
+using ScriptContext = qjs::JSContext;
+using RawScriptValue = JSValue;
+using qjs::createJSContext;
+#endif
+
+class HostObject;
+class ScriptArguments;
+class ScriptValue;
+
+// Return an empty ScriptValue for undefined. Set exception to throw it to the caller instead.
+using NativeFunction = ScriptValue (*)(ScriptContext *context, const ScriptValue &thisObject,
+                                       const ScriptArguments &arguments, void *data, ScriptValue *exception);
+
+// A value of the script engine which is kept alive as long as it's held. Values belong to the context they are
+// created in and must be released before the context is.
+//
+// JavaScriptCore finds the values on the native stack by itself, there ScriptValue only borrows them, values stored
+// anywhere else, like members of host objects or elements of containers, are protected.
+//
+// Operations which can throw take an exception pointer, the exception is stored in it and an empty value is
+// returned. When exception is nullptr the exception is reported to the context instead.
+class ScriptValue {
+public:
+  // An empty value, which holds nothing. It's returned when an operation throws, and by host objects which leave a
+  // property to the engine.
+  ScriptValue() = default;
+  // Retain value, which stays owned by the caller.
+  ScriptValue(ScriptContext *context, RawScriptValue value);
+  ScriptValue(const ScriptValue &other);
+  ScriptValue(ScriptValue &&other) noexcept;
+  ScriptValue &operator=(const ScriptValue &other);
+  ScriptValue &operator=(ScriptValue &&other) noexcept;
+  ~ScriptValue();
+
+  // Take over a value returned by the engine, QuickJS returns values which already hold a reference.
+  static ScriptValue adopt(ScriptContext *context, RawScriptValue value);
+
+  static ScriptValue undefined(ScriptContext *context);
+  static ScriptValue null(ScriptContext *context);
+  static ScriptValue makeBoolean(ScriptContext *context, bool value);
+  static ScriptValue makeNumber(ScriptContext *context, double value);
+  static ScriptValue makeString(ScriptContext *context, const std::string &string);
+  static ScriptValue makeString(ScriptContext *context, const std::u16string &string);
+  static ScriptValue makeObject(ScriptContext *context);
+  static ScriptValue makeArray(ScriptContext *context, const std::vector<ScriptValue> &elements);
+  // A TypeError with message, throw it by storing it into the exception of a callback.
+  static ScriptValue makeError(ScriptContext *context, const std::string &message);
+  static ScriptValue makeRangeError(ScriptContext *context, const std::string &message);
+  // The bytes are copied.
+  static ScriptValue makeArrayBuffer(ScriptContext *context, const uint8_t *bytes, size_t length);
+  // The bytes are copied.
+  static ScriptValue makeUint8Array(ScriptContext *context, const uint8_t *bytes, size_t length);
+  static ScriptValue makeFunction(ScriptContext *context, const char *name, NativeFunction function, void *data);
+  // new Promise(executor), executor is called with resolve and reject as arguments before this returns.
+  static ScriptValue makePromise(ScriptContext *context, NativeFunction executor, void *data, ScriptValue *exception);
+  // The value of JSON text, or an empty value when json is not valid JSON. Nothing is thrown.
+  static ScriptValue parseJSON(ScriptContext *context, const std::u16string &json);
+
+  bool empty() const;
+  bool isUndefined() const;
+  bool isNull() const;
+  bool isBoolean() const;
+  bool isNumber() const;
+  bool isString() const;
+  bool isSymbol() const;
+  bool isObject() const;
+  bool isFunction() const;
+  bool isArray() const;
+
+  bool toBoolean() const;
+  double toNumber() const;
+  std::string toString() const;
+  std::u16string toU16String() const;
+  // The storage of an Uint8Array, nullptr when this is not an Uint8Array.
+  uint8_t *uint8ArrayBytes(size_t *length) const;
+  // The storage of an ArrayBuffer or of a typed array, nullptr for other values.
+  uint8_t *bufferSourceBytes(size_t *length) const;
+  // JSON.stringify(this), undefined when this has no JSON representation, such as functions.
+  ScriptValue toJSON(ScriptValue *exception) const;
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) const;
+  void setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) const;
+  ScriptValue getIndex(uint32_t index, ScriptValue *exception) const;
+  bool hasProperty(const std::string &name) const;
+  void deleteProperty(const std::string &name, ScriptValue *exception) const;
+  // Object.keys(this), the own enumerable string keys.
+  std::vector<std::string> keys(ScriptValue *exception) const;
+  // Define a property scripts don't enumerate, for links between objects which are not part of their interface.
+  void defineHiddenProperty(const std::string &name, const ScriptValue &value) const;
+  ScriptValue getPrototype() const;
+  void setPrototype(const ScriptValue &prototype, ScriptValue *exception) const;
+  bool strictEquals(const ScriptValue &other) const;
+  ScriptValue call(const ScriptValue &thisObject, const std::vector<ScriptValue> &arguments,
+                   ScriptValue *exception) const;
+  // new this(...arguments)
+  ScriptValue construct(const std::vector<ScriptValue> &arguments, ScriptValue *exception) const;
+
+  // The host object of objects created by HostObject and HostClass, nullptr for other values.
+  HostObject *hostObject() const;
+  template <typename T> T *hostObject() const {
+    return static_cast<T *>(hostObject());
+  }
+
+  ScriptContext *context() const {
+    return context_;
+  }
+  // Borrow the engine value, it's valid as long as this is alive.
+  RawScriptValue raw() const {
+    return value_;
+  }
+
+private:
+  void retain();
+  void release();
+  // Take the value of other, which is left empty.
+  void takeOver(ScriptValue &other);
+
+  ScriptContext *context_{nullptr};
+#if KRAKEN_JSC_ENGINE
+  RawScriptValue value_{nullptr};
+  bool protected_{false};
+#elif KRAKEN_QUICK_JS_ENGINE
+  // Scripts can't produce uninitialized values, so it's used for empty values.
+  RawScriptValue value_{JS_UNINITIALIZED};
+#endif
+};
+
+// Arguments of a native function, values are only wrapped when they are read.
+class ScriptArguments {
+public:
+  ScriptArguments(ScriptContext *context, size_t count, const RawScriptValue *values)
+    : context_(context), count_(count), values_(values) {}
+
+  size_t size() const {
+    return count_;
+  }
+  // Undefined when index is out of range, the same as a missing argument in scripts.
+  ScriptValue operator[](size_t index) const;
+
+private:
+  ScriptContext *context_;
+  size_t count_;
+  const RawScriptValue *values_;
+};
+
+#if KRAKEN_JSC_ENGINE
+// JavaScriptCore finds the objects native code works with on the native stack.
+class ScriptScope {
+public:
+  explicit ScriptScope(ScriptContext *context) {}
+};
+#elif KRAKEN_QUICK_JS_ENGINE
+// Native code called from dart which creates host objects and calls into scripts runs in a scope, objects created
+// in it are kept alive until it's left.
+using ScriptScope = qjs::JSContext::EntryScope;
+#endif
+
+ScriptValue globalObject(ScriptContext *context);
+// Set name of the global object to value.
+void bindGlobalValue(ScriptContext *context, const char *name, const ScriptValue &value);
+// Call listener with the module events of moduleName dispatched by dart, the bridge of context keeps it alive.
+void addModuleListener(ScriptContext *context, const std::u16string &moduleName, const ScriptValue &listener);
+
+} // namespace kraken::binding
+
+#endif // KRAKENBRIDGE_SCRIPT_VALUE_H
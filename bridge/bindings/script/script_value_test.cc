@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/host_object.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// The same suite runs against the engine the bridge is built with.
+using namespace kraken::binding;
+
+namespace {
+
+class ScriptValueTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    context = createJSContext(0, [this](int32_t contextId, const char *errmsg) { errors.emplace_back(errmsg); },
+                              nullptr);
+  }
+
+  bool evaluate(const std::u16string &code) {
+    return context->evaluateJavaScript(code.c_str(), code.size(), "vm://", 0);
+  }
+
+  ScriptValue global(const char *name) {
+    return globalObject(context.get()).getProperty(name, nullptr);
+  }
+
+  std::vector<std::string> errors;
+  std::unique_ptr<ScriptContext> context;
+};
+
+int hostObjectCount = 0;
+
+class Counter : public HostObject {
+public:
+  Counter(ScriptContext *context, int count) : HostObject(context, "Counter"), count(count) {
+    hostObjectCount++;
+  }
+  ~Counter() override {
+    hostObjectCount--;
+  }
+
+  ScriptValue getProperty(const std::string &name, ScriptValue *exception) override {
+    if (name == "count") return ScriptValue::makeNumber(context, count);
+    if (name == "broken") *exception = ScriptValue::makeError(context, "broken is not readable");
+    return HostObject::getProperty(name, exception);
+  }
+
+  bool setProperty(const std::string &name, const ScriptValue &value, ScriptValue *exception) override {
+    if (name == "count") {
+      count = static_cast<int>(value.toNumber());
+      return true;
+    }
+    return HostObject::setProperty(name, value, exception);
+  }
+
+  void getPropertyNames(std::vector<std::string> &names) override {
+    names.emplace_back("count");
+  }
+
+  int count;
+};
+
+ScriptValue add(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments, void *data,
+                ScriptValue *exception) {
+  if (arguments.size() < 2) {
+    *exception = ScriptValue::makeError(context, "2 arguments required.");
+    return ScriptValue();
+  }
+  return ScriptValue::makeNumber(context, arguments[0].toNumber() + arguments[1].toNumber());
+}
+
+ScriptValue store(ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments, void *data,
+                  ScriptValue *exception) {
+  static_cast<std::vector<ScriptValue> *>(data)->emplace_back(arguments[0]);
+  return ScriptValue();
+}
+
+} // namespace
+
+TEST_F(ScriptValueTest, primitives) {
+  ASSERT_TRUE(evaluate(u"var number = 42; var string = '你好, kraken'; var flag = true; var nothing = null;"));
+
+  EXPECT_EQ(global("number").toNumber(), 42);
+  EXPECT_EQ(global("string").toString(), "你好, kraken");
+  EXPECT_EQ(global("string").toU16String(), u"你好, kraken");
+  EXPECT_TRUE(global("flag").isBoolean());
+  EXPECT_TRUE(global("flag").toBoolean());
+  EXPECT_TRUE(global("nothing").isNull());
+  EXPECT_TRUE(global("missing").isUndefined());
+  EXPECT_FALSE(global("missing").empty());
+  EXPECT_TRUE(ScriptValue().empty());
+
+  ScriptValue string = ScriptValue::makeString(context.get(), u"ユニコード");
+  EXPECT_TRUE(string.isString());
+  EXPECT_EQ(string.toString(), "ユニコード");
+
+  // Lone surrogates are kept, TextEncoder relies on seeing them.
+  std::u16string loneSurrogate{u'a', static_cast<char16_t>(0xD800), u'b'};
+  EXPECT_EQ(ScriptValue::makeString(context.get(), loneSurrogate).toU16String(), loneSurrogate);
+}
+
+TEST_F(ScriptValueTest, objectsAndArrays) {
+  ScriptValue object = ScriptValue::makeObject(context.get());
+  object.setProperty("name", ScriptValue::makeString(context.get(), std::string("kraken")), nullptr);
+  std::vector<ScriptValue> elements{ScriptValue::makeNumber(context.get(), 1), object};
+  bindGlobalValue(context.get(), "list", ScriptValue::makeArray(context.get(), elements));
+
+  ASSERT_TRUE(evaluate(u"var result = list.length === 2 && list[0] === 1 && list[1].name === 'kraken';"));
+  EXPECT_TRUE(global("result").toBoolean());
+  EXPECT_TRUE(global("list").isArray());
+  EXPECT_EQ(global("list").getIndex(1, nullptr).getProperty("name", nullptr).toString(), "kraken");
+}
+
+TEST_F(ScriptValueTest, uint8Array) {
+  const uint8_t bytes[] = {1, 2, 3};
+  bindGlobalValue(context.get(), "bytes", ScriptValue::makeUint8Array(context.get(), bytes, 3));
+  ASSERT_TRUE(evaluate(u"var result = bytes instanceof Uint8Array && bytes.join() === '1,2,3';"
+                       u"var view = new Uint8Array(new ArrayBuffer(8), 2, 4); view[0] = 7;"));
+  EXPECT_TRUE(global("result").toBoolean());
+
+  size_t length = 0;
+  uint8_t *view = global("view").uint8ArrayBytes(&length);
+  ASSERT_NE(view, nullptr);
+  EXPECT_EQ(length, 4);
+  EXPECT_EQ(view[0], 7);
+  EXPECT_EQ(global("result").uint8ArrayBytes(&length), nullptr);
+  EXPECT_EQ(ScriptValue::makeObject(context.get()).uint8ArrayBytes(&length), nullptr);
+}
+
+TEST_F(ScriptValueTest, bufferSources) {
+  const uint8_t bytes[] = {1, 2, 3};
+  bindGlobalValue(context.get(), "buffer", ScriptValue::makeArrayBuffer(context.get(), bytes, 3));
+  ASSERT_TRUE(evaluate(u"var result = buffer instanceof ArrayBuffer && new Uint8Array(buffer).join() === '1,2,3';"
+                       u"var words = new Uint16Array(new ArrayBuffer(8), 2, 3); words[0] = 0x0101;"));
+  EXPECT_TRUE(global("result").toBoolean());
+
+  size_t length = 0;
+  uint8_t *buffer = global("buffer").bufferSourceBytes(&length);
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(length, 3);
+  EXPECT_EQ(buffer[2], 3);
+  uint8_t *words = global("words").bufferSourceBytes(&length);
+  ASSERT_NE(words, nullptr);
+  EXPECT_EQ(length, 6);
+  EXPECT_EQ(words[0], 1);
+  EXPECT_EQ(ScriptValue::makeString(context.get(), std::string("123")).bufferSourceBytes(&length), nullptr);
+}
+
+TEST_F(ScriptValueTest, json) {
+  ScriptValue value = ScriptValue::parseJSON(context.get(), u"{\"name\": \"kraken\", \"list\": [1, 2]}");
+  ASSERT_TRUE(value.isObject());
+  EXPECT_EQ(value.getProperty("name", nullptr).toString(), "kraken");
+  EXPECT_EQ(value.toJSON(nullptr).toString(), "{\"name\":\"kraken\",\"list\":[1,2]}");
+  EXPECT_TRUE(ScriptValue::parseJSON(context.get(), u"{broken").empty());
+  EXPECT_TRUE(ScriptValue::makeFunction(context.get(), "add", add, nullptr).toJSON(nullptr).isUndefined());
+  EXPECT_TRUE(errors.empty());
+}
+
+TEST_F(ScriptValueTest, properties) {
+  ASSERT_TRUE(evaluate(u"function Point(x) { this.x = x; } Point.prototype.inherited = 1;"
+                       u"var point = new Point(1); point.y = 2;"
+                       u"Object.defineProperty(point, 'hidden', { value: 3, enumerable: false });"));
+  ScriptValue point = global("point");
+  EXPECT_EQ(point.keys(nullptr), std::vector<std::string>({"x", "y"}));
+  EXPECT_TRUE(point.hasProperty("inherited"));
+  EXPECT_TRUE(point.hasProperty("hidden"));
+  point.deleteProperty("x", nullptr);
+  EXPECT_FALSE(point.hasProperty("x"));
+
+  ScriptValue constructed = global("Point").construct({ScriptValue::makeNumber(context.get(), 7)}, nullptr);
+  EXPECT_EQ(constructed.getProperty("x", nullptr).toNumber(), 7);
+  ScriptValue exception;
+  EXPECT_TRUE(point.construct({}, &exception).empty());
+  EXPECT_TRUE(exception.isObject());
+}
+
+TEST_F(ScriptValueTest, errorTypes) {
+  bindGlobalValue(context.get(), "typeError", ScriptValue::makeError(context.get(), "wrong type"));
+  bindGlobalValue(context.get(), "rangeError", ScriptValue::makeRangeError(context.get(), "out of range"));
+  ASSERT_TRUE(evaluate(u"var result = typeError instanceof TypeError && rangeError instanceof RangeError &&"
+                       u"  rangeError.message === 'out of range';"));
+  EXPECT_TRUE(global("result").toBoolean());
+}
+
+TEST_F(ScriptValueTest, promise) {
+  auto resolveWithData = [](ScriptContext *context, const ScriptValue &thisObject, const ScriptArguments &arguments,
+                            void *data, ScriptValue *exception) -> ScriptValue {
+    return arguments[0].call(ScriptValue(), {ScriptValue::makeNumber(context, *static_cast<int *>(data))},
+                             exception);
+  };
+  int data = 42;
+  ScriptValue promise = ScriptValue::makePromise(context.get(), resolveWithData, &data, nullptr);
+  bindGlobalValue(context.get(), "promise", promise);
+  ASSERT_TRUE(evaluate(u"var result = promise instanceof Promise; var resolved;"
+                       u"promise.then(function(value) { resolved = value; });"));
+  EXPECT_TRUE(global("result").toBoolean());
+  // Promise jobs run once the script returns to native code.
+  ASSERT_TRUE(evaluate(u""));
+  EXPECT_EQ(global("resolved").toNumber(), 42);
+}
+
+TEST_F(ScriptValueTest, exceptions) {
+  ASSERT_TRUE(evaluate(u"var object = { get broken() { throw new Error('broken'); } };"
+                       u"function fail() { throw new Error('failed'); }"));
+
+  ScriptValue exception;
+  EXPECT_TRUE(global("object").getProperty("broken", &exception).empty());
+  EXPECT_EQ(exception.getProperty("message", nullptr).toString(), "broken");
+  EXPECT_TRUE(errors.empty());
+
+  EXPECT_TRUE(global("fail").call(ScriptValue(), {}, nullptr).empty());
+  ASSERT_EQ(errors.size(), 1);
+  EXPECT_NE(errors[0].find("failed"), std::string::npos);
+}
+
+TEST_F(ScriptValueTest, nativeFunction) {
+  ScriptValue function = ScriptValue::makeFunction(context.get(), "add", add, nullptr);
+  EXPECT_TRUE(function.isFunction());
+  bindGlobalValue(context.get(), "add", function);
+
+  ASSERT_TRUE(evaluate(u"var sum = add(1, 2); var name = add.name;"
+                       u"var message; try { add(1); } catch (e) { message = e.message; }"));
+  EXPECT_EQ(global("sum").toNumber(), 3);
+  EXPECT_EQ(global("name").toString(), "add");
+  EXPECT_EQ(global("message").toString(), "2 arguments required.");
+
+  std::vector<ScriptValue> arguments{ScriptValue::makeNumber(context.get(), 20),
+                                     ScriptValue::makeNumber(context.get(), 22)};
+  EXPECT_EQ(function.call(ScriptValue(), arguments, nullptr).toNumber(), 42);
+}
+
+TEST_F(ScriptValueTest, hostObject) {
+  auto counter = new Counter(context.get(), 1);
+  ScriptValue object = counter->value();
+  EXPECT_EQ(object.hostObject<Counter>(), counter);
+  EXPECT_EQ(counter->value().hostObject(), counter);
+  EXPECT_EQ(ScriptValue::makeObject(context.get()).hostObject(), nullptr);
+  bindGlobalValue(context.get(), "counter", object);
+
+  ASSERT_TRUE(evaluate(u"counter.count = 5; counter.label = 'clicks';"
+                       u"var keys = Object.keys(counter).sort().join();"
+                       u"var result = counter.count + ' ' + counter.label + ' ' + counter.hasOwnProperty('toString');"
+                       u"var message; try { counter.broken; } catch (e) { message = e.message; }"));
+  EXPECT_EQ(counter->count, 5);
+  EXPECT_EQ(global("keys").toString(), "count,label");
+  EXPECT_EQ(global("result").toString(), "5 clicks false");
+  EXPECT_EQ(global("message").toString(), "broken is not readable");
+}
+
+TEST_F(ScriptValueTest, hostObjectsAreReleasedWithContext) {
+  int count = hostObjectCount;
+  bindGlobalValue(context.get(), "counter", (new Counter(context.get(), 0))->value());
+  new Counter(context.get(), 0);
+  // Unreferenced objects may already be collected, depending on the engine.
+  EXPECT_GE(hostObjectCount, count + 1);
+
+  context.reset();
+  EXPECT_EQ(hostObjectCount, count);
+}
+
+// JavaScriptCore only finds values on the native stack by itself, values stored anywhere else must stay alive.
+TEST_F(ScriptValueTest, storedValuesSurviveCollection) {
+  std::vector<ScriptValue> stored;
+  bindGlobalValue(context.get(), "store", ScriptValue::makeFunction(context.get(), "store", store, &stored));
+  auto member = std::make_unique<ScriptValue>(ScriptValue::makeString(context.get(), std::string("member")));
+
+  ASSERT_TRUE(evaluate(u"store({name: 'argument'}); store = undefined;"
+                       u"for (var i = 0; i < 1000000; i++) { var a = {}; a.self = a; }"));
+  ASSERT_EQ(stored.size(), 1);
+  EXPECT_EQ(stored[0].getProperty("name", nullptr).toString(), "argument");
+  EXPECT_EQ(member->toString(), "member");
+  EXPECT_TRUE(errors.empty());
+}
@@ -0,0 +1,16 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKEN_BRIDGE_H_
+#define KRAKEN_BRIDGE_H_
+
+// The JSBridge of the engine the bridge is built with, for code written against bindings/script.
+#if KRAKEN_JSC_ENGINE
+#include "bridge_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_qjs.h"
+#endif
+
+#endif // KRAKEN_BRIDGE_H_
@@ -7,42 +7,62 @@
 
 #include "bridge_jsc.h"
 #include "foundation/logging.h"
+#include "foundation/trace_event.h"
 #include "polyfill.h"
 
 #include "dart_methods.h"
 #include <atomic>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 
-#include "bindings/jsc/DOM/comment_node.h"
-#include "bindings/jsc/DOM/custom_event.h"
-#include "bindings/jsc/DOM/document.h"
-#include "bindings/jsc/DOM/element.h"
-#include "bindings/jsc/DOM/elements/image_element.h"
-#include "bindings/jsc/DOM/elements/input_element.h"
-#include "bindings/jsc/DOM/event.h"
-#include "bindings/jsc/DOM/custom_event.h"
-#include "bindings/jsc/DOM/gesture_event.h"
-#include "bindings/jsc/DOM/events/input_event.h"
-#include "bindings/jsc/DOM/event_target.h"
-#include "bindings/jsc/DOM/events/close_event.h"
-#include "bindings/jsc/DOM/events/input_event.h"
-#include "bindings/jsc/DOM/events/intersection_change_event.h"
-#include "bindings/jsc/DOM/events/media_error_event.h"
-#include "bindings/jsc/DOM/events/message_event.h"
-#include "bindings/jsc/DOM/events/touch_event.h"
-#include "bindings/jsc/DOM/node.h"
-#include "bindings/jsc/DOM/style_declaration.h"
-#include "bindings/jsc/DOM/text_node.h"
-#include "bindings/jsc/KOM/blob.h"
-#include "bindings/jsc/KOM/console.h"
-#include "bindings/jsc/KOM/location.h"
-#include "bindings/jsc/KOM/performance.h"
-#include "bindings/jsc/KOM/screen.h"
-#include "bindings/jsc/KOM/window.h"
+// The heap of a context is only reachable through the internal headers, which must match the library linked, that's
+// only the case for the vendored Android build, the system framework of Apple platforms may differ.
+#if defined(IS_ANDROID)
+#include <wtf/Platform.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/StdLibExtras.h>
+#include <JavaScriptCore/JSExportMacros.h>
+#include <JavaScriptCore/APICast.h>
+#include <JavaScriptCore/Heap.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/VM.h>
+#endif
+
 #include "bindings/jsc/js_context_internal.h"
 #include "bindings/jsc/kraken.h"
 #include "bindings/jsc/ui_manager.h"
+#include "bindings/script/DOM/comment_node.h"
+#include "bindings/script/DOM/custom_event.h"
+#include "bindings/script/DOM/document.h"
+#include "bindings/script/DOM/element.h"
+#include "bindings/script/DOM/elements/image_element.h"
+#include "bindings/script/DOM/elements/input_element.h"
+#include "bindings/script/DOM/event.h"
+#include "bindings/script/DOM/event_target.h"
+#include "bindings/script/DOM/events/close_event.h"
+#include "bindings/script/DOM/events/input_event.h"
+#include "bindings/script/DOM/events/intersection_change_event.h"
+#include "bindings/script/DOM/events/media_error_event.h"
+#include "bindings/script/DOM/events/message_event.h"
+#include "bindings/script/DOM/events/progress_event.h"
+#include "bindings/script/DOM/events/touch_event.h"
+#include "bindings/script/DOM/gesture_event.h"
+#include "bindings/script/DOM/node.h"
+#include "bindings/script/DOM/style_declaration.h"
+#include "bindings/script/DOM/text_node.h"
+#include "bindings/script/KOM/blob.h"
+#include "bindings/script/KOM/console.h"
+#include "bindings/script/KOM/location.h"
+#include "bindings/script/KOM/performance.h"
+#include "bindings/script/KOM/performance_observer.h"
+#include "bindings/script/KOM/screen.h"
+#include "bindings/script/KOM/text_decoder.h"
+#include "bindings/script/KOM/text_encoder.h"
+#include "bindings/script/KOM/url.h"
+#include "bindings/script/KOM/url_search_params.h"
+#include "bindings/script/KOM/window.h"
+#include "bindings/script/KOM/xml_http_request.h"
 
 namespace kraken {
 
@@ -50,26 +70,46 @@ using namespace binding::jsc;
 
 std::unordered_map<std::string, NativeString> JSBridge::pluginSourceCode {};
 
+// Read once at startup, invokeModuleEvent is too hot to query the environment for each event.
+static const bool enableJSLog = [] {
+  const char *env = std::getenv("ENABLE_KRAKEN_JS_LOG");
+  return env != nullptr && strcmp(env, "true") == 0;
+}();
+
+static JSBridge::ModuleListeners appendModuleListener(const JSBridge::ModuleListeners &listeners,
+                                                      JSObjectRef callback) {
+  auto next = listeners == nullptr ? std::make_shared<std::vector<JSObjectRef>>()
+                                   : std::make_shared<std::vector<JSObjectRef>>(*listeners);
+  next->emplace_back(callback);
+  return next;
+}
+
 /**
  * JSRuntime
  */
-JSBridge::JSBridge(int32_t contextId, const JSExceptionHandler &handler) : contextId(contextId) {
+JSBridge::JSBridge(int32_t contextId, const JSExceptionHandler &handler) : JSBridge(contextId, handler, false) {}
+
+JSBridge::JSBridge(int32_t contextId, const JSExceptionHandler &handler, bool standby) : contextId(contextId) {
   auto errorHandler = [handler, this](int32_t contextId, const char *errmsg) {
     handler(contextId, errmsg);
     // trigger window.onerror handler.
     // TODO: trigger oneror event.
   };
+  TRACE_EVENT("bridge", "createBridge");
 
 #if ENABLE_PROFILE
-  double jsContextStartTime =
-    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+  int64_t jsContextStartTime =
+    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 #endif
   bridgeCallback = new foundation::BridgeCallback();
 
   context = binding::jsc::createJSContext(contextId, errorHandler, this);
+  if (standby) {
+    context->enterStandby();
+  }
 
 #if ENABLE_PROFILE
-  auto nativePerformance = binding::jsc::NativePerformance::instance(context->uniqueId);
+  auto nativePerformance = binding::NativePerformance::instance(context.get());
   nativePerformance->mark(PERF_JS_CONTEXT_INIT_START, jsContextStartTime);
   nativePerformance->mark(PERF_JS_CONTEXT_INIT_END);
   nativePerformance->mark(PERF_JS_NATIVE_METHOD_INIT_START);
@@ -77,29 +117,36 @@ JSBridge::JSBridge(int32_t contextId, const JSExceptionHandler &handler) : conte
 
   bindKraken(context);
   bindUIManager(context);
-  bindConsole(context);
-  bindEvent(context);
-  bindCustomEvent(context);
-  bindCloseEvent(context);
-  bindGestureEvent(context);
-  bindMediaErrorEvent(context);
-  bindTouchEvent(context);
-  bindInputEvent(context);
-  bindIntersectionChangeEvent(context);
-  bindMessageEvent(context);
-  bindEventTarget(context);
-  bindDocument(context);
-  bindNode(context);
-  bindTextNode(context);
-  bindCommentNode(context);
-  bindElement(context);
-  bindImageElement(context);
-  bindInputElement(context);
-  bindWindow(context);
-  bindPerformance(context);
-  bindCSSStyleDeclaration(context);
-  bindScreen(context);
-  bindBlob(context);
+  binding::bindConsole(context.get());
+  binding::bindEvent(context.get());
+  binding::bindCustomEvent(context.get());
+  binding::bindCloseEvent(context.get());
+  binding::bindGestureEvent(context.get());
+  binding::bindMediaErrorEvent(context.get());
+  binding::bindTouchEvent(context.get());
+  binding::bindInputEvent(context.get());
+  binding::bindIntersectionChangeEvent(context.get());
+  binding::bindMessageEvent(context.get());
+  binding::bindProgressEvent(context.get());
+  binding::bindEventTarget(context.get());
+  binding::bindDocument(context.get());
+  binding::bindNode(context.get());
+  binding::bindTextNode(context.get());
+  binding::bindCommentNode(context.get());
+  binding::bindElement(context.get());
+  binding::bindImageElement(context.get());
+  binding::bindInputElement(context.get());
+  binding::bindWindow(context.get());
+  binding::bindPerformance(context.get());
+  binding::bindPerformanceObserver(context.get());
+  binding::bindCSSStyleDeclaration(context.get());
+  binding::bindScreen(context.get());
+  binding::bindBlob(context.get());
+  binding::bindXMLHttpRequest(context.get());
+  binding::bindURLSearchParams(context.get());
+  binding::bindURL(context.get());
+  binding::bindTextEncoder(context.get());
+  binding::bindTextDecoder(context.get());
 
 #if ENABLE_PROFILE
   nativePerformance->mark(PERF_JS_NATIVE_METHOD_INIT_END);
@@ -145,70 +192,131 @@ void JSBridge::detachDevtools() {
 }
 #endif // ENABLE_DEBUGGER
 
+void JSBridge::activate() {
+  if (!context->isValid()) return;
+  context->activate();
+}
+
 void JSBridge::invokeModuleEvent(NativeString *moduleName, const char* eventType, void *event, NativeString *extra) {
   if (!context->isValid()) return;
+  TRACE_EVENT("module", "invokeModuleEvent");
 
-  if (std::getenv("ENABLE_KRAKEN_JS_LOG") != nullptr && strcmp(std::getenv("ENABLE_KRAKEN_JS_LOG"), "true") == 0) {
+  if (JSC_UNLIKELY(enableJSLog)) {
     KRAKEN_LOG(VERBOSE) << "[invokeModuleEvent VERBOSE]: moduleName " << moduleName << " event: " << event;
   }
 
-  JSValueRef exception = nullptr;
-  JSObjectRef eventObjectRef = nullptr;
+  std::u16string name(reinterpret_cast<const char16_t *>(moduleName->string), moduleName->length);
+  auto moduleListeners = krakenModuleListenerMap.find(name);
+  ModuleListeners listeners = moduleListeners == krakenModuleListenerMap.end() ? nullptr : moduleListeners->second;
+  ModuleListeners globalListeners = krakenModuleListenerList;
+
+  JSContextRef ctx = context->context();
+  binding::ScriptValue eventObject;
   if (event != nullptr) {
     std::string type = std::string(eventType);
-    EventInstance *eventInstance = JSEvent::buildEventInstance(type, context.get(), event, false);
-    eventObjectRef = eventInstance->object;
+    binding::EventInstance *eventInstance = binding::JSEvent::buildEventInstance(type, context.get(), event, false);
+    eventObject = eventInstance->value();
   }
 
-  for (const auto &callback : krakenModuleListenerList) {
-    if (exception != nullptr) {
+  // Arguments are built once and shared by all listeners.
+  JSStringRef moduleNameStringRef = JSStringCreateWithCharacters(moduleName->string, moduleName->length);
+  JSStringRef moduleExtraDataRef = JSStringCreateWithCharacters(extra->string, extra->length);
+  const JSValueRef args[] = {JSValueMakeString(ctx, moduleNameStringRef),
+                             eventObject.empty() ? JSValueMakeNull(ctx) : eventObject.raw(),
+                             JSValueMakeFromJSONString(ctx, moduleExtraDataRef)};
+  JSStringRelease(moduleNameStringRef);
+  JSStringRelease(moduleExtraDataRef);
+
+  // A listener which throws is reported, the remaining listeners still receive the event.
+  for (auto &snapshot : {listeners, globalListeners}) {
+    if (snapshot == nullptr) continue;
+    for (const auto &callback : *snapshot) {
+      JSValueRef exception = nullptr;
+      JSObjectCallAsFunction(ctx, callback, context->global(), 3, args, &exception);
       context->handleException(exception);
-      return;
     }
-
-    JSStringRef moduleNameStringRef = JSStringCreateWithCharacters(moduleName->string, moduleName->length);
-    JSStringRef moduleExtraDataRef = JSStringCreateWithCharacters(extra->string, extra->length);
-    const JSValueRef args[] = {
-      JSValueMakeString(context->context(), moduleNameStringRef),
-      eventObjectRef == nullptr ? JSValueMakeNull(context->context()) : eventObjectRef,
-      JSValueMakeFromJSONString(context->context(), moduleExtraDataRef)
-    };
-    JSObjectCallAsFunction(context->context(), callback, context->global(), 3, args, &exception);
   }
+}
+
+void JSBridge::addModuleListener(JSObjectRef callback) {
+  krakenModuleListenerList = appendModuleListener(krakenModuleListenerList, callback);
+}
 
-  context->handleException(exception);
+void JSBridge::addModuleListener(const std::u16string &moduleName, JSObjectRef callback) {
+  ModuleListeners &listeners = krakenModuleListenerMap[moduleName];
+  listeners = appendModuleListener(listeners, callback);
 }
 
 void JSBridge::evaluateScript(const NativeString *script, const char *url, int startLine) {
   if (!context->isValid()) return;
-  binding::jsc::updateLocation(url);
+  TRACE_EVENT("bridge", "evaluateScripts");
+  binding::updateLocation(url);
   context->evaluateJavaScript(script->string, script->length, url, startLine);
 }
 
 void JSBridge::evaluateScript(const std::u16string &script, const char *url, int startLine) {
   if (!context->isValid()) return;
-  binding::jsc::updateLocation(url);
+  TRACE_EVENT("bridge", "evaluateScripts");
+  binding::updateLocation(url);
   context->evaluateJavaScript(script.c_str(), script.size(), url, startLine);
 }
 
 JSBridge::~JSBridge() {
+  // Callbacks still pending are freed even when the context is released already.
+  delete bridgeCallback;
+
   if (!context->isValid()) return;
 
-  for (auto &callback : krakenModuleListenerList) {
-    JSValueUnprotect(context->context(), callback);
+  if (krakenModuleListenerList != nullptr) {
+    for (auto &callback : *krakenModuleListenerList) {
+      JSValueUnprotect(context->context(), callback);
+    }
   }
 
-  krakenModuleListenerList.clear();
+  krakenModuleListenerList = nullptr;
 
-  delete bridgeCallback;
+  for (auto &listeners : krakenModuleListenerMap) {
+    for (auto &callback : *listeners.second) {
+      JSValueUnprotect(context->context(), callback);
+    }
+  }
+
+  krakenModuleListenerMap.clear();
 
-  binding::jsc::NativePerformance::disposeInstance(context->uniqueId);
+  binding::NativePerformance::disposeInstance(context->uniqueId);
+  binding::NativeConsole::disposeInstance(context->uniqueId);
+}
+
+void JSBridge::getMemoryStats(ContextMemoryStats *stats) {
+#if defined(IS_ANDROID)
+  // Every context is created in a group of its own, so the heap of its VM is the heap of this page.
+  JSC::ExecState *exec = toJS(context->context());
+  JSC::JSLockHolder locker(exec);
+  JSC::Heap &heap = exec->vm().heap;
+  stats->jsHeapSize = static_cast<int64_t>(heap.size());
+  stats->jsHeapCapacity = static_cast<int64_t>(heap.capacity());
+#else
+  stats->jsHeapSize = -1;
+  stats->jsHeapCapacity = -1;
+#endif
+  stats->eventTargetCount = context->memoryCounters.eventTargetCount;
+  stats->nodeCount = context->memoryCounters.nodeCount;
+  stats->pendingUICommandBytes = context->getUICommandQueue()->pendingBytes();
+  stats->blobBytes = context->memoryCounters.blobBytes;
+  stats->bridgeCallbackCount = static_cast<int64_t>(bridgeCallback->contextCount());
 }
 
 void JSBridge::reportError(const char *errmsg) {
   handler_(context->getContextId(), errmsg);
 }
 
+foundation::BridgeCallback::Context *getBridgeCallbackContext(int32_t contextId,
+                                                              foundation::BridgeCallback::Handle handle) {
+  if (!checkContext(contextId)) return nullptr;
+  auto bridge = static_cast<JSBridge *>(getJSContext(contextId));
+  return bridge->bridgeCallback->getContext(handle);
+}
+
 } // namespace kraken
 
 #endif
@@ -12,7 +12,9 @@
 #include "include/kraken_bridge.h"
 
 #include <atomic>
-#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 #ifdef ENABLE_DEBUGGER
 #include <devtools/frontdoor.h>
@@ -24,6 +26,8 @@ class JSBridge final {
 public:
   JSBridge() = delete;
   JSBridge(int32_t jsContext, const JSExceptionHandler &handler);
+  // Create a pre-warmed bridge which stays in standby until activate() is called.
+  JSBridge(int32_t jsContext, const JSExceptionHandler &handler, bool standby);
   ~JSBridge();
 #ifdef ENABLE_DEBUGGER
   void attachDevtools();
@@ -32,7 +36,16 @@ public:
 
   static std::unordered_map<std::string, NativeString> pluginSourceCode;
 
-  std::deque<JSObjectRef> krakenModuleListenerList;
+  // Listeners are kept as immutable snapshots which are rebuilt on subscription, an event holds the snapshot it
+  // started with, so listeners subscribed while dispatching receive the next event.
+  using ModuleListeners = std::shared_ptr<const std::vector<JSObjectRef>>;
+  // Listeners receive events of all modules.
+  ModuleListeners krakenModuleListenerList;
+  // Listeners subscribed to a single module, keyed by module name.
+  std::unordered_map<std::u16string, ModuleListeners> krakenModuleListenerMap;
+  // Take over a reference of callback, which is released with the bridge.
+  void addModuleListener(JSObjectRef callback);
+  void addModuleListener(const std::u16string &moduleName, JSObjectRef callback);
 
   int32_t contextId;
   foundation::BridgeCallback *bridgeCallback;
@@ -46,8 +59,13 @@ public:
     return context;
   }
 
+  /// hand out a standby bridge to dart.
+  void activate();
+
   void invokeModuleEvent(NativeString *moduleName, const char* eventType, void *event, NativeString *extra);
   void reportError(const char *errmsg);
+  // Counters are kept up to date by the objects they count, this only reads them.
+  void getMemoryStats(ContextMemoryStats *stats);
 
   std::atomic<bool> event_registered = false;
 
@@ -58,6 +76,12 @@ private:
   std::unique_ptr<binding::jsc::JSContext> context;
   JSExceptionHandler handler_;
 };
+
+// The callback context dart passed the handle of back, nullptr when the bridge of contextId is disposed or the
+// callback was freed already.
+foundation::BridgeCallback::Context *getBridgeCallbackContext(int32_t contextId,
+                                                              foundation::BridgeCallback::Handle handle);
+
 } // namespace kraken
 
 #endif
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bridge_qjs.h"
+#include "foundation/logging.h"
+#include "foundation/trace_event.h"
+#include "foundation/ui_command_queue.h"
+#include "polyfill.h"
+
+#include "dart_methods.h"
+#include <cstdlib>
+#include <cstring>
+
+#include "bindings/qjs/kraken.h"
+#include "bindings/qjs/ui_manager.h"
+#include "bindings/script/DOM/comment_node.h"
+#include "bindings/script/DOM/custom_event.h"
+#include "bindings/script/DOM/document.h"
+#include "bindings/script/DOM/element.h"
+#include "bindings/script/DOM/elements/image_element.h"
+#include "bindings/script/DOM/elements/input_element.h"
+#include "bindings/script/DOM/event.h"
+#include "bindings/script/DOM/event_target.h"
+#include "bindings/script/DOM/events/close_event.h"
+#include "bindings/script/DOM/events/input_event.h"
+#include "bindings/script/DOM/events/intersection_change_event.h"
+#include "bindings/script/DOM/events/media_error_event.h"
+#include "bindings/script/DOM/events/message_event.h"
+#include "bindings/script/DOM/events/progress_event.h"
+#include "bindings/script/DOM/events/touch_event.h"
+#include "bindings/script/DOM/gesture_event.h"
+#include "bindings/script/DOM/node.h"
+#include "bindings/script/DOM/style_declaration.h"
+#include "bindings/script/DOM/text_node.h"
+#include "bindings/script/KOM/blob.h"
+#include "bindings/script/KOM/console.h"
+#include "bindings/script/KOM/location.h"
+#include "bindings/script/KOM/performance.h"
+#include "bindings/script/KOM/performance_observer.h"
+#include "bindings/script/KOM/screen.h"
+#include "bindings/script/KOM/text_decoder.h"
+#include "bindings/script/KOM/text_encoder.h"
+#include "bindings/script/KOM/url.h"
+#include "bindings/script/KOM/url_search_params.h"
+#include "bindings/script/KOM/window.h"
+#include "bindings/script/KOM/xml_http_request.h"
+
+namespace kraken {
+
+using namespace binding::qjs;
+
+std::unordered_map<std::string, NativeString> JSBridge::pluginSourceCode{};
+std::unordered_map<std::string, std::vector<uint8_t>> JSBridge::pluginByteCode{};
+
+// Read once at startup, invokeModuleEvent is too hot to query the environment for each event.
+static const bool enableJSLog = [] {
+  const char *env = std::getenv("ENABLE_KRAKEN_JS_LOG");
+  return env != nullptr && strcmp(env, "true") == 0;
+}();
+
+static JSBridge::ModuleListeners appendModuleListener(const JSBridge::ModuleListeners &listeners, JSValue callback) {
+  auto next = listeners == nullptr ? std::make_shared<std::vector<JSValue>>()
+                                   : std::make_shared<std::vector<JSValue>>(*listeners);
+  next->emplace_back(callback);
+  return next;
+}
+
+JSBridge::JSBridge(int32_t contextId, const JSExceptionHandler &handler) : JSBridge(contextId, handler, false) {}
+
+JSBridge::JSBridge(int32_t contextId, const JSExceptionHandler &handler, bool standby)
+  : contextId(contextId), handler_(handler) {
+  TRACE_EVENT("bridge", "createBridge");
+  bridgeCallback = new foundation::BridgeCallback();
+
+  context = binding::qjs::createJSContext(contextId, handler, this);
+  if (standby) {
+    context->enterStandby();
+  }
+
+  bindKraken(context);
+  bindUIManager(context);
+  binding::bindConsole(context.get());
+  binding::bindEvent(context.get());
+  binding::bindCustomEvent(context.get());
+  binding::bindCloseEvent(context.get());
+  binding::bindGestureEvent(context.get());
+  binding::bindMediaErrorEvent(context.get());
+  binding::bindTouchEvent(context.get());
+  binding::bindInputEvent(context.get());
+  binding::bindIntersectionChangeEvent(context.get());
+  binding::bindMessageEvent(context.get());
+  binding::bindProgressEvent(context.get());
+  binding::bindEventTarget(context.get());
+  binding::bindDocument(context.get());
+  binding::bindNode(context.get());
+  binding::bindTextNode(context.get());
+  binding::bindCommentNode(context.get());
+  binding::bindElement(context.get());
+  binding::bindImageElement(context.get());
+  binding::bindInputElement(context.get());
+  binding::bindWindow(context.get());
+  binding::bindPerformance(context.get());
+  binding::bindPerformanceObserver(context.get());
+  binding::bindCSSStyleDeclaration(context.get());
+  binding::bindScreen(context.get());
+  binding::bindBlob(context.get());
+  binding::bindXMLHttpRequest(context.get());
+  binding::bindURLSearchParams(context.get());
+  binding::bindURL(context.get());
+  binding::bindTextEncoder(context.get());
+  binding::bindTextDecoder(context.get());
+
+  initKrakenPolyFill(this);
+
+  for (auto &p : pluginSourceCode) {
+    evaluateScript(&p.second, p.first.c_str(), 0);
+  }
+
+  for (auto &p : pluginByteCode) {
+    evaluateByteCode(p.second.data(), p.second.size());
+  }
+}
+
+void JSBridge::activate() {
+  if (!context->isValid()) return;
+  context->activate();
+}
+
+void JSBridge::invokeModuleEvent(NativeString *moduleName, const char *eventType, void *event, NativeString *extra) {
+  if (!context->isValid()) return;
+  TRACE_EVENT("module", "invokeModuleEvent");
+
+  if (QJS_UNLIKELY(enableJSLog)) {
+    KRAKEN_LOG(VERBOSE) << "[invokeModuleEvent VERBOSE]: moduleName " << moduleName << " event: " << event;
+  }
+
+  std::u16string name(reinterpret_cast<const char16_t *>(moduleName->string), moduleName->length);
+  auto moduleListeners = krakenModuleListenerMap.find(name);
+  ModuleListeners listeners = moduleListeners == krakenModuleListenerMap.end() ? nullptr : moduleListeners->second;
+  ModuleListeners globalListeners = krakenModuleListenerList;
+
+  ::JSContext *ctx = context->context();
+  binding::ScriptScope scope(context.get());
+
+  JSValue eventValue = JS_NULL;
+  if (event != nullptr) {
+    std::string type = std::string(eventType);
+    binding::EventInstance *eventInstance = binding::JSEvent::buildEventInstance(type, context.get(), event, false);
+    eventValue = JS_DupValue(ctx, eventInstance->value().raw());
+  }
+
+  // Arguments are built once and shared by all listeners.
+  std::string extraJSON = toUTF8(std::u16string(reinterpret_cast<const char16_t *>(extra->string), extra->length));
+  JSValue extraValue = JS_ParseJSON(ctx, extraJSON.c_str(), extraJSON.size(), "");
+  if (JS_IsException(extraValue)) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    extraValue = JS_NULL;
+  }
+  JSValue args[] = {newU16String(ctx, moduleName->string, moduleName->length), eventValue, extraValue};
+
+  // A listener which throws is reported, the remaining listeners still receive the event.
+  for (auto &snapshot : {listeners, globalListeners}) {
+    if (snapshot == nullptr) continue;
+    for (const auto &callback : *snapshot) {
+      JSValue result = context->callFunction(callback, JS_UNDEFINED, 3, args);
+      context->handleException(result);
+      JS_FreeValue(ctx, result);
+    }
+  }
+
+  for (auto &arg : args) JS_FreeValue(ctx, arg);
+  context->drainPendingPromiseJobs();
+}
+
+void JSBridge::addModuleListener(JSValue callback) {
+  krakenModuleListenerList = appendModuleListener(krakenModuleListenerList, callback);
+}
+
+void JSBridge::addModuleListener(const std::u16string &moduleName, JSValue callback) {
+  ModuleListeners &listeners = krakenModuleListenerMap[moduleName];
+  listeners = appendModuleListener(listeners, callback);
+}
+
+void JSBridge::evaluateScript(const NativeString *script, const char *url, int startLine) {
+  if (!context->isValid()) return;
+  TRACE_EVENT("bridge", "evaluateScripts");
+  binding::updateLocation(url);
+  context->evaluateJavaScript(script->string, script->length, url, startLine);
+}
+
+void JSBridge::evaluateScript(const std::u16string &script, const char *url, int startLine) {
+  if (!context->isValid()) return;
+  TRACE_EVENT("bridge", "evaluateScripts");
+  binding::updateLocation(url);
+  context->evaluateJavaScript(script.c_str(), script.size(), url, startLine);
+}
+
+void JSBridge::evaluateByteCode(const uint8_t *bytes, size_t byteLength) {
+  if (!context->isValid()) return;
+  TRACE_EVENT("bridge", "evaluateByteCode");
+  context->evaluateByteCode(bytes, byteLength);
+}
+
+JSBridge::~JSBridge() {
+  // Every value referenced natively must be freed before the runtime, QuickJS asserts its heap is empty when the
+  // runtime is freed.
+  delete bridgeCallback;
+
+  ::JSContext *ctx = context->context();
+  if (krakenModuleListenerList != nullptr) {
+    for (auto &callback : *krakenModuleListenerList) {
+      JS_FreeValue(ctx, callback);
+    }
+  }
+  krakenModuleListenerList = nullptr;
+
+  for (auto &listeners : krakenModuleListenerMap) {
+    for (auto &callback : *listeners.second) {
+      JS_FreeValue(ctx, callback);
+    }
+  }
+  krakenModuleListenerMap.clear();
+
+  binding::NativePerformance::disposeInstance(context->uniqueId);
+  binding::NativeConsole::disposeInstance(context->uniqueId);
+}
+
+void JSBridge::getMemoryStats(ContextMemoryStats *stats) {
+  JSMemoryUsage usage;
+  JS_ComputeMemoryUsage(context->runtime(), &usage);
+  stats->jsHeapSize = usage.memory_used_size;
+  stats->jsHeapCapacity = usage.malloc_size;
+  stats->eventTargetCount = context->memoryCounters.eventTargetCount;
+  stats->nodeCount = context->memoryCounters.nodeCount;
+  stats->pendingUICommandBytes = context->getUICommandQueue()->pendingBytes();
+  stats->blobBytes = context->memoryCounters.blobBytes;
+  stats->bridgeCallbackCount = static_cast<int64_t>(bridgeCallback->contextCount());
+}
+
+void JSBridge::reportError(const char *errmsg) {
+  handler_(context->getContextId(), errmsg);
+}
+
+foundation::BridgeCallback::Context *getBridgeCallbackContext(int32_t contextId,
+                                                              foundation::BridgeCallback::Handle handle) {
+  if (!checkContext(contextId)) return nullptr;
+  auto bridge = static_cast<JSBridge *>(getJSContext(contextId));
+  return bridge->bridgeCallback->getContext(handle);
+}
+
+} // namespace kraken
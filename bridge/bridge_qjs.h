@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKEN_QJS_BRIDGE_H_
+#define KRAKEN_QJS_BRIDGE_H_
+
+#include "bindings/qjs/js_context_internal.h"
+#include "foundation/bridge_callback.h"
+#include "include/kraken_bridge.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kraken {
+
+// The JSBridge of the QuickJS engine, it has the same interface as the JSBridge of JavaScriptCore so kraken_bridge.cc
+// works with either of them.
+class JSBridge final {
+public:
+  JSBridge() = delete;
+  JSBridge(int32_t jsContext, const JSExceptionHandler &handler);
+  // Create a pre-warmed bridge which stays in standby until activate() is called.
+  JSBridge(int32_t jsContext, const JSExceptionHandler &handler, bool standby);
+  ~JSBridge();
+
+  static std::unordered_map<std::string, NativeString> pluginSourceCode;
+  // Plugins precompiled into QuickJS bytecode, they are evaluated after the plugins of source code.
+  static std::unordered_map<std::string, std::vector<uint8_t>> pluginByteCode;
+
+  // Listeners are kept as immutable snapshots which are rebuilt on subscription, an event holds the snapshot it
+  // started with, so listeners subscribed while dispatching receive the next event.
+  using ModuleListeners = std::shared_ptr<const std::vector<JSValue>>;
+  // Listeners receive events of all modules.
+  ModuleListeners krakenModuleListenerList;
+  // Listeners subscribed to a single module, keyed by module name.
+  std::unordered_map<std::u16string, ModuleListeners> krakenModuleListenerMap;
+  // Take over a reference of callback, which is released with the bridge.
+  void addModuleListener(JSValue callback);
+  void addModuleListener(const std::u16string &moduleName, JSValue callback);
+
+  int32_t contextId;
+  foundation::BridgeCallback *bridgeCallback;
+  // the owner pointer which take JSBridge as property.
+  void *owner;
+  /// evaluate JavaScript source codes in standard mode.
+  KRAKEN_EXPORT void evaluateScript(const NativeString *script, const char *url, int startLine);
+  KRAKEN_EXPORT void evaluateScript(const std::u16string &script, const char *url, int startLine);
+  /// evaluate QuickJS bytecode compiled by polyfill/scripts/js_to_c.js.
+  KRAKEN_EXPORT void evaluateByteCode(const uint8_t *bytes, size_t byteLength);
+
+  const std::unique_ptr<kraken::binding::qjs::JSContext> &getContext() const {
+    return context;
+  }
+
+  /// hand out a standby bridge to dart.
+  void activate();
+
+  void invokeModuleEvent(NativeString *moduleName, const char *eventType, void *event, NativeString *extra);
+  void reportError(const char *errmsg);
+  // Counters are kept up to date by the objects they count, the heap is measured by QuickJS when this is called.
+  void getMemoryStats(ContextMemoryStats *stats);
+
+  std::atomic<bool> event_registered = false;
+
+private:
+  std::unique_ptr<binding::qjs::JSContext> context;
+  JSExceptionHandler handler_;
+};
+
+// The callback context dart passed the handle of back, nullptr when the bridge of contextId is disposed or the
+// callback was freed already.
+foundation::BridgeCallback::Context *getBridgeCallbackContext(int32_t contextId,
+                                                              foundation::BridgeCallback::Handle handle);
+
+} // namespace kraken
+
+#endif // KRAKEN_QJS_BRIDGE_H_
@@ -4,8 +4,8 @@
  */
 
 #include "bridge_test_jsc.h"
-#include "bindings/jsc/KOM/blob.h"
-#include "bindings/jsc/KOM/location.h"
+#include "bindings/script/KOM/blob.h"
+#include "bindings/script/KOM/location.h"
 #include "dart_methods.h"
 #include "foundation/bridge_callback.h"
 #include "testframework.h"
@@ -16,7 +16,7 @@ using namespace kraken::foundation;
 
 bool JSBridgeTest::evaluateTestScripts(const uint16_t *code, size_t codeLength, const char *sourceURL, int startLine) {
   if (!context->isValid()) return false;
-  binding::jsc::updateLocation(sourceURL);
+  binding::updateLocation(sourceURL);
   return context->evaluateJavaScript(code, codeLength, sourceURL, startLine);
 }
 
@@ -65,8 +65,9 @@ JSValueRef refreshPaint(JSContextRef ctx, JSObjectRef function, JSObjectRef this
 
   auto callbackContext = std::make_unique<BridgeCallback::Context>(*context, callbackObjectRef, exception);
 
-  auto fn = [](void *ptr, int32_t contextId, const char *errmsg) {
-    auto callbackContext = static_cast<BridgeCallback::Context *>(ptr);
+  auto fn = [](void *handle, int32_t contextId, const char *errmsg) {
+    auto callbackContext = getBridgeCallbackContext(contextId, handle);
+    if (callbackContext == nullptr) return;
     binding::jsc::JSContext &_context = callbackContext->_context;
     JSContextRef ctx = _context.context();
 
@@ -86,13 +87,13 @@ JSValueRef refreshPaint(JSContextRef ctx, JSObjectRef function, JSObjectRef this
 
     _context.handleException(exception);
     auto bridge = static_cast<JSBridge *>(callbackContext->_context.getOwner());
-    bridge->bridgeCallback->freeBridgeCallbackContext(callbackContext);
+    bridge->bridgeCallback->freeBridgeCallbackContext(handle);
   };
 
   auto bridge = static_cast<JSBridge *>(context->getOwner());
   bridge->bridgeCallback->registerCallback<void>(std::move(callbackContext),
-                                                 [&fn](BridgeCallback::Context *callbackContext, int32_t contextId) {
-                                                   getDartMethod()->refreshPaint(callbackContext, contextId, fn);
+                                                 [&fn](BridgeCallback::Handle handle, int32_t contextId) {
+                                                   getDartMethod()->refreshPaint(handle, contextId, fn);
                                                  });
 
   return nullptr;
@@ -111,8 +112,7 @@ JSValueRef matchImageSnapshot(JSContextRef ctx, JSObjectRef function, JSObjectRe
     return nullptr;
   }
 
-  JSObjectRef blobObjectRef = JSValueToObject(ctx, blobValueRef, exception);
-  auto blob = static_cast<binding::jsc::JSBlob::BlobInstance *>(JSObjectGetPrivate(blobObjectRef));
+  auto blob = binding::JSBlob::blobOf(binding::ScriptValue(context, blobValueRef));
 
   if (blob == nullptr) {
     binding::jsc::throwJSError(ctx, "Failed to execute '__kraken_match_image_snapshot__': parameter 1 (blob) must be an Blob object.",
@@ -159,24 +159,25 @@ JSValueRef matchImageSnapshot(JSContextRef ctx, JSObjectRef function, JSObjectRe
 
   auto callbackContext = std::make_unique<BridgeCallback::Context>(*context, callbackObjectRef, exception);
 
-  auto fn = [](void *ptr, int32_t contextId, int8_t result) {
+  auto fn = [](void *handle, int32_t contextId, int8_t result) {
     JSValueRef exception = nullptr;
-    auto callbackContext = static_cast<BridgeCallback::Context *>(ptr);
+    auto callbackContext = getBridgeCallbackContext(contextId, handle);
+    if (callbackContext == nullptr) return;
     binding::jsc::JSContext &_context = callbackContext->_context;
     JSContextRef ctx = _context.context();
     JSObjectRef callbackObjectRef = JSValueToObject(ctx, callbackContext->_callback, &exception);
     const JSValueRef arguments[] = {JSValueMakeBoolean(ctx, result != 0)};
     JSObjectCallAsFunction(ctx, callbackObjectRef, _context.global(), 1, arguments, &exception);
     auto bridge = static_cast<JSBridge *>(callbackContext->_context.getOwner());
-    bridge->bridgeCallback->freeBridgeCallbackContext(callbackContext);
+    bridge->bridgeCallback->freeBridgeCallbackContext(handle);
     _context.handleException(exception);
   };
 
   auto bridge = static_cast<JSBridge *>(context->getOwner());
   bridge->bridgeCallback->registerCallback<void>(
     std::move(callbackContext),
-    [&blob, &nativeString, &fn](BridgeCallback::Context *callbackContext, int32_t contextId) {
-      getDartMethod()->matchImageSnapshot(callbackContext, contextId, blob->bytes(), blob->size(), &nativeString, fn);
+    [&blob, &nativeString, &fn](BridgeCallback::Handle handle, int32_t contextId) {
+      getDartMethod()->matchImageSnapshot(handle, contextId, blob->bytes(), blob->size(), &nativeString, fn);
     });
 
   return nullptr;
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2020-present Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bridge_test_qjs.h"
+#include "dart_methods.h"
+#include "testframework.h"
+#include <cstring>
+
+namespace kraken {
+
+using namespace binding::qjs;
+
+namespace {
+
+JSBridgeTest *getBridgeTest(::JSContext *ctx) {
+  auto bridge = static_cast<JSBridge *>(getContext(ctx)->getOwner());
+  return static_cast<JSBridgeTest *>(bridge->owner);
+}
+
+JSValue executeTest(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (argc < 1 || !JS_IsFunction(ctx, argv[0])) {
+    return throwJSError(ctx, "Failed to execute 'executeTest': parameter 1 (callback) is not an function.");
+  }
+
+  auto bridgeTest = getBridgeTest(ctx);
+  JS_FreeValue(ctx, bridgeTest->executeTestCallback);
+  bridgeTest->executeTestCallback = JS_DupValue(ctx, argv[0]);
+  return JS_UNDEFINED;
+}
+
+JSValue environment(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (getDartMethod()->environment == nullptr) {
+    return throwJSError(ctx,
+                        "Failed to execute '__kraken_environment__': dart method (environment) is not registered.");
+  }
+  const char *env = getDartMethod()->environment();
+  return JS_ParseJSON(ctx, env, strlen(env), "");
+}
+
+JSValue done(::JSContext *ctx, JSValueConst thisVal, int argc, JSValueConst *argv) {
+  if (argc < 1 || !JS_IsString(argv[0])) {
+    return throwJSError(ctx, "failed to execute 'done': parameter 1 (status) is not a string");
+  }
+
+  auto bridgeTest = getBridgeTest(ctx);
+  if (bridgeTest->executeCallback == nullptr) return JS_UNDEFINED;
+
+  std::u16string status = jsValueToU16String(ctx, argv[0]);
+  NativeString nativeString{};
+  nativeString.string = reinterpret_cast<const uint16_t *>(status.c_str());
+  nativeString.length = status.size();
+  bridgeTest->executeCallback(getContext(ctx)->getContextId(), &nativeString);
+  return JS_UNDEFINED;
+}
+
+} // namespace
+
+bool JSBridgeTest::evaluateTestScripts(const uint16_t *code, size_t codeLength, const char *sourceURL, int startLine) {
+  if (!context->isValid()) return false;
+  return context->evaluateJavaScript(code, codeLength, sourceURL, startLine);
+}
+
+JSBridgeTest::JSBridgeTest(JSBridge *bridge) : bridge_(bridge), context(bridge->getContext()) {
+  bridge->owner = this;
+  bindGlobalFunction(context.get(), "__kraken_executeTest__", executeTest, 1);
+  bindGlobalFunction(context.get(), "__kraken_environment__", environment, 0);
+
+  initKrakenTestFramework(bridge);
+}
+
+void JSBridgeTest::invokeExecuteTest(ExecuteCallback callback) {
+  if (JS_IsUndefined(executeTestCallback)) {
+    return;
+  }
+
+  executeCallback = callback;
+  ::JSContext *ctx = context->context();
+  JSValue doneFunction = JS_NewCFunction(ctx, done, "done", 1);
+  JSValue result = context->callFunction(executeTestCallback, JS_UNDEFINED, 1, &doneFunction);
+  context->handleException(result);
+  JS_FreeValue(ctx, result);
+  JS_FreeValue(ctx, doneFunction);
+  JS_FreeValue(ctx, executeTestCallback);
+  executeTestCallback = JS_UNDEFINED;
+  context->drainPendingPromiseJobs();
+}
+
+} // namespace kraken
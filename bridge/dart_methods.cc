@@ -6,11 +6,26 @@
 #include "dart_methods.h"
 #include "kraken_bridge.h"
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 
 namespace kraken {
 
 std::shared_ptr<DartMethodPointer> methodPointer = std::make_shared<DartMethodPointer>();
 
+#ifndef NDEBUG
+// Every embedded kraken view registers the dart methods from the thread of its isolate before it allocates a
+// context.
+std::mutex dartThreadsMutex;
+std::unordered_set<std::__thread_id> dartThreads;
+
+bool isDartThread(std::__thread_id thread) {
+  if (thread == getUIThreadId()) return true;
+  std::lock_guard<std::mutex> guard(dartThreadsMutex);
+  return dartThreads.count(thread) > 0;
+}
+#endif
+
 std::shared_ptr<DartMethodPointer> getDartMethod() {
   std::__thread_id currentThread = std::this_thread::get_id();
 
@@ -18,7 +33,7 @@ std::shared_ptr<DartMethodPointer> getDartMethod() {
   // Dart methods can only invoked from Flutter UI threads. Javascript Debugger like Safari Debugger can invoke
   // Javascript methods from debugger thread and will crash the app.
   // @TODO: implement task loops for async method call.
-  if (currentThread != getUIThreadId()) {
+  if (!isDartThread(currentThread)) {
     // return empty struct to stop further behavior.
     return std::make_shared<DartMethodPointer>();
   }
@@ -28,6 +43,12 @@ std::shared_ptr<DartMethodPointer> getDartMethod() {
 }
 
 void registerDartMethods(uint64_t *methodBytes, int32_t length) {
+#ifndef NDEBUG
+  {
+    std::lock_guard<std::mutex> guard(dartThreadsMutex);
+    dartThreads.emplace(std::this_thread::get_id());
+  }
+#endif
   size_t i = 0;
 
   methodPointer->invokeModule = reinterpret_cast<InvokeModule>(methodBytes[i++]);
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "async_logger.h"
+#include "logging.h"
+
+namespace foundation {
+
+namespace {
+
+size_t roundUpToPowerOfTwo(size_t value) {
+  size_t result = 2;
+  while (result < value) result <<= 1;
+  return result;
+}
+
+} // namespace
+
+AsyncLogger::AsyncLogger(Sink sink, size_t capacity)
+  : m_sink(std::move(sink)), m_cells(new Cell[roundUpToPowerOfTwo(capacity)]),
+    m_mask(roundUpToPowerOfTwo(capacity) - 1) {
+  for (size_t i = 0; i <= m_mask; i++) {
+    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  m_thread = std::thread(&AsyncLogger::drain, this);
+}
+
+AsyncLogger::~AsyncLogger() {
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_stopped = true;
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
+}
+
+bool AsyncLogger::post(int severity, std::string &&message) {
+  size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+  Cell *cell;
+  while (true) {
+    cell = &m_cells[position & m_mask];
+    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+    if (diff == 0) {
+      if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+    } else if (diff < 0) {
+      // The drain thread hasn't written the message queued a full ring ago.
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      position = m_enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+
+  cell->severity = severity;
+  cell->message = std::move(message);
+  cell->sequence.store(position + 1, std::memory_order_release);
+
+  // Pairs with the fence in drain(), either the drain thread sees this message before it sleeps or the flag is
+  // seen here. The lock is only taken to wake an idle drain thread.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_waiting.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_wakeup.notify_one();
+  }
+  return true;
+}
+
+void AsyncLogger::flush() {
+  size_t target = m_enqueuePosition.load(std::memory_order_acquire);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_drained.wait(lock, [this, target]() { return m_written.load(std::memory_order_acquire) >= target; });
+}
+
+bool AsyncLogger::pop(int &severity, std::string &message) {
+  Cell &cell = m_cells[m_dequeuePosition & m_mask];
+  if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) return false;
+
+  severity = cell.severity;
+  message = std::move(cell.message);
+  cell.message.clear();
+  cell.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+  m_dequeuePosition++;
+  return true;
+}
+
+bool AsyncLogger::hasPending() const {
+  const Cell &cell = m_cells[m_dequeuePosition & m_mask];
+  return cell.sequence.load(std::memory_order_acquire) == m_dequeuePosition + 1;
+}
+
+void AsyncLogger::drain() {
+  int severity;
+  std::string message;
+  while (true) {
+    while (pop(severity, message)) {
+      m_sink(severity, message);
+      m_written.fetch_add(1, std::memory_order_release);
+    }
+
+    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped > m_reportedDropped) {
+      m_sink(LOG_WARN, "[Kraken] " + std::to_string(dropped - m_reportedDropped) +
+                         " log messages were dropped, the log buffer is full.");
+      m_reportedDropped = dropped;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_drained.notify_all();
+    m_waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!hasPending()) {
+      if (m_stopped) return;
+      m_wakeup.wait(lock);
+    }
+    m_waiting.store(false, std::memory_order_relaxed);
+  }
+}
+
+} // namespace foundation
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_ASYNC_LOGGER_H
+#define KRAKENBRIDGE_ASYNC_LOGGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace foundation {
+
+// Hands formatted log messages to a background thread, so writing to the console never blocks the thread which
+// logs. Messages are queued into a bounded lock free ring, https://www.1024cores.net/home/lock-free-algorithms/queues/
+// bounded-mpmc-queue, and written by the drain thread in the order they were queued. A message is dropped and
+// counted when the ring is full.
+class AsyncLogger {
+public:
+  using Sink = std::function<void(int severity, const std::string &message)>;
+
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  // The capacity is rounded up to a power of two.
+  explicit AsyncLogger(Sink sink, size_t capacity = kDefaultCapacity);
+  // Write the queued messages and stop the drain thread.
+  ~AsyncLogger();
+
+  AsyncLogger(const AsyncLogger &) = delete;
+  AsyncLogger &operator=(const AsyncLogger &) = delete;
+
+  // Returns false when the message is dropped.
+  bool post(int severity, std::string &&message);
+  // Block until the messages posted before are written.
+  void flush();
+
+  uint64_t droppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    int severity{0};
+    std::string message;
+  };
+
+  bool pop(int &severity, std::string &message);
+  bool hasPending() const;
+  void drain();
+
+  Sink m_sink;
+  std::unique_ptr<Cell[]> m_cells;
+  size_t m_mask;
+  // Producers and the drain thread touch different positions, keep them on their own cache lines.
+  alignas(64) std::atomic<size_t> m_enqueuePosition{0};
+  alignas(64) size_t m_dequeuePosition{0};
+  std::atomic<size_t> m_written{0};
+  std::atomic<uint64_t> m_dropped{0};
+  uint64_t m_reportedDropped{0};
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::condition_variable m_drained;
+  std::atomic<bool> m_waiting{false};
+  bool m_stopped{false};
+  std::thread m_thread;
+};
+
+} // namespace foundation
+
+#endif // KRAKENBRIDGE_ASYNC_LOGGER_H
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "async_logger.h"
+#include "logging.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace foundation;
+
+namespace {
+
+// Log "<producer>:<index>" from several threads at once, the messages are returned in the order they were written.
+std::vector<std::string> logConcurrently(int producers, int count, size_t capacity, uint64_t &dropped) {
+  // The sink only runs on the drain thread, flush() publishes the messages to this thread.
+  std::vector<std::string> messages;
+  AsyncLogger logger(
+    [&messages](int severity, const std::string &message) {
+      if (severity == LOG_VERBOSE) messages.emplace_back(message);
+    },
+    capacity);
+  std::vector<std::thread> threads;
+  for (int producer = 0; producer < producers; producer++) {
+    threads.emplace_back([&logger, producer, count]() {
+      for (int i = 0; i < count; i++) {
+        logger.post(LOG_VERBOSE, std::to_string(producer) + ":" + std::to_string(i));
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  logger.flush();
+  dropped = logger.droppedCount();
+  return messages;
+}
+
+// Last index written by each producer, every producer must write its messages in order.
+std::vector<int> checkOrder(const std::vector<std::string> &messages, int producers) {
+  std::vector<int> last(producers, -1);
+  for (auto &message : messages) {
+    size_t separator = message.find(':');
+    int producer = std::stoi(message.substr(0, separator));
+    int index = std::stoi(message.substr(separator + 1));
+    EXPECT_GT(index, last[producer]) << message;
+    last[producer] = index;
+  }
+  return last;
+}
+
+} // namespace
+
+TEST(AsyncLogger, keepsTheOrderOfEachProducer) {
+  uint64_t dropped;
+  auto messages = logConcurrently(4, 2000, 8192, dropped);
+  EXPECT_EQ(dropped, 0);
+  EXPECT_EQ(messages.size(), 8000);
+  EXPECT_EQ(checkOrder(messages, 4), std::vector<int>({1999, 1999, 1999, 1999}));
+}
+
+TEST(AsyncLogger, dropsAndCountsMessagesWhenTheBufferIsFull) {
+  uint64_t dropped;
+  auto messages = logConcurrently(4, 2000, 16, dropped);
+  // Messages dropped by a full buffer are reported with a warning, which the sink filters out.
+  EXPECT_EQ(messages.size() + dropped, 8000);
+  checkOrder(messages, 4);
+}
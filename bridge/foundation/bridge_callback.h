@@ -8,10 +8,15 @@
 
 #ifdef KRAKEN_JSC_ENGINE
 #include "bindings/jsc/js_context_internal.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bindings/qjs/js_context_internal.h"
 #endif
+#include "foundation/instance_tracker.h"
 
 #include <atomic>
+#include <cassert>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -19,12 +24,19 @@ namespace kraken::foundation {
 
 /// An global standalone BridgeCallback register and collector used to register an callback which will call back from
 /// outside of bridge.
+/// Contexts are kept in a slot map, so registering and freeing a context take constant time whatever the order
+/// callbacks complete in. Freed slots are reused by later contexts.
+/// Dart is given a handle of each context instead of its address, and passes it back with the result. The lower half
+/// of the bits of a handle is the slot of its context and the upper half the generation of the slot, which changes
+/// every time the slot is freed, so a result which arrives after its context was freed resolves to nothing.
 /// This class can auto recycle callback context's memory when bridge are willing to unmount.
-/// This class is thread safe.
+/// This class is not thread safe, use it on the JS thread only.
 class BridgeCallback {
 public:
+  using Handle = void *;
+
   ~BridgeCallback() {
-    contextList.clear();
+    disposeAll();
   }
 
 #ifdef KRAKEN_ENABLE_JSA
@@ -36,17 +48,23 @@ public:
   };
 #elif KRAKEN_JSC_ENGINE
   struct Context {
-    Context(kraken::binding::jsc::JSContext &context, JSValueRef callback, JSValueRef *exception)
+    Context(kraken::binding::jsc::JSContext &context, JSValueRef callback, JSValueRef *exception = nullptr)
       : _context(context), _callback(callback) {
       JSValueProtect(context.context(), callback);
+      KRAKEN_TRACK_INSTANCE(this, context.getContextId(), "BridgeCallback");
     };
     Context(kraken::binding::jsc::JSContext &context, JSValueRef callback, JSValueRef secondaryCallback,
-            JSValueRef *exception)
+            JSValueRef *exception = nullptr)
       : _context(context), _callback(callback), _secondaryCallback(secondaryCallback) {
       JSValueProtect(context.context(), callback);
       JSValueProtect(context.context(), secondaryCallback);
+      KRAKEN_TRACK_INSTANCE(this, context.getContextId(), "BridgeCallback");
     };
-    ~Context() {
+    // Bindings may extend a context with the state their callback needs.
+    virtual ~Context() {
+      KRAKEN_UNTRACK_INSTANCE(this);
+      // Values protected by a released JSContext are gone with its heap.
+      if (!_context.isValid()) return;
       JSValueUnprotect(_context.context(), _callback);
 
       if (_secondaryCallback != nullptr) {
@@ -57,35 +75,109 @@ public:
     JSValueRef _callback{nullptr};
     JSValueRef _secondaryCallback{nullptr};
   };
+#elif KRAKEN_QUICK_JS_ENGINE
+  struct Context {
+    Context(kraken::binding::qjs::JSContext &context, JSValueConst callback)
+      : _context(context), _callback(JS_DupValue(context.context(), callback)) {
+      KRAKEN_TRACK_INSTANCE(this, context.getContextId(), "BridgeCallback");
+    };
+    Context(kraken::binding::qjs::JSContext &context, JSValueConst callback, JSValueConst secondaryCallback)
+      : _context(context), _callback(JS_DupValue(context.context(), callback)),
+        _secondaryCallback(JS_DupValue(context.context(), secondaryCallback)) {
+      KRAKEN_TRACK_INSTANCE(this, context.getContextId(), "BridgeCallback");
+    };
+    // Bindings may extend a context with the state their callback needs.
+    virtual ~Context() {
+      KRAKEN_UNTRACK_INSTANCE(this);
+      // Values referenced by a released JSContext are gone with its runtime.
+      if (!_context.isValid()) return;
+      JS_FreeValue(_context.context(), _callback);
+      JS_FreeValue(_context.context(), _secondaryCallback);
+    }
+    kraken::binding::qjs::JSContext &_context;
+    JSValue _callback{JS_UNDEFINED};
+    JSValue _secondaryCallback{JS_UNDEFINED};
+  };
 #endif
-  // An wrapper to register an callback outside of bridge and wait for callback to bridge.
+  // An wrapper to register an callback outside of bridge and wait for callback to bridge, fn passes the handle of
+  // the context to dart.
   template <typename T>
-  T registerCallback(std::unique_ptr<Context> &&context, std::function<T(BridgeCallback::Context *, int32_t)> fn) {
-    Context *p = context.get();
-    assert(p != nullptr && "Callback context can not be nullptr");
-    auto &jsContext = context->_context;
+  T registerCallback(std::unique_ptr<Context> &&context, std::function<T(Handle, int32_t)> fn) {
+    assert(context != nullptr && "Callback context can not be nullptr");
     int32_t contextId = context->_context.getContextId();
-    contextList.emplace_back(std::move(context));
-    return fn(p, contextId);
+
+    size_t index;
+    if (freeSlots.empty()) {
+      assert(slots.size() <= HANDLE_SLOT_MASK && "Too many callbacks are pending");
+      index = slots.size();
+      slots.emplace_back(Slot{nullptr, nextGeneration()});
+    } else {
+      index = freeSlots.back();
+      freeSlots.pop_back();
+    }
+    slots[index].context = std::move(context);
+    count++;
+    return fn(makeHandle(index, slots[index].generation), contextId);
   }
 
-  void freeBridgeCallbackContext(Context *context) {
-    auto begin = std::begin(contextList);
-    auto end = std::end(contextList);
+  // The context of handle, nullptr when it's freed already or wasn't registered here. The handle is never
+  // dereferenced, any value dart passes back is safe to look up.
+  Context *getContext(Handle handle) const {
+    auto bits = reinterpret_cast<uintptr_t>(handle);
+    size_t index = bits & HANDLE_SLOT_MASK;
+    if (index >= slots.size() || slots[index].generation != bits >> HANDLE_SLOT_BITS) return nullptr;
+    return slots[index].context.get();
+  }
 
-    while (begin != end) {
-      auto &&ctx = *begin;
-      if (ctx.get() == context) {
-        ctx.reset();
-        contextList.erase(begin);
-      }
+  // Contexts which are freed already, or not registered here, are left alone.
+  void freeBridgeCallbackContext(Handle handle) {
+    if (getContext(handle) == nullptr) return;
+    size_t index = reinterpret_cast<uintptr_t>(handle) & HANDLE_SLOT_MASK;
+    slots[index].context.reset();
+    slots[index].generation = nextGeneration();
+    freeSlots.emplace_back(index);
+    count--;
+  }
 
-      begin++;
-    }
+  // Free every context still waiting for its callback, used when the bridge is disposed.
+  void disposeAll() {
+    slots.clear();
+    freeSlots.clear();
+    count = 0;
+  }
+
+  // Callbacks registered and not freed yet.
+  size_t contextCount() const {
+    return count;
   }
 
 private:
-  std::vector<std::unique_ptr<Context>> contextList;
+  static constexpr int HANDLE_SLOT_BITS = sizeof(uintptr_t) * 4;
+  static constexpr uintptr_t HANDLE_SLOT_MASK = (static_cast<uintptr_t>(1) << HANDLE_SLOT_BITS) - 1;
+
+  struct Slot {
+    std::unique_ptr<Context> context;
+    uintptr_t generation;
+  };
+
+  static Handle makeHandle(size_t index, uintptr_t generation) {
+    return reinterpret_cast<Handle>((generation << HANDLE_SLOT_BITS) | index);
+  }
+
+  // Generations are drawn from a sequence shared by every BridgeCallback, so handles of another bridge, like the one
+  // replaced by a reload, don't resolve here either. Zero is skipped, a handle is never null.
+  static uintptr_t nextGeneration() {
+    static std::atomic<uintptr_t> sequence{0};
+    uintptr_t generation;
+    do {
+      generation = ++sequence & HANDLE_SLOT_MASK;
+    } while (generation == 0);
+    return generation;
+  }
+
+  std::vector<Slot> slots;
+  std::vector<size_t> freeSlots;
+  size_t count{0};
 };
 
 } // namespace kraken::foundation
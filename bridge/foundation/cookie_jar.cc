@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "cookie_jar.h"
+#include <algorithm>
+#include <limits>
+
+namespace foundation {
+
+namespace {
+
+constexpr int64_t kEarliestTime = std::numeric_limits<int64_t>::min();
+constexpr int64_t kSessionExpiryTime = std::numeric_limits<int64_t>::max();
+
+inline bool isWhitespace(char c) {
+  return c == ' ' || c == '\t';
+}
+
+inline bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+inline char toLower(char c) {
+  return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string toLowerCase(std::string input) {
+  std::transform(input.begin(), input.end(), input.begin(), toLower);
+  return input;
+}
+
+std::string trim(const std::string &input, size_t begin, size_t end) {
+  while (begin < end && isWhitespace(input[begin])) begin++;
+  while (end > begin && isWhitespace(input[end - 1])) end--;
+  return input.substr(begin, end - begin);
+}
+
+// https://tools.ietf.org/html/rfc6265#section-5.1.1, delimiter = %x09 / %x20-2F / %x3B-40 / %x5B-60 / %x7B-7E
+inline bool isDateDelimiter(unsigned char c) {
+  return c == 0x09 || (c >= 0x20 && c <= 0x2F) || (c >= 0x3B && c <= 0x40) || (c >= 0x5B && c <= 0x60) ||
+         (c >= 0x7B && c <= 0x7E);
+}
+
+// Read minDigits to maxDigits digits at position, the digits must not be followed by another digit.
+bool readDigits(const std::string &token, size_t &position, size_t minDigits, size_t maxDigits, int &value) {
+  size_t start = position;
+  value = 0;
+  while (position < token.size() && isDigit(token[position])) {
+    value = value * 10 + (token[position] - '0');
+    if (++position - start > maxDigits) return false;
+  }
+  return position - start >= minDigits;
+}
+
+bool parseTime(const std::string &token, int &hour, int &minute, int &second) {
+  size_t position = 0;
+  if (!readDigits(token, position, 1, 2, hour) || position >= token.size() || token[position++] != ':') return false;
+  if (!readDigits(token, position, 1, 2, minute) || position >= token.size() || token[position++] != ':') return false;
+  return readDigits(token, position, 1, 2, second);
+}
+
+bool parseMonth(const std::string &token, int &month) {
+  static const char *months[] = {"jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+  if (token.size() < 3) return false;
+  std::string prefix = toLowerCase(token.substr(0, 3));
+  for (int i = 0; i < 12; i++) {
+    if (prefix == months[i]) {
+      month = i + 1;
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool isLeapYear(int year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+int daysInMonth(int year, int month) {
+  static const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return month == 2 && isLeapYear(year) ? 29 : days[month - 1];
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date.
+int64_t daysFromCivil(int64_t year, int month, int day) {
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yearOfEra = year - era * 400;
+  int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+inline bool isIPAddress(const std::string &host) {
+  if (!host.empty() && host[0] == '[') return true;
+  return !host.empty() && std::all_of(host.begin(), host.end(), [](char c) { return isDigit(c) || c == '.'; });
+}
+
+inline bool isSecureScheme(const std::string &scheme) {
+  return scheme == "https" || scheme == "wss";
+}
+
+} // namespace
+
+bool parseCookieDate(const std::string &input, int64_t &time) {
+  bool foundTime = false, foundDayOfMonth = false, foundMonth = false, foundYear = false;
+  int hour = 0, minute = 0, second = 0, dayOfMonth = 0, month = 0, year = 0;
+
+  size_t i = 0;
+  while (i < input.size()) {
+    while (i < input.size() && isDateDelimiter(input[i])) i++;
+    size_t start = i;
+    while (i < input.size() && !isDateDelimiter(input[i])) i++;
+    if (start == i) continue;
+
+    std::string token = input.substr(start, i - start);
+    size_t dayPosition = 0;
+    size_t yearPosition = 0;
+    if (!foundTime && parseTime(token, hour, minute, second)) {
+      foundTime = true;
+    } else if (!foundDayOfMonth && readDigits(token, dayPosition, 1, 2, dayOfMonth)) {
+      foundDayOfMonth = true;
+    } else if (!foundMonth && parseMonth(token, month)) {
+      foundMonth = true;
+    } else if (!foundYear && readDigits(token, yearPosition, 2, 4, year)) {
+      foundYear = true;
+    }
+  }
+
+  if (year >= 70 && year <= 99) year += 1900;
+  if (year >= 0 && year <= 69) year += 2000;
+
+  if (!foundTime || !foundDayOfMonth || !foundMonth || !foundYear) return false;
+  if (dayOfMonth < 1 || dayOfMonth > daysInMonth(year, month) || year < 1601) return false;
+  if (hour > 23 || minute > 59 || second > 59) return false;
+
+  int64_t days = daysFromCivil(year, month, dayOfMonth);
+  time = ((days * 24 + hour) * 60 + minute) * 60 * 1000 + second * 1000;
+  return true;
+}
+
+// https://tools.ietf.org/html/rfc6265#section-5.2. A name-value pair without "=" is a cookie with empty name as
+// browsers do, https://tools.ietf.org/html/draft-ietf-httpbis-rfc6265bis#section-5.6.
+bool parseSetCookie(const std::string &input, SetCookie &cookie) {
+  size_t pairEnd = std::min(input.find(';'), input.size());
+  for (size_t i = 0; i < pairEnd; i++) {
+    auto c = static_cast<unsigned char>(input[i]);
+    if ((c < 0x20 && c != '\t') || c == 0x7F) return false;
+  }
+
+  size_t equal = input.find('=');
+  if (equal == std::string::npos || equal > pairEnd) {
+    cookie.name = "";
+    cookie.value = trim(input, 0, pairEnd);
+  } else {
+    cookie.name = trim(input, 0, equal);
+    cookie.value = trim(input, equal + 1, pairEnd);
+  }
+
+  if (cookie.name.empty() && cookie.value.empty()) return false;
+  if (cookie.name.size() + cookie.value.size() > CookieJar::kMaxNameValueSize) return false;
+
+  size_t position = pairEnd;
+  while (position < input.size()) {
+    size_t start = position + 1;
+    size_t end = std::min(input.find(';', start), input.size());
+    position = end;
+
+    size_t attributeEqual = input.find('=', start);
+    std::string name;
+    std::string value;
+    if (attributeEqual == std::string::npos || attributeEqual > end) {
+      name = toLowerCase(trim(input, start, end));
+    } else {
+      name = toLowerCase(trim(input, start, attributeEqual));
+      value = trim(input, attributeEqual + 1, end);
+    }
+
+    if (name == "expires") {
+      int64_t expires;
+      if (parseCookieDate(value, expires)) cookie.expires = expires;
+    } else if (name == "max-age") {
+      if (value.empty() || !(isDigit(value[0]) || value[0] == '-')) continue;
+      bool negative = value[0] == '-';
+      if (negative && value.size() == 1) continue;
+      if (!std::all_of(value.begin() + (negative ? 1 : 0), value.end(), isDigit)) continue;
+      int64_t maxAge = 0;
+      for (size_t i = negative ? 1 : 0; i < value.size() && maxAge < CookieJar::kMaxAgeLimit; i++) {
+        maxAge = maxAge * 10 + (value[i] - '0');
+      }
+      cookie.maxAge = negative ? -maxAge : maxAge;
+    } else if (name == "domain") {
+      if (value.empty()) continue;
+      if (value[0] == '.') value.erase(0, 1);
+      cookie.domain = toLowerCase(value);
+    } else if (name == "path") {
+      if (value.empty() || value[0] != '/') {
+        cookie.path = std::nullopt;
+      } else {
+        cookie.path = value;
+      }
+    } else if (name == "secure") {
+      cookie.secure = true;
+    } else if (name == "httponly") {
+      cookie.httpOnly = true;
+    }
+  }
+
+  return true;
+}
+
+bool domainMatch(const std::string &host, const std::string &domain) {
+  if (host == domain) return true;
+  if (domain.empty() || host.size() <= domain.size() || isIPAddress(host)) return false;
+  return host.compare(host.size() - domain.size(), domain.size(), domain) == 0 &&
+         host[host.size() - domain.size() - 1] == '.';
+}
+
+bool pathMatch(const std::string &requestPath, const std::string &cookiePath) {
+  if (requestPath == cookiePath) return true;
+  if (requestPath.compare(0, cookiePath.size(), cookiePath) != 0) return false;
+  return cookiePath.back() == '/' || requestPath[cookiePath.size()] == '/';
+}
+
+std::string defaultCookiePath(const URLRecord &url) {
+  std::string path = url.hasOpaquePath ? "" : url.serializePath();
+  if (path.empty() || path[0] != '/') return "/";
+  size_t lastSlash = path.rfind('/');
+  return lastSlash == 0 ? "/" : path.substr(0, lastSlash);
+}
+
+CookieJar::CookieJar(Clock clock) : m_clock(std::move(clock)) {}
+
+int64_t CookieJar::now() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(m_clock().time_since_epoch()).count();
+}
+
+void CookieJar::setClock(Clock clock) {
+  m_clock = std::move(clock);
+}
+
+void CookieJar::clear() {
+  m_cookies.clear();
+  m_size = 0;
+}
+
+// https://tools.ietf.org/html/rfc6265#section-5.3
+bool CookieJar::setCookie(const URLRecord &url, const std::string &setCookieString, bool fromHTTP) {
+  SetCookie parsed;
+  if (!parseSetCookie(setCookieString, parsed)) return false;
+
+  int64_t currentTime = now();
+  std::string host = url.host.value_or("");
+
+  Cookie cookie;
+  cookie.name = std::move(parsed.name);
+  cookie.value = std::move(parsed.value);
+  cookie.creationTime = currentTime;
+  cookie.lastAccessTime = currentTime;
+  cookie.secure = parsed.secure;
+  cookie.httpOnly = parsed.httpOnly;
+
+  // Max-Age takes precedence over Expires regardless of their order.
+  if (parsed.maxAge) {
+    cookie.persistent = true;
+    cookie.expiryTime = *parsed.maxAge <= 0 ? kEarliestTime : currentTime + *parsed.maxAge * 1000;
+  } else if (parsed.expires) {
+    cookie.persistent = true;
+    cookie.expiryTime = *parsed.expires;
+  } else {
+    cookie.persistent = false;
+    cookie.expiryTime = kSessionExpiryTime;
+  }
+  if (cookie.persistent && cookie.expiryTime > currentTime + kMaxAgeLimit) {
+    cookie.expiryTime = currentTime + kMaxAgeLimit;
+  }
+
+  if (parsed.domain && !parsed.domain->empty()) {
+    // Without a public suffix list, top level domains are at least rejected.
+    if (!domainMatch(host, *parsed.domain)) return false;
+    if (parsed.domain->find('.') == std::string::npos && *parsed.domain != host) return false;
+    cookie.hostOnly = false;
+    cookie.domain = std::move(*parsed.domain);
+  } else {
+    cookie.hostOnly = true;
+    cookie.domain = host;
+  }
+
+  cookie.path = parsed.path ? std::move(*parsed.path) : defaultCookiePath(url);
+
+  if (cookie.secure && !isSecureScheme(url.scheme)) return false;
+  if (cookie.httpOnly && !fromHTTP) return false;
+
+  auto &cookies = m_cookies[cookie.domain];
+  auto existing = std::find_if(cookies.begin(), cookies.end(), [&cookie](const Cookie &old) {
+    return old.name == cookie.name && old.path == cookie.path;
+  });
+  if (existing != cookies.end()) {
+    if (existing->httpOnly && !fromHTTP) return false;
+    cookie.creationTime = existing->creationTime;
+    cookie.creationIndex = existing->creationIndex;
+    cookies.erase(existing);
+    m_size--;
+  } else {
+    cookie.creationIndex = m_nextCreationIndex++;
+  }
+
+  // An expired cookie only removes the old one.
+  if (cookie.expiryTime <= currentTime) {
+    if (cookies.empty()) m_cookies.erase(cookie.domain);
+    return true;
+  }
+
+  std::string domain = cookie.domain;
+  cookies.emplace_back(std::move(cookie));
+  m_size++;
+  evict(domain);
+  return true;
+}
+
+// https://tools.ietf.org/html/rfc6265#section-5.4
+std::string CookieJar::getCookies(const URLRecord &url, bool forHTTP) {
+  int64_t currentTime = now();
+  std::string host = url.host.value_or("");
+  std::string path = url.hasOpaquePath ? "" : url.serializePath();
+  if (path.empty() || path[0] != '/') path = "/";
+  bool secure = isSecureScheme(url.scheme);
+
+  std::vector<Cookie *> matched;
+  auto collect = [&](const std::string &domain) {
+    auto bucket = m_cookies.find(domain);
+    if (bucket == m_cookies.end()) return;
+
+    auto &cookies = bucket->second;
+    size_t size = cookies.size();
+    cookies.erase(std::remove_if(cookies.begin(), cookies.end(),
+                                 [currentTime](const Cookie &cookie) { return cookie.expiryTime <= currentTime; }),
+                  cookies.end());
+    m_size -= size - cookies.size();
+
+    for (auto &cookie : cookies) {
+      if (cookie.hostOnly ? host != cookie.domain : !domainMatch(host, cookie.domain)) continue;
+      if (!pathMatch(path, cookie.path)) continue;
+      if (cookie.secure && !secure) continue;
+      if (cookie.httpOnly && !forHTTP) continue;
+      matched.push_back(&cookie);
+    }
+  };
+
+  collect(host);
+  if (!isIPAddress(host)) {
+    for (size_t dot = host.find('.'); dot != std::string::npos; dot = host.find('.', dot + 1)) {
+      collect(host.substr(dot + 1));
+    }
+  }
+
+  // Cookies with longer paths are listed first, then the earlier created ones.
+  std::sort(matched.begin(), matched.end(), [](const Cookie *a, const Cookie *b) {
+    if (a->path.size() != b->path.size()) return a->path.size() > b->path.size();
+    return a->creationIndex < b->creationIndex;
+  });
+
+  std::string result;
+  for (auto cookie : matched) {
+    cookie->lastAccessTime = currentTime;
+    if (!result.empty()) result += "; ";
+    if (!cookie->name.empty()) result += cookie->name + "=";
+    result += cookie->value;
+  }
+  return result;
+}
+
+void CookieJar::removeExpired(int64_t currentTime) {
+  for (auto bucket = m_cookies.begin(); bucket != m_cookies.end();) {
+    auto &cookies = bucket->second;
+    size_t size = cookies.size();
+    cookies.erase(std::remove_if(cookies.begin(), cookies.end(),
+                                 [currentTime](const Cookie &cookie) { return cookie.expiryTime <= currentTime; }),
+                  cookies.end());
+    m_size -= size - cookies.size();
+    bucket = cookies.empty() ? m_cookies.erase(bucket) : std::next(bucket);
+  }
+}
+
+// Expired cookies are removed first, then the least recently accessed ones of the same domain and at last of all
+// domains, https://tools.ietf.org/html/rfc6265#section-5.3 step 12.
+void CookieJar::evict(const std::string &domain) {
+  auto byLastAccess = [](const Cookie &a, const Cookie &b) {
+    if (a.lastAccessTime != b.lastAccessTime) return a.lastAccessTime < b.lastAccessTime;
+    return a.creationIndex < b.creationIndex;
+  };
+
+  if (m_cookies[domain].size() > kMaxCookiesPerDomain || m_size > kMaxCookies) removeExpired(now());
+
+  auto bucket = m_cookies.find(domain);
+  while (bucket != m_cookies.end() && bucket->second.size() > kMaxCookiesPerDomain) {
+    auto &cookies = bucket->second;
+    cookies.erase(std::min_element(cookies.begin(), cookies.end(), byLastAccess));
+    m_size--;
+  }
+
+  while (m_size > kMaxCookies) {
+    std::vector<Cookie>::iterator oldest;
+    std::unordered_map<std::string, std::vector<Cookie>>::iterator oldestBucket = m_cookies.end();
+    for (auto it = m_cookies.begin(); it != m_cookies.end(); it++) {
+      if (it->second.empty()) continue;
+      auto candidate = std::min_element(it->second.begin(), it->second.end(), byLastAccess);
+      if (oldestBucket == m_cookies.end() || byLastAccess(*candidate, *oldest)) {
+        oldest = candidate;
+        oldestBucket = it;
+      }
+    }
+    oldestBucket->second.erase(oldest);
+    if (oldestBucket->second.empty()) m_cookies.erase(oldestBucket);
+    m_size--;
+  }
+}
+
+} // namespace foundation
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_COOKIE_JAR_H
+#define KRAKENBRIDGE_COOKIE_JAR_H
+
+#include "url_parser.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace foundation {
+
+// Attributes of a set-cookie-string, https://tools.ietf.org/html/rfc6265#section-5.2. Times are milliseconds since
+// epoch, a path which is not absolute is left empty so the default path of request is used.
+struct SetCookie {
+  std::string name;
+  std::string value;
+  std::optional<int64_t> expires;
+  std::optional<int64_t> maxAge;
+  std::optional<std::string> domain;
+  std::optional<std::string> path;
+  bool secure{false};
+  bool httpOnly{false};
+};
+
+// Parse a Set-Cookie header value or a document.cookie assignment, returns false when the cookie must be ignored.
+// Unknown and malformed attributes are skipped.
+bool parseSetCookie(const std::string &input, SetCookie &cookie);
+
+// https://tools.ietf.org/html/rfc6265#section-5.1.1, time is milliseconds since epoch.
+bool parseCookieDate(const std::string &input, int64_t &time);
+
+// https://tools.ietf.org/html/rfc6265#section-5.1.3 and #section-5.1.4.
+bool domainMatch(const std::string &host, const std::string &domain);
+bool pathMatch(const std::string &requestPath, const std::string &cookiePath);
+std::string defaultCookiePath(const URLRecord &url);
+
+struct Cookie {
+  std::string name;
+  std::string value;
+  std::string domain;
+  std::string path;
+  // Milliseconds since epoch, session cookies never expire until the jar is dropped.
+  int64_t expiryTime;
+  int64_t creationTime;
+  int64_t lastAccessTime;
+  // Orders cookies created within the same millisecond.
+  uint64_t creationIndex;
+  bool persistent;
+  bool hostOnly;
+  bool secure;
+  bool httpOnly;
+};
+
+// Cookie storage model of https://tools.ietf.org/html/rfc6265#section-5.3. Cookies are bucketed by their domain,
+// so a lookup only visits the buckets of host and its parent domains.
+class CookieJar {
+public:
+  using Clock = std::function<std::chrono::system_clock::time_point()>;
+
+  // Limits suggested by https://tools.ietf.org/html/rfc6265#section-6.1, expiry is capped to 400 days as
+  // browsers do.
+  static constexpr size_t kMaxCookiesPerDomain = 50;
+  static constexpr size_t kMaxCookies = 3000;
+  static constexpr size_t kMaxNameValueSize = 4096;
+  static constexpr int64_t kMaxAgeLimit = 400LL * 24 * 60 * 60 * 1000;
+
+  explicit CookieJar(Clock clock = std::chrono::system_clock::now);
+
+  // Store a cookie received from url, the cookie is ignored when it is invalid for url. fromHTTP is false for
+  // document.cookie, which can't touch HttpOnly cookies.
+  bool setCookie(const URLRecord &url, const std::string &setCookieString, bool fromHTTP);
+  // The cookie-string of https://tools.ietf.org/html/rfc6265#section-5.4, joined with "; ".
+  std::string getCookies(const URLRecord &url, bool forHTTP);
+
+  // Replace the time source, expired cookies are dropped on the next access.
+  void setClock(Clock clock);
+  void clear();
+  size_t size() const {
+    return m_size;
+  }
+
+private:
+  int64_t now() const;
+  void removeExpired(int64_t now);
+  void evict(const std::string &domain);
+
+  Clock m_clock;
+  std::unordered_map<std::string, std::vector<Cookie>> m_cookies;
+  size_t m_size{0};
+  uint64_t m_nextCreationIndex{0};
+};
+
+} // namespace foundation
+
+#endif // KRAKENBRIDGE_COOKIE_JAR_H
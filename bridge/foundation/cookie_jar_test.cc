@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "cookie_jar.h"
+#include "url_parser.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <ctime>
+#include <string>
+
+using namespace foundation;
+
+namespace {
+
+class CookieJarTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    URLParser::parse(decodeUTF8("http://kraken.test/"), nullptr, url);
+    now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    setTime(now);
+  }
+
+  // Freeze the clock of the jar at the given milliseconds since epoch.
+  void setTime(int64_t time) {
+    jar.setClock([time]() { return std::chrono::system_clock::time_point(std::chrono::milliseconds(time)); });
+  }
+
+  void set(const std::string &cookie) {
+    jar.setCookie(url, cookie, false);
+  }
+
+  std::string get() {
+    return jar.getCookies(url, false);
+  }
+
+  CookieJar jar;
+  URLRecord url;
+  int64_t now;
+};
+
+std::string toUTCString(int64_t time) {
+  std::time_t seconds = time / 1000;
+  char buffer[64];
+  std::strftime(buffer, sizeof(buffer), "%a, %d %b %Y %H:%M:%S GMT", std::gmtime(&seconds));
+  return buffer;
+}
+
+} // namespace
+
+TEST_F(CookieJarTest, expiresWithTheClockOfTheJar) {
+  set("a=1; Max-Age=10");
+  set("b=2; Expires=" + toUTCString(now + 20000));
+  set("c=3");
+
+  setTime(now + 9999);
+  EXPECT_EQ(get(), "a=1; b=2; c=3");
+  setTime(now + 10000);
+  EXPECT_EQ(get(), "b=2; c=3");
+  setTime(now + 20000);
+  EXPECT_EQ(get(), "c=3");
+}
+
+TEST_F(CookieJarTest, expiryIsCappedTo400Days) {
+  set("a=1; Expires=Fri, 31 Dec 9999 23:59:59 GMT");
+  setTime(now + CookieJar::kMaxAgeLimit);
+  EXPECT_EQ(get(), "");
+}
+
+TEST_F(CookieJarTest, leastRecentlyAccessedCookieIsEvictedBeyondTheDomainLimit) {
+  for (size_t i = 0; i < CookieJar::kMaxCookiesPerDomain; i++) {
+    setTime(now + i);
+    set("k" + std::to_string(i) + "=v");
+  }
+  // Updating k0 makes k1 the least recently accessed one.
+  setTime(now + 100);
+  set("k0=updated");
+  setTime(now + 101);
+  set("k50=v");
+
+  std::string cookies = get();
+  EXPECT_EQ(jar.size(), CookieJar::kMaxCookiesPerDomain);
+  EXPECT_EQ(cookies.find("k0=updated"), 0);
+  EXPECT_EQ(cookies.find("k1="), std::string::npos);
+  EXPECT_EQ(cookies.rfind("k50=v"), cookies.size() - 5);
+}
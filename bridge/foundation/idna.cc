@@ -0,0 +1,417 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "idna.h"
+#include "idna_table.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace foundation {
+
+namespace {
+
+using namespace idna_table;
+
+constexpr char32_t kZeroWidthNonJoiner = 0x200C;
+constexpr char32_t kZeroWidthJoiner = 0x200D;
+constexpr uint8_t kViramaCombiningClass = 9;
+// Strings below the first combining mark are always normalized.
+constexpr char32_t kFirstCombiningMark = 0x300;
+
+// Hangul syllables are composed and decomposed algorithmically, https://unicode.org/reports/tr15/#Hangul
+constexpr char32_t kSBase = 0xAC00;
+constexpr char32_t kLBase = 0x1100;
+constexpr char32_t kVBase = 0x1161;
+constexpr char32_t kTBase = 0x11A7;
+constexpr uint32_t kLCount = 19;
+constexpr uint32_t kVCount = 21;
+constexpr uint32_t kTCount = 28;
+constexpr uint32_t kNCount = kVCount * kTCount;
+constexpr uint32_t kSCount = kLCount * kNCount;
+
+template <size_t N>
+uint8_t lookupRange(const CodePointRange (&table)[N], char32_t c, uint8_t fallback) {
+  auto range = std::upper_bound(std::begin(table), std::end(table), c,
+                                [](char32_t c, const CodePointRange &range) { return c < range.start; });
+  if (range == std::begin(table)) return fallback;
+  range--;
+  return c <= range->end ? range->value : fallback;
+}
+
+uint8_t combiningClass(char32_t c) {
+  return c < kFirstCombiningMark ? 0 : lookupRange(kCombiningClasses, c, 0);
+}
+
+bool isMark(char32_t c) {
+  return lookupRange(kMarks, c, 0) != 0;
+}
+
+BidiClass bidiClass(char32_t c) {
+  return static_cast<BidiClass>(lookupRange(kBidiClasses, c, kBidiL));
+}
+
+JoiningType joiningType(char32_t c) {
+  return static_cast<JoiningType>(lookupRange(kJoiningTypes, c, kJoiningU));
+}
+
+const IDNAMappingRange &idnaMapping(char32_t c) {
+  auto range = std::upper_bound(std::begin(kIDNAMapping), std::end(kIDNAMapping), c,
+                                [](char32_t c, const IDNAMappingRange &range) { return c < range.start; });
+  return *(range - 1);
+}
+
+void decompose(char32_t c, std::u32string &output) {
+  if (c >= kSBase && c < kSBase + kSCount) {
+    uint32_t index = c - kSBase;
+    output.push_back(kLBase + index / kNCount);
+    output.push_back(kVBase + (index % kNCount) / kTCount);
+    if (index % kTCount != 0) output.push_back(kTBase + index % kTCount);
+    return;
+  }
+
+  auto decomposition = std::lower_bound(std::begin(kDecompositions), std::end(kDecompositions), c,
+                                        [](const Decomposition &d, char32_t c) { return d.codePoint < c; });
+  if (decomposition == std::end(kDecompositions) || decomposition->codePoint != c) {
+    output.push_back(c);
+    return;
+  }
+  output.append(kDecompositionData + decomposition->offset, decomposition->length);
+}
+
+bool compose(char32_t first, char32_t second, char32_t *composite) {
+  if (first >= kLBase && first < kLBase + kLCount && second >= kVBase && second < kVBase + kVCount) {
+    *composite = kSBase + ((first - kLBase) * kVCount + (second - kVBase)) * kTCount;
+    return true;
+  }
+  if (first >= kSBase && first < kSBase + kSCount && (first - kSBase) % kTCount == 0 && second > kTBase &&
+      second < kTBase + kTCount) {
+    *composite = first + (second - kTBase);
+    return true;
+  }
+
+  auto composition = std::lower_bound(std::begin(kCompositions), std::end(kCompositions), std::make_pair(first, second),
+                                      [](const Composition &c, const std::pair<char32_t, char32_t> &pair) {
+                                        return c.first < pair.first ||
+                                               (c.first == pair.first && c.second < pair.second);
+                                      });
+  if (composition == std::end(kCompositions) || composition->first != first || composition->second != second) {
+    return false;
+  }
+  *composite = composition->composite;
+  return true;
+}
+
+// Punycode, https://tools.ietf.org/html/rfc3492, labels are encoded and decoded without the `xn--` prefix.
+namespace punycode {
+
+constexpr uint32_t kBase = 36;
+constexpr uint32_t kTMin = 1;
+constexpr uint32_t kTMax = 26;
+constexpr uint32_t kSkew = 38;
+constexpr uint32_t kDamp = 700;
+constexpr uint32_t kInitialBias = 72;
+constexpr uint32_t kInitialN = 128;
+constexpr uint64_t kMaxInt = 0x7FFFFFFF;
+
+uint32_t adapt(uint32_t delta, uint32_t numPoints, bool firstTime) {
+  delta = firstTime ? delta / kDamp : delta / 2;
+  delta += delta / numPoints;
+  uint32_t k = 0;
+  while (delta > ((kBase - kTMin) * kTMax) / 2) {
+    delta /= kBase - kTMin;
+    k += kBase;
+  }
+  return k + (kBase - kTMin + 1) * delta / (delta + kSkew);
+}
+
+char encodeDigit(uint32_t digit) {
+  return static_cast<char>(digit < 26 ? 'a' + digit : '0' + digit - 26);
+}
+
+std::optional<std::string> encode(const std::u32string &input) {
+  std::string output;
+  for (char32_t c : input) {
+    if (c < 0x80) output.push_back(static_cast<char>(c));
+  }
+
+  uint64_t n = kInitialN;
+  uint64_t delta = 0;
+  uint32_t bias = kInitialBias;
+  size_t basicLength = output.size();
+  size_t handled = basicLength;
+  if (basicLength > 0) output.push_back('-');
+
+  while (handled < input.size()) {
+    uint64_t m = kMaxInt;
+    for (char32_t c : input) {
+      if (c >= n && c < m) m = c;
+    }
+    if ((m - n) > (kMaxInt - delta) / (handled + 1)) return std::nullopt;
+    delta += (m - n) * (handled + 1);
+    n = m;
+
+    for (char32_t c : input) {
+      if (c < n && ++delta > kMaxInt) return std::nullopt;
+      if (c != n) continue;
+
+      uint64_t q = delta;
+      for (uint32_t k = kBase;; k += kBase) {
+        uint32_t t = k <= bias ? kTMin : (k >= bias + kTMax ? kTMax : k - bias);
+        if (q < t) break;
+        output.push_back(encodeDigit(t + (q - t) % (kBase - t)));
+        q = (q - t) / (kBase - t);
+      }
+      output.push_back(encodeDigit(q));
+      bias = adapt(delta, handled + 1, handled == basicLength);
+      delta = 0;
+      handled++;
+    }
+
+    delta++;
+    n++;
+  }
+
+  return output;
+}
+
+std::optional<std::u32string> decode(const std::string &input) {
+  std::u32string output;
+  size_t basicEnd = input.rfind('-');
+  size_t in = 0;
+  if (basicEnd != std::string::npos) {
+    for (size_t j = 0; j < basicEnd; j++) {
+      if (static_cast<unsigned char>(input[j]) >= 0x80) return std::nullopt;
+      output.push_back(input[j]);
+    }
+    in = basicEnd + 1;
+  }
+
+  uint64_t n = kInitialN;
+  uint64_t i = 0;
+  uint32_t bias = kInitialBias;
+
+  while (in < input.size()) {
+    uint64_t oldi = i;
+    uint64_t w = 1;
+    for (uint32_t k = kBase;; k += kBase) {
+      if (in >= input.size()) return std::nullopt;
+      char c = input[in++];
+      uint32_t digit;
+      if (c >= '0' && c <= '9') {
+        digit = c - '0' + 26;
+      } else if (c >= 'a' && c <= 'z') {
+        digit = c - 'a';
+      } else if (c >= 'A' && c <= 'Z') {
+        digit = c - 'A';
+      } else {
+        return std::nullopt;
+      }
+      if (digit > (kMaxInt - i) / w) return std::nullopt;
+      i += digit * w;
+      uint32_t t = k <= bias ? kTMin : (k >= bias + kTMax ? kTMax : k - bias);
+      if (digit < t) break;
+      if (w > kMaxInt / (kBase - t)) return std::nullopt;
+      w *= kBase - t;
+    }
+
+    uint64_t length = output.size() + 1;
+    bias = adapt(i - oldi, length, oldi == 0);
+    if (i / length > kMaxInt - n) return std::nullopt;
+    n += i / length;
+    i %= length;
+    if (n > 0x10FFFF || (n >= 0xD800 && n <= 0xDFFF)) return std::nullopt;
+    output.insert(output.begin() + i, static_cast<char32_t>(n));
+    i++;
+  }
+
+  return output;
+}
+
+} // namespace punycode
+
+bool isASCII(const std::u32string &input) {
+  return std::all_of(input.begin(), input.end(), [](char32_t c) { return c < 0x80; });
+}
+
+// https://tools.ietf.org/html/rfc5892#appendix-A.1 and https://tools.ietf.org/html/rfc5892#appendix-A.2
+bool checkJoiners(const std::u32string &label) {
+  for (size_t i = 0; i < label.size(); i++) {
+    if (label[i] != kZeroWidthNonJoiner && label[i] != kZeroWidthJoiner) continue;
+    if (i > 0 && combiningClass(label[i - 1]) == kViramaCombiningClass) continue;
+    if (label[i] == kZeroWidthJoiner) return false;
+
+    // (Joining_Type:{L,D})(Joining_Type:T)*\u200C(Joining_Type:T)*(Joining_Type:{R,D})
+    size_t before = i;
+    while (before > 0 && joiningType(label[before - 1]) == kJoiningT) before--;
+    if (before == 0) return false;
+    JoiningType left = joiningType(label[before - 1]);
+    if (left != kJoiningL && left != kJoiningD) return false;
+
+    size_t after = i + 1;
+    while (after < label.size() && joiningType(label[after]) == kJoiningT) after++;
+    if (after == label.size()) return false;
+    JoiningType right = joiningType(label[after]);
+    if (right != kJoiningR && right != kJoiningD) return false;
+  }
+  return true;
+}
+
+bool isRTLLabel(const std::u32string &label) {
+  return std::any_of(label.begin(), label.end(), [](char32_t c) {
+    BidiClass bidi = bidiClass(c);
+    return bidi == kBidiR || bidi == kBidiAL || bidi == kBidiAN;
+  });
+}
+
+// The Bidi Rule, https://tools.ietf.org/html/rfc5893#section-2
+bool satisfiesBidiRule(const std::u32string &label) {
+  if (label.empty()) return true;
+  BidiClass first = bidiClass(label[0]);
+  if (first != kBidiL && first != kBidiR && first != kBidiAL) return false;
+  bool isRTL = first != kBidiL;
+
+  bool hasEN = false;
+  bool hasAN = false;
+  for (char32_t c : label) {
+    BidiClass bidi = bidiClass(c);
+    switch (bidi) {
+      case kBidiL:
+        if (isRTL) return false;
+        break;
+      case kBidiR:
+      case kBidiAL:
+      case kBidiAN:
+        if (!isRTL) return false;
+        break;
+      case kBidiOther:
+        return false;
+      default:
+        break;
+    }
+    hasEN = hasEN || bidi == kBidiEN;
+    hasAN = hasAN || bidi == kBidiAN;
+  }
+
+  // The label ends with its last character which is not NSM, the first one is never NSM.
+  size_t end = label.size();
+  while (bidiClass(label[end - 1]) == kBidiNSM) end--;
+  BidiClass last = bidiClass(label[end - 1]);
+  if (isRTL) {
+    return (last == kBidiR || last == kBidiAL || last == kBidiEN || last == kBidiAN) && !(hasEN && hasAN);
+  }
+  return last == kBidiL || last == kBidiEN;
+}
+
+// https://unicode.org/reports/tr46/#Validity_Criteria, labels which were not punycode are normalized and mapped
+// already.
+bool isValidLabel(const std::u32string &label, bool decoded) {
+  if (label.empty()) return true;
+  if (decoded && (label.compare(0, 4, U"xn--") == 0 || normalizeNFC(label) != label)) return false;
+  if (isMark(label[0])) return false;
+  for (char32_t c : label) {
+    if (c == '.' || idnaMapping(c).status != kValid) return false;
+  }
+  return checkJoiners(label);
+}
+
+} // namespace
+
+std::u32string normalizeNFC(const std::u32string &input) {
+  if (std::all_of(input.begin(), input.end(), [](char32_t c) { return c < kFirstCombiningMark; })) return input;
+
+  std::u32string decomposed;
+  decomposed.reserve(input.size());
+  for (char32_t c : input) {
+    decompose(c, decomposed);
+  }
+
+  // Canonical ordering, marks between two starters are stably sorted by their combining classes.
+  for (size_t i = 1; i < decomposed.size(); i++) {
+    uint8_t combining = combiningClass(decomposed[i]);
+    if (combining == 0) continue;
+    for (size_t j = i; j > 0 && combiningClass(decomposed[j - 1]) > combining; j--) {
+      std::swap(decomposed[j - 1], decomposed[j]);
+    }
+  }
+
+  // Canonical composition, a character composes with the last starter unless another character between them is a
+  // starter or has a combining class not lower than its own.
+  std::u32string result;
+  result.reserve(decomposed.size());
+  size_t starter = std::u32string::npos;
+  uint8_t lastCombiningClass = 0;
+  for (char32_t c : decomposed) {
+    uint8_t combining = combiningClass(c);
+    if (starter != std::u32string::npos) {
+      bool adjacent = result.size() == starter + 1;
+      char32_t composite;
+      if ((adjacent || (lastCombiningClass != 0 && lastCombiningClass < combining)) &&
+          compose(result[starter], c, &composite)) {
+        result[starter] = composite;
+        continue;
+      }
+    }
+    if (combining == 0) starter = result.size();
+    lastCombiningClass = combining;
+    result.push_back(c);
+  }
+
+  return result;
+}
+
+std::optional<std::string> domainToASCIIUTS46(const std::u32string &domain) {
+  std::u32string mapped;
+  mapped.reserve(domain.size());
+  for (char32_t c : domain) {
+    const IDNAMappingRange &mapping = idnaMapping(c);
+    if (mapping.status == kDisallowed) return std::nullopt;
+    if (mapping.status == kValid) {
+      mapped.push_back(c);
+    } else {
+      mapped.append(kIDNAMappingData + mapping.mappingOffset, mapping.mappingLength);
+    }
+  }
+
+  std::u32string normalized = normalizeNFC(mapped);
+  std::vector<std::u32string> labels;
+  bool isBidiDomain = false;
+  size_t start = 0;
+  while (true) {
+    size_t end = normalized.find('.', start);
+    std::u32string label = normalized.substr(start, end == std::u32string::npos ? std::u32string::npos : end - start);
+
+    bool decoded = label.compare(0, 4, U"xn--") == 0;
+    if (decoded) {
+      if (!isASCII(label)) return std::nullopt;
+      auto unicode = punycode::decode(std::string(label.begin() + 4, label.end()));
+      if (!unicode || unicode->empty() || isASCII(*unicode)) return std::nullopt;
+      label = std::move(*unicode);
+    }
+    if (!isValidLabel(label, decoded)) return std::nullopt;
+
+    isBidiDomain = isBidiDomain || isRTLLabel(label);
+    labels.emplace_back(std::move(label));
+    if (end == std::u32string::npos) break;
+    start = end + 1;
+  }
+
+  std::string result;
+  for (size_t i = 0; i < labels.size(); i++) {
+    if (isBidiDomain && !satisfiesBidiRule(labels[i])) return std::nullopt;
+    if (i > 0) result.push_back('.');
+    if (isASCII(labels[i])) {
+      result.append(labels[i].begin(), labels[i].end());
+    } else {
+      auto encoded = punycode::encode(labels[i]);
+      if (!encoded) return std::nullopt;
+      result += "xn--" + *encoded;
+    }
+  }
+
+  return result;
+}
+
+} // namespace foundation
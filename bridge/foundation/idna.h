@@ -0,0 +1,24 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_IDNA_H
+#define KRAKENBRIDGE_IDNA_H
+
+#include <optional>
+#include <string>
+
+namespace foundation {
+
+// Unicode Normalization Form C, https://unicode.org/reports/tr15/
+std::u32string normalizeNFC(const std::u32string &input);
+
+// UTS #46 ToASCII, https://unicode.org/reports/tr46/#ToASCII, with the options the URL standard uses when beStrict
+// is false: CheckBidi and CheckJoiners, nontransitional processing, no hyphen, STD3 or DNS length checks. Returns
+// nullopt when an error is recorded.
+std::optional<std::string> domainToASCIIUTS46(const std::u32string &domain);
+
+} // namespace foundation
+
+#endif // KRAKENBRIDGE_IDNA_H
@@ -0,0 +1,3701 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+// Generated by scripts/generate_idna_table.py from Unicode 15.1.0, do not edit.
+
+#ifndef KRAKENBRIDGE_IDNA_TABLE_H
+#define KRAKENBRIDGE_IDNA_TABLE_H
+
+#include <cstdint>
+
+namespace foundation::idna_table {
+
+constexpr const char *kUnicodeVersion = "15.1.0";
+
+enum IDNAStatus : uint8_t { kValid, kMapped, kDisallowed };
+
+// A range starts at its code point and ends before the next one.
+struct IDNAMappingRange {
+  uint32_t start;
+  IDNAStatus status;
+  uint8_t mappingLength;
+  uint16_t mappingOffset;
+};
+
+struct CodePointRange {
+  uint32_t start;
+  uint32_t end;
+  uint8_t value;
+};
+
+struct Decomposition {
+  uint32_t codePoint;
+  uint16_t offset;
+  uint8_t length;
+};
+
+struct Composition {
+  uint32_t first;
+  uint32_t second;
+  uint32_t composite;
+};
+
+enum BidiClass : uint8_t {
+  kBidiL, kBidiR, kBidiAL, kBidiAN, kBidiEN, kBidiES, kBidiCS, kBidiET, kBidiON, kBidiBN, kBidiNSM, kBidiOther,
+};
+
+enum JoiningType : uint8_t { kJoiningU, kJoiningL, kJoiningD, kJoiningR, kJoiningT };
+
+static const IDNAMappingRange kIDNAMapping[] = {
+  {0x0, kValid, 0, 0}, {0x41, kMapped, 1, 0}, {0x42, kMapped, 1, 1}, {0x43, kMapped, 1, 2}, {0x44, kMapped, 1, 3},
+  {0x45, kMapped, 1, 4}, {0x46, kMapped, 1, 5}, {0x47, kMapped, 1, 6}, {0x48, kMapped, 1, 7}, {0x49, kMapped, 1, 8},
+  {0x4A, kMapped, 1, 9}, {0x4B, kMapped, 1, 10}, {0x4C, kMapped, 1, 11}, {0x4D, kMapped, 1, 12},
+  {0x4E, kMapped, 1, 13}, {0x4F, kMapped, 1, 14}, {0x50, kMapped, 1, 15}, {0x51, kMapped, 1, 16},
+  {0x52, kMapped, 1, 17}, {0x53, kMapped, 1, 18}, {0x54, kMapped, 1, 19}, {0x55, kMapped, 1, 20},
+  {0x56, kMapped, 1, 21}, {0x57, kMapped, 1, 22}, {0x58, kMapped, 1, 23}, {0x59, kMapped, 1, 24},
+  {0x5A, kMapped, 1, 25}, {0x5B, kValid, 0, 0}, {0x80, kDisallowed, 0, 0}, {0xA0, kMapped, 1, 26},
+  {0xA1, kValid, 0, 0}, {0xA8, kMapped, 2, 27}, {0xA9, kValid, 0, 0}, {0xAA, kMapped, 1, 0}, {0xAB, kValid, 0, 0},
+  {0xAD, kMapped, 0, 0}, {0xAE, kValid, 0, 0}, {0xAF, kMapped, 2, 29}, {0xB0, kValid, 0, 0}, {0xB2, kMapped, 1, 31},
+  {0xB3, kMapped, 1, 32}, {0xB4, kMapped, 2, 33}, {0xB5, kMapped, 1, 35}, {0xB6, kValid, 0, 0}, {0xB8, kMapped, 2, 36},
+  {0xB9, kMapped, 1, 38}, {0xBA, kMapped, 1, 14}, {0xBB, kValid, 0, 0}, {0xBC, kMapped, 3, 39}, {0xBD, kMapped, 3, 42},
+  {0xBE, kMapped, 3, 45}, {0xBF, kValid, 0, 0}, {0xC0, kMapped, 1, 48}, {0xC1, kMapped, 1, 49}, {0xC2, kMapped, 1, 50},
+  {0xC3, kMapped, 1, 51}, {0xC4, kMapped, 1, 52}, {0xC5, kMapped, 1, 53}, {0xC6, kMapped, 1, 54},
+  {0xC7, kMapped, 1, 55}, {0xC8, kMapped, 1, 56}, {0xC9, kMapped, 1, 57}, {0xCA, kMapped, 1, 58},
+  {0xCB, kMapped, 1, 59}, {0xCC, kMapped, 1, 60}, {0xCD, kMapped, 1, 61}, {0xCE, kMapped, 1, 62},
+  {0xCF, kMapped, 1, 63}, {0xD0, kMapped, 1, 64}, {0xD1, kMapped, 1, 65}, {0xD2, kMapped, 1, 66},
+  {0xD3, kMapped, 1, 67}, {0xD4, kMapped, 1, 68}, {0xD5, kMapped, 1, 69}, {0xD6, kMapped, 1, 70}, {0xD7, kValid, 0, 0},
+  {0xD8, kMapped, 1, 71}, {0xD9, kMapped, 1, 72}, {0xDA, kMapped, 1, 73}, {0xDB, kMapped, 1, 74},
+  {0xDC, kMapped, 1, 75}, {0xDD, kMapped, 1, 76}, {0xDE, kMapped, 1, 77}, {0xDF, kValid, 0, 0},
+  {0x100, kMapped, 1, 78}, {0x101, kValid, 0, 0}, {0x102, kMapped, 1, 79}, {0x103, kValid, 0, 0},
+  {0x104, kMapped, 1, 80}, {0x105, kValid, 0, 0}, {0x106, kMapped, 1, 81}, {0x107, kValid, 0, 0},
+  {0x108, kMapped, 1, 82}, {0x109, kValid, 0, 0}, {0x10A, kMapped, 1, 83}, {0x10B, kValid, 0, 0},
+  {0x10C, kMapped, 1, 84}, {0x10D, kValid, 0, 0}, {0x10E, kMapped, 1, 85}, {0x10F, kValid, 0, 0},
+  {0x110, kMapped, 1, 86}, {0x111, kValid, 0, 0}, {0x112, kMapped, 1, 87}, {0x113, kValid, 0, 0},
+  {0x114, kMapped, 1, 88}, {0x115, kValid, 0, 0}, {0x116, kMapped, 1, 89}, {0x117, kValid, 0, 0},
+  {0x118, kMapped, 1, 90}, {0x119, kValid, 0, 0}, {0x11A, kMapped, 1, 91}, {0x11B, kValid, 0, 0},
+  {0x11C, kMapped, 1, 92}, {0x11D, kValid, 0, 0}, {0x11E, kMapped, 1, 93}, {0x11F, kValid, 0, 0},
+  {0x120, kMapped, 1, 94}, {0x121, kValid, 0, 0}, {0x122, kMapped, 1, 95}, {0x123, kValid, 0, 0},
+  {0x124, kMapped, 1, 96}, {0x125, kValid, 0, 0}, {0x126, kMapped, 1, 97}, {0x127, kValid, 0, 0},
+  {0x128, kMapped, 1, 98}, {0x129, kValid, 0, 0}, {0x12A, kMapped, 1, 99}, {0x12B, kValid, 0, 0},
+  {0x12C, kMapped, 1, 100}, {0x12D, kValid, 0, 0}, {0x12E, kMapped, 1, 101}, {0x12F, kValid, 0, 0},
+  {0x130, kMapped, 2, 102}, {0x131, kValid, 0, 0}, {0x132, kMapped, 2, 104}, {0x134, kMapped, 1, 106},
+  {0x135, kValid, 0, 0}, {0x136, kMapped, 1, 107}, {0x137, kValid, 0, 0}, {0x139, kMapped, 1, 108},
+  {0x13A, kValid, 0, 0}, {0x13B, kMapped, 1, 109}, {0x13C, kValid, 0, 0}, {0x13D, kMapped, 1, 110},
+  {0x13E, kValid, 0, 0}, {0x13F, kMapped, 2, 111}, {0x141, kMapped, 1, 113}, {0x142, kValid, 0, 0},
+  {0x143, kMapped, 1, 114}, {0x144, kValid, 0, 0}, {0x145, kMapped, 1, 115}, {0x146, kValid, 0, 0},
+  {0x147, kMapped, 1, 116}, {0x148, kValid, 0, 0}, {0x149, kMapped, 2, 117}, {0x14A, kMapped, 1, 119},
+  {0x14B, kValid, 0, 0}, {0x14C, kMapped, 1, 120}, {0x14D, kValid, 0, 0}, {0x14E, kMapped, 1, 121},
+  {0x14F, kValid, 0, 0}, {0x150, kMapped, 1, 122}, {0x151, kValid, 0, 0}, {0x152, kMapped, 1, 123},
+  {0x153, kValid, 0, 0}, {0x154, kMapped, 1, 124}, {0x155, kValid, 0, 0}, {0x156, kMapped, 1, 125},
+  {0x157, kValid, 0, 0}, {0x158, kMapped, 1, 126}, {0x159, kValid, 0, 0}, {0x15A, kMapped, 1, 127},
+  {0x15B, kValid, 0, 0}, {0x15C, kMapped, 1, 128}, {0x15D, kValid, 0, 0}, {0x15E, kMapped, 1, 129},
+  {0x15F, kValid, 0, 0}, {0x160, kMapped, 1, 130}, {0x161, kValid, 0, 0}, {0x162, kMapped, 1, 131},
+  {0x163, kValid, 0, 0}, {0x164, kMapped, 1, 132}, {0x165, kValid, 0, 0}, {0x166, kMapped, 1, 133},
+  {0x167, kValid, 0, 0}, {0x168, kMapped, 1, 134}, {0x169, kValid, 0, 0}, {0x16A, kMapped, 1, 135},
+  {0x16B, kValid, 0, 0}, {0x16C, kMapped, 1, 136}, {0x16D, kValid, 0, 0}, {0x16E, kMapped, 1, 137},
+  {0x16F, kValid, 0, 0}, {0x170, kMapped, 1, 138}, {0x171, kValid, 0, 0}, {0x172, kMapped, 1, 139},
+  {0x173, kValid, 0, 0}, {0x174, kMapped, 1, 140}, {0x175, kValid, 0, 0}, {0x176, kMapped, 1, 141},
+  {0x177, kValid, 0, 0}, {0x178, kMapped, 1, 142}, {0x179, kMapped, 1, 143}, {0x17A, kValid, 0, 0},
+  {0x17B, kMapped, 1, 144}, {0x17C, kValid, 0, 0}, {0x17D, kMapped, 1, 145}, {0x17E, kValid, 0, 0},
+  {0x17F, kMapped, 1, 18}, {0x180, kValid, 0, 0}, {0x181, kMapped, 1, 146}, {0x182, kMapped, 1, 147},
+  {0x183, kValid, 0, 0}, {0x184, kMapped, 1, 148}, {0x185, kValid, 0, 0}, {0x186, kMapped, 1, 149},
+  {0x187, kMapped, 1, 150}, {0x188, kValid, 0, 0}, {0x189, kMapped, 1, 151}, {0x18A, kMapped, 1, 152},
+  {0x18B, kMapped, 1, 153}, {0x18C, kValid, 0, 0}, {0x18E, kMapped, 1, 154}, {0x18F, kMapped, 1, 155},
+  {0x190, kMapped, 1, 156}, {0x191, kMapped, 1, 157}, {0x192, kValid, 0, 0}, {0x193, kMapped, 1, 158},
+  {0x194, kMapped, 1, 159}, {0x195, kValid, 0, 0}, {0x196, kMapped, 1, 160}, {0x197, kMapped, 1, 161},
+  {0x198, kMapped, 1, 162}, {0x199, kValid, 0, 0}, {0x19C, kMapped, 1, 163}, {0x19D, kMapped, 1, 164},
+  {0x19E, kValid, 0, 0}, {0x19F, kMapped, 1, 165}, {0x1A0, kMapped, 1, 166}, {0x1A1, kValid, 0, 0},
+  {0x1A2, kMapped, 1, 167}, {0x1A3, kValid, 0, 0}, {0x1A4, kMapped, 1, 168}, {0x1A5, kValid, 0, 0},
+  {0x1A6, kMapped, 1, 169}, {0x1A7, kMapped, 1, 170}, {0x1A8, kValid, 0, 0}, {0x1A9, kMapped, 1, 171},
+  {0x1AA, kValid, 0, 0}, {0x1AC, kMapped, 1, 172}, {0x1AD, kValid, 0, 0}, {0x1AE, kMapped, 1, 173},
+  {0x1AF, kMapped, 1, 174}, {0x1B0, kValid, 0, 0}, {0x1B1, kMapped, 1, 175}, {0x1B2, kMapped, 1, 176},
+  {0x1B3, kMapped, 1, 177}, {0x1B4, kValid, 0, 0}, {0x1B5, kMapped, 1, 178}, {0x1B6, kValid, 0, 0},
+  {0x1B7, kMapped, 1, 179}, {0x1B8, kMapped, 1, 180}, {0x1B9, kValid, 0, 0}, {0x1BC, kMapped, 1, 181},
+  {0x1BD, kValid, 0, 0}, {0x1C4, kMapped, 2, 182}, {0x1C7, kMapped, 2, 184}, {0x1CA, kMapped, 2, 186},
+  {0x1CD, kMapped, 1, 188}, {0x1CE, kValid, 0, 0}, {0x1CF, kMapped, 1, 189}, {0x1D0, kValid, 0, 0},
+  {0x1D1, kMapped, 1, 190}, {0x1D2, kValid, 0, 0}, {0x1D3, kMapped, 1, 191}, {0x1D4, kValid, 0, 0},
+  {0x1D5, kMapped, 1, 192}, {0x1D6, kValid, 0, 0}, {0x1D7, kMapped, 1, 193}, {0x1D8, kValid, 0, 0},
+  {0x1D9, kMapped, 1, 194}, {0x1DA, kValid, 0, 0}, {0x1DB, kMapped, 1, 195}, {0x1DC, kValid, 0, 0},
+  {0x1DE, kMapped, 1, 196}, {0x1DF, kValid, 0, 0}, {0x1E0, kMapped, 1, 197}, {0x1E1, kValid, 0, 0},
+  {0x1E2, kMapped, 1, 198}, {0x1E3, kValid, 0, 0}, {0x1E4, kMapped, 1, 199}, {0x1E5, kValid, 0, 0},
+  {0x1E6, kMapped, 1, 200}, {0x1E7, kValid, 0, 0}, {0x1E8, kMapped, 1, 201}, {0x1E9, kValid, 0, 0},
+  {0x1EA, kMapped, 1, 202}, {0x1EB, kValid, 0, 0}, {0x1EC, kMapped, 1, 203}, {0x1ED, kValid, 0, 0},
+  {0x1EE, kMapped, 1, 204}, {0x1EF, kValid, 0, 0}, {0x1F1, kMapped, 2, 205}, {0x1F4, kMapped, 1, 207},
+  {0x1F5, kValid, 0, 0}, {0x1F6, kMapped, 1, 208}, {0x1F7, kMapped, 1, 209}, {0x1F8, kMapped, 1, 210},
+  {0x1F9, kValid, 0, 0}, {0x1FA, kMapped, 1, 211}, {0x1FB, kValid, 0, 0}, {0x1FC, kMapped, 1, 212},
+  {0x1FD, kValid, 0, 0}, {0x1FE, kMapped, 1, 213}, {0x1FF, kValid, 0, 0}, {0x200, kMapped, 1, 214},
+  {0x201, kValid, 0, 0}, {0x202, kMapped, 1, 215}, {0x203, kValid, 0, 0}, {0x204, kMapped, 1, 216},
+  {0x205, kValid, 0, 0}, {0x206, kMapped, 1, 217}, {0x207, kValid, 0, 0}, {0x208, kMapped, 1, 218},
+  {0x209, kValid, 0, 0}, {0x20A, kMapped, 1, 219}, {0x20B, kValid, 0, 0}, {0x20C, kMapped, 1, 220},
+  {0x20D, kValid, 0, 0}, {0x20E, kMapped, 1, 221}, {0x20F, kValid, 0, 0}, {0x210, kMapped, 1, 222},
+  {0x211, kValid, 0, 0}, {0x212, kMapped, 1, 223}, {0x213, kValid, 0, 0}, {0x214, kMapped, 1, 224},
+  {0x215, kValid, 0, 0}, {0x216, kMapped, 1, 225}, {0x217, kValid, 0, 0}, {0x218, kMapped, 1, 226},
+  {0x219, kValid, 0, 0}, {0x21A, kMapped, 1, 227}, {0x21B, kValid, 0, 0}, {0x21C, kMapped, 1, 228},
+  {0x21D, kValid, 0, 0}, {0x21E, kMapped, 1, 229}, {0x21F, kValid, 0, 0}, {0x220, kMapped, 1, 230},
+  {0x221, kValid, 0, 0}, {0x222, kMapped, 1, 231}, {0x223, kValid, 0, 0}, {0x224, kMapped, 1, 232},
+  {0x225, kValid, 0, 0}, {0x226, kMapped, 1, 233}, {0x227, kValid, 0, 0}, {0x228, kMapped, 1, 234},
+  {0x229, kValid, 0, 0}, {0x22A, kMapped, 1, 235}, {0x22B, kValid, 0, 0}, {0x22C, kMapped, 1, 236},
+  {0x22D, kValid, 0, 0}, {0x22E, kMapped, 1, 237}, {0x22F, kValid, 0, 0}, {0x230, kMapped, 1, 238},
+  {0x231, kValid, 0, 0}, {0x232, kMapped, 1, 239}, {0x233, kValid, 0, 0}, {0x23A, kMapped, 1, 240},
+  {0x23B, kMapped, 1, 241}, {0x23C, kValid, 0, 0}, {0x23D, kMapped, 1, 242}, {0x23E, kMapped, 1, 243},
+  {0x23F, kValid, 0, 0}, {0x241, kMapped, 1, 244}, {0x242, kValid, 0, 0}, {0x243, kMapped, 1, 245},
+  {0x244, kMapped, 1, 246}, {0x245, kMapped, 1, 247}, {0x246, kMapped, 1, 248}, {0x247, kValid, 0, 0},
+  {0x248, kMapped, 1, 249}, {0x249, kValid, 0, 0}, {0x24A, kMapped, 1, 250}, {0x24B, kValid, 0, 0},
+  {0x24C, kMapped, 1, 251}, {0x24D, kValid, 0, 0}, {0x24E, kMapped, 1, 252}, {0x24F, kValid, 0, 0},
+  {0x2B0, kMapped, 1, 7}, {0x2B1, kMapped, 1, 253}, {0x2B2, kMapped, 1, 9}, {0x2B3, kMapped, 1, 17},
+  {0x2B4, kMapped, 1, 254}, {0x2B5, kMapped, 1, 255}, {0x2B6, kMapped, 1, 256}, {0x2B7, kMapped, 1, 22},
+  {0x2B8, kMapped, 1, 24}, {0x2B9, kValid, 0, 0}, {0x2D8, kMapped, 2, 257}, {0x2D9, kMapped, 2, 259},
+  {0x2DA, kMapped, 2, 261}, {0x2DB, kMapped, 2, 263}, {0x2DC, kMapped, 2, 265}, {0x2DD, kMapped, 2, 267},
+  {0x2DE, kValid, 0, 0}, {0x2E0, kMapped, 1, 159}, {0x2E1, kMapped, 1, 11}, {0x2E2, kMapped, 1, 18},
+  {0x2E3, kMapped, 1, 23}, {0x2E4, kMapped, 1, 269}, {0x2E5, kValid, 0, 0}, {0x340, kMapped, 1, 270},
+  {0x341, kMapped, 1, 271}, {0x342, kValid, 0, 0}, {0x343, kMapped, 1, 272}, {0x344, kMapped, 2, 273},
+  {0x345, kMapped, 1, 275}, {0x346, kValid, 0, 0}, {0x34F, kMapped, 0, 0}, {0x350, kValid, 0, 0},
+  {0x370, kMapped, 1, 276}, {0x371, kValid, 0, 0}, {0x372, kMapped, 1, 277}, {0x373, kValid, 0, 0},
+  {0x374, kMapped, 1, 278}, {0x375, kValid, 0, 0}, {0x376, kMapped, 1, 279}, {0x377, kValid, 0, 0},
+  {0x378, kDisallowed, 0, 0}, {0x37A, kMapped, 2, 280}, {0x37B, kValid, 0, 0}, {0x37E, kMapped, 1, 282},
+  {0x37F, kMapped, 1, 283}, {0x380, kDisallowed, 0, 0}, {0x384, kMapped, 2, 33}, {0x385, kMapped, 3, 284},
+  {0x386, kMapped, 1, 287}, {0x387, kMapped, 1, 288}, {0x388, kMapped, 1, 289}, {0x389, kMapped, 1, 290},
+  {0x38A, kMapped, 1, 291}, {0x38B, kDisallowed, 0, 0}, {0x38C, kMapped, 1, 292}, {0x38D, kDisallowed, 0, 0},
+  {0x38E, kMapped, 1, 293}, {0x38F, kMapped, 1, 294}, {0x390, kValid, 0, 0}, {0x391, kMapped, 1, 295},
+  {0x392, kMapped, 1, 296}, {0x393, kMapped, 1, 297}, {0x394, kMapped, 1, 298}, {0x395, kMapped, 1, 299},
+  {0x396, kMapped, 1, 300}, {0x397, kMapped, 1, 301}, {0x398, kMapped, 1, 302}, {0x399, kMapped, 1, 275},
+  {0x39A, kMapped, 1, 303}, {0x39B, kMapped, 1, 304}, {0x39C, kMapped, 1, 35}, {0x39D, kMapped, 1, 305},
+  {0x39E, kMapped, 1, 306}, {0x39F, kMapped, 1, 307}, {0x3A0, kMapped, 1, 308}, {0x3A1, kMapped, 1, 309},
+  {0x3A2, kDisallowed, 0, 0}, {0x3A3, kMapped, 1, 310}, {0x3A4, kMapped, 1, 311}, {0x3A5, kMapped, 1, 312},
+  {0x3A6, kMapped, 1, 313}, {0x3A7, kMapped, 1, 314}, {0x3A8, kMapped, 1, 315}, {0x3A9, kMapped, 1, 316},
+  {0x3AA, kMapped, 1, 317}, {0x3AB, kMapped, 1, 318}, {0x3AC, kValid, 0, 0}, {0x3CF, kMapped, 1, 319},
+  {0x3D0, kMapped, 1, 296}, {0x3D1, kMapped, 1, 302}, {0x3D2, kMapped, 1, 312}, {0x3D3, kMapped, 1, 293},
+  {0x3D4, kMapped, 1, 318}, {0x3D5, kMapped, 1, 313}, {0x3D6, kMapped, 1, 308}, {0x3D7, kValid, 0, 0},
+  {0x3D8, kMapped, 1, 320}, {0x3D9, kValid, 0, 0}, {0x3DA, kMapped, 1, 321}, {0x3DB, kValid, 0, 0},
+  {0x3DC, kMapped, 1, 322}, {0x3DD, kValid, 0, 0}, {0x3DE, kMapped, 1, 323}, {0x3DF, kValid, 0, 0},
+  {0x3E0, kMapped, 1, 324}, {0x3E1, kValid, 0, 0}, {0x3E2, kMapped, 1, 325}, {0x3E3, kValid, 0, 0},
+  {0x3E4, kMapped, 1, 326}, {0x3E5, kValid, 0, 0}, {0x3E6, kMapped, 1, 327}, {0x3E7, kValid, 0, 0},
+  {0x3E8, kMapped, 1, 328}, {0x3E9, kValid, 0, 0}, {0x3EA, kMapped, 1, 329}, {0x3EB, kValid, 0, 0},
+  {0x3EC, kMapped, 1, 330}, {0x3ED, kValid, 0, 0}, {0x3EE, kMapped, 1, 331}, {0x3EF, kValid, 0, 0},
+  {0x3F0, kMapped, 1, 303}, {0x3F1, kMapped, 1, 309}, {0x3F2, kMapped, 1, 310}, {0x3F3, kValid, 0, 0},
+  {0x3F4, kMapped, 1, 302}, {0x3F5, kMapped, 1, 299}, {0x3F6, kValid, 0, 0}, {0x3F7, kMapped, 1, 332},
+  {0x3F8, kValid, 0, 0}, {0x3F9, kMapped, 1, 310}, {0x3FA, kMapped, 1, 333}, {0x3FB, kValid, 0, 0},
+  {0x3FD, kMapped, 1, 334}, {0x3FE, kMapped, 1, 335}, {0x3FF, kMapped, 1, 336}, {0x400, kMapped, 1, 337},
+  {0x401, kMapped, 1, 338}, {0x402, kMapped, 1, 339}, {0x403, kMapped, 1, 340}, {0x404, kMapped, 1, 341},
+  {0x405, kMapped, 1, 342}, {0x406, kMapped, 1, 343}, {0x407, kMapped, 1, 344}, {0x408, kMapped, 1, 345},
+  {0x409, kMapped, 1, 346}, {0x40A, kMapped, 1, 347}, {0x40B, kMapped, 1, 348}, {0x40C, kMapped, 1, 349},
+  {0x40D, kMapped, 1, 350}, {0x40E, kMapped, 1, 351}, {0x40F, kMapped, 1, 352}, {0x410, kMapped, 1, 353},
+  {0x411, kMapped, 1, 354}, {0x412, kMapped, 1, 355}, {0x413, kMapped, 1, 356}, {0x414, kMapped, 1, 357},
+  {0x415, kMapped, 1, 358}, {0x416, kMapped, 1, 359}, {0x417, kMapped, 1, 360}, {0x418, kMapped, 1, 361},
+  {0x419, kMapped, 1, 362}, {0x41A, kMapped, 1, 363}, {0x41B, kMapped, 1, 364}, {0x41C, kMapped, 1, 365},
+  {0x41D, kMapped, 1, 366}, {0x41E, kMapped, 1, 367}, {0x41F, kMapped, 1, 368}, {0x420, kMapped, 1, 369},
+  {0x421, kMapped, 1, 370}, {0x422, kMapped, 1, 371}, {0x423, kMapped, 1, 372}, {0x424, kMapped, 1, 373},
+  {0x425, kMapped, 1, 374}, {0x426, kMapped, 1, 375}, {0x427, kMapped, 1, 376}, {0x428, kMapped, 1, 377},
+  {0x429, kMapped, 1, 378}, {0x42A, kMapped, 1, 379}, {0x42B, kMapped, 1, 380}, {0x42C, kMapped, 1, 381},
+  {0x42D, kMapped, 1, 382}, {0x42E, kMapped, 1, 383}, {0x42F, kMapped, 1, 384}, {0x430, kValid, 0, 0},
+  {0x460, kMapped, 1, 385}, {0x461, kValid, 0, 0}, {0x462, kMapped, 1, 386}, {0x463, kValid, 0, 0},
+  {0x464, kMapped, 1, 387}, {0x465, kValid, 0, 0}, {0x466, kMapped, 1, 388}, {0x467, kValid, 0, 0},
+  {0x468, kMapped, 1, 389}, {0x469, kValid, 0, 0}, {0x46A, kMapped, 1, 390}, {0x46B, kValid, 0, 0},
+  {0x46C, kMapped, 1, 391}, {0x46D, kValid, 0, 0}, {0x46E, kMapped, 1, 392}, {0x46F, kValid, 0, 0},
+  {0x470, kMapped, 1, 393}, {0x471, kValid, 0, 0}, {0x472, kMapped, 1, 394}, {0x473, kValid, 0, 0},
+  {0x474, kMapped, 1, 395}, {0x475, kValid, 0, 0}, {0x476, kMapped, 1, 396}, {0x477, kValid, 0, 0},
+  {0x478, kMapped, 1, 397}, {0x479, kValid, 0, 0}, {0x47A, kMapped, 1, 398}, {0x47B, kValid, 0, 0},
+  {0x47C, kMapped, 1, 399}, {0x47D, kValid, 0, 0}, {0x47E, kMapped, 1, 400}, {0x47F, kValid, 0, 0},
+  {0x480, kMapped, 1, 401}, {0x481, kValid, 0, 0}, {0x48A, kMapped, 1, 402}, {0x48B, kValid, 0, 0},
+  {0x48C, kMapped, 1, 403}, {0x48D, kValid, 0, 0}, {0x48E, kMapped, 1, 404}, {0x48F, kValid, 0, 0},
+  {0x490, kMapped, 1, 405}, {0x491, kValid, 0, 0}, {0x492, kMapped, 1, 406}, {0x493, kValid, 0, 0},
+  {0x494, kMapped, 1, 407}, {0x495, kValid, 0, 0}, {0x496, kMapped, 1, 408}, {0x497, kValid, 0, 0},
+  {0x498, kMapped, 1, 409}, {0x499, kValid, 0, 0}, {0x49A, kMapped, 1, 410}, {0x49B, kValid, 0, 0},
+  {0x49C, kMapped, 1, 411}, {0x49D, kValid, 0, 0}, {0x49E, kMapped, 1, 412}, {0x49F, kValid, 0, 0},
+  {0x4A0, kMapped, 1, 413}, {0x4A1, kValid, 0, 0}, {0x4A2, kMapped, 1, 414}, {0x4A3, kValid, 0, 0},
+  {0x4A4, kMapped, 1, 415}, {0x4A5, kValid, 0, 0}, {0x4A6, kMapped, 1, 416}, {0x4A7, kValid, 0, 0},
+  {0x4A8, kMapped, 1, 417}, {0x4A9, kValid, 0, 0}, {0x4AA, kMapped, 1, 418}, {0x4AB, kValid, 0, 0},
+  {0x4AC, kMapped, 1, 419}, {0x4AD, kValid, 0, 0}, {0x4AE, kMapped, 1, 420}, {0x4AF, kValid, 0, 0},
+  {0x4B0, kMapped, 1, 421}, {0x4B1, kValid, 0, 0}, {0x4B2, kMapped, 1, 422}, {0x4B3, kValid, 0, 0},
+  {0x4B4, kMapped, 1, 423}, {0x4B5, kValid, 0, 0}, {0x4B6, kMapped, 1, 424}, {0x4B7, kValid, 0, 0},
+  {0x4B8, kMapped, 1, 425}, {0x4B9, kValid, 0, 0}, {0x4BA, kMapped, 1, 426}, {0x4BB, kValid, 0, 0},
+  {0x4BC, kMapped, 1, 427}, {0x4BD, kValid, 0, 0}, {0x4BE, kMapped, 1, 428}, {0x4BF, kValid, 0, 0},
+  {0x4C0, kDisallowed, 0, 0}, {0x4C1, kMapped, 1, 429}, {0x4C2, kValid, 0, 0}, {0x4C3, kMapped, 1, 430},
+  {0x4C4, kValid, 0, 0}, {0x4C5, kMapped, 1, 431}, {0x4C6, kValid, 0, 0}, {0x4C7, kMapped, 1, 432},
+  {0x4C8, kValid, 0, 0}, {0x4C9, kMapped, 1, 433}, {0x4CA, kValid, 0, 0}, {0x4CB, kMapped, 1, 434},
+  {0x4CC, kValid, 0, 0}, {0x4CD, kMapped, 1, 435}, {0x4CE, kValid, 0, 0}, {0x4D0, kMapped, 1, 436},
+  {0x4D1, kValid, 0, 0}, {0x4D2, kMapped, 1, 437}, {0x4D3, kValid, 0, 0}, {0x4D4, kMapped, 1, 438},
+  {0x4D5, kValid, 0, 0}, {0x4D6, kMapped, 1, 439}, {0x4D7, kValid, 0, 0}, {0x4D8, kMapped, 1, 440},
+  {0x4D9, kValid, 0, 0}, {0x4DA, kMapped, 1, 441}, {0x4DB, kValid, 0, 0}, {0x4DC, kMapped, 1, 442},
+  {0x4DD, kValid, 0, 0}, {0x4DE, kMapped, 1, 443}, {0x4DF, kValid, 0, 0}, {0x4E0, kMapped, 1, 444},
+  {0x4E1, kValid, 0, 0}, {0x4E2, kMapped, 1, 445}, {0x4E3, kValid, 0, 0}, {0x4E4, kMapped, 1, 446},
+  {0x4E5, kValid, 0, 0}, {0x4E6, kMapped, 1, 447}, {0x4E7, kValid, 0, 0}, {0x4E8, kMapped, 1, 448},
+  {0x4E9, kValid, 0, 0}, {0x4EA, kMapped, 1, 449}, {0x4EB, kValid, 0, 0}, {0x4EC, kMapped, 1, 450},
+  {0x4ED, kValid, 0, 0}, {0x4EE, kMapped, 1, 451}, {0x4EF, kValid, 0, 0}, {0x4F0, kMapped, 1, 452},
+  {0x4F1, kValid, 0, 0}, {0x4F2, kMapped, 1, 453}, {0x4F3, kValid, 0, 0}, {0x4F4, kMapped, 1, 454},
+  {0x4F5, kValid, 0, 0}, {0x4F6, kMapped, 1, 455}, {0x4F7, kValid, 0, 0}, {0x4F8, kMapped, 1, 456},
+  {0x4F9, kValid, 0, 0}, {0x4FA, kMapped, 1, 457}, {0x4FB, kValid, 0, 0}, {0x4FC, kMapped, 1, 458},
+  {0x4FD, kValid, 0, 0}, {0x4FE, kMapped, 1, 459}, {0x4FF, kValid, 0, 0}, {0x500, kMapped, 1, 460},
+  {0x501, kValid, 0, 0}, {0x502, kMapped, 1, 461}, {0x503, kValid, 0, 0}, {0x504, kMapped, 1, 462},
+  {0x505, kValid, 0, 0}, {0x506, kMapped, 1, 463}, {0x507, kValid, 0, 0}, {0x508, kMapped, 1, 464},
+  {0x509, kValid, 0, 0}, {0x50A, kMapped, 1, 465}, {0x50B, kValid, 0, 0}, {0x50C, kMapped, 1, 466},
+  {0x50D, kValid, 0, 0}, {0x50E, kMapped, 1, 467}, {0x50F, kValid, 0, 0}, {0x510, kMapped, 1, 468},
+  {0x511, kValid, 0, 0}, {0x512, kMapped, 1, 469}, {0x513, kValid, 0, 0}, {0x514, kMapped, 1, 470},
+  {0x515, kValid, 0, 0}, {0x516, kMapped, 1, 471}, {0x517, kValid, 0, 0}, {0x518, kMapped, 1, 472},
+  {0x519, kValid, 0, 0}, {0x51A, kMapped, 1, 473}, {0x51B, kValid, 0, 0}, {0x51C, kMapped, 1, 474},
+  {0x51D, kValid, 0, 0}, {0x51E, kMapped, 1, 475}, {0x51F, kValid, 0, 0}, {0x520, kMapped, 1, 476},
+  {0x521, kValid, 0, 0}, {0x522, kMapped, 1, 477}, {0x523, kValid, 0, 0}, {0x524, kMapped, 1, 478},
+  {0x525, kValid, 0, 0}, {0x526, kMapped, 1, 479}, {0x527, kValid, 0, 0}, {0x528, kMapped, 1, 480},
+  {0x529, kValid, 0, 0}, {0x52A, kMapped, 1, 481}, {0x52B, kValid, 0, 0}, {0x52C, kMapped, 1, 482},
+  {0x52D, kValid, 0, 0}, {0x52E, kMapped, 1, 483}, {0x52F, kValid, 0, 0}, {0x530, kDisallowed, 0, 0},
+  {0x531, kMapped, 1, 484}, {0x532, kMapped, 1, 485}, {0x533, kMapped, 1, 486}, {0x534, kMapped, 1, 487},
+  {0x535, kMapped, 1, 488}, {0x536, kMapped, 1, 489}, {0x537, kMapped, 1, 490}, {0x538, kMapped, 1, 491},
+  {0x539, kMapped, 1, 492}, {0x53A, kMapped, 1, 493}, {0x53B, kMapped, 1, 494}, {0x53C, kMapped, 1, 495},
+  {0x53D, kMapped, 1, 496}, {0x53E, kMapped, 1, 497}, {0x53F, kMapped, 1, 498}, {0x540, kMapped, 1, 499},
+  {0x541, kMapped, 1, 500}, {0x542, kMapped, 1, 501}, {0x543, kMapped, 1, 502}, {0x544, kMapped, 1, 503},
+  {0x545, kMapped, 1, 504}, {0x546, kMapped, 1, 505}, {0x547, kMapped, 1, 506}, {0x548, kMapped, 1, 507},
+  {0x549, kMapped, 1, 508}, {0x54A, kMapped, 1, 509}, {0x54B, kMapped, 1, 510}, {0x54C, kMapped, 1, 511},
+  {0x54D, kMapped, 1, 512}, {0x54E, kMapped, 1, 513}, {0x54F, kMapped, 1, 514}, {0x550, kMapped, 1, 515},
+  {0x551, kMapped, 1, 516}, {0x552, kMapped, 1, 517}, {0x553, kMapped, 1, 518}, {0x554, kMapped, 1, 519},
+  {0x555, kMapped, 1, 520}, {0x556, kMapped, 1, 521}, {0x557, kDisallowed, 0, 0}, {0x559, kValid, 0, 0},
+  {0x587, kMapped, 2, 522}, {0x588, kValid, 0, 0}, {0x58B, kDisallowed, 0, 0}, {0x58D, kValid, 0, 0},
+  {0x590, kDisallowed, 0, 0}, {0x591, kValid, 0, 0}, {0x5C8, kDisallowed, 0, 0}, {0x5D0, kValid, 0, 0},
+  {0x5EB, kDisallowed, 0, 0}, {0x5EF, kValid, 0, 0}, {0x5F5, kDisallowed, 0, 0}, {0x606, kValid, 0, 0},
+  {0x61C, kDisallowed, 0, 0}, {0x61D, kValid, 0, 0}, {0x675, kMapped, 2, 524}, {0x676, kMapped, 2, 526},
+  {0x677, kMapped, 2, 528}, {0x678, kMapped, 2, 530}, {0x679, kValid, 0, 0}, {0x6DD, kDisallowed, 0, 0},
+  {0x6DE, kValid, 0, 0}, {0x70E, kDisallowed, 0, 0}, {0x710, kValid, 0, 0}, {0x74B, kDisallowed, 0, 0},
+  {0x74D, kValid, 0, 0}, {0x7B2, kDisallowed, 0, 0}, {0x7C0, kValid, 0, 0}, {0x7FB, kDisallowed, 0, 0},
+  {0x7FD, kValid, 0, 0}, {0x82E, kDisallowed, 0, 0}, {0x830, kValid, 0, 0}, {0x83F, kDisallowed, 0, 0},
+  {0x840, kValid, 0, 0}, {0x85C, kDisallowed, 0, 0}, {0x85E, kValid, 0, 0}, {0x85F, kDisallowed, 0, 0},
+  {0x860, kValid, 0, 0}, {0x86B, kDisallowed, 0, 0}, {0x870, kValid, 0, 0}, {0x88F, kDisallowed, 0, 0},
+  {0x898, kValid, 0, 0}, {0x8E2, kDisallowed, 0, 0}, {0x8E3, kValid, 0, 0}, {0x958, kMapped, 2, 532},
+  {0x959, kMapped, 2, 534}, {0x95A, kMapped, 2, 536}, {0x95B, kMapped, 2, 538}, {0x95C, kMapped, 2, 540},
+  {0x95D, kMapped, 2, 542}, {0x95E, kMapped, 2, 544}, {0x95F, kMapped, 2, 546}, {0x960, kValid, 0, 0},
+  {0x984, kDisallowed, 0, 0}, {0x985, kValid, 0, 0}, {0x98D, kDisallowed, 0, 0}, {0x98F, kValid, 0, 0},
+  {0x991, kDisallowed, 0, 0}, {0x993, kValid, 0, 0}, {0x9A9, kDisallowed, 0, 0}, {0x9AA, kValid, 0, 0},
+  {0x9B1, kDisallowed, 0, 0}, {0x9B2, kValid, 0, 0}, {0x9B3, kDisallowed, 0, 0}, {0x9B6, kValid, 0, 0},
+  {0x9BA, kDisallowed, 0, 0}, {0x9BC, kValid, 0, 0}, {0x9C5, kDisallowed, 0, 0}, {0x9C7, kValid, 0, 0},
+  {0x9C9, kDisallowed, 0, 0}, {0x9CB, kValid, 0, 0}, {0x9CF, kDisallowed, 0, 0}, {0x9D7, kValid, 0, 0},
+  {0x9D8, kDisallowed, 0, 0}, {0x9DC, kMapped, 2, 548}, {0x9DD, kMapped, 2, 550}, {0x9DE, kDisallowed, 0, 0},
+  {0x9DF, kMapped, 2, 552}, {0x9E0, kValid, 0, 0}, {0x9E4, kDisallowed, 0, 0}, {0x9E6, kValid, 0, 0},
+  {0x9FF, kDisallowed, 0, 0}, {0xA01, kValid, 0, 0}, {0xA04, kDisallowed, 0, 0}, {0xA05, kValid, 0, 0},
+  {0xA0B, kDisallowed, 0, 0}, {0xA0F, kValid, 0, 0}, {0xA11, kDisallowed, 0, 0}, {0xA13, kValid, 0, 0},
+  {0xA29, kDisallowed, 0, 0}, {0xA2A, kValid, 0, 0}, {0xA31, kDisallowed, 0, 0}, {0xA32, kValid, 0, 0},
+  {0xA33, kMapped, 2, 554}, {0xA34, kDisallowed, 0, 0}, {0xA35, kValid, 0, 0}, {0xA36, kMapped, 2, 556},
+  {0xA37, kDisallowed, 0, 0}, {0xA38, kValid, 0, 0}, {0xA3A, kDisallowed, 0, 0}, {0xA3C, kValid, 0, 0},
+  {0xA3D, kDisallowed, 0, 0}, {0xA3E, kValid, 0, 0}, {0xA43, kDisallowed, 0, 0}, {0xA47, kValid, 0, 0},
+  {0xA49, kDisallowed, 0, 0}, {0xA4B, kValid, 0, 0}, {0xA4E, kDisallowed, 0, 0}, {0xA51, kValid, 0, 0},
+  {0xA52, kDisallowed, 0, 0}, {0xA59, kMapped, 2, 558}, {0xA5A, kMapped, 2, 560}, {0xA5B, kMapped, 2, 562},
+  {0xA5C, kValid, 0, 0}, {0xA5D, kDisallowed, 0, 0}, {0xA5E, kMapped, 2, 564}, {0xA5F, kDisallowed, 0, 0},
+  {0xA66, kValid, 0, 0}, {0xA77, kDisallowed, 0, 0}, {0xA81, kValid, 0, 0}, {0xA84, kDisallowed, 0, 0},
+  {0xA85, kValid, 0, 0}, {0xA8E, kDisallowed, 0, 0}, {0xA8F, kValid, 0, 0}, {0xA92, kDisallowed, 0, 0},
+  {0xA93, kValid, 0, 0}, {0xAA9, kDisallowed, 0, 0}, {0xAAA, kValid, 0, 0}, {0xAB1, kDisallowed, 0, 0},
+  {0xAB2, kValid, 0, 0}, {0xAB4, kDisallowed, 0, 0}, {0xAB5, kValid, 0, 0}, {0xABA, kDisallowed, 0, 0},
+  {0xABC, kValid, 0, 0}, {0xAC6, kDisallowed, 0, 0}, {0xAC7, kValid, 0, 0}, {0xACA, kDisallowed, 0, 0},
+  {0xACB, kValid, 0, 0}, {0xACE, kDisallowed, 0, 0}, {0xAD0, kValid, 0, 0}, {0xAD1, kDisallowed, 0, 0},
+  {0xAE0, kValid, 0, 0}, {0xAE4, kDisallowed, 0, 0}, {0xAE6, kValid, 0, 0}, {0xAF2, kDisallowed, 0, 0},
+  {0xAF9, kValid, 0, 0}, {0xB00, kDisallowed, 0, 0}, {0xB01, kValid, 0, 0}, {0xB04, kDisallowed, 0, 0},
+  {0xB05, kValid, 0, 0}, {0xB0D, kDisallowed, 0, 0}, {0xB0F, kValid, 0, 0}, {0xB11, kDisallowed, 0, 0},
+  {0xB13, kValid, 0, 0}, {0xB29, kDisallowed, 0, 0}, {0xB2A, kValid, 0, 0}, {0xB31, kDisallowed, 0, 0},
+  {0xB32, kValid, 0, 0}, {0xB34, kDisallowed, 0, 0}, {0xB35, kValid, 0, 0}, {0xB3A, kDisallowed, 0, 0},
+  {0xB3C, kValid, 0, 0}, {0xB45, kDisallowed, 0, 0}, {0xB47, kValid, 0, 0}, {0xB49, kDisallowed, 0, 0},
+  {0xB4B, kValid, 0, 0}, {0xB4E, kDisallowed, 0, 0}, {0xB55, kValid, 0, 0}, {0xB58, kDisallowed, 0, 0},
+  {0xB5C, kMapped, 2, 566}, {0xB5D, kMapped, 2, 568}, {0xB5E, kDisallowed, 0, 0}, {0xB5F, kValid, 0, 0},
+  {0xB64, kDisallowed, 0, 0}, {0xB66, kValid, 0, 0}, {0xB78, kDisallowed, 0, 0}, {0xB82, kValid, 0, 0},
+  {0xB84, kDisallowed, 0, 0}, {0xB85, kValid, 0, 0}, {0xB8B, kDisallowed, 0, 0}, {0xB8E, kValid, 0, 0},
+  {0xB91, kDisallowed, 0, 0}, {0xB92, kValid, 0, 0}, {0xB96, kDisallowed, 0, 0}, {0xB99, kValid, 0, 0},
+  {0xB9B, kDisallowed, 0, 0}, {0xB9C, kValid, 0, 0}, {0xB9D, kDisallowed, 0, 0}, {0xB9E, kValid, 0, 0},
+  {0xBA0, kDisallowed, 0, 0}, {0xBA3, kValid, 0, 0}, {0xBA5, kDisallowed, 0, 0}, {0xBA8, kValid, 0, 0},
+  {0xBAB, kDisallowed, 0, 0}, {0xBAE, kValid, 0, 0}, {0xBBA, kDisallowed, 0, 0}, {0xBBE, kValid, 0, 0},
+  {0xBC3, kDisallowed, 0, 0}, {0xBC6, kValid, 0, 0}, {0xBC9, kDisallowed, 0, 0}, {0xBCA, kValid, 0, 0},
+  {0xBCE, kDisallowed, 0, 0}, {0xBD0, kValid, 0, 0}, {0xBD1, kDisallowed, 0, 0}, {0xBD7, kValid, 0, 0},
+  {0xBD8, kDisallowed, 0, 0}, {0xBE6, kValid, 0, 0}, {0xBFB, kDisallowed, 0, 0}, {0xC00, kValid, 0, 0},
+  {0xC0D, kDisallowed, 0, 0}, {0xC0E, kValid, 0, 0}, {0xC11, kDisallowed, 0, 0}, {0xC12, kValid, 0, 0},
+  {0xC29, kDisallowed, 0, 0}, {0xC2A, kValid, 0, 0}, {0xC3A, kDisallowed, 0, 0}, {0xC3C, kValid, 0, 0},
+  {0xC45, kDisallowed, 0, 0}, {0xC46, kValid, 0, 0}, {0xC49, kDisallowed, 0, 0}, {0xC4A, kValid, 0, 0},
+  {0xC4E, kDisallowed, 0, 0}, {0xC55, kValid, 0, 0}, {0xC57, kDisallowed, 0, 0}, {0xC58, kValid, 0, 0},
+  {0xC5B, kDisallowed, 0, 0}, {0xC5D, kValid, 0, 0}, {0xC5E, kDisallowed, 0, 0}, {0xC60, kValid, 0, 0},
+  {0xC64, kDisallowed, 0, 0}, {0xC66, kValid, 0, 0}, {0xC70, kDisallowed, 0, 0}, {0xC77, kValid, 0, 0},
+  {0xC8D, kDisallowed, 0, 0}, {0xC8E, kValid, 0, 0}, {0xC91, kDisallowed, 0, 0}, {0xC92, kValid, 0, 0},
+  {0xCA9, kDisallowed, 0, 0}, {0xCAA, kValid, 0, 0}, {0xCB4, kDisallowed, 0, 0}, {0xCB5, kValid, 0, 0},
+  {0xCBA, kDisallowed, 0, 0}, {0xCBC, kValid, 0, 0}, {0xCC5, kDisallowed, 0, 0}, {0xCC6, kValid, 0, 0},
+  {0xCC9, kDisallowed, 0, 0}, {0xCCA, kValid, 0, 0}, {0xCCE, kDisallowed, 0, 0}, {0xCD5, kValid, 0, 0},
+  {0xCD7, kDisallowed, 0, 0}, {0xCDD, kValid, 0, 0}, {0xCDF, kDisallowed, 0, 0}, {0xCE0, kValid, 0, 0},
+  {0xCE4, kDisallowed, 0, 0}, {0xCE6, kValid, 0, 0}, {0xCF0, kDisallowed, 0, 0}, {0xCF1, kValid, 0, 0},
+  {0xCF4, kDisallowed, 0, 0}, {0xD00, kValid, 0, 0}, {0xD0D, kDisallowed, 0, 0}, {0xD0E, kValid, 0, 0},
+  {0xD11, kDisallowed, 0, 0}, {0xD12, kValid, 0, 0}, {0xD45, kDisallowed, 0, 0}, {0xD46, kValid, 0, 0},
+  {0xD49, kDisallowed, 0, 0}, {0xD4A, kValid, 0, 0}, {0xD50, kDisallowed, 0, 0}, {0xD54, kValid, 0, 0},
+  {0xD64, kDisallowed, 0, 0}, {0xD66, kValid, 0, 0}, {0xD80, kDisallowed, 0, 0}, {0xD81, kValid, 0, 0},
+  {0xD84, kDisallowed, 0, 0}, {0xD85, kValid, 0, 0}, {0xD97, kDisallowed, 0, 0}, {0xD9A, kValid, 0, 0},
+  {0xDB2, kDisallowed, 0, 0}, {0xDB3, kValid, 0, 0}, {0xDBC, kDisallowed, 0, 0}, {0xDBD, kValid, 0, 0},
+  {0xDBE, kDisallowed, 0, 0}, {0xDC0, kValid, 0, 0}, {0xDC7, kDisallowed, 0, 0}, {0xDCA, kValid, 0, 0},
+  {0xDCB, kDisallowed, 0, 0}, {0xDCF, kValid, 0, 0}, {0xDD5, kDisallowed, 0, 0}, {0xDD6, kValid, 0, 0},
+  {0xDD7, kDisallowed, 0, 0}, {0xDD8, kValid, 0, 0}, {0xDE0, kDisallowed, 0, 0}, {0xDE6, kValid, 0, 0},
+  {0xDF0, kDisallowed, 0, 0}, {0xDF2, kValid, 0, 0}, {0xDF5, kDisallowed, 0, 0}, {0xE01, kValid, 0, 0},
+  {0xE33, kMapped, 2, 570}, {0xE34, kValid, 0, 0}, {0xE3B, kDisallowed, 0, 0}, {0xE3F, kValid, 0, 0},
+  {0xE5C, kDisallowed, 0, 0}, {0xE81, kValid, 0, 0}, {0xE83, kDisallowed, 0, 0}, {0xE84, kValid, 0, 0},
+  {0xE85, kDisallowed, 0, 0}, {0xE86, kValid, 0, 0}, {0xE8B, kDisallowed, 0, 0}, {0xE8C, kValid, 0, 0},
+  {0xEA4, kDisallowed, 0, 0}, {0xEA5, kValid, 0, 0}, {0xEA6, kDisallowed, 0, 0}, {0xEA7, kValid, 0, 0},
+  {0xEB3, kMapped, 2, 572}, {0xEB4, kValid, 0, 0}, {0xEBE, kDisallowed, 0, 0}, {0xEC0, kValid, 0, 0},
+  {0xEC5, kDisallowed, 0, 0}, {0xEC6, kValid, 0, 0}, {0xEC7, kDisallowed, 0, 0}, {0xEC8, kValid, 0, 0},
+  {0xECF, kDisallowed, 0, 0}, {0xED0, kValid, 0, 0}, {0xEDA, kDisallowed, 0, 0}, {0xEDC, kMapped, 2, 574},
+  {0xEDD, kMapped, 2, 576}, {0xEDE, kValid, 0, 0}, {0xEE0, kDisallowed, 0, 0}, {0xF00, kValid, 0, 0},
+  {0xF0C, kMapped, 1, 578}, {0xF0D, kValid, 0, 0}, {0xF43, kMapped, 2, 579}, {0xF44, kValid, 0, 0},
+  {0xF48, kDisallowed, 0, 0}, {0xF49, kValid, 0, 0}, {0xF4D, kMapped, 2, 581}, {0xF4E, kValid, 0, 0},
+  {0xF52, kMapped, 2, 583}, {0xF53, kValid, 0, 0}, {0xF57, kMapped, 2, 585}, {0xF58, kValid, 0, 0},
+  {0xF5C, kMapped, 2, 587}, {0xF5D, kValid, 0, 0}, {0xF69, kMapped, 2, 589}, {0xF6A, kValid, 0, 0},
+  {0xF6D, kDisallowed, 0, 0}, {0xF71, kValid, 0, 0}, {0xF73, kMapped, 2, 591}, {0xF74, kValid, 0, 0},
+  {0xF75, kMapped, 2, 593}, {0xF76, kMapped, 2, 595}, {0xF77, kMapped, 3, 597}, {0xF78, kMapped, 2, 600},
+  {0xF79, kMapped, 3, 602}, {0xF7A, kValid, 0, 0}, {0xF81, kMapped, 2, 605}, {0xF82, kValid, 0, 0},
+  {0xF93, kMapped, 2, 607}, {0xF94, kValid, 0, 0}, {0xF98, kDisallowed, 0, 0}, {0xF99, kValid, 0, 0},
+  {0xF9D, kMapped, 2, 609}, {0xF9E, kValid, 0, 0}, {0xFA2, kMapped, 2, 611}, {0xFA3, kValid, 0, 0},
+  {0xFA7, kMapped, 2, 613}, {0xFA8, kValid, 0, 0}, {0xFAC, kMapped, 2, 615}, {0xFAD, kValid, 0, 0},
+  {0xFB9, kMapped, 2, 617}, {0xFBA, kValid, 0, 0}, {0xFBD, kDisallowed, 0, 0}, {0xFBE, kValid, 0, 0},
+  {0xFCD, kDisallowed, 0, 0}, {0xFCE, kValid, 0, 0}, {0xFDB, kDisallowed, 0, 0}, {0x1000, kValid, 0, 0},
+  {0x10A0, kDisallowed, 0, 0}, {0x10C7, kMapped, 1, 619}, {0x10C8, kDisallowed, 0, 0}, {0x10CD, kMapped, 1, 620},
+  {0x10CE, kDisallowed, 0, 0}, {0x10D0, kValid, 0, 0}, {0x10FC, kMapped, 1, 621}, {0x10FD, kValid, 0, 0},
+  {0x115F, kDisallowed, 0, 0}, {0x1161, kValid, 0, 0}, {0x1249, kDisallowed, 0, 0}, {0x124A, kValid, 0, 0},
+  {0x124E, kDisallowed, 0, 0}, {0x1250, kValid, 0, 0}, {0x1257, kDisallowed, 0, 0}, {0x1258, kValid, 0, 0},
+  {0x1259, kDisallowed, 0, 0}, {0x125A, kValid, 0, 0}, {0x125E, kDisallowed, 0, 0}, {0x1260, kValid, 0, 0},
+  {0x1289, kDisallowed, 0, 0}, {0x128A, kValid, 0, 0}, {0x128E, kDisallowed, 0, 0}, {0x1290, kValid, 0, 0},
+  {0x12B1, kDisallowed, 0, 0}, {0x12B2, kValid, 0, 0}, {0x12B6, kDisallowed, 0, 0}, {0x12B8, kValid, 0, 0},
+  {0x12BF, kDisallowed, 0, 0}, {0x12C0, kValid, 0, 0}, {0x12C1, kDisallowed, 0, 0}, {0x12C2, kValid, 0, 0},
+  {0x12C6, kDisallowed, 0, 0}, {0x12C8, kValid, 0, 0}, {0x12D7, kDisallowed, 0, 0}, {0x12D8, kValid, 0, 0},
+  {0x1311, kDisallowed, 0, 0}, {0x1312, kValid, 0, 0}, {0x1316, kDisallowed, 0, 0}, {0x1318, kValid, 0, 0},
+  {0x135B, kDisallowed, 0, 0}, {0x135D, kValid, 0, 0}, {0x137D, kDisallowed, 0, 0}, {0x1380, kValid, 0, 0},
+  {0x139A, kDisallowed, 0, 0}, {0x13A0, kValid, 0, 0}, {0x13F6, kDisallowed, 0, 0}, {0x13F8, kMapped, 1, 622},
+  {0x13F9, kMapped, 1, 623}, {0x13FA, kMapped, 1, 624}, {0x13FB, kMapped, 1, 625}, {0x13FC, kMapped, 1, 626},
+  {0x13FD, kMapped, 1, 627}, {0x13FE, kDisallowed, 0, 0}, {0x1400, kValid, 0, 0}, {0x1680, kDisallowed, 0, 0},
+  {0x1681, kValid, 0, 0}, {0x169D, kDisallowed, 0, 0}, {0x16A0, kValid, 0, 0}, {0x16F9, kDisallowed, 0, 0},
+  {0x1700, kValid, 0, 0}, {0x1716, kDisallowed, 0, 0}, {0x171F, kValid, 0, 0}, {0x1737, kDisallowed, 0, 0},
+  {0x1740, kValid, 0, 0}, {0x1754, kDisallowed, 0, 0}, {0x1760, kValid, 0, 0}, {0x176D, kDisallowed, 0, 0},
+  {0x176E, kValid, 0, 0}, {0x1771, kDisallowed, 0, 0}, {0x1772, kValid, 0, 0}, {0x1774, kDisallowed, 0, 0},
+  {0x1780, kValid, 0, 0}, {0x17B4, kDisallowed, 0, 0}, {0x17B6, kValid, 0, 0}, {0x17DE, kDisallowed, 0, 0},
+  {0x17E0, kValid, 0, 0}, {0x17EA, kDisallowed, 0, 0}, {0x17F0, kValid, 0, 0}, {0x17FA, kDisallowed, 0, 0},
+  {0x1800, kValid, 0, 0}, {0x1806, kDisallowed, 0, 0}, {0x1807, kValid, 0, 0}, {0x180B, kMapped, 0, 0},
+  {0x180E, kDisallowed, 0, 0}, {0x180F, kMapped, 0, 0}, {0x1810, kValid, 0, 0}, {0x181A, kDisallowed, 0, 0},
+  {0x1820, kValid, 0, 0}, {0x1879, kDisallowed, 0, 0}, {0x1880, kValid, 0, 0}, {0x18AB, kDisallowed, 0, 0},
+  {0x18B0, kValid, 0, 0}, {0x18F6, kDisallowed, 0, 0}, {0x1900, kValid, 0, 0}, {0x191F, kDisallowed, 0, 0},
+  {0x1920, kValid, 0, 0}, {0x192C, kDisallowed, 0, 0}, {0x1930, kValid, 0, 0}, {0x193C, kDisallowed, 0, 0},
+  {0x1940, kValid, 0, 0}, {0x1941, kDisallowed, 0, 0}, {0x1944, kValid, 0, 0}, {0x196E, kDisallowed, 0, 0},
+  {0x1970, kValid, 0, 0}, {0x1975, kDisallowed, 0, 0}, {0x1980, kValid, 0, 0}, {0x19AC, kDisallowed, 0, 0},
+  {0x19B0, kValid, 0, 0}, {0x19CA, kDisallowed, 0, 0}, {0x19D0, kValid, 0, 0}, {0x19DB, kDisallowed, 0, 0},
+  {0x19DE, kValid, 0, 0}, {0x1A1C, kDisallowed, 0, 0}, {0x1A1E, kValid, 0, 0}, {0x1A5F, kDisallowed, 0, 0},
+  {0x1A60, kValid, 0, 0}, {0x1A7D, kDisallowed, 0, 0}, {0x1A7F, kValid, 0, 0}, {0x1A8A, kDisallowed, 0, 0},
+  {0x1A90, kValid, 0, 0}, {0x1A9A, kDisallowed, 0, 0}, {0x1AA0, kValid, 0, 0}, {0x1AAE, kDisallowed, 0, 0},
+  {0x1AB0, kValid, 0, 0}, {0x1ACF, kDisallowed, 0, 0}, {0x1B00, kValid, 0, 0}, {0x1B4D, kDisallowed, 0, 0},
+  {0x1B50, kValid, 0, 0}, {0x1B7F, kDisallowed, 0, 0}, {0x1B80, kValid, 0, 0}, {0x1BF4, kDisallowed, 0, 0},
+  {0x1BFC, kValid, 0, 0}, {0x1C38, kDisallowed, 0, 0}, {0x1C3B, kValid, 0, 0}, {0x1C4A, kDisallowed, 0, 0},
+  {0x1C4D, kValid, 0, 0}, {0x1C80, kMapped, 1, 355}, {0x1C81, kMapped, 1, 357}, {0x1C82, kMapped, 1, 367},
+  {0x1C83, kMapped, 1, 370}, {0x1C84, kMapped, 1, 371}, {0x1C86, kMapped, 1, 379}, {0x1C87, kMapped, 1, 386},
+  {0x1C88, kMapped, 1, 628}, {0x1C89, kDisallowed, 0, 0}, {0x1C90, kMapped, 1, 629}, {0x1C91, kMapped, 1, 630},
+  {0x1C92, kMapped, 1, 631}, {0x1C93, kMapped, 1, 632}, {0x1C94, kMapped, 1, 633}, {0x1C95, kMapped, 1, 634},
+  {0x1C96, kMapped, 1, 635}, {0x1C97, kMapped, 1, 636}, {0x1C98, kMapped, 1, 637}, {0x1C99, kMapped, 1, 638},
+  {0x1C9A, kMapped, 1, 639}, {0x1C9B, kMapped, 1, 640}, {0x1C9C, kMapped, 1, 621}, {0x1C9D, kMapped, 1, 641},
+  {0x1C9E, kMapped, 1, 642}, {0x1C9F, kMapped, 1, 643}, {0x1CA0, kMapped, 1, 644}, {0x1CA1, kMapped, 1, 645},
+  {0x1CA2, kMapped, 1, 646}, {0x1CA3, kMapped, 1, 647}, {0x1CA4, kMapped, 1, 648}, {0x1CA5, kMapped, 1, 649},
+  {0x1CA6, kMapped, 1, 650}, {0x1CA7, kMapped, 1, 651}, {0x1CA8, kMapped, 1, 652}, {0x1CA9, kMapped, 1, 653},
+  {0x1CAA, kMapped, 1, 654}, {0x1CAB, kMapped, 1, 655}, {0x1CAC, kMapped, 1, 656}, {0x1CAD, kMapped, 1, 657},
+  {0x1CAE, kMapped, 1, 658}, {0x1CAF, kMapped, 1, 659}, {0x1CB0, kMapped, 1, 660}, {0x1CB1, kMapped, 1, 661},
+  {0x1CB2, kMapped, 1, 662}, {0x1CB3, kMapped, 1, 663}, {0x1CB4, kMapped, 1, 664}, {0x1CB5, kMapped, 1, 665},
+  {0x1CB6, kMapped, 1, 666}, {0x1CB7, kMapped, 1, 667}, {0x1CB8, kMapped, 1, 668}, {0x1CB9, kMapped, 1, 669},
+  {0x1CBA, kMapped, 1, 670}, {0x1CBB, kDisallowed, 0, 0}, {0x1CBD, kMapped, 1, 671}, {0x1CBE, kMapped, 1, 672},
+  {0x1CBF, kMapped, 1, 673}, {0x1CC0, kValid, 0, 0}, {0x1CC8, kDisallowed, 0, 0}, {0x1CD0, kValid, 0, 0},
+  {0x1CFB, kDisallowed, 0, 0}, {0x1D00, kValid, 0, 0}, {0x1D2C, kMapped, 1, 0}, {0x1D2D, kMapped, 1, 54},
+  {0x1D2E, kMapped, 1, 1}, {0x1D2F, kValid, 0, 0}, {0x1D30, kMapped, 1, 3}, {0x1D31, kMapped, 1, 4},
+  {0x1D32, kMapped, 1, 154}, {0x1D33, kMapped, 1, 6}, {0x1D34, kMapped, 1, 7}, {0x1D35, kMapped, 1, 8},
+  {0x1D36, kMapped, 1, 9}, {0x1D37, kMapped, 1, 10}, {0x1D38, kMapped, 1, 11}, {0x1D39, kMapped, 1, 12},
+  {0x1D3A, kMapped, 1, 13}, {0x1D3B, kValid, 0, 0}, {0x1D3C, kMapped, 1, 14}, {0x1D3D, kMapped, 1, 231},
+  {0x1D3E, kMapped, 1, 15}, {0x1D3F, kMapped, 1, 17}, {0x1D40, kMapped, 1, 19}, {0x1D41, kMapped, 1, 20},
+  {0x1D42, kMapped, 1, 22}, {0x1D43, kMapped, 1, 0}, {0x1D44, kMapped, 1, 674}, {0x1D45, kMapped, 1, 675},
+  {0x1D46, kMapped, 1, 676}, {0x1D47, kMapped, 1, 1}, {0x1D48, kMapped, 1, 3}, {0x1D49, kMapped, 1, 4},
+  {0x1D4A, kMapped, 1, 155}, {0x1D4B, kMapped, 1, 156}, {0x1D4C, kMapped, 1, 677}, {0x1D4D, kMapped, 1, 6},
+  {0x1D4E, kValid, 0, 0}, {0x1D4F, kMapped, 1, 10}, {0x1D50, kMapped, 1, 12}, {0x1D51, kMapped, 1, 119},
+  {0x1D52, kMapped, 1, 14}, {0x1D53, kMapped, 1, 149}, {0x1D54, kMapped, 1, 678}, {0x1D55, kMapped, 1, 679},
+  {0x1D56, kMapped, 1, 15}, {0x1D57, kMapped, 1, 19}, {0x1D58, kMapped, 1, 20}, {0x1D59, kMapped, 1, 680},
+  {0x1D5A, kMapped, 1, 163}, {0x1D5B, kMapped, 1, 21}, {0x1D5C, kMapped, 1, 681}, {0x1D5D, kMapped, 1, 296},
+  {0x1D5E, kMapped, 1, 297}, {0x1D5F, kMapped, 1, 298}, {0x1D60, kMapped, 1, 313}, {0x1D61, kMapped, 1, 314},
+  {0x1D62, kMapped, 1, 8}, {0x1D63, kMapped, 1, 17}, {0x1D64, kMapped, 1, 20}, {0x1D65, kMapped, 1, 21},
+  {0x1D66, kMapped, 1, 296}, {0x1D67, kMapped, 1, 297}, {0x1D68, kMapped, 1, 309}, {0x1D69, kMapped, 1, 313},
+  {0x1D6A, kMapped, 1, 314}, {0x1D6B, kValid, 0, 0}, {0x1D78, kMapped, 1, 366}, {0x1D79, kValid, 0, 0},
+  {0x1D9B, kMapped, 1, 682}, {0x1D9C, kMapped, 1, 2}, {0x1D9D, kMapped, 1, 683}, {0x1D9E, kMapped, 1, 64},
+  {0x1D9F, kMapped, 1, 677}, {0x1DA0, kMapped, 1, 5}, {0x1DA1, kMapped, 1, 684}, {0x1DA2, kMapped, 1, 685},
+  {0x1DA3, kMapped, 1, 686}, {0x1DA4, kMapped, 1, 161}, {0x1DA5, kMapped, 1, 160}, {0x1DA6, kMapped, 1, 687},
+  {0x1DA7, kMapped, 1, 688}, {0x1DA8, kMapped, 1, 689}, {0x1DA9, kMapped, 1, 690}, {0x1DAA, kMapped, 1, 691},
+  {0x1DAB, kMapped, 1, 692}, {0x1DAC, kMapped, 1, 693}, {0x1DAD, kMapped, 1, 694}, {0x1DAE, kMapped, 1, 164},
+  {0x1DAF, kMapped, 1, 695}, {0x1DB0, kMapped, 1, 696}, {0x1DB1, kMapped, 1, 165}, {0x1DB2, kMapped, 1, 697},
+  {0x1DB3, kMapped, 1, 698}, {0x1DB4, kMapped, 1, 171}, {0x1DB5, kMapped, 1, 699}, {0x1DB6, kMapped, 1, 246},
+  {0x1DB7, kMapped, 1, 175}, {0x1DB8, kMapped, 1, 700}, {0x1DB9, kMapped, 1, 176}, {0x1DBA, kMapped, 1, 247},
+  {0x1DBB, kMapped, 1, 25}, {0x1DBC, kMapped, 1, 701}, {0x1DBD, kMapped, 1, 702}, {0x1DBE, kMapped, 1, 179},
+  {0x1DBF, kMapped, 1, 302}, {0x1DC0, kValid, 0, 0}, {0x1E00, kMapped, 1, 703}, {0x1E01, kValid, 0, 0},
+  {0x1E02, kMapped, 1, 704}, {0x1E03, kValid, 0, 0}, {0x1E04, kMapped, 1, 705}, {0x1E05, kValid, 0, 0},
+  {0x1E06, kMapped, 1, 706}, {0x1E07, kValid, 0, 0}, {0x1E08, kMapped, 1, 707}, {0x1E09, kValid, 0, 0},
+  {0x1E0A, kMapped, 1, 708}, {0x1E0B, kValid, 0, 0}, {0x1E0C, kMapped, 1, 709}, {0x1E0D, kValid, 0, 0},
+  {0x1E0E, kMapped, 1, 710}, {0x1E0F, kValid, 0, 0}, {0x1E10, kMapped, 1, 711}, {0x1E11, kValid, 0, 0},
+  {0x1E12, kMapped, 1, 712}, {0x1E13, kValid, 0, 0}, {0x1E14, kMapped, 1, 713}, {0x1E15, kValid, 0, 0},
+  {0x1E16, kMapped, 1, 714}, {0x1E17, kValid, 0, 0}, {0x1E18, kMapped, 1, 715}, {0x1E19, kValid, 0, 0},
+  {0x1E1A, kMapped, 1, 716}, {0x1E1B, kValid, 0, 0}, {0x1E1C, kMapped, 1, 717}, {0x1E1D, kValid, 0, 0},
+  {0x1E1E, kMapped, 1, 718}, {0x1E1F, kValid, 0, 0}, {0x1E20, kMapped, 1, 719}, {0x1E21, kValid, 0, 0},
+  {0x1E22, kMapped, 1, 720}, {0x1E23, kValid, 0, 0}, {0x1E24, kMapped, 1, 721}, {0x1E25, kValid, 0, 0},
+  {0x1E26, kMapped, 1, 722}, {0x1E27, kValid, 0, 0}, {0x1E28, kMapped, 1, 723}, {0x1E29, kValid, 0, 0},
+  {0x1E2A, kMapped, 1, 724}, {0x1E2B, kValid, 0, 0}, {0x1E2C, kMapped, 1, 725}, {0x1E2D, kValid, 0, 0},
+  {0x1E2E, kMapped, 1, 726}, {0x1E2F, kValid, 0, 0}, {0x1E30, kMapped, 1, 727}, {0x1E31, kValid, 0, 0},
+  {0x1E32, kMapped, 1, 728}, {0x1E33, kValid, 0, 0}, {0x1E34, kMapped, 1, 729}, {0x1E35, kValid, 0, 0},
+  {0x1E36, kMapped, 1, 730}, {0x1E37, kValid, 0, 0}, {0x1E38, kMapped, 1, 731}, {0x1E39, kValid, 0, 0},
+  {0x1E3A, kMapped, 1, 732}, {0x1E3B, kValid, 0, 0}, {0x1E3C, kMapped, 1, 733}, {0x1E3D, kValid, 0, 0},
+  {0x1E3E, kMapped, 1, 734}, {0x1E3F, kValid, 0, 0}, {0x1E40, kMapped, 1, 735}, {0x1E41, kValid, 0, 0},
+  {0x1E42, kMapped, 1, 736}, {0x1E43, kValid, 0, 0}, {0x1E44, kMapped, 1, 737}, {0x1E45, kValid, 0, 0},
+  {0x1E46, kMapped, 1, 738}, {0x1E47, kValid, 0, 0}, {0x1E48, kMapped, 1, 739}, {0x1E49, kValid, 0, 0},
+  {0x1E4A, kMapped, 1, 740}, {0x1E4B, kValid, 0, 0}, {0x1E4C, kMapped, 1, 741}, {0x1E4D, kValid, 0, 0},
+  {0x1E4E, kMapped, 1, 742}, {0x1E4F, kValid, 0, 0}, {0x1E50, kMapped, 1, 743}, {0x1E51, kValid, 0, 0},
+  {0x1E52, kMapped, 1, 744}, {0x1E53, kValid, 0, 0}, {0x1E54, kMapped, 1, 745}, {0x1E55, kValid, 0, 0},
+  {0x1E56, kMapped, 1, 746}, {0x1E57, kValid, 0, 0}, {0x1E58, kMapped, 1, 747}, {0x1E59, kValid, 0, 0},
+  {0x1E5A, kMapped, 1, 748}, {0x1E5B, kValid, 0, 0}, {0x1E5C, kMapped, 1, 749}, {0x1E5D, kValid, 0, 0},
+  {0x1E5E, kMapped, 1, 750}, {0x1E5F, kValid, 0, 0}, {0x1E60, kMapped, 1, 751}, {0x1E61, kValid, 0, 0},
+  {0x1E62, kMapped, 1, 752}, {0x1E63, kValid, 0, 0}, {0x1E64, kMapped, 1, 753}, {0x1E65, kValid, 0, 0},
+  {0x1E66, kMapped, 1, 754}, {0x1E67, kValid, 0, 0}, {0x1E68, kMapped, 1, 755}, {0x1E69, kValid, 0, 0},
+  {0x1E6A, kMapped, 1, 756}, {0x1E6B, kValid, 0, 0}, {0x1E6C, kMapped, 1, 757}, {0x1E6D, kValid, 0, 0},
+  {0x1E6E, kMapped, 1, 758}, {0x1E6F, kValid, 0, 0}, {0x1E70, kMapped, 1, 759}, {0x1E71, kValid, 0, 0},
+  {0x1E72, kMapped, 1, 760}, {0x1E73, kValid, 0, 0}, {0x1E74, kMapped, 1, 761}, {0x1E75, kValid, 0, 0},
+  {0x1E76, kMapped, 1, 762}, {0x1E77, kValid, 0, 0}, {0x1E78, kMapped, 1, 763}, {0x1E79, kValid, 0, 0},
+  {0x1E7A, kMapped, 1, 764}, {0x1E7B, kValid, 0, 0}, {0x1E7C, kMapped, 1, 765}, {0x1E7D, kValid, 0, 0},
+  {0x1E7E, kMapped, 1, 766}, {0x1E7F, kValid, 0, 0}, {0x1E80, kMapped, 1, 767}, {0x1E81, kValid, 0, 0},
+  {0x1E82, kMapped, 1, 768}, {0x1E83, kValid, 0, 0}, {0x1E84, kMapped, 1, 769}, {0x1E85, kValid, 0, 0},
+  {0x1E86, kMapped, 1, 770}, {0x1E87, kValid, 0, 0}, {0x1E88, kMapped, 1, 771}, {0x1E89, kValid, 0, 0},
+  {0x1E8A, kMapped, 1, 772}, {0x1E8B, kValid, 0, 0}, {0x1E8C, kMapped, 1, 773}, {0x1E8D, kValid, 0, 0},
+  {0x1E8E, kMapped, 1, 774}, {0x1E8F, kValid, 0, 0}, {0x1E90, kMapped, 1, 775}, {0x1E91, kValid, 0, 0},
+  {0x1E92, kMapped, 1, 776}, {0x1E93, kValid, 0, 0}, {0x1E94, kMapped, 1, 777}, {0x1E95, kValid, 0, 0},
+  {0x1E9A, kMapped, 2, 778}, {0x1E9B, kMapped, 1, 751}, {0x1E9C, kValid, 0, 0}, {0x1E9E, kMapped, 1, 780},
+  {0x1E9F, kValid, 0, 0}, {0x1EA0, kMapped, 1, 781}, {0x1EA1, kValid, 0, 0}, {0x1EA2, kMapped, 1, 782},
+  {0x1EA3, kValid, 0, 0}, {0x1EA4, kMapped, 1, 783}, {0x1EA5, kValid, 0, 0}, {0x1EA6, kMapped, 1, 784},
+  {0x1EA7, kValid, 0, 0}, {0x1EA8, kMapped, 1, 785}, {0x1EA9, kValid, 0, 0}, {0x1EAA, kMapped, 1, 786},
+  {0x1EAB, kValid, 0, 0}, {0x1EAC, kMapped, 1, 787}, {0x1EAD, kValid, 0, 0}, {0x1EAE, kMapped, 1, 788},
+  {0x1EAF, kValid, 0, 0}, {0x1EB0, kMapped, 1, 789}, {0x1EB1, kValid, 0, 0}, {0x1EB2, kMapped, 1, 790},
+  {0x1EB3, kValid, 0, 0}, {0x1EB4, kMapped, 1, 791}, {0x1EB5, kValid, 0, 0}, {0x1EB6, kMapped, 1, 792},
+  {0x1EB7, kValid, 0, 0}, {0x1EB8, kMapped, 1, 793}, {0x1EB9, kValid, 0, 0}, {0x1EBA, kMapped, 1, 794},
+  {0x1EBB, kValid, 0, 0}, {0x1EBC, kMapped, 1, 795}, {0x1EBD, kValid, 0, 0}, {0x1EBE, kMapped, 1, 796},
+  {0x1EBF, kValid, 0, 0}, {0x1EC0, kMapped, 1, 797}, {0x1EC1, kValid, 0, 0}, {0x1EC2, kMapped, 1, 798},
+  {0x1EC3, kValid, 0, 0}, {0x1EC4, kMapped, 1, 799}, {0x1EC5, kValid, 0, 0}, {0x1EC6, kMapped, 1, 800},
+  {0x1EC7, kValid, 0, 0}, {0x1EC8, kMapped, 1, 801}, {0x1EC9, kValid, 0, 0}, {0x1ECA, kMapped, 1, 802},
+  {0x1ECB, kValid, 0, 0}, {0x1ECC, kMapped, 1, 803}, {0x1ECD, kValid, 0, 0}, {0x1ECE, kMapped, 1, 804},
+  {0x1ECF, kValid, 0, 0}, {0x1ED0, kMapped, 1, 805}, {0x1ED1, kValid, 0, 0}, {0x1ED2, kMapped, 1, 806},
+  {0x1ED3, kValid, 0, 0}, {0x1ED4, kMapped, 1, 807}, {0x1ED5, kValid, 0, 0}, {0x1ED6, kMapped, 1, 808},
+  {0x1ED7, kValid, 0, 0}, {0x1ED8, kMapped, 1, 809}, {0x1ED9, kValid, 0, 0}, {0x1EDA, kMapped, 1, 810},
+  {0x1EDB, kValid, 0, 0}, {0x1EDC, kMapped, 1, 811}, {0x1EDD, kValid, 0, 0}, {0x1EDE, kMapped, 1, 812},
+  {0x1EDF, kValid, 0, 0}, {0x1EE0, kMapped, 1, 813}, {0x1EE1, kValid, 0, 0}, {0x1EE2, kMapped, 1, 814},
+  {0x1EE3, kValid, 0, 0}, {0x1EE4, kMapped, 1, 815}, {0x1EE5, kValid, 0, 0}, {0x1EE6, kMapped, 1, 816},
+  {0x1EE7, kValid, 0, 0}, {0x1EE8, kMapped, 1, 817}, {0x1EE9, kValid, 0, 0}, {0x1EEA, kMapped, 1, 818},
+  {0x1EEB, kValid, 0, 0}, {0x1EEC, kMapped, 1, 819}, {0x1EED, kValid, 0, 0}, {0x1EEE, kMapped, 1, 820},
+  {0x1EEF, kValid, 0, 0}, {0x1EF0, kMapped, 1, 821}, {0x1EF1, kValid, 0, 0}, {0x1EF2, kMapped, 1, 822},
+  {0x1EF3, kValid, 0, 0}, {0x1EF4, kMapped, 1, 823}, {0x1EF5, kValid, 0, 0}, {0x1EF6, kMapped, 1, 824},
+  {0x1EF7, kValid, 0, 0}, {0x1EF8, kMapped, 1, 825}, {0x1EF9, kValid, 0, 0}, {0x1EFA, kMapped, 1, 826},
+  {0x1EFB, kValid, 0, 0}, {0x1EFC, kMapped, 1, 827}, {0x1EFD, kValid, 0, 0}, {0x1EFE, kMapped, 1, 828},
+  {0x1EFF, kValid, 0, 0}, {0x1F08, kMapped, 1, 829}, {0x1F09, kMapped, 1, 830}, {0x1F0A, kMapped, 1, 831},
+  {0x1F0B, kMapped, 1, 832}, {0x1F0C, kMapped, 1, 833}, {0x1F0D, kMapped, 1, 834}, {0x1F0E, kMapped, 1, 835},
+  {0x1F0F, kMapped, 1, 836}, {0x1F10, kValid, 0, 0}, {0x1F16, kDisallowed, 0, 0}, {0x1F18, kMapped, 1, 837},
+  {0x1F19, kMapped, 1, 838}, {0x1F1A, kMapped, 1, 839}, {0x1F1B, kMapped, 1, 840}, {0x1F1C, kMapped, 1, 841},
+  {0x1F1D, kMapped, 1, 842}, {0x1F1E, kDisallowed, 0, 0}, {0x1F20, kValid, 0, 0}, {0x1F28, kMapped, 1, 843},
+  {0x1F29, kMapped, 1, 844}, {0x1F2A, kMapped, 1, 845}, {0x1F2B, kMapped, 1, 846}, {0x1F2C, kMapped, 1, 847},
+  {0x1F2D, kMapped, 1, 848}, {0x1F2E, kMapped, 1, 849}, {0x1F2F, kMapped, 1, 850}, {0x1F30, kValid, 0, 0},
+  {0x1F38, kMapped, 1, 851}, {0x1F39, kMapped, 1, 852}, {0x1F3A, kMapped, 1, 853}, {0x1F3B, kMapped, 1, 854},
+  {0x1F3C, kMapped, 1, 855}, {0x1F3D, kMapped, 1, 856}, {0x1F3E, kMapped, 1, 857}, {0x1F3F, kMapped, 1, 858},
+  {0x1F40, kValid, 0, 0}, {0x1F46, kDisallowed, 0, 0}, {0x1F48, kMapped, 1, 859}, {0x1F49, kMapped, 1, 860},
+  {0x1F4A, kMapped, 1, 861}, {0x1F4B, kMapped, 1, 862}, {0x1F4C, kMapped, 1, 863}, {0x1F4D, kMapped, 1, 864},
+  {0x1F4E, kDisallowed, 0, 0}, {0x1F50, kValid, 0, 0}, {0x1F58, kDisallowed, 0, 0}, {0x1F59, kMapped, 1, 865},
+  {0x1F5A, kDisallowed, 0, 0}, {0x1F5B, kMapped, 1, 866}, {0x1F5C, kDisallowed, 0, 0}, {0x1F5D, kMapped, 1, 867},
+  {0x1F5E, kDisallowed, 0, 0}, {0x1F5F, kMapped, 1, 868}, {0x1F60, kValid, 0, 0}, {0x1F68, kMapped, 1, 869},
+  {0x1F69, kMapped, 1, 870}, {0x1F6A, kMapped, 1, 871}, {0x1F6B, kMapped, 1, 872}, {0x1F6C, kMapped, 1, 873},
+  {0x1F6D, kMapped, 1, 874}, {0x1F6E, kMapped, 1, 875}, {0x1F6F, kMapped, 1, 876}, {0x1F70, kValid, 0, 0},
+  {0x1F71, kMapped, 1, 287}, {0x1F72, kValid, 0, 0}, {0x1F73, kMapped, 1, 289}, {0x1F74, kValid, 0, 0},
+  {0x1F75, kMapped, 1, 290}, {0x1F76, kValid, 0, 0}, {0x1F77, kMapped, 1, 291}, {0x1F78, kValid, 0, 0},
+  {0x1F79, kMapped, 1, 292}, {0x1F7A, kValid, 0, 0}, {0x1F7B, kMapped, 1, 293}, {0x1F7C, kValid, 0, 0},
+  {0x1F7D, kMapped, 1, 294}, {0x1F7E, kDisallowed, 0, 0}, {0x1F80, kMapped, 2, 877}, {0x1F81, kMapped, 2, 879},
+  {0x1F82, kMapped, 2, 881}, {0x1F83, kMapped, 2, 883}, {0x1F84, kMapped, 2, 885}, {0x1F85, kMapped, 2, 887},
+  {0x1F86, kMapped, 2, 889}, {0x1F87, kMapped, 2, 891}, {0x1F88, kMapped, 2, 877}, {0x1F89, kMapped, 2, 879},
+  {0x1F8A, kMapped, 2, 881}, {0x1F8B, kMapped, 2, 883}, {0x1F8C, kMapped, 2, 885}, {0x1F8D, kMapped, 2, 887},
+  {0x1F8E, kMapped, 2, 889}, {0x1F8F, kMapped, 2, 891}, {0x1F90, kMapped, 2, 893}, {0x1F91, kMapped, 2, 895},
+  {0x1F92, kMapped, 2, 897}, {0x1F93, kMapped, 2, 899}, {0x1F94, kMapped, 2, 901}, {0x1F95, kMapped, 2, 903},
+  {0x1F96, kMapped, 2, 905}, {0x1F97, kMapped, 2, 907}, {0x1F98, kMapped, 2, 893}, {0x1F99, kMapped, 2, 895},
+  {0x1F9A, kMapped, 2, 897}, {0x1F9B, kMapped, 2, 899}, {0x1F9C, kMapped, 2, 901}, {0x1F9D, kMapped, 2, 903},
+  {0x1F9E, kMapped, 2, 905}, {0x1F9F, kMapped, 2, 907}, {0x1FA0, kMapped, 2, 909}, {0x1FA1, kMapped, 2, 911},
+  {0x1FA2, kMapped, 2, 913}, {0x1FA3, kMapped, 2, 915}, {0x1FA4, kMapped, 2, 917}, {0x1FA5, kMapped, 2, 919},
+  {0x1FA6, kMapped, 2, 921}, {0x1FA7, kMapped, 2, 923}, {0x1FA8, kMapped, 2, 909}, {0x1FA9, kMapped, 2, 911},
+  {0x1FAA, kMapped, 2, 913}, {0x1FAB, kMapped, 2, 915}, {0x1FAC, kMapped, 2, 917}, {0x1FAD, kMapped, 2, 919},
+  {0x1FAE, kMapped, 2, 921}, {0x1FAF, kMapped, 2, 923}, {0x1FB0, kValid, 0, 0}, {0x1FB2, kMapped, 2, 925},
+  {0x1FB3, kMapped, 2, 927}, {0x1FB4, kMapped, 2, 929}, {0x1FB5, kDisallowed, 0, 0}, {0x1FB6, kValid, 0, 0},
+  {0x1FB7, kMapped, 2, 931}, {0x1FB8, kMapped, 1, 933}, {0x1FB9, kMapped, 1, 934}, {0x1FBA, kMapped, 1, 935},
+  {0x1FBB, kMapped, 1, 287}, {0x1FBC, kMapped, 2, 927}, {0x1FBD, kMapped, 2, 936}, {0x1FBE, kMapped, 1, 275},
+  {0x1FBF, kMapped, 2, 936}, {0x1FC0, kMapped, 2, 938}, {0x1FC1, kMapped, 3, 940}, {0x1FC2, kMapped, 2, 943},
+  {0x1FC3, kMapped, 2, 945}, {0x1FC4, kMapped, 2, 947}, {0x1FC5, kDisallowed, 0, 0}, {0x1FC6, kValid, 0, 0},
+  {0x1FC7, kMapped, 2, 949}, {0x1FC8, kMapped, 1, 951}, {0x1FC9, kMapped, 1, 289}, {0x1FCA, kMapped, 1, 952},
+  {0x1FCB, kMapped, 1, 290}, {0x1FCC, kMapped, 2, 945}, {0x1FCD, kMapped, 3, 953}, {0x1FCE, kMapped, 3, 956},
+  {0x1FCF, kMapped, 3, 959}, {0x1FD0, kValid, 0, 0}, {0x1FD3, kMapped, 1, 962}, {0x1FD4, kDisallowed, 0, 0},
+  {0x1FD6, kValid, 0, 0}, {0x1FD8, kMapped, 1, 963}, {0x1FD9, kMapped, 1, 964}, {0x1FDA, kMapped, 1, 965},
+  {0x1FDB, kMapped, 1, 291}, {0x1FDC, kDisallowed, 0, 0}, {0x1FDD, kMapped, 3, 966}, {0x1FDE, kMapped, 3, 969},
+  {0x1FDF, kMapped, 3, 972}, {0x1FE0, kValid, 0, 0}, {0x1FE3, kMapped, 1, 975}, {0x1FE4, kValid, 0, 0},
+  {0x1FE8, kMapped, 1, 976}, {0x1FE9, kMapped, 1, 977}, {0x1FEA, kMapped, 1, 978}, {0x1FEB, kMapped, 1, 293},
+  {0x1FEC, kMapped, 1, 979}, {0x1FED, kMapped, 3, 980}, {0x1FEE, kMapped, 3, 284}, {0x1FEF, kMapped, 1, 983},
+  {0x1FF0, kDisallowed, 0, 0}, {0x1FF2, kMapped, 2, 984}, {0x1FF3, kMapped, 2, 986}, {0x1FF4, kMapped, 2, 988},
+  {0x1FF5, kDisallowed, 0, 0}, {0x1FF6, kValid, 0, 0}, {0x1FF7, kMapped, 2, 990}, {0x1FF8, kMapped, 1, 992},
+  {0x1FF9, kMapped, 1, 292}, {0x1FFA, kMapped, 1, 993}, {0x1FFB, kMapped, 1, 294}, {0x1FFC, kMapped, 2, 986},
+  {0x1FFD, kMapped, 2, 33}, {0x1FFE, kMapped, 2, 994}, {0x1FFF, kDisallowed, 0, 0}, {0x2000, kMapped, 1, 26},
+  {0x200B, kMapped, 0, 0}, {0x200C, kValid, 0, 0}, {0x200E, kDisallowed, 0, 0}, {0x2010, kValid, 0, 0},
+  {0x2011, kMapped, 1, 996}, {0x2012, kValid, 0, 0}, {0x2017, kMapped, 2, 997}, {0x2018, kValid, 0, 0},
+  {0x2024, kDisallowed, 0, 0}, {0x2027, kValid, 0, 0}, {0x2028, kDisallowed, 0, 0}, {0x202F, kMapped, 1, 26},
+  {0x2030, kValid, 0, 0}, {0x2033, kMapped, 2, 999}, {0x2034, kMapped, 3, 1001}, {0x2035, kValid, 0, 0},
+  {0x2036, kMapped, 2, 1004}, {0x2037, kMapped, 3, 1006}, {0x2038, kValid, 0, 0}, {0x203C, kMapped, 2, 1009},
+  {0x203D, kValid, 0, 0}, {0x203E, kMapped, 2, 1011}, {0x203F, kValid, 0, 0}, {0x2047, kMapped, 2, 1013},
+  {0x2048, kMapped, 2, 1015}, {0x2049, kMapped, 2, 1017}, {0x204A, kValid, 0, 0}, {0x2057, kMapped, 4, 1019},
+  {0x2058, kValid, 0, 0}, {0x205F, kMapped, 1, 26}, {0x2060, kMapped, 0, 0}, {0x2061, kDisallowed, 0, 0},
+  {0x2064, kMapped, 0, 0}, {0x2065, kDisallowed, 0, 0}, {0x2070, kMapped, 1, 1023}, {0x2071, kMapped, 1, 8},
+  {0x2072, kDisallowed, 0, 0}, {0x2074, kMapped, 1, 1024}, {0x2075, kMapped, 1, 1025}, {0x2076, kMapped, 1, 1026},
+  {0x2077, kMapped, 1, 1027}, {0x2078, kMapped, 1, 1028}, {0x2079, kMapped, 1, 1029}, {0x207A, kMapped, 1, 1030},
+  {0x207B, kMapped, 1, 1031}, {0x207C, kMapped, 1, 1032}, {0x207D, kMapped, 1, 1033}, {0x207E, kMapped, 1, 1034},
+  {0x207F, kMapped, 1, 13}, {0x2080, kMapped, 1, 1023}, {0x2081, kMapped, 1, 38}, {0x2082, kMapped, 1, 31},
+  {0x2083, kMapped, 1, 32}, {0x2084, kMapped, 1, 1024}, {0x2085, kMapped, 1, 1025}, {0x2086, kMapped, 1, 1026},
+  {0x2087, kMapped, 1, 1027}, {0x2088, kMapped, 1, 1028}, {0x2089, kMapped, 1, 1029}, {0x208A, kMapped, 1, 1030},
+  {0x208B, kMapped, 1, 1031}, {0x208C, kMapped, 1, 1032}, {0x208D, kMapped, 1, 1033}, {0x208E, kMapped, 1, 1034},
+  {0x208F, kDisallowed, 0, 0}, {0x2090, kMapped, 1, 0}, {0x2091, kMapped, 1, 4}, {0x2092, kMapped, 1, 14},
+  {0x2093, kMapped, 1, 23}, {0x2094, kMapped, 1, 155}, {0x2095, kMapped, 1, 7}, {0x2096, kMapped, 1, 10},
+  {0x2097, kMapped, 1, 11}, {0x2098, kMapped, 1, 12}, {0x2099, kMapped, 1, 13}, {0x209A, kMapped, 1, 15},
+  {0x209B, kMapped, 1, 18}, {0x209C, kMapped, 1, 19}, {0x209D, kDisallowed, 0, 0}, {0x20A0, kValid, 0, 0},
+  {0x20A8, kMapped, 2, 1035}, {0x20A9, kValid, 0, 0}, {0x20C1, kDisallowed, 0, 0}, {0x20D0, kValid, 0, 0},
+  {0x20F1, kDisallowed, 0, 0}, {0x2100, kMapped, 3, 1037}, {0x2101, kMapped, 3, 1040}, {0x2102, kMapped, 1, 2},
+  {0x2103, kMapped, 2, 1043}, {0x2104, kValid, 0, 0}, {0x2105, kMapped, 3, 1045}, {0x2106, kMapped, 3, 1048},
+  {0x2107, kMapped, 1, 156}, {0x2108, kValid, 0, 0}, {0x2109, kMapped, 2, 1051}, {0x210A, kMapped, 1, 6},
+  {0x210B, kMapped, 1, 7}, {0x210F, kMapped, 1, 97}, {0x2110, kMapped, 1, 8}, {0x2112, kMapped, 1, 11},
+  {0x2114, kValid, 0, 0}, {0x2115, kMapped, 1, 13}, {0x2116, kMapped, 2, 1053}, {0x2117, kValid, 0, 0},
+  {0x2119, kMapped, 1, 15}, {0x211A, kMapped, 1, 16}, {0x211B, kMapped, 1, 17}, {0x211E, kValid, 0, 0},
+  {0x2120, kMapped, 2, 1055}, {0x2121, kMapped, 3, 1057}, {0x2122, kMapped, 2, 1060}, {0x2123, kValid, 0, 0},
+  {0x2124, kMapped, 1, 25}, {0x2125, kValid, 0, 0}, {0x2126, kMapped, 1, 316}, {0x2127, kValid, 0, 0},
+  {0x2128, kMapped, 1, 25}, {0x2129, kValid, 0, 0}, {0x212A, kMapped, 1, 10}, {0x212B, kMapped, 1, 53},
+  {0x212C, kMapped, 1, 1}, {0x212D, kMapped, 1, 2}, {0x212E, kValid, 0, 0}, {0x212F, kMapped, 1, 4},
+  {0x2131, kMapped, 1, 5}, {0x2132, kDisallowed, 0, 0}, {0x2133, kMapped, 1, 12}, {0x2134, kMapped, 1, 14},
+  {0x2135, kMapped, 1, 1062}, {0x2136, kMapped, 1, 1063}, {0x2137, kMapped, 1, 1064}, {0x2138, kMapped, 1, 1065},
+  {0x2139, kMapped, 1, 8}, {0x213A, kValid, 0, 0}, {0x213B, kMapped, 3, 1066}, {0x213C, kMapped, 1, 308},
+  {0x213D, kMapped, 1, 297}, {0x213F, kMapped, 1, 308}, {0x2140, kMapped, 1, 1069}, {0x2141, kValid, 0, 0},
+  {0x2145, kMapped, 1, 3}, {0x2147, kMapped, 1, 4}, {0x2148, kMapped, 1, 8}, {0x2149, kMapped, 1, 9},
+  {0x214A, kValid, 0, 0}, {0x2150, kMapped, 3, 1070}, {0x2151, kMapped, 3, 1073}, {0x2152, kMapped, 4, 1076},
+  {0x2153, kMapped, 3, 1080}, {0x2154, kMapped, 3, 1083}, {0x2155, kMapped, 3, 1086}, {0x2156, kMapped, 3, 1089},
+  {0x2157, kMapped, 3, 1092}, {0x2158, kMapped, 3, 1095}, {0x2159, kMapped, 3, 1098}, {0x215A, kMapped, 3, 1101},
+  {0x215B, kMapped, 3, 1104}, {0x215C, kMapped, 3, 1107}, {0x215D, kMapped, 3, 1110}, {0x215E, kMapped, 3, 1113},
+  {0x215F, kMapped, 2, 1116}, {0x2160, kMapped, 1, 8}, {0x2161, kMapped, 2, 1118}, {0x2162, kMapped, 3, 1120},
+  {0x2163, kMapped, 2, 1123}, {0x2164, kMapped, 1, 21}, {0x2165, kMapped, 2, 1125}, {0x2166, kMapped, 3, 1127},
+  {0x2167, kMapped, 4, 1130}, {0x2168, kMapped, 2, 1134}, {0x2169, kMapped, 1, 23}, {0x216A, kMapped, 2, 1136},
+  {0x216B, kMapped, 3, 1138}, {0x216C, kMapped, 1, 11}, {0x216D, kMapped, 1, 2}, {0x216E, kMapped, 1, 3},
+  {0x216F, kMapped, 1, 12}, {0x2170, kMapped, 1, 8}, {0x2171, kMapped, 2, 1118}, {0x2172, kMapped, 3, 1120},
+  {0x2173, kMapped, 2, 1123}, {0x2174, kMapped, 1, 21}, {0x2175, kMapped, 2, 1125}, {0x2176, kMapped, 3, 1127},
+  {0x2177, kMapped, 4, 1130}, {0x2178, kMapped, 2, 1134}, {0x2179, kMapped, 1, 23}, {0x217A, kMapped, 2, 1136},
+  {0x217B, kMapped, 3, 1138}, {0x217C, kMapped, 1, 11}, {0x217D, kMapped, 1, 2}, {0x217E, kMapped, 1, 3},
+  {0x217F, kMapped, 1, 12}, {0x2180, kValid, 0, 0}, {0x2183, kDisallowed, 0, 0}, {0x2184, kValid, 0, 0},
+  {0x2189, kMapped, 3, 1141}, {0x218A, kValid, 0, 0}, {0x218C, kDisallowed, 0, 0}, {0x2190, kValid, 0, 0},
+  {0x222C, kMapped, 2, 1144}, {0x222D, kMapped, 3, 1146}, {0x222E, kValid, 0, 0}, {0x222F, kMapped, 2, 1149},
+  {0x2230, kMapped, 3, 1151}, {0x2231, kValid, 0, 0}, {0x2329, kMapped, 1, 1154}, {0x232A, kMapped, 1, 1155},
+  {0x232B, kValid, 0, 0}, {0x2427, kDisallowed, 0, 0}, {0x2440, kValid, 0, 0}, {0x244B, kDisallowed, 0, 0},
+  {0x2460, kMapped, 1, 38}, {0x2461, kMapped, 1, 31}, {0x2462, kMapped, 1, 32}, {0x2463, kMapped, 1, 1024},
+  {0x2464, kMapped, 1, 1025}, {0x2465, kMapped, 1, 1026}, {0x2466, kMapped, 1, 1027}, {0x2467, kMapped, 1, 1028},
+  {0x2468, kMapped, 1, 1029}, {0x2469, kMapped, 2, 1156}, {0x246A, kMapped, 2, 1158}, {0x246B, kMapped, 2, 1160},
+  {0x246C, kMapped, 2, 1162}, {0x246D, kMapped, 2, 1164}, {0x246E, kMapped, 2, 1166}, {0x246F, kMapped, 2, 1168},
+  {0x2470, kMapped, 2, 1170}, {0x2471, kMapped, 2, 1172}, {0x2472, kMapped, 2, 1174}, {0x2473, kMapped, 2, 1176},
+  {0x2474, kMapped, 3, 1178}, {0x2475, kMapped, 3, 1181}, {0x2476, kMapped, 3, 1184}, {0x2477, kMapped, 3, 1187},
+  {0x2478, kMapped, 3, 1190}, {0x2479, kMapped, 3, 1193}, {0x247A, kMapped, 3, 1196}, {0x247B, kMapped, 3, 1199},
+  {0x247C, kMapped, 3, 1202}, {0x247D, kMapped, 4, 1205}, {0x247E, kMapped, 4, 1209}, {0x247F, kMapped, 4, 1213},
+  {0x2480, kMapped, 4, 1217}, {0x2481, kMapped, 4, 1221}, {0x2482, kMapped, 4, 1225}, {0x2483, kMapped, 4, 1229},
+  {0x2484, kMapped, 4, 1233}, {0x2485, kMapped, 4, 1237}, {0x2486, kMapped, 4, 1241}, {0x2487, kMapped, 4, 1245},
+  {0x2488, kDisallowed, 0, 0}, {0x249C, kMapped, 3, 1249}, {0x249D, kMapped, 3, 1252}, {0x249E, kMapped, 3, 1255},
+  {0x249F, kMapped, 3, 1258}, {0x24A0, kMapped, 3, 1261}, {0x24A1, kMapped, 3, 1264}, {0x24A2, kMapped, 3, 1267},
+  {0x24A3, kMapped, 3, 1270}, {0x24A4, kMapped, 3, 1273}, {0x24A5, kMapped, 3, 1276}, {0x24A6, kMapped, 3, 1279},
+  {0x24A7, kMapped, 3, 1282}, {0x24A8, kMapped, 3, 1285}, {0x24A9, kMapped, 3, 1288}, {0x24AA, kMapped, 3, 1291},
+  {0x24AB, kMapped, 3, 1294}, {0x24AC, kMapped, 3, 1297}, {0x24AD, kMapped, 3, 1300}, {0x24AE, kMapped, 3, 1303},
+  {0x24AF, kMapped, 3, 1306}, {0x24B0, kMapped, 3, 1309}, {0x24B1, kMapped, 3, 1312}, {0x24B2, kMapped, 3, 1315},
+  {0x24B3, kMapped, 3, 1318}, {0x24B4, kMapped, 3, 1321}, {0x24B5, kMapped, 3, 1324}, {0x24B6, kMapped, 1, 0},
+  {0x24B7, kMapped, 1, 1}, {0x24B8, kMapped, 1, 2}, {0x24B9, kMapped, 1, 3}, {0x24BA, kMapped, 1, 4},
+  {0x24BB, kMapped, 1, 5}, {0x24BC, kMapped, 1, 6}, {0x24BD, kMapped, 1, 7}, {0x24BE, kMapped, 1, 8},
+  {0x24BF, kMapped, 1, 9}, {0x24C0, kMapped, 1, 10}, {0x24C1, kMapped, 1, 11}, {0x24C2, kMapped, 1, 12},
+  {0x24C3, kMapped, 1, 13}, {0x24C4, kMapped, 1, 14}, {0x24C5, kMapped, 1, 15}, {0x24C6, kMapped, 1, 16},
+  {0x24C7, kMapped, 1, 17}, {0x24C8, kMapped, 1, 18}, {0x24C9, kMapped, 1, 19}, {0x24CA, kMapped, 1, 20},
+  {0x24CB, kMapped, 1, 21}, {0x24CC, kMapped, 1, 22}, {0x24CD, kMapped, 1, 23}, {0x24CE, kMapped, 1, 24},
+  {0x24CF, kMapped, 1, 25}, {0x24D0, kMapped, 1, 0}, {0x24D1, kMapped, 1, 1}, {0x24D2, kMapped, 1, 2},
+  {0x24D3, kMapped, 1, 3}, {0x24D4, kMapped, 1, 4}, {0x24D5, kMapped, 1, 5}, {0x24D6, kMapped, 1, 6},
+  {0x24D7, kMapped, 1, 7}, {0x24D8, kMapped, 1, 8}, {0x24D9, kMapped, 1, 9}, {0x24DA, kMapped, 1, 10},
+  {0x24DB, kMapped, 1, 11}, {0x24DC, kMapped, 1, 12}, {0x24DD, kMapped, 1, 13}, {0x24DE, kMapped, 1, 14},
+  {0x24DF, kMapped, 1, 15}, {0x24E0, kMapped, 1, 16}, {0x24E1, kMapped, 1, 17}, {0x24E2, kMapped, 1, 18},
+  {0x24E3, kMapped, 1, 19}, {0x24E4, kMapped, 1, 20}, {0x24E5, kMapped, 1, 21}, {0x24E6, kMapped, 1, 22},
+  {0x24E7, kMapped, 1, 23}, {0x24E8, kMapped, 1, 24}, {0x24E9, kMapped, 1, 25}, {0x24EA, kMapped, 1, 1023},
+  {0x24EB, kValid, 0, 0}, {0x2A0C, kMapped, 4, 1327}, {0x2A0D, kValid, 0, 0}, {0x2A74, kMapped, 3, 1331},
+  {0x2A75, kMapped, 2, 1334}, {0x2A76, kMapped, 3, 1336}, {0x2A77, kValid, 0, 0}, {0x2ADC, kMapped, 2, 1339},
+  {0x2ADD, kValid, 0, 0}, {0x2B74, kDisallowed, 0, 0}, {0x2B76, kValid, 0, 0}, {0x2B96, kDisallowed, 0, 0},
+  {0x2B97, kValid, 0, 0}, {0x2C00, kMapped, 1, 1341}, {0x2C01, kMapped, 1, 1342}, {0x2C02, kMapped, 1, 1343},
+  {0x2C03, kMapped, 1, 1344}, {0x2C04, kMapped, 1, 1345}, {0x2C05, kMapped, 1, 1346}, {0x2C06, kMapped, 1, 1347},
+  {0x2C07, kMapped, 1, 1348}, {0x2C08, kMapped, 1, 1349}, {0x2C09, kMapped, 1, 1350}, {0x2C0A, kMapped, 1, 1351},
+  {0x2C0B, kMapped, 1, 1352}, {0x2C0C, kMapped, 1, 1353}, {0x2C0D, kMapped, 1, 1354}, {0x2C0E, kMapped, 1, 1355},
+  {0x2C0F, kMapped, 1, 1356}, {0x2C10, kMapped, 1, 1357}, {0x2C11, kMapped, 1, 1358}, {0x2C12, kMapped, 1, 1359},
+  {0x2C13, kMapped, 1, 1360}, {0x2C14, kMapped, 1, 1361}, {0x2C15, kMapped, 1, 1362}, {0x2C16, kMapped, 1, 1363},
+  {0x2C17, kMapped, 1, 1364}, {0x2C18, kMapped, 1, 1365}, {0x2C19, kMapped, 1, 1366}, {0x2C1A, kMapped, 1, 1367},
+  {0x2C1B, kMapped, 1, 1368}, {0x2C1C, kMapped, 1, 1369}, {0x2C1D, kMapped, 1, 1370}, {0x2C1E, kMapped, 1, 1371},
+  {0x2C1F, kMapped, 1, 1372}, {0x2C20, kMapped, 1, 1373}, {0x2C21, kMapped, 1, 1374}, {0x2C22, kMapped, 1, 1375},
+  {0x2C23, kMapped, 1, 1376}, {0x2C24, kMapped, 1, 1377}, {0x2C25, kMapped, 1, 1378}, {0x2C26, kMapped, 1, 1379},
+  {0x2C27, kMapped, 1, 1380}, {0x2C28, kMapped, 1, 1381}, {0x2C29, kMapped, 1, 1382}, {0x2C2A, kMapped, 1, 1383},
+  {0x2C2B, kMapped, 1, 1384}, {0x2C2C, kMapped, 1, 1385}, {0x2C2D, kMapped, 1, 1386}, {0x2C2E, kMapped, 1, 1387},
+  {0x2C2F, kMapped, 1, 1388}, {0x2C30, kValid, 0, 0}, {0x2C60, kMapped, 1, 1389}, {0x2C61, kValid, 0, 0},
+  {0x2C62, kMapped, 1, 1390}, {0x2C63, kMapped, 1, 1391}, {0x2C64, kMapped, 1, 1392}, {0x2C65, kValid, 0, 0},
+  {0x2C67, kMapped, 1, 1393}, {0x2C68, kValid, 0, 0}, {0x2C69, kMapped, 1, 1394}, {0x2C6A, kValid, 0, 0},
+  {0x2C6B, kMapped, 1, 1395}, {0x2C6C, kValid, 0, 0}, {0x2C6D, kMapped, 1, 675}, {0x2C6E, kMapped, 1, 693},
+  {0x2C6F, kMapped, 1, 674}, {0x2C70, kMapped, 1, 682}, {0x2C71, kValid, 0, 0}, {0x2C72, kMapped, 1, 1396},
+  {0x2C73, kValid, 0, 0}, {0x2C75, kMapped, 1, 1397}, {0x2C76, kValid, 0, 0}, {0x2C7C, kMapped, 1, 9},
+  {0x2C7D, kMapped, 1, 21}, {0x2C7E, kMapped, 1, 1398}, {0x2C7F, kMapped, 1, 1399}, {0x2C80, kMapped, 1, 1400},
+  {0x2C81, kValid, 0, 0}, {0x2C82, kMapped, 1, 1401}, {0x2C83, kValid, 0, 0}, {0x2C84, kMapped, 1, 1402},
+  {0x2C85, kValid, 0, 0}, {0x2C86, kMapped, 1, 1403}, {0x2C87, kValid, 0, 0}, {0x2C88, kMapped, 1, 1404},
+  {0x2C89, kValid, 0, 0}, {0x2C8A, kMapped, 1, 1405}, {0x2C8B, kValid, 0, 0}, {0x2C8C, kMapped, 1, 1406},
+  {0x2C8D, kValid, 0, 0}, {0x2C8E, kMapped, 1, 1407}, {0x2C8F, kValid, 0, 0}, {0x2C90, kMapped, 1, 1408},
+  {0x2C91, kValid, 0, 0}, {0x2C92, kMapped, 1, 1409}, {0x2C93, kValid, 0, 0}, {0x2C94, kMapped, 1, 1410},
+  {0x2C95, kValid, 0, 0}, {0x2C96, kMapped, 1, 1411}, {0x2C97, kValid, 0, 0}, {0x2C98, kMapped, 1, 1412},
+  {0x2C99, kValid, 0, 0}, {0x2C9A, kMapped, 1, 1413}, {0x2C9B, kValid, 0, 0}, {0x2C9C, kMapped, 1, 1414},
+  {0x2C9D, kValid, 0, 0}, {0x2C9E, kMapped, 1, 1415}, {0x2C9F, kValid, 0, 0}, {0x2CA0, kMapped, 1, 1416},
+  {0x2CA1, kValid, 0, 0}, {0x2CA2, kMapped, 1, 1417}, {0x2CA3, kValid, 0, 0}, {0x2CA4, kMapped, 1, 1418},
+  {0x2CA5, kValid, 0, 0}, {0x2CA6, kMapped, 1, 1419}, {0x2CA7, kValid, 0, 0}, {0x2CA8, kMapped, 1, 1420},
+  {0x2CA9, kValid, 0, 0}, {0x2CAA, kMapped, 1, 1421}, {0x2CAB, kValid, 0, 0}, {0x2CAC, kMapped, 1, 1422},
+  {0x2CAD, kValid, 0, 0}, {0x2CAE, kMapped, 1, 1423}, {0x2CAF, kValid, 0, 0}, {0x2CB0, kMapped, 1, 1424},
+  {0x2CB1, kValid, 0, 0}, {0x2CB2, kMapped, 1, 1425}, {0x2CB3, kValid, 0, 0}, {0x2CB4, kMapped, 1, 1426},
+  {0x2CB5, kValid, 0, 0}, {0x2CB6, kMapped, 1, 1427}, {0x2CB7, kValid, 0, 0}, {0x2CB8, kMapped, 1, 1428},
+  {0x2CB9, kValid, 0, 0}, {0x2CBA, kMapped, 1, 1429}, {0x2CBB, kValid, 0, 0}, {0x2CBC, kMapped, 1, 1430},
+  {0x2CBD, kValid, 0, 0}, {0x2CBE, kMapped, 1, 1431}, {0x2CBF, kValid, 0, 0}, {0x2CC0, kMapped, 1, 1432},
+  {0x2CC1, kValid, 0, 0}, {0x2CC2, kMapped, 1, 1433}, {0x2CC3, kValid, 0, 0}, {0x2CC4, kMapped, 1, 1434},
+  {0x2CC5, kValid, 0, 0}, {0x2CC6, kMapped, 1, 1435}, {0x2CC7, kValid, 0, 0}, {0x2CC8, kMapped, 1, 1436},
+  {0x2CC9, kValid, 0, 0}, {0x2CCA, kMapped, 1, 1437}, {0x2CCB, kValid, 0, 0}, {0x2CCC, kMapped, 1, 1438},
+  {0x2CCD, kValid, 0, 0}, {0x2CCE, kMapped, 1, 1439}, {0x2CCF, kValid, 0, 0}, {0x2CD0, kMapped, 1, 1440},
+  {0x2CD1, kValid, 0, 0}, {0x2CD2, kMapped, 1, 1441}, {0x2CD3, kValid, 0, 0}, {0x2CD4, kMapped, 1, 1442},
+  {0x2CD5, kValid, 0, 0}, {0x2CD6, kMapped, 1, 1443}, {0x2CD7, kValid, 0, 0}, {0x2CD8, kMapped, 1, 1444},
+  {0x2CD9, kValid, 0, 0}, {0x2CDA, kMapped, 1, 1445}, {0x2CDB, kValid, 0, 0}, {0x2CDC, kMapped, 1, 1446},
+  {0x2CDD, kValid, 0, 0}, {0x2CDE, kMapped, 1, 1447}, {0x2CDF, kValid, 0, 0}, {0x2CE0, kMapped, 1, 1448},
+  {0x2CE1, kValid, 0, 0}, {0x2CE2, kMapped, 1, 1449}, {0x2CE3, kValid, 0, 0}, {0x2CEB, kMapped, 1, 1450},
+  {0x2CEC, kValid, 0, 0}, {0x2CED, kMapped, 1, 1451}, {0x2CEE, kValid, 0, 0}, {0x2CF2, kMapped, 1, 1452},
+  {0x2CF3, kValid, 0, 0}, {0x2CF4, kDisallowed, 0, 0}, {0x2CF9, kValid, 0, 0}, {0x2D26, kDisallowed, 0, 0},
+  {0x2D27, kValid, 0, 0}, {0x2D28, kDisallowed, 0, 0}, {0x2D2D, kValid, 0, 0}, {0x2D2E, kDisallowed, 0, 0},
+  {0x2D30, kValid, 0, 0}, {0x2D68, kDisallowed, 0, 0}, {0x2D6F, kMapped, 1, 1453}, {0x2D70, kValid, 0, 0},
+  {0x2D71, kDisallowed, 0, 0}, {0x2D7F, kValid, 0, 0}, {0x2D97, kDisallowed, 0, 0}, {0x2DA0, kValid, 0, 0},
+  {0x2DA7, kDisallowed, 0, 0}, {0x2DA8, kValid, 0, 0}, {0x2DAF, kDisallowed, 0, 0}, {0x2DB0, kValid, 0, 0},
+  {0x2DB7, kDisallowed, 0, 0}, {0x2DB8, kValid, 0, 0}, {0x2DBF, kDisallowed, 0, 0}, {0x2DC0, kValid, 0, 0},
+  {0x2DC7, kDisallowed, 0, 0}, {0x2DC8, kValid, 0, 0}, {0x2DCF, kDisallowed, 0, 0}, {0x2DD0, kValid, 0, 0},
+  {0x2DD7, kDisallowed, 0, 0}, {0x2DD8, kValid, 0, 0}, {0x2DDF, kDisallowed, 0, 0}, {0x2DE0, kValid, 0, 0},
+  {0x2E5E, kDisallowed, 0, 0}, {0x2E80, kValid, 0, 0}, {0x2E9A, kDisallowed, 0, 0}, {0x2E9B, kValid, 0, 0},
+  {0x2E9F, kMapped, 1, 1454}, {0x2EA0, kValid, 0, 0}, {0x2EF3, kMapped, 1, 1455}, {0x2EF4, kDisallowed, 0, 0},
+  {0x2F00, kMapped, 1, 1456}, {0x2F01, kMapped, 1, 1457}, {0x2F02, kMapped, 1, 1458}, {0x2F03, kMapped, 1, 1459},
+  {0x2F04, kMapped, 1, 1460}, {0x2F05, kMapped, 1, 1461}, {0x2F06, kMapped, 1, 1462}, {0x2F07, kMapped, 1, 1463},
+  {0x2F08, kMapped, 1, 1464}, {0x2F09, kMapped, 1, 1465}, {0x2F0A, kMapped, 1, 1466}, {0x2F0B, kMapped, 1, 1467},
+  {0x2F0C, kMapped, 1, 1468}, {0x2F0D, kMapped, 1, 1469}, {0x2F0E, kMapped, 1, 1470}, {0x2F0F, kMapped, 1, 1471},
+  {0x2F10, kMapped, 1, 1472}, {0x2F11, kMapped, 1, 1473}, {0x2F12, kMapped, 1, 1474}, {0x2F13, kMapped, 1, 1475},
+  {0x2F14, kMapped, 1, 1476}, {0x2F15, kMapped, 1, 1477}, {0x2F16, kMapped, 1, 1478}, {0x2F17, kMapped, 1, 1479},
+  {0x2F18, kMapped, 1, 1480}, {0x2F19, kMapped, 1, 1481}, {0x2F1A, kMapped, 1, 1482}, {0x2F1B, kMapped, 1, 1483},
+  {0x2F1C, kMapped, 1, 1484}, {0x2F1D, kMapped, 1, 1485}, {0x2F1E, kMapped, 1, 1486}, {0x2F1F, kMapped, 1, 1487},
+  {0x2F20, kMapped, 1, 1488}, {0x2F21, kMapped, 1, 1489}, {0x2F22, kMapped, 1, 1490}, {0x2F23, kMapped, 1, 1491},
+  {0x2F24, kMapped, 1, 1492}, {0x2F25, kMapped, 1, 1493}, {0x2F26, kMapped, 1, 1494}, {0x2F27, kMapped, 1, 1495},
+  {0x2F28, kMapped, 1, 1496}, {0x2F29, kMapped, 1, 1497}, {0x2F2A, kMapped, 1, 1498}, {0x2F2B, kMapped, 1, 1499},
+  {0x2F2C, kMapped, 1, 1500}, {0x2F2D, kMapped, 1, 1501}, {0x2F2E, kMapped, 1, 1502}, {0x2F2F, kMapped, 1, 1503},
+  {0x2F30, kMapped, 1, 1504}, {0x2F31, kMapped, 1, 1505}, {0x2F32, kMapped, 1, 1506}, {0x2F33, kMapped, 1, 1507},
+  {0x2F34, kMapped, 1, 1508}, {0x2F35, kMapped, 1, 1509}, {0x2F36, kMapped, 1, 1510}, {0x2F37, kMapped, 1, 1511},
+  {0x2F38, kMapped, 1, 1512}, {0x2F39, kMapped, 1, 1513}, {0x2F3A, kMapped, 1, 1514}, {0x2F3B, kMapped, 1, 1515},
+  {0x2F3C, kMapped, 1, 1516}, {0x2F3D, kMapped, 1, 1517}, {0x2F3E, kMapped, 1, 1518}, {0x2F3F, kMapped, 1, 1519},
+  {0x2F40, kMapped, 1, 1520}, {0x2F41, kMapped, 1, 1521}, {0x2F42, kMapped, 1, 1522}, {0x2F43, kMapped, 1, 1523},
+  {0x2F44, kMapped, 1, 1524}, {0x2F45, kMapped, 1, 1525}, {0x2F46, kMapped, 1, 1526}, {0x2F47, kMapped, 1, 1527},
+  {0x2F48, kMapped, 1, 1528}, {0x2F49, kMapped, 1, 1529}, {0x2F4A, kMapped, 1, 1530}, {0x2F4B, kMapped, 1, 1531},
+  {0x2F4C, kMapped, 1, 1532}, {0x2F4D, kMapped, 1, 1533}, {0x2F4E, kMapped, 1, 1534}, {0x2F4F, kMapped, 1, 1535},
+  {0x2F50, kMapped, 1, 1536}, {0x2F51, kMapped, 1, 1537}, {0x2F52, kMapped, 1, 1538}, {0x2F53, kMapped, 1, 1539},
+  {0x2F54, kMapped, 1, 1540}, {0x2F55, kMapped, 1, 1541}, {0x2F56, kMapped, 1, 1542}, {0x2F57, kMapped, 1, 1543},
+  {0x2F58, kMapped, 1, 1544}, {0x2F59, kMapped, 1, 1545}, {0x2F5A, kMapped, 1, 1546}, {0x2F5B, kMapped, 1, 1547},
+  {0x2F5C, kMapped, 1, 1548}, {0x2F5D, kMapped, 1, 1549}, {0x2F5E, kMapped, 1, 1550}, {0x2F5F, kMapped, 1, 1551},
+  {0x2F60, kMapped, 1, 1552}, {0x2F61, kMapped, 1, 1553}, {0x2F62, kMapped, 1, 1554}, {0x2F63, kMapped, 1, 1555},
+  {0x2F64, kMapped, 1, 1556}, {0x2F65, kMapped, 1, 1557}, {0x2F66, kMapped, 1, 1558}, {0x2F67, kMapped, 1, 1559},
+  {0x2F68, kMapped, 1, 1560}, {0x2F69, kMapped, 1, 1561}, {0x2F6A, kMapped, 1, 1562}, {0x2F6B, kMapped, 1, 1563},
+  {0x2F6C, kMapped, 1, 1564}, {0x2F6D, kMapped, 1, 1565}, {0x2F6E, kMapped, 1, 1566}, {0x2F6F, kMapped, 1, 1567},
+  {0x2F70, kMapped, 1, 1568}, {0x2F71, kMapped, 1, 1569}, {0x2F72, kMapped, 1, 1570}, {0x2F73, kMapped, 1, 1571},
+  {0x2F74, kMapped, 1, 1572}, {0x2F75, kMapped, 1, 1573}, {0x2F76, kMapped, 1, 1574}, {0x2F77, kMapped, 1, 1575},
+  {0x2F78, kMapped, 1, 1576}, {0x2F79, kMapped, 1, 1577}, {0x2F7A, kMapped, 1, 1578}, {0x2F7B, kMapped, 1, 1579},
+  {0x2F7C, kMapped, 1, 1580}, {0x2F7D, kMapped, 1, 1581}, {0x2F7E, kMapped, 1, 1582}, {0x2F7F, kMapped, 1, 1583},
+  {0x2F80, kMapped, 1, 1584}, {0x2F81, kMapped, 1, 1585}, {0x2F82, kMapped, 1, 1586}, {0x2F83, kMapped, 1, 1587},
+  {0x2F84, kMapped, 1, 1588}, {0x2F85, kMapped, 1, 1589}, {0x2F86, kMapped, 1, 1590}, {0x2F87, kMapped, 1, 1591},
+  {0x2F88, kMapped, 1, 1592}, {0x2F89, kMapped, 1, 1593}, {0x2F8A, kMapped, 1, 1594}, {0x2F8B, kMapped, 1, 1595},
+  {0x2F8C, kMapped, 1, 1596}, {0x2F8D, kMapped, 1, 1597}, {0x2F8E, kMapped, 1, 1598}, {0x2F8F, kMapped, 1, 1599},
+  {0x2F90, kMapped, 1, 1600}, {0x2F91, kMapped, 1, 1601}, {0x2F92, kMapped, 1, 1602}, {0x2F93, kMapped, 1, 1603},
+  {0x2F94, kMapped, 1, 1604}, {0x2F95, kMapped, 1, 1605}, {0x2F96, kMapped, 1, 1606}, {0x2F97, kMapped, 1, 1607},
+  {0x2F98, kMapped, 1, 1608}, {0x2F99, kMapped, 1, 1609}, {0x2F9A, kMapped, 1, 1610}, {0x2F9B, kMapped, 1, 1611},
+  {0x2F9C, kMapped, 1, 1612}, {0x2F9D, kMapped, 1, 1613}, {0x2F9E, kMapped, 1, 1614}, {0x2F9F, kMapped, 1, 1615},
+  {0x2FA0, kMapped, 1, 1616}, {0x2FA1, kMapped, 1, 1617}, {0x2FA2, kMapped, 1, 1618}, {0x2FA3, kMapped, 1, 1619},
+  {0x2FA4, kMapped, 1, 1620}, {0x2FA5, kMapped, 1, 1621}, {0x2FA6, kMapped, 1, 1622}, {0x2FA7, kMapped, 1, 1623},
+  {0x2FA8, kMapped, 1, 1624}, {0x2FA9, kMapped, 1, 1625}, {0x2FAA, kMapped, 1, 1626}, {0x2FAB, kMapped, 1, 1627},
+  {0x2FAC, kMapped, 1, 1628}, {0x2FAD, kMapped, 1, 1629}, {0x2FAE, kMapped, 1, 1630}, {0x2FAF, kMapped, 1, 1631},
+  {0x2FB0, kMapped, 1, 1632}, {0x2FB1, kMapped, 1, 1633}, {0x2FB2, kMapped, 1, 1634}, {0x2FB3, kMapped, 1, 1635},
+  {0x2FB4, kMapped, 1, 1636}, {0x2FB5, kMapped, 1, 1637}, {0x2FB6, kMapped, 1, 1638}, {0x2FB7, kMapped, 1, 1639},
+  {0x2FB8, kMapped, 1, 1640}, {0x2FB9, kMapped, 1, 1641}, {0x2FBA, kMapped, 1, 1642}, {0x2FBB, kMapped, 1, 1643},
+  {0x2FBC, kMapped, 1, 1644}, {0x2FBD, kMapped, 1, 1645}, {0x2FBE, kMapped, 1, 1646}, {0x2FBF, kMapped, 1, 1647},
+  {0x2FC0, kMapped, 1, 1648}, {0x2FC1, kMapped, 1, 1649}, {0x2FC2, kMapped, 1, 1650}, {0x2FC3, kMapped, 1, 1651},
+  {0x2FC4, kMapped, 1, 1652}, {0x2FC5, kMapped, 1, 1653}, {0x2FC6, kMapped, 1, 1654}, {0x2FC7, kMapped, 1, 1655},
+  {0x2FC8, kMapped, 1, 1656}, {0x2FC9, kMapped, 1, 1657}, {0x2FCA, kMapped, 1, 1658}, {0x2FCB, kMapped, 1, 1659},
+  {0x2FCC, kMapped, 1, 1660}, {0x2FCD, kMapped, 1, 1661}, {0x2FCE, kMapped, 1, 1662}, {0x2FCF, kMapped, 1, 1663},
+  {0x2FD0, kMapped, 1, 1664}, {0x2FD1, kMapped, 1, 1665}, {0x2FD2, kMapped, 1, 1666}, {0x2FD3, kMapped, 1, 1667},
+  {0x2FD4, kMapped, 1, 1668}, {0x2FD5, kMapped, 1, 1669}, {0x2FD6, kDisallowed, 0, 0}, {0x3000, kMapped, 1, 26},
+  {0x3001, kValid, 0, 0}, {0x3002, kMapped, 1, 1670}, {0x3003, kValid, 0, 0}, {0x3036, kMapped, 1, 1671},
+  {0x3037, kValid, 0, 0}, {0x3038, kMapped, 1, 1479}, {0x3039, kMapped, 1, 1672}, {0x303A, kMapped, 1, 1673},
+  {0x303B, kValid, 0, 0}, {0x3040, kDisallowed, 0, 0}, {0x3041, kValid, 0, 0}, {0x3097, kDisallowed, 0, 0},
+  {0x3099, kValid, 0, 0}, {0x309B, kMapped, 2, 1674}, {0x309C, kMapped, 2, 1676}, {0x309D, kValid, 0, 0},
+  {0x309F, kMapped, 2, 1678}, {0x30A0, kValid, 0, 0}, {0x30FF, kMapped, 2, 1680}, {0x3100, kDisallowed, 0, 0},
+  {0x3105, kValid, 0, 0}, {0x3130, kDisallowed, 0, 0}, {0x3131, kMapped, 1, 1682}, {0x3132, kMapped, 1, 1683},
+  {0x3133, kMapped, 1, 1684}, {0x3134, kMapped, 1, 1685}, {0x3135, kMapped, 1, 1686}, {0x3136, kMapped, 1, 1687},
+  {0x3137, kMapped, 1, 1688}, {0x3138, kMapped, 1, 1689}, {0x3139, kMapped, 1, 1690}, {0x313A, kMapped, 1, 1691},
+  {0x313B, kMapped, 1, 1692}, {0x313C, kMapped, 1, 1693}, {0x313D, kMapped, 1, 1694}, {0x313E, kMapped, 1, 1695},
+  {0x313F, kMapped, 1, 1696}, {0x3140, kMapped, 1, 1697}, {0x3141, kMapped, 1, 1698}, {0x3142, kMapped, 1, 1699},
+  {0x3143, kMapped, 1, 1700}, {0x3144, kMapped, 1, 1701}, {0x3145, kMapped, 1, 1702}, {0x3146, kMapped, 1, 1703},
+  {0x3147, kMapped, 1, 1704}, {0x3148, kMapped, 1, 1705}, {0x3149, kMapped, 1, 1706}, {0x314A, kMapped, 1, 1707},
+  {0x314B, kMapped, 1, 1708}, {0x314C, kMapped, 1, 1709}, {0x314D, kMapped, 1, 1710}, {0x314E, kMapped, 1, 1711},
+  {0x314F, kMapped, 1, 1712}, {0x3150, kMapped, 1, 1713}, {0x3151, kMapped, 1, 1714}, {0x3152, kMapped, 1, 1715},
+  {0x3153, kMapped, 1, 1716}, {0x3154, kMapped, 1, 1717}, {0x3155, kMapped, 1, 1718}, {0x3156, kMapped, 1, 1719},
+  {0x3157, kMapped, 1, 1720}, {0x3158, kMapped, 1, 1721}, {0x3159, kMapped, 1, 1722}, {0x315A, kMapped, 1, 1723},
+  {0x315B, kMapped, 1, 1724}, {0x315C, kMapped, 1, 1725}, {0x315D, kMapped, 1, 1726}, {0x315E, kMapped, 1, 1727},
+  {0x315F, kMapped, 1, 1728}, {0x3160, kMapped, 1, 1729}, {0x3161, kMapped, 1, 1730}, {0x3162, kMapped, 1, 1731},
+  {0x3163, kMapped, 1, 1732}, {0x3164, kDisallowed, 0, 0}, {0x3165, kMapped, 1, 1733}, {0x3166, kMapped, 1, 1734},
+  {0x3167, kMapped, 1, 1735}, {0x3168, kMapped, 1, 1736}, {0x3169, kMapped, 1, 1737}, {0x316A, kMapped, 1, 1738},
+  {0x316B, kMapped, 1, 1739}, {0x316C, kMapped, 1, 1740}, {0x316D, kMapped, 1, 1741}, {0x316E, kMapped, 1, 1742},
+  {0x316F, kMapped, 1, 1743}, {0x3170, kMapped, 1, 1744}, {0x3171, kMapped, 1, 1745}, {0x3172, kMapped, 1, 1746},
+  {0x3173, kMapped, 1, 1747}, {0x3174, kMapped, 1, 1748}, {0x3175, kMapped, 1, 1749}, {0x3176, kMapped, 1, 1750},
+  {0x3177, kMapped, 1, 1751}, {0x3178, kMapped, 1, 1752}, {0x3179, kMapped, 1, 1753}, {0x317A, kMapped, 1, 1754},
+  {0x317B, kMapped, 1, 1755}, {0x317C, kMapped, 1, 1756}, {0x317D, kMapped, 1, 1757}, {0x317E, kMapped, 1, 1758},
+  {0x317F, kMapped, 1, 1759}, {0x3180, kMapped, 1, 1760}, {0x3181, kMapped, 1, 1761}, {0x3182, kMapped, 1, 1762},
+  {0x3183, kMapped, 1, 1763}, {0x3184, kMapped, 1, 1764}, {0x3185, kMapped, 1, 1765}, {0x3186, kMapped, 1, 1766},
+  {0x3187, kMapped, 1, 1767}, {0x3188, kMapped, 1, 1768}, {0x3189, kMapped, 1, 1769}, {0x318A, kMapped, 1, 1770},
+  {0x318B, kMapped, 1, 1771}, {0x318C, kMapped, 1, 1772}, {0x318D, kMapped, 1, 1773}, {0x318E, kMapped, 1, 1774},
+  {0x318F, kDisallowed, 0, 0}, {0x3190, kValid, 0, 0}, {0x3192, kMapped, 1, 1456}, {0x3193, kMapped, 1, 1462},
+  {0x3194, kMapped, 1, 1775}, {0x3195, kMapped, 1, 1776}, {0x3196, kMapped, 1, 1777}, {0x3197, kMapped, 1, 1778},
+  {0x3198, kMapped, 1, 1779}, {0x3199, kMapped, 1, 1780}, {0x319A, kMapped, 1, 1460}, {0x319B, kMapped, 1, 1781},
+  {0x319C, kMapped, 1, 1782}, {0x319D, kMapped, 1, 1783}, {0x319E, kMapped, 1, 1784}, {0x319F, kMapped, 1, 1464},
+  {0x31A0, kValid, 0, 0}, {0x31E4, kDisallowed, 0, 0}, {0x31F0, kValid, 0, 0}, {0x3200, kMapped, 3, 1785},
+  {0x3201, kMapped, 3, 1788}, {0x3202, kMapped, 3, 1791}, {0x3203, kMapped, 3, 1794}, {0x3204, kMapped, 3, 1797},
+  {0x3205, kMapped, 3, 1800}, {0x3206, kMapped, 3, 1803}, {0x3207, kMapped, 3, 1806}, {0x3208, kMapped, 3, 1809},
+  {0x3209, kMapped, 3, 1812}, {0x320A, kMapped, 3, 1815}, {0x320B, kMapped, 3, 1818}, {0x320C, kMapped, 3, 1821},
+  {0x320D, kMapped, 3, 1824}, {0x320E, kMapped, 3, 1827}, {0x320F, kMapped, 3, 1830}, {0x3210, kMapped, 3, 1833},
+  {0x3211, kMapped, 3, 1836}, {0x3212, kMapped, 3, 1839}, {0x3213, kMapped, 3, 1842}, {0x3214, kMapped, 3, 1845},
+  {0x3215, kMapped, 3, 1848}, {0x3216, kMapped, 3, 1851}, {0x3217, kMapped, 3, 1854}, {0x3218, kMapped, 3, 1857},
+  {0x3219, kMapped, 3, 1860}, {0x321A, kMapped, 3, 1863}, {0x321B, kMapped, 3, 1866}, {0x321C, kMapped, 3, 1869},
+  {0x321D, kMapped, 4, 1872}, {0x321E, kMapped, 4, 1876}, {0x321F, kDisallowed, 0, 0}, {0x3220, kMapped, 3, 1880},
+  {0x3221, kMapped, 3, 1883}, {0x3222, kMapped, 3, 1886}, {0x3223, kMapped, 3, 1889}, {0x3224, kMapped, 3, 1892},
+  {0x3225, kMapped, 3, 1895}, {0x3226, kMapped, 3, 1898}, {0x3227, kMapped, 3, 1901}, {0x3228, kMapped, 3, 1904},
+  {0x3229, kMapped, 3, 1907}, {0x322A, kMapped, 3, 1910}, {0x322B, kMapped, 3, 1913}, {0x322C, kMapped, 3, 1916},
+  {0x322D, kMapped, 3, 1919}, {0x322E, kMapped, 3, 1922}, {0x322F, kMapped, 3, 1925}, {0x3230, kMapped, 3, 1928},
+  {0x3231, kMapped, 3, 1931}, {0x3232, kMapped, 3, 1934}, {0x3233, kMapped, 3, 1937}, {0x3234, kMapped, 3, 1940},
+  {0x3235, kMapped, 3, 1943}, {0x3236, kMapped, 3, 1946}, {0x3237, kMapped, 3, 1949}, {0x3238, kMapped, 3, 1952},
+  {0x3239, kMapped, 3, 1955}, {0x323A, kMapped, 3, 1958}, {0x323B, kMapped, 3, 1961}, {0x323C, kMapped, 3, 1964},
+  {0x323D, kMapped, 3, 1967}, {0x323E, kMapped, 3, 1970}, {0x323F, kMapped, 3, 1973}, {0x3240, kMapped, 3, 1976},
+  {0x3241, kMapped, 3, 1979}, {0x3242, kMapped, 3, 1982}, {0x3243, kMapped, 3, 1985}, {0x3244, kMapped, 1, 1988},
+  {0x3245, kMapped, 1, 1989}, {0x3246, kMapped, 1, 1522}, {0x3247, kMapped, 1, 1990}, {0x3248, kValid, 0, 0},
+  {0x3250, kMapped, 3, 1991}, {0x3251, kMapped, 2, 1994}, {0x3252, kMapped, 2, 1996}, {0x3253, kMapped, 2, 1998},
+  {0x3254, kMapped, 2, 2000}, {0x3255, kMapped, 2, 2002}, {0x3256, kMapped, 2, 2004}, {0x3257, kMapped, 2, 2006},
+  {0x3258, kMapped, 2, 2008}, {0x3259, kMapped, 2, 2010}, {0x325A, kMapped, 2, 2012}, {0x325B, kMapped, 2, 2014},
+  {0x325C, kMapped, 2, 2016}, {0x325D, kMapped, 2, 2018}, {0x325E, kMapped, 2, 2020}, {0x325F, kMapped, 2, 2022},
+  {0x3260, kMapped, 1, 1682}, {0x3261, kMapped, 1, 1685}, {0x3262, kMapped, 1, 1688}, {0x3263, kMapped, 1, 1690},
+  {0x3264, kMapped, 1, 1698}, {0x3265, kMapped, 1, 1699}, {0x3266, kMapped, 1, 1702}, {0x3267, kMapped, 1, 1704},
+  {0x3268, kMapped, 1, 1705}, {0x3269, kMapped, 1, 1707}, {0x326A, kMapped, 1, 1708}, {0x326B, kMapped, 1, 1709},
+  {0x326C, kMapped, 1, 1710}, {0x326D, kMapped, 1, 1711}, {0x326E, kMapped, 1, 2024}, {0x326F, kMapped, 1, 2025},
+  {0x3270, kMapped, 1, 2026}, {0x3271, kMapped, 1, 2027}, {0x3272, kMapped, 1, 2028}, {0x3273, kMapped, 1, 2029},
+  {0x3274, kMapped, 1, 2030}, {0x3275, kMapped, 1, 2031}, {0x3276, kMapped, 1, 2032}, {0x3277, kMapped, 1, 2033},
+  {0x3278, kMapped, 1, 2034}, {0x3279, kMapped, 1, 2035}, {0x327A, kMapped, 1, 2036}, {0x327B, kMapped, 1, 2037},
+  {0x327C, kMapped, 2, 2038}, {0x327D, kMapped, 2, 2040}, {0x327E, kMapped, 1, 2042}, {0x327F, kValid, 0, 0},
+  {0x3280, kMapped, 1, 1456}, {0x3281, kMapped, 1, 1462}, {0x3282, kMapped, 1, 1775}, {0x3283, kMapped, 1, 1776},
+  {0x3284, kMapped, 1, 2043}, {0x3285, kMapped, 1, 2044}, {0x3286, kMapped, 1, 2045}, {0x3287, kMapped, 1, 1467},
+  {0x3288, kMapped, 1, 2046}, {0x3289, kMapped, 1, 1479}, {0x328A, kMapped, 1, 1529}, {0x328B, kMapped, 1, 1541},
+  {0x328C, kMapped, 1, 1540}, {0x328D, kMapped, 1, 1530}, {0x328E, kMapped, 1, 1622}, {0x328F, kMapped, 1, 1487},
+  {0x3290, kMapped, 1, 1527}, {0x3291, kMapped, 1, 2047}, {0x3292, kMapped, 1, 2048}, {0x3293, kMapped, 1, 2049},
+  {0x3294, kMapped, 1, 2050}, {0x3295, kMapped, 1, 2051}, {0x3296, kMapped, 1, 2052}, {0x3297, kMapped, 1, 2053},
+  {0x3298, kMapped, 1, 2054}, {0x3299, kMapped, 1, 2055}, {0x329A, kMapped, 1, 2056}, {0x329B, kMapped, 1, 1493},
+  {0x329C, kMapped, 1, 2057}, {0x329D, kMapped, 1, 2058}, {0x329E, kMapped, 1, 2059}, {0x329F, kMapped, 1, 2060},
+  {0x32A0, kMapped, 1, 2061}, {0x32A1, kMapped, 1, 2062}, {0x32A2, kMapped, 1, 2063}, {0x32A3, kMapped, 1, 2064},
+  {0x32A4, kMapped, 1, 1777}, {0x32A5, kMapped, 1, 1778}, {0x32A6, kMapped, 1, 1779}, {0x32A7, kMapped, 1, 2065},
+  {0x32A8, kMapped, 1, 2066}, {0x32A9, kMapped, 1, 2067}, {0x32AA, kMapped, 1, 2068}, {0x32AB, kMapped, 1, 2069},
+  {0x32AC, kMapped, 1, 2070}, {0x32AD, kMapped, 1, 2071}, {0x32AE, kMapped, 1, 2072}, {0x32AF, kMapped, 1, 2073},
+  {0x32B0, kMapped, 1, 2074}, {0x32B1, kMapped, 2, 2075}, {0x32B2, kMapped, 2, 2077}, {0x32B3, kMapped, 2, 2079},
+  {0x32B4, kMapped, 2, 2081}, {0x32B5, kMapped, 2, 2083}, {0x32B6, kMapped, 2, 2085}, {0x32B7, kMapped, 2, 2087},
+  {0x32B8, kMapped, 2, 2089}, {0x32B9, kMapped, 2, 2091}, {0x32BA, kMapped, 2, 2093}, {0x32BB, kMapped, 2, 2095},
+  {0x32BC, kMapped, 2, 2097}, {0x32BD, kMapped, 2, 2099}, {0x32BE, kMapped, 2, 2101}, {0x32BF, kMapped, 2, 2103},
+  {0x32C0, kMapped, 2, 2105}, {0x32C1, kMapped, 2, 2107}, {0x32C2, kMapped, 2, 2109}, {0x32C3, kMapped, 2, 2111},
+  {0x32C4, kMapped, 2, 2113}, {0x32C5, kMapped, 2, 2115}, {0x32C6, kMapped, 2, 2117}, {0x32C7, kMapped, 2, 2119},
+  {0x32C8, kMapped, 2, 2121}, {0x32C9, kMapped, 3, 2123}, {0x32CA, kMapped, 3, 2126}, {0x32CB, kMapped, 3, 2129},
+  {0x32CC, kMapped, 2, 2132}, {0x32CD, kMapped, 3, 2134}, {0x32CE, kMapped, 2, 2137}, {0x32CF, kMapped, 3, 2139},
+  {0x32D0, kMapped, 1, 2142}, {0x32D1, kMapped, 1, 2143}, {0x32D2, kMapped, 1, 2144}, {0x32D3, kMapped, 1, 2145},
+  {0x32D4, kMapped, 1, 2146}, {0x32D5, kMapped, 1, 2147}, {0x32D6, kMapped, 1, 2148}, {0x32D7, kMapped, 1, 2149},
+  {0x32D8, kMapped, 1, 2150}, {0x32D9, kMapped, 1, 2151}, {0x32DA, kMapped, 1, 2152}, {0x32DB, kMapped, 1, 2153},
+  {0x32DC, kMapped, 1, 2154}, {0x32DD, kMapped, 1, 2155}, {0x32DE, kMapped, 1, 2156}, {0x32DF, kMapped, 1, 2157},
+  {0x32E0, kMapped, 1, 2158}, {0x32E1, kMapped, 1, 2159}, {0x32E2, kMapped, 1, 2160}, {0x32E3, kMapped, 1, 2161},
+  {0x32E4, kMapped, 1, 2162}, {0x32E5, kMapped, 1, 2163}, {0x32E6, kMapped, 1, 2164}, {0x32E7, kMapped, 1, 2165},
+  {0x32E8, kMapped, 1, 2166}, {0x32E9, kMapped, 1, 2167}, {0x32EA, kMapped, 1, 2168}, {0x32EB, kMapped, 1, 2169},
+  {0x32EC, kMapped, 1, 2170}, {0x32ED, kMapped, 1, 2171}, {0x32EE, kMapped, 1, 2172}, {0x32EF, kMapped, 1, 2173},
+  {0x32F0, kMapped, 1, 2174}, {0x32F1, kMapped, 1, 2175}, {0x32F2, kMapped, 1, 2176}, {0x32F3, kMapped, 1, 2177},
+  {0x32F4, kMapped, 1, 2178}, {0x32F5, kMapped, 1, 2179}, {0x32F6, kMapped, 1, 2180}, {0x32F7, kMapped, 1, 2181},
+  {0x32F8, kMapped, 1, 2182}, {0x32F9, kMapped, 1, 2183}, {0x32FA, kMapped, 1, 2184}, {0x32FB, kMapped, 1, 2185},
+  {0x32FC, kMapped, 1, 2186}, {0x32FD, kMapped, 1, 2187}, {0x32FE, kMapped, 1, 2188}, {0x32FF, kMapped, 2, 2189},
+  {0x3300, kMapped, 4, 2191}, {0x3301, kMapped, 4, 2195}, {0x3302, kMapped, 4, 2199}, {0x3303, kMapped, 3, 2203},
+  {0x3304, kMapped, 4, 2206}, {0x3305, kMapped, 3, 2210}, {0x3306, kMapped, 3, 2213}, {0x3307, kMapped, 5, 2216},
+  {0x3308, kMapped, 4, 2221}, {0x3309, kMapped, 3, 2225}, {0x330A, kMapped, 3, 2228}, {0x330B, kMapped, 3, 2231},
+  {0x330C, kMapped, 4, 2234}, {0x330D, kMapped, 4, 2238}, {0x330E, kMapped, 3, 2242}, {0x330F, kMapped, 3, 2245},
+  {0x3310, kMapped, 2, 2248}, {0x3311, kMapped, 3, 2250}, {0x3312, kMapped, 4, 2253}, {0x3313, kMapped, 4, 2257},
+  {0x3314, kMapped, 2, 2261}, {0x3315, kMapped, 5, 2263}, {0x3316, kMapped, 6, 2268}, {0x3317, kMapped, 5, 2274},
+  {0x3318, kMapped, 3, 2279}, {0x3319, kMapped, 5, 2282}, {0x331A, kMapped, 5, 2287}, {0x331B, kMapped, 4, 2292},
+  {0x331C, kMapped, 3, 2296}, {0x331D, kMapped, 3, 2299}, {0x331E, kMapped, 3, 2302}, {0x331F, kMapped, 4, 2305},
+  {0x3320, kMapped, 5, 2309}, {0x3321, kMapped, 4, 2314}, {0x3322, kMapped, 3, 2318}, {0x3323, kMapped, 3, 2321},
+  {0x3324, kMapped, 3, 2324}, {0x3325, kMapped, 2, 2327}, {0x3326, kMapped, 2, 2329}, {0x3327, kMapped, 2, 2331},
+  {0x3328, kMapped, 2, 2333}, {0x3329, kMapped, 3, 2335}, {0x332A, kMapped, 3, 2338}, {0x332B, kMapped, 5, 2341},
+  {0x332C, kMapped, 3, 2346}, {0x332D, kMapped, 4, 2349}, {0x332E, kMapped, 5, 2353}, {0x332F, kMapped, 3, 2358},
+  {0x3330, kMapped, 2, 2361}, {0x3331, kMapped, 2, 2363}, {0x3332, kMapped, 5, 2365}, {0x3333, kMapped, 4, 2370},
+  {0x3334, kMapped, 5, 2374}, {0x3335, kMapped, 3, 2379}, {0x3336, kMapped, 5, 2382}, {0x3337, kMapped, 2, 2387},
+  {0x3338, kMapped, 3, 2389}, {0x3339, kMapped, 3, 2392}, {0x333A, kMapped, 3, 2395}, {0x333B, kMapped, 3, 2398},
+  {0x333C, kMapped, 3, 2401}, {0x333D, kMapped, 4, 2404}, {0x333E, kMapped, 3, 2408}, {0x333F, kMapped, 2, 2411},
+  {0x3340, kMapped, 3, 2413}, {0x3341, kMapped, 3, 2416}, {0x3342, kMapped, 3, 2419}, {0x3343, kMapped, 4, 2422},
+  {0x3344, kMapped, 3, 2426}, {0x3345, kMapped, 3, 2429}, {0x3346, kMapped, 3, 2432}, {0x3347, kMapped, 5, 2435},
+  {0x3348, kMapped, 4, 2440}, {0x3349, kMapped, 2, 2444}, {0x334A, kMapped, 5, 2446}, {0x334B, kMapped, 2, 2451},
+  {0x334C, kMapped, 4, 2453}, {0x334D, kMapped, 4, 2457}, {0x334E, kMapped, 3, 2461}, {0x334F, kMapped, 3, 2464},
+  {0x3350, kMapped, 3, 2467}, {0x3351, kMapped, 4, 2470}, {0x3352, kMapped, 2, 2474}, {0x3353, kMapped, 3, 2476},
+  {0x3354, kMapped, 4, 2479}, {0x3355, kMapped, 2, 2483}, {0x3356, kMapped, 5, 2485}, {0x3357, kMapped, 3, 2490},
+  {0x3358, kMapped, 2, 2493}, {0x3359, kMapped, 2, 2495}, {0x335A, kMapped, 2, 2497}, {0x335B, kMapped, 2, 2499},
+  {0x335C, kMapped, 2, 2501}, {0x335D, kMapped, 2, 2503}, {0x335E, kMapped, 2, 2505}, {0x335F, kMapped, 2, 2507},
+  {0x3360, kMapped, 2, 2509}, {0x3361, kMapped, 2, 2511}, {0x3362, kMapped, 3, 2513}, {0x3363, kMapped, 3, 2516},
+  {0x3364, kMapped, 3, 2519}, {0x3365, kMapped, 3, 2522}, {0x3366, kMapped, 3, 2525}, {0x3367, kMapped, 3, 2528},
+  {0x3368, kMapped, 3, 2531}, {0x3369, kMapped, 3, 2534}, {0x336A, kMapped, 3, 2537}, {0x336B, kMapped, 3, 2540},
+  {0x336C, kMapped, 3, 2543}, {0x336D, kMapped, 3, 2546}, {0x336E, kMapped, 3, 2549}, {0x336F, kMapped, 3, 2552},
+  {0x3370, kMapped, 3, 2555}, {0x3371, kMapped, 3, 2558}, {0x3372, kMapped, 2, 2561}, {0x3373, kMapped, 2, 2563},
+  {0x3374, kMapped, 3, 2565}, {0x3375, kMapped, 2, 2568}, {0x3376, kMapped, 2, 2570}, {0x3377, kMapped, 2, 2572},
+  {0x3378, kMapped, 3, 2574}, {0x3379, kMapped, 3, 2577}, {0x337A, kMapped, 2, 2580}, {0x337B, kMapped, 2, 2582},
+  {0x337C, kMapped, 2, 2584}, {0x337D, kMapped, 2, 2586}, {0x337E, kMapped, 2, 2588}, {0x337F, kMapped, 4, 2590},
+  {0x3380, kMapped, 2, 2594}, {0x3381, kMapped, 2, 2596}, {0x3382, kMapped, 2, 2598}, {0x3383, kMapped, 2, 2600},
+  {0x3384, kMapped, 2, 2602}, {0x3385, kMapped, 2, 2604}, {0x3386, kMapped, 2, 2606}, {0x3387, kMapped, 2, 2608},
+  {0x3388, kMapped, 3, 2610}, {0x3389, kMapped, 4, 2613}, {0x338A, kMapped, 2, 2617}, {0x338B, kMapped, 2, 2619},
+  {0x338C, kMapped, 2, 2621}, {0x338D, kMapped, 2, 2623}, {0x338E, kMapped, 2, 2625}, {0x338F, kMapped, 2, 2627},
+  {0x3390, kMapped, 2, 2629}, {0x3391, kMapped, 3, 2631}, {0x3392, kMapped, 3, 2634}, {0x3393, kMapped, 3, 2637},
+  {0x3394, kMapped, 3, 2640}, {0x3395, kMapped, 2, 2643}, {0x3396, kMapped, 2, 2645}, {0x3397, kMapped, 2, 2647},
+  {0x3398, kMapped, 2, 2649}, {0x3399, kMapped, 2, 2651}, {0x339A, kMapped, 2, 2653}, {0x339B, kMapped, 2, 2655},
+  {0x339C, kMapped, 2, 2657}, {0x339D, kMapped, 2, 2659}, {0x339E, kMapped, 2, 2661}, {0x339F, kMapped, 3, 2663},
+  {0x33A0, kMapped, 3, 2666}, {0x33A1, kMapped, 2, 2669}, {0x33A2, kMapped, 3, 2671}, {0x33A3, kMapped, 3, 2674},
+  {0x33A4, kMapped, 3, 2677}, {0x33A5, kMapped, 2, 2680}, {0x33A6, kMapped, 3, 2682}, {0x33A7, kMapped, 3, 2685},
+  {0x33A8, kMapped, 4, 2688}, {0x33A9, kMapped, 2, 2594}, {0x33AA, kMapped, 3, 2692}, {0x33AB, kMapped, 3, 2695},
+  {0x33AC, kMapped, 3, 2698}, {0x33AD, kMapped, 3, 2701}, {0x33AE, kMapped, 5, 2704}, {0x33AF, kMapped, 6, 2709},
+  {0x33B0, kMapped, 2, 2715}, {0x33B1, kMapped, 2, 2717}, {0x33B2, kMapped, 2, 2719}, {0x33B3, kMapped, 2, 2721},
+  {0x33B4, kMapped, 2, 2723}, {0x33B5, kMapped, 2, 2725}, {0x33B6, kMapped, 2, 2727}, {0x33B7, kMapped, 2, 2729},
+  {0x33B8, kMapped, 2, 2731}, {0x33B9, kMapped, 2, 2729}, {0x33BA, kMapped, 2, 2733}, {0x33BB, kMapped, 2, 2735},
+  {0x33BC, kMapped, 2, 2737}, {0x33BD, kMapped, 2, 2739}, {0x33BE, kMapped, 2, 2741}, {0x33BF, kMapped, 2, 2739},
+  {0x33C0, kMapped, 2, 2743}, {0x33C1, kMapped, 2, 2745}, {0x33C2, kDisallowed, 0, 0}, {0x33C3, kMapped, 2, 2747},
+  {0x33C4, kMapped, 2, 2749}, {0x33C5, kMapped, 2, 2751}, {0x33C6, kMapped, 4, 2753}, {0x33C7, kDisallowed, 0, 0},
+  {0x33C8, kMapped, 2, 2757}, {0x33C9, kMapped, 2, 2759}, {0x33CA, kMapped, 2, 2761}, {0x33CB, kMapped, 2, 2763},
+  {0x33CC, kMapped, 2, 2765}, {0x33CD, kMapped, 2, 2767}, {0x33CE, kMapped, 2, 2661}, {0x33CF, kMapped, 2, 2769},
+  {0x33D0, kMapped, 2, 2771}, {0x33D1, kMapped, 2, 2773}, {0x33D2, kMapped, 3, 2775}, {0x33D3, kMapped, 2, 2778},
+  {0x33D4, kMapped, 2, 2606}, {0x33D5, kMapped, 3, 2780}, {0x33D6, kMapped, 3, 2783}, {0x33D7, kMapped, 2, 2786},
+  {0x33D8, kDisallowed, 0, 0}, {0x33D9, kMapped, 3, 2788}, {0x33DA, kMapped, 2, 2791}, {0x33DB, kMapped, 2, 2793},
+  {0x33DC, kMapped, 2, 2795}, {0x33DD, kMapped, 2, 2797}, {0x33DE, kMapped, 3, 2799}, {0x33DF, kMapped, 3, 2802},
+  {0x33E0, kMapped, 2, 2805}, {0x33E1, kMapped, 2, 2807}, {0x33E2, kMapped, 2, 2809}, {0x33E3, kMapped, 2, 2811},
+  {0x33E4, kMapped, 2, 2813}, {0x33E5, kMapped, 2, 2815}, {0x33E6, kMapped, 2, 2817}, {0x33E7, kMapped, 2, 2819},
+  {0x33E8, kMapped, 2, 2821}, {0x33E9, kMapped, 3, 2823}, {0x33EA, kMapped, 3, 2826}, {0x33EB, kMapped, 3, 2829},
+  {0x33EC, kMapped, 3, 2832}, {0x33ED, kMapped, 3, 2835}, {0x33EE, kMapped, 3, 2838}, {0x33EF, kMapped, 3, 2841},
+  {0x33F0, kMapped, 3, 2844}, {0x33F1, kMapped, 3, 2847}, {0x33F2, kMapped, 3, 2850}, {0x33F3, kMapped, 3, 2853},
+  {0x33F4, kMapped, 3, 2856}, {0x33F5, kMapped, 3, 2859}, {0x33F6, kMapped, 3, 2862}, {0x33F7, kMapped, 3, 2865},
+  {0x33F8, kMapped, 3, 2868}, {0x33F9, kMapped, 3, 2871}, {0x33FA, kMapped, 3, 2874}, {0x33FB, kMapped, 3, 2877},
+  {0x33FC, kMapped, 3, 2880}, {0x33FD, kMapped, 3, 2883}, {0x33FE, kMapped, 3, 2886}, {0x33FF, kMapped, 3, 2889},
+  {0x3400, kValid, 0, 0}, {0xA48D, kDisallowed, 0, 0}, {0xA490, kValid, 0, 0}, {0xA4C7, kDisallowed, 0, 0},
+  {0xA4D0, kValid, 0, 0}, {0xA62C, kDisallowed, 0, 0}, {0xA640, kMapped, 1, 2892}, {0xA641, kValid, 0, 0},
+  {0xA642, kMapped, 1, 2893}, {0xA643, kValid, 0, 0}, {0xA644, kMapped, 1, 2894}, {0xA645, kValid, 0, 0},
+  {0xA646, kMapped, 1, 2895}, {0xA647, kValid, 0, 0}, {0xA648, kMapped, 1, 2896}, {0xA649, kValid, 0, 0},
+  {0xA64A, kMapped, 1, 628}, {0xA64B, kValid, 0, 0}, {0xA64C, kMapped, 1, 2897}, {0xA64D, kValid, 0, 0},
+  {0xA64E, kMapped, 1, 2898}, {0xA64F, kValid, 0, 0}, {0xA650, kMapped, 1, 2899}, {0xA651, kValid, 0, 0},
+  {0xA652, kMapped, 1, 2900}, {0xA653, kValid, 0, 0}, {0xA654, kMapped, 1, 2901}, {0xA655, kValid, 0, 0},
+  {0xA656, kMapped, 1, 2902}, {0xA657, kValid, 0, 0}, {0xA658, kMapped, 1, 2903}, {0xA659, kValid, 0, 0},
+  {0xA65A, kMapped, 1, 2904}, {0xA65B, kValid, 0, 0}, {0xA65C, kMapped, 1, 2905}, {0xA65D, kValid, 0, 0},
+  {0xA65E, kMapped, 1, 2906}, {0xA65F, kValid, 0, 0}, {0xA660, kMapped, 1, 2907}, {0xA661, kValid, 0, 0},
+  {0xA662, kMapped, 1, 2908}, {0xA663, kValid, 0, 0}, {0xA664, kMapped, 1, 2909}, {0xA665, kValid, 0, 0},
+  {0xA666, kMapped, 1, 2910}, {0xA667, kValid, 0, 0}, {0xA668, kMapped, 1, 2911}, {0xA669, kValid, 0, 0},
+  {0xA66A, kMapped, 1, 2912}, {0xA66B, kValid, 0, 0}, {0xA66C, kMapped, 1, 2913}, {0xA66D, kValid, 0, 0},
+  {0xA680, kMapped, 1, 2914}, {0xA681, kValid, 0, 0}, {0xA682, kMapped, 1, 2915}, {0xA683, kValid, 0, 0},
+  {0xA684, kMapped, 1, 2916}, {0xA685, kValid, 0, 0}, {0xA686, kMapped, 1, 2917}, {0xA687, kValid, 0, 0},
+  {0xA688, kMapped, 1, 2918}, {0xA689, kValid, 0, 0}, {0xA68A, kMapped, 1, 2919}, {0xA68B, kValid, 0, 0},
+  {0xA68C, kMapped, 1, 2920}, {0xA68D, kValid, 0, 0}, {0xA68E, kMapped, 1, 2921}, {0xA68F, kValid, 0, 0},
+  {0xA690, kMapped, 1, 2922}, {0xA691, kValid, 0, 0}, {0xA692, kMapped, 1, 2923}, {0xA693, kValid, 0, 0},
+  {0xA694, kMapped, 1, 2924}, {0xA695, kValid, 0, 0}, {0xA696, kMapped, 1, 2925}, {0xA697, kValid, 0, 0},
+  {0xA698, kMapped, 1, 2926}, {0xA699, kValid, 0, 0}, {0xA69A, kMapped, 1, 2927}, {0xA69B, kValid, 0, 0},
+  {0xA69C, kMapped, 1, 379}, {0xA69D, kMapped, 1, 381}, {0xA69E, kValid, 0, 0}, {0xA6F8, kDisallowed, 0, 0},
+  {0xA700, kValid, 0, 0}, {0xA722, kMapped, 1, 2928}, {0xA723, kValid, 0, 0}, {0xA724, kMapped, 1, 2929},
+  {0xA725, kValid, 0, 0}, {0xA726, kMapped, 1, 2930}, {0xA727, kValid, 0, 0}, {0xA728, kMapped, 1, 2931},
+  {0xA729, kValid, 0, 0}, {0xA72A, kMapped, 1, 2932}, {0xA72B, kValid, 0, 0}, {0xA72C, kMapped, 1, 2933},
+  {0xA72D, kValid, 0, 0}, {0xA72E, kMapped, 1, 2934}, {0xA72F, kValid, 0, 0}, {0xA732, kMapped, 1, 2935},
+  {0xA733, kValid, 0, 0}, {0xA734, kMapped, 1, 2936}, {0xA735, kValid, 0, 0}, {0xA736, kMapped, 1, 2937},
+  {0xA737, kValid, 0, 0}, {0xA738, kMapped, 1, 2938}, {0xA739, kValid, 0, 0}, {0xA73A, kMapped, 1, 2939},
+  {0xA73B, kValid, 0, 0}, {0xA73C, kMapped, 1, 2940}, {0xA73D, kValid, 0, 0}, {0xA73E, kMapped, 1, 2941},
+  {0xA73F, kValid, 0, 0}, {0xA740, kMapped, 1, 2942}, {0xA741, kValid, 0, 0}, {0xA742, kMapped, 1, 2943},
+  {0xA743, kValid, 0, 0}, {0xA744, kMapped, 1, 2944}, {0xA745, kValid, 0, 0}, {0xA746, kMapped, 1, 2945},
+  {0xA747, kValid, 0, 0}, {0xA748, kMapped, 1, 2946}, {0xA749, kValid, 0, 0}, {0xA74A, kMapped, 1, 2947},
+  {0xA74B, kValid, 0, 0}, {0xA74C, kMapped, 1, 2948}, {0xA74D, kValid, 0, 0}, {0xA74E, kMapped, 1, 2949},
+  {0xA74F, kValid, 0, 0}, {0xA750, kMapped, 1, 2950}, {0xA751, kValid, 0, 0}, {0xA752, kMapped, 1, 2951},
+  {0xA753, kValid, 0, 0}, {0xA754, kMapped, 1, 2952}, {0xA755, kValid, 0, 0}, {0xA756, kMapped, 1, 2953},
+  {0xA757, kValid, 0, 0}, {0xA758, kMapped, 1, 2954}, {0xA759, kValid, 0, 0}, {0xA75A, kMapped, 1, 2955},
+  {0xA75B, kValid, 0, 0}, {0xA75C, kMapped, 1, 2956}, {0xA75D, kValid, 0, 0}, {0xA75E, kMapped, 1, 2957},
+  {0xA75F, kValid, 0, 0}, {0xA760, kMapped, 1, 2958}, {0xA761, kValid, 0, 0}, {0xA762, kMapped, 1, 2959},
+  {0xA763, kValid, 0, 0}, {0xA764, kMapped, 1, 2960}, {0xA765, kValid, 0, 0}, {0xA766, kMapped, 1, 2961},
+  {0xA767, kValid, 0, 0}, {0xA768, kMapped, 1, 2962}, {0xA769, kValid, 0, 0}, {0xA76A, kMapped, 1, 2963},
+  {0xA76B, kValid, 0, 0}, {0xA76C, kMapped, 1, 2964}, {0xA76D, kValid, 0, 0}, {0xA76E, kMapped, 1, 2965},
+  {0xA76F, kValid, 0, 0}, {0xA770, kMapped, 1, 2965}, {0xA771, kValid, 0, 0}, {0xA779, kMapped, 1, 2966},
+  {0xA77A, kValid, 0, 0}, {0xA77B, kMapped, 1, 2967}, {0xA77C, kValid, 0, 0}, {0xA77D, kMapped, 1, 2968},
+  {0xA77E, kMapped, 1, 2969}, {0xA77F, kValid, 0, 0}, {0xA780, kMapped, 1, 2970}, {0xA781, kValid, 0, 0},
+  {0xA782, kMapped, 1, 2971}, {0xA783, kValid, 0, 0}, {0xA784, kMapped, 1, 2972}, {0xA785, kValid, 0, 0},
+  {0xA786, kMapped, 1, 2973}, {0xA787, kValid, 0, 0}, {0xA78B, kMapped, 1, 2974}, {0xA78C, kValid, 0, 0},
+  {0xA78D, kMapped, 1, 686}, {0xA78E, kValid, 0, 0}, {0xA790, kMapped, 1, 2975}, {0xA791, kValid, 0, 0},
+  {0xA792, kMapped, 1, 2976}, {0xA793, kValid, 0, 0}, {0xA796, kMapped, 1, 2977}, {0xA797, kValid, 0, 0},
+  {0xA798, kMapped, 1, 2978}, {0xA799, kValid, 0, 0}, {0xA79A, kMapped, 1, 2979}, {0xA79B, kValid, 0, 0},
+  {0xA79C, kMapped, 1, 2980}, {0xA79D, kValid, 0, 0}, {0xA79E, kMapped, 1, 2981}, {0xA79F, kValid, 0, 0},
+  {0xA7A0, kMapped, 1, 2982}, {0xA7A1, kValid, 0, 0}, {0xA7A2, kMapped, 1, 2983}, {0xA7A3, kValid, 0, 0},
+  {0xA7A4, kMapped, 1, 2984}, {0xA7A5, kValid, 0, 0}, {0xA7A6, kMapped, 1, 2985}, {0xA7A7, kValid, 0, 0},
+  {0xA7A8, kMapped, 1, 2986}, {0xA7A9, kValid, 0, 0}, {0xA7AA, kMapped, 1, 253}, {0xA7AB, kMapped, 1, 677},
+  {0xA7AC, kMapped, 1, 685}, {0xA7AD, kMapped, 1, 2987}, {0xA7AE, kMapped, 1, 687}, {0xA7AF, kValid, 0, 0},
+  {0xA7B0, kMapped, 1, 2988}, {0xA7B1, kMapped, 1, 2989}, {0xA7B2, kMapped, 1, 689}, {0xA7B3, kMapped, 1, 2990},
+  {0xA7B4, kMapped, 1, 2991}, {0xA7B5, kValid, 0, 0}, {0xA7B6, kMapped, 1, 2992}, {0xA7B7, kValid, 0, 0},
+  {0xA7B8, kMapped, 1, 2993}, {0xA7B9, kValid, 0, 0}, {0xA7BA, kMapped, 1, 2994}, {0xA7BB, kValid, 0, 0},
+  {0xA7BC, kMapped, 1, 2995}, {0xA7BD, kValid, 0, 0}, {0xA7BE, kMapped, 1, 2996}, {0xA7BF, kValid, 0, 0},
+  {0xA7C0, kMapped, 1, 2997}, {0xA7C1, kValid, 0, 0}, {0xA7C2, kMapped, 1, 2998}, {0xA7C3, kValid, 0, 0},
+  {0xA7C4, kMapped, 1, 2999}, {0xA7C5, kMapped, 1, 698}, {0xA7C6, kMapped, 1, 3000}, {0xA7C7, kMapped, 1, 3001},
+  {0xA7C8, kValid, 0, 0}, {0xA7C9, kMapped, 1, 3002}, {0xA7CA, kValid, 0, 0}, {0xA7CB, kDisallowed, 0, 0},
+  {0xA7D0, kMapped, 1, 3003}, {0xA7D1, kValid, 0, 0}, {0xA7D2, kDisallowed, 0, 0}, {0xA7D3, kValid, 0, 0},
+  {0xA7D4, kDisallowed, 0, 0}, {0xA7D5, kValid, 0, 0}, {0xA7D6, kMapped, 1, 3004}, {0xA7D7, kValid, 0, 0},
+  {0xA7D8, kMapped, 1, 3005}, {0xA7D9, kValid, 0, 0}, {0xA7DA, kDisallowed, 0, 0}, {0xA7F2, kMapped, 1, 2},
+  {0xA7F3, kMapped, 1, 5}, {0xA7F4, kMapped, 1, 16}, {0xA7F5, kMapped, 1, 3006}, {0xA7F6, kValid, 0, 0},
+  {0xA7F8, kMapped, 1, 97}, {0xA7F9, kMapped, 1, 123}, {0xA7FA, kValid, 0, 0}, {0xA82D, kDisallowed, 0, 0},
+  {0xA830, kValid, 0, 0}, {0xA83A, kDisallowed, 0, 0}, {0xA840, kValid, 0, 0}, {0xA878, kDisallowed, 0, 0},
+  {0xA880, kValid, 0, 0}, {0xA8C6, kDisallowed, 0, 0}, {0xA8CE, kValid, 0, 0}, {0xA8DA, kDisallowed, 0, 0},
+  {0xA8E0, kValid, 0, 0}, {0xA954, kDisallowed, 0, 0}, {0xA95F, kValid, 0, 0}, {0xA97D, kDisallowed, 0, 0},
+  {0xA980, kValid, 0, 0}, {0xA9CE, kDisallowed, 0, 0}, {0xA9CF, kValid, 0, 0}, {0xA9DA, kDisallowed, 0, 0},
+  {0xA9DE, kValid, 0, 0}, {0xA9FF, kDisallowed, 0, 0}, {0xAA00, kValid, 0, 0}, {0xAA37, kDisallowed, 0, 0},
+  {0xAA40, kValid, 0, 0}, {0xAA4E, kDisallowed, 0, 0}, {0xAA50, kValid, 0, 0}, {0xAA5A, kDisallowed, 0, 0},
+  {0xAA5C, kValid, 0, 0}, {0xAAC3, kDisallowed, 0, 0}, {0xAADB, kValid, 0, 0}, {0xAAF7, kDisallowed, 0, 0},
+  {0xAB01, kValid, 0, 0}, {0xAB07, kDisallowed, 0, 0}, {0xAB09, kValid, 0, 0}, {0xAB0F, kDisallowed, 0, 0},
+  {0xAB11, kValid, 0, 0}, {0xAB17, kDisallowed, 0, 0}, {0xAB20, kValid, 0, 0}, {0xAB27, kDisallowed, 0, 0},
+  {0xAB28, kValid, 0, 0}, {0xAB2F, kDisallowed, 0, 0}, {0xAB30, kValid, 0, 0}, {0xAB5C, kMapped, 1, 2930},
+  {0xAB5D, kMapped, 1, 3007}, {0xAB5E, kMapped, 1, 1390}, {0xAB5F, kMapped, 1, 3008}, {0xAB60, kValid, 0, 0},
+  {0xAB69, kMapped, 1, 3009}, {0xAB6A, kValid, 0, 0}, {0xAB6C, kDisallowed, 0, 0}, {0xAB70, kMapped, 1, 3010},
+  {0xAB71, kMapped, 1, 3011}, {0xAB72, kMapped, 1, 3012}, {0xAB73, kMapped, 1, 3013}, {0xAB74, kMapped, 1, 3014},
+  {0xAB75, kMapped, 1, 3015}, {0xAB76, kMapped, 1, 3016}, {0xAB77, kMapped, 1, 3017}, {0xAB78, kMapped, 1, 3018},
+  {0xAB79, kMapped, 1, 3019}, {0xAB7A, kMapped, 1, 3020}, {0xAB7B, kMapped, 1, 3021}, {0xAB7C, kMapped, 1, 3022},
+  {0xAB7D, kMapped, 1, 3023}, {0xAB7E, kMapped, 1, 3024}, {0xAB7F, kMapped, 1, 3025}, {0xAB80, kMapped, 1, 3026},
+  {0xAB81, kMapped, 1, 3027}, {0xAB82, kMapped, 1, 3028}, {0xAB83, kMapped, 1, 3029}, {0xAB84, kMapped, 1, 3030},
+  {0xAB85, kMapped, 1, 3031}, {0xAB86, kMapped, 1, 3032}, {0xAB87, kMapped, 1, 3033}, {0xAB88, kMapped, 1, 3034},
+  {0xAB89, kMapped, 1, 3035}, {0xAB8A, kMapped, 1, 3036}, {0xAB8B, kMapped, 1, 3037}, {0xAB8C, kMapped, 1, 3038},
+  {0xAB8D, kMapped, 1, 3039}, {0xAB8E, kMapped, 1, 3040}, {0xAB8F, kMapped, 1, 3041}, {0xAB90, kMapped, 1, 3042},
+  {0xAB91, kMapped, 1, 3043}, {0xAB92, kMapped, 1, 3044}, {0xAB93, kMapped, 1, 3045}, {0xAB94, kMapped, 1, 3046},
+  {0xAB95, kMapped, 1, 3047}, {0xAB96, kMapped, 1, 3048}, {0xAB97, kMapped, 1, 3049}, {0xAB98, kMapped, 1, 3050},
+  {0xAB99, kMapped, 1, 3051}, {0xAB9A, kMapped, 1, 3052}, {0xAB9B, kMapped, 1, 3053}, {0xAB9C, kMapped, 1, 3054},
+  {0xAB9D, kMapped, 1, 3055}, {0xAB9E, kMapped, 1, 3056}, {0xAB9F, kMapped, 1, 3057}, {0xABA0, kMapped, 1, 3058},
+  {0xABA1, kMapped, 1, 3059}, {0xABA2, kMapped, 1, 3060}, {0xABA3, kMapped, 1, 3061}, {0xABA4, kMapped, 1, 3062},
+  {0xABA5, kMapped, 1, 3063}, {0xABA6, kMapped, 1, 3064}, {0xABA7, kMapped, 1, 3065}, {0xABA8, kMapped, 1, 3066},
+  {0xABA9, kMapped, 1, 3067}, {0xABAA, kMapped, 1, 3068}, {0xABAB, kMapped, 1, 3069}, {0xABAC, kMapped, 1, 3070},
+  {0xABAD, kMapped, 1, 3071}, {0xABAE, kMapped, 1, 3072}, {0xABAF, kMapped, 1, 3073}, {0xABB0, kMapped, 1, 3074},
+  {0xABB1, kMapped, 1, 3075}, {0xABB2, kMapped, 1, 3076}, {0xABB3, kMapped, 1, 3077}, {0xABB4, kMapped, 1, 3078},
+  {0xABB5, kMapped, 1, 3079}, {0xABB6, kMapped, 1, 3080}, {0xABB7, kMapped, 1, 3081}, {0xABB8, kMapped, 1, 3082},
+  {0xABB9, kMapped, 1, 3083}, {0xABBA, kMapped, 1, 3084}, {0xABBB, kMapped, 1, 3085}, {0xABBC, kMapped, 1, 3086},
+  {0xABBD, kMapped, 1, 3087}, {0xABBE, kMapped, 1, 3088}, {0xABBF, kMapped, 1, 3089}, {0xABC0, kValid, 0, 0},
+  {0xABEE, kDisallowed, 0, 0}, {0xABF0, kValid, 0, 0}, {0xABFA, kDisallowed, 0, 0}, {0xAC00, kValid, 0, 0},
+  {0xD7A4, kDisallowed, 0, 0}, {0xD7B0, kValid, 0, 0}, {0xD7C7, kDisallowed, 0, 0}, {0xD7CB, kValid, 0, 0},
+  {0xD7FC, kDisallowed, 0, 0}, {0xF900, kMapped, 1, 3090}, {0xF901, kMapped, 1, 3091}, {0xF902, kMapped, 1, 1614},
+  {0xF903, kMapped, 1, 3092}, {0xF904, kMapped, 1, 3093}, {0xF905, kMapped, 1, 3094}, {0xF906, kMapped, 1, 3095},
+  {0xF907, kMapped, 1, 1668}, {0xF909, kMapped, 1, 3096}, {0xF90A, kMapped, 1, 1622}, {0xF90B, kMapped, 1, 3097},
+  {0xF90C, kMapped, 1, 3098}, {0xF90D, kMapped, 1, 3099}, {0xF90E, kMapped, 1, 3100}, {0xF90F, kMapped, 1, 3101},
+  {0xF910, kMapped, 1, 3102}, {0xF911, kMapped, 1, 3103}, {0xF912, kMapped, 1, 3104}, {0xF913, kMapped, 1, 3105},
+  {0xF914, kMapped, 1, 3106}, {0xF915, kMapped, 1, 3107}, {0xF916, kMapped, 1, 3108}, {0xF917, kMapped, 1, 3109},
+  {0xF918, kMapped, 1, 3110}, {0xF919, kMapped, 1, 3111}, {0xF91A, kMapped, 1, 3112}, {0xF91B, kMapped, 1, 3113},
+  {0xF91C, kMapped, 1, 3114}, {0xF91D, kMapped, 1, 3115}, {0xF91E, kMapped, 1, 3116}, {0xF91F, kMapped, 1, 3117},
+  {0xF920, kMapped, 1, 3118}, {0xF921, kMapped, 1, 3119}, {0xF922, kMapped, 1, 3120}, {0xF923, kMapped, 1, 3121},
+  {0xF924, kMapped, 1, 3122}, {0xF925, kMapped, 1, 3123}, {0xF926, kMapped, 1, 3124}, {0xF927, kMapped, 1, 3125},
+  {0xF928, kMapped, 1, 3126}, {0xF929, kMapped, 1, 3127}, {0xF92A, kMapped, 1, 3128}, {0xF92B, kMapped, 1, 3129},
+  {0xF92C, kMapped, 1, 3130}, {0xF92D, kMapped, 1, 3131}, {0xF92E, kMapped, 1, 3132}, {0xF92F, kMapped, 1, 3133},
+  {0xF930, kMapped, 1, 3134}, {0xF931, kMapped, 1, 3135}, {0xF932, kMapped, 1, 3136}, {0xF933, kMapped, 1, 3137},
+  {0xF934, kMapped, 1, 1580}, {0xF935, kMapped, 1, 3138}, {0xF936, kMapped, 1, 3139}, {0xF937, kMapped, 1, 3140},
+  {0xF938, kMapped, 1, 3141}, {0xF939, kMapped, 1, 3142}, {0xF93A, kMapped, 1, 3143}, {0xF93B, kMapped, 1, 3144},
+  {0xF93C, kMapped, 1, 3145}, {0xF93D, kMapped, 1, 3146}, {0xF93E, kMapped, 1, 3147}, {0xF93F, kMapped, 1, 3148},
+  {0xF940, kMapped, 1, 1653}, {0xF941, kMapped, 1, 3149}, {0xF942, kMapped, 1, 3150}, {0xF943, kMapped, 1, 3151},
+  {0xF944, kMapped, 1, 3152}, {0xF945, kMapped, 1, 3153}, {0xF946, kMapped, 1, 3154}, {0xF947, kMapped, 1, 3155},
+  {0xF948, kMapped, 1, 3156}, {0xF949, kMapped, 1, 3157}, {0xF94A, kMapped, 1, 3158}, {0xF94B, kMapped, 1, 3159},
+  {0xF94C, kMapped, 1, 3160}, {0xF94D, kMapped, 1, 3161}, {0xF94E, kMapped, 1, 3162}, {0xF94F, kMapped, 1, 3163},
+  {0xF950, kMapped, 1, 3164}, {0xF951, kMapped, 1, 3165}, {0xF952, kMapped, 1, 3166}, {0xF953, kMapped, 1, 3167},
+  {0xF954, kMapped, 1, 3168}, {0xF955, kMapped, 1, 3169}, {0xF956, kMapped, 1, 3170}, {0xF957, kMapped, 1, 3171},
+  {0xF958, kMapped, 1, 3172}, {0xF959, kMapped, 1, 3173}, {0xF95A, kMapped, 1, 3174}, {0xF95B, kMapped, 1, 3175},
+  {0xF95C, kMapped, 1, 3106}, {0xF95D, kMapped, 1, 3176}, {0xF95E, kMapped, 1, 3177}, {0xF95F, kMapped, 1, 3178},
+  {0xF960, kMapped, 1, 3179}, {0xF961, kMapped, 1, 3180}, {0xF962, kMapped, 1, 3181}, {0xF963, kMapped, 1, 3182},
+  {0xF964, kMapped, 1, 3183}, {0xF965, kMapped, 1, 3184}, {0xF966, kMapped, 1, 3185}, {0xF967, kMapped, 1, 3186},
+  {0xF968, kMapped, 1, 3187}, {0xF969, kMapped, 1, 3188}, {0xF96A, kMapped, 1, 3189}, {0xF96B, kMapped, 1, 3190},
+  {0xF96C, kMapped, 1, 3191}, {0xF96D, kMapped, 1, 3192}, {0xF96E, kMapped, 1, 3193}, {0xF96F, kMapped, 1, 3194},
+  {0xF970, kMapped, 1, 3195}, {0xF971, kMapped, 1, 1616}, {0xF972, kMapped, 1, 3196}, {0xF973, kMapped, 1, 3197},
+  {0xF974, kMapped, 1, 3198}, {0xF975, kMapped, 1, 3199}, {0xF976, kMapped, 1, 3200}, {0xF977, kMapped, 1, 3201},
+  {0xF978, kMapped, 1, 3202}, {0xF979, kMapped, 1, 3203}, {0xF97A, kMapped, 1, 3204}, {0xF97B, kMapped, 1, 3205},
+  {0xF97C, kMapped, 1, 3206}, {0xF97D, kMapped, 1, 3207}, {0xF97E, kMapped, 1, 3208}, {0xF97F, kMapped, 1, 3209},
+  {0xF980, kMapped, 1, 3210}, {0xF981, kMapped, 1, 1493}, {0xF982, kMapped, 1, 3211}, {0xF983, kMapped, 1, 3212},
+  {0xF984, kMapped, 1, 3213}, {0xF985, kMapped, 1, 3214}, {0xF986, kMapped, 1, 3215}, {0xF987, kMapped, 1, 3216},
+  {0xF988, kMapped, 1, 3217}, {0xF989, kMapped, 1, 3218}, {0xF98A, kMapped, 1, 1474}, {0xF98B, kMapped, 1, 3219},
+  {0xF98C, kMapped, 1, 3220}, {0xF98D, kMapped, 1, 3221}, {0xF98E, kMapped, 1, 3222}, {0xF98F, kMapped, 1, 3223},
+  {0xF990, kMapped, 1, 3224}, {0xF991, kMapped, 1, 3225}, {0xF992, kMapped, 1, 3226}, {0xF993, kMapped, 1, 3227},
+  {0xF994, kMapped, 1, 3228}, {0xF995, kMapped, 1, 3229}, {0xF996, kMapped, 1, 3230}, {0xF997, kMapped, 1, 3231},
+  {0xF998, kMapped, 1, 3232}, {0xF999, kMapped, 1, 3233}, {0xF99A, kMapped, 1, 3234}, {0xF99B, kMapped, 1, 3235},
+  {0xF99C, kMapped, 1, 3236}, {0xF99D, kMapped, 1, 3237}, {0xF99E, kMapped, 1, 3238}, {0xF99F, kMapped, 1, 3239},
+  {0xF9A0, kMapped, 1, 3240}, {0xF9A1, kMapped, 1, 3194}, {0xF9A2, kMapped, 1, 3241}, {0xF9A3, kMapped, 1, 3242},
+  {0xF9A4, kMapped, 1, 3243}, {0xF9A5, kMapped, 1, 3244}, {0xF9A6, kMapped, 1, 3245}, {0xF9A7, kMapped, 1, 3246},
+  {0xF9A8, kMapped, 1, 3247}, {0xF9A9, kMapped, 1, 3248}, {0xF9AA, kMapped, 1, 3178}, {0xF9AB, kMapped, 1, 3249},
+  {0xF9AC, kMapped, 1, 3250}, {0xF9AD, kMapped, 1, 3251}, {0xF9AE, kMapped, 1, 3252}, {0xF9AF, kMapped, 1, 3253},
+  {0xF9B0, kMapped, 1, 3254}, {0xF9B1, kMapped, 1, 3255}, {0xF9B2, kMapped, 1, 3256}, {0xF9B3, kMapped, 1, 3257},
+  {0xF9B4, kMapped, 1, 3258}, {0xF9B5, kMapped, 1, 3259}, {0xF9B6, kMapped, 1, 3260}, {0xF9B7, kMapped, 1, 3261},
+  {0xF9B8, kMapped, 1, 3262}, {0xF9B9, kMapped, 1, 3263}, {0xF9BA, kMapped, 1, 3264}, {0xF9BB, kMapped, 1, 3265},
+  {0xF9BC, kMapped, 1, 3266}, {0xF9BD, kMapped, 1, 3267}, {0xF9BE, kMapped, 1, 3268}, {0xF9BF, kMapped, 1, 3106},
+  {0xF9C0, kMapped, 1, 3269}, {0xF9C1, kMapped, 1, 3270}, {0xF9C2, kMapped, 1, 3271}, {0xF9C3, kMapped, 1, 3272},
+  {0xF9C4, kMapped, 1, 1667}, {0xF9C5, kMapped, 1, 3273}, {0xF9C6, kMapped, 1, 3274}, {0xF9C7, kMapped, 1, 3275},
+  {0xF9C8, kMapped, 1, 3276}, {0xF9C9, kMapped, 1, 3277}, {0xF9CA, kMapped, 1, 3278}, {0xF9CB, kMapped, 1, 3279},
+  {0xF9CC, kMapped, 1, 3280}, {0xF9CD, kMapped, 1, 3281}, {0xF9CE, kMapped, 1, 3282}, {0xF9CF, kMapped, 1, 3283},
+  {0xF9D0, kMapped, 1, 3284}, {0xF9D1, kMapped, 1, 2044}, {0xF9D2, kMapped, 1, 3285}, {0xF9D3, kMapped, 1, 3286},
+  {0xF9D4, kMapped, 1, 3287}, {0xF9D5, kMapped, 1, 3288}, {0xF9D6, kMapped, 1, 3289}, {0xF9D7, kMapped, 1, 3290},
+  {0xF9D8, kMapped, 1, 3291}, {0xF9D9, kMapped, 1, 3292}, {0xF9DA, kMapped, 1, 3293}, {0xF9DB, kMapped, 1, 3180},
+  {0xF9DC, kMapped, 1, 3294}, {0xF9DD, kMapped, 1, 3295}, {0xF9DE, kMapped, 1, 3296}, {0xF9DF, kMapped, 1, 3297},
+  {0xF9E0, kMapped, 1, 3298}, {0xF9E1, kMapped, 1, 3299}, {0xF9E2, kMapped, 1, 3300}, {0xF9E3, kMapped, 1, 3301},
+  {0xF9E4, kMapped, 1, 3302}, {0xF9E5, kMapped, 1, 3303}, {0xF9E6, kMapped, 1, 3304}, {0xF9E7, kMapped, 1, 3305},
+  {0xF9E8, kMapped, 1, 3306}, {0xF9E9, kMapped, 1, 1621}, {0xF9EA, kMapped, 1, 3307}, {0xF9EB, kMapped, 1, 3308},
+  {0xF9EC, kMapped, 1, 3309}, {0xF9ED, kMapped, 1, 3310}, {0xF9EE, kMapped, 1, 3311}, {0xF9EF, kMapped, 1, 3312},
+  {0xF9F0, kMapped, 1, 3313}, {0xF9F1, kMapped, 1, 3314}, {0xF9F2, kMapped, 1, 3315}, {0xF9F3, kMapped, 1, 3316},
+  {0xF9F4, kMapped, 1, 3317}, {0xF9F5, kMapped, 1, 3318}, {0xF9F6, kMapped, 1, 3319}, {0xF9F7, kMapped, 1, 1572},
+  {0xF9F8, kMapped, 1, 3320}, {0xF9F9, kMapped, 1, 3321}, {0xF9FA, kMapped, 1, 3322}, {0xF9FB, kMapped, 1, 3323},
+  {0xF9FC, kMapped, 1, 3324}, {0xF9FD, kMapped, 1, 3325}, {0xF9FE, kMapped, 1, 3326}, {0xF9FF, kMapped, 1, 3327},
+  {0xFA00, kMapped, 1, 3328}, {0xFA01, kMapped, 1, 3329}, {0xFA02, kMapped, 1, 3330}, {0xFA03, kMapped, 1, 3331},
+  {0xFA04, kMapped, 1, 3332}, {0xFA05, kMapped, 1, 3333}, {0xFA06, kMapped, 1, 3334}, {0xFA07, kMapped, 1, 3335},
+  {0xFA08, kMapped, 1, 1599}, {0xFA09, kMapped, 1, 3336}, {0xFA0A, kMapped, 1, 1602}, {0xFA0B, kMapped, 1, 3337},
+  {0xFA0C, kMapped, 1, 3338}, {0xFA0D, kMapped, 1, 3339}, {0xFA0E, kValid, 0, 0}, {0xFA10, kMapped, 1, 3340},
+  {0xFA11, kValid, 0, 0}, {0xFA12, kMapped, 1, 3341}, {0xFA13, kValid, 0, 0}, {0xFA15, kMapped, 1, 3342},
+  {0xFA16, kMapped, 1, 3343}, {0xFA17, kMapped, 1, 3344}, {0xFA18, kMapped, 1, 3345}, {0xFA19, kMapped, 1, 3346},
+  {0xFA1A, kMapped, 1, 3347}, {0xFA1B, kMapped, 1, 3348}, {0xFA1C, kMapped, 1, 3349}, {0xFA1D, kMapped, 1, 3350},
+  {0xFA1E, kMapped, 1, 1579}, {0xFA1F, kValid, 0, 0}, {0xFA20, kMapped, 1, 3351}, {0xFA21, kValid, 0, 0},
+  {0xFA22, kMapped, 1, 3352}, {0xFA23, kValid, 0, 0}, {0xFA25, kMapped, 1, 3353}, {0xFA26, kMapped, 1, 3354},
+  {0xFA27, kValid, 0, 0}, {0xFA2A, kMapped, 1, 3355}, {0xFA2B, kMapped, 1, 3356}, {0xFA2C, kMapped, 1, 3357},
+  {0xFA2D, kMapped, 1, 3358}, {0xFA2E, kMapped, 1, 3359}, {0xFA2F, kMapped, 1, 3360}, {0xFA30, kMapped, 1, 3361},
+  {0xFA31, kMapped, 1, 3362}, {0xFA32, kMapped, 1, 3363}, {0xFA33, kMapped, 1, 3364}, {0xFA34, kMapped, 1, 3365},
+  {0xFA35, kMapped, 1, 3366}, {0xFA36, kMapped, 1, 3367}, {0xFA37, kMapped, 1, 3368}, {0xFA38, kMapped, 1, 3369},
+  {0xFA39, kMapped, 1, 3370}, {0xFA3A, kMapped, 1, 3371}, {0xFA3B, kMapped, 1, 3372}, {0xFA3C, kMapped, 1, 1500},
+  {0xFA3D, kMapped, 1, 3373}, {0xFA3E, kMapped, 1, 3374}, {0xFA3F, kMapped, 1, 3375}, {0xFA40, kMapped, 1, 3376},
+  {0xFA41, kMapped, 1, 3377}, {0xFA42, kMapped, 1, 3378}, {0xFA43, kMapped, 1, 3379}, {0xFA44, kMapped, 1, 3380},
+  {0xFA45, kMapped, 1, 3381}, {0xFA46, kMapped, 1, 3382}, {0xFA47, kMapped, 1, 3383}, {0xFA48, kMapped, 1, 3384},
+  {0xFA49, kMapped, 1, 3385}, {0xFA4A, kMapped, 1, 3386}, {0xFA4B, kMapped, 1, 3387}, {0xFA4C, kMapped, 1, 2049},
+  {0xFA4D, kMapped, 1, 3388}, {0xFA4E, kMapped, 1, 3389}, {0xFA4F, kMapped, 1, 3390}, {0xFA50, kMapped, 1, 3391},
+  {0xFA51, kMapped, 1, 2053}, {0xFA52, kMapped, 1, 3392}, {0xFA53, kMapped, 1, 3393}, {0xFA54, kMapped, 1, 3394},
+  {0xFA55, kMapped, 1, 3395}, {0xFA56, kMapped, 1, 3396}, {0xFA57, kMapped, 1, 3230}, {0xFA58, kMapped, 1, 3397},
+  {0xFA59, kMapped, 1, 3398}, {0xFA5A, kMapped, 1, 3399}, {0xFA5B, kMapped, 1, 3400}, {0xFA5C, kMapped, 1, 3401},
+  {0xFA5D, kMapped, 1, 3402}, {0xFA5F, kMapped, 1, 3403}, {0xFA60, kMapped, 1, 3404}, {0xFA61, kMapped, 1, 3405},
+  {0xFA62, kMapped, 1, 3406}, {0xFA63, kMapped, 1, 3407}, {0xFA64, kMapped, 1, 3408}, {0xFA65, kMapped, 1, 3409},
+  {0xFA66, kMapped, 1, 3410}, {0xFA67, kMapped, 1, 3353}, {0xFA68, kMapped, 1, 3411}, {0xFA69, kMapped, 1, 3412},
+  {0xFA6A, kMapped, 1, 3413}, {0xFA6B, kMapped, 1, 3414}, {0xFA6C, kMapped, 1, 3415}, {0xFA6D, kMapped, 1, 3416},
+  {0xFA6E, kDisallowed, 0, 0}, {0xFA70, kMapped, 1, 3417}, {0xFA71, kMapped, 1, 3418}, {0xFA72, kMapped, 1, 3419},
+  {0xFA73, kMapped, 1, 3420}, {0xFA74, kMapped, 1, 3421}, {0xFA75, kMapped, 1, 3422}, {0xFA76, kMapped, 1, 3423},
+  {0xFA77, kMapped, 1, 3424}, {0xFA78, kMapped, 1, 3367}, {0xFA79, kMapped, 1, 3425}, {0xFA7A, kMapped, 1, 3426},
+  {0xFA7B, kMapped, 1, 3427}, {0xFA7C, kMapped, 1, 3340}, {0xFA7D, kMapped, 1, 3428}, {0xFA7E, kMapped, 1, 3429},
+  {0xFA7F, kMapped, 1, 3430}, {0xFA80, kMapped, 1, 3431}, {0xFA81, kMapped, 1, 3432}, {0xFA82, kMapped, 1, 3433},
+  {0xFA83, kMapped, 1, 3434}, {0xFA84, kMapped, 1, 3435}, {0xFA85, kMapped, 1, 3436}, {0xFA86, kMapped, 1, 3437},
+  {0xFA87, kMapped, 1, 3438}, {0xFA88, kMapped, 1, 3439}, {0xFA89, kMapped, 1, 3375}, {0xFA8A, kMapped, 1, 3440},
+  {0xFA8B, kMapped, 1, 3376}, {0xFA8C, kMapped, 1, 3441}, {0xFA8D, kMapped, 1, 3442}, {0xFA8E, kMapped, 1, 3443},
+  {0xFA8F, kMapped, 1, 3444}, {0xFA90, kMapped, 1, 3445}, {0xFA91, kMapped, 1, 3341}, {0xFA92, kMapped, 1, 3127},
+  {0xFA93, kMapped, 1, 3446}, {0xFA94, kMapped, 1, 3447}, {0xFA95, kMapped, 1, 1533}, {0xFA96, kMapped, 1, 3195},
+  {0xFA97, kMapped, 1, 3278}, {0xFA98, kMapped, 1, 3448}, {0xFA99, kMapped, 1, 3449}, {0xFA9A, kMapped, 1, 3383},
+  {0xFA9B, kMapped, 1, 3450}, {0xFA9C, kMapped, 1, 3384}, {0xFA9D, kMapped, 1, 3451}, {0xFA9E, kMapped, 1, 3452},
+  {0xFA9F, kMapped, 1, 3453}, {0xFAA0, kMapped, 1, 3343}, {0xFAA1, kMapped, 1, 3454}, {0xFAA2, kMapped, 1, 3455},
+  {0xFAA3, kMapped, 1, 3456}, {0xFAA4, kMapped, 1, 3457}, {0xFAA5, kMapped, 1, 3458}, {0xFAA6, kMapped, 1, 3344},
+  {0xFAA7, kMapped, 1, 3459}, {0xFAA8, kMapped, 1, 3460}, {0xFAA9, kMapped, 1, 3461}, {0xFAAA, kMapped, 1, 3462},
+  {0xFAAB, kMapped, 1, 3463}, {0xFAAC, kMapped, 1, 3464}, {0xFAAD, kMapped, 1, 3396}, {0xFAAE, kMapped, 1, 3465},
+  {0xFAAF, kMapped, 1, 3466}, {0xFAB0, kMapped, 1, 3230}, {0xFAB1, kMapped, 1, 3467}, {0xFAB2, kMapped, 1, 3400},
+  {0xFAB3, kMapped, 1, 3468}, {0xFAB4, kMapped, 1, 3469}, {0xFAB5, kMapped, 1, 3470}, {0xFAB6, kMapped, 1, 3471},
+  {0xFAB7, kMapped, 1, 3472}, {0xFAB8, kMapped, 1, 3405}, {0xFAB9, kMapped, 1, 3473}, {0xFABA, kMapped, 1, 3352},
+  {0xFABB, kMapped, 1, 3474}, {0xFABC, kMapped, 1, 3406}, {0xFABD, kMapped, 1, 3176}, {0xFABE, kMapped, 1, 3475},
+  {0xFABF, kMapped, 1, 3407}, {0xFAC0, kMapped, 1, 3476}, {0xFAC1, kMapped, 1, 3409}, {0xFAC2, kMapped, 1, 3477},
+  {0xFAC3, kMapped, 1, 3478}, {0xFAC4, kMapped, 1, 3479}, {0xFAC5, kMapped, 1, 3480}, {0xFAC6, kMapped, 1, 3481},
+  {0xFAC7, kMapped, 1, 3411}, {0xFAC8, kMapped, 1, 3349}, {0xFAC9, kMapped, 1, 3482}, {0xFACA, kMapped, 1, 3412},
+  {0xFACB, kMapped, 1, 3483}, {0xFACC, kMapped, 1, 3413}, {0xFACD, kMapped, 1, 3484}, {0xFACE, kMapped, 1, 1668},
+  {0xFACF, kMapped, 1, 3485}, {0xFAD0, kMapped, 1, 3486}, {0xFAD1, kMapped, 1, 3487}, {0xFAD2, kMapped, 1, 3488},
+  {0xFAD3, kMapped, 1, 3489}, {0xFAD4, kMapped, 1, 3490}, {0xFAD5, kMapped, 1, 3491}, {0xFAD6, kMapped, 1, 3492},
+  {0xFAD7, kMapped, 1, 3493}, {0xFAD8, kMapped, 1, 3494}, {0xFAD9, kMapped, 1, 3495}, {0xFADA, kDisallowed, 0, 0},
+  {0xFB00, kMapped, 2, 3496}, {0xFB01, kMapped, 2, 3498}, {0xFB02, kMapped, 2, 3500}, {0xFB03, kMapped, 3, 3502},
+  {0xFB04, kMapped, 3, 3505}, {0xFB05, kMapped, 2, 3508}, {0xFB07, kDisallowed, 0, 0}, {0xFB13, kMapped, 2, 3510},
+  {0xFB14, kMapped, 2, 3512}, {0xFB15, kMapped, 2, 3514}, {0xFB16, kMapped, 2, 3516}, {0xFB17, kMapped, 2, 3518},
+  {0xFB18, kDisallowed, 0, 0}, {0xFB1D, kMapped, 2, 3520}, {0xFB1E, kValid, 0, 0}, {0xFB1F, kMapped, 2, 3522},
+  {0xFB20, kMapped, 1, 3524}, {0xFB21, kMapped, 1, 1062}, {0xFB22, kMapped, 1, 1065}, {0xFB23, kMapped, 1, 3525},
+  {0xFB24, kMapped, 1, 3526}, {0xFB25, kMapped, 1, 3527}, {0xFB26, kMapped, 1, 3528}, {0xFB27, kMapped, 1, 3529},
+  {0xFB28, kMapped, 1, 3530}, {0xFB29, kMapped, 1, 1030}, {0xFB2A, kMapped, 2, 3531}, {0xFB2B, kMapped, 2, 3533},
+  {0xFB2C, kMapped, 3, 3535}, {0xFB2D, kMapped, 3, 3538}, {0xFB2E, kMapped, 2, 3541}, {0xFB2F, kMapped, 2, 3543},
+  {0xFB30, kMapped, 2, 3545}, {0xFB31, kMapped, 2, 3547}, {0xFB32, kMapped, 2, 3549}, {0xFB33, kMapped, 2, 3551},
+  {0xFB34, kMapped, 2, 3553}, {0xFB35, kMapped, 2, 3555}, {0xFB36, kMapped, 2, 3557}, {0xFB37, kDisallowed, 0, 0},
+  {0xFB38, kMapped, 2, 3559}, {0xFB39, kMapped, 2, 3561}, {0xFB3A, kMapped, 2, 3563}, {0xFB3B, kMapped, 2, 3565},
+  {0xFB3C, kMapped, 2, 3567}, {0xFB3D, kDisallowed, 0, 0}, {0xFB3E, kMapped, 2, 3569}, {0xFB3F, kDisallowed, 0, 0},
+  {0xFB40, kMapped, 2, 3571}, {0xFB41, kMapped, 2, 3573}, {0xFB42, kDisallowed, 0, 0}, {0xFB43, kMapped, 2, 3575},
+  {0xFB44, kMapped, 2, 3577}, {0xFB45, kDisallowed, 0, 0}, {0xFB46, kMapped, 2, 3579}, {0xFB47, kMapped, 2, 3581},
+  {0xFB48, kMapped, 2, 3583}, {0xFB49, kMapped, 2, 3585}, {0xFB4A, kMapped, 2, 3587}, {0xFB4B, kMapped, 2, 3589},
+  {0xFB4C, kMapped, 2, 3591}, {0xFB4D, kMapped, 2, 3593}, {0xFB4E, kMapped, 2, 3595}, {0xFB4F, kMapped, 2, 3597},
+  {0xFB50, kMapped, 1, 3599}, {0xFB52, kMapped, 1, 3600}, {0xFB56, kMapped, 1, 3601}, {0xFB5A, kMapped, 1, 3602},
+  {0xFB5E, kMapped, 1, 3603}, {0xFB62, kMapped, 1, 3604}, {0xFB66, kMapped, 1, 3605}, {0xFB6A, kMapped, 1, 3606},
+  {0xFB6E, kMapped, 1, 3607}, {0xFB72, kMapped, 1, 3608}, {0xFB76, kMapped, 1, 3609}, {0xFB7A, kMapped, 1, 3610},
+  {0xFB7E, kMapped, 1, 3611}, {0xFB82, kMapped, 1, 3612}, {0xFB84, kMapped, 1, 3613}, {0xFB86, kMapped, 1, 3614},
+  {0xFB88, kMapped, 1, 3615}, {0xFB8A, kMapped, 1, 3616}, {0xFB8C, kMapped, 1, 3617}, {0xFB8E, kMapped, 1, 3618},
+  {0xFB92, kMapped, 1, 3619}, {0xFB96, kMapped, 1, 3620}, {0xFB9A, kMapped, 1, 3621}, {0xFB9E, kMapped, 1, 3622},
+  {0xFBA0, kMapped, 1, 3623}, {0xFBA4, kMapped, 1, 3624}, {0xFBA6, kMapped, 1, 3625}, {0xFBAA, kMapped, 1, 3626},
+  {0xFBAE, kMapped, 1, 3627}, {0xFBB0, kMapped, 1, 3628}, {0xFBB2, kValid, 0, 0}, {0xFBC3, kDisallowed, 0, 0},
+  {0xFBD3, kMapped, 1, 3629}, {0xFBD7, kMapped, 1, 3630}, {0xFBD9, kMapped, 1, 3631}, {0xFBDB, kMapped, 1, 3632},
+  {0xFBDD, kMapped, 2, 528}, {0xFBDE, kMapped, 1, 3633}, {0xFBE0, kMapped, 1, 3634}, {0xFBE2, kMapped, 1, 3635},
+  {0xFBE4, kMapped, 1, 3636}, {0xFBE8, kMapped, 1, 3637}, {0xFBEA, kMapped, 2, 3638}, {0xFBEC, kMapped, 2, 3640},
+  {0xFBEE, kMapped, 2, 3642}, {0xFBF0, kMapped, 2, 3644}, {0xFBF2, kMapped, 2, 3646}, {0xFBF4, kMapped, 2, 3648},
+  {0xFBF6, kMapped, 2, 3650}, {0xFBF9, kMapped, 2, 3652}, {0xFBFC, kMapped, 1, 3654}, {0xFC00, kMapped, 2, 3655},
+  {0xFC01, kMapped, 2, 3657}, {0xFC02, kMapped, 2, 3659}, {0xFC03, kMapped, 2, 3652}, {0xFC04, kMapped, 2, 3661},
+  {0xFC05, kMapped, 2, 3663}, {0xFC06, kMapped, 2, 3665}, {0xFC07, kMapped, 2, 3667}, {0xFC08, kMapped, 2, 3669},
+  {0xFC09, kMapped, 2, 3671}, {0xFC0A, kMapped, 2, 3673}, {0xFC0B, kMapped, 2, 3675}, {0xFC0C, kMapped, 2, 3677},
+  {0xFC0D, kMapped, 2, 3679}, {0xFC0E, kMapped, 2, 3681}, {0xFC0F, kMapped, 2, 3683}, {0xFC10, kMapped, 2, 3685},
+  {0xFC11, kMapped, 2, 3687}, {0xFC12, kMapped, 2, 3689}, {0xFC13, kMapped, 2, 3691}, {0xFC14, kMapped, 2, 3693},
+  {0xFC15, kMapped, 2, 3695}, {0xFC16, kMapped, 2, 3697}, {0xFC17, kMapped, 2, 3699}, {0xFC18, kMapped, 2, 3701},
+  {0xFC19, kMapped, 2, 3703}, {0xFC1A, kMapped, 2, 3705}, {0xFC1B, kMapped, 2, 3707}, {0xFC1C, kMapped, 2, 3709},
+  {0xFC1D, kMapped, 2, 3711}, {0xFC1E, kMapped, 2, 3713}, {0xFC1F, kMapped, 2, 3715}, {0xFC20, kMapped, 2, 3717},
+  {0xFC21, kMapped, 2, 3719}, {0xFC22, kMapped, 2, 3721}, {0xFC23, kMapped, 2, 3723}, {0xFC24, kMapped, 2, 3725},
+  {0xFC25, kMapped, 2, 3727}, {0xFC26, kMapped, 2, 3729}, {0xFC27, kMapped, 2, 3731}, {0xFC28, kMapped, 2, 3733},
+  {0xFC29, kMapped, 2, 3735}, {0xFC2A, kMapped, 2, 3737}, {0xFC2B, kMapped, 2, 3739}, {0xFC2C, kMapped, 2, 3741},
+  {0xFC2D, kMapped, 2, 3743}, {0xFC2E, kMapped, 2, 3745}, {0xFC2F, kMapped, 2, 3747}, {0xFC30, kMapped, 2, 3749},
+  {0xFC31, kMapped, 2, 3751}, {0xFC32, kMapped, 2, 3753}, {0xFC33, kMapped, 2, 3755}, {0xFC34, kMapped, 2, 3757},
+  {0xFC35, kMapped, 2, 3759}, {0xFC36, kMapped, 2, 3761}, {0xFC37, kMapped, 2, 3763}, {0xFC38, kMapped, 2, 3765},
+  {0xFC39, kMapped, 2, 3767}, {0xFC3A, kMapped, 2, 3769}, {0xFC3B, kMapped, 2, 3771}, {0xFC3C, kMapped, 2, 3773},
+  {0xFC3D, kMapped, 2, 3775}, {0xFC3E, kMapped, 2, 3777}, {0xFC3F, kMapped, 2, 3779}, {0xFC40, kMapped, 2, 3781},
+  {0xFC41, kMapped, 2, 3783}, {0xFC42, kMapped, 2, 3785}, {0xFC43, kMapped, 2, 3787}, {0xFC44, kMapped, 2, 3789},
+  {0xFC45, kMapped, 2, 3791}, {0xFC46, kMapped, 2, 3793}, {0xFC47, kMapped, 2, 3795}, {0xFC48, kMapped, 2, 3797},
+  {0xFC49, kMapped, 2, 3799}, {0xFC4A, kMapped, 2, 3801}, {0xFC4B, kMapped, 2, 3803}, {0xFC4C, kMapped, 2, 3805},
+  {0xFC4D, kMapped, 2, 3807}, {0xFC4E, kMapped, 2, 3809}, {0xFC4F, kMapped, 2, 3811}, {0xFC50, kMapped, 2, 3813},
+  {0xFC51, kMapped, 2, 3815}, {0xFC52, kMapped, 2, 3817}, {0xFC53, kMapped, 2, 3819}, {0xFC54, kMapped, 2, 3821},
+  {0xFC55, kMapped, 2, 3823}, {0xFC56, kMapped, 2, 3825}, {0xFC57, kMapped, 2, 3827}, {0xFC58, kMapped, 2, 3829},
+  {0xFC59, kMapped, 2, 3831}, {0xFC5A, kMapped, 2, 3833}, {0xFC5B, kMapped, 2, 3835}, {0xFC5C, kMapped, 2, 3837},
+  {0xFC5D, kMapped, 2, 3839}, {0xFC5E, kMapped, 3, 3841}, {0xFC5F, kMapped, 3, 3844}, {0xFC60, kMapped, 3, 3847},
+  {0xFC61, kMapped, 3, 3850}, {0xFC62, kMapped, 3, 3853}, {0xFC63, kMapped, 3, 3856}, {0xFC64, kMapped, 2, 3859},
+  {0xFC65, kMapped, 2, 3861}, {0xFC66, kMapped, 2, 3659}, {0xFC67, kMapped, 2, 3863}, {0xFC68, kMapped, 2, 3652},
+  {0xFC69, kMapped, 2, 3661}, {0xFC6A, kMapped, 2, 3865}, {0xFC6B, kMapped, 2, 3867}, {0xFC6C, kMapped, 2, 3669},
+  {0xFC6D, kMapped, 2, 3869}, {0xFC6E, kMapped, 2, 3671}, {0xFC6F, kMapped, 2, 3673}, {0xFC70, kMapped, 2, 3871},
+  {0xFC71, kMapped, 2, 3873}, {0xFC72, kMapped, 2, 3681}, {0xFC73, kMapped, 2, 3875}, {0xFC74, kMapped, 2, 3683},
+  {0xFC75, kMapped, 2, 3685}, {0xFC76, kMapped, 2, 3877}, {0xFC77, kMapped, 2, 3879}, {0xFC78, kMapped, 2, 3689},
+  {0xFC79, kMapped, 2, 3881}, {0xFC7A, kMapped, 2, 3691}, {0xFC7B, kMapped, 2, 3693}, {0xFC7C, kMapped, 2, 3751},
+  {0xFC7D, kMapped, 2, 3753}, {0xFC7E, kMapped, 2, 3759}, {0xFC7F, kMapped, 2, 3761}, {0xFC80, kMapped, 2, 3763},
+  {0xFC81, kMapped, 2, 3771}, {0xFC82, kMapped, 2, 3773}, {0xFC83, kMapped, 2, 3775}, {0xFC84, kMapped, 2, 3777},
+  {0xFC85, kMapped, 2, 3785}, {0xFC86, kMapped, 2, 3787}, {0xFC87, kMapped, 2, 3789}, {0xFC88, kMapped, 2, 3883},
+  {0xFC89, kMapped, 2, 3797}, {0xFC8A, kMapped, 2, 3885}, {0xFC8B, kMapped, 2, 3887}, {0xFC8C, kMapped, 2, 3809},
+  {0xFC8D, kMapped, 2, 3889}, {0xFC8E, kMapped, 2, 3811}, {0xFC8F, kMapped, 2, 3813}, {0xFC90, kMapped, 2, 3839},
+  {0xFC91, kMapped, 2, 3891}, {0xFC92, kMapped, 2, 3893}, {0xFC93, kMapped, 2, 3829}, {0xFC94, kMapped, 2, 3895},
+  {0xFC95, kMapped, 2, 3831}, {0xFC96, kMapped, 2, 3833}, {0xFC97, kMapped, 2, 3655}, {0xFC98, kMapped, 2, 3657},
+  {0xFC99, kMapped, 2, 3897}, {0xFC9A, kMapped, 2, 3659}, {0xFC9B, kMapped, 2, 3899}, {0xFC9C, kMapped, 2, 3663},
+  {0xFC9D, kMapped, 2, 3665}, {0xFC9E, kMapped, 2, 3667}, {0xFC9F, kMapped, 2, 3669}, {0xFCA0, kMapped, 2, 3901},
+  {0xFCA1, kMapped, 2, 3675}, {0xFCA2, kMapped, 2, 3677}, {0xFCA3, kMapped, 2, 3679}, {0xFCA4, kMapped, 2, 3681},
+  {0xFCA5, kMapped, 2, 3903}, {0xFCA6, kMapped, 2, 3689}, {0xFCA7, kMapped, 2, 3695}, {0xFCA8, kMapped, 2, 3697},
+  {0xFCA9, kMapped, 2, 3699}, {0xFCAA, kMapped, 2, 3701}, {0xFCAB, kMapped, 2, 3703}, {0xFCAC, kMapped, 2, 3707},
+  {0xFCAD, kMapped, 2, 3709}, {0xFCAE, kMapped, 2, 3711}, {0xFCAF, kMapped, 2, 3713}, {0xFCB0, kMapped, 2, 3715},
+  {0xFCB1, kMapped, 2, 3717}, {0xFCB2, kMapped, 2, 3905}, {0xFCB3, kMapped, 2, 3719}, {0xFCB4, kMapped, 2, 3721},
+  {0xFCB5, kMapped, 2, 3723}, {0xFCB6, kMapped, 2, 3725}, {0xFCB7, kMapped, 2, 3727}, {0xFCB8, kMapped, 2, 3729},
+  {0xFCB9, kMapped, 2, 3733}, {0xFCBA, kMapped, 2, 3735}, {0xFCBB, kMapped, 2, 3737}, {0xFCBC, kMapped, 2, 3739},
+  {0xFCBD, kMapped, 2, 3741}, {0xFCBE, kMapped, 2, 3743}, {0xFCBF, kMapped, 2, 3745}, {0xFCC0, kMapped, 2, 3747},
+  {0xFCC1, kMapped, 2, 3749}, {0xFCC2, kMapped, 2, 3755}, {0xFCC3, kMapped, 2, 3757}, {0xFCC4, kMapped, 2, 3765},
+  {0xFCC5, kMapped, 2, 3767}, {0xFCC6, kMapped, 2, 3769}, {0xFCC7, kMapped, 2, 3771}, {0xFCC8, kMapped, 2, 3773},
+  {0xFCC9, kMapped, 2, 3779}, {0xFCCA, kMapped, 2, 3781}, {0xFCCB, kMapped, 2, 3783}, {0xFCCC, kMapped, 2, 3785},
+  {0xFCCD, kMapped, 2, 3907}, {0xFCCE, kMapped, 2, 3791}, {0xFCCF, kMapped, 2, 3793}, {0xFCD0, kMapped, 2, 3795},
+  {0xFCD1, kMapped, 2, 3797}, {0xFCD2, kMapped, 2, 3803}, {0xFCD3, kMapped, 2, 3805}, {0xFCD4, kMapped, 2, 3807},
+  {0xFCD5, kMapped, 2, 3809}, {0xFCD6, kMapped, 2, 3909}, {0xFCD7, kMapped, 2, 3815}, {0xFCD8, kMapped, 2, 3817},
+  {0xFCD9, kMapped, 2, 3911}, {0xFCDA, kMapped, 2, 3823}, {0xFCDB, kMapped, 2, 3825}, {0xFCDC, kMapped, 2, 3827},
+  {0xFCDD, kMapped, 2, 3829}, {0xFCDE, kMapped, 2, 3913}, {0xFCDF, kMapped, 2, 3659}, {0xFCE0, kMapped, 2, 3899},
+  {0xFCE1, kMapped, 2, 3669}, {0xFCE2, kMapped, 2, 3901}, {0xFCE3, kMapped, 2, 3681}, {0xFCE4, kMapped, 2, 3903},
+  {0xFCE5, kMapped, 2, 3689}, {0xFCE6, kMapped, 2, 3915}, {0xFCE7, kMapped, 2, 3715}, {0xFCE8, kMapped, 2, 3917},
+  {0xFCE9, kMapped, 2, 3919}, {0xFCEA, kMapped, 2, 3921}, {0xFCEB, kMapped, 2, 3771}, {0xFCEC, kMapped, 2, 3773},
+  {0xFCED, kMapped, 2, 3785}, {0xFCEE, kMapped, 2, 3809}, {0xFCEF, kMapped, 2, 3909}, {0xFCF0, kMapped, 2, 3829},
+  {0xFCF1, kMapped, 2, 3913}, {0xFCF2, kMapped, 3, 3923}, {0xFCF3, kMapped, 3, 3926}, {0xFCF4, kMapped, 3, 3929},
+  {0xFCF5, kMapped, 2, 3932}, {0xFCF6, kMapped, 2, 3934}, {0xFCF7, kMapped, 2, 3936}, {0xFCF8, kMapped, 2, 3938},
+  {0xFCF9, kMapped, 2, 3940}, {0xFCFA, kMapped, 2, 3942}, {0xFCFB, kMapped, 2, 3944}, {0xFCFC, kMapped, 2, 3946},
+  {0xFCFD, kMapped, 2, 3948}, {0xFCFE, kMapped, 2, 3950}, {0xFCFF, kMapped, 2, 3952}, {0xFD00, kMapped, 2, 3954},
+  {0xFD01, kMapped, 2, 3956}, {0xFD02, kMapped, 2, 3958}, {0xFD03, kMapped, 2, 3960}, {0xFD04, kMapped, 2, 3962},
+  {0xFD05, kMapped, 2, 3964}, {0xFD06, kMapped, 2, 3966}, {0xFD07, kMapped, 2, 3968}, {0xFD08, kMapped, 2, 3970},
+  {0xFD09, kMapped, 2, 3972}, {0xFD0A, kMapped, 2, 3974}, {0xFD0B, kMapped, 2, 3976}, {0xFD0C, kMapped, 2, 3919},
+  {0xFD0D, kMapped, 2, 3978}, {0xFD0E, kMapped, 2, 3980}, {0xFD0F, kMapped, 2, 3982}, {0xFD10, kMapped, 2, 3984},
+  {0xFD11, kMapped, 2, 3932}, {0xFD12, kMapped, 2, 3934}, {0xFD13, kMapped, 2, 3936}, {0xFD14, kMapped, 2, 3938},
+  {0xFD15, kMapped, 2, 3940}, {0xFD16, kMapped, 2, 3942}, {0xFD17, kMapped, 2, 3944}, {0xFD18, kMapped, 2, 3946},
+  {0xFD19, kMapped, 2, 3948}, {0xFD1A, kMapped, 2, 3950}, {0xFD1B, kMapped, 2, 3952}, {0xFD1C, kMapped, 2, 3954},
+  {0xFD1D, kMapped, 2, 3956}, {0xFD1E, kMapped, 2, 3958}, {0xFD1F, kMapped, 2, 3960}, {0xFD20, kMapped, 2, 3962},
+  {0xFD21, kMapped, 2, 3964}, {0xFD22, kMapped, 2, 3966}, {0xFD23, kMapped, 2, 3968}, {0xFD24, kMapped, 2, 3970},
+  {0xFD25, kMapped, 2, 3972}, {0xFD26, kMapped, 2, 3974}, {0xFD27, kMapped, 2, 3976}, {0xFD28, kMapped, 2, 3919},
+  {0xFD29, kMapped, 2, 3978}, {0xFD2A, kMapped, 2, 3980}, {0xFD2B, kMapped, 2, 3982}, {0xFD2C, kMapped, 2, 3984},
+  {0xFD2D, kMapped, 2, 3972}, {0xFD2E, kMapped, 2, 3974}, {0xFD2F, kMapped, 2, 3976}, {0xFD30, kMapped, 2, 3919},
+  {0xFD31, kMapped, 2, 3917}, {0xFD32, kMapped, 2, 3921}, {0xFD33, kMapped, 2, 3731}, {0xFD34, kMapped, 2, 3709},
+  {0xFD35, kMapped, 2, 3711}, {0xFD36, kMapped, 2, 3713}, {0xFD37, kMapped, 2, 3972}, {0xFD38, kMapped, 2, 3974},
+  {0xFD39, kMapped, 2, 3976}, {0xFD3A, kMapped, 2, 3731}, {0xFD3B, kMapped, 2, 3733}, {0xFD3C, kMapped, 2, 3986},
+  {0xFD3E, kValid, 0, 0}, {0xFD50, kMapped, 3, 3988}, {0xFD51, kMapped, 3, 3991}, {0xFD53, kMapped, 3, 3994},
+  {0xFD54, kMapped, 3, 3997}, {0xFD55, kMapped, 3, 4000}, {0xFD56, kMapped, 3, 4003}, {0xFD57, kMapped, 3, 4006},
+  {0xFD58, kMapped, 3, 4009}, {0xFD5A, kMapped, 3, 4012}, {0xFD5B, kMapped, 3, 4015}, {0xFD5C, kMapped, 3, 4018},
+  {0xFD5D, kMapped, 3, 4021}, {0xFD5E, kMapped, 3, 4024}, {0xFD5F, kMapped, 3, 4027}, {0xFD61, kMapped, 3, 4030},
+  {0xFD62, kMapped, 3, 4033}, {0xFD64, kMapped, 3, 4036}, {0xFD66, kMapped, 3, 4039}, {0xFD67, kMapped, 3, 4042},
+  {0xFD69, kMapped, 3, 4045}, {0xFD6A, kMapped, 3, 4048}, {0xFD6C, kMapped, 3, 4051}, {0xFD6E, kMapped, 3, 4054},
+  {0xFD6F, kMapped, 3, 4057}, {0xFD71, kMapped, 3, 4060}, {0xFD73, kMapped, 3, 4063}, {0xFD74, kMapped, 3, 4066},
+  {0xFD75, kMapped, 3, 4069}, {0xFD76, kMapped, 3, 4072}, {0xFD78, kMapped, 3, 4075}, {0xFD79, kMapped, 3, 4078},
+  {0xFD7A, kMapped, 3, 4081}, {0xFD7B, kMapped, 3, 4084}, {0xFD7C, kMapped, 3, 4087}, {0xFD7E, kMapped, 3, 4090},
+  {0xFD7F, kMapped, 3, 4093}, {0xFD80, kMapped, 3, 4096}, {0xFD81, kMapped, 3, 4099}, {0xFD82, kMapped, 3, 4102},
+  {0xFD83, kMapped, 3, 4105}, {0xFD85, kMapped, 3, 4108}, {0xFD87, kMapped, 3, 4111}, {0xFD89, kMapped, 3, 4114},
+  {0xFD8A, kMapped, 3, 4117}, {0xFD8B, kMapped, 3, 4120}, {0xFD8C, kMapped, 3, 4123}, {0xFD8D, kMapped, 3, 4126},
+  {0xFD8E, kMapped, 3, 4129}, {0xFD8F, kMapped, 3, 4132}, {0xFD90, kDisallowed, 0, 0}, {0xFD92, kMapped, 3, 4135},
+  {0xFD93, kMapped, 3, 4138}, {0xFD94, kMapped, 3, 4141}, {0xFD95, kMapped, 3, 4144}, {0xFD96, kMapped, 3, 4147},
+  {0xFD97, kMapped, 3, 4150}, {0xFD99, kMapped, 3, 4153}, {0xFD9A, kMapped, 3, 4156}, {0xFD9B, kMapped, 3, 4159},
+  {0xFD9C, kMapped, 3, 4162}, {0xFD9E, kMapped, 3, 4165}, {0xFD9F, kMapped, 3, 4168}, {0xFDA0, kMapped, 3, 4171},
+  {0xFDA1, kMapped, 3, 4174}, {0xFDA2, kMapped, 3, 4177}, {0xFDA3, kMapped, 3, 4180}, {0xFDA4, kMapped, 3, 4183},
+  {0xFDA5, kMapped, 3, 4186}, {0xFDA6, kMapped, 3, 4189}, {0xFDA7, kMapped, 3, 4192}, {0xFDA8, kMapped, 3, 4195},
+  {0xFDA9, kMapped, 3, 4198}, {0xFDAA, kMapped, 3, 4201}, {0xFDAB, kMapped, 3, 4204}, {0xFDAC, kMapped, 3, 4207},
+  {0xFDAD, kMapped, 3, 4210}, {0xFDAE, kMapped, 3, 4213}, {0xFDAF, kMapped, 3, 4216}, {0xFDB0, kMapped, 3, 4219},
+  {0xFDB1, kMapped, 3, 4222}, {0xFDB2, kMapped, 3, 4225}, {0xFDB3, kMapped, 3, 4228}, {0xFDB4, kMapped, 3, 4090},
+  {0xFDB5, kMapped, 3, 4096}, {0xFDB6, kMapped, 3, 4231}, {0xFDB7, kMapped, 3, 4234}, {0xFDB8, kMapped, 3, 4237},
+  {0xFDB9, kMapped, 3, 4240}, {0xFDBA, kMapped, 3, 4243}, {0xFDBB, kMapped, 3, 4246}, {0xFDBC, kMapped, 3, 4243},
+  {0xFDBD, kMapped, 3, 4237}, {0xFDBE, kMapped, 3, 4249}, {0xFDBF, kMapped, 3, 4252}, {0xFDC0, kMapped, 3, 4255},
+  {0xFDC1, kMapped, 3, 4258}, {0xFDC2, kMapped, 3, 4261}, {0xFDC3, kMapped, 3, 4246}, {0xFDC4, kMapped, 3, 4069},
+  {0xFDC5, kMapped, 3, 4039}, {0xFDC6, kMapped, 3, 4264}, {0xFDC7, kMapped, 3, 4267}, {0xFDC8, kDisallowed, 0, 0},
+  {0xFDCF, kValid, 0, 0}, {0xFDD0, kDisallowed, 0, 0}, {0xFDF0, kMapped, 3, 4270}, {0xFDF1, kMapped, 3, 4273},
+  {0xFDF2, kMapped, 4, 4276}, {0xFDF3, kMapped, 4, 4280}, {0xFDF4, kMapped, 4, 4284}, {0xFDF5, kMapped, 4, 4288},
+  {0xFDF6, kMapped, 4, 4292}, {0xFDF7, kMapped, 4, 4296}, {0xFDF8, kMapped, 4, 4300}, {0xFDF9, kMapped, 3, 4304},
+  {0xFDFA, kMapped, 18, 4307}, {0xFDFB, kMapped, 8, 4325}, {0xFDFC, kMapped, 4, 4333}, {0xFDFD, kValid, 0, 0},
+  {0xFE00, kMapped, 0, 0}, {0xFE10, kMapped, 1, 4337}, {0xFE11, kMapped, 1, 4338}, {0xFE12, kDisallowed, 0, 0},
+  {0xFE13, kMapped, 1, 4339}, {0xFE14, kMapped, 1, 282}, {0xFE15, kMapped, 1, 4340}, {0xFE16, kMapped, 1, 4341},
+  {0xFE17, kMapped, 1, 4342}, {0xFE18, kMapped, 1, 4343}, {0xFE19, kDisallowed, 0, 0}, {0xFE20, kValid, 0, 0},
+  {0xFE30, kDisallowed, 0, 0}, {0xFE31, kMapped, 1, 4344}, {0xFE32, kMapped, 1, 4345}, {0xFE33, kMapped, 1, 4346},
+  {0xFE35, kMapped, 1, 1033}, {0xFE36, kMapped, 1, 1034}, {0xFE37, kMapped, 1, 4347}, {0xFE38, kMapped, 1, 4348},
+  {0xFE39, kMapped, 1, 4349}, {0xFE3A, kMapped, 1, 4350}, {0xFE3B, kMapped, 1, 4351}, {0xFE3C, kMapped, 1, 4352},
+  {0xFE3D, kMapped, 1, 4353}, {0xFE3E, kMapped, 1, 4354}, {0xFE3F, kMapped, 1, 1154}, {0xFE40, kMapped, 1, 1155},
+  {0xFE41, kMapped, 1, 4355}, {0xFE42, kMapped, 1, 4356}, {0xFE43, kMapped, 1, 4357}, {0xFE44, kMapped, 1, 4358},
+  {0xFE45, kValid, 0, 0}, {0xFE47, kMapped, 1, 4359}, {0xFE48, kMapped, 1, 4360}, {0xFE49, kMapped, 2, 1011},
+  {0xFE4D, kMapped, 1, 4346}, {0xFE50, kMapped, 1, 4337}, {0xFE51, kMapped, 1, 4338}, {0xFE52, kDisallowed, 0, 0},
+  {0xFE54, kMapped, 1, 282}, {0xFE55, kMapped, 1, 4339}, {0xFE56, kMapped, 1, 4341}, {0xFE57, kMapped, 1, 4340},
+  {0xFE58, kMapped, 1, 4344}, {0xFE59, kMapped, 1, 1033}, {0xFE5A, kMapped, 1, 1034}, {0xFE5B, kMapped, 1, 4347},
+  {0xFE5C, kMapped, 1, 4348}, {0xFE5D, kMapped, 1, 4349}, {0xFE5E, kMapped, 1, 4350}, {0xFE5F, kMapped, 1, 4361},
+  {0xFE60, kMapped, 1, 4362}, {0xFE61, kMapped, 1, 4363}, {0xFE62, kMapped, 1, 1030}, {0xFE63, kMapped, 1, 4364},
+  {0xFE64, kMapped, 1, 4365}, {0xFE65, kMapped, 1, 4366}, {0xFE66, kMapped, 1, 1032}, {0xFE67, kDisallowed, 0, 0},
+  {0xFE68, kMapped, 1, 4367}, {0xFE69, kMapped, 1, 4368}, {0xFE6A, kMapped, 1, 4369}, {0xFE6B, kMapped, 1, 4370},
+  {0xFE6C, kDisallowed, 0, 0}, {0xFE70, kMapped, 2, 4371}, {0xFE71, kMapped, 2, 4373}, {0xFE72, kMapped, 2, 4375},
+  {0xFE73, kValid, 0, 0}, {0xFE74, kMapped, 2, 4377}, {0xFE75, kDisallowed, 0, 0}, {0xFE76, kMapped, 2, 4379},
+  {0xFE77, kMapped, 2, 4381}, {0xFE78, kMapped, 2, 4383}, {0xFE79, kMapped, 2, 4385}, {0xFE7A, kMapped, 2, 4387},
+  {0xFE7B, kMapped, 2, 4389}, {0xFE7C, kMapped, 2, 4391}, {0xFE7D, kMapped, 2, 4393}, {0xFE7E, kMapped, 2, 4395},
+  {0xFE7F, kMapped, 2, 4397}, {0xFE80, kMapped, 1, 4399}, {0xFE81, kMapped, 1, 4400}, {0xFE83, kMapped, 1, 4401},
+  {0xFE85, kMapped, 1, 4402}, {0xFE87, kMapped, 1, 4403}, {0xFE89, kMapped, 1, 4404}, {0xFE8D, kMapped, 1, 4405},
+  {0xFE8F, kMapped, 1, 4406}, {0xFE93, kMapped, 1, 4407}, {0xFE95, kMapped, 1, 4408}, {0xFE99, kMapped, 1, 4409},
+  {0xFE9D, kMapped, 1, 4410}, {0xFEA1, kMapped, 1, 4411}, {0xFEA5, kMapped, 1, 4412}, {0xFEA9, kMapped, 1, 4413},
+  {0xFEAB, kMapped, 1, 4414}, {0xFEAD, kMapped, 1, 4415}, {0xFEAF, kMapped, 1, 4416}, {0xFEB1, kMapped, 1, 4417},
+  {0xFEB5, kMapped, 1, 4418}, {0xFEB9, kMapped, 1, 4419}, {0xFEBD, kMapped, 1, 4420}, {0xFEC1, kMapped, 1, 4421},
+  {0xFEC5, kMapped, 1, 4422}, {0xFEC9, kMapped, 1, 4423}, {0xFECD, kMapped, 1, 4424}, {0xFED1, kMapped, 1, 4425},
+  {0xFED5, kMapped, 1, 4426}, {0xFED9, kMapped, 1, 4427}, {0xFEDD, kMapped, 1, 4428}, {0xFEE1, kMapped, 1, 4429},
+  {0xFEE5, kMapped, 1, 4430}, {0xFEE9, kMapped, 1, 4431}, {0xFEED, kMapped, 1, 4432}, {0xFEEF, kMapped, 1, 3637},
+  {0xFEF1, kMapped, 1, 4433}, {0xFEF5, kMapped, 2, 4434}, {0xFEF7, kMapped, 2, 4436}, {0xFEF9, kMapped, 2, 4438},
+  {0xFEFB, kMapped, 2, 4440}, {0xFEFD, kDisallowed, 0, 0}, {0xFEFF, kMapped, 0, 0}, {0xFF00, kDisallowed, 0, 0},
+  {0xFF01, kMapped, 1, 4340}, {0xFF02, kMapped, 1, 4442}, {0xFF03, kMapped, 1, 4361}, {0xFF04, kMapped, 1, 4368},
+  {0xFF05, kMapped, 1, 4369}, {0xFF06, kMapped, 1, 4362}, {0xFF07, kMapped, 1, 4443}, {0xFF08, kMapped, 1, 1033},
+  {0xFF09, kMapped, 1, 1034}, {0xFF0A, kMapped, 1, 4363}, {0xFF0B, kMapped, 1, 1030}, {0xFF0C, kMapped, 1, 4337},
+  {0xFF0D, kMapped, 1, 4364}, {0xFF0E, kMapped, 1, 1670}, {0xFF0F, kMapped, 1, 4444}, {0xFF10, kMapped, 1, 1023},
+  {0xFF11, kMapped, 1, 38}, {0xFF12, kMapped, 1, 31}, {0xFF13, kMapped, 1, 32}, {0xFF14, kMapped, 1, 1024},
+  {0xFF15, kMapped, 1, 1025}, {0xFF16, kMapped, 1, 1026}, {0xFF17, kMapped, 1, 1027}, {0xFF18, kMapped, 1, 1028},
+  {0xFF19, kMapped, 1, 1029}, {0xFF1A, kMapped, 1, 4339}, {0xFF1B, kMapped, 1, 282}, {0xFF1C, kMapped, 1, 4365},
+  {0xFF1D, kMapped, 1, 1032}, {0xFF1E, kMapped, 1, 4366}, {0xFF1F, kMapped, 1, 4341}, {0xFF20, kMapped, 1, 4370},
+  {0xFF21, kMapped, 1, 0}, {0xFF22, kMapped, 1, 1}, {0xFF23, kMapped, 1, 2}, {0xFF24, kMapped, 1, 3},
+  {0xFF25, kMapped, 1, 4}, {0xFF26, kMapped, 1, 5}, {0xFF27, kMapped, 1, 6}, {0xFF28, kMapped, 1, 7},
+  {0xFF29, kMapped, 1, 8}, {0xFF2A, kMapped, 1, 9}, {0xFF2B, kMapped, 1, 10}, {0xFF2C, kMapped, 1, 11},
+  {0xFF2D, kMapped, 1, 12}, {0xFF2E, kMapped, 1, 13}, {0xFF2F, kMapped, 1, 14}, {0xFF30, kMapped, 1, 15},
+  {0xFF31, kMapped, 1, 16}, {0xFF32, kMapped, 1, 17}, {0xFF33, kMapped, 1, 18}, {0xFF34, kMapped, 1, 19},
+  {0xFF35, kMapped, 1, 20}, {0xFF36, kMapped, 1, 21}, {0xFF37, kMapped, 1, 22}, {0xFF38, kMapped, 1, 23},
+  {0xFF39, kMapped, 1, 24}, {0xFF3A, kMapped, 1, 25}, {0xFF3B, kMapped, 1, 4359}, {0xFF3C, kMapped, 1, 4367},
+  {0xFF3D, kMapped, 1, 4360}, {0xFF3E, kMapped, 1, 4445}, {0xFF3F, kMapped, 1, 4346}, {0xFF40, kMapped, 1, 983},
+  {0xFF41, kMapped, 1, 0}, {0xFF42, kMapped, 1, 1}, {0xFF43, kMapped, 1, 2}, {0xFF44, kMapped, 1, 3},
+  {0xFF45, kMapped, 1, 4}, {0xFF46, kMapped, 1, 5}, {0xFF47, kMapped, 1, 6}, {0xFF48, kMapped, 1, 7},
+  {0xFF49, kMapped, 1, 8}, {0xFF4A, kMapped, 1, 9}, {0xFF4B, kMapped, 1, 10}, {0xFF4C, kMapped, 1, 11},
+  {0xFF4D, kMapped, 1, 12}, {0xFF4E, kMapped, 1, 13}, {0xFF4F, kMapped, 1, 14}, {0xFF50, kMapped, 1, 15},
+  {0xFF51, kMapped, 1, 16}, {0xFF52, kMapped, 1, 17}, {0xFF53, kMapped, 1, 18}, {0xFF54, kMapped, 1, 19},
+  {0xFF55, kMapped, 1, 20}, {0xFF56, kMapped, 1, 21}, {0xFF57, kMapped, 1, 22}, {0xFF58, kMapped, 1, 23},
+  {0xFF59, kMapped, 1, 24}, {0xFF5A, kMapped, 1, 25}, {0xFF5B, kMapped, 1, 4347}, {0xFF5C, kMapped, 1, 4446},
+  {0xFF5D, kMapped, 1, 4348}, {0xFF5E, kMapped, 1, 4447}, {0xFF5F, kMapped, 1, 4448}, {0xFF60, kMapped, 1, 4449},
+  {0xFF61, kMapped, 1, 1670}, {0xFF62, kMapped, 1, 4355}, {0xFF63, kMapped, 1, 4356}, {0xFF64, kMapped, 1, 4338},
+  {0xFF65, kMapped, 1, 4450}, {0xFF66, kMapped, 1, 2188}, {0xFF67, kMapped, 1, 4451}, {0xFF68, kMapped, 1, 4452},
+  {0xFF69, kMapped, 1, 4453}, {0xFF6A, kMapped, 1, 4454}, {0xFF6B, kMapped, 1, 4455}, {0xFF6C, kMapped, 1, 4456},
+  {0xFF6D, kMapped, 1, 4457}, {0xFF6E, kMapped, 1, 4458}, {0xFF6F, kMapped, 1, 4459}, {0xFF70, kMapped, 1, 4460},
+  {0xFF71, kMapped, 1, 2142}, {0xFF72, kMapped, 1, 2143}, {0xFF73, kMapped, 1, 2144}, {0xFF74, kMapped, 1, 2145},
+  {0xFF75, kMapped, 1, 2146}, {0xFF76, kMapped, 1, 2147}, {0xFF77, kMapped, 1, 2148}, {0xFF78, kMapped, 1, 2149},
+  {0xFF79, kMapped, 1, 2150}, {0xFF7A, kMapped, 1, 2151}, {0xFF7B, kMapped, 1, 2152}, {0xFF7C, kMapped, 1, 2153},
+  {0xFF7D, kMapped, 1, 2154}, {0xFF7E, kMapped, 1, 2155}, {0xFF7F, kMapped, 1, 2156}, {0xFF80, kMapped, 1, 2157},
+  {0xFF81, kMapped, 1, 2158}, {0xFF82, kMapped, 1, 2159}, {0xFF83, kMapped, 1, 2160}, {0xFF84, kMapped, 1, 2161},
+  {0xFF85, kMapped, 1, 2162}, {0xFF86, kMapped, 1, 2163}, {0xFF87, kMapped, 1, 2164}, {0xFF88, kMapped, 1, 2165},
+  {0xFF89, kMapped, 1, 2166}, {0xFF8A, kMapped, 1, 2167}, {0xFF8B, kMapped, 1, 2168}, {0xFF8C, kMapped, 1, 2169},
+  {0xFF8D, kMapped, 1, 2170}, {0xFF8E, kMapped, 1, 2171}, {0xFF8F, kMapped, 1, 2172}, {0xFF90, kMapped, 1, 2173},
+  {0xFF91, kMapped, 1, 2174}, {0xFF92, kMapped, 1, 2175}, {0xFF93, kMapped, 1, 2176}, {0xFF94, kMapped, 1, 2177},
+  {0xFF95, kMapped, 1, 2178}, {0xFF96, kMapped, 1, 2179}, {0xFF97, kMapped, 1, 2180}, {0xFF98, kMapped, 1, 2181},
+  {0xFF99, kMapped, 1, 2182}, {0xFF9A, kMapped, 1, 2183}, {0xFF9B, kMapped, 1, 2184}, {0xFF9C, kMapped, 1, 2185},
+  {0xFF9D, kMapped, 1, 4461}, {0xFF9E, kMapped, 1, 4462}, {0xFF9F, kMapped, 1, 4463}, {0xFFA0, kDisallowed, 0, 0},
+  {0xFFA1, kMapped, 1, 1682}, {0xFFA2, kMapped, 1, 1683}, {0xFFA3, kMapped, 1, 1684}, {0xFFA4, kMapped, 1, 1685},
+  {0xFFA5, kMapped, 1, 1686}, {0xFFA6, kMapped, 1, 1687}, {0xFFA7, kMapped, 1, 1688}, {0xFFA8, kMapped, 1, 1689},
+  {0xFFA9, kMapped, 1, 1690}, {0xFFAA, kMapped, 1, 1691}, {0xFFAB, kMapped, 1, 1692}, {0xFFAC, kMapped, 1, 1693},
+  {0xFFAD, kMapped, 1, 1694}, {0xFFAE, kMapped, 1, 1695}, {0xFFAF, kMapped, 1, 1696}, {0xFFB0, kMapped, 1, 1697},
+  {0xFFB1, kMapped, 1, 1698}, {0xFFB2, kMapped, 1, 1699}, {0xFFB3, kMapped, 1, 1700}, {0xFFB4, kMapped, 1, 1701},
+  {0xFFB5, kMapped, 1, 1702}, {0xFFB6, kMapped, 1, 1703}, {0xFFB7, kMapped, 1, 1704}, {0xFFB8, kMapped, 1, 1705},
+  {0xFFB9, kMapped, 1, 1706}, {0xFFBA, kMapped, 1, 1707}, {0xFFBB, kMapped, 1, 1708}, {0xFFBC, kMapped, 1, 1709},
+  {0xFFBD, kMapped, 1, 1710}, {0xFFBE, kMapped, 1, 1711}, {0xFFBF, kDisallowed, 0, 0}, {0xFFC2, kMapped, 1, 1712},
+  {0xFFC3, kMapped, 1, 1713}, {0xFFC4, kMapped, 1, 1714}, {0xFFC5, kMapped, 1, 1715}, {0xFFC6, kMapped, 1, 1716},
+  {0xFFC7, kMapped, 1, 1717}, {0xFFC8, kDisallowed, 0, 0}, {0xFFCA, kMapped, 1, 1718}, {0xFFCB, kMapped, 1, 1719},
+  {0xFFCC, kMapped, 1, 1720}, {0xFFCD, kMapped, 1, 1721}, {0xFFCE, kMapped, 1, 1722}, {0xFFCF, kMapped, 1, 1723},
+  {0xFFD0, kDisallowed, 0, 0}, {0xFFD2, kMapped, 1, 1724}, {0xFFD3, kMapped, 1, 1725}, {0xFFD4, kMapped, 1, 1726},
+  {0xFFD5, kMapped, 1, 1727}, {0xFFD6, kMapped, 1, 1728}, {0xFFD7, kMapped, 1, 1729}, {0xFFD8, kDisallowed, 0, 0},
+  {0xFFDA, kMapped, 1, 1730}, {0xFFDB, kMapped, 1, 1731}, {0xFFDC, kMapped, 1, 1732}, {0xFFDD, kDisallowed, 0, 0},
+  {0xFFE0, kMapped, 1, 4464}, {0xFFE1, kMapped, 1, 4465}, {0xFFE2, kMapped, 1, 4466}, {0xFFE3, kMapped, 2, 29},
+  {0xFFE4, kMapped, 1, 4467}, {0xFFE5, kMapped, 1, 4468}, {0xFFE6, kMapped, 1, 4469}, {0xFFE7, kDisallowed, 0, 0},
+  {0xFFE8, kMapped, 1, 4470}, {0xFFE9, kMapped, 1, 4471}, {0xFFEA, kMapped, 1, 4472}, {0xFFEB, kMapped, 1, 4473},
+  {0xFFEC, kMapped, 1, 4474}, {0xFFED, kMapped, 1, 4475}, {0xFFEE, kMapped, 1, 4476}, {0xFFEF, kDisallowed, 0, 0},
+  {0x10000, kValid, 0, 0}, {0x1000C, kDisallowed, 0, 0}, {0x1000D, kValid, 0, 0}, {0x10027, kDisallowed, 0, 0},
+  {0x10028, kValid, 0, 0}, {0x1003B, kDisallowed, 0, 0}, {0x1003C, kValid, 0, 0}, {0x1003E, kDisallowed, 0, 0},
+  {0x1003F, kValid, 0, 0}, {0x1004E, kDisallowed, 0, 0}, {0x10050, kValid, 0, 0}, {0x1005E, kDisallowed, 0, 0},
+  {0x10080, kValid, 0, 0}, {0x100FB, kDisallowed, 0, 0}, {0x10100, kValid, 0, 0}, {0x10103, kDisallowed, 0, 0},
+  {0x10107, kValid, 0, 0}, {0x10134, kDisallowed, 0, 0}, {0x10137, kValid, 0, 0}, {0x1018F, kDisallowed, 0, 0},
+  {0x10190, kValid, 0, 0}, {0x1019D, kDisallowed, 0, 0}, {0x101A0, kValid, 0, 0}, {0x101A1, kDisallowed, 0, 0},
+  {0x101D0, kValid, 0, 0}, {0x101FE, kDisallowed, 0, 0}, {0x10280, kValid, 0, 0}, {0x1029D, kDisallowed, 0, 0},
+  {0x102A0, kValid, 0, 0}, {0x102D1, kDisallowed, 0, 0}, {0x102E0, kValid, 0, 0}, {0x102FC, kDisallowed, 0, 0},
+  {0x10300, kValid, 0, 0}, {0x10324, kDisallowed, 0, 0}, {0x1032D, kValid, 0, 0}, {0x1034B, kDisallowed, 0, 0},
+  {0x10350, kValid, 0, 0}, {0x1037B, kDisallowed, 0, 0}, {0x10380, kValid, 0, 0}, {0x1039E, kDisallowed, 0, 0},
+  {0x1039F, kValid, 0, 0}, {0x103C4, kDisallowed, 0, 0}, {0x103C8, kValid, 0, 0}, {0x103D6, kDisallowed, 0, 0},
+  {0x10400, kMapped, 1, 4477}, {0x10401, kMapped, 1, 4478}, {0x10402, kMapped, 1, 4479}, {0x10403, kMapped, 1, 4480},
+  {0x10404, kMapped, 1, 4481}, {0x10405, kMapped, 1, 4482}, {0x10406, kMapped, 1, 4483}, {0x10407, kMapped, 1, 4484},
+  {0x10408, kMapped, 1, 4485}, {0x10409, kMapped, 1, 4486}, {0x1040A, kMapped, 1, 4487}, {0x1040B, kMapped, 1, 4488},
+  {0x1040C, kMapped, 1, 4489}, {0x1040D, kMapped, 1, 4490}, {0x1040E, kMapped, 1, 4491}, {0x1040F, kMapped, 1, 4492},
+  {0x10410, kMapped, 1, 4493}, {0x10411, kMapped, 1, 4494}, {0x10412, kMapped, 1, 4495}, {0x10413, kMapped, 1, 4496},
+  {0x10414, kMapped, 1, 4497}, {0x10415, kMapped, 1, 4498}, {0x10416, kMapped, 1, 4499}, {0x10417, kMapped, 1, 4500},
+  {0x10418, kMapped, 1, 4501}, {0x10419, kMapped, 1, 4502}, {0x1041A, kMapped, 1, 4503}, {0x1041B, kMapped, 1, 4504},
+  {0x1041C, kMapped, 1, 4505}, {0x1041D, kMapped, 1, 4506}, {0x1041E, kMapped, 1, 4507}, {0x1041F, kMapped, 1, 4508},
+  {0x10420, kMapped, 1, 4509}, {0x10421, kMapped, 1, 4510}, {0x10422, kMapped, 1, 4511}, {0x10423, kMapped, 1, 4512},
+  {0x10424, kMapped, 1, 4513}, {0x10425, kMapped, 1, 4514}, {0x10426, kMapped, 1, 4515}, {0x10427, kMapped, 1, 4516},
+  {0x10428, kValid, 0, 0}, {0x1049E, kDisallowed, 0, 0}, {0x104A0, kValid, 0, 0}, {0x104AA, kDisallowed, 0, 0},
+  {0x104B0, kMapped, 1, 4517}, {0x104B1, kMapped, 1, 4518}, {0x104B2, kMapped, 1, 4519}, {0x104B3, kMapped, 1, 4520},
+  {0x104B4, kMapped, 1, 4521}, {0x104B5, kMapped, 1, 4522}, {0x104B6, kMapped, 1, 4523}, {0x104B7, kMapped, 1, 4524},
+  {0x104B8, kMapped, 1, 4525}, {0x104B9, kMapped, 1, 4526}, {0x104BA, kMapped, 1, 4527}, {0x104BB, kMapped, 1, 4528},
+  {0x104BC, kMapped, 1, 4529}, {0x104BD, kMapped, 1, 4530}, {0x104BE, kMapped, 1, 4531}, {0x104BF, kMapped, 1, 4532},
+  {0x104C0, kMapped, 1, 4533}, {0x104C1, kMapped, 1, 4534}, {0x104C2, kMapped, 1, 4535}, {0x104C3, kMapped, 1, 4536},
+  {0x104C4, kMapped, 1, 4537}, {0x104C5, kMapped, 1, 4538}, {0x104C6, kMapped, 1, 4539}, {0x104C7, kMapped, 1, 4540},
+  {0x104C8, kMapped, 1, 4541}, {0x104C9, kMapped, 1, 4542}, {0x104CA, kMapped, 1, 4543}, {0x104CB, kMapped, 1, 4544},
+  {0x104CC, kMapped, 1, 4545}, {0x104CD, kMapped, 1, 4546}, {0x104CE, kMapped, 1, 4547}, {0x104CF, kMapped, 1, 4548},
+  {0x104D0, kMapped, 1, 4549}, {0x104D1, kMapped, 1, 4550}, {0x104D2, kMapped, 1, 4551}, {0x104D3, kMapped, 1, 4552},
+  {0x104D4, kDisallowed, 0, 0}, {0x104D8, kValid, 0, 0}, {0x104FC, kDisallowed, 0, 0}, {0x10500, kValid, 0, 0},
+  {0x10528, kDisallowed, 0, 0}, {0x10530, kValid, 0, 0}, {0x10564, kDisallowed, 0, 0}, {0x1056F, kValid, 0, 0},
+  {0x10570, kMapped, 1, 4553}, {0x10571, kMapped, 1, 4554}, {0x10572, kMapped, 1, 4555}, {0x10573, kMapped, 1, 4556},
+  {0x10574, kMapped, 1, 4557}, {0x10575, kMapped, 1, 4558}, {0x10576, kMapped, 1, 4559}, {0x10577, kMapped, 1, 4560},
+  {0x10578, kMapped, 1, 4561}, {0x10579, kMapped, 1, 4562}, {0x1057A, kMapped, 1, 4563}, {0x1057B, kDisallowed, 0, 0},
+  {0x1057C, kMapped, 1, 4564}, {0x1057D, kMapped, 1, 4565}, {0x1057E, kMapped, 1, 4566}, {0x1057F, kMapped, 1, 4567},
+  {0x10580, kMapped, 1, 4568}, {0x10581, kMapped, 1, 4569}, {0x10582, kMapped, 1, 4570}, {0x10583, kMapped, 1, 4571},
+  {0x10584, kMapped, 1, 4572}, {0x10585, kMapped, 1, 4573}, {0x10586, kMapped, 1, 4574}, {0x10587, kMapped, 1, 4575},
+  {0x10588, kMapped, 1, 4576}, {0x10589, kMapped, 1, 4577}, {0x1058A, kMapped, 1, 4578}, {0x1058B, kDisallowed, 0, 0},
+  {0x1058C, kMapped, 1, 4579}, {0x1058D, kMapped, 1, 4580}, {0x1058E, kMapped, 1, 4581}, {0x1058F, kMapped, 1, 4582},
+  {0x10590, kMapped, 1, 4583}, {0x10591, kMapped, 1, 4584}, {0x10592, kMapped, 1, 4585}, {0x10593, kDisallowed, 0, 0},
+  {0x10594, kMapped, 1, 4586}, {0x10595, kMapped, 1, 4587}, {0x10596, kDisallowed, 0, 0}, {0x10597, kValid, 0, 0},
+  {0x105A2, kDisallowed, 0, 0}, {0x105A3, kValid, 0, 0}, {0x105B2, kDisallowed, 0, 0}, {0x105B3, kValid, 0, 0},
+  {0x105BA, kDisallowed, 0, 0}, {0x105BB, kValid, 0, 0}, {0x105BD, kDisallowed, 0, 0}, {0x10600, kValid, 0, 0},
+  {0x10737, kDisallowed, 0, 0}, {0x10740, kValid, 0, 0}, {0x10756, kDisallowed, 0, 0}, {0x10760, kValid, 0, 0},
+  {0x10768, kDisallowed, 0, 0}, {0x10780, kValid, 0, 0}, {0x10781, kMapped, 1, 4588}, {0x10782, kMapped, 1, 4589},
+  {0x10783, kMapped, 1, 54}, {0x10784, kMapped, 1, 4590}, {0x10785, kMapped, 1, 146}, {0x10786, kDisallowed, 0, 0},
+  {0x10787, kMapped, 1, 4591}, {0x10788, kMapped, 1, 4592}, {0x10789, kMapped, 1, 4593}, {0x1078A, kMapped, 1, 4594},
+  {0x1078B, kMapped, 1, 151}, {0x1078C, kMapped, 1, 152}, {0x1078D, kMapped, 1, 4595}, {0x1078E, kMapped, 1, 4596},
+  {0x1078F, kMapped, 1, 4597}, {0x10790, kMapped, 1, 4598}, {0x10791, kMapped, 1, 4599}, {0x10792, kMapped, 1, 4600},
+  {0x10793, kMapped, 1, 158}, {0x10794, kMapped, 1, 4601}, {0x10795, kMapped, 1, 97}, {0x10796, kMapped, 1, 4602},
+  {0x10797, kMapped, 1, 4603}, {0x10798, kMapped, 1, 4604}, {0x10799, kMapped, 1, 4605}, {0x1079A, kMapped, 1, 4606},
+  {0x1079B, kMapped, 1, 2987}, {0x1079C, kMapped, 1, 4607}, {0x1079D, kMapped, 1, 4608}, {0x1079E, kMapped, 1, 4609},
+  {0x1079F, kMapped, 1, 4610}, {0x107A0, kMapped, 1, 4611}, {0x107A1, kMapped, 1, 4612}, {0x107A2, kMapped, 1, 71},
+  {0x107A3, kMapped, 1, 4613}, {0x107A4, kMapped, 1, 4614}, {0x107A5, kMapped, 1, 16}, {0x107A6, kMapped, 1, 4615},
+  {0x107A7, kMapped, 1, 4616}, {0x107A8, kMapped, 1, 1392}, {0x107A9, kMapped, 1, 4617}, {0x107AA, kMapped, 1, 169},
+  {0x107AB, kMapped, 1, 4618}, {0x107AC, kMapped, 1, 4619}, {0x107AD, kMapped, 1, 4620}, {0x107AE, kMapped, 1, 4621},
+  {0x107AF, kMapped, 1, 173}, {0x107B0, kMapped, 1, 4622}, {0x107B1, kDisallowed, 0, 0}, {0x107B2, kMapped, 1, 4623},
+  {0x107B3, kMapped, 1, 4624}, {0x107B4, kMapped, 1, 4625}, {0x107B5, kMapped, 1, 4626}, {0x107B6, kMapped, 1, 4627},
+  {0x107B7, kMapped, 1, 4628}, {0x107B8, kMapped, 1, 4629}, {0x107B9, kMapped, 1, 4630}, {0x107BA, kMapped, 1, 4631},
+  {0x107BB, kDisallowed, 0, 0}, {0x10800, kValid, 0, 0}, {0x10806, kDisallowed, 0, 0}, {0x10808, kValid, 0, 0},
+  {0x10809, kDisallowed, 0, 0}, {0x1080A, kValid, 0, 0}, {0x10836, kDisallowed, 0, 0}, {0x10837, kValid, 0, 0},
+  {0x10839, kDisallowed, 0, 0}, {0x1083C, kValid, 0, 0}, {0x1083D, kDisallowed, 0, 0}, {0x1083F, kValid, 0, 0},
+  {0x10856, kDisallowed, 0, 0}, {0x10857, kValid, 0, 0}, {0x1089F, kDisallowed, 0, 0}, {0x108A7, kValid, 0, 0},
+  {0x108B0, kDisallowed, 0, 0}, {0x108E0, kValid, 0, 0}, {0x108F3, kDisallowed, 0, 0}, {0x108F4, kValid, 0, 0},
+  {0x108F6, kDisallowed, 0, 0}, {0x108FB, kValid, 0, 0}, {0x1091C, kDisallowed, 0, 0}, {0x1091F, kValid, 0, 0},
+  {0x1093A, kDisallowed, 0, 0}, {0x1093F, kValid, 0, 0}, {0x10940, kDisallowed, 0, 0}, {0x10980, kValid, 0, 0},
+  {0x109B8, kDisallowed, 0, 0}, {0x109BC, kValid, 0, 0}, {0x109D0, kDisallowed, 0, 0}, {0x109D2, kValid, 0, 0},
+  {0x10A04, kDisallowed, 0, 0}, {0x10A05, kValid, 0, 0}, {0x10A07, kDisallowed, 0, 0}, {0x10A0C, kValid, 0, 0},
+  {0x10A14, kDisallowed, 0, 0}, {0x10A15, kValid, 0, 0}, {0x10A18, kDisallowed, 0, 0}, {0x10A19, kValid, 0, 0},
+  {0x10A36, kDisallowed, 0, 0}, {0x10A38, kValid, 0, 0}, {0x10A3B, kDisallowed, 0, 0}, {0x10A3F, kValid, 0, 0},
+  {0x10A49, kDisallowed, 0, 0}, {0x10A50, kValid, 0, 0}, {0x10A59, kDisallowed, 0, 0}, {0x10A60, kValid, 0, 0},
+  {0x10AA0, kDisallowed, 0, 0}, {0x10AC0, kValid, 0, 0}, {0x10AE7, kDisallowed, 0, 0}, {0x10AEB, kValid, 0, 0},
+  {0x10AF7, kDisallowed, 0, 0}, {0x10B00, kValid, 0, 0}, {0x10B36, kDisallowed, 0, 0}, {0x10B39, kValid, 0, 0},
+  {0x10B56, kDisallowed, 0, 0}, {0x10B58, kValid, 0, 0}, {0x10B73, kDisallowed, 0, 0}, {0x10B78, kValid, 0, 0},
+  {0x10B92, kDisallowed, 0, 0}, {0x10B99, kValid, 0, 0}, {0x10B9D, kDisallowed, 0, 0}, {0x10BA9, kValid, 0, 0},
+  {0x10BB0, kDisallowed, 0, 0}, {0x10C00, kValid, 0, 0}, {0x10C49, kDisallowed, 0, 0}, {0x10C80, kMapped, 1, 4632},
+  {0x10C81, kMapped, 1, 4633}, {0x10C82, kMapped, 1, 4634}, {0x10C83, kMapped, 1, 4635}, {0x10C84, kMapped, 1, 4636},
+  {0x10C85, kMapped, 1, 4637}, {0x10C86, kMapped, 1, 4638}, {0x10C87, kMapped, 1, 4639}, {0x10C88, kMapped, 1, 4640},
+  {0x10C89, kMapped, 1, 4641}, {0x10C8A, kMapped, 1, 4642}, {0x10C8B, kMapped, 1, 4643}, {0x10C8C, kMapped, 1, 4644},
+  {0x10C8D, kMapped, 1, 4645}, {0x10C8E, kMapped, 1, 4646}, {0x10C8F, kMapped, 1, 4647}, {0x10C90, kMapped, 1, 4648},
+  {0x10C91, kMapped, 1, 4649}, {0x10C92, kMapped, 1, 4650}, {0x10C93, kMapped, 1, 4651}, {0x10C94, kMapped, 1, 4652},
+  {0x10C95, kMapped, 1, 4653}, {0x10C96, kMapped, 1, 4654}, {0x10C97, kMapped, 1, 4655}, {0x10C98, kMapped, 1, 4656},
+  {0x10C99, kMapped, 1, 4657}, {0x10C9A, kMapped, 1, 4658}, {0x10C9B, kMapped, 1, 4659}, {0x10C9C, kMapped, 1, 4660},
+  {0x10C9D, kMapped, 1, 4661}, {0x10C9E, kMapped, 1, 4662}, {0x10C9F, kMapped, 1, 4663}, {0x10CA0, kMapped, 1, 4664},
+  {0x10CA1, kMapped, 1, 4665}, {0x10CA2, kMapped, 1, 4666}, {0x10CA3, kMapped, 1, 4667}, {0x10CA4, kMapped, 1, 4668},
+  {0x10CA5, kMapped, 1, 4669}, {0x10CA6, kMapped, 1, 4670}, {0x10CA7, kMapped, 1, 4671}, {0x10CA8, kMapped, 1, 4672},
+  {0x10CA9, kMapped, 1, 4673}, {0x10CAA, kMapped, 1, 4674}, {0x10CAB, kMapped, 1, 4675}, {0x10CAC, kMapped, 1, 4676},
+  {0x10CAD, kMapped, 1, 4677}, {0x10CAE, kMapped, 1, 4678}, {0x10CAF, kMapped, 1, 4679}, {0x10CB0, kMapped, 1, 4680},
+  {0x10CB1, kMapped, 1, 4681}, {0x10CB2, kMapped, 1, 4682}, {0x10CB3, kDisallowed, 0, 0}, {0x10CC0, kValid, 0, 0},
+  {0x10CF3, kDisallowed, 0, 0}, {0x10CFA, kValid, 0, 0}, {0x10D28, kDisallowed, 0, 0}, {0x10D30, kValid, 0, 0},
+  {0x10D3A, kDisallowed, 0, 0}, {0x10E60, kValid, 0, 0}, {0x10E7F, kDisallowed, 0, 0}, {0x10E80, kValid, 0, 0},
+  {0x10EAA, kDisallowed, 0, 0}, {0x10EAB, kValid, 0, 0}, {0x10EAE, kDisallowed, 0, 0}, {0x10EB0, kValid, 0, 0},
+  {0x10EB2, kDisallowed, 0, 0}, {0x10EFD, kValid, 0, 0}, {0x10F28, kDisallowed, 0, 0}, {0x10F30, kValid, 0, 0},
+  {0x10F5A, kDisallowed, 0, 0}, {0x10F70, kValid, 0, 0}, {0x10F8A, kDisallowed, 0, 0}, {0x10FB0, kValid, 0, 0},
+  {0x10FCC, kDisallowed, 0, 0}, {0x10FE0, kValid, 0, 0}, {0x10FF7, kDisallowed, 0, 0}, {0x11000, kValid, 0, 0},
+  {0x1104E, kDisallowed, 0, 0}, {0x11052, kValid, 0, 0}, {0x11076, kDisallowed, 0, 0}, {0x1107F, kValid, 0, 0},
+  {0x110BD, kDisallowed, 0, 0}, {0x110BE, kValid, 0, 0}, {0x110C3, kDisallowed, 0, 0}, {0x110D0, kValid, 0, 0},
+  {0x110E9, kDisallowed, 0, 0}, {0x110F0, kValid, 0, 0}, {0x110FA, kDisallowed, 0, 0}, {0x11100, kValid, 0, 0},
+  {0x11135, kDisallowed, 0, 0}, {0x11136, kValid, 0, 0}, {0x11148, kDisallowed, 0, 0}, {0x11150, kValid, 0, 0},
+  {0x11177, kDisallowed, 0, 0}, {0x11180, kValid, 0, 0}, {0x111E0, kDisallowed, 0, 0}, {0x111E1, kValid, 0, 0},
+  {0x111F5, kDisallowed, 0, 0}, {0x11200, kValid, 0, 0}, {0x11212, kDisallowed, 0, 0}, {0x11213, kValid, 0, 0},
+  {0x11242, kDisallowed, 0, 0}, {0x11280, kValid, 0, 0}, {0x11287, kDisallowed, 0, 0}, {0x11288, kValid, 0, 0},
+  {0x11289, kDisallowed, 0, 0}, {0x1128A, kValid, 0, 0}, {0x1128E, kDisallowed, 0, 0}, {0x1128F, kValid, 0, 0},
+  {0x1129E, kDisallowed, 0, 0}, {0x1129F, kValid, 0, 0}, {0x112AA, kDisallowed, 0, 0}, {0x112B0, kValid, 0, 0},
+  {0x112EB, kDisallowed, 0, 0}, {0x112F0, kValid, 0, 0}, {0x112FA, kDisallowed, 0, 0}, {0x11300, kValid, 0, 0},
+  {0x11304, kDisallowed, 0, 0}, {0x11305, kValid, 0, 0}, {0x1130D, kDisallowed, 0, 0}, {0x1130F, kValid, 0, 0},
+  {0x11311, kDisallowed, 0, 0}, {0x11313, kValid, 0, 0}, {0x11329, kDisallowed, 0, 0}, {0x1132A, kValid, 0, 0},
+  {0x11331, kDisallowed, 0, 0}, {0x11332, kValid, 0, 0}, {0x11334, kDisallowed, 0, 0}, {0x11335, kValid, 0, 0},
+  {0x1133A, kDisallowed, 0, 0}, {0x1133B, kValid, 0, 0}, {0x11345, kDisallowed, 0, 0}, {0x11347, kValid, 0, 0},
+  {0x11349, kDisallowed, 0, 0}, {0x1134B, kValid, 0, 0}, {0x1134E, kDisallowed, 0, 0}, {0x11350, kValid, 0, 0},
+  {0x11351, kDisallowed, 0, 0}, {0x11357, kValid, 0, 0}, {0x11358, kDisallowed, 0, 0}, {0x1135D, kValid, 0, 0},
+  {0x11364, kDisallowed, 0, 0}, {0x11366, kValid, 0, 0}, {0x1136D, kDisallowed, 0, 0}, {0x11370, kValid, 0, 0},
+  {0x11375, kDisallowed, 0, 0}, {0x11400, kValid, 0, 0}, {0x1145C, kDisallowed, 0, 0}, {0x1145D, kValid, 0, 0},
+  {0x11462, kDisallowed, 0, 0}, {0x11480, kValid, 0, 0}, {0x114C8, kDisallowed, 0, 0}, {0x114D0, kValid, 0, 0},
+  {0x114DA, kDisallowed, 0, 0}, {0x11580, kValid, 0, 0}, {0x115B6, kDisallowed, 0, 0}, {0x115B8, kValid, 0, 0},
+  {0x115DE, kDisallowed, 0, 0}, {0x11600, kValid, 0, 0}, {0x11645, kDisallowed, 0, 0}, {0x11650, kValid, 0, 0},
+  {0x1165A, kDisallowed, 0, 0}, {0x11660, kValid, 0, 0}, {0x1166D, kDisallowed, 0, 0}, {0x11680, kValid, 0, 0},
+  {0x116BA, kDisallowed, 0, 0}, {0x116C0, kValid, 0, 0}, {0x116CA, kDisallowed, 0, 0}, {0x11700, kValid, 0, 0},
+  {0x1171B, kDisallowed, 0, 0}, {0x1171D, kValid, 0, 0}, {0x1172C, kDisallowed, 0, 0}, {0x11730, kValid, 0, 0},
+  {0x11747, kDisallowed, 0, 0}, {0x11800, kValid, 0, 0}, {0x1183C, kDisallowed, 0, 0}, {0x118A0, kMapped, 1, 4683},
+  {0x118A1, kMapped, 1, 4684}, {0x118A2, kMapped, 1, 4685}, {0x118A3, kMapped, 1, 4686}, {0x118A4, kMapped, 1, 4687},
+  {0x118A5, kMapped, 1, 4688}, {0x118A6, kMapped, 1, 4689}, {0x118A7, kMapped, 1, 4690}, {0x118A8, kMapped, 1, 4691},
+  {0x118A9, kMapped, 1, 4692}, {0x118AA, kMapped, 1, 4693}, {0x118AB, kMapped, 1, 4694}, {0x118AC, kMapped, 1, 4695},
+  {0x118AD, kMapped, 1, 4696}, {0x118AE, kMapped, 1, 4697}, {0x118AF, kMapped, 1, 4698}, {0x118B0, kMapped, 1, 4699},
+  {0x118B1, kMapped, 1, 4700}, {0x118B2, kMapped, 1, 4701}, {0x118B3, kMapped, 1, 4702}, {0x118B4, kMapped, 1, 4703},
+  {0x118B5, kMapped, 1, 4704}, {0x118B6, kMapped, 1, 4705}, {0x118B7, kMapped, 1, 4706}, {0x118B8, kMapped, 1, 4707},
+  {0x118B9, kMapped, 1, 4708}, {0x118BA, kMapped, 1, 4709}, {0x118BB, kMapped, 1, 4710}, {0x118BC, kMapped, 1, 4711},
+  {0x118BD, kMapped, 1, 4712}, {0x118BE, kMapped, 1, 4713}, {0x118BF, kMapped, 1, 4714}, {0x118C0, kValid, 0, 0},
+  {0x118F3, kDisallowed, 0, 0}, {0x118FF, kValid, 0, 0}, {0x11907, kDisallowed, 0, 0}, {0x11909, kValid, 0, 0},
+  {0x1190A, kDisallowed, 0, 0}, {0x1190C, kValid, 0, 0}, {0x11914, kDisallowed, 0, 0}, {0x11915, kValid, 0, 0},
+  {0x11917, kDisallowed, 0, 0}, {0x11918, kValid, 0, 0}, {0x11936, kDisallowed, 0, 0}, {0x11937, kValid, 0, 0},
+  {0x11939, kDisallowed, 0, 0}, {0x1193B, kValid, 0, 0}, {0x11947, kDisallowed, 0, 0}, {0x11950, kValid, 0, 0},
+  {0x1195A, kDisallowed, 0, 0}, {0x119A0, kValid, 0, 0}, {0x119A8, kDisallowed, 0, 0}, {0x119AA, kValid, 0, 0},
+  {0x119D8, kDisallowed, 0, 0}, {0x119DA, kValid, 0, 0}, {0x119E5, kDisallowed, 0, 0}, {0x11A00, kValid, 0, 0},
+  {0x11A48, kDisallowed, 0, 0}, {0x11A50, kValid, 0, 0}, {0x11AA3, kDisallowed, 0, 0}, {0x11AB0, kValid, 0, 0},
+  {0x11AF9, kDisallowed, 0, 0}, {0x11B00, kValid, 0, 0}, {0x11B0A, kDisallowed, 0, 0}, {0x11C00, kValid, 0, 0},
+  {0x11C09, kDisallowed, 0, 0}, {0x11C0A, kValid, 0, 0}, {0x11C37, kDisallowed, 0, 0}, {0x11C38, kValid, 0, 0},
+  {0x11C46, kDisallowed, 0, 0}, {0x11C50, kValid, 0, 0}, {0x11C6D, kDisallowed, 0, 0}, {0x11C70, kValid, 0, 0},
+  {0x11C90, kDisallowed, 0, 0}, {0x11C92, kValid, 0, 0}, {0x11CA8, kDisallowed, 0, 0}, {0x11CA9, kValid, 0, 0},
+  {0x11CB7, kDisallowed, 0, 0}, {0x11D00, kValid, 0, 0}, {0x11D07, kDisallowed, 0, 0}, {0x11D08, kValid, 0, 0},
+  {0x11D0A, kDisallowed, 0, 0}, {0x11D0B, kValid, 0, 0}, {0x11D37, kDisallowed, 0, 0}, {0x11D3A, kValid, 0, 0},
+  {0x11D3B, kDisallowed, 0, 0}, {0x11D3C, kValid, 0, 0}, {0x11D3E, kDisallowed, 0, 0}, {0x11D3F, kValid, 0, 0},
+  {0x11D48, kDisallowed, 0, 0}, {0x11D50, kValid, 0, 0}, {0x11D5A, kDisallowed, 0, 0}, {0x11D60, kValid, 0, 0},
+  {0x11D66, kDisallowed, 0, 0}, {0x11D67, kValid, 0, 0}, {0x11D69, kDisallowed, 0, 0}, {0x11D6A, kValid, 0, 0},
+  {0x11D8F, kDisallowed, 0, 0}, {0x11D90, kValid, 0, 0}, {0x11D92, kDisallowed, 0, 0}, {0x11D93, kValid, 0, 0},
+  {0x11D99, kDisallowed, 0, 0}, {0x11DA0, kValid, 0, 0}, {0x11DAA, kDisallowed, 0, 0}, {0x11EE0, kValid, 0, 0},
+  {0x11EF9, kDisallowed, 0, 0}, {0x11F00, kValid, 0, 0}, {0x11F11, kDisallowed, 0, 0}, {0x11F12, kValid, 0, 0},
+  {0x11F3B, kDisallowed, 0, 0}, {0x11F3E, kValid, 0, 0}, {0x11F5A, kDisallowed, 0, 0}, {0x11FB0, kValid, 0, 0},
+  {0x11FB1, kDisallowed, 0, 0}, {0x11FC0, kValid, 0, 0}, {0x11FF2, kDisallowed, 0, 0}, {0x11FFF, kValid, 0, 0},
+  {0x1239A, kDisallowed, 0, 0}, {0x12400, kValid, 0, 0}, {0x1246F, kDisallowed, 0, 0}, {0x12470, kValid, 0, 0},
+  {0x12475, kDisallowed, 0, 0}, {0x12480, kValid, 0, 0}, {0x12544, kDisallowed, 0, 0}, {0x12F90, kValid, 0, 0},
+  {0x12FF3, kDisallowed, 0, 0}, {0x13000, kValid, 0, 0}, {0x13430, kDisallowed, 0, 0}, {0x13440, kValid, 0, 0},
+  {0x13456, kDisallowed, 0, 0}, {0x14400, kValid, 0, 0}, {0x14647, kDisallowed, 0, 0}, {0x16800, kValid, 0, 0},
+  {0x16A39, kDisallowed, 0, 0}, {0x16A40, kValid, 0, 0}, {0x16A5F, kDisallowed, 0, 0}, {0x16A60, kValid, 0, 0},
+  {0x16A6A, kDisallowed, 0, 0}, {0x16A6E, kValid, 0, 0}, {0x16ABF, kDisallowed, 0, 0}, {0x16AC0, kValid, 0, 0},
+  {0x16ACA, kDisallowed, 0, 0}, {0x16AD0, kValid, 0, 0}, {0x16AEE, kDisallowed, 0, 0}, {0x16AF0, kValid, 0, 0},
+  {0x16AF6, kDisallowed, 0, 0}, {0x16B00, kValid, 0, 0}, {0x16B46, kDisallowed, 0, 0}, {0x16B50, kValid, 0, 0},
+  {0x16B5A, kDisallowed, 0, 0}, {0x16B5B, kValid, 0, 0}, {0x16B62, kDisallowed, 0, 0}, {0x16B63, kValid, 0, 0},
+  {0x16B78, kDisallowed, 0, 0}, {0x16B7D, kValid, 0, 0}, {0x16B90, kDisallowed, 0, 0}, {0x16E40, kMapped, 1, 4715},
+  {0x16E41, kMapped, 1, 4716}, {0x16E42, kMapped, 1, 4717}, {0x16E43, kMapped, 1, 4718}, {0x16E44, kMapped, 1, 4719},
+  {0x16E45, kMapped, 1, 4720}, {0x16E46, kMapped, 1, 4721}, {0x16E47, kMapped, 1, 4722}, {0x16E48, kMapped, 1, 4723},
+  {0x16E49, kMapped, 1, 4724}, {0x16E4A, kMapped, 1, 4725}, {0x16E4B, kMapped, 1, 4726}, {0x16E4C, kMapped, 1, 4727},
+  {0x16E4D, kMapped, 1, 4728}, {0x16E4E, kMapped, 1, 4729}, {0x16E4F, kMapped, 1, 4730}, {0x16E50, kMapped, 1, 4731},
+  {0x16E51, kMapped, 1, 4732}, {0x16E52, kMapped, 1, 4733}, {0x16E53, kMapped, 1, 4734}, {0x16E54, kMapped, 1, 4735},
+  {0x16E55, kMapped, 1, 4736}, {0x16E56, kMapped, 1, 4737}, {0x16E57, kMapped, 1, 4738}, {0x16E58, kMapped, 1, 4739},
+  {0x16E59, kMapped, 1, 4740}, {0x16E5A, kMapped, 1, 4741}, {0x16E5B, kMapped, 1, 4742}, {0x16E5C, kMapped, 1, 4743},
+  {0x16E5D, kMapped, 1, 4744}, {0x16E5E, kMapped, 1, 4745}, {0x16E5F, kMapped, 1, 4746}, {0x16E60, kValid, 0, 0},
+  {0x16E9B, kDisallowed, 0, 0}, {0x16F00, kValid, 0, 0}, {0x16F4B, kDisallowed, 0, 0}, {0x16F4F, kValid, 0, 0},
+  {0x16F88, kDisallowed, 0, 0}, {0x16F8F, kValid, 0, 0}, {0x16FA0, kDisallowed, 0, 0}, {0x16FE0, kValid, 0, 0},
+  {0x16FE5, kDisallowed, 0, 0}, {0x16FF0, kValid, 0, 0}, {0x16FF2, kDisallowed, 0, 0}, {0x17000, kValid, 0, 0},
+  {0x187F8, kDisallowed, 0, 0}, {0x18800, kValid, 0, 0}, {0x18CD6, kDisallowed, 0, 0}, {0x18D00, kValid, 0, 0},
+  {0x18D09, kDisallowed, 0, 0}, {0x1AFF0, kValid, 0, 0}, {0x1AFF4, kDisallowed, 0, 0}, {0x1AFF5, kValid, 0, 0},
+  {0x1AFFC, kDisallowed, 0, 0}, {0x1AFFD, kValid, 0, 0}, {0x1AFFF, kDisallowed, 0, 0}, {0x1B000, kValid, 0, 0},
+  {0x1B123, kDisallowed, 0, 0}, {0x1B132, kValid, 0, 0}, {0x1B133, kDisallowed, 0, 0}, {0x1B150, kValid, 0, 0},
+  {0x1B153, kDisallowed, 0, 0}, {0x1B155, kValid, 0, 0}, {0x1B156, kDisallowed, 0, 0}, {0x1B164, kValid, 0, 0},
+  {0x1B168, kDisallowed, 0, 0}, {0x1B170, kValid, 0, 0}, {0x1B2FC, kDisallowed, 0, 0}, {0x1BC00, kValid, 0, 0},
+  {0x1BC6B, kDisallowed, 0, 0}, {0x1BC70, kValid, 0, 0}, {0x1BC7D, kDisallowed, 0, 0}, {0x1BC80, kValid, 0, 0},
+  {0x1BC89, kDisallowed, 0, 0}, {0x1BC90, kValid, 0, 0}, {0x1BC9A, kDisallowed, 0, 0}, {0x1BC9C, kValid, 0, 0},
+  {0x1BCA0, kMapped, 0, 0}, {0x1BCA4, kDisallowed, 0, 0}, {0x1CF00, kValid, 0, 0}, {0x1CF2E, kDisallowed, 0, 0},
+  {0x1CF30, kValid, 0, 0}, {0x1CF47, kDisallowed, 0, 0}, {0x1CF50, kValid, 0, 0}, {0x1CFC4, kDisallowed, 0, 0},
+  {0x1D000, kValid, 0, 0}, {0x1D0F6, kDisallowed, 0, 0}, {0x1D100, kValid, 0, 0}, {0x1D127, kDisallowed, 0, 0},
+  {0x1D129, kValid, 0, 0}, {0x1D15E, kMapped, 2, 4747}, {0x1D15F, kMapped, 2, 4749}, {0x1D160, kMapped, 3, 4751},
+  {0x1D161, kMapped, 3, 4754}, {0x1D162, kMapped, 3, 4757}, {0x1D163, kMapped, 3, 4760}, {0x1D164, kMapped, 3, 4763},
+  {0x1D165, kValid, 0, 0}, {0x1D173, kDisallowed, 0, 0}, {0x1D17B, kValid, 0, 0}, {0x1D1BB, kMapped, 2, 4766},
+  {0x1D1BC, kMapped, 2, 4768}, {0x1D1BD, kMapped, 3, 4770}, {0x1D1BE, kMapped, 3, 4773}, {0x1D1BF, kMapped, 3, 4776},
+  {0x1D1C0, kMapped, 3, 4779}, {0x1D1C1, kValid, 0, 0}, {0x1D1EB, kDisallowed, 0, 0}, {0x1D200, kValid, 0, 0},
+  {0x1D246, kDisallowed, 0, 0}, {0x1D2C0, kValid, 0, 0}, {0x1D2D4, kDisallowed, 0, 0}, {0x1D2E0, kValid, 0, 0},
+  {0x1D2F4, kDisallowed, 0, 0}, {0x1D300, kValid, 0, 0}, {0x1D357, kDisallowed, 0, 0}, {0x1D360, kValid, 0, 0},
+  {0x1D379, kDisallowed, 0, 0}, {0x1D400, kMapped, 1, 0}, {0x1D401, kMapped, 1, 1}, {0x1D402, kMapped, 1, 2},
+  {0x1D403, kMapped, 1, 3}, {0x1D404, kMapped, 1, 4}, {0x1D405, kMapped, 1, 5}, {0x1D406, kMapped, 1, 6},
+  {0x1D407, kMapped, 1, 7}, {0x1D408, kMapped, 1, 8}, {0x1D409, kMapped, 1, 9}, {0x1D40A, kMapped, 1, 10},
+  {0x1D40B, kMapped, 1, 11}, {0x1D40C, kMapped, 1, 12}, {0x1D40D, kMapped, 1, 13}, {0x1D40E, kMapped, 1, 14},
+  {0x1D40F, kMapped, 1, 15}, {0x1D410, kMapped, 1, 16}, {0x1D411, kMapped, 1, 17}, {0x1D412, kMapped, 1, 18},
+  {0x1D413, kMapped, 1, 19}, {0x1D414, kMapped, 1, 20}, {0x1D415, kMapped, 1, 21}, {0x1D416, kMapped, 1, 22},
+  {0x1D417, kMapped, 1, 23}, {0x1D418, kMapped, 1, 24}, {0x1D419, kMapped, 1, 25}, {0x1D41A, kMapped, 1, 0},
+  {0x1D41B, kMapped, 1, 1}, {0x1D41C, kMapped, 1, 2}, {0x1D41D, kMapped, 1, 3}, {0x1D41E, kMapped, 1, 4},
+  {0x1D41F, kMapped, 1, 5}, {0x1D420, kMapped, 1, 6}, {0x1D421, kMapped, 1, 7}, {0x1D422, kMapped, 1, 8},
+  {0x1D423, kMapped, 1, 9}, {0x1D424, kMapped, 1, 10}, {0x1D425, kMapped, 1, 11}, {0x1D426, kMapped, 1, 12},
+  {0x1D427, kMapped, 1, 13}, {0x1D428, kMapped, 1, 14}, {0x1D429, kMapped, 1, 15}, {0x1D42A, kMapped, 1, 16},
+  {0x1D42B, kMapped, 1, 17}, {0x1D42C, kMapped, 1, 18}, {0x1D42D, kMapped, 1, 19}, {0x1D42E, kMapped, 1, 20},
+  {0x1D42F, kMapped, 1, 21}, {0x1D430, kMapped, 1, 22}, {0x1D431, kMapped, 1, 23}, {0x1D432, kMapped, 1, 24},
+  {0x1D433, kMapped, 1, 25}, {0x1D434, kMapped, 1, 0}, {0x1D435, kMapped, 1, 1}, {0x1D436, kMapped, 1, 2},
+  {0x1D437, kMapped, 1, 3}, {0x1D438, kMapped, 1, 4}, {0x1D439, kMapped, 1, 5}, {0x1D43A, kMapped, 1, 6},
+  {0x1D43B, kMapped, 1, 7}, {0x1D43C, kMapped, 1, 8}, {0x1D43D, kMapped, 1, 9}, {0x1D43E, kMapped, 1, 10},
+  {0x1D43F, kMapped, 1, 11}, {0x1D440, kMapped, 1, 12}, {0x1D441, kMapped, 1, 13}, {0x1D442, kMapped, 1, 14},
+  {0x1D443, kMapped, 1, 15}, {0x1D444, kMapped, 1, 16}, {0x1D445, kMapped, 1, 17}, {0x1D446, kMapped, 1, 18},
+  {0x1D447, kMapped, 1, 19}, {0x1D448, kMapped, 1, 20}, {0x1D449, kMapped, 1, 21}, {0x1D44A, kMapped, 1, 22},
+  {0x1D44B, kMapped, 1, 23}, {0x1D44C, kMapped, 1, 24}, {0x1D44D, kMapped, 1, 25}, {0x1D44E, kMapped, 1, 0},
+  {0x1D44F, kMapped, 1, 1}, {0x1D450, kMapped, 1, 2}, {0x1D451, kMapped, 1, 3}, {0x1D452, kMapped, 1, 4},
+  {0x1D453, kMapped, 1, 5}, {0x1D454, kMapped, 1, 6}, {0x1D455, kDisallowed, 0, 0}, {0x1D456, kMapped, 1, 8},
+  {0x1D457, kMapped, 1, 9}, {0x1D458, kMapped, 1, 10}, {0x1D459, kMapped, 1, 11}, {0x1D45A, kMapped, 1, 12},
+  {0x1D45B, kMapped, 1, 13}, {0x1D45C, kMapped, 1, 14}, {0x1D45D, kMapped, 1, 15}, {0x1D45E, kMapped, 1, 16},
+  {0x1D45F, kMapped, 1, 17}, {0x1D460, kMapped, 1, 18}, {0x1D461, kMapped, 1, 19}, {0x1D462, kMapped, 1, 20},
+  {0x1D463, kMapped, 1, 21}, {0x1D464, kMapped, 1, 22}, {0x1D465, kMapped, 1, 23}, {0x1D466, kMapped, 1, 24},
+  {0x1D467, kMapped, 1, 25}, {0x1D468, kMapped, 1, 0}, {0x1D469, kMapped, 1, 1}, {0x1D46A, kMapped, 1, 2},
+  {0x1D46B, kMapped, 1, 3}, {0x1D46C, kMapped, 1, 4}, {0x1D46D, kMapped, 1, 5}, {0x1D46E, kMapped, 1, 6},
+  {0x1D46F, kMapped, 1, 7}, {0x1D470, kMapped, 1, 8}, {0x1D471, kMapped, 1, 9}, {0x1D472, kMapped, 1, 10},
+  {0x1D473, kMapped, 1, 11}, {0x1D474, kMapped, 1, 12}, {0x1D475, kMapped, 1, 13}, {0x1D476, kMapped, 1, 14},
+  {0x1D477, kMapped, 1, 15}, {0x1D478, kMapped, 1, 16}, {0x1D479, kMapped, 1, 17}, {0x1D47A, kMapped, 1, 18},
+  {0x1D47B, kMapped, 1, 19}, {0x1D47C, kMapped, 1, 20}, {0x1D47D, kMapped, 1, 21}, {0x1D47E, kMapped, 1, 22},
+  {0x1D47F, kMapped, 1, 23}, {0x1D480, kMapped, 1, 24}, {0x1D481, kMapped, 1, 25}, {0x1D482, kMapped, 1, 0},
+  {0x1D483, kMapped, 1, 1}, {0x1D484, kMapped, 1, 2}, {0x1D485, kMapped, 1, 3}, {0x1D486, kMapped, 1, 4},
+  {0x1D487, kMapped, 1, 5}, {0x1D488, kMapped, 1, 6}, {0x1D489, kMapped, 1, 7}, {0x1D48A, kMapped, 1, 8},
+  {0x1D48B, kMapped, 1, 9}, {0x1D48C, kMapped, 1, 10}, {0x1D48D, kMapped, 1, 11}, {0x1D48E, kMapped, 1, 12},
+  {0x1D48F, kMapped, 1, 13}, {0x1D490, kMapped, 1, 14}, {0x1D491, kMapped, 1, 15}, {0x1D492, kMapped, 1, 16},
+  {0x1D493, kMapped, 1, 17}, {0x1D494, kMapped, 1, 18}, {0x1D495, kMapped, 1, 19}, {0x1D496, kMapped, 1, 20},
+  {0x1D497, kMapped, 1, 21}, {0x1D498, kMapped, 1, 22}, {0x1D499, kMapped, 1, 23}, {0x1D49A, kMapped, 1, 24},
+  {0x1D49B, kMapped, 1, 25}, {0x1D49C, kMapped, 1, 0}, {0x1D49D, kDisallowed, 0, 0}, {0x1D49E, kMapped, 1, 2},
+  {0x1D49F, kMapped, 1, 3}, {0x1D4A0, kDisallowed, 0, 0}, {0x1D4A2, kMapped, 1, 6}, {0x1D4A3, kDisallowed, 0, 0},
+  {0x1D4A5, kMapped, 1, 9}, {0x1D4A6, kMapped, 1, 10}, {0x1D4A7, kDisallowed, 0, 0}, {0x1D4A9, kMapped, 1, 13},
+  {0x1D4AA, kMapped, 1, 14}, {0x1D4AB, kMapped, 1, 15}, {0x1D4AC, kMapped, 1, 16}, {0x1D4AD, kDisallowed, 0, 0},
+  {0x1D4AE, kMapped, 1, 18}, {0x1D4AF, kMapped, 1, 19}, {0x1D4B0, kMapped, 1, 20}, {0x1D4B1, kMapped, 1, 21},
+  {0x1D4B2, kMapped, 1, 22}, {0x1D4B3, kMapped, 1, 23}, {0x1D4B4, kMapped, 1, 24}, {0x1D4B5, kMapped, 1, 25},
+  {0x1D4B6, kMapped, 1, 0}, {0x1D4B7, kMapped, 1, 1}, {0x1D4B8, kMapped, 1, 2}, {0x1D4B9, kMapped, 1, 3},
+  {0x1D4BA, kDisallowed, 0, 0}, {0x1D4BB, kMapped, 1, 5}, {0x1D4BC, kDisallowed, 0, 0}, {0x1D4BD, kMapped, 1, 7},
+  {0x1D4BE, kMapped, 1, 8}, {0x1D4BF, kMapped, 1, 9}, {0x1D4C0, kMapped, 1, 10}, {0x1D4C1, kMapped, 1, 11},
+  {0x1D4C2, kMapped, 1, 12}, {0x1D4C3, kMapped, 1, 13}, {0x1D4C4, kDisallowed, 0, 0}, {0x1D4C5, kMapped, 1, 15},
+  {0x1D4C6, kMapped, 1, 16}, {0x1D4C7, kMapped, 1, 17}, {0x1D4C8, kMapped, 1, 18}, {0x1D4C9, kMapped, 1, 19},
+  {0x1D4CA, kMapped, 1, 20}, {0x1D4CB, kMapped, 1, 21}, {0x1D4CC, kMapped, 1, 22}, {0x1D4CD, kMapped, 1, 23},
+  {0x1D4CE, kMapped, 1, 24}, {0x1D4CF, kMapped, 1, 25}, {0x1D4D0, kMapped, 1, 0}, {0x1D4D1, kMapped, 1, 1},
+  {0x1D4D2, kMapped, 1, 2}, {0x1D4D3, kMapped, 1, 3}, {0x1D4D4, kMapped, 1, 4}, {0x1D4D5, kMapped, 1, 5},
+  {0x1D4D6, kMapped, 1, 6}, {0x1D4D7, kMapped, 1, 7}, {0x1D4D8, kMapped, 1, 8}, {0x1D4D9, kMapped, 1, 9},
+  {0x1D4DA, kMapped, 1, 10}, {0x1D4DB, kMapped, 1, 11}, {0x1D4DC, kMapped, 1, 12}, {0x1D4DD, kMapped, 1, 13},
+  {0x1D4DE, kMapped, 1, 14}, {0x1D4DF, kMapped, 1, 15}, {0x1D4E0, kMapped, 1, 16}, {0x1D4E1, kMapped, 1, 17},
+  {0x1D4E2, kMapped, 1, 18}, {0x1D4E3, kMapped, 1, 19}, {0x1D4E4, kMapped, 1, 20}, {0x1D4E5, kMapped, 1, 21},
+  {0x1D4E6, kMapped, 1, 22}, {0x1D4E7, kMapped, 1, 23}, {0x1D4E8, kMapped, 1, 24}, {0x1D4E9, kMapped, 1, 25},
+  {0x1D4EA, kMapped, 1, 0}, {0x1D4EB, kMapped, 1, 1}, {0x1D4EC, kMapped, 1, 2}, {0x1D4ED, kMapped, 1, 3},
+  {0x1D4EE, kMapped, 1, 4}, {0x1D4EF, kMapped, 1, 5}, {0x1D4F0, kMapped, 1, 6}, {0x1D4F1, kMapped, 1, 7},
+  {0x1D4F2, kMapped, 1, 8}, {0x1D4F3, kMapped, 1, 9}, {0x1D4F4, kMapped, 1, 10}, {0x1D4F5, kMapped, 1, 11},
+  {0x1D4F6, kMapped, 1, 12}, {0x1D4F7, kMapped, 1, 13}, {0x1D4F8, kMapped, 1, 14}, {0x1D4F9, kMapped, 1, 15},
+  {0x1D4FA, kMapped, 1, 16}, {0x1D4FB, kMapped, 1, 17}, {0x1D4FC, kMapped, 1, 18}, {0x1D4FD, kMapped, 1, 19},
+  {0x1D4FE, kMapped, 1, 20}, {0x1D4FF, kMapped, 1, 21}, {0x1D500, kMapped, 1, 22}, {0x1D501, kMapped, 1, 23},
+  {0x1D502, kMapped, 1, 24}, {0x1D503, kMapped, 1, 25}, {0x1D504, kMapped, 1, 0}, {0x1D505, kMapped, 1, 1},
+  {0x1D506, kDisallowed, 0, 0}, {0x1D507, kMapped, 1, 3}, {0x1D508, kMapped, 1, 4}, {0x1D509, kMapped, 1, 5},
+  {0x1D50A, kMapped, 1, 6}, {0x1D50B, kDisallowed, 0, 0}, {0x1D50D, kMapped, 1, 9}, {0x1D50E, kMapped, 1, 10},
+  {0x1D50F, kMapped, 1, 11}, {0x1D510, kMapped, 1, 12}, {0x1D511, kMapped, 1, 13}, {0x1D512, kMapped, 1, 14},
+  {0x1D513, kMapped, 1, 15}, {0x1D514, kMapped, 1, 16}, {0x1D515, kDisallowed, 0, 0}, {0x1D516, kMapped, 1, 18},
+  {0x1D517, kMapped, 1, 19}, {0x1D518, kMapped, 1, 20}, {0x1D519, kMapped, 1, 21}, {0x1D51A, kMapped, 1, 22},
+  {0x1D51B, kMapped, 1, 23}, {0x1D51C, kMapped, 1, 24}, {0x1D51D, kDisallowed, 0, 0}, {0x1D51E, kMapped, 1, 0},
+  {0x1D51F, kMapped, 1, 1}, {0x1D520, kMapped, 1, 2}, {0x1D521, kMapped, 1, 3}, {0x1D522, kMapped, 1, 4},
+  {0x1D523, kMapped, 1, 5}, {0x1D524, kMapped, 1, 6}, {0x1D525, kMapped, 1, 7}, {0x1D526, kMapped, 1, 8},
+  {0x1D527, kMapped, 1, 9}, {0x1D528, kMapped, 1, 10}, {0x1D529, kMapped, 1, 11}, {0x1D52A, kMapped, 1, 12},
+  {0x1D52B, kMapped, 1, 13}, {0x1D52C, kMapped, 1, 14}, {0x1D52D, kMapped, 1, 15}, {0x1D52E, kMapped, 1, 16},
+  {0x1D52F, kMapped, 1, 17}, {0x1D530, kMapped, 1, 18}, {0x1D531, kMapped, 1, 19}, {0x1D532, kMapped, 1, 20},
+  {0x1D533, kMapped, 1, 21}, {0x1D534, kMapped, 1, 22}, {0x1D535, kMapped, 1, 23}, {0x1D536, kMapped, 1, 24},
+  {0x1D537, kMapped, 1, 25}, {0x1D538, kMapped, 1, 0}, {0x1D539, kMapped, 1, 1}, {0x1D53A, kDisallowed, 0, 0},
+  {0x1D53B, kMapped, 1, 3}, {0x1D53C, kMapped, 1, 4}, {0x1D53D, kMapped, 1, 5}, {0x1D53E, kMapped, 1, 6},
+  {0x1D53F, kDisallowed, 0, 0}, {0x1D540, kMapped, 1, 8}, {0x1D541, kMapped, 1, 9}, {0x1D542, kMapped, 1, 10},
+  {0x1D543, kMapped, 1, 11}, {0x1D544, kMapped, 1, 12}, {0x1D545, kDisallowed, 0, 0}, {0x1D546, kMapped, 1, 14},
+  {0x1D547, kDisallowed, 0, 0}, {0x1D54A, kMapped, 1, 18}, {0x1D54B, kMapped, 1, 19}, {0x1D54C, kMapped, 1, 20},
+  {0x1D54D, kMapped, 1, 21}, {0x1D54E, kMapped, 1, 22}, {0x1D54F, kMapped, 1, 23}, {0x1D550, kMapped, 1, 24},
+  {0x1D551, kDisallowed, 0, 0}, {0x1D552, kMapped, 1, 0}, {0x1D553, kMapped, 1, 1}, {0x1D554, kMapped, 1, 2},
+  {0x1D555, kMapped, 1, 3}, {0x1D556, kMapped, 1, 4}, {0x1D557, kMapped, 1, 5}, {0x1D558, kMapped, 1, 6},
+  {0x1D559, kMapped, 1, 7}, {0x1D55A, kMapped, 1, 8}, {0x1D55B, kMapped, 1, 9}, {0x1D55C, kMapped, 1, 10},
+  {0x1D55D, kMapped, 1, 11}, {0x1D55E, kMapped, 1, 12}, {0x1D55F, kMapped, 1, 13}, {0x1D560, kMapped, 1, 14},
+  {0x1D561, kMapped, 1, 15}, {0x1D562, kMapped, 1, 16}, {0x1D563, kMapped, 1, 17}, {0x1D564, kMapped, 1, 18},
+  {0x1D565, kMapped, 1, 19}, {0x1D566, kMapped, 1, 20}, {0x1D567, kMapped, 1, 21}, {0x1D568, kMapped, 1, 22},
+  {0x1D569, kMapped, 1, 23}, {0x1D56A, kMapped, 1, 24}, {0x1D56B, kMapped, 1, 25}, {0x1D56C, kMapped, 1, 0},
+  {0x1D56D, kMapped, 1, 1}, {0x1D56E, kMapped, 1, 2}, {0x1D56F, kMapped, 1, 3}, {0x1D570, kMapped, 1, 4},
+  {0x1D571, kMapped, 1, 5}, {0x1D572, kMapped, 1, 6}, {0x1D573, kMapped, 1, 7}, {0x1D574, kMapped, 1, 8},
+  {0x1D575, kMapped, 1, 9}, {0x1D576, kMapped, 1, 10}, {0x1D577, kMapped, 1, 11}, {0x1D578, kMapped, 1, 12},
+  {0x1D579, kMapped, 1, 13}, {0x1D57A, kMapped, 1, 14}, {0x1D57B, kMapped, 1, 15}, {0x1D57C, kMapped, 1, 16},
+  {0x1D57D, kMapped, 1, 17}, {0x1D57E, kMapped, 1, 18}, {0x1D57F, kMapped, 1, 19}, {0x1D580, kMapped, 1, 20},
+  {0x1D581, kMapped, 1, 21}, {0x1D582, kMapped, 1, 22}, {0x1D583, kMapped, 1, 23}, {0x1D584, kMapped, 1, 24},
+  {0x1D585, kMapped, 1, 25}, {0x1D586, kMapped, 1, 0}, {0x1D587, kMapped, 1, 1}, {0x1D588, kMapped, 1, 2},
+  {0x1D589, kMapped, 1, 3}, {0x1D58A, kMapped, 1, 4}, {0x1D58B, kMapped, 1, 5}, {0x1D58C, kMapped, 1, 6},
+  {0x1D58D, kMapped, 1, 7}, {0x1D58E, kMapped, 1, 8}, {0x1D58F, kMapped, 1, 9}, {0x1D590, kMapped, 1, 10},
+  {0x1D591, kMapped, 1, 11}, {0x1D592, kMapped, 1, 12}, {0x1D593, kMapped, 1, 13}, {0x1D594, kMapped, 1, 14},
+  {0x1D595, kMapped, 1, 15}, {0x1D596, kMapped, 1, 16}, {0x1D597, kMapped, 1, 17}, {0x1D598, kMapped, 1, 18},
+  {0x1D599, kMapped, 1, 19}, {0x1D59A, kMapped, 1, 20}, {0x1D59B, kMapped, 1, 21}, {0x1D59C, kMapped, 1, 22},
+  {0x1D59D, kMapped, 1, 23}, {0x1D59E, kMapped, 1, 24}, {0x1D59F, kMapped, 1, 25}, {0x1D5A0, kMapped, 1, 0},
+  {0x1D5A1, kMapped, 1, 1}, {0x1D5A2, kMapped, 1, 2}, {0x1D5A3, kMapped, 1, 3}, {0x1D5A4, kMapped, 1, 4},
+  {0x1D5A5, kMapped, 1, 5}, {0x1D5A6, kMapped, 1, 6}, {0x1D5A7, kMapped, 1, 7}, {0x1D5A8, kMapped, 1, 8},
+  {0x1D5A9, kMapped, 1, 9}, {0x1D5AA, kMapped, 1, 10}, {0x1D5AB, kMapped, 1, 11}, {0x1D5AC, kMapped, 1, 12},
+  {0x1D5AD, kMapped, 1, 13}, {0x1D5AE, kMapped, 1, 14}, {0x1D5AF, kMapped, 1, 15}, {0x1D5B0, kMapped, 1, 16},
+  {0x1D5B1, kMapped, 1, 17}, {0x1D5B2, kMapped, 1, 18}, {0x1D5B3, kMapped, 1, 19}, {0x1D5B4, kMapped, 1, 20},
+  {0x1D5B5, kMapped, 1, 21}, {0x1D5B6, kMapped, 1, 22}, {0x1D5B7, kMapped, 1, 23}, {0x1D5B8, kMapped, 1, 24},
+  {0x1D5B9, kMapped, 1, 25}, {0x1D5BA, kMapped, 1, 0}, {0x1D5BB, kMapped, 1, 1}, {0x1D5BC, kMapped, 1, 2},
+  {0x1D5BD, kMapped, 1, 3}, {0x1D5BE, kMapped, 1, 4}, {0x1D5BF, kMapped, 1, 5}, {0x1D5C0, kMapped, 1, 6},
+  {0x1D5C1, kMapped, 1, 7}, {0x1D5C2, kMapped, 1, 8}, {0x1D5C3, kMapped, 1, 9}, {0x1D5C4, kMapped, 1, 10},
+  {0x1D5C5, kMapped, 1, 11}, {0x1D5C6, kMapped, 1, 12}, {0x1D5C7, kMapped, 1, 13}, {0x1D5C8, kMapped, 1, 14},
+  {0x1D5C9, kMapped, 1, 15}, {0x1D5CA, kMapped, 1, 16}, {0x1D5CB, kMapped, 1, 17}, {0x1D5CC, kMapped, 1, 18},
+  {0x1D5CD, kMapped, 1, 19}, {0x1D5CE, kMapped, 1, 20}, {0x1D5CF, kMapped, 1, 21}, {0x1D5D0, kMapped, 1, 22},
+  {0x1D5D1, kMapped, 1, 23}, {0x1D5D2, kMapped, 1, 24}, {0x1D5D3, kMapped, 1, 25}, {0x1D5D4, kMapped, 1, 0},
+  {0x1D5D5, kMapped, 1, 1}, {0x1D5D6, kMapped, 1, 2}, {0x1D5D7, kMapped, 1, 3}, {0x1D5D8, kMapped, 1, 4},
+  {0x1D5D9, kMapped, 1, 5}, {0x1D5DA, kMapped, 1, 6}, {0x1D5DB, kMapped, 1, 7}, {0x1D5DC, kMapped, 1, 8},
+  {0x1D5DD, kMapped, 1, 9}, {0x1D5DE, kMapped, 1, 10}, {0x1D5DF, kMapped, 1, 11}, {0x1D5E0, kMapped, 1, 12},
+  {0x1D5E1, kMapped, 1, 13}, {0x1D5E2, kMapped, 1, 14}, {0x1D5E3, kMapped, 1, 15}, {0x1D5E4, kMapped, 1, 16},
+  {0x1D5E5, kMapped, 1, 17}, {0x1D5E6, kMapped, 1, 18}, {0x1D5E7, kMapped, 1, 19}, {0x1D5E8, kMapped, 1, 20},
+  {0x1D5E9, kMapped, 1, 21}, {0x1D5EA, kMapped, 1, 22}, {0x1D5EB, kMapped, 1, 23}, {0x1D5EC, kMapped, 1, 24},
+  {0x1D5ED, kMapped, 1, 25}, {0x1D5EE, kMapped, 1, 0}, {0x1D5EF, kMapped, 1, 1}, {0x1D5F0, kMapped, 1, 2},
+  {0x1D5F1, kMapped, 1, 3}, {0x1D5F2, kMapped, 1, 4}, {0x1D5F3, kMapped, 1, 5}, {0x1D5F4, kMapped, 1, 6},
+  {0x1D5F5, kMapped, 1, 7}, {0x1D5F6, kMapped, 1, 8}, {0x1D5F7, kMapped, 1, 9}, {0x1D5F8, kMapped, 1, 10},
+  {0x1D5F9, kMapped, 1, 11}, {0x1D5FA, kMapped, 1, 12}, {0x1D5FB, kMapped, 1, 13}, {0x1D5FC, kMapped, 1, 14},
+  {0x1D5FD, kMapped, 1, 15}, {0x1D5FE, kMapped, 1, 16}, {0x1D5FF, kMapped, 1, 17}, {0x1D600, kMapped, 1, 18},
+  {0x1D601, kMapped, 1, 19}, {0x1D602, kMapped, 1, 20}, {0x1D603, kMapped, 1, 21}, {0x1D604, kMapped, 1, 22},
+  {0x1D605, kMapped, 1, 23}, {0x1D606, kMapped, 1, 24}, {0x1D607, kMapped, 1, 25}, {0x1D608, kMapped, 1, 0},
+  {0x1D609, kMapped, 1, 1}, {0x1D60A, kMapped, 1, 2}, {0x1D60B, kMapped, 1, 3}, {0x1D60C, kMapped, 1, 4},
+  {0x1D60D, kMapped, 1, 5}, {0x1D60E, kMapped, 1, 6}, {0x1D60F, kMapped, 1, 7}, {0x1D610, kMapped, 1, 8},
+  {0x1D611, kMapped, 1, 9}, {0x1D612, kMapped, 1, 10}, {0x1D613, kMapped, 1, 11}, {0x1D614, kMapped, 1, 12},
+  {0x1D615, kMapped, 1, 13}, {0x1D616, kMapped, 1, 14}, {0x1D617, kMapped, 1, 15}, {0x1D618, kMapped, 1, 16},
+  {0x1D619, kMapped, 1, 17}, {0x1D61A, kMapped, 1, 18}, {0x1D61B, kMapped, 1, 19}, {0x1D61C, kMapped, 1, 20},
+  {0x1D61D, kMapped, 1, 21}, {0x1D61E, kMapped, 1, 22}, {0x1D61F, kMapped, 1, 23}, {0x1D620, kMapped, 1, 24},
+  {0x1D621, kMapped, 1, 25}, {0x1D622, kMapped, 1, 0}, {0x1D623, kMapped, 1, 1}, {0x1D624, kMapped, 1, 2},
+  {0x1D625, kMapped, 1, 3}, {0x1D626, kMapped, 1, 4}, {0x1D627, kMapped, 1, 5}, {0x1D628, kMapped, 1, 6},
+  {0x1D629, kMapped, 1, 7}, {0x1D62A, kMapped, 1, 8}, {0x1D62B, kMapped, 1, 9}, {0x1D62C, kMapped, 1, 10},
+  {0x1D62D, kMapped, 1, 11}, {0x1D62E, kMapped, 1, 12}, {0x1D62F, kMapped, 1, 13}, {0x1D630, kMapped, 1, 14},
+  {0x1D631, kMapped, 1, 15}, {0x1D632, kMapped, 1, 16}, {0x1D633, kMapped, 1, 17}, {0x1D634, kMapped, 1, 18},
+  {0x1D635, kMapped, 1, 19}, {0x1D636, kMapped, 1, 20}, {0x1D637, kMapped, 1, 21}, {0x1D638, kMapped, 1, 22},
+  {0x1D639, kMapped, 1, 23}, {0x1D63A, kMapped, 1, 24}, {0x1D63B, kMapped, 1, 25}, {0x1D63C, kMapped, 1, 0},
+  {0x1D63D, kMapped, 1, 1}, {0x1D63E, kMapped, 1, 2}, {0x1D63F, kMapped, 1, 3}, {0x1D640, kMapped, 1, 4},
+  {0x1D641, kMapped, 1, 5}, {0x1D642, kMapped, 1, 6}, {0x1D643, kMapped, 1, 7}, {0x1D644, kMapped, 1, 8},
+  {0x1D645, kMapped, 1, 9}, {0x1D646, kMapped, 1, 10}, {0x1D647, kMapped, 1, 11}, {0x1D648, kMapped, 1, 12},
+  {0x1D649, kMapped, 1, 13}, {0x1D64A, kMapped, 1, 14}, {0x1D64B, kMapped, 1, 15}, {0x1D64C, kMapped, 1, 16},
+  {0x1D64D, kMapped, 1, 17}, {0x1D64E, kMapped, 1, 18}, {0x1D64F, kMapped, 1, 19}, {0x1D650, kMapped, 1, 20},
+  {0x1D651, kMapped, 1, 21}, {0x1D652, kMapped, 1, 22}, {0x1D653, kMapped, 1, 23}, {0x1D654, kMapped, 1, 24},
+  {0x1D655, kMapped, 1, 25}, {0x1D656, kMapped, 1, 0}, {0x1D657, kMapped, 1, 1}, {0x1D658, kMapped, 1, 2},
+  {0x1D659, kMapped, 1, 3}, {0x1D65A, kMapped, 1, 4}, {0x1D65B, kMapped, 1, 5}, {0x1D65C, kMapped, 1, 6},
+  {0x1D65D, kMapped, 1, 7}, {0x1D65E, kMapped, 1, 8}, {0x1D65F, kMapped, 1, 9}, {0x1D660, kMapped, 1, 10},
+  {0x1D661, kMapped, 1, 11}, {0x1D662, kMapped, 1, 12}, {0x1D663, kMapped, 1, 13}, {0x1D664, kMapped, 1, 14},
+  {0x1D665, kMapped, 1, 15}, {0x1D666, kMapped, 1, 16}, {0x1D667, kMapped, 1, 17}, {0x1D668, kMapped, 1, 18},
+  {0x1D669, kMapped, 1, 19}, {0x1D66A, kMapped, 1, 20}, {0x1D66B, kMapped, 1, 21}, {0x1D66C, kMapped, 1, 22},
+  {0x1D66D, kMapped, 1, 23}, {0x1D66E, kMapped, 1, 24}, {0x1D66F, kMapped, 1, 25}, {0x1D670, kMapped, 1, 0},
+  {0x1D671, kMapped, 1, 1}, {0x1D672, kMapped, 1, 2}, {0x1D673, kMapped, 1, 3}, {0x1D674, kMapped, 1, 4},
+  {0x1D675, kMapped, 1, 5}, {0x1D676, kMapped, 1, 6}, {0x1D677, kMapped, 1, 7}, {0x1D678, kMapped, 1, 8},
+  {0x1D679, kMapped, 1, 9}, {0x1D67A, kMapped, 1, 10}, {0x1D67B, kMapped, 1, 11}, {0x1D67C, kMapped, 1, 12},
+  {0x1D67D, kMapped, 1, 13}, {0x1D67E, kMapped, 1, 14}, {0x1D67F, kMapped, 1, 15}, {0x1D680, kMapped, 1, 16},
+  {0x1D681, kMapped, 1, 17}, {0x1D682, kMapped, 1, 18}, {0x1D683, kMapped, 1, 19}, {0x1D684, kMapped, 1, 20},
+  {0x1D685, kMapped, 1, 21}, {0x1D686, kMapped, 1, 22}, {0x1D687, kMapped, 1, 23}, {0x1D688, kMapped, 1, 24},
+  {0x1D689, kMapped, 1, 25}, {0x1D68A, kMapped, 1, 0}, {0x1D68B, kMapped, 1, 1}, {0x1D68C, kMapped, 1, 2},
+  {0x1D68D, kMapped, 1, 3}, {0x1D68E, kMapped, 1, 4}, {0x1D68F, kMapped, 1, 5}, {0x1D690, kMapped, 1, 6},
+  {0x1D691, kMapped, 1, 7}, {0x1D692, kMapped, 1, 8}, {0x1D693, kMapped, 1, 9}, {0x1D694, kMapped, 1, 10},
+  {0x1D695, kMapped, 1, 11}, {0x1D696, kMapped, 1, 12}, {0x1D697, kMapped, 1, 13}, {0x1D698, kMapped, 1, 14},
+  {0x1D699, kMapped, 1, 15}, {0x1D69A, kMapped, 1, 16}, {0x1D69B, kMapped, 1, 17}, {0x1D69C, kMapped, 1, 18},
+  {0x1D69D, kMapped, 1, 19}, {0x1D69E, kMapped, 1, 20}, {0x1D69F, kMapped, 1, 21}, {0x1D6A0, kMapped, 1, 22},
+  {0x1D6A1, kMapped, 1, 23}, {0x1D6A2, kMapped, 1, 24}, {0x1D6A3, kMapped, 1, 25}, {0x1D6A4, kMapped, 1, 4782},
+  {0x1D6A5, kMapped, 1, 4783}, {0x1D6A6, kDisallowed, 0, 0}, {0x1D6A8, kMapped, 1, 295}, {0x1D6A9, kMapped, 1, 296},
+  {0x1D6AA, kMapped, 1, 297}, {0x1D6AB, kMapped, 1, 298}, {0x1D6AC, kMapped, 1, 299}, {0x1D6AD, kMapped, 1, 300},
+  {0x1D6AE, kMapped, 1, 301}, {0x1D6AF, kMapped, 1, 302}, {0x1D6B0, kMapped, 1, 275}, {0x1D6B1, kMapped, 1, 303},
+  {0x1D6B2, kMapped, 1, 304}, {0x1D6B3, kMapped, 1, 35}, {0x1D6B4, kMapped, 1, 305}, {0x1D6B5, kMapped, 1, 306},
+  {0x1D6B6, kMapped, 1, 307}, {0x1D6B7, kMapped, 1, 308}, {0x1D6B8, kMapped, 1, 309}, {0x1D6B9, kMapped, 1, 302},
+  {0x1D6BA, kMapped, 1, 310}, {0x1D6BB, kMapped, 1, 311}, {0x1D6BC, kMapped, 1, 312}, {0x1D6BD, kMapped, 1, 313},
+  {0x1D6BE, kMapped, 1, 314}, {0x1D6BF, kMapped, 1, 315}, {0x1D6C0, kMapped, 1, 316}, {0x1D6C1, kMapped, 1, 4784},
+  {0x1D6C2, kMapped, 1, 295}, {0x1D6C3, kMapped, 1, 296}, {0x1D6C4, kMapped, 1, 297}, {0x1D6C5, kMapped, 1, 298},
+  {0x1D6C6, kMapped, 1, 299}, {0x1D6C7, kMapped, 1, 300}, {0x1D6C8, kMapped, 1, 301}, {0x1D6C9, kMapped, 1, 302},
+  {0x1D6CA, kMapped, 1, 275}, {0x1D6CB, kMapped, 1, 303}, {0x1D6CC, kMapped, 1, 304}, {0x1D6CD, kMapped, 1, 35},
+  {0x1D6CE, kMapped, 1, 305}, {0x1D6CF, kMapped, 1, 306}, {0x1D6D0, kMapped, 1, 307}, {0x1D6D1, kMapped, 1, 308},
+  {0x1D6D2, kMapped, 1, 309}, {0x1D6D3, kMapped, 1, 310}, {0x1D6D5, kMapped, 1, 311}, {0x1D6D6, kMapped, 1, 312},
+  {0x1D6D7, kMapped, 1, 313}, {0x1D6D8, kMapped, 1, 314}, {0x1D6D9, kMapped, 1, 315}, {0x1D6DA, kMapped, 1, 316},
+  {0x1D6DB, kMapped, 1, 4785}, {0x1D6DC, kMapped, 1, 299}, {0x1D6DD, kMapped, 1, 302}, {0x1D6DE, kMapped, 1, 303},
+  {0x1D6DF, kMapped, 1, 313}, {0x1D6E0, kMapped, 1, 309}, {0x1D6E1, kMapped, 1, 308}, {0x1D6E2, kMapped, 1, 295},
+  {0x1D6E3, kMapped, 1, 296}, {0x1D6E4, kMapped, 1, 297}, {0x1D6E5, kMapped, 1, 298}, {0x1D6E6, kMapped, 1, 299},
+  {0x1D6E7, kMapped, 1, 300}, {0x1D6E8, kMapped, 1, 301}, {0x1D6E9, kMapped, 1, 302}, {0x1D6EA, kMapped, 1, 275},
+  {0x1D6EB, kMapped, 1, 303}, {0x1D6EC, kMapped, 1, 304}, {0x1D6ED, kMapped, 1, 35}, {0x1D6EE, kMapped, 1, 305},
+  {0x1D6EF, kMapped, 1, 306}, {0x1D6F0, kMapped, 1, 307}, {0x1D6F1, kMapped, 1, 308}, {0x1D6F2, kMapped, 1, 309},
+  {0x1D6F3, kMapped, 1, 302}, {0x1D6F4, kMapped, 1, 310}, {0x1D6F5, kMapped, 1, 311}, {0x1D6F6, kMapped, 1, 312},
+  {0x1D6F7, kMapped, 1, 313}, {0x1D6F8, kMapped, 1, 314}, {0x1D6F9, kMapped, 1, 315}, {0x1D6FA, kMapped, 1, 316},
+  {0x1D6FB, kMapped, 1, 4784}, {0x1D6FC, kMapped, 1, 295}, {0x1D6FD, kMapped, 1, 296}, {0x1D6FE, kMapped, 1, 297},
+  {0x1D6FF, kMapped, 1, 298}, {0x1D700, kMapped, 1, 299}, {0x1D701, kMapped, 1, 300}, {0x1D702, kMapped, 1, 301},
+  {0x1D703, kMapped, 1, 302}, {0x1D704, kMapped, 1, 275}, {0x1D705, kMapped, 1, 303}, {0x1D706, kMapped, 1, 304},
+  {0x1D707, kMapped, 1, 35}, {0x1D708, kMapped, 1, 305}, {0x1D709, kMapped, 1, 306}, {0x1D70A, kMapped, 1, 307},
+  {0x1D70B, kMapped, 1, 308}, {0x1D70C, kMapped, 1, 309}, {0x1D70D, kMapped, 1, 310}, {0x1D70F, kMapped, 1, 311},
+  {0x1D710, kMapped, 1, 312}, {0x1D711, kMapped, 1, 313}, {0x1D712, kMapped, 1, 314}, {0x1D713, kMapped, 1, 315},
+  {0x1D714, kMapped, 1, 316}, {0x1D715, kMapped, 1, 4785}, {0x1D716, kMapped, 1, 299}, {0x1D717, kMapped, 1, 302},
+  {0x1D718, kMapped, 1, 303}, {0x1D719, kMapped, 1, 313}, {0x1D71A, kMapped, 1, 309}, {0x1D71B, kMapped, 1, 308},
+  {0x1D71C, kMapped, 1, 295}, {0x1D71D, kMapped, 1, 296}, {0x1D71E, kMapped, 1, 297}, {0x1D71F, kMapped, 1, 298},
+  {0x1D720, kMapped, 1, 299}, {0x1D721, kMapped, 1, 300}, {0x1D722, kMapped, 1, 301}, {0x1D723, kMapped, 1, 302},
+  {0x1D724, kMapped, 1, 275}, {0x1D725, kMapped, 1, 303}, {0x1D726, kMapped, 1, 304}, {0x1D727, kMapped, 1, 35},
+  {0x1D728, kMapped, 1, 305}, {0x1D729, kMapped, 1, 306}, {0x1D72A, kMapped, 1, 307}, {0x1D72B, kMapped, 1, 308},
+  {0x1D72C, kMapped, 1, 309}, {0x1D72D, kMapped, 1, 302}, {0x1D72E, kMapped, 1, 310}, {0x1D72F, kMapped, 1, 311},
+  {0x1D730, kMapped, 1, 312}, {0x1D731, kMapped, 1, 313}, {0x1D732, kMapped, 1, 314}, {0x1D733, kMapped, 1, 315},
+  {0x1D734, kMapped, 1, 316}, {0x1D735, kMapped, 1, 4784}, {0x1D736, kMapped, 1, 295}, {0x1D737, kMapped, 1, 296},
+  {0x1D738, kMapped, 1, 297}, {0x1D739, kMapped, 1, 298}, {0x1D73A, kMapped, 1, 299}, {0x1D73B, kMapped, 1, 300},
+  {0x1D73C, kMapped, 1, 301}, {0x1D73D, kMapped, 1, 302}, {0x1D73E, kMapped, 1, 275}, {0x1D73F, kMapped, 1, 303},
+  {0x1D740, kMapped, 1, 304}, {0x1D741, kMapped, 1, 35}, {0x1D742, kMapped, 1, 305}, {0x1D743, kMapped, 1, 306},
+  {0x1D744, kMapped, 1, 307}, {0x1D745, kMapped, 1, 308}, {0x1D746, kMapped, 1, 309}, {0x1D747, kMapped, 1, 310},
+  {0x1D749, kMapped, 1, 311}, {0x1D74A, kMapped, 1, 312}, {0x1D74B, kMapped, 1, 313}, {0x1D74C, kMapped, 1, 314},
+  {0x1D74D, kMapped, 1, 315}, {0x1D74E, kMapped, 1, 316}, {0x1D74F, kMapped, 1, 4785}, {0x1D750, kMapped, 1, 299},
+  {0x1D751, kMapped, 1, 302}, {0x1D752, kMapped, 1, 303}, {0x1D753, kMapped, 1, 313}, {0x1D754, kMapped, 1, 309},
+  {0x1D755, kMapped, 1, 308}, {0x1D756, kMapped, 1, 295}, {0x1D757, kMapped, 1, 296}, {0x1D758, kMapped, 1, 297},
+  {0x1D759, kMapped, 1, 298}, {0x1D75A, kMapped, 1, 299}, {0x1D75B, kMapped, 1, 300}, {0x1D75C, kMapped, 1, 301},
+  {0x1D75D, kMapped, 1, 302}, {0x1D75E, kMapped, 1, 275}, {0x1D75F, kMapped, 1, 303}, {0x1D760, kMapped, 1, 304},
+  {0x1D761, kMapped, 1, 35}, {0x1D762, kMapped, 1, 305}, {0x1D763, kMapped, 1, 306}, {0x1D764, kMapped, 1, 307},
+  {0x1D765, kMapped, 1, 308}, {0x1D766, kMapped, 1, 309}, {0x1D767, kMapped, 1, 302}, {0x1D768, kMapped, 1, 310},
+  {0x1D769, kMapped, 1, 311}, {0x1D76A, kMapped, 1, 312}, {0x1D76B, kMapped, 1, 313}, {0x1D76C, kMapped, 1, 314},
+  {0x1D76D, kMapped, 1, 315}, {0x1D76E, kMapped, 1, 316}, {0x1D76F, kMapped, 1, 4784}, {0x1D770, kMapped, 1, 295},
+  {0x1D771, kMapped, 1, 296}, {0x1D772, kMapped, 1, 297}, {0x1D773, kMapped, 1, 298}, {0x1D774, kMapped, 1, 299},
+  {0x1D775, kMapped, 1, 300}, {0x1D776, kMapped, 1, 301}, {0x1D777, kMapped, 1, 302}, {0x1D778, kMapped, 1, 275},
+  {0x1D779, kMapped, 1, 303}, {0x1D77A, kMapped, 1, 304}, {0x1D77B, kMapped, 1, 35}, {0x1D77C, kMapped, 1, 305},
+  {0x1D77D, kMapped, 1, 306}, {0x1D77E, kMapped, 1, 307}, {0x1D77F, kMapped, 1, 308}, {0x1D780, kMapped, 1, 309},
+  {0x1D781, kMapped, 1, 310}, {0x1D783, kMapped, 1, 311}, {0x1D784, kMapped, 1, 312}, {0x1D785, kMapped, 1, 313},
+  {0x1D786, kMapped, 1, 314}, {0x1D787, kMapped, 1, 315}, {0x1D788, kMapped, 1, 316}, {0x1D789, kMapped, 1, 4785},
+  {0x1D78A, kMapped, 1, 299}, {0x1D78B, kMapped, 1, 302}, {0x1D78C, kMapped, 1, 303}, {0x1D78D, kMapped, 1, 313},
+  {0x1D78E, kMapped, 1, 309}, {0x1D78F, kMapped, 1, 308}, {0x1D790, kMapped, 1, 295}, {0x1D791, kMapped, 1, 296},
+  {0x1D792, kMapped, 1, 297}, {0x1D793, kMapped, 1, 298}, {0x1D794, kMapped, 1, 299}, {0x1D795, kMapped, 1, 300},
+  {0x1D796, kMapped, 1, 301}, {0x1D797, kMapped, 1, 302}, {0x1D798, kMapped, 1, 275}, {0x1D799, kMapped, 1, 303},
+  {0x1D79A, kMapped, 1, 304}, {0x1D79B, kMapped, 1, 35}, {0x1D79C, kMapped, 1, 305}, {0x1D79D, kMapped, 1, 306},
+  {0x1D79E, kMapped, 1, 307}, {0x1D79F, kMapped, 1, 308}, {0x1D7A0, kMapped, 1, 309}, {0x1D7A1, kMapped, 1, 302},
+  {0x1D7A2, kMapped, 1, 310}, {0x1D7A3, kMapped, 1, 311}, {0x1D7A4, kMapped, 1, 312}, {0x1D7A5, kMapped, 1, 313},
+  {0x1D7A6, kMapped, 1, 314}, {0x1D7A7, kMapped, 1, 315}, {0x1D7A8, kMapped, 1, 316}, {0x1D7A9, kMapped, 1, 4784},
+  {0x1D7AA, kMapped, 1, 295}, {0x1D7AB, kMapped, 1, 296}, {0x1D7AC, kMapped, 1, 297}, {0x1D7AD, kMapped, 1, 298},
+  {0x1D7AE, kMapped, 1, 299}, {0x1D7AF, kMapped, 1, 300}, {0x1D7B0, kMapped, 1, 301}, {0x1D7B1, kMapped, 1, 302},
+  {0x1D7B2, kMapped, 1, 275}, {0x1D7B3, kMapped, 1, 303}, {0x1D7B4, kMapped, 1, 304}, {0x1D7B5, kMapped, 1, 35},
+  {0x1D7B6, kMapped, 1, 305}, {0x1D7B7, kMapped, 1, 306}, {0x1D7B8, kMapped, 1, 307}, {0x1D7B9, kMapped, 1, 308},
+  {0x1D7BA, kMapped, 1, 309}, {0x1D7BB, kMapped, 1, 310}, {0x1D7BD, kMapped, 1, 311}, {0x1D7BE, kMapped, 1, 312},
+  {0x1D7BF, kMapped, 1, 313}, {0x1D7C0, kMapped, 1, 314}, {0x1D7C1, kMapped, 1, 315}, {0x1D7C2, kMapped, 1, 316},
+  {0x1D7C3, kMapped, 1, 4785}, {0x1D7C4, kMapped, 1, 299}, {0x1D7C5, kMapped, 1, 302}, {0x1D7C6, kMapped, 1, 303},
+  {0x1D7C7, kMapped, 1, 313}, {0x1D7C8, kMapped, 1, 309}, {0x1D7C9, kMapped, 1, 308}, {0x1D7CA, kMapped, 1, 322},
+  {0x1D7CC, kDisallowed, 0, 0}, {0x1D7CE, kMapped, 1, 1023}, {0x1D7CF, kMapped, 1, 38}, {0x1D7D0, kMapped, 1, 31},
+  {0x1D7D1, kMapped, 1, 32}, {0x1D7D2, kMapped, 1, 1024}, {0x1D7D3, kMapped, 1, 1025}, {0x1D7D4, kMapped, 1, 1026},
+  {0x1D7D5, kMapped, 1, 1027}, {0x1D7D6, kMapped, 1, 1028}, {0x1D7D7, kMapped, 1, 1029}, {0x1D7D8, kMapped, 1, 1023},
+  {0x1D7D9, kMapped, 1, 38}, {0x1D7DA, kMapped, 1, 31}, {0x1D7DB, kMapped, 1, 32}, {0x1D7DC, kMapped, 1, 1024},
+  {0x1D7DD, kMapped, 1, 1025}, {0x1D7DE, kMapped, 1, 1026}, {0x1D7DF, kMapped, 1, 1027}, {0x1D7E0, kMapped, 1, 1028},
+  {0x1D7E1, kMapped, 1, 1029}, {0x1D7E2, kMapped, 1, 1023}, {0x1D7E3, kMapped, 1, 38}, {0x1D7E4, kMapped, 1, 31},
+  {0x1D7E5, kMapped, 1, 32}, {0x1D7E6, kMapped, 1, 1024}, {0x1D7E7, kMapped, 1, 1025}, {0x1D7E8, kMapped, 1, 1026},
+  {0x1D7E9, kMapped, 1, 1027}, {0x1D7EA, kMapped, 1, 1028}, {0x1D7EB, kMapped, 1, 1029}, {0x1D7EC, kMapped, 1, 1023},
+  {0x1D7ED, kMapped, 1, 38}, {0x1D7EE, kMapped, 1, 31}, {0x1D7EF, kMapped, 1, 32}, {0x1D7F0, kMapped, 1, 1024},
+  {0x1D7F1, kMapped, 1, 1025}, {0x1D7F2, kMapped, 1, 1026}, {0x1D7F3, kMapped, 1, 1027}, {0x1D7F4, kMapped, 1, 1028},
+  {0x1D7F5, kMapped, 1, 1029}, {0x1D7F6, kMapped, 1, 1023}, {0x1D7F7, kMapped, 1, 38}, {0x1D7F8, kMapped, 1, 31},
+  {0x1D7F9, kMapped, 1, 32}, {0x1D7FA, kMapped, 1, 1024}, {0x1D7FB, kMapped, 1, 1025}, {0x1D7FC, kMapped, 1, 1026},
+  {0x1D7FD, kMapped, 1, 1027}, {0x1D7FE, kMapped, 1, 1028}, {0x1D7FF, kMapped, 1, 1029}, {0x1D800, kValid, 0, 0},
+  {0x1DA8C, kDisallowed, 0, 0}, {0x1DA9B, kValid, 0, 0}, {0x1DAA0, kDisallowed, 0, 0}, {0x1DAA1, kValid, 0, 0},
+  {0x1DAB0, kDisallowed, 0, 0}, {0x1DF00, kValid, 0, 0}, {0x1DF1F, kDisallowed, 0, 0}, {0x1DF25, kValid, 0, 0},
+  {0x1DF2B, kDisallowed, 0, 0}, {0x1E000, kValid, 0, 0}, {0x1E007, kDisallowed, 0, 0}, {0x1E008, kValid, 0, 0},
+  {0x1E019, kDisallowed, 0, 0}, {0x1E01B, kValid, 0, 0}, {0x1E022, kDisallowed, 0, 0}, {0x1E023, kValid, 0, 0},
+  {0x1E025, kDisallowed, 0, 0}, {0x1E026, kValid, 0, 0}, {0x1E02B, kDisallowed, 0, 0}, {0x1E030, kMapped, 1, 353},
+  {0x1E031, kMapped, 1, 354}, {0x1E032, kMapped, 1, 355}, {0x1E033, kMapped, 1, 356}, {0x1E034, kMapped, 1, 357},
+  {0x1E035, kMapped, 1, 358}, {0x1E036, kMapped, 1, 359}, {0x1E037, kMapped, 1, 360}, {0x1E038, kMapped, 1, 361},
+  {0x1E039, kMapped, 1, 363}, {0x1E03A, kMapped, 1, 364}, {0x1E03B, kMapped, 1, 365}, {0x1E03C, kMapped, 1, 367},
+  {0x1E03D, kMapped, 1, 368}, {0x1E03E, kMapped, 1, 369}, {0x1E03F, kMapped, 1, 370}, {0x1E040, kMapped, 1, 371},
+  {0x1E041, kMapped, 1, 372}, {0x1E042, kMapped, 1, 373}, {0x1E043, kMapped, 1, 374}, {0x1E044, kMapped, 1, 375},
+  {0x1E045, kMapped, 1, 376}, {0x1E046, kMapped, 1, 377}, {0x1E047, kMapped, 1, 380}, {0x1E048, kMapped, 1, 382},
+  {0x1E049, kMapped, 1, 383}, {0x1E04A, kMapped, 1, 2918}, {0x1E04B, kMapped, 1, 440}, {0x1E04C, kMapped, 1, 343},
+  {0x1E04D, kMapped, 1, 345}, {0x1E04E, kMapped, 1, 448}, {0x1E04F, kMapped, 1, 420}, {0x1E050, kMapped, 1, 4786},
+  {0x1E051, kMapped, 1, 353}, {0x1E052, kMapped, 1, 354}, {0x1E053, kMapped, 1, 355}, {0x1E054, kMapped, 1, 356},
+  {0x1E055, kMapped, 1, 357}, {0x1E056, kMapped, 1, 358}, {0x1E057, kMapped, 1, 359}, {0x1E058, kMapped, 1, 360},
+  {0x1E059, kMapped, 1, 361}, {0x1E05A, kMapped, 1, 363}, {0x1E05B, kMapped, 1, 364}, {0x1E05C, kMapped, 1, 367},
+  {0x1E05D, kMapped, 1, 368}, {0x1E05E, kMapped, 1, 370}, {0x1E05F, kMapped, 1, 372}, {0x1E060, kMapped, 1, 373},
+  {0x1E061, kMapped, 1, 374}, {0x1E062, kMapped, 1, 375}, {0x1E063, kMapped, 1, 376}, {0x1E064, kMapped, 1, 377},
+  {0x1E065, kMapped, 1, 379}, {0x1E066, kMapped, 1, 380}, {0x1E067, kMapped, 1, 405}, {0x1E068, kMapped, 1, 343},
+  {0x1E069, kMapped, 1, 342}, {0x1E06A, kMapped, 1, 352}, {0x1E06B, kMapped, 1, 418}, {0x1E06C, kMapped, 1, 2899},
+  {0x1E06D, kMapped, 1, 421}, {0x1E06E, kDisallowed, 0, 0}, {0x1E08F, kValid, 0, 0}, {0x1E090, kDisallowed, 0, 0},
+  {0x1E100, kValid, 0, 0}, {0x1E12D, kDisallowed, 0, 0}, {0x1E130, kValid, 0, 0}, {0x1E13E, kDisallowed, 0, 0},
+  {0x1E140, kValid, 0, 0}, {0x1E14A, kDisallowed, 0, 0}, {0x1E14E, kValid, 0, 0}, {0x1E150, kDisallowed, 0, 0},
+  {0x1E290, kValid, 0, 0}, {0x1E2AF, kDisallowed, 0, 0}, {0x1E2C0, kValid, 0, 0}, {0x1E2FA, kDisallowed, 0, 0},
+  {0x1E2FF, kValid, 0, 0}, {0x1E300, kDisallowed, 0, 0}, {0x1E4D0, kValid, 0, 0}, {0x1E4FA, kDisallowed, 0, 0},
+  {0x1E7E0, kValid, 0, 0}, {0x1E7E7, kDisallowed, 0, 0}, {0x1E7E8, kValid, 0, 0}, {0x1E7EC, kDisallowed, 0, 0},
+  {0x1E7ED, kValid, 0, 0}, {0x1E7EF, kDisallowed, 0, 0}, {0x1E7F0, kValid, 0, 0}, {0x1E7FF, kDisallowed, 0, 0},
+  {0x1E800, kValid, 0, 0}, {0x1E8C5, kDisallowed, 0, 0}, {0x1E8C7, kValid, 0, 0}, {0x1E8D7, kDisallowed, 0, 0},
+  {0x1E900, kMapped, 1, 4787}, {0x1E901, kMapped, 1, 4788}, {0x1E902, kMapped, 1, 4789}, {0x1E903, kMapped, 1, 4790},
+  {0x1E904, kMapped, 1, 4791}, {0x1E905, kMapped, 1, 4792}, {0x1E906, kMapped, 1, 4793}, {0x1E907, kMapped, 1, 4794},
+  {0x1E908, kMapped, 1, 4795}, {0x1E909, kMapped, 1, 4796}, {0x1E90A, kMapped, 1, 4797}, {0x1E90B, kMapped, 1, 4798},
+  {0x1E90C, kMapped, 1, 4799}, {0x1E90D, kMapped, 1, 4800}, {0x1E90E, kMapped, 1, 4801}, {0x1E90F, kMapped, 1, 4802},
+  {0x1E910, kMapped, 1, 4803}, {0x1E911, kMapped, 1, 4804}, {0x1E912, kMapped, 1, 4805}, {0x1E913, kMapped, 1, 4806},
+  {0x1E914, kMapped, 1, 4807}, {0x1E915, kMapped, 1, 4808}, {0x1E916, kMapped, 1, 4809}, {0x1E917, kMapped, 1, 4810},
+  {0x1E918, kMapped, 1, 4811}, {0x1E919, kMapped, 1, 4812}, {0x1E91A, kMapped, 1, 4813}, {0x1E91B, kMapped, 1, 4814},
+  {0x1E91C, kMapped, 1, 4815}, {0x1E91D, kMapped, 1, 4816}, {0x1E91E, kMapped, 1, 4817}, {0x1E91F, kMapped, 1, 4818},
+  {0x1E920, kMapped, 1, 4819}, {0x1E921, kMapped, 1, 4820}, {0x1E922, kValid, 0, 0}, {0x1E94C, kDisallowed, 0, 0},
+  {0x1E950, kValid, 0, 0}, {0x1E95A, kDisallowed, 0, 0}, {0x1E95E, kValid, 0, 0}, {0x1E960, kDisallowed, 0, 0},
+  {0x1EC71, kValid, 0, 0}, {0x1ECB5, kDisallowed, 0, 0}, {0x1ED01, kValid, 0, 0}, {0x1ED3E, kDisallowed, 0, 0},
+  {0x1EE00, kMapped, 1, 4405}, {0x1EE01, kMapped, 1, 4406}, {0x1EE02, kMapped, 1, 4410}, {0x1EE03, kMapped, 1, 4413},
+  {0x1EE04, kDisallowed, 0, 0}, {0x1EE05, kMapped, 1, 4432}, {0x1EE06, kMapped, 1, 4416}, {0x1EE07, kMapped, 1, 4411},
+  {0x1EE08, kMapped, 1, 4421}, {0x1EE09, kMapped, 1, 4433}, {0x1EE0A, kMapped, 1, 4427}, {0x1EE0B, kMapped, 1, 4428},
+  {0x1EE0C, kMapped, 1, 4429}, {0x1EE0D, kMapped, 1, 4430}, {0x1EE0E, kMapped, 1, 4417}, {0x1EE0F, kMapped, 1, 4423},
+  {0x1EE10, kMapped, 1, 4425}, {0x1EE11, kMapped, 1, 4419}, {0x1EE12, kMapped, 1, 4426}, {0x1EE13, kMapped, 1, 4415},
+  {0x1EE14, kMapped, 1, 4418}, {0x1EE15, kMapped, 1, 4408}, {0x1EE16, kMapped, 1, 4409}, {0x1EE17, kMapped, 1, 4412},
+  {0x1EE18, kMapped, 1, 4414}, {0x1EE19, kMapped, 1, 4420}, {0x1EE1A, kMapped, 1, 4422}, {0x1EE1B, kMapped, 1, 4424},
+  {0x1EE1C, kMapped, 1, 4821}, {0x1EE1D, kMapped, 1, 3622}, {0x1EE1E, kMapped, 1, 4822}, {0x1EE1F, kMapped, 1, 4823},
+  {0x1EE20, kDisallowed, 0, 0}, {0x1EE21, kMapped, 1, 4406}, {0x1EE22, kMapped, 1, 4410}, {0x1EE23, kDisallowed, 0, 0},
+  {0x1EE24, kMapped, 1, 4431}, {0x1EE25, kDisallowed, 0, 0}, {0x1EE27, kMapped, 1, 4411}, {0x1EE28, kDisallowed, 0, 0},
+  {0x1EE29, kMapped, 1, 4433}, {0x1EE2A, kMapped, 1, 4427}, {0x1EE2B, kMapped, 1, 4428}, {0x1EE2C, kMapped, 1, 4429},
+  {0x1EE2D, kMapped, 1, 4430}, {0x1EE2E, kMapped, 1, 4417}, {0x1EE2F, kMapped, 1, 4423}, {0x1EE30, kMapped, 1, 4425},
+  {0x1EE31, kMapped, 1, 4419}, {0x1EE32, kMapped, 1, 4426}, {0x1EE33, kDisallowed, 0, 0}, {0x1EE34, kMapped, 1, 4418},
+  {0x1EE35, kMapped, 1, 4408}, {0x1EE36, kMapped, 1, 4409}, {0x1EE37, kMapped, 1, 4412}, {0x1EE38, kDisallowed, 0, 0},
+  {0x1EE39, kMapped, 1, 4420}, {0x1EE3A, kDisallowed, 0, 0}, {0x1EE3B, kMapped, 1, 4424}, {0x1EE3C, kDisallowed, 0, 0},
+  {0x1EE42, kMapped, 1, 4410}, {0x1EE43, kDisallowed, 0, 0}, {0x1EE47, kMapped, 1, 4411}, {0x1EE48, kDisallowed, 0, 0},
+  {0x1EE49, kMapped, 1, 4433}, {0x1EE4A, kDisallowed, 0, 0}, {0x1EE4B, kMapped, 1, 4428}, {0x1EE4C, kDisallowed, 0, 0},
+  {0x1EE4D, kMapped, 1, 4430}, {0x1EE4E, kMapped, 1, 4417}, {0x1EE4F, kMapped, 1, 4423}, {0x1EE50, kDisallowed, 0, 0},
+  {0x1EE51, kMapped, 1, 4419}, {0x1EE52, kMapped, 1, 4426}, {0x1EE53, kDisallowed, 0, 0}, {0x1EE54, kMapped, 1, 4418},
+  {0x1EE55, kDisallowed, 0, 0}, {0x1EE57, kMapped, 1, 4412}, {0x1EE58, kDisallowed, 0, 0}, {0x1EE59, kMapped, 1, 4420},
+  {0x1EE5A, kDisallowed, 0, 0}, {0x1EE5B, kMapped, 1, 4424}, {0x1EE5C, kDisallowed, 0, 0}, {0x1EE5D, kMapped, 1, 3622},
+  {0x1EE5E, kDisallowed, 0, 0}, {0x1EE5F, kMapped, 1, 4823}, {0x1EE60, kDisallowed, 0, 0}, {0x1EE61, kMapped, 1, 4406},
+  {0x1EE62, kMapped, 1, 4410}, {0x1EE63, kDisallowed, 0, 0}, {0x1EE64, kMapped, 1, 4431}, {0x1EE65, kDisallowed, 0, 0},
+  {0x1EE67, kMapped, 1, 4411}, {0x1EE68, kMapped, 1, 4421}, {0x1EE69, kMapped, 1, 4433}, {0x1EE6A, kMapped, 1, 4427},
+  {0x1EE6B, kDisallowed, 0, 0}, {0x1EE6C, kMapped, 1, 4429}, {0x1EE6D, kMapped, 1, 4430}, {0x1EE6E, kMapped, 1, 4417},
+  {0x1EE6F, kMapped, 1, 4423}, {0x1EE70, kMapped, 1, 4425}, {0x1EE71, kMapped, 1, 4419}, {0x1EE72, kMapped, 1, 4426},
+  {0x1EE73, kDisallowed, 0, 0}, {0x1EE74, kMapped, 1, 4418}, {0x1EE75, kMapped, 1, 4408}, {0x1EE76, kMapped, 1, 4409},
+  {0x1EE77, kMapped, 1, 4412}, {0x1EE78, kDisallowed, 0, 0}, {0x1EE79, kMapped, 1, 4420}, {0x1EE7A, kMapped, 1, 4422},
+  {0x1EE7B, kMapped, 1, 4424}, {0x1EE7C, kMapped, 1, 4821}, {0x1EE7D, kDisallowed, 0, 0}, {0x1EE7E, kMapped, 1, 4822},
+  {0x1EE7F, kDisallowed, 0, 0}, {0x1EE80, kMapped, 1, 4405}, {0x1EE81, kMapped, 1, 4406}, {0x1EE82, kMapped, 1, 4410},
+  {0x1EE83, kMapped, 1, 4413}, {0x1EE84, kMapped, 1, 4431}, {0x1EE85, kMapped, 1, 4432}, {0x1EE86, kMapped, 1, 4416},
+  {0x1EE87, kMapped, 1, 4411}, {0x1EE88, kMapped, 1, 4421}, {0x1EE89, kMapped, 1, 4433}, {0x1EE8A, kDisallowed, 0, 0},
+  {0x1EE8B, kMapped, 1, 4428}, {0x1EE8C, kMapped, 1, 4429}, {0x1EE8D, kMapped, 1, 4430}, {0x1EE8E, kMapped, 1, 4417},
+  {0x1EE8F, kMapped, 1, 4423}, {0x1EE90, kMapped, 1, 4425}, {0x1EE91, kMapped, 1, 4419}, {0x1EE92, kMapped, 1, 4426},
+  {0x1EE93, kMapped, 1, 4415}, {0x1EE94, kMapped, 1, 4418}, {0x1EE95, kMapped, 1, 4408}, {0x1EE96, kMapped, 1, 4409},
+  {0x1EE97, kMapped, 1, 4412}, {0x1EE98, kMapped, 1, 4414}, {0x1EE99, kMapped, 1, 4420}, {0x1EE9A, kMapped, 1, 4422},
+  {0x1EE9B, kMapped, 1, 4424}, {0x1EE9C, kDisallowed, 0, 0}, {0x1EEA1, kMapped, 1, 4406}, {0x1EEA2, kMapped, 1, 4410},
+  {0x1EEA3, kMapped, 1, 4413}, {0x1EEA4, kDisallowed, 0, 0}, {0x1EEA5, kMapped, 1, 4432}, {0x1EEA6, kMapped, 1, 4416},
+  {0x1EEA7, kMapped, 1, 4411}, {0x1EEA8, kMapped, 1, 4421}, {0x1EEA9, kMapped, 1, 4433}, {0x1EEAA, kDisallowed, 0, 0},
+  {0x1EEAB, kMapped, 1, 4428}, {0x1EEAC, kMapped, 1, 4429}, {0x1EEAD, kMapped, 1, 4430}, {0x1EEAE, kMapped, 1, 4417},
+  {0x1EEAF, kMapped, 1, 4423}, {0x1EEB0, kMapped, 1, 4425}, {0x1EEB1, kMapped, 1, 4419}, {0x1EEB2, kMapped, 1, 4426},
+  {0x1EEB3, kMapped, 1, 4415}, {0x1EEB4, kMapped, 1, 4418}, {0x1EEB5, kMapped, 1, 4408}, {0x1EEB6, kMapped, 1, 4409},
+  {0x1EEB7, kMapped, 1, 4412}, {0x1EEB8, kMapped, 1, 4414}, {0x1EEB9, kMapped, 1, 4420}, {0x1EEBA, kMapped, 1, 4422},
+  {0x1EEBB, kMapped, 1, 4424}, {0x1EEBC, kDisallowed, 0, 0}, {0x1EEF0, kValid, 0, 0}, {0x1EEF2, kDisallowed, 0, 0},
+  {0x1F000, kValid, 0, 0}, {0x1F02C, kDisallowed, 0, 0}, {0x1F030, kValid, 0, 0}, {0x1F094, kDisallowed, 0, 0},
+  {0x1F0A0, kValid, 0, 0}, {0x1F0AF, kDisallowed, 0, 0}, {0x1F0B1, kValid, 0, 0}, {0x1F0C0, kDisallowed, 0, 0},
+  {0x1F0C1, kValid, 0, 0}, {0x1F0D0, kDisallowed, 0, 0}, {0x1F0D1, kValid, 0, 0}, {0x1F0F6, kDisallowed, 0, 0},
+  {0x1F101, kMapped, 2, 4824}, {0x1F102, kMapped, 2, 4826}, {0x1F103, kMapped, 2, 4828}, {0x1F104, kMapped, 2, 4830},
+  {0x1F105, kMapped, 2, 4832}, {0x1F106, kMapped, 2, 4834}, {0x1F107, kMapped, 2, 4836}, {0x1F108, kMapped, 2, 4838},
+  {0x1F109, kMapped, 2, 4840}, {0x1F10A, kMapped, 2, 4842}, {0x1F10B, kValid, 0, 0}, {0x1F110, kMapped, 3, 1249},
+  {0x1F111, kMapped, 3, 1252}, {0x1F112, kMapped, 3, 1255}, {0x1F113, kMapped, 3, 1258}, {0x1F114, kMapped, 3, 1261},
+  {0x1F115, kMapped, 3, 1264}, {0x1F116, kMapped, 3, 1267}, {0x1F117, kMapped, 3, 1270}, {0x1F118, kMapped, 3, 1273},
+  {0x1F119, kMapped, 3, 1276}, {0x1F11A, kMapped, 3, 1279}, {0x1F11B, kMapped, 3, 1282}, {0x1F11C, kMapped, 3, 1285},
+  {0x1F11D, kMapped, 3, 1288}, {0x1F11E, kMapped, 3, 1291}, {0x1F11F, kMapped, 3, 1294}, {0x1F120, kMapped, 3, 1297},
+  {0x1F121, kMapped, 3, 1300}, {0x1F122, kMapped, 3, 1303}, {0x1F123, kMapped, 3, 1306}, {0x1F124, kMapped, 3, 1309},
+  {0x1F125, kMapped, 3, 1312}, {0x1F126, kMapped, 3, 1315}, {0x1F127, kMapped, 3, 1318}, {0x1F128, kMapped, 3, 1321},
+  {0x1F129, kMapped, 3, 1324}, {0x1F12A, kMapped, 3, 4844}, {0x1F12B, kMapped, 1, 2}, {0x1F12C, kMapped, 1, 17},
+  {0x1F12D, kMapped, 2, 2751}, {0x1F12E, kMapped, 2, 4847}, {0x1F12F, kValid, 0, 0}, {0x1F130, kMapped, 1, 0},
+  {0x1F131, kMapped, 1, 1}, {0x1F132, kMapped, 1, 2}, {0x1F133, kMapped, 1, 3}, {0x1F134, kMapped, 1, 4},
+  {0x1F135, kMapped, 1, 5}, {0x1F136, kMapped, 1, 6}, {0x1F137, kMapped, 1, 7}, {0x1F138, kMapped, 1, 8},
+  {0x1F139, kMapped, 1, 9}, {0x1F13A, kMapped, 1, 10}, {0x1F13B, kMapped, 1, 11}, {0x1F13C, kMapped, 1, 12},
+  {0x1F13D, kMapped, 1, 13}, {0x1F13E, kMapped, 1, 14}, {0x1F13F, kMapped, 1, 15}, {0x1F140, kMapped, 1, 16},
+  {0x1F141, kMapped, 1, 17}, {0x1F142, kMapped, 1, 18}, {0x1F143, kMapped, 1, 19}, {0x1F144, kMapped, 1, 20},
+  {0x1F145, kMapped, 1, 21}, {0x1F146, kMapped, 1, 22}, {0x1F147, kMapped, 1, 23}, {0x1F148, kMapped, 1, 24},
+  {0x1F149, kMapped, 1, 25}, {0x1F14A, kMapped, 2, 4849}, {0x1F14B, kMapped, 2, 2729}, {0x1F14C, kMapped, 2, 4851},
+  {0x1F14D, kMapped, 2, 4853}, {0x1F14E, kMapped, 3, 4855}, {0x1F14F, kMapped, 2, 4858}, {0x1F150, kValid, 0, 0},
+  {0x1F16A, kMapped, 2, 4860}, {0x1F16B, kMapped, 2, 4862}, {0x1F16C, kMapped, 2, 4864}, {0x1F16D, kValid, 0, 0},
+  {0x1F190, kMapped, 2, 4866}, {0x1F191, kValid, 0, 0}, {0x1F1AE, kDisallowed, 0, 0}, {0x1F1E6, kValid, 0, 0},
+  {0x1F200, kMapped, 2, 4868}, {0x1F201, kMapped, 2, 4870}, {0x1F202, kMapped, 1, 2152}, {0x1F203, kDisallowed, 0, 0},
+  {0x1F210, kMapped, 1, 1519}, {0x1F211, kMapped, 1, 4872}, {0x1F212, kMapped, 1, 4873}, {0x1F213, kMapped, 1, 4874},
+  {0x1F214, kMapped, 1, 1462}, {0x1F215, kMapped, 1, 4875}, {0x1F216, kMapped, 1, 4876}, {0x1F217, kMapped, 1, 1783},
+  {0x1F218, kMapped, 1, 4877}, {0x1F219, kMapped, 1, 4878}, {0x1F21A, kMapped, 1, 4879}, {0x1F21B, kMapped, 1, 3268},
+  {0x1F21C, kMapped, 1, 4880}, {0x1F21D, kMapped, 1, 4881}, {0x1F21E, kMapped, 1, 4882}, {0x1F21F, kMapped, 1, 4883},
+  {0x1F220, kMapped, 1, 4884}, {0x1F221, kMapped, 1, 4885}, {0x1F222, kMapped, 1, 1555}, {0x1F223, kMapped, 1, 4886},
+  {0x1F224, kMapped, 1, 4887}, {0x1F225, kMapped, 1, 4888}, {0x1F226, kMapped, 1, 4889}, {0x1F227, kMapped, 1, 4890},
+  {0x1F228, kMapped, 1, 4891}, {0x1F229, kMapped, 1, 1456}, {0x1F22A, kMapped, 1, 1775}, {0x1F22B, kMapped, 1, 4892},
+  {0x1F22C, kMapped, 1, 2065}, {0x1F22D, kMapped, 1, 1778}, {0x1F22E, kMapped, 1, 2066}, {0x1F22F, kMapped, 1, 4893},
+  {0x1F230, kMapped, 1, 1611}, {0x1F231, kMapped, 1, 4894}, {0x1F232, kMapped, 1, 4895}, {0x1F233, kMapped, 1, 4896},
+  {0x1F234, kMapped, 1, 4897}, {0x1F235, kMapped, 1, 4898}, {0x1F236, kMapped, 1, 2048}, {0x1F237, kMapped, 1, 1529},
+  {0x1F238, kMapped, 1, 4899}, {0x1F239, kMapped, 1, 4900}, {0x1F23A, kMapped, 1, 4901}, {0x1F23B, kMapped, 1, 4902},
+  {0x1F23C, kDisallowed, 0, 0}, {0x1F240, kMapped, 3, 4903}, {0x1F241, kMapped, 3, 4906}, {0x1F242, kMapped, 3, 4909},
+  {0x1F243, kMapped, 3, 4912}, {0x1F244, kMapped, 3, 4915}, {0x1F245, kMapped, 3, 4918}, {0x1F246, kMapped, 3, 4921},
+  {0x1F247, kMapped, 3, 4924}, {0x1F248, kMapped, 3, 4927}, {0x1F249, kDisallowed, 0, 0}, {0x1F250, kMapped, 1, 4930},
+  {0x1F251, kMapped, 1, 4931}, {0x1F252, kDisallowed, 0, 0}, {0x1F260, kValid, 0, 0}, {0x1F266, kDisallowed, 0, 0},
+  {0x1F300, kValid, 0, 0}, {0x1F6D8, kDisallowed, 0, 0}, {0x1F6DC, kValid, 0, 0}, {0x1F6ED, kDisallowed, 0, 0},
+  {0x1F6F0, kValid, 0, 0}, {0x1F6FD, kDisallowed, 0, 0}, {0x1F700, kValid, 0, 0}, {0x1F777, kDisallowed, 0, 0},
+  {0x1F77B, kValid, 0, 0}, {0x1F7DA, kDisallowed, 0, 0}, {0x1F7E0, kValid, 0, 0}, {0x1F7EC, kDisallowed, 0, 0},
+  {0x1F7F0, kValid, 0, 0}, {0x1F7F1, kDisallowed, 0, 0}, {0x1F800, kValid, 0, 0}, {0x1F80C, kDisallowed, 0, 0},
+  {0x1F810, kValid, 0, 0}, {0x1F848, kDisallowed, 0, 0}, {0x1F850, kValid, 0, 0}, {0x1F85A, kDisallowed, 0, 0},
+  {0x1F860, kValid, 0, 0}, {0x1F888, kDisallowed, 0, 0}, {0x1F890, kValid, 0, 0}, {0x1F8AE, kDisallowed, 0, 0},
+  {0x1F8B0, kValid, 0, 0}, {0x1F8B2, kDisallowed, 0, 0}, {0x1F900, kValid, 0, 0}, {0x1FA54, kDisallowed, 0, 0},
+  {0x1FA60, kValid, 0, 0}, {0x1FA6E, kDisallowed, 0, 0}, {0x1FA70, kValid, 0, 0}, {0x1FA7D, kDisallowed, 0, 0},
+  {0x1FA80, kValid, 0, 0}, {0x1FA89, kDisallowed, 0, 0}, {0x1FA90, kValid, 0, 0}, {0x1FABE, kDisallowed, 0, 0},
+  {0x1FABF, kValid, 0, 0}, {0x1FAC6, kDisallowed, 0, 0}, {0x1FACE, kValid, 0, 0}, {0x1FADC, kDisallowed, 0, 0},
+  {0x1FAE0, kValid, 0, 0}, {0x1FAE9, kDisallowed, 0, 0}, {0x1FAF0, kValid, 0, 0}, {0x1FAF9, kDisallowed, 0, 0},
+  {0x1FB00, kValid, 0, 0}, {0x1FB93, kDisallowed, 0, 0}, {0x1FB94, kValid, 0, 0}, {0x1FBCB, kDisallowed, 0, 0},
+  {0x1FBF0, kMapped, 1, 1023}, {0x1FBF1, kMapped, 1, 38}, {0x1FBF2, kMapped, 1, 31}, {0x1FBF3, kMapped, 1, 32},
+  {0x1FBF4, kMapped, 1, 1024}, {0x1FBF5, kMapped, 1, 1025}, {0x1FBF6, kMapped, 1, 1026}, {0x1FBF7, kMapped, 1, 1027},
+  {0x1FBF8, kMapped, 1, 1028}, {0x1FBF9, kMapped, 1, 1029}, {0x1FBFA, kDisallowed, 0, 0}, {0x20000, kValid, 0, 0},
+  {0x2A6E0, kDisallowed, 0, 0}, {0x2A700, kValid, 0, 0}, {0x2B73A, kDisallowed, 0, 0}, {0x2B740, kValid, 0, 0},
+  {0x2B81E, kDisallowed, 0, 0}, {0x2B820, kValid, 0, 0}, {0x2CEA2, kDisallowed, 0, 0}, {0x2CEB0, kValid, 0, 0},
+  {0x2EBE1, kDisallowed, 0, 0}, {0x2EBF0, kValid, 0, 0}, {0x2EE5E, kDisallowed, 0, 0}, {0x2F800, kMapped, 1, 4932},
+  {0x2F801, kMapped, 1, 4933}, {0x2F802, kMapped, 1, 4934}, {0x2F803, kMapped, 1, 4935}, {0x2F804, kMapped, 1, 4936},
+  {0x2F805, kMapped, 1, 3361}, {0x2F806, kMapped, 1, 4937}, {0x2F807, kMapped, 1, 4938}, {0x2F808, kMapped, 1, 4939},
+  {0x2F809, kMapped, 1, 4940}, {0x2F80A, kMapped, 1, 3362}, {0x2F80B, kMapped, 1, 4941}, {0x2F80C, kMapped, 1, 4942},
+  {0x2F80D, kMapped, 1, 4943}, {0x2F80E, kMapped, 1, 3363}, {0x2F80F, kMapped, 1, 4944}, {0x2F810, kMapped, 1, 4945},
+  {0x2F811, kMapped, 1, 4946}, {0x2F812, kMapped, 1, 4947}, {0x2F813, kMapped, 1, 4948}, {0x2F814, kMapped, 1, 4949},
+  {0x2F815, kMapped, 1, 4882}, {0x2F816, kMapped, 1, 4950}, {0x2F817, kMapped, 1, 4951}, {0x2F818, kMapped, 1, 4952},
+  {0x2F819, kMapped, 1, 4953}, {0x2F81A, kMapped, 1, 4954}, {0x2F81B, kMapped, 1, 3418}, {0x2F81C, kMapped, 1, 4955},
+  {0x2F81D, kMapped, 1, 1472}, {0x2F81E, kMapped, 1, 4956}, {0x2F81F, kMapped, 1, 4957}, {0x2F820, kMapped, 1, 4958},
+  {0x2F821, kMapped, 1, 4959}, {0x2F822, kMapped, 1, 4900}, {0x2F823, kMapped, 1, 4960}, {0x2F824, kMapped, 1, 4961},
+  {0x2F825, kMapped, 1, 3423}, {0x2F826, kMapped, 1, 3364}, {0x2F827, kMapped, 1, 3365}, {0x2F828, kMapped, 1, 3424},
+  {0x2F829, kMapped, 1, 4962}, {0x2F82A, kMapped, 1, 4963}, {0x2F82B, kMapped, 1, 3182}, {0x2F82C, kMapped, 1, 4964},
+  {0x2F82D, kMapped, 1, 3366}, {0x2F82E, kMapped, 1, 4965}, {0x2F82F, kMapped, 1, 4966}, {0x2F830, kMapped, 1, 4967},
+  {0x2F831, kMapped, 1, 4968}, {0x2F834, kMapped, 1, 4969}, {0x2F835, kMapped, 1, 4970}, {0x2F836, kMapped, 1, 4971},
+  {0x2F837, kMapped, 1, 4972}, {0x2F838, kMapped, 1, 4973}, {0x2F839, kMapped, 1, 4974}, {0x2F83A, kMapped, 1, 4975},
+  {0x2F83B, kMapped, 1, 4976}, {0x2F83C, kMapped, 1, 4977}, {0x2F83D, kMapped, 1, 4978}, {0x2F83E, kMapped, 1, 4979},
+  {0x2F83F, kMapped, 1, 4980}, {0x2F840, kMapped, 1, 4981}, {0x2F841, kMapped, 1, 4982}, {0x2F842, kMapped, 1, 4983},
+  {0x2F843, kMapped, 1, 4984}, {0x2F844, kMapped, 1, 4985}, {0x2F845, kMapped, 1, 4986}, {0x2F847, kMapped, 1, 3426},
+  {0x2F848, kMapped, 1, 4987}, {0x2F849, kMapped, 1, 4988}, {0x2F84A, kMapped, 1, 4989}, {0x2F84B, kMapped, 1, 4990},
+  {0x2F84C, kMapped, 1, 3368}, {0x2F84D, kMapped, 1, 4991}, {0x2F84E, kMapped, 1, 4992}, {0x2F84F, kMapped, 1, 4993},
+  {0x2F850, kMapped, 1, 3328}, {0x2F851, kMapped, 1, 4994}, {0x2F852, kMapped, 1, 4995}, {0x2F853, kMapped, 1, 4996},
+  {0x2F854, kMapped, 1, 4997}, {0x2F855, kMapped, 1, 4998}, {0x2F856, kMapped, 1, 4999}, {0x2F857, kMapped, 1, 5000},
+  {0x2F858, kMapped, 1, 5001}, {0x2F859, kMapped, 1, 5002}, {0x2F85A, kMapped, 1, 5003}, {0x2F85B, kMapped, 1, 5004},
+  {0x2F85C, kMapped, 1, 5005}, {0x2F85D, kMapped, 1, 4875}, {0x2F85E, kMapped, 1, 5006}, {0x2F85F, kMapped, 1, 5007},
+  {0x2F860, kMapped, 1, 5008}, {0x2F861, kMapped, 1, 5009}, {0x2F862, kMapped, 1, 5010}, {0x2F863, kMapped, 1, 5011},
+  {0x2F864, kMapped, 1, 5012}, {0x2F865, kMapped, 1, 5013}, {0x2F866, kMapped, 1, 5014}, {0x2F867, kMapped, 1, 5015},
+  {0x2F868, kDisallowed, 0, 0}, {0x2F869, kMapped, 1, 5016}, {0x2F86A, kMapped, 1, 5017}, {0x2F86C, kMapped, 1, 5018},
+  {0x2F86D, kMapped, 1, 5019}, {0x2F86E, kMapped, 1, 5020}, {0x2F86F, kMapped, 1, 3178}, {0x2F870, kMapped, 1, 5021},
+  {0x2F871, kMapped, 1, 5022}, {0x2F872, kMapped, 1, 5023}, {0x2F873, kMapped, 1, 5024}, {0x2F874, kDisallowed, 0, 0},
+  {0x2F875, kMapped, 1, 1498}, {0x2F876, kMapped, 1, 5025}, {0x2F877, kMapped, 1, 5026}, {0x2F878, kMapped, 1, 1500},
+  {0x2F879, kMapped, 1, 5027}, {0x2F87A, kMapped, 1, 5028}, {0x2F87B, kMapped, 1, 5029}, {0x2F87C, kMapped, 1, 5030},
+  {0x2F87D, kMapped, 1, 5031}, {0x2F87E, kMapped, 1, 5032}, {0x2F87F, kMapped, 1, 5033}, {0x2F880, kMapped, 1, 5034},
+  {0x2F881, kMapped, 1, 5035}, {0x2F882, kMapped, 1, 5036}, {0x2F883, kMapped, 1, 5037}, {0x2F884, kMapped, 1, 5038},
+  {0x2F885, kMapped, 1, 5039}, {0x2F886, kMapped, 1, 5040}, {0x2F887, kMapped, 1, 5041}, {0x2F888, kMapped, 1, 5042},
+  {0x2F889, kMapped, 1, 5043}, {0x2F88A, kMapped, 1, 5044}, {0x2F88B, kMapped, 1, 5045}, {0x2F88C, kMapped, 1, 5046},
+  {0x2F88D, kMapped, 1, 5047}, {0x2F88E, kMapped, 1, 3126}, {0x2F88F, kMapped, 1, 5048}, {0x2F890, kMapped, 1, 1510},
+  {0x2F891, kMapped, 1, 5049}, {0x2F893, kMapped, 1, 5050}, {0x2F894, kMapped, 1, 5051}, {0x2F896, kMapped, 1, 5052},
+  {0x2F897, kMapped, 1, 5053}, {0x2F898, kMapped, 1, 5054}, {0x2F899, kMapped, 1, 5055}, {0x2F89A, kMapped, 1, 5056},
+  {0x2F89B, kMapped, 1, 5057}, {0x2F89C, kMapped, 1, 5058}, {0x2F89D, kMapped, 1, 5059}, {0x2F89E, kMapped, 1, 5060},
+  {0x2F89F, kMapped, 1, 5061}, {0x2F8A0, kMapped, 1, 5062}, {0x2F8A1, kMapped, 1, 5063}, {0x2F8A2, kMapped, 1, 5064},
+  {0x2F8A3, kMapped, 1, 3373}, {0x2F8A4, kMapped, 1, 5065}, {0x2F8A5, kMapped, 1, 5066}, {0x2F8A6, kMapped, 1, 5067},
+  {0x2F8A7, kMapped, 1, 5068}, {0x2F8A8, kMapped, 1, 3438}, {0x2F8A9, kMapped, 1, 5068}, {0x2F8AA, kMapped, 1, 5069},
+  {0x2F8AB, kMapped, 1, 3375}, {0x2F8AC, kMapped, 1, 5070}, {0x2F8AD, kMapped, 1, 5071}, {0x2F8AE, kMapped, 1, 5072},
+  {0x2F8AF, kMapped, 1, 5073}, {0x2F8B0, kMapped, 1, 3376}, {0x2F8B1, kMapped, 1, 3099}, {0x2F8B2, kMapped, 1, 5074},
+  {0x2F8B3, kMapped, 1, 5075}, {0x2F8B4, kMapped, 1, 5076}, {0x2F8B5, kMapped, 1, 5077}, {0x2F8B6, kMapped, 1, 5078},
+  {0x2F8B7, kMapped, 1, 5079}, {0x2F8B8, kMapped, 1, 5080}, {0x2F8B9, kMapped, 1, 5081}, {0x2F8BA, kMapped, 1, 5082},
+  {0x2F8BB, kMapped, 1, 5083}, {0x2F8BC, kMapped, 1, 5084}, {0x2F8BD, kMapped, 1, 5085}, {0x2F8BE, kMapped, 1, 5086},
+  {0x2F8BF, kMapped, 1, 5087}, {0x2F8C0, kMapped, 1, 5088}, {0x2F8C1, kMapped, 1, 5089}, {0x2F8C2, kMapped, 1, 5090},
+  {0x2F8C3, kMapped, 1, 5091}, {0x2F8C4, kMapped, 1, 5092}, {0x2F8C5, kMapped, 1, 5093}, {0x2F8C6, kMapped, 1, 5094},
+  {0x2F8C7, kMapped, 1, 5095}, {0x2F8C8, kMapped, 1, 3377}, {0x2F8C9, kMapped, 1, 5096}, {0x2F8CA, kMapped, 1, 5097},
+  {0x2F8CB, kMapped, 1, 5098}, {0x2F8CC, kMapped, 1, 5099}, {0x2F8CD, kMapped, 1, 5100}, {0x2F8CE, kMapped, 1, 5101},
+  {0x2F8CF, kMapped, 1, 3379}, {0x2F8D0, kMapped, 1, 5102}, {0x2F8D1, kMapped, 1, 5103}, {0x2F8D2, kMapped, 1, 5104},
+  {0x2F8D3, kMapped, 1, 5105}, {0x2F8D4, kMapped, 1, 5106}, {0x2F8D5, kMapped, 1, 5107}, {0x2F8D6, kMapped, 1, 5108},
+  {0x2F8D7, kMapped, 1, 5109}, {0x2F8D8, kMapped, 1, 3127}, {0x2F8D9, kMapped, 1, 3446}, {0x2F8DA, kMapped, 1, 5110},
+  {0x2F8DB, kMapped, 1, 5111}, {0x2F8DC, kMapped, 1, 5112}, {0x2F8DD, kMapped, 1, 5113}, {0x2F8DE, kMapped, 1, 5114},
+  {0x2F8DF, kMapped, 1, 5115}, {0x2F8E0, kMapped, 1, 5116}, {0x2F8E1, kMapped, 1, 5117}, {0x2F8E2, kMapped, 1, 3380},
+  {0x2F8E3, kMapped, 1, 5118}, {0x2F8E4, kMapped, 1, 5119}, {0x2F8E5, kMapped, 1, 5120}, {0x2F8E6, kMapped, 1, 5121},
+  {0x2F8E7, kMapped, 1, 3488}, {0x2F8E8, kMapped, 1, 5122}, {0x2F8E9, kMapped, 1, 5123}, {0x2F8EA, kMapped, 1, 5124},
+  {0x2F8EB, kMapped, 1, 5125}, {0x2F8EC, kMapped, 1, 5126}, {0x2F8ED, kMapped, 1, 5127}, {0x2F8EE, kMapped, 1, 5128},
+  {0x2F8EF, kMapped, 1, 5129}, {0x2F8F0, kMapped, 1, 5130}, {0x2F8F1, kMapped, 1, 5131}, {0x2F8F2, kMapped, 1, 5132},
+  {0x2F8F3, kMapped, 1, 5133}, {0x2F8F4, kMapped, 1, 5134}, {0x2F8F5, kMapped, 1, 3195}, {0x2F8F6, kMapped, 1, 5135},
+  {0x2F8F7, kMapped, 1, 5136}, {0x2F8F8, kMapped, 1, 5137}, {0x2F8F9, kMapped, 1, 5138}, {0x2F8FA, kMapped, 1, 5139},
+  {0x2F8FB, kMapped, 1, 5140}, {0x2F8FC, kMapped, 1, 5141}, {0x2F8FD, kMapped, 1, 5142}, {0x2F8FE, kMapped, 1, 5143},
+  {0x2F8FF, kMapped, 1, 5144}, {0x2F900, kMapped, 1, 5145}, {0x2F901, kMapped, 1, 3381}, {0x2F902, kMapped, 1, 3278},
+  {0x2F903, kMapped, 1, 5146}, {0x2F904, kMapped, 1, 5147}, {0x2F905, kMapped, 1, 5148}, {0x2F906, kMapped, 1, 5149},
+  {0x2F907, kMapped, 1, 5150}, {0x2F908, kMapped, 1, 5151}, {0x2F909, kMapped, 1, 5152}, {0x2F90A, kMapped, 1, 5153},
+  {0x2F90B, kMapped, 1, 3449}, {0x2F90C, kMapped, 1, 5154}, {0x2F90D, kMapped, 1, 5155}, {0x2F90E, kMapped, 1, 5156},
+  {0x2F90F, kMapped, 1, 5157}, {0x2F910, kMapped, 1, 5158}, {0x2F911, kMapped, 1, 5159}, {0x2F912, kMapped, 1, 5160},
+  {0x2F913, kMapped, 1, 5161}, {0x2F914, kMapped, 1, 3450}, {0x2F915, kMapped, 1, 5162}, {0x2F916, kMapped, 1, 5163},
+  {0x2F917, kMapped, 1, 5164}, {0x2F918, kMapped, 1, 5165}, {0x2F919, kMapped, 1, 5166}, {0x2F91A, kMapped, 1, 5167},
+  {0x2F91B, kMapped, 1, 5168}, {0x2F91C, kMapped, 1, 5169}, {0x2F91D, kMapped, 1, 5170}, {0x2F91E, kMapped, 1, 5171},
+  {0x2F91F, kDisallowed, 0, 0}, {0x2F920, kMapped, 1, 5172}, {0x2F921, kMapped, 1, 3452}, {0x2F922, kMapped, 1, 5173},
+  {0x2F923, kMapped, 1, 5174}, {0x2F924, kMapped, 1, 5175}, {0x2F925, kMapped, 1, 5176}, {0x2F926, kMapped, 1, 5177},
+  {0x2F927, kMapped, 1, 5178}, {0x2F928, kMapped, 1, 5179}, {0x2F929, kMapped, 1, 5180}, {0x2F92A, kMapped, 1, 5181},
+  {0x2F92B, kMapped, 1, 5182}, {0x2F92C, kMapped, 1, 5183}, {0x2F92E, kMapped, 1, 5184}, {0x2F92F, kMapped, 1, 5185},
+  {0x2F930, kMapped, 1, 3454}, {0x2F931, kMapped, 1, 5186}, {0x2F932, kMapped, 1, 5187}, {0x2F933, kMapped, 1, 5188},
+  {0x2F934, kMapped, 1, 5189}, {0x2F935, kMapped, 1, 5190}, {0x2F936, kMapped, 1, 5191}, {0x2F937, kMapped, 1, 5192},
+  {0x2F938, kMapped, 1, 3181}, {0x2F939, kMapped, 1, 5193}, {0x2F93A, kMapped, 1, 5194}, {0x2F93B, kMapped, 1, 5195},
+  {0x2F93C, kMapped, 1, 5196}, {0x2F93D, kMapped, 1, 5197}, {0x2F93E, kMapped, 1, 5198}, {0x2F93F, kMapped, 1, 5199},
+  {0x2F940, kMapped, 1, 3460}, {0x2F941, kMapped, 1, 5200}, {0x2F942, kMapped, 1, 5201}, {0x2F943, kMapped, 1, 5202},
+  {0x2F944, kMapped, 1, 5203}, {0x2F945, kMapped, 1, 5204}, {0x2F946, kMapped, 1, 5205}, {0x2F948, kMapped, 1, 3461},
+  {0x2F949, kMapped, 1, 3490}, {0x2F94A, kMapped, 1, 5206}, {0x2F94B, kMapped, 1, 5207}, {0x2F94C, kMapped, 1, 5208},
+  {0x2F94D, kMapped, 1, 5209}, {0x2F94E, kMapped, 1, 5210}, {0x2F94F, kMapped, 1, 3144}, {0x2F950, kMapped, 1, 3463},
+  {0x2F951, kMapped, 1, 5211}, {0x2F952, kMapped, 1, 5212}, {0x2F953, kMapped, 1, 3391}, {0x2F954, kMapped, 1, 5213},
+  {0x2F955, kMapped, 1, 5214}, {0x2F956, kMapped, 1, 3348}, {0x2F957, kMapped, 1, 5215}, {0x2F958, kMapped, 1, 5216},
+  {0x2F959, kMapped, 1, 3394}, {0x2F95A, kMapped, 1, 5217}, {0x2F95B, kMapped, 1, 5218}, {0x2F95C, kMapped, 1, 5219},
+  {0x2F95D, kMapped, 1, 5220}, {0x2F95F, kDisallowed, 0, 0}, {0x2F960, kMapped, 1, 5221}, {0x2F961, kMapped, 1, 5222},
+  {0x2F962, kMapped, 1, 5223}, {0x2F963, kMapped, 1, 5224}, {0x2F964, kMapped, 1, 5225}, {0x2F965, kMapped, 1, 5226},
+  {0x2F966, kMapped, 1, 5227}, {0x2F967, kMapped, 1, 5228}, {0x2F968, kMapped, 1, 5229}, {0x2F969, kMapped, 1, 5230},
+  {0x2F96A, kMapped, 1, 5231}, {0x2F96B, kMapped, 1, 5232}, {0x2F96C, kMapped, 1, 5233}, {0x2F96D, kMapped, 1, 5234},
+  {0x2F96E, kMapped, 1, 5235}, {0x2F96F, kMapped, 1, 5236}, {0x2F970, kMapped, 1, 5237}, {0x2F971, kMapped, 1, 5238},
+  {0x2F972, kMapped, 1, 5239}, {0x2F973, kMapped, 1, 5240}, {0x2F974, kMapped, 1, 5241}, {0x2F975, kMapped, 1, 5242},
+  {0x2F976, kMapped, 1, 5243}, {0x2F977, kMapped, 1, 5244}, {0x2F978, kMapped, 1, 5245}, {0x2F979, kMapped, 1, 5246},
+  {0x2F97A, kMapped, 1, 3400}, {0x2F97B, kMapped, 1, 5247}, {0x2F97C, kMapped, 1, 5248}, {0x2F97D, kMapped, 1, 5249},
+  {0x2F97E, kMapped, 1, 5250}, {0x2F97F, kMapped, 1, 5251}, {0x2F980, kMapped, 1, 5252}, {0x2F981, kMapped, 1, 5253},
+  {0x2F982, kMapped, 1, 5254}, {0x2F983, kMapped, 1, 5255}, {0x2F984, kMapped, 1, 5256}, {0x2F985, kMapped, 1, 5257},
+  {0x2F986, kMapped, 1, 5258}, {0x2F987, kMapped, 1, 5259}, {0x2F988, kMapped, 1, 5260}, {0x2F989, kMapped, 1, 5261},
+  {0x2F98A, kMapped, 1, 5262}, {0x2F98B, kMapped, 1, 5050}, {0x2F98C, kMapped, 1, 5263}, {0x2F98D, kMapped, 1, 5264},
+  {0x2F98E, kMapped, 1, 5265}, {0x2F98F, kMapped, 1, 5266}, {0x2F990, kMapped, 1, 5267}, {0x2F991, kMapped, 1, 5268},
+  {0x2F992, kMapped, 1, 5269}, {0x2F993, kMapped, 1, 5270}, {0x2F994, kMapped, 1, 5271}, {0x2F995, kMapped, 1, 5272},
+  {0x2F996, kMapped, 1, 5273}, {0x2F997, kMapped, 1, 5274}, {0x2F998, kMapped, 1, 3198}, {0x2F999, kMapped, 1, 5275},
+  {0x2F99A, kMapped, 1, 5276}, {0x2F99B, kMapped, 1, 5277}, {0x2F99C, kMapped, 1, 5278}, {0x2F99D, kMapped, 1, 5279},
+  {0x2F99E, kMapped, 1, 5280}, {0x2F99F, kMapped, 1, 3403}, {0x2F9A0, kMapped, 1, 5281}, {0x2F9A1, kMapped, 1, 5282},
+  {0x2F9A2, kMapped, 1, 5283}, {0x2F9A3, kMapped, 1, 5284}, {0x2F9A4, kMapped, 1, 5285}, {0x2F9A5, kMapped, 1, 5286},
+  {0x2F9A6, kMapped, 1, 5287}, {0x2F9A7, kMapped, 1, 5288}, {0x2F9A8, kMapped, 1, 5289}, {0x2F9A9, kMapped, 1, 5290},
+  {0x2F9AA, kMapped, 1, 5291}, {0x2F9AB, kMapped, 1, 5292}, {0x2F9AC, kMapped, 1, 5293}, {0x2F9AD, kMapped, 1, 5294},
+  {0x2F9AE, kMapped, 1, 5295}, {0x2F9AF, kMapped, 1, 5296}, {0x2F9B0, kMapped, 1, 5297}, {0x2F9B1, kMapped, 1, 5298},
+  {0x2F9B2, kMapped, 1, 5299}, {0x2F9B3, kMapped, 1, 5300}, {0x2F9B4, kMapped, 1, 3139}, {0x2F9B5, kMapped, 1, 5301},
+  {0x2F9B6, kMapped, 1, 5302}, {0x2F9B7, kMapped, 1, 5303}, {0x2F9B8, kMapped, 1, 5304}, {0x2F9B9, kMapped, 1, 5305},
+  {0x2F9BA, kMapped, 1, 5306}, {0x2F9BB, kMapped, 1, 3470}, {0x2F9BC, kMapped, 1, 5307}, {0x2F9BD, kMapped, 1, 5308},
+  {0x2F9BE, kMapped, 1, 5309}, {0x2F9BF, kDisallowed, 0, 0}, {0x2F9C0, kMapped, 1, 5310}, {0x2F9C1, kMapped, 1, 5311},
+  {0x2F9C2, kMapped, 1, 5312}, {0x2F9C3, kMapped, 1, 5313}, {0x2F9C4, kMapped, 1, 1600}, {0x2F9C5, kMapped, 1, 5314},
+  {0x2F9C6, kMapped, 1, 5315}, {0x2F9C7, kMapped, 1, 5316}, {0x2F9C8, kMapped, 1, 5317}, {0x2F9C9, kMapped, 1, 5318},
+  {0x2F9CA, kMapped, 1, 5319}, {0x2F9CB, kMapped, 1, 5320}, {0x2F9CC, kMapped, 1, 5321}, {0x2F9CD, kMapped, 1, 5322},
+  {0x2F9CE, kMapped, 1, 5323}, {0x2F9CF, kMapped, 1, 5324}, {0x2F9D0, kMapped, 1, 3475}, {0x2F9D1, kMapped, 1, 3476},
+  {0x2F9D2, kMapped, 1, 1607}, {0x2F9D3, kMapped, 1, 5325}, {0x2F9D4, kMapped, 1, 5326}, {0x2F9D5, kMapped, 1, 5327},
+  {0x2F9D6, kMapped, 1, 5328}, {0x2F9D7, kMapped, 1, 5329}, {0x2F9D8, kMapped, 1, 5330}, {0x2F9D9, kMapped, 1, 5331},
+  {0x2F9DA, kMapped, 1, 5332}, {0x2F9DB, kMapped, 1, 5333}, {0x2F9DC, kMapped, 1, 5334}, {0x2F9DD, kMapped, 1, 5335},
+  {0x2F9DE, kMapped, 1, 5336}, {0x2F9DF, kMapped, 1, 3477}, {0x2F9E0, kMapped, 1, 5337}, {0x2F9E1, kMapped, 1, 5338},
+  {0x2F9E2, kMapped, 1, 5339}, {0x2F9E3, kMapped, 1, 5340}, {0x2F9E4, kMapped, 1, 5341}, {0x2F9E5, kMapped, 1, 5342},
+  {0x2F9E6, kMapped, 1, 5343}, {0x2F9E7, kMapped, 1, 5344}, {0x2F9E8, kMapped, 1, 5345}, {0x2F9E9, kMapped, 1, 5346},
+  {0x2F9EA, kMapped, 1, 5347}, {0x2F9EB, kMapped, 1, 5348}, {0x2F9EC, kMapped, 1, 5349}, {0x2F9ED, kMapped, 1, 5350},
+  {0x2F9EE, kMapped, 1, 5351}, {0x2F9EF, kMapped, 1, 5352}, {0x2F9F0, kMapped, 1, 5353}, {0x2F9F1, kMapped, 1, 5354},
+  {0x2F9F2, kMapped, 1, 5355}, {0x2F9F3, kMapped, 1, 5356}, {0x2F9F4, kMapped, 1, 5357}, {0x2F9F5, kMapped, 1, 5358},
+  {0x2F9F6, kMapped, 1, 5359}, {0x2F9F7, kMapped, 1, 5360}, {0x2F9F8, kMapped, 1, 5361}, {0x2F9F9, kMapped, 1, 5362},
+  {0x2F9FA, kMapped, 1, 5363}, {0x2F9FB, kMapped, 1, 5364}, {0x2F9FC, kMapped, 1, 5365}, {0x2F9FD, kMapped, 1, 5366},
+  {0x2F9FE, kMapped, 1, 3483}, {0x2FA00, kMapped, 1, 5367}, {0x2FA01, kMapped, 1, 5368}, {0x2FA02, kMapped, 1, 5369},
+  {0x2FA03, kMapped, 1, 5370}, {0x2FA04, kMapped, 1, 5371}, {0x2FA05, kMapped, 1, 5372}, {0x2FA06, kMapped, 1, 5373},
+  {0x2FA07, kMapped, 1, 5374}, {0x2FA08, kMapped, 1, 5375}, {0x2FA09, kMapped, 1, 5376}, {0x2FA0A, kMapped, 1, 3484},
+  {0x2FA0B, kMapped, 1, 5377}, {0x2FA0C, kMapped, 1, 5378}, {0x2FA0D, kMapped, 1, 5379}, {0x2FA0E, kMapped, 1, 5380},
+  {0x2FA0F, kMapped, 1, 5381}, {0x2FA10, kMapped, 1, 5382}, {0x2FA11, kMapped, 1, 5383}, {0x2FA12, kMapped, 1, 5384},
+  {0x2FA13, kMapped, 1, 5385}, {0x2FA14, kMapped, 1, 5386}, {0x2FA15, kMapped, 1, 1655}, {0x2FA16, kMapped, 1, 5387},
+  {0x2FA17, kMapped, 1, 1659}, {0x2FA18, kMapped, 1, 5388}, {0x2FA19, kMapped, 1, 5389}, {0x2FA1A, kMapped, 1, 5390},
+  {0x2FA1B, kMapped, 1, 5391}, {0x2FA1C, kMapped, 1, 1664}, {0x2FA1D, kMapped, 1, 5392}, {0x2FA1E, kDisallowed, 0, 0},
+  {0x30000, kValid, 0, 0}, {0x3134B, kDisallowed, 0, 0}, {0x31350, kValid, 0, 0}, {0x323B0, kDisallowed, 0, 0},
+  {0xE0100, kMapped, 0, 0}, {0xE01F0, kDisallowed, 0, 0},
+};
+
+static const char32_t kIDNAMappingData[] = {
+  0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
+  0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x20, 0x20, 0x308, 0x20, 0x304, 0x32, 0x33, 0x20, 0x301, 0x3BC, 0x20,
+  0x327, 0x31, 0x31, 0x2044, 0x34, 0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6,
+  0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF8, 0xF9, 0xFA,
+  0xFB, 0xFC, 0xFD, 0xFE, 0x101, 0x103, 0x105, 0x107, 0x109, 0x10B, 0x10D, 0x10F, 0x111, 0x113, 0x115, 0x117, 0x119,
+  0x11B, 0x11D, 0x11F, 0x121, 0x123, 0x125, 0x127, 0x129, 0x12B, 0x12D, 0x12F, 0x69, 0x307, 0x69, 0x6A, 0x135, 0x137,
+  0x13A, 0x13C, 0x13E, 0x6C, 0xB7, 0x142, 0x144, 0x146, 0x148, 0x2BC, 0x6E, 0x14B, 0x14D, 0x14F, 0x151, 0x153, 0x155,
+  0x157, 0x159, 0x15B, 0x15D, 0x15F, 0x161, 0x163, 0x165, 0x167, 0x169, 0x16B, 0x16D, 0x16F, 0x171, 0x173, 0x175,
+  0x177, 0xFF, 0x17A, 0x17C, 0x17E, 0x253, 0x183, 0x185, 0x254, 0x188, 0x256, 0x257, 0x18C, 0x1DD, 0x259, 0x25B, 0x192,
+  0x260, 0x263, 0x269, 0x268, 0x199, 0x26F, 0x272, 0x275, 0x1A1, 0x1A3, 0x1A5, 0x280, 0x1A8, 0x283, 0x1AD, 0x288,
+  0x1B0, 0x28A, 0x28B, 0x1B4, 0x1B6, 0x292, 0x1B9, 0x1BD, 0x64, 0x17E, 0x6C, 0x6A, 0x6E, 0x6A, 0x1CE, 0x1D0, 0x1D2,
+  0x1D4, 0x1D6, 0x1D8, 0x1DA, 0x1DC, 0x1DF, 0x1E1, 0x1E3, 0x1E5, 0x1E7, 0x1E9, 0x1EB, 0x1ED, 0x1EF, 0x64, 0x7A, 0x1F5,
+  0x195, 0x1BF, 0x1F9, 0x1FB, 0x1FD, 0x1FF, 0x201, 0x203, 0x205, 0x207, 0x209, 0x20B, 0x20D, 0x20F, 0x211, 0x213,
+  0x215, 0x217, 0x219, 0x21B, 0x21D, 0x21F, 0x19E, 0x223, 0x225, 0x227, 0x229, 0x22B, 0x22D, 0x22F, 0x231, 0x233,
+  0x2C65, 0x23C, 0x19A, 0x2C66, 0x242, 0x180, 0x289, 0x28C, 0x247, 0x249, 0x24B, 0x24D, 0x24F, 0x266, 0x279, 0x27B,
+  0x281, 0x20, 0x306, 0x20, 0x307, 0x20, 0x30A, 0x20, 0x328, 0x20, 0x303, 0x20, 0x30B, 0x295, 0x300, 0x301, 0x313,
+  0x308, 0x301, 0x3B9, 0x371, 0x373, 0x2B9, 0x377, 0x20, 0x3B9, 0x3B, 0x3F3, 0x20, 0x308, 0x301, 0x3AC, 0xB7, 0x3AD,
+  0x3AE, 0x3AF, 0x3CC, 0x3CD, 0x3CE, 0x3B1, 0x3B2, 0x3B3, 0x3B4, 0x3B5, 0x3B6, 0x3B7, 0x3B8, 0x3BA, 0x3BB, 0x3BD,
+  0x3BE, 0x3BF, 0x3C0, 0x3C1, 0x3C3, 0x3C4, 0x3C5, 0x3C6, 0x3C7, 0x3C8, 0x3C9, 0x3CA, 0x3CB, 0x3D7, 0x3D9, 0x3DB,
+  0x3DD, 0x3DF, 0x3E1, 0x3E3, 0x3E5, 0x3E7, 0x3E9, 0x3EB, 0x3ED, 0x3EF, 0x3F8, 0x3FB, 0x37B, 0x37C, 0x37D, 0x450,
+  0x451, 0x452, 0x453, 0x454, 0x455, 0x456, 0x457, 0x458, 0x459, 0x45A, 0x45B, 0x45C, 0x45D, 0x45E, 0x45F, 0x430,
+  0x431, 0x432, 0x433, 0x434, 0x435, 0x436, 0x437, 0x438, 0x439, 0x43A, 0x43B, 0x43C, 0x43D, 0x43E, 0x43F, 0x440,
+  0x441, 0x442, 0x443, 0x444, 0x445, 0x446, 0x447, 0x448, 0x449, 0x44A, 0x44B, 0x44C, 0x44D, 0x44E, 0x44F, 0x461,
+  0x463, 0x465, 0x467, 0x469, 0x46B, 0x46D, 0x46F, 0x471, 0x473, 0x475, 0x477, 0x479, 0x47B, 0x47D, 0x47F, 0x481,
+  0x48B, 0x48D, 0x48F, 0x491, 0x493, 0x495, 0x497, 0x499, 0x49B, 0x49D, 0x49F, 0x4A1, 0x4A3, 0x4A5, 0x4A7, 0x4A9,
+  0x4AB, 0x4AD, 0x4AF, 0x4B1, 0x4B3, 0x4B5, 0x4B7, 0x4B9, 0x4BB, 0x4BD, 0x4BF, 0x4C2, 0x4C4, 0x4C6, 0x4C8, 0x4CA,
+  0x4CC, 0x4CE, 0x4D1, 0x4D3, 0x4D5, 0x4D7, 0x4D9, 0x4DB, 0x4DD, 0x4DF, 0x4E1, 0x4E3, 0x4E5, 0x4E7, 0x4E9, 0x4EB,
+  0x4ED, 0x4EF, 0x4F1, 0x4F3, 0x4F5, 0x4F7, 0x4F9, 0x4FB, 0x4FD, 0x4FF, 0x501, 0x503, 0x505, 0x507, 0x509, 0x50B,
+  0x50D, 0x50F, 0x511, 0x513, 0x515, 0x517, 0x519, 0x51B, 0x51D, 0x51F, 0x521, 0x523, 0x525, 0x527, 0x529, 0x52B,
+  0x52D, 0x52F, 0x561, 0x562, 0x563, 0x564, 0x565, 0x566, 0x567, 0x568, 0x569, 0x56A, 0x56B, 0x56C, 0x56D, 0x56E,
+  0x56F, 0x570, 0x571, 0x572, 0x573, 0x574, 0x575, 0x576, 0x577, 0x578, 0x579, 0x57A, 0x57B, 0x57C, 0x57D, 0x57E,
+  0x57F, 0x580, 0x581, 0x582, 0x583, 0x584, 0x585, 0x586, 0x565, 0x582, 0x627, 0x674, 0x648, 0x674, 0x6C7, 0x674,
+  0x64A, 0x674, 0x915, 0x93C, 0x916, 0x93C, 0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C, 0x92B, 0x93C,
+  0x92F, 0x93C, 0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C,
+  0xA1C, 0xA3C, 0xA2B, 0xA3C, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xE4D, 0xE32, 0xECD, 0xEB2, 0xEAB, 0xE99, 0xEAB, 0xEA1,
+  0xF0B, 0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7, 0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71,
+  0xF74, 0xFB2, 0xF80, 0xFB2, 0xF71, 0xF80, 0xFB3, 0xF80, 0xFB3, 0xF71, 0xF80, 0xF71, 0xF80, 0xF92, 0xFB7, 0xF9C,
+  0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7, 0xF90, 0xFB5, 0x2D27, 0x2D2D, 0x10DC, 0x13F0, 0x13F1, 0x13F2,
+  0x13F3, 0x13F4, 0x13F5, 0xA64B, 0x10D0, 0x10D1, 0x10D2, 0x10D3, 0x10D4, 0x10D5, 0x10D6, 0x10D7, 0x10D8, 0x10D9,
+  0x10DA, 0x10DB, 0x10DD, 0x10DE, 0x10DF, 0x10E0, 0x10E1, 0x10E2, 0x10E3, 0x10E4, 0x10E5, 0x10E6, 0x10E7, 0x10E8,
+  0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED, 0x10EE, 0x10EF, 0x10F0, 0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6,
+  0x10F7, 0x10F8, 0x10F9, 0x10FA, 0x10FD, 0x10FE, 0x10FF, 0x250, 0x251, 0x1D02, 0x25C, 0x1D16, 0x1D17, 0x1D1D, 0x1D25,
+  0x252, 0x255, 0x25F, 0x261, 0x265, 0x26A, 0x1D7B, 0x29D, 0x26D, 0x1D85, 0x29F, 0x271, 0x270, 0x273, 0x274, 0x278,
+  0x282, 0x1AB, 0x1D1C, 0x290, 0x291, 0x1E01, 0x1E03, 0x1E05, 0x1E07, 0x1E09, 0x1E0B, 0x1E0D, 0x1E0F, 0x1E11, 0x1E13,
+  0x1E15, 0x1E17, 0x1E19, 0x1E1B, 0x1E1D, 0x1E1F, 0x1E21, 0x1E23, 0x1E25, 0x1E27, 0x1E29, 0x1E2B, 0x1E2D, 0x1E2F,
+  0x1E31, 0x1E33, 0x1E35, 0x1E37, 0x1E39, 0x1E3B, 0x1E3D, 0x1E3F, 0x1E41, 0x1E43, 0x1E45, 0x1E47, 0x1E49, 0x1E4B,
+  0x1E4D, 0x1E4F, 0x1E51, 0x1E53, 0x1E55, 0x1E57, 0x1E59, 0x1E5B, 0x1E5D, 0x1E5F, 0x1E61, 0x1E63, 0x1E65, 0x1E67,
+  0x1E69, 0x1E6B, 0x1E6D, 0x1E6F, 0x1E71, 0x1E73, 0x1E75, 0x1E77, 0x1E79, 0x1E7B, 0x1E7D, 0x1E7F, 0x1E81, 0x1E83,
+  0x1E85, 0x1E87, 0x1E89, 0x1E8B, 0x1E8D, 0x1E8F, 0x1E91, 0x1E93, 0x1E95, 0x61, 0x2BE, 0xDF, 0x1EA1, 0x1EA3, 0x1EA5,
+  0x1EA7, 0x1EA9, 0x1EAB, 0x1EAD, 0x1EAF, 0x1EB1, 0x1EB3, 0x1EB5, 0x1EB7, 0x1EB9, 0x1EBB, 0x1EBD, 0x1EBF, 0x1EC1,
+  0x1EC3, 0x1EC5, 0x1EC7, 0x1EC9, 0x1ECB, 0x1ECD, 0x1ECF, 0x1ED1, 0x1ED3, 0x1ED5, 0x1ED7, 0x1ED9, 0x1EDB, 0x1EDD,
+  0x1EDF, 0x1EE1, 0x1EE3, 0x1EE5, 0x1EE7, 0x1EE9, 0x1EEB, 0x1EED, 0x1EEF, 0x1EF1, 0x1EF3, 0x1EF5, 0x1EF7, 0x1EF9,
+  0x1EFB, 0x1EFD, 0x1EFF, 0x1F00, 0x1F01, 0x1F02, 0x1F03, 0x1F04, 0x1F05, 0x1F06, 0x1F07, 0x1F10, 0x1F11, 0x1F12,
+  0x1F13, 0x1F14, 0x1F15, 0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26, 0x1F27, 0x1F30, 0x1F31, 0x1F32,
+  0x1F33, 0x1F34, 0x1F35, 0x1F36, 0x1F37, 0x1F40, 0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45, 0x1F51, 0x1F53, 0x1F55,
+  0x1F57, 0x1F60, 0x1F61, 0x1F62, 0x1F63, 0x1F64, 0x1F65, 0x1F66, 0x1F67, 0x1F00, 0x3B9, 0x1F01, 0x3B9, 0x1F02, 0x3B9,
+  0x1F03, 0x3B9, 0x1F04, 0x3B9, 0x1F05, 0x3B9, 0x1F06, 0x3B9, 0x1F07, 0x3B9, 0x1F20, 0x3B9, 0x1F21, 0x3B9, 0x1F22,
+  0x3B9, 0x1F23, 0x3B9, 0x1F24, 0x3B9, 0x1F25, 0x3B9, 0x1F26, 0x3B9, 0x1F27, 0x3B9, 0x1F60, 0x3B9, 0x1F61, 0x3B9,
+  0x1F62, 0x3B9, 0x1F63, 0x3B9, 0x1F64, 0x3B9, 0x1F65, 0x3B9, 0x1F66, 0x3B9, 0x1F67, 0x3B9, 0x1F70, 0x3B9, 0x3B1,
+  0x3B9, 0x3AC, 0x3B9, 0x1FB6, 0x3B9, 0x1FB0, 0x1FB1, 0x1F70, 0x20, 0x313, 0x20, 0x342, 0x20, 0x308, 0x342, 0x1F74,
+  0x3B9, 0x3B7, 0x3B9, 0x3AE, 0x3B9, 0x1FC6, 0x3B9, 0x1F72, 0x1F74, 0x20, 0x313, 0x300, 0x20, 0x313, 0x301, 0x20,
+  0x313, 0x342, 0x390, 0x1FD0, 0x1FD1, 0x1F76, 0x20, 0x314, 0x300, 0x20, 0x314, 0x301, 0x20, 0x314, 0x342, 0x3B0,
+  0x1FE0, 0x1FE1, 0x1F7A, 0x1FE5, 0x20, 0x308, 0x300, 0x60, 0x1F7C, 0x3B9, 0x3C9, 0x3B9, 0x3CE, 0x3B9, 0x1FF6, 0x3B9,
+  0x1F78, 0x1F7C, 0x20, 0x314, 0x2010, 0x20, 0x333, 0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035,
+  0x2035, 0x2035, 0x21, 0x21, 0x20, 0x305, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x2032, 0x2032, 0x2032, 0x2032, 0x30,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x2B, 0x2212, 0x3D, 0x28, 0x29, 0x72, 0x73, 0x61, 0x2F, 0x63, 0x61, 0x2F, 0x73,
+  0xB0, 0x63, 0x63, 0x2F, 0x6F, 0x63, 0x2F, 0x75, 0xB0, 0x66, 0x6E, 0x6F, 0x73, 0x6D, 0x74, 0x65, 0x6C, 0x74, 0x6D,
+  0x5D0, 0x5D1, 0x5D2, 0x5D3, 0x66, 0x61, 0x78, 0x2211, 0x31, 0x2044, 0x37, 0x31, 0x2044, 0x39, 0x31, 0x2044, 0x31,
+  0x30, 0x31, 0x2044, 0x33, 0x32, 0x2044, 0x33, 0x31, 0x2044, 0x35, 0x32, 0x2044, 0x35, 0x33, 0x2044, 0x35, 0x34,
+  0x2044, 0x35, 0x31, 0x2044, 0x36, 0x35, 0x2044, 0x36, 0x31, 0x2044, 0x38, 0x33, 0x2044, 0x38, 0x35, 0x2044, 0x38,
+  0x37, 0x2044, 0x38, 0x31, 0x2044, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x76, 0x76, 0x69, 0x76, 0x69, 0x69, 0x76, 0x69,
+  0x69, 0x69, 0x69, 0x78, 0x78, 0x69, 0x78, 0x69, 0x69, 0x30, 0x2044, 0x33, 0x222B, 0x222B, 0x222B, 0x222B, 0x222B,
+  0x222E, 0x222E, 0x222E, 0x222E, 0x222E, 0x3008, 0x3009, 0x31, 0x30, 0x31, 0x31, 0x31, 0x32, 0x31, 0x33, 0x31, 0x34,
+  0x31, 0x35, 0x31, 0x36, 0x31, 0x37, 0x31, 0x38, 0x31, 0x39, 0x32, 0x30, 0x28, 0x31, 0x29, 0x28, 0x32, 0x29, 0x28,
+  0x33, 0x29, 0x28, 0x34, 0x29, 0x28, 0x35, 0x29, 0x28, 0x36, 0x29, 0x28, 0x37, 0x29, 0x28, 0x38, 0x29, 0x28, 0x39,
+  0x29, 0x28, 0x31, 0x30, 0x29, 0x28, 0x31, 0x31, 0x29, 0x28, 0x31, 0x32, 0x29, 0x28, 0x31, 0x33, 0x29, 0x28, 0x31,
+  0x34, 0x29, 0x28, 0x31, 0x35, 0x29, 0x28, 0x31, 0x36, 0x29, 0x28, 0x31, 0x37, 0x29, 0x28, 0x31, 0x38, 0x29, 0x28,
+  0x31, 0x39, 0x29, 0x28, 0x32, 0x30, 0x29, 0x28, 0x61, 0x29, 0x28, 0x62, 0x29, 0x28, 0x63, 0x29, 0x28, 0x64, 0x29,
+  0x28, 0x65, 0x29, 0x28, 0x66, 0x29, 0x28, 0x67, 0x29, 0x28, 0x68, 0x29, 0x28, 0x69, 0x29, 0x28, 0x6A, 0x29, 0x28,
+  0x6B, 0x29, 0x28, 0x6C, 0x29, 0x28, 0x6D, 0x29, 0x28, 0x6E, 0x29, 0x28, 0x6F, 0x29, 0x28, 0x70, 0x29, 0x28, 0x71,
+  0x29, 0x28, 0x72, 0x29, 0x28, 0x73, 0x29, 0x28, 0x74, 0x29, 0x28, 0x75, 0x29, 0x28, 0x76, 0x29, 0x28, 0x77, 0x29,
+  0x28, 0x78, 0x29, 0x28, 0x79, 0x29, 0x28, 0x7A, 0x29, 0x222B, 0x222B, 0x222B, 0x222B, 0x3A, 0x3A, 0x3D, 0x3D, 0x3D,
+  0x3D, 0x3D, 0x3D, 0x2ADD, 0x338, 0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37, 0x2C38, 0x2C39,
+  0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F, 0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46, 0x2C47,
+  0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F, 0x2C50, 0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55,
+  0x2C56, 0x2C57, 0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x2C5F, 0x2C61, 0x26B, 0x1D7D, 0x27D, 0x2C68,
+  0x2C6A, 0x2C6C, 0x2C73, 0x2C76, 0x23F, 0x240, 0x2C81, 0x2C83, 0x2C85, 0x2C87, 0x2C89, 0x2C8B, 0x2C8D, 0x2C8F, 0x2C91,
+  0x2C93, 0x2C95, 0x2C97, 0x2C99, 0x2C9B, 0x2C9D, 0x2C9F, 0x2CA1, 0x2CA3, 0x2CA5, 0x2CA7, 0x2CA9, 0x2CAB, 0x2CAD,
+  0x2CAF, 0x2CB1, 0x2CB3, 0x2CB5, 0x2CB7, 0x2CB9, 0x2CBB, 0x2CBD, 0x2CBF, 0x2CC1, 0x2CC3, 0x2CC5, 0x2CC7, 0x2CC9,
+  0x2CCB, 0x2CCD, 0x2CCF, 0x2CD1, 0x2CD3, 0x2CD5, 0x2CD7, 0x2CD9, 0x2CDB, 0x2CDD, 0x2CDF, 0x2CE1, 0x2CE3, 0x2CEC,
+  0x2CEE, 0x2CF3, 0x2D61, 0x6BCD, 0x9F9F, 0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0, 0x4EBA,
+  0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0, 0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338,
+  0x5341, 0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F, 0x58EB, 0x5902, 0x590A, 0x5915, 0x5927,
+  0x5973, 0x5B50, 0x5B80, 0x5BF8, 0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5, 0x5DF1, 0x5DFE, 0x5E72,
+  0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B, 0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B, 0x652F,
+  0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5, 0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3,
+  0x6BCB, 0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236, 0x723B, 0x723F, 0x7247, 0x7259, 0x725B,
+  0x72AC, 0x7384, 0x7389, 0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592, 0x7676, 0x767D, 0x76AE,
+  0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3, 0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8, 0x7F36,
+  0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033, 0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C,
+  0x821B, 0x821F, 0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C, 0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00,
+  0x8C37, 0x8C46, 0x8C55, 0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B, 0x8FB0, 0x8FB5, 0x9091,
+  0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577, 0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762, 0x9769,
+  0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF, 0x9996, 0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25,
+  0x9B2F, 0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB, 0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD,
+  0x9F0E, 0x9F13, 0x9F20, 0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0x2E, 0x3012, 0x5344, 0x5345, 0x20, 0x3099,
+  0x20, 0x309A, 0x3088, 0x308A, 0x30B3, 0x30C8, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103, 0x1104, 0x1105,
+  0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5, 0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B,
+  0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167,
+  0x1168, 0x1169, 0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175,
+  0x1114, 0x1115, 0x11C7, 0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD, 0x11DF, 0x111D, 0x111E,
+  0x1120, 0x1122, 0x1123, 0x1127, 0x1129, 0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140, 0x1147,
+  0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1,
+  0x4E09, 0x56DB, 0x4E0A, 0x4E2D, 0x4E0B, 0x7532, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x28, 0x1100, 0x29, 0x28, 0x1102,
+  0x29, 0x28, 0x1103, 0x29, 0x28, 0x1105, 0x29, 0x28, 0x1106, 0x29, 0x28, 0x1107, 0x29, 0x28, 0x1109, 0x29, 0x28,
+  0x110B, 0x29, 0x28, 0x110C, 0x29, 0x28, 0x110E, 0x29, 0x28, 0x110F, 0x29, 0x28, 0x1110, 0x29, 0x28, 0x1111, 0x29,
+  0x28, 0x1112, 0x29, 0x28, 0xAC00, 0x29, 0x28, 0xB098, 0x29, 0x28, 0xB2E4, 0x29, 0x28, 0xB77C, 0x29, 0x28, 0xB9C8,
+  0x29, 0x28, 0xBC14, 0x29, 0x28, 0xC0AC, 0x29, 0x28, 0xC544, 0x29, 0x28, 0xC790, 0x29, 0x28, 0xCC28, 0x29, 0x28,
+  0xCE74, 0x29, 0x28, 0xD0C0, 0x29, 0x28, 0xD30C, 0x29, 0x28, 0xD558, 0x29, 0x28, 0xC8FC, 0x29, 0x28, 0xC624, 0xC804,
+  0x29, 0x28, 0xC624, 0xD6C4, 0x29, 0x28, 0x4E00, 0x29, 0x28, 0x4E8C, 0x29, 0x28, 0x4E09, 0x29, 0x28, 0x56DB, 0x29,
+  0x28, 0x4E94, 0x29, 0x28, 0x516D, 0x29, 0x28, 0x4E03, 0x29, 0x28, 0x516B, 0x29, 0x28, 0x4E5D, 0x29, 0x28, 0x5341,
+  0x29, 0x28, 0x6708, 0x29, 0x28, 0x706B, 0x29, 0x28, 0x6C34, 0x29, 0x28, 0x6728, 0x29, 0x28, 0x91D1, 0x29, 0x28,
+  0x571F, 0x29, 0x28, 0x65E5, 0x29, 0x28, 0x682A, 0x29, 0x28, 0x6709, 0x29, 0x28, 0x793E, 0x29, 0x28, 0x540D, 0x29,
+  0x28, 0x7279, 0x29, 0x28, 0x8CA1, 0x29, 0x28, 0x795D, 0x29, 0x28, 0x52B4, 0x29, 0x28, 0x4EE3, 0x29, 0x28, 0x547C,
+  0x29, 0x28, 0x5B66, 0x29, 0x28, 0x76E3, 0x29, 0x28, 0x4F01, 0x29, 0x28, 0x8CC7, 0x29, 0x28, 0x5354, 0x29, 0x28,
+  0x796D, 0x29, 0x28, 0x4F11, 0x29, 0x28, 0x81EA, 0x29, 0x28, 0x81F3, 0x29, 0x554F, 0x5E7C, 0x7B8F, 0x70, 0x74, 0x65,
+  0x32, 0x31, 0x32, 0x32, 0x32, 0x33, 0x32, 0x34, 0x32, 0x35, 0x32, 0x36, 0x32, 0x37, 0x32, 0x38, 0x32, 0x39, 0x33,
+  0x30, 0x33, 0x31, 0x33, 0x32, 0x33, 0x33, 0x33, 0x34, 0x33, 0x35, 0xAC00, 0xB098, 0xB2E4, 0xB77C, 0xB9C8, 0xBC14,
+  0xC0AC, 0xC544, 0xC790, 0xCC28, 0xCE74, 0xD0C0, 0xD30C, 0xD558, 0xCC38, 0xACE0, 0xC8FC, 0xC758, 0xC6B0, 0x4E94,
+  0x516D, 0x4E03, 0x4E5D, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D, 0x52B4, 0x79D8, 0x7537, 0x9069,
+  0x512A, 0x5370, 0x6CE8, 0x9805, 0x4F11, 0x5199, 0x6B63, 0x5DE6, 0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01,
+  0x8CC7, 0x5354, 0x591C, 0x33, 0x36, 0x33, 0x37, 0x33, 0x38, 0x33, 0x39, 0x34, 0x30, 0x34, 0x31, 0x34, 0x32, 0x34,
+  0x33, 0x34, 0x34, 0x34, 0x35, 0x34, 0x36, 0x34, 0x37, 0x34, 0x38, 0x34, 0x39, 0x35, 0x30, 0x31, 0x6708, 0x32, 0x6708,
+  0x33, 0x6708, 0x34, 0x6708, 0x35, 0x6708, 0x36, 0x6708, 0x37, 0x6708, 0x38, 0x6708, 0x39, 0x6708, 0x31, 0x30, 0x6708,
+  0x31, 0x31, 0x6708, 0x31, 0x32, 0x6708, 0x68, 0x67, 0x65, 0x72, 0x67, 0x65, 0x76, 0x6C, 0x74, 0x64, 0x30A2, 0x30A4,
+  0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF,
+  0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB,
+  0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF,
+  0x30F0, 0x30F1, 0x30F2, 0x4EE4, 0x548C, 0x30A2, 0x30D1, 0x30FC, 0x30C8, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x30A2,
+  0x30F3, 0x30DA, 0x30A2, 0x30A2, 0x30FC, 0x30EB, 0x30A4, 0x30CB, 0x30F3, 0x30B0, 0x30A4, 0x30F3, 0x30C1, 0x30A6,
+  0x30A9, 0x30F3, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C9, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x30AA, 0x30F3, 0x30B9,
+  0x30AA, 0x30FC, 0x30E0, 0x30AB, 0x30A4, 0x30EA, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x30AB, 0x30ED, 0x30EA, 0x30FC,
+  0x30AC, 0x30ED, 0x30F3, 0x30AC, 0x30F3, 0x30DE, 0x30AE, 0x30AC, 0x30AE, 0x30CB, 0x30FC, 0x30AD, 0x30E5, 0x30EA,
+  0x30FC, 0x30AE, 0x30EB, 0x30C0, 0x30FC, 0x30AD, 0x30ED, 0x30AD, 0x30ED, 0x30B0, 0x30E9, 0x30E0, 0x30AD, 0x30ED,
+  0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30AD, 0x30ED, 0x30EF, 0x30C3, 0x30C8, 0x30B0, 0x30E9, 0x30E0, 0x30B0, 0x30E9,
+  0x30E0, 0x30C8, 0x30F3, 0x30AF, 0x30EB, 0x30BC, 0x30A4, 0x30ED, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x30B1, 0x30FC,
+  0x30B9, 0x30B3, 0x30EB, 0x30CA, 0x30B3, 0x30FC, 0x30DD, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x30B5, 0x30F3, 0x30C1,
+  0x30FC, 0x30E0, 0x30B7, 0x30EA, 0x30F3, 0x30B0, 0x30BB, 0x30F3, 0x30C1, 0x30BB, 0x30F3, 0x30C8, 0x30C0, 0x30FC,
+  0x30B9, 0x30C7, 0x30B7, 0x30C9, 0x30EB, 0x30C8, 0x30F3, 0x30CA, 0x30CE, 0x30CE, 0x30C3, 0x30C8, 0x30CF, 0x30A4,
+  0x30C4, 0x30D1, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x30D1, 0x30FC, 0x30C4, 0x30D0, 0x30FC, 0x30EC, 0x30EB, 0x30D4,
+  0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x30D4, 0x30AF, 0x30EB, 0x30D4, 0x30B3, 0x30D3, 0x30EB, 0x30D5, 0x30A1, 0x30E9,
+  0x30C3, 0x30C9, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x30D6, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x30D5, 0x30E9, 0x30F3,
+  0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x30DA, 0x30BD, 0x30DA, 0x30CB, 0x30D2, 0x30D8, 0x30EB, 0x30C4, 0x30DA,
+  0x30F3, 0x30B9, 0x30DA, 0x30FC, 0x30B8, 0x30D9, 0x30FC, 0x30BF, 0x30DD, 0x30A4, 0x30F3, 0x30C8, 0x30DC, 0x30EB,
+  0x30C8, 0x30DB, 0x30F3, 0x30DD, 0x30F3, 0x30C9, 0x30DB, 0x30FC, 0x30EB, 0x30DB, 0x30FC, 0x30F3, 0x30DE, 0x30A4,
+  0x30AF, 0x30ED, 0x30DE, 0x30A4, 0x30EB, 0x30DE, 0x30C3, 0x30CF, 0x30DE, 0x30EB, 0x30AF, 0x30DE, 0x30F3, 0x30B7,
+  0x30E7, 0x30F3, 0x30DF, 0x30AF, 0x30ED, 0x30F3, 0x30DF, 0x30EA, 0x30DF, 0x30EA, 0x30D0, 0x30FC, 0x30EB, 0x30E1,
+  0x30AC, 0x30E1, 0x30AC, 0x30C8, 0x30F3, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x30E4, 0x30FC, 0x30C9, 0x30E4, 0x30FC,
+  0x30EB, 0x30E6, 0x30A2, 0x30F3, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x30EA, 0x30E9, 0x30EB, 0x30D4, 0x30FC, 0x30EB,
+  0x30FC, 0x30D6, 0x30EB, 0x30EC, 0x30E0, 0x30EC, 0x30F3, 0x30C8, 0x30B2, 0x30F3, 0x30EF, 0x30C3, 0x30C8, 0x30, 0x70B9,
+  0x31, 0x70B9, 0x32, 0x70B9, 0x33, 0x70B9, 0x34, 0x70B9, 0x35, 0x70B9, 0x36, 0x70B9, 0x37, 0x70B9, 0x38, 0x70B9, 0x39,
+  0x70B9, 0x31, 0x30, 0x70B9, 0x31, 0x31, 0x70B9, 0x31, 0x32, 0x70B9, 0x31, 0x33, 0x70B9, 0x31, 0x34, 0x70B9, 0x31,
+  0x35, 0x70B9, 0x31, 0x36, 0x70B9, 0x31, 0x37, 0x70B9, 0x31, 0x38, 0x70B9, 0x31, 0x39, 0x70B9, 0x32, 0x30, 0x70B9,
+  0x32, 0x31, 0x70B9, 0x32, 0x32, 0x70B9, 0x32, 0x33, 0x70B9, 0x32, 0x34, 0x70B9, 0x68, 0x70, 0x61, 0x64, 0x61, 0x61,
+  0x75, 0x62, 0x61, 0x72, 0x6F, 0x76, 0x70, 0x63, 0x64, 0x6D, 0x64, 0x6D, 0x32, 0x64, 0x6D, 0x33, 0x69, 0x75, 0x5E73,
+  0x6210, 0x662D, 0x548C, 0x5927, 0x6B63, 0x660E, 0x6CBB, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x70, 0x61, 0x6E, 0x61,
+  0x3BC, 0x61, 0x6D, 0x61, 0x6B, 0x61, 0x6B, 0x62, 0x6D, 0x62, 0x67, 0x62, 0x63, 0x61, 0x6C, 0x6B, 0x63, 0x61, 0x6C,
+  0x70, 0x66, 0x6E, 0x66, 0x3BC, 0x66, 0x3BC, 0x67, 0x6D, 0x67, 0x6B, 0x67, 0x68, 0x7A, 0x6B, 0x68, 0x7A, 0x6D, 0x68,
+  0x7A, 0x67, 0x68, 0x7A, 0x74, 0x68, 0x7A, 0x3BC, 0x6C, 0x6D, 0x6C, 0x64, 0x6C, 0x6B, 0x6C, 0x66, 0x6D, 0x6E, 0x6D,
+  0x3BC, 0x6D, 0x6D, 0x6D, 0x63, 0x6D, 0x6B, 0x6D, 0x6D, 0x6D, 0x32, 0x63, 0x6D, 0x32, 0x6D, 0x32, 0x6B, 0x6D, 0x32,
+  0x6D, 0x6D, 0x33, 0x63, 0x6D, 0x33, 0x6D, 0x33, 0x6B, 0x6D, 0x33, 0x6D, 0x2215, 0x73, 0x6D, 0x2215, 0x73, 0x32, 0x6B,
+  0x70, 0x61, 0x6D, 0x70, 0x61, 0x67, 0x70, 0x61, 0x72, 0x61, 0x64, 0x72, 0x61, 0x64, 0x2215, 0x73, 0x72, 0x61, 0x64,
+  0x2215, 0x73, 0x32, 0x70, 0x73, 0x6E, 0x73, 0x3BC, 0x73, 0x6D, 0x73, 0x70, 0x76, 0x6E, 0x76, 0x3BC, 0x76, 0x6D, 0x76,
+  0x6B, 0x76, 0x70, 0x77, 0x6E, 0x77, 0x3BC, 0x77, 0x6D, 0x77, 0x6B, 0x77, 0x6B, 0x3C9, 0x6D, 0x3C9, 0x62, 0x71, 0x63,
+  0x63, 0x63, 0x64, 0x63, 0x2215, 0x6B, 0x67, 0x64, 0x62, 0x67, 0x79, 0x68, 0x61, 0x68, 0x70, 0x69, 0x6E, 0x6B, 0x6B,
+  0x6B, 0x74, 0x6C, 0x6D, 0x6C, 0x6E, 0x6C, 0x6F, 0x67, 0x6C, 0x78, 0x6D, 0x69, 0x6C, 0x6D, 0x6F, 0x6C, 0x70, 0x68,
+  0x70, 0x70, 0x6D, 0x70, 0x72, 0x73, 0x72, 0x73, 0x76, 0x77, 0x62, 0x76, 0x2215, 0x6D, 0x61, 0x2215, 0x6D, 0x31,
+  0x65E5, 0x32, 0x65E5, 0x33, 0x65E5, 0x34, 0x65E5, 0x35, 0x65E5, 0x36, 0x65E5, 0x37, 0x65E5, 0x38, 0x65E5, 0x39,
+  0x65E5, 0x31, 0x30, 0x65E5, 0x31, 0x31, 0x65E5, 0x31, 0x32, 0x65E5, 0x31, 0x33, 0x65E5, 0x31, 0x34, 0x65E5, 0x31,
+  0x35, 0x65E5, 0x31, 0x36, 0x65E5, 0x31, 0x37, 0x65E5, 0x31, 0x38, 0x65E5, 0x31, 0x39, 0x65E5, 0x32, 0x30, 0x65E5,
+  0x32, 0x31, 0x65E5, 0x32, 0x32, 0x65E5, 0x32, 0x33, 0x65E5, 0x32, 0x34, 0x65E5, 0x32, 0x35, 0x65E5, 0x32, 0x36,
+  0x65E5, 0x32, 0x37, 0x65E5, 0x32, 0x38, 0x65E5, 0x32, 0x39, 0x65E5, 0x33, 0x30, 0x65E5, 0x33, 0x31, 0x65E5, 0x67,
+  0x61, 0x6C, 0xA641, 0xA643, 0xA645, 0xA647, 0xA649, 0xA64D, 0xA64F, 0xA651, 0xA653, 0xA655, 0xA657, 0xA659, 0xA65B,
+  0xA65D, 0xA65F, 0xA661, 0xA663, 0xA665, 0xA667, 0xA669, 0xA66B, 0xA66D, 0xA681, 0xA683, 0xA685, 0xA687, 0xA689,
+  0xA68B, 0xA68D, 0xA68F, 0xA691, 0xA693, 0xA695, 0xA697, 0xA699, 0xA69B, 0xA723, 0xA725, 0xA727, 0xA729, 0xA72B,
+  0xA72D, 0xA72F, 0xA733, 0xA735, 0xA737, 0xA739, 0xA73B, 0xA73D, 0xA73F, 0xA741, 0xA743, 0xA745, 0xA747, 0xA749,
+  0xA74B, 0xA74D, 0xA74F, 0xA751, 0xA753, 0xA755, 0xA757, 0xA759, 0xA75B, 0xA75D, 0xA75F, 0xA761, 0xA763, 0xA765,
+  0xA767, 0xA769, 0xA76B, 0xA76D, 0xA76F, 0xA77A, 0xA77C, 0x1D79, 0xA77F, 0xA781, 0xA783, 0xA785, 0xA787, 0xA78C,
+  0xA791, 0xA793, 0xA797, 0xA799, 0xA79B, 0xA79D, 0xA79F, 0xA7A1, 0xA7A3, 0xA7A5, 0xA7A7, 0xA7A9, 0x26C, 0x29E, 0x287,
+  0xAB53, 0xA7B5, 0xA7B7, 0xA7B9, 0xA7BB, 0xA7BD, 0xA7BF, 0xA7C1, 0xA7C3, 0xA794, 0x1D8E, 0xA7C8, 0xA7CA, 0xA7D1,
+  0xA7D7, 0xA7D9, 0xA7F6, 0xAB37, 0xAB52, 0x28D, 0x13A0, 0x13A1, 0x13A2, 0x13A3, 0x13A4, 0x13A5, 0x13A6, 0x13A7,
+  0x13A8, 0x13A9, 0x13AA, 0x13AB, 0x13AC, 0x13AD, 0x13AE, 0x13AF, 0x13B0, 0x13B1, 0x13B2, 0x13B3, 0x13B4, 0x13B5,
+  0x13B6, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB, 0x13BC, 0x13BD, 0x13BE, 0x13BF, 0x13C0, 0x13C1, 0x13C2, 0x13C3,
+  0x13C4, 0x13C5, 0x13C6, 0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB, 0x13CC, 0x13CD, 0x13CE, 0x13CF, 0x13D0, 0x13D1,
+  0x13D2, 0x13D3, 0x13D4, 0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9, 0x13DA, 0x13DB, 0x13DC, 0x13DD, 0x13DE, 0x13DF,
+  0x13E0, 0x13E1, 0x13E2, 0x13E3, 0x13E4, 0x13E5, 0x13E6, 0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC, 0x13ED,
+  0x13EE, 0x13EF, 0x8C48, 0x66F4, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x5951, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85,
+  0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04,
+  0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC,
+  0x90CE, 0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA,
+  0x788C, 0x797F, 0x7DA0, 0x83C9, 0x9304, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7,
+  0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE,
+  0x83F1, 0x9675, 0x8B80, 0x62CF, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+  0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x6C88, 0x62FE, 0x82E5, 0x63A0,
+  0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5EEC, 0x65C5, 0x6FFE,
+  0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149,
+  0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x5EC9,
+  0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234,
+  0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x71CE,
+  0x7642, 0x84FC, 0x907C, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10,
+  0x985E, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x9686, 0x5229, 0x540F, 0x5C65,
+  0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0,
+  0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0,
+  0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x964D, 0x5ED3, 0x5140, 0x55C0,
+  0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x8612, 0x8AF8, 0x9038,
+  0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D,
+  0x5606, 0x5668, 0x5840, 0x58A8, 0x5C64, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77,
+  0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x7949, 0x7948, 0x7950, 0x7956, 0x798D, 0x798E, 0x7A40, 0x7A81,
+  0x7BC0, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08,
+  0x8FB6, 0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7,
+  0x52FA, 0x5555, 0x5599, 0x55E2, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8,
+  0x614E, 0x6108, 0x6160, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x671B, 0x6756, 0x6EDB, 0x6ECB, 0x701E, 0x77A7,
+  0x7235, 0x72AF, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7C7B,
+  0x7D5B, 0x7F3E, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8ABF, 0x8ACB, 0x8AED, 0x8B8A, 0x8F38, 0x9072, 0x9199,
+  0x9276, 0x967C, 0x97DB, 0x980B, 0x9B12, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3,
+  0x9F43, 0x9F8E, 0x66, 0x66, 0x66, 0x69, 0x66, 0x6C, 0x66, 0x66, 0x69, 0x66, 0x66, 0x6C, 0x73, 0x74, 0x574, 0x576,
+  0x574, 0x565, 0x574, 0x56B, 0x57E, 0x576, 0x574, 0x56D, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5E2, 0x5D4, 0x5DB, 0x5DC,
+  0x5DD, 0x5E8, 0x5EA, 0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5E9, 0x5BC, 0x5C1, 0x5E9, 0x5BC, 0x5C2, 0x5D0, 0x5B7, 0x5D0,
+  0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC, 0x5D3, 0x5BC, 0x5D4, 0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8,
+  0x5BC, 0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC, 0x5BC, 0x5DE, 0x5BC, 0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3,
+  0x5BC, 0x5E4, 0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8, 0x5BC, 0x5E9, 0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9, 0x5D1,
+  0x5BF, 0x5DB, 0x5BF, 0x5E4, 0x5BF, 0x5D0, 0x5DC, 0x671, 0x67B, 0x67E, 0x680, 0x67A, 0x67F, 0x679, 0x6A4, 0x6A6,
+  0x684, 0x683, 0x686, 0x687, 0x68D, 0x68C, 0x68E, 0x688, 0x698, 0x691, 0x6A9, 0x6AF, 0x6B3, 0x6B1, 0x6BA, 0x6BB,
+  0x6C0, 0x6C1, 0x6BE, 0x6D2, 0x6D3, 0x6AD, 0x6C7, 0x6C6, 0x6C8, 0x6CB, 0x6C5, 0x6C9, 0x6D0, 0x649, 0x626, 0x627,
+  0x626, 0x6D5, 0x626, 0x648, 0x626, 0x6C7, 0x626, 0x6C6, 0x626, 0x6C8, 0x626, 0x6D0, 0x626, 0x649, 0x6CC, 0x626,
+  0x62C, 0x626, 0x62D, 0x626, 0x645, 0x626, 0x64A, 0x628, 0x62C, 0x628, 0x62D, 0x628, 0x62E, 0x628, 0x645, 0x628,
+  0x649, 0x628, 0x64A, 0x62A, 0x62C, 0x62A, 0x62D, 0x62A, 0x62E, 0x62A, 0x645, 0x62A, 0x649, 0x62A, 0x64A, 0x62B,
+  0x62C, 0x62B, 0x645, 0x62B, 0x649, 0x62B, 0x64A, 0x62C, 0x62D, 0x62C, 0x645, 0x62D, 0x62C, 0x62D, 0x645, 0x62E,
+  0x62C, 0x62E, 0x62D, 0x62E, 0x645, 0x633, 0x62C, 0x633, 0x62D, 0x633, 0x62E, 0x633, 0x645, 0x635, 0x62D, 0x635,
+  0x645, 0x636, 0x62C, 0x636, 0x62D, 0x636, 0x62E, 0x636, 0x645, 0x637, 0x62D, 0x637, 0x645, 0x638, 0x645, 0x639,
+  0x62C, 0x639, 0x645, 0x63A, 0x62C, 0x63A, 0x645, 0x641, 0x62C, 0x641, 0x62D, 0x641, 0x62E, 0x641, 0x645, 0x641,
+  0x649, 0x641, 0x64A, 0x642, 0x62D, 0x642, 0x645, 0x642, 0x649, 0x642, 0x64A, 0x643, 0x627, 0x643, 0x62C, 0x643,
+  0x62D, 0x643, 0x62E, 0x643, 0x644, 0x643, 0x645, 0x643, 0x649, 0x643, 0x64A, 0x644, 0x62C, 0x644, 0x62D, 0x644,
+  0x62E, 0x644, 0x645, 0x644, 0x649, 0x644, 0x64A, 0x645, 0x62C, 0x645, 0x62D, 0x645, 0x62E, 0x645, 0x645, 0x645,
+  0x649, 0x645, 0x64A, 0x646, 0x62C, 0x646, 0x62D, 0x646, 0x62E, 0x646, 0x645, 0x646, 0x649, 0x646, 0x64A, 0x647,
+  0x62C, 0x647, 0x645, 0x647, 0x649, 0x647, 0x64A, 0x64A, 0x62C, 0x64A, 0x62D, 0x64A, 0x62E, 0x64A, 0x645, 0x64A,
+  0x649, 0x64A, 0x64A, 0x630, 0x670, 0x631, 0x670, 0x649, 0x670, 0x20, 0x64C, 0x651, 0x20, 0x64D, 0x651, 0x20, 0x64E,
+  0x651, 0x20, 0x64F, 0x651, 0x20, 0x650, 0x651, 0x20, 0x651, 0x670, 0x626, 0x631, 0x626, 0x632, 0x626, 0x646, 0x628,
+  0x631, 0x628, 0x632, 0x628, 0x646, 0x62A, 0x631, 0x62A, 0x632, 0x62A, 0x646, 0x62B, 0x631, 0x62B, 0x632, 0x62B,
+  0x646, 0x645, 0x627, 0x646, 0x631, 0x646, 0x632, 0x646, 0x646, 0x64A, 0x631, 0x64A, 0x632, 0x64A, 0x646, 0x626,
+  0x62E, 0x626, 0x647, 0x628, 0x647, 0x62A, 0x647, 0x635, 0x62E, 0x644, 0x647, 0x646, 0x647, 0x647, 0x670, 0x64A,
+  0x647, 0x62B, 0x647, 0x633, 0x647, 0x634, 0x645, 0x634, 0x647, 0x640, 0x64E, 0x651, 0x640, 0x64F, 0x651, 0x640,
+  0x650, 0x651, 0x637, 0x649, 0x637, 0x64A, 0x639, 0x649, 0x639, 0x64A, 0x63A, 0x649, 0x63A, 0x64A, 0x633, 0x649,
+  0x633, 0x64A, 0x634, 0x649, 0x634, 0x64A, 0x62D, 0x649, 0x62D, 0x64A, 0x62C, 0x649, 0x62C, 0x64A, 0x62E, 0x649,
+  0x62E, 0x64A, 0x635, 0x649, 0x635, 0x64A, 0x636, 0x649, 0x636, 0x64A, 0x634, 0x62C, 0x634, 0x62D, 0x634, 0x62E,
+  0x634, 0x631, 0x633, 0x631, 0x635, 0x631, 0x636, 0x631, 0x627, 0x64B, 0x62A, 0x62C, 0x645, 0x62A, 0x62D, 0x62C,
+  0x62A, 0x62D, 0x645, 0x62A, 0x62E, 0x645, 0x62A, 0x645, 0x62C, 0x62A, 0x645, 0x62D, 0x62A, 0x645, 0x62E, 0x62C,
+  0x645, 0x62D, 0x62D, 0x645, 0x64A, 0x62D, 0x645, 0x649, 0x633, 0x62D, 0x62C, 0x633, 0x62C, 0x62D, 0x633, 0x62C,
+  0x649, 0x633, 0x645, 0x62D, 0x633, 0x645, 0x62C, 0x633, 0x645, 0x645, 0x635, 0x62D, 0x62D, 0x635, 0x645, 0x645,
+  0x634, 0x62D, 0x645, 0x634, 0x62C, 0x64A, 0x634, 0x645, 0x62E, 0x634, 0x645, 0x645, 0x636, 0x62D, 0x649, 0x636,
+  0x62E, 0x645, 0x637, 0x645, 0x62D, 0x637, 0x645, 0x645, 0x637, 0x645, 0x64A, 0x639, 0x62C, 0x645, 0x639, 0x645,
+  0x645, 0x639, 0x645, 0x649, 0x63A, 0x645, 0x645, 0x63A, 0x645, 0x64A, 0x63A, 0x645, 0x649, 0x641, 0x62E, 0x645,
+  0x642, 0x645, 0x62D, 0x642, 0x645, 0x645, 0x644, 0x62D, 0x645, 0x644, 0x62D, 0x64A, 0x644, 0x62D, 0x649, 0x644,
+  0x62C, 0x62C, 0x644, 0x62E, 0x645, 0x644, 0x645, 0x62D, 0x645, 0x62D, 0x62C, 0x645, 0x62D, 0x645, 0x645, 0x62D,
+  0x64A, 0x645, 0x62C, 0x62D, 0x645, 0x62C, 0x645, 0x645, 0x62E, 0x62C, 0x645, 0x62E, 0x645, 0x645, 0x62C, 0x62E,
+  0x647, 0x645, 0x62C, 0x647, 0x645, 0x645, 0x646, 0x62D, 0x645, 0x646, 0x62D, 0x649, 0x646, 0x62C, 0x645, 0x646,
+  0x62C, 0x649, 0x646, 0x645, 0x64A, 0x646, 0x645, 0x649, 0x64A, 0x645, 0x645, 0x628, 0x62E, 0x64A, 0x62A, 0x62C,
+  0x64A, 0x62A, 0x62C, 0x649, 0x62A, 0x62E, 0x64A, 0x62A, 0x62E, 0x649, 0x62A, 0x645, 0x64A, 0x62A, 0x645, 0x649,
+  0x62C, 0x645, 0x64A, 0x62C, 0x62D, 0x649, 0x62C, 0x645, 0x649, 0x633, 0x62E, 0x649, 0x635, 0x62D, 0x64A, 0x634,
+  0x62D, 0x64A, 0x636, 0x62D, 0x64A, 0x644, 0x62C, 0x64A, 0x644, 0x645, 0x64A, 0x64A, 0x62D, 0x64A, 0x64A, 0x62C,
+  0x64A, 0x64A, 0x645, 0x64A, 0x645, 0x645, 0x64A, 0x642, 0x645, 0x64A, 0x646, 0x62D, 0x64A, 0x639, 0x645, 0x64A,
+  0x643, 0x645, 0x64A, 0x646, 0x62C, 0x62D, 0x645, 0x62E, 0x64A, 0x644, 0x62C, 0x645, 0x643, 0x645, 0x645, 0x62C,
+  0x62D, 0x64A, 0x62D, 0x62C, 0x64A, 0x645, 0x62C, 0x64A, 0x641, 0x645, 0x64A, 0x628, 0x62D, 0x64A, 0x633, 0x62E,
+  0x64A, 0x646, 0x62C, 0x64A, 0x635, 0x644, 0x6D2, 0x642, 0x644, 0x6D2, 0x627, 0x644, 0x644, 0x647, 0x627, 0x643,
+  0x628, 0x631, 0x645, 0x62D, 0x645, 0x62F, 0x635, 0x644, 0x639, 0x645, 0x631, 0x633, 0x648, 0x644, 0x639, 0x644,
+  0x64A, 0x647, 0x648, 0x633, 0x644, 0x645, 0x635, 0x644, 0x649, 0x635, 0x644, 0x649, 0x20, 0x627, 0x644, 0x644, 0x647,
+  0x20, 0x639, 0x644, 0x64A, 0x647, 0x20, 0x648, 0x633, 0x644, 0x645, 0x62C, 0x644, 0x20, 0x62C, 0x644, 0x627, 0x644,
+  0x647, 0x631, 0x6CC, 0x627, 0x644, 0x2C, 0x3001, 0x3A, 0x21, 0x3F, 0x3016, 0x3017, 0x2014, 0x2013, 0x5F, 0x7B, 0x7D,
+  0x3014, 0x3015, 0x3010, 0x3011, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E, 0x300F, 0x5B, 0x5D, 0x23, 0x26, 0x2A, 0x2D,
+  0x3C, 0x3E, 0x5C, 0x24, 0x25, 0x40, 0x20, 0x64B, 0x640, 0x64B, 0x20, 0x64C, 0x20, 0x64D, 0x20, 0x64E, 0x640, 0x64E,
+  0x20, 0x64F, 0x640, 0x64F, 0x20, 0x650, 0x640, 0x650, 0x20, 0x651, 0x640, 0x651, 0x20, 0x652, 0x640, 0x652, 0x621,
+  0x622, 0x623, 0x624, 0x625, 0x626, 0x627, 0x628, 0x629, 0x62A, 0x62B, 0x62C, 0x62D, 0x62E, 0x62F, 0x630, 0x631,
+  0x632, 0x633, 0x634, 0x635, 0x636, 0x637, 0x638, 0x639, 0x63A, 0x641, 0x642, 0x643, 0x644, 0x645, 0x646, 0x647,
+  0x648, 0x64A, 0x644, 0x622, 0x644, 0x623, 0x644, 0x625, 0x644, 0x627, 0x22, 0x27, 0x2F, 0x5E, 0x7C, 0x7E, 0x2985,
+  0x2986, 0x30FB, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC, 0x30F3, 0x3099,
+  0x309A, 0xA2, 0xA3, 0xAC, 0xA6, 0xA5, 0x20A9, 0x2502, 0x2190, 0x2191, 0x2192, 0x2193, 0x25A0, 0x25CB, 0x10428,
+  0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D, 0x1042E, 0x1042F, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435,
+  0x10436, 0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E, 0x1043F, 0x10440, 0x10441, 0x10442,
+  0x10443, 0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D, 0x1044E, 0x1044F,
+  0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE, 0x104DF, 0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4,
+  0x104E5, 0x104E6, 0x104E7, 0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE, 0x104EF, 0x104F0, 0x104F1,
+  0x104F2, 0x104F3, 0x104F4, 0x104F5, 0x104F6, 0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x10597, 0x10598, 0x10599,
+  0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0, 0x105A1, 0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7,
+  0x105A8, 0x105A9, 0x105AA, 0x105AB, 0x105AC, 0x105AD, 0x105AE, 0x105AF, 0x105B0, 0x105B1, 0x105B3, 0x105B4, 0x105B5,
+  0x105B6, 0x105B7, 0x105B8, 0x105B9, 0x105BB, 0x105BC, 0x2D0, 0x2D1, 0x299, 0x2A3, 0xAB66, 0x2A5, 0x2A4, 0x1D91,
+  0x258, 0x25E, 0x2A9, 0x264, 0x262, 0x29B, 0x29C, 0x267, 0x284, 0x2AA, 0x2AB, 0x1DF04, 0xA78E, 0x26E, 0x1DF05, 0x28E,
+  0x1DF06, 0x276, 0x277, 0x27A, 0x1DF08, 0x27E, 0x2A8, 0x2A6, 0xAB67, 0x2A7, 0x2C71, 0x28F, 0x2A1, 0x2A2, 0x298, 0x1C0,
+  0x1C1, 0x1C2, 0x1DF0A, 0x1DF1E, 0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7, 0x10CC8,
+  0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF, 0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5,
+  0x10CD6, 0x10CD7, 0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF, 0x10CE0, 0x10CE1, 0x10CE2,
+  0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7, 0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CEF,
+  0x10CF0, 0x10CF1, 0x10CF2, 0x118C0, 0x118C1, 0x118C2, 0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9,
+  0x118CA, 0x118CB, 0x118CC, 0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4, 0x118D5, 0x118D6,
+  0x118D7, 0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF, 0x16E60, 0x16E61, 0x16E62, 0x16E63,
+  0x16E64, 0x16E65, 0x16E66, 0x16E67, 0x16E68, 0x16E69, 0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70,
+  0x16E71, 0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78, 0x16E79, 0x16E7A, 0x16E7B, 0x16E7C, 0x16E7D,
+  0x16E7E, 0x16E7F, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+  0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9,
+  0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x131, 0x237,
+  0x2207, 0x2202, 0x4CF, 0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929, 0x1E92A, 0x1E92B,
+  0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931, 0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937, 0x1E938,
+  0x1E939, 0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940, 0x1E941, 0x1E942, 0x1E943, 0x66E, 0x6A1,
+  0x66F, 0x30, 0x2C, 0x31, 0x2C, 0x32, 0x2C, 0x33, 0x2C, 0x34, 0x2C, 0x35, 0x2C, 0x36, 0x2C, 0x37, 0x2C, 0x38, 0x2C,
+  0x39, 0x2C, 0x3014, 0x73, 0x3015, 0x77, 0x7A, 0x68, 0x76, 0x73, 0x64, 0x73, 0x73, 0x70, 0x70, 0x76, 0x77, 0x63, 0x6D,
+  0x63, 0x6D, 0x64, 0x6D, 0x72, 0x64, 0x6A, 0x307B, 0x304B, 0x30B3, 0x30B3, 0x5B57, 0x53CC, 0x30C7, 0x591A, 0x89E3,
+  0x4EA4, 0x6620, 0x7121, 0x524D, 0x5F8C, 0x518D, 0x65B0, 0x521D, 0x7D42, 0x8CA9, 0x58F0, 0x5439, 0x6F14, 0x6295,
+  0x6355, 0x904A, 0x6307, 0x6253, 0x7981, 0x7A7A, 0x5408, 0x6E80, 0x7533, 0x5272, 0x55B6, 0x914D, 0x3014, 0x672C,
+  0x3015, 0x3014, 0x4E09, 0x3015, 0x3014, 0x4E8C, 0x3015, 0x3014, 0x5B89, 0x3015, 0x3014, 0x70B9, 0x3015, 0x3014,
+  0x6253, 0x3015, 0x3014, 0x76D7, 0x3015, 0x3014, 0x52DD, 0x3015, 0x3014, 0x6557, 0x3015, 0x5F97, 0x53EF, 0x4E3D,
+  0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50CF, 0x349E, 0x2063A, 0x5154, 0x5164, 0x5177,
+  0x2051C, 0x34B9, 0x5167, 0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x291DF, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5277,
+  0x3515, 0x5305, 0x5306, 0x5349, 0x535A, 0x5373, 0x537D, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB,
+  0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x55AB, 0x55B3,
+  0x55C2, 0x5716, 0x5717, 0x5651, 0x5674, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831, 0x58AC, 0x214E4,
+  0x58F2, 0x58F7, 0x5906, 0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x5B08,
+  0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x3781, 0x5C60, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43,
+  0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C,
+  0x5EB0, 0x5EB3, 0x5EB6, 0x2A392, 0x22331, 0x8201, 0x5F22, 0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A,
+  0x5FCD, 0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x226D4, 0x60C7, 0x6148, 0x614C, 0x617A, 0x61B2, 0x61A4, 0x61AF,
+  0x61DE, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1,
+  0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649,
+  0x3B19, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49,
+  0x67FA, 0x6785, 0x6852, 0x2346D, 0x688E, 0x681F, 0x6914, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18,
+  0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD,
+  0x6C67, 0x6D16, 0x6D3E, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6EC7, 0x23ED1, 0x6DF9,
+  0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263,
+  0x719C, 0x7228, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x7447,
+  0x745C, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC,
+  0x4008, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x40E3, 0x25626,
+  0x2569A, 0x256C5, 0x79EB, 0x412F, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80,
+  0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247,
+  0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2,
+  0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D,
+  0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8353, 0x83CA,
+  0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561,
+  0x26FB1, 0x270D2, 0x456B, 0x8650, 0x8667, 0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8728, 0x876B, 0x8786, 0x87E1,
+  0x8801, 0x45F9, 0x8860, 0x27667, 0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0,
+  0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x285D2, 0x285ED,
+  0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995,
+  0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496,
+  0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED,
+  0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x4D56, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x2A600,
+};
+
+static const CodePointRange kCombiningClasses[] = {
+  {0x300, 0x314, 230}, {0x315, 0x315, 232}, {0x316, 0x319, 220}, {0x31A, 0x31A, 232}, {0x31B, 0x31B, 216},
+  {0x31C, 0x320, 220}, {0x321, 0x322, 202}, {0x323, 0x326, 220}, {0x327, 0x328, 202}, {0x329, 0x333, 220},
+  {0x334, 0x338, 1}, {0x339, 0x33C, 220}, {0x33D, 0x344, 230}, {0x345, 0x345, 240}, {0x346, 0x346, 230},
+  {0x347, 0x349, 220}, {0x34A, 0x34C, 230}, {0x34D, 0x34E, 220}, {0x350, 0x352, 230}, {0x353, 0x356, 220},
+  {0x357, 0x357, 230}, {0x358, 0x358, 232}, {0x359, 0x35A, 220}, {0x35B, 0x35B, 230}, {0x35C, 0x35C, 233},
+  {0x35D, 0x35E, 234}, {0x35F, 0x35F, 233}, {0x360, 0x361, 234}, {0x362, 0x362, 233}, {0x363, 0x36F, 230},
+  {0x483, 0x487, 230}, {0x591, 0x591, 220}, {0x592, 0x595, 230}, {0x596, 0x596, 220}, {0x597, 0x599, 230},
+  {0x59A, 0x59A, 222}, {0x59B, 0x59B, 220}, {0x59C, 0x5A1, 230}, {0x5A2, 0x5A7, 220}, {0x5A8, 0x5A9, 230},
+  {0x5AA, 0x5AA, 220}, {0x5AB, 0x5AC, 230}, {0x5AD, 0x5AD, 222}, {0x5AE, 0x5AE, 228}, {0x5AF, 0x5AF, 230},
+  {0x5B0, 0x5B0, 10}, {0x5B1, 0x5B1, 11}, {0x5B2, 0x5B2, 12}, {0x5B3, 0x5B3, 13}, {0x5B4, 0x5B4, 14},
+  {0x5B5, 0x5B5, 15}, {0x5B6, 0x5B6, 16}, {0x5B7, 0x5B7, 17}, {0x5B8, 0x5B8, 18}, {0x5B9, 0x5BA, 19},
+  {0x5BB, 0x5BB, 20}, {0x5BC, 0x5BC, 21}, {0x5BD, 0x5BD, 22}, {0x5BF, 0x5BF, 23}, {0x5C1, 0x5C1, 24},
+  {0x5C2, 0x5C2, 25}, {0x5C4, 0x5C4, 230}, {0x5C5, 0x5C5, 220}, {0x5C7, 0x5C7, 18}, {0x610, 0x617, 230},
+  {0x618, 0x618, 30}, {0x619, 0x619, 31}, {0x61A, 0x61A, 32}, {0x64B, 0x64B, 27}, {0x64C, 0x64C, 28},
+  {0x64D, 0x64D, 29}, {0x64E, 0x64E, 30}, {0x64F, 0x64F, 31}, {0x650, 0x650, 32}, {0x651, 0x651, 33},
+  {0x652, 0x652, 34}, {0x653, 0x654, 230}, {0x655, 0x656, 220}, {0x657, 0x65B, 230}, {0x65C, 0x65C, 220},
+  {0x65D, 0x65E, 230}, {0x65F, 0x65F, 220}, {0x670, 0x670, 35}, {0x6D6, 0x6DC, 230}, {0x6DF, 0x6E2, 230},
+  {0x6E3, 0x6E3, 220}, {0x6E4, 0x6E4, 230}, {0x6E7, 0x6E8, 230}, {0x6EA, 0x6EA, 220}, {0x6EB, 0x6EC, 230},
+  {0x6ED, 0x6ED, 220}, {0x711, 0x711, 36}, {0x730, 0x730, 230}, {0x731, 0x731, 220}, {0x732, 0x733, 230},
+  {0x734, 0x734, 220}, {0x735, 0x736, 230}, {0x737, 0x739, 220}, {0x73A, 0x73A, 230}, {0x73B, 0x73C, 220},
+  {0x73D, 0x73D, 230}, {0x73E, 0x73E, 220}, {0x73F, 0x741, 230}, {0x742, 0x742, 220}, {0x743, 0x743, 230},
+  {0x744, 0x744, 220}, {0x745, 0x745, 230}, {0x746, 0x746, 220}, {0x747, 0x747, 230}, {0x748, 0x748, 220},
+  {0x749, 0x74A, 230}, {0x7EB, 0x7F1, 230}, {0x7F2, 0x7F2, 220}, {0x7F3, 0x7F3, 230}, {0x7FD, 0x7FD, 220},
+  {0x816, 0x819, 230}, {0x81B, 0x823, 230}, {0x825, 0x827, 230}, {0x829, 0x82D, 230}, {0x859, 0x85B, 220},
+  {0x898, 0x898, 230}, {0x899, 0x89B, 220}, {0x89C, 0x89F, 230}, {0x8CA, 0x8CE, 230}, {0x8CF, 0x8D3, 220},
+  {0x8D4, 0x8E1, 230}, {0x8E3, 0x8E3, 220}, {0x8E4, 0x8E5, 230}, {0x8E6, 0x8E6, 220}, {0x8E7, 0x8E8, 230},
+  {0x8E9, 0x8E9, 220}, {0x8EA, 0x8EC, 230}, {0x8ED, 0x8EF, 220}, {0x8F0, 0x8F0, 27}, {0x8F1, 0x8F1, 28},
+  {0x8F2, 0x8F2, 29}, {0x8F3, 0x8F5, 230}, {0x8F6, 0x8F6, 220}, {0x8F7, 0x8F8, 230}, {0x8F9, 0x8FA, 220},
+  {0x8FB, 0x8FF, 230}, {0x93C, 0x93C, 7}, {0x94D, 0x94D, 9}, {0x951, 0x951, 230}, {0x952, 0x952, 220},
+  {0x953, 0x954, 230}, {0x9BC, 0x9BC, 7}, {0x9CD, 0x9CD, 9}, {0x9FE, 0x9FE, 230}, {0xA3C, 0xA3C, 7}, {0xA4D, 0xA4D, 9},
+  {0xABC, 0xABC, 7}, {0xACD, 0xACD, 9}, {0xB3C, 0xB3C, 7}, {0xB4D, 0xB4D, 9}, {0xBCD, 0xBCD, 9}, {0xC3C, 0xC3C, 7},
+  {0xC4D, 0xC4D, 9}, {0xC55, 0xC55, 84}, {0xC56, 0xC56, 91}, {0xCBC, 0xCBC, 7}, {0xCCD, 0xCCD, 9}, {0xD3B, 0xD3C, 9},
+  {0xD4D, 0xD4D, 9}, {0xDCA, 0xDCA, 9}, {0xE38, 0xE39, 103}, {0xE3A, 0xE3A, 9}, {0xE48, 0xE4B, 107},
+  {0xEB8, 0xEB9, 118}, {0xEBA, 0xEBA, 9}, {0xEC8, 0xECB, 122}, {0xF18, 0xF19, 220}, {0xF35, 0xF35, 220},
+  {0xF37, 0xF37, 220}, {0xF39, 0xF39, 216}, {0xF71, 0xF71, 129}, {0xF72, 0xF72, 130}, {0xF74, 0xF74, 132},
+  {0xF7A, 0xF7D, 130}, {0xF80, 0xF80, 130}, {0xF82, 0xF83, 230}, {0xF84, 0xF84, 9}, {0xF86, 0xF87, 230},
+  {0xFC6, 0xFC6, 220}, {0x1037, 0x1037, 7}, {0x1039, 0x103A, 9}, {0x108D, 0x108D, 220}, {0x135D, 0x135F, 230},
+  {0x1714, 0x1715, 9}, {0x1734, 0x1734, 9}, {0x17D2, 0x17D2, 9}, {0x17DD, 0x17DD, 230}, {0x18A9, 0x18A9, 228},
+  {0x1939, 0x1939, 222}, {0x193A, 0x193A, 230}, {0x193B, 0x193B, 220}, {0x1A17, 0x1A17, 230}, {0x1A18, 0x1A18, 220},
+  {0x1A60, 0x1A60, 9}, {0x1A75, 0x1A7C, 230}, {0x1A7F, 0x1A7F, 220}, {0x1AB0, 0x1AB4, 230}, {0x1AB5, 0x1ABA, 220},
+  {0x1ABB, 0x1ABC, 230}, {0x1ABD, 0x1ABD, 220}, {0x1ABF, 0x1AC0, 220}, {0x1AC1, 0x1AC2, 230}, {0x1AC3, 0x1AC4, 220},
+  {0x1AC5, 0x1AC9, 230}, {0x1ACA, 0x1ACA, 220}, {0x1ACB, 0x1ACE, 230}, {0x1B34, 0x1B34, 7}, {0x1B44, 0x1B44, 9},
+  {0x1B6B, 0x1B6B, 230}, {0x1B6C, 0x1B6C, 220}, {0x1B6D, 0x1B73, 230}, {0x1BAA, 0x1BAB, 9}, {0x1BE6, 0x1BE6, 7},
+  {0x1BF2, 0x1BF3, 9}, {0x1C37, 0x1C37, 7}, {0x1CD0, 0x1CD2, 230}, {0x1CD4, 0x1CD4, 1}, {0x1CD5, 0x1CD9, 220},
+  {0x1CDA, 0x1CDB, 230}, {0x1CDC, 0x1CDF, 220}, {0x1CE0, 0x1CE0, 230}, {0x1CE2, 0x1CE8, 1}, {0x1CED, 0x1CED, 220},
+  {0x1CF4, 0x1CF4, 230}, {0x1CF8, 0x1CF9, 230}, {0x1DC0, 0x1DC1, 230}, {0x1DC2, 0x1DC2, 220}, {0x1DC3, 0x1DC9, 230},
+  {0x1DCA, 0x1DCA, 220}, {0x1DCB, 0x1DCC, 230}, {0x1DCD, 0x1DCD, 234}, {0x1DCE, 0x1DCE, 214}, {0x1DCF, 0x1DCF, 220},
+  {0x1DD0, 0x1DD0, 202}, {0x1DD1, 0x1DF5, 230}, {0x1DF6, 0x1DF6, 232}, {0x1DF7, 0x1DF8, 228}, {0x1DF9, 0x1DF9, 220},
+  {0x1DFA, 0x1DFA, 218}, {0x1DFB, 0x1DFB, 230}, {0x1DFC, 0x1DFC, 233}, {0x1DFD, 0x1DFD, 220}, {0x1DFE, 0x1DFE, 230},
+  {0x1DFF, 0x1DFF, 220}, {0x20D0, 0x20D1, 230}, {0x20D2, 0x20D3, 1}, {0x20D4, 0x20D7, 230}, {0x20D8, 0x20DA, 1},
+  {0x20DB, 0x20DC, 230}, {0x20E1, 0x20E1, 230}, {0x20E5, 0x20E6, 1}, {0x20E7, 0x20E7, 230}, {0x20E8, 0x20E8, 220},
+  {0x20E9, 0x20E9, 230}, {0x20EA, 0x20EB, 1}, {0x20EC, 0x20EF, 220}, {0x20F0, 0x20F0, 230}, {0x2CEF, 0x2CF1, 230},
+  {0x2D7F, 0x2D7F, 9}, {0x2DE0, 0x2DFF, 230}, {0x302A, 0x302A, 218}, {0x302B, 0x302B, 228}, {0x302C, 0x302C, 232},
+  {0x302D, 0x302D, 222}, {0x302E, 0x302F, 224}, {0x3099, 0x309A, 8}, {0xA66F, 0xA66F, 230}, {0xA674, 0xA67D, 230},
+  {0xA69E, 0xA69F, 230}, {0xA6F0, 0xA6F1, 230}, {0xA806, 0xA806, 9}, {0xA82C, 0xA82C, 9}, {0xA8C4, 0xA8C4, 9},
+  {0xA8E0, 0xA8F1, 230}, {0xA92B, 0xA92D, 220}, {0xA953, 0xA953, 9}, {0xA9B3, 0xA9B3, 7}, {0xA9C0, 0xA9C0, 9},
+  {0xAAB0, 0xAAB0, 230}, {0xAAB2, 0xAAB3, 230}, {0xAAB4, 0xAAB4, 220}, {0xAAB7, 0xAAB8, 230}, {0xAABE, 0xAABF, 230},
+  {0xAAC1, 0xAAC1, 230}, {0xAAF6, 0xAAF6, 9}, {0xABED, 0xABED, 9}, {0xFB1E, 0xFB1E, 26}, {0xFE20, 0xFE26, 230},
+  {0xFE27, 0xFE2D, 220}, {0xFE2E, 0xFE2F, 230}, {0x101FD, 0x101FD, 220}, {0x102E0, 0x102E0, 220},
+  {0x10376, 0x1037A, 230}, {0x10A0D, 0x10A0D, 220}, {0x10A0F, 0x10A0F, 230}, {0x10A38, 0x10A38, 230},
+  {0x10A39, 0x10A39, 1}, {0x10A3A, 0x10A3A, 220}, {0x10A3F, 0x10A3F, 9}, {0x10AE5, 0x10AE5, 230},
+  {0x10AE6, 0x10AE6, 220}, {0x10D24, 0x10D27, 230}, {0x10EAB, 0x10EAC, 230}, {0x10EFD, 0x10EFF, 220},
+  {0x10F46, 0x10F47, 220}, {0x10F48, 0x10F4A, 230}, {0x10F4B, 0x10F4B, 220}, {0x10F4C, 0x10F4C, 230},
+  {0x10F4D, 0x10F50, 220}, {0x10F82, 0x10F82, 230}, {0x10F83, 0x10F83, 220}, {0x10F84, 0x10F84, 230},
+  {0x10F85, 0x10F85, 220}, {0x11046, 0x11046, 9}, {0x11070, 0x11070, 9}, {0x1107F, 0x1107F, 9}, {0x110B9, 0x110B9, 9},
+  {0x110BA, 0x110BA, 7}, {0x11100, 0x11102, 230}, {0x11133, 0x11134, 9}, {0x11173, 0x11173, 7}, {0x111C0, 0x111C0, 9},
+  {0x111CA, 0x111CA, 7}, {0x11235, 0x11235, 9}, {0x11236, 0x11236, 7}, {0x112E9, 0x112E9, 7}, {0x112EA, 0x112EA, 9},
+  {0x1133B, 0x1133C, 7}, {0x1134D, 0x1134D, 9}, {0x11366, 0x1136C, 230}, {0x11370, 0x11374, 230},
+  {0x11442, 0x11442, 9}, {0x11446, 0x11446, 7}, {0x1145E, 0x1145E, 230}, {0x114C2, 0x114C2, 9}, {0x114C3, 0x114C3, 7},
+  {0x115BF, 0x115BF, 9}, {0x115C0, 0x115C0, 7}, {0x1163F, 0x1163F, 9}, {0x116B6, 0x116B6, 9}, {0x116B7, 0x116B7, 7},
+  {0x1172B, 0x1172B, 9}, {0x11839, 0x11839, 9}, {0x1183A, 0x1183A, 7}, {0x1193D, 0x1193E, 9}, {0x11943, 0x11943, 7},
+  {0x119E0, 0x119E0, 9}, {0x11A34, 0x11A34, 9}, {0x11A47, 0x11A47, 9}, {0x11A99, 0x11A99, 9}, {0x11C3F, 0x11C3F, 9},
+  {0x11D42, 0x11D42, 7}, {0x11D44, 0x11D45, 9}, {0x11D97, 0x11D97, 9}, {0x11F41, 0x11F42, 9}, {0x16AF0, 0x16AF4, 1},
+  {0x16B30, 0x16B36, 230}, {0x16FF0, 0x16FF1, 6}, {0x1BC9E, 0x1BC9E, 1}, {0x1D165, 0x1D166, 216},
+  {0x1D167, 0x1D169, 1}, {0x1D16D, 0x1D16D, 226}, {0x1D16E, 0x1D172, 216}, {0x1D17B, 0x1D182, 220},
+  {0x1D185, 0x1D189, 230}, {0x1D18A, 0x1D18B, 220}, {0x1D1AA, 0x1D1AD, 230}, {0x1D242, 0x1D244, 230},
+  {0x1E000, 0x1E006, 230}, {0x1E008, 0x1E018, 230}, {0x1E01B, 0x1E021, 230}, {0x1E023, 0x1E024, 230},
+  {0x1E026, 0x1E02A, 230}, {0x1E08F, 0x1E08F, 230}, {0x1E130, 0x1E136, 230}, {0x1E2AE, 0x1E2AE, 230},
+  {0x1E2EC, 0x1E2EF, 230}, {0x1E4EC, 0x1E4ED, 232}, {0x1E4EE, 0x1E4EE, 220}, {0x1E4EF, 0x1E4EF, 230},
+  {0x1E8D0, 0x1E8D6, 220}, {0x1E944, 0x1E949, 230}, {0x1E94A, 0x1E94A, 7},
+};
+
+// General_Category=Mark, value is always 1.
+static const CodePointRange kMarks[] = {
+  {0x300, 0x36F, 1}, {0x483, 0x489, 1}, {0x591, 0x5BD, 1}, {0x5BF, 0x5BF, 1}, {0x5C1, 0x5C2, 1}, {0x5C4, 0x5C5, 1},
+  {0x5C7, 0x5C7, 1}, {0x610, 0x61A, 1}, {0x64B, 0x65F, 1}, {0x670, 0x670, 1}, {0x6D6, 0x6DC, 1}, {0x6DF, 0x6E4, 1},
+  {0x6E7, 0x6E8, 1}, {0x6EA, 0x6ED, 1}, {0x711, 0x711, 1}, {0x730, 0x74A, 1}, {0x7A6, 0x7B0, 1}, {0x7EB, 0x7F3, 1},
+  {0x7FD, 0x7FD, 1}, {0x816, 0x819, 1}, {0x81B, 0x823, 1}, {0x825, 0x827, 1}, {0x829, 0x82D, 1}, {0x859, 0x85B, 1},
+  {0x898, 0x89F, 1}, {0x8CA, 0x8E1, 1}, {0x8E3, 0x903, 1}, {0x93A, 0x93C, 1}, {0x93E, 0x94F, 1}, {0x951, 0x957, 1},
+  {0x962, 0x963, 1}, {0x981, 0x983, 1}, {0x9BC, 0x9BC, 1}, {0x9BE, 0x9C4, 1}, {0x9C7, 0x9C8, 1}, {0x9CB, 0x9CD, 1},
+  {0x9D7, 0x9D7, 1}, {0x9E2, 0x9E3, 1}, {0x9FE, 0x9FE, 1}, {0xA01, 0xA03, 1}, {0xA3C, 0xA3C, 1}, {0xA3E, 0xA42, 1},
+  {0xA47, 0xA48, 1}, {0xA4B, 0xA4D, 1}, {0xA51, 0xA51, 1}, {0xA70, 0xA71, 1}, {0xA75, 0xA75, 1}, {0xA81, 0xA83, 1},
+  {0xABC, 0xABC, 1}, {0xABE, 0xAC5, 1}, {0xAC7, 0xAC9, 1}, {0xACB, 0xACD, 1}, {0xAE2, 0xAE3, 1}, {0xAFA, 0xAFF, 1},
+  {0xB01, 0xB03, 1}, {0xB3C, 0xB3C, 1}, {0xB3E, 0xB44, 1}, {0xB47, 0xB48, 1}, {0xB4B, 0xB4D, 1}, {0xB55, 0xB57, 1},
+  {0xB62, 0xB63, 1}, {0xB82, 0xB82, 1}, {0xBBE, 0xBC2, 1}, {0xBC6, 0xBC8, 1}, {0xBCA, 0xBCD, 1}, {0xBD7, 0xBD7, 1},
+  {0xC00, 0xC04, 1}, {0xC3C, 0xC3C, 1}, {0xC3E, 0xC44, 1}, {0xC46, 0xC48, 1}, {0xC4A, 0xC4D, 1}, {0xC55, 0xC56, 1},
+  {0xC62, 0xC63, 1}, {0xC81, 0xC83, 1}, {0xCBC, 0xCBC, 1}, {0xCBE, 0xCC4, 1}, {0xCC6, 0xCC8, 1}, {0xCCA, 0xCCD, 1},
+  {0xCD5, 0xCD6, 1}, {0xCE2, 0xCE3, 1}, {0xCF3, 0xCF3, 1}, {0xD00, 0xD03, 1}, {0xD3B, 0xD3C, 1}, {0xD3E, 0xD44, 1},
+  {0xD46, 0xD48, 1}, {0xD4A, 0xD4D, 1}, {0xD57, 0xD57, 1}, {0xD62, 0xD63, 1}, {0xD81, 0xD83, 1}, {0xDCA, 0xDCA, 1},
+  {0xDCF, 0xDD4, 1}, {0xDD6, 0xDD6, 1}, {0xDD8, 0xDDF, 1}, {0xDF2, 0xDF3, 1}, {0xE31, 0xE31, 1}, {0xE34, 0xE3A, 1},
+  {0xE47, 0xE4E, 1}, {0xEB1, 0xEB1, 1}, {0xEB4, 0xEBC, 1}, {0xEC8, 0xECE, 1}, {0xF18, 0xF19, 1}, {0xF35, 0xF35, 1},
+  {0xF37, 0xF37, 1}, {0xF39, 0xF39, 1}, {0xF3E, 0xF3F, 1}, {0xF71, 0xF84, 1}, {0xF86, 0xF87, 1}, {0xF8D, 0xF97, 1},
+  {0xF99, 0xFBC, 1}, {0xFC6, 0xFC6, 1}, {0x102B, 0x103E, 1}, {0x1056, 0x1059, 1}, {0x105E, 0x1060, 1},
+  {0x1062, 0x1064, 1}, {0x1067, 0x106D, 1}, {0x1071, 0x1074, 1}, {0x1082, 0x108D, 1}, {0x108F, 0x108F, 1},
+  {0x109A, 0x109D, 1}, {0x135D, 0x135F, 1}, {0x1712, 0x1715, 1}, {0x1732, 0x1734, 1}, {0x1752, 0x1753, 1},
+  {0x1772, 0x1773, 1}, {0x17B4, 0x17D3, 1}, {0x17DD, 0x17DD, 1}, {0x180B, 0x180D, 1}, {0x180F, 0x180F, 1},
+  {0x1885, 0x1886, 1}, {0x18A9, 0x18A9, 1}, {0x1920, 0x192B, 1}, {0x1930, 0x193B, 1}, {0x1A17, 0x1A1B, 1},
+  {0x1A55, 0x1A5E, 1}, {0x1A60, 0x1A7C, 1}, {0x1A7F, 0x1A7F, 1}, {0x1AB0, 0x1ACE, 1}, {0x1B00, 0x1B04, 1},
+  {0x1B34, 0x1B44, 1}, {0x1B6B, 0x1B73, 1}, {0x1B80, 0x1B82, 1}, {0x1BA1, 0x1BAD, 1}, {0x1BE6, 0x1BF3, 1},
+  {0x1C24, 0x1C37, 1}, {0x1CD0, 0x1CD2, 1}, {0x1CD4, 0x1CE8, 1}, {0x1CED, 0x1CED, 1}, {0x1CF4, 0x1CF4, 1},
+  {0x1CF7, 0x1CF9, 1}, {0x1DC0, 0x1DFF, 1}, {0x20D0, 0x20F0, 1}, {0x2CEF, 0x2CF1, 1}, {0x2D7F, 0x2D7F, 1},
+  {0x2DE0, 0x2DFF, 1}, {0x302A, 0x302F, 1}, {0x3099, 0x309A, 1}, {0xA66F, 0xA672, 1}, {0xA674, 0xA67D, 1},
+  {0xA69E, 0xA69F, 1}, {0xA6F0, 0xA6F1, 1}, {0xA802, 0xA802, 1}, {0xA806, 0xA806, 1}, {0xA80B, 0xA80B, 1},
+  {0xA823, 0xA827, 1}, {0xA82C, 0xA82C, 1}, {0xA880, 0xA881, 1}, {0xA8B4, 0xA8C5, 1}, {0xA8E0, 0xA8F1, 1},
+  {0xA8FF, 0xA8FF, 1}, {0xA926, 0xA92D, 1}, {0xA947, 0xA953, 1}, {0xA980, 0xA983, 1}, {0xA9B3, 0xA9C0, 1},
+  {0xA9E5, 0xA9E5, 1}, {0xAA29, 0xAA36, 1}, {0xAA43, 0xAA43, 1}, {0xAA4C, 0xAA4D, 1}, {0xAA7B, 0xAA7D, 1},
+  {0xAAB0, 0xAAB0, 1}, {0xAAB2, 0xAAB4, 1}, {0xAAB7, 0xAAB8, 1}, {0xAABE, 0xAABF, 1}, {0xAAC1, 0xAAC1, 1},
+  {0xAAEB, 0xAAEF, 1}, {0xAAF5, 0xAAF6, 1}, {0xABE3, 0xABEA, 1}, {0xABEC, 0xABED, 1}, {0xFB1E, 0xFB1E, 1},
+  {0xFE00, 0xFE0F, 1}, {0xFE20, 0xFE2F, 1}, {0x101FD, 0x101FD, 1}, {0x102E0, 0x102E0, 1}, {0x10376, 0x1037A, 1},
+  {0x10A01, 0x10A03, 1}, {0x10A05, 0x10A06, 1}, {0x10A0C, 0x10A0F, 1}, {0x10A38, 0x10A3A, 1}, {0x10A3F, 0x10A3F, 1},
+  {0x10AE5, 0x10AE6, 1}, {0x10D24, 0x10D27, 1}, {0x10EAB, 0x10EAC, 1}, {0x10EFD, 0x10EFF, 1}, {0x10F46, 0x10F50, 1},
+  {0x10F82, 0x10F85, 1}, {0x11000, 0x11002, 1}, {0x11038, 0x11046, 1}, {0x11070, 0x11070, 1}, {0x11073, 0x11074, 1},
+  {0x1107F, 0x11082, 1}, {0x110B0, 0x110BA, 1}, {0x110C2, 0x110C2, 1}, {0x11100, 0x11102, 1}, {0x11127, 0x11134, 1},
+  {0x11145, 0x11146, 1}, {0x11173, 0x11173, 1}, {0x11180, 0x11182, 1}, {0x111B3, 0x111C0, 1}, {0x111C9, 0x111CC, 1},
+  {0x111CE, 0x111CF, 1}, {0x1122C, 0x11237, 1}, {0x1123E, 0x1123E, 1}, {0x11241, 0x11241, 1}, {0x112DF, 0x112EA, 1},
+  {0x11300, 0x11303, 1}, {0x1133B, 0x1133C, 1}, {0x1133E, 0x11344, 1}, {0x11347, 0x11348, 1}, {0x1134B, 0x1134D, 1},
+  {0x11357, 0x11357, 1}, {0x11362, 0x11363, 1}, {0x11366, 0x1136C, 1}, {0x11370, 0x11374, 1}, {0x11435, 0x11446, 1},
+  {0x1145E, 0x1145E, 1}, {0x114B0, 0x114C3, 1}, {0x115AF, 0x115B5, 1}, {0x115B8, 0x115C0, 1}, {0x115DC, 0x115DD, 1},
+  {0x11630, 0x11640, 1}, {0x116AB, 0x116B7, 1}, {0x1171D, 0x1172B, 1}, {0x1182C, 0x1183A, 1}, {0x11930, 0x11935, 1},
+  {0x11937, 0x11938, 1}, {0x1193B, 0x1193E, 1}, {0x11940, 0x11940, 1}, {0x11942, 0x11943, 1}, {0x119D1, 0x119D7, 1},
+  {0x119DA, 0x119E0, 1}, {0x119E4, 0x119E4, 1}, {0x11A01, 0x11A0A, 1}, {0x11A33, 0x11A39, 1}, {0x11A3B, 0x11A3E, 1},
+  {0x11A47, 0x11A47, 1}, {0x11A51, 0x11A5B, 1}, {0x11A8A, 0x11A99, 1}, {0x11C2F, 0x11C36, 1}, {0x11C38, 0x11C3F, 1},
+  {0x11C92, 0x11CA7, 1}, {0x11CA9, 0x11CB6, 1}, {0x11D31, 0x11D36, 1}, {0x11D3A, 0x11D3A, 1}, {0x11D3C, 0x11D3D, 1},
+  {0x11D3F, 0x11D45, 1}, {0x11D47, 0x11D47, 1}, {0x11D8A, 0x11D8E, 1}, {0x11D90, 0x11D91, 1}, {0x11D93, 0x11D97, 1},
+  {0x11EF3, 0x11EF6, 1}, {0x11F00, 0x11F01, 1}, {0x11F03, 0x11F03, 1}, {0x11F34, 0x11F3A, 1}, {0x11F3E, 0x11F42, 1},
+  {0x13440, 0x13440, 1}, {0x13447, 0x13455, 1}, {0x16AF0, 0x16AF4, 1}, {0x16B30, 0x16B36, 1}, {0x16F4F, 0x16F4F, 1},
+  {0x16F51, 0x16F87, 1}, {0x16F8F, 0x16F92, 1}, {0x16FE4, 0x16FE4, 1}, {0x16FF0, 0x16FF1, 1}, {0x1BC9D, 0x1BC9E, 1},
+  {0x1CF00, 0x1CF2D, 1}, {0x1CF30, 0x1CF46, 1}, {0x1D165, 0x1D169, 1}, {0x1D16D, 0x1D172, 1}, {0x1D17B, 0x1D182, 1},
+  {0x1D185, 0x1D18B, 1}, {0x1D1AA, 0x1D1AD, 1}, {0x1D242, 0x1D244, 1}, {0x1DA00, 0x1DA36, 1}, {0x1DA3B, 0x1DA6C, 1},
+  {0x1DA75, 0x1DA75, 1}, {0x1DA84, 0x1DA84, 1}, {0x1DA9B, 0x1DA9F, 1}, {0x1DAA1, 0x1DAAF, 1}, {0x1E000, 0x1E006, 1},
+  {0x1E008, 0x1E018, 1}, {0x1E01B, 0x1E021, 1}, {0x1E023, 0x1E024, 1}, {0x1E026, 0x1E02A, 1}, {0x1E08F, 0x1E08F, 1},
+  {0x1E130, 0x1E136, 1}, {0x1E2AE, 0x1E2AE, 1}, {0x1E2EC, 0x1E2EF, 1}, {0x1E4EC, 0x1E4EF, 1}, {0x1E8D0, 0x1E8D6, 1},
+  {0x1E944, 0x1E94A, 1}, {0xE0100, 0xE01EF, 1},
+};
+
+// Code points which are not listed are of class L.
+static const CodePointRange kBidiClasses[] = {
+  {0x0, 0x8, kBidiBN}, {0x9, 0xD, kBidiOther}, {0xE, 0x1B, kBidiBN}, {0x1C, 0x20, kBidiOther}, {0x21, 0x22, kBidiON},
+  {0x23, 0x25, kBidiET}, {0x26, 0x2A, kBidiON}, {0x2B, 0x2B, kBidiES}, {0x2C, 0x2C, kBidiCS}, {0x2D, 0x2D, kBidiES},
+  {0x2E, 0x2F, kBidiCS}, {0x30, 0x39, kBidiEN}, {0x3A, 0x3A, kBidiCS}, {0x3B, 0x40, kBidiON}, {0x5B, 0x60, kBidiON},
+  {0x7B, 0x7E, kBidiON}, {0x7F, 0x84, kBidiBN}, {0x85, 0x85, kBidiOther}, {0x86, 0x9F, kBidiBN}, {0xA0, 0xA0, kBidiCS},
+  {0xA1, 0xA1, kBidiON}, {0xA2, 0xA5, kBidiET}, {0xA6, 0xA9, kBidiON}, {0xAB, 0xAC, kBidiON}, {0xAD, 0xAD, kBidiBN},
+  {0xAE, 0xAF, kBidiON}, {0xB0, 0xB1, kBidiET}, {0xB2, 0xB3, kBidiEN}, {0xB4, 0xB4, kBidiON}, {0xB6, 0xB8, kBidiON},
+  {0xB9, 0xB9, kBidiEN}, {0xBB, 0xBF, kBidiON}, {0xD7, 0xD7, kBidiON}, {0xF7, 0xF7, kBidiON}, {0x2B9, 0x2BA, kBidiON},
+  {0x2C2, 0x2CF, kBidiON}, {0x2D2, 0x2DF, kBidiON}, {0x2E5, 0x2ED, kBidiON}, {0x2EF, 0x2FF, kBidiON},
+  {0x300, 0x36F, kBidiNSM}, {0x374, 0x375, kBidiON}, {0x37E, 0x37E, kBidiON}, {0x384, 0x385, kBidiON},
+  {0x387, 0x387, kBidiON}, {0x3F6, 0x3F6, kBidiON}, {0x483, 0x489, kBidiNSM}, {0x58A, 0x58A, kBidiON},
+  {0x58D, 0x58E, kBidiON}, {0x58F, 0x58F, kBidiET}, {0x591, 0x5BD, kBidiNSM}, {0x5BE, 0x5BE, kBidiR},
+  {0x5BF, 0x5BF, kBidiNSM}, {0x5C0, 0x5C0, kBidiR}, {0x5C1, 0x5C2, kBidiNSM}, {0x5C3, 0x5C3, kBidiR},
+  {0x5C4, 0x5C5, kBidiNSM}, {0x5C6, 0x5C6, kBidiR}, {0x5C7, 0x5C7, kBidiNSM}, {0x5D0, 0x5EA, kBidiR},
+  {0x5EF, 0x5F4, kBidiR}, {0x600, 0x605, kBidiAN}, {0x606, 0x607, kBidiON}, {0x608, 0x608, kBidiAL},
+  {0x609, 0x60A, kBidiET}, {0x60B, 0x60B, kBidiAL}, {0x60C, 0x60C, kBidiCS}, {0x60D, 0x60D, kBidiAL},
+  {0x60E, 0x60F, kBidiON}, {0x610, 0x61A, kBidiNSM}, {0x61B, 0x64A, kBidiAL}, {0x64B, 0x65F, kBidiNSM},
+  {0x660, 0x669, kBidiAN}, {0x66A, 0x66A, kBidiET}, {0x66B, 0x66C, kBidiAN}, {0x66D, 0x66F, kBidiAL},
+  {0x670, 0x670, kBidiNSM}, {0x671, 0x6D5, kBidiAL}, {0x6D6, 0x6DC, kBidiNSM}, {0x6DD, 0x6DD, kBidiAN},
+  {0x6DE, 0x6DE, kBidiON}, {0x6DF, 0x6E4, kBidiNSM}, {0x6E5, 0x6E6, kBidiAL}, {0x6E7, 0x6E8, kBidiNSM},
+  {0x6E9, 0x6E9, kBidiON}, {0x6EA, 0x6ED, kBidiNSM}, {0x6EE, 0x6EF, kBidiAL}, {0x6F0, 0x6F9, kBidiEN},
+  {0x6FA, 0x70D, kBidiAL}, {0x70F, 0x710, kBidiAL}, {0x711, 0x711, kBidiNSM}, {0x712, 0x72F, kBidiAL},
+  {0x730, 0x74A, kBidiNSM}, {0x74D, 0x7A5, kBidiAL}, {0x7A6, 0x7B0, kBidiNSM}, {0x7B1, 0x7B1, kBidiAL},
+  {0x7C0, 0x7EA, kBidiR}, {0x7EB, 0x7F3, kBidiNSM}, {0x7F4, 0x7F5, kBidiR}, {0x7F6, 0x7F9, kBidiON},
+  {0x7FA, 0x7FA, kBidiR}, {0x7FD, 0x7FD, kBidiNSM}, {0x7FE, 0x815, kBidiR}, {0x816, 0x819, kBidiNSM},
+  {0x81A, 0x81A, kBidiR}, {0x81B, 0x823, kBidiNSM}, {0x824, 0x824, kBidiR}, {0x825, 0x827, kBidiNSM},
+  {0x828, 0x828, kBidiR}, {0x829, 0x82D, kBidiNSM}, {0x830, 0x83E, kBidiR}, {0x840, 0x858, kBidiR},
+  {0x859, 0x85B, kBidiNSM}, {0x85E, 0x85E, kBidiR}, {0x860, 0x86A, kBidiAL}, {0x870, 0x88E, kBidiAL},
+  {0x890, 0x891, kBidiAN}, {0x898, 0x89F, kBidiNSM}, {0x8A0, 0x8C9, kBidiAL}, {0x8CA, 0x8E1, kBidiNSM},
+  {0x8E2, 0x8E2, kBidiAN}, {0x8E3, 0x902, kBidiNSM}, {0x93A, 0x93A, kBidiNSM}, {0x93C, 0x93C, kBidiNSM},
+  {0x941, 0x948, kBidiNSM}, {0x94D, 0x94D, kBidiNSM}, {0x951, 0x957, kBidiNSM}, {0x962, 0x963, kBidiNSM},
+  {0x981, 0x981, kBidiNSM}, {0x9BC, 0x9BC, kBidiNSM}, {0x9C1, 0x9C4, kBidiNSM}, {0x9CD, 0x9CD, kBidiNSM},
+  {0x9E2, 0x9E3, kBidiNSM}, {0x9F2, 0x9F3, kBidiET}, {0x9FB, 0x9FB, kBidiET}, {0x9FE, 0x9FE, kBidiNSM},
+  {0xA01, 0xA02, kBidiNSM}, {0xA3C, 0xA3C, kBidiNSM}, {0xA41, 0xA42, kBidiNSM}, {0xA47, 0xA48, kBidiNSM},
+  {0xA4B, 0xA4D, kBidiNSM}, {0xA51, 0xA51, kBidiNSM}, {0xA70, 0xA71, kBidiNSM}, {0xA75, 0xA75, kBidiNSM},
+  {0xA81, 0xA82, kBidiNSM}, {0xABC, 0xABC, kBidiNSM}, {0xAC1, 0xAC5, kBidiNSM}, {0xAC7, 0xAC8, kBidiNSM},
+  {0xACD, 0xACD, kBidiNSM}, {0xAE2, 0xAE3, kBidiNSM}, {0xAF1, 0xAF1, kBidiET}, {0xAFA, 0xAFF, kBidiNSM},
+  {0xB01, 0xB01, kBidiNSM}, {0xB3C, 0xB3C, kBidiNSM}, {0xB3F, 0xB3F, kBidiNSM}, {0xB41, 0xB44, kBidiNSM},
+  {0xB4D, 0xB4D, kBidiNSM}, {0xB55, 0xB56, kBidiNSM}, {0xB62, 0xB63, kBidiNSM}, {0xB82, 0xB82, kBidiNSM},
+  {0xBC0, 0xBC0, kBidiNSM}, {0xBCD, 0xBCD, kBidiNSM}, {0xBF3, 0xBF8, kBidiON}, {0xBF9, 0xBF9, kBidiET},
+  {0xBFA, 0xBFA, kBidiON}, {0xC00, 0xC00, kBidiNSM}, {0xC04, 0xC04, kBidiNSM}, {0xC3C, 0xC3C, kBidiNSM},
+  {0xC3E, 0xC40, kBidiNSM}, {0xC46, 0xC48, kBidiNSM}, {0xC4A, 0xC4D, kBidiNSM}, {0xC55, 0xC56, kBidiNSM},
+  {0xC62, 0xC63, kBidiNSM}, {0xC78, 0xC7E, kBidiON}, {0xC81, 0xC81, kBidiNSM}, {0xCBC, 0xCBC, kBidiNSM},
+  {0xCCC, 0xCCD, kBidiNSM}, {0xCE2, 0xCE3, kBidiNSM}, {0xD00, 0xD01, kBidiNSM}, {0xD3B, 0xD3C, kBidiNSM},
+  {0xD41, 0xD44, kBidiNSM}, {0xD4D, 0xD4D, kBidiNSM}, {0xD62, 0xD63, kBidiNSM}, {0xD81, 0xD81, kBidiNSM},
+  {0xDCA, 0xDCA, kBidiNSM}, {0xDD2, 0xDD4, kBidiNSM}, {0xDD6, 0xDD6, kBidiNSM}, {0xE31, 0xE31, kBidiNSM},
+  {0xE34, 0xE3A, kBidiNSM}, {0xE3F, 0xE3F, kBidiET}, {0xE47, 0xE4E, kBidiNSM}, {0xEB1, 0xEB1, kBidiNSM},
+  {0xEB4, 0xEBC, kBidiNSM}, {0xEC8, 0xECE, kBidiNSM}, {0xF18, 0xF19, kBidiNSM}, {0xF35, 0xF35, kBidiNSM},
+  {0xF37, 0xF37, kBidiNSM}, {0xF39, 0xF39, kBidiNSM}, {0xF3A, 0xF3D, kBidiON}, {0xF71, 0xF7E, kBidiNSM},
+  {0xF80, 0xF84, kBidiNSM}, {0xF86, 0xF87, kBidiNSM}, {0xF8D, 0xF97, kBidiNSM}, {0xF99, 0xFBC, kBidiNSM},
+  {0xFC6, 0xFC6, kBidiNSM}, {0x102D, 0x1030, kBidiNSM}, {0x1032, 0x1037, kBidiNSM}, {0x1039, 0x103A, kBidiNSM},
+  {0x103D, 0x103E, kBidiNSM}, {0x1058, 0x1059, kBidiNSM}, {0x105E, 0x1060, kBidiNSM}, {0x1071, 0x1074, kBidiNSM},
+  {0x1082, 0x1082, kBidiNSM}, {0x1085, 0x1086, kBidiNSM}, {0x108D, 0x108D, kBidiNSM}, {0x109D, 0x109D, kBidiNSM},
+  {0x135D, 0x135F, kBidiNSM}, {0x1390, 0x1399, kBidiON}, {0x1400, 0x1400, kBidiON}, {0x1680, 0x1680, kBidiOther},
+  {0x169B, 0x169C, kBidiON}, {0x1712, 0x1714, kBidiNSM}, {0x1732, 0x1733, kBidiNSM}, {0x1752, 0x1753, kBidiNSM},
+  {0x1772, 0x1773, kBidiNSM}, {0x17B4, 0x17B5, kBidiNSM}, {0x17B7, 0x17BD, kBidiNSM}, {0x17C6, 0x17C6, kBidiNSM},
+  {0x17C9, 0x17D3, kBidiNSM}, {0x17DB, 0x17DB, kBidiET}, {0x17DD, 0x17DD, kBidiNSM}, {0x17F0, 0x17F9, kBidiON},
+  {0x1800, 0x180A, kBidiON}, {0x180B, 0x180D, kBidiNSM}, {0x180E, 0x180E, kBidiBN}, {0x180F, 0x180F, kBidiNSM},
+  {0x1885, 0x1886, kBidiNSM}, {0x18A9, 0x18A9, kBidiNSM}, {0x1920, 0x1922, kBidiNSM}, {0x1927, 0x1928, kBidiNSM},
+  {0x1932, 0x1932, kBidiNSM}, {0x1939, 0x193B, kBidiNSM}, {0x1940, 0x1940, kBidiON}, {0x1944, 0x1945, kBidiON},
+  {0x19DE, 0x19FF, kBidiON}, {0x1A17, 0x1A18, kBidiNSM}, {0x1A1B, 0x1A1B, kBidiNSM}, {0x1A56, 0x1A56, kBidiNSM},
+  {0x1A58, 0x1A5E, kBidiNSM}, {0x1A60, 0x1A60, kBidiNSM}, {0x1A62, 0x1A62, kBidiNSM}, {0x1A65, 0x1A6C, kBidiNSM},
+  {0x1A73, 0x1A7C, kBidiNSM}, {0x1A7F, 0x1A7F, kBidiNSM}, {0x1AB0, 0x1ACE, kBidiNSM}, {0x1B00, 0x1B03, kBidiNSM},
+  {0x1B34, 0x1B34, kBidiNSM}, {0x1B36, 0x1B3A, kBidiNSM}, {0x1B3C, 0x1B3C, kBidiNSM}, {0x1B42, 0x1B42, kBidiNSM},
+  {0x1B6B, 0x1B73, kBidiNSM}, {0x1B80, 0x1B81, kBidiNSM}, {0x1BA2, 0x1BA5, kBidiNSM}, {0x1BA8, 0x1BA9, kBidiNSM},
+  {0x1BAB, 0x1BAD, kBidiNSM}, {0x1BE6, 0x1BE6, kBidiNSM}, {0x1BE8, 0x1BE9, kBidiNSM}, {0x1BED, 0x1BED, kBidiNSM},
+  {0x1BEF, 0x1BF1, kBidiNSM}, {0x1C2C, 0x1C33, kBidiNSM}, {0x1C36, 0x1C37, kBidiNSM}, {0x1CD0, 0x1CD2, kBidiNSM},
+  {0x1CD4, 0x1CE0, kBidiNSM}, {0x1CE2, 0x1CE8, kBidiNSM}, {0x1CED, 0x1CED, kBidiNSM}, {0x1CF4, 0x1CF4, kBidiNSM},
+  {0x1CF8, 0x1CF9, kBidiNSM}, {0x1DC0, 0x1DFF, kBidiNSM}, {0x1FBD, 0x1FBD, kBidiON}, {0x1FBF, 0x1FC1, kBidiON},
+  {0x1FCD, 0x1FCF, kBidiON}, {0x1FDD, 0x1FDF, kBidiON}, {0x1FED, 0x1FEF, kBidiON}, {0x1FFD, 0x1FFE, kBidiON},
+  {0x2000, 0x200A, kBidiOther}, {0x200B, 0x200D, kBidiBN}, {0x200F, 0x200F, kBidiR}, {0x2010, 0x2027, kBidiON},
+  {0x2028, 0x202E, kBidiOther}, {0x202F, 0x202F, kBidiCS}, {0x2030, 0x2034, kBidiET}, {0x2035, 0x2043, kBidiON},
+  {0x2044, 0x2044, kBidiCS}, {0x2045, 0x205E, kBidiON}, {0x205F, 0x205F, kBidiOther}, {0x2060, 0x2064, kBidiBN},
+  {0x2066, 0x2069, kBidiOther}, {0x206A, 0x206F, kBidiBN}, {0x2070, 0x2070, kBidiEN}, {0x2074, 0x2079, kBidiEN},
+  {0x207A, 0x207B, kBidiES}, {0x207C, 0x207E, kBidiON}, {0x2080, 0x2089, kBidiEN}, {0x208A, 0x208B, kBidiES},
+  {0x208C, 0x208E, kBidiON}, {0x20A0, 0x20C0, kBidiET}, {0x20D0, 0x20F0, kBidiNSM}, {0x2100, 0x2101, kBidiON},
+  {0x2103, 0x2106, kBidiON}, {0x2108, 0x2109, kBidiON}, {0x2114, 0x2114, kBidiON}, {0x2116, 0x2118, kBidiON},
+  {0x211E, 0x2123, kBidiON}, {0x2125, 0x2125, kBidiON}, {0x2127, 0x2127, kBidiON}, {0x2129, 0x2129, kBidiON},
+  {0x212E, 0x212E, kBidiET}, {0x213A, 0x213B, kBidiON}, {0x2140, 0x2144, kBidiON}, {0x214A, 0x214D, kBidiON},
+  {0x2150, 0x215F, kBidiON}, {0x2189, 0x218B, kBidiON}, {0x2190, 0x2211, kBidiON}, {0x2212, 0x2212, kBidiES},
+  {0x2213, 0x2213, kBidiET}, {0x2214, 0x2335, kBidiON}, {0x237B, 0x2394, kBidiON}, {0x2396, 0x2426, kBidiON},
+  {0x2440, 0x244A, kBidiON}, {0x2460, 0x2487, kBidiON}, {0x2488, 0x249B, kBidiEN}, {0x24EA, 0x26AB, kBidiON},
+  {0x26AD, 0x27FF, kBidiON}, {0x2900, 0x2B73, kBidiON}, {0x2B76, 0x2B95, kBidiON}, {0x2B97, 0x2BFF, kBidiON},
+  {0x2CE5, 0x2CEA, kBidiON}, {0x2CEF, 0x2CF1, kBidiNSM}, {0x2CF9, 0x2CFF, kBidiON}, {0x2D7F, 0x2D7F, kBidiNSM},
+  {0x2DE0, 0x2DFF, kBidiNSM}, {0x2E00, 0x2E5D, kBidiON}, {0x2E80, 0x2E99, kBidiON}, {0x2E9B, 0x2EF3, kBidiON},
+  {0x2F00, 0x2FD5, kBidiON}, {0x2FF0, 0x2FFF, kBidiON}, {0x3000, 0x3000, kBidiOther}, {0x3001, 0x3004, kBidiON},
+  {0x3008, 0x3020, kBidiON}, {0x302A, 0x302D, kBidiNSM}, {0x3030, 0x3030, kBidiON}, {0x3036, 0x3037, kBidiON},
+  {0x303D, 0x303F, kBidiON}, {0x3099, 0x309A, kBidiNSM}, {0x309B, 0x309C, kBidiON}, {0x30A0, 0x30A0, kBidiON},
+  {0x30FB, 0x30FB, kBidiON}, {0x31C0, 0x31E3, kBidiON}, {0x31EF, 0x31EF, kBidiON}, {0x321D, 0x321E, kBidiON},
+  {0x3250, 0x325F, kBidiON}, {0x327C, 0x327E, kBidiON}, {0x32B1, 0x32BF, kBidiON}, {0x32CC, 0x32CF, kBidiON},
+  {0x3377, 0x337A, kBidiON}, {0x33DE, 0x33DF, kBidiON}, {0x33FF, 0x33FF, kBidiON}, {0x4DC0, 0x4DFF, kBidiON},
+  {0xA490, 0xA4C6, kBidiON}, {0xA60D, 0xA60F, kBidiON}, {0xA66F, 0xA672, kBidiNSM}, {0xA673, 0xA673, kBidiON},
+  {0xA674, 0xA67D, kBidiNSM}, {0xA67E, 0xA67F, kBidiON}, {0xA69E, 0xA69F, kBidiNSM}, {0xA6F0, 0xA6F1, kBidiNSM},
+  {0xA700, 0xA721, kBidiON}, {0xA788, 0xA788, kBidiON}, {0xA802, 0xA802, kBidiNSM}, {0xA806, 0xA806, kBidiNSM},
+  {0xA80B, 0xA80B, kBidiNSM}, {0xA825, 0xA826, kBidiNSM}, {0xA828, 0xA82B, kBidiON}, {0xA82C, 0xA82C, kBidiNSM},
+  {0xA838, 0xA839, kBidiET}, {0xA874, 0xA877, kBidiON}, {0xA8C4, 0xA8C5, kBidiNSM}, {0xA8E0, 0xA8F1, kBidiNSM},
+  {0xA8FF, 0xA8FF, kBidiNSM}, {0xA926, 0xA92D, kBidiNSM}, {0xA947, 0xA951, kBidiNSM}, {0xA980, 0xA982, kBidiNSM},
+  {0xA9B3, 0xA9B3, kBidiNSM}, {0xA9B6, 0xA9B9, kBidiNSM}, {0xA9BC, 0xA9BD, kBidiNSM}, {0xA9E5, 0xA9E5, kBidiNSM},
+  {0xAA29, 0xAA2E, kBidiNSM}, {0xAA31, 0xAA32, kBidiNSM}, {0xAA35, 0xAA36, kBidiNSM}, {0xAA43, 0xAA43, kBidiNSM},
+  {0xAA4C, 0xAA4C, kBidiNSM}, {0xAA7C, 0xAA7C, kBidiNSM}, {0xAAB0, 0xAAB0, kBidiNSM}, {0xAAB2, 0xAAB4, kBidiNSM},
+  {0xAAB7, 0xAAB8, kBidiNSM}, {0xAABE, 0xAABF, kBidiNSM}, {0xAAC1, 0xAAC1, kBidiNSM}, {0xAAEC, 0xAAED, kBidiNSM},
+  {0xAAF6, 0xAAF6, kBidiNSM}, {0xAB6A, 0xAB6B, kBidiON}, {0xABE5, 0xABE5, kBidiNSM}, {0xABE8, 0xABE8, kBidiNSM},
+  {0xABED, 0xABED, kBidiNSM}, {0xFB1D, 0xFB1D, kBidiR}, {0xFB1E, 0xFB1E, kBidiNSM}, {0xFB1F, 0xFB28, kBidiR},
+  {0xFB29, 0xFB29, kBidiES}, {0xFB2A, 0xFB36, kBidiR}, {0xFB38, 0xFB3C, kBidiR}, {0xFB3E, 0xFB3E, kBidiR},
+  {0xFB40, 0xFB41, kBidiR}, {0xFB43, 0xFB44, kBidiR}, {0xFB46, 0xFB4F, kBidiR}, {0xFB50, 0xFBC2, kBidiAL},
+  {0xFBD3, 0xFD3D, kBidiAL}, {0xFD3E, 0xFD4F, kBidiON}, {0xFD50, 0xFD8F, kBidiAL}, {0xFD92, 0xFDC7, kBidiAL},
+  {0xFDCF, 0xFDCF, kBidiON}, {0xFDF0, 0xFDFC, kBidiAL}, {0xFDFD, 0xFDFF, kBidiON}, {0xFE00, 0xFE0F, kBidiNSM},
+  {0xFE10, 0xFE19, kBidiON}, {0xFE20, 0xFE2F, kBidiNSM}, {0xFE30, 0xFE4F, kBidiON}, {0xFE50, 0xFE50, kBidiCS},
+  {0xFE51, 0xFE51, kBidiON}, {0xFE52, 0xFE52, kBidiCS}, {0xFE54, 0xFE54, kBidiON}, {0xFE55, 0xFE55, kBidiCS},
+  {0xFE56, 0xFE5E, kBidiON}, {0xFE5F, 0xFE5F, kBidiET}, {0xFE60, 0xFE61, kBidiON}, {0xFE62, 0xFE63, kBidiES},
+  {0xFE64, 0xFE66, kBidiON}, {0xFE68, 0xFE68, kBidiON}, {0xFE69, 0xFE6A, kBidiET}, {0xFE6B, 0xFE6B, kBidiON},
+  {0xFE70, 0xFE74, kBidiAL}, {0xFE76, 0xFEFC, kBidiAL}, {0xFEFF, 0xFEFF, kBidiBN}, {0xFF01, 0xFF02, kBidiON},
+  {0xFF03, 0xFF05, kBidiET}, {0xFF06, 0xFF0A, kBidiON}, {0xFF0B, 0xFF0B, kBidiES}, {0xFF0C, 0xFF0C, kBidiCS},
+  {0xFF0D, 0xFF0D, kBidiES}, {0xFF0E, 0xFF0F, kBidiCS}, {0xFF10, 0xFF19, kBidiEN}, {0xFF1A, 0xFF1A, kBidiCS},
+  {0xFF1B, 0xFF20, kBidiON}, {0xFF3B, 0xFF40, kBidiON}, {0xFF5B, 0xFF65, kBidiON}, {0xFFE0, 0xFFE1, kBidiET},
+  {0xFFE2, 0xFFE4, kBidiON}, {0xFFE5, 0xFFE6, kBidiET}, {0xFFE8, 0xFFEE, kBidiON}, {0xFFF9, 0xFFFD, kBidiON},
+  {0x10101, 0x10101, kBidiON}, {0x10140, 0x1018C, kBidiON}, {0x10190, 0x1019C, kBidiON}, {0x101A0, 0x101A0, kBidiON},
+  {0x101FD, 0x101FD, kBidiNSM}, {0x102E0, 0x102E0, kBidiNSM}, {0x102E1, 0x102FB, kBidiEN},
+  {0x10376, 0x1037A, kBidiNSM}, {0x10800, 0x10805, kBidiR}, {0x10808, 0x10808, kBidiR}, {0x1080A, 0x10835, kBidiR},
+  {0x10837, 0x10838, kBidiR}, {0x1083C, 0x1083C, kBidiR}, {0x1083F, 0x10855, kBidiR}, {0x10857, 0x1089E, kBidiR},
+  {0x108A7, 0x108AF, kBidiR}, {0x108E0, 0x108F2, kBidiR}, {0x108F4, 0x108F5, kBidiR}, {0x108FB, 0x1091B, kBidiR},
+  {0x1091F, 0x1091F, kBidiON}, {0x10920, 0x10939, kBidiR}, {0x1093F, 0x1093F, kBidiR}, {0x10980, 0x109B7, kBidiR},
+  {0x109BC, 0x109CF, kBidiR}, {0x109D2, 0x10A00, kBidiR}, {0x10A01, 0x10A03, kBidiNSM}, {0x10A05, 0x10A06, kBidiNSM},
+  {0x10A0C, 0x10A0F, kBidiNSM}, {0x10A10, 0x10A13, kBidiR}, {0x10A15, 0x10A17, kBidiR}, {0x10A19, 0x10A35, kBidiR},
+  {0x10A38, 0x10A3A, kBidiNSM}, {0x10A3F, 0x10A3F, kBidiNSM}, {0x10A40, 0x10A48, kBidiR}, {0x10A50, 0x10A58, kBidiR},
+  {0x10A60, 0x10A9F, kBidiR}, {0x10AC0, 0x10AE4, kBidiR}, {0x10AE5, 0x10AE6, kBidiNSM}, {0x10AEB, 0x10AF6, kBidiR},
+  {0x10B00, 0x10B35, kBidiR}, {0x10B39, 0x10B3F, kBidiON}, {0x10B40, 0x10B55, kBidiR}, {0x10B58, 0x10B72, kBidiR},
+  {0x10B78, 0x10B91, kBidiR}, {0x10B99, 0x10B9C, kBidiR}, {0x10BA9, 0x10BAF, kBidiR}, {0x10C00, 0x10C48, kBidiR},
+  {0x10C80, 0x10CB2, kBidiR}, {0x10CC0, 0x10CF2, kBidiR}, {0x10CFA, 0x10CFF, kBidiR}, {0x10D00, 0x10D23, kBidiAL},
+  {0x10D24, 0x10D27, kBidiNSM}, {0x10D30, 0x10D39, kBidiAN}, {0x10E60, 0x10E7E, kBidiAN}, {0x10E80, 0x10EA9, kBidiR},
+  {0x10EAB, 0x10EAC, kBidiNSM}, {0x10EAD, 0x10EAD, kBidiR}, {0x10EB0, 0x10EB1, kBidiR}, {0x10EFD, 0x10EFF, kBidiNSM},
+  {0x10F00, 0x10F27, kBidiR}, {0x10F30, 0x10F45, kBidiAL}, {0x10F46, 0x10F50, kBidiNSM}, {0x10F51, 0x10F59, kBidiAL},
+  {0x10F70, 0x10F81, kBidiR}, {0x10F82, 0x10F85, kBidiNSM}, {0x10F86, 0x10F89, kBidiR}, {0x10FB0, 0x10FCB, kBidiR},
+  {0x10FE0, 0x10FF6, kBidiR}, {0x11001, 0x11001, kBidiNSM}, {0x11038, 0x11046, kBidiNSM}, {0x11052, 0x11065, kBidiON},
+  {0x11070, 0x11070, kBidiNSM}, {0x11073, 0x11074, kBidiNSM}, {0x1107F, 0x11081, kBidiNSM},
+  {0x110B3, 0x110B6, kBidiNSM}, {0x110B9, 0x110BA, kBidiNSM}, {0x110C2, 0x110C2, kBidiNSM},
+  {0x11100, 0x11102, kBidiNSM}, {0x11127, 0x1112B, kBidiNSM}, {0x1112D, 0x11134, kBidiNSM},
+  {0x11173, 0x11173, kBidiNSM}, {0x11180, 0x11181, kBidiNSM}, {0x111B6, 0x111BE, kBidiNSM},
+  {0x111C9, 0x111CC, kBidiNSM}, {0x111CF, 0x111CF, kBidiNSM}, {0x1122F, 0x11231, kBidiNSM},
+  {0x11234, 0x11234, kBidiNSM}, {0x11236, 0x11237, kBidiNSM}, {0x1123E, 0x1123E, kBidiNSM},
+  {0x11241, 0x11241, kBidiNSM}, {0x112DF, 0x112DF, kBidiNSM}, {0x112E3, 0x112EA, kBidiNSM},
+  {0x11300, 0x11301, kBidiNSM}, {0x1133B, 0x1133C, kBidiNSM}, {0x11340, 0x11340, kBidiNSM},
+  {0x11366, 0x1136C, kBidiNSM}, {0x11370, 0x11374, kBidiNSM}, {0x11438, 0x1143F, kBidiNSM},
+  {0x11442, 0x11444, kBidiNSM}, {0x11446, 0x11446, kBidiNSM}, {0x1145E, 0x1145E, kBidiNSM},
+  {0x114B3, 0x114B8, kBidiNSM}, {0x114BA, 0x114BA, kBidiNSM}, {0x114BF, 0x114C0, kBidiNSM},
+  {0x114C2, 0x114C3, kBidiNSM}, {0x115B2, 0x115B5, kBidiNSM}, {0x115BC, 0x115BD, kBidiNSM},
+  {0x115BF, 0x115C0, kBidiNSM}, {0x115DC, 0x115DD, kBidiNSM}, {0x11633, 0x1163A, kBidiNSM},
+  {0x1163D, 0x1163D, kBidiNSM}, {0x1163F, 0x11640, kBidiNSM}, {0x11660, 0x1166C, kBidiON},
+  {0x116AB, 0x116AB, kBidiNSM}, {0x116AD, 0x116AD, kBidiNSM}, {0x116B0, 0x116B5, kBidiNSM},
+  {0x116B7, 0x116B7, kBidiNSM}, {0x1171D, 0x1171F, kBidiNSM}, {0x11722, 0x11725, kBidiNSM},
+  {0x11727, 0x1172B, kBidiNSM}, {0x1182F, 0x11837, kBidiNSM}, {0x11839, 0x1183A, kBidiNSM},
+  {0x1193B, 0x1193C, kBidiNSM}, {0x1193E, 0x1193E, kBidiNSM}, {0x11943, 0x11943, kBidiNSM},
+  {0x119D4, 0x119D7, kBidiNSM}, {0x119DA, 0x119DB, kBidiNSM}, {0x119E0, 0x119E0, kBidiNSM},
+  {0x11A01, 0x11A06, kBidiNSM}, {0x11A09, 0x11A0A, kBidiNSM}, {0x11A33, 0x11A38, kBidiNSM},
+  {0x11A3B, 0x11A3E, kBidiNSM}, {0x11A47, 0x11A47, kBidiNSM}, {0x11A51, 0x11A56, kBidiNSM},
+  {0x11A59, 0x11A5B, kBidiNSM}, {0x11A8A, 0x11A96, kBidiNSM}, {0x11A98, 0x11A99, kBidiNSM},
+  {0x11C30, 0x11C36, kBidiNSM}, {0x11C38, 0x11C3D, kBidiNSM}, {0x11C92, 0x11CA7, kBidiNSM},
+  {0x11CAA, 0x11CB0, kBidiNSM}, {0x11CB2, 0x11CB3, kBidiNSM}, {0x11CB5, 0x11CB6, kBidiNSM},
+  {0x11D31, 0x11D36, kBidiNSM}, {0x11D3A, 0x11D3A, kBidiNSM}, {0x11D3C, 0x11D3D, kBidiNSM},
+  {0x11D3F, 0x11D45, kBidiNSM}, {0x11D47, 0x11D47, kBidiNSM}, {0x11D90, 0x11D91, kBidiNSM},
+  {0x11D95, 0x11D95, kBidiNSM}, {0x11D97, 0x11D97, kBidiNSM}, {0x11EF3, 0x11EF4, kBidiNSM},
+  {0x11F00, 0x11F01, kBidiNSM}, {0x11F36, 0x11F3A, kBidiNSM}, {0x11F40, 0x11F40, kBidiNSM},
+  {0x11F42, 0x11F42, kBidiNSM}, {0x11FD5, 0x11FDC, kBidiON}, {0x11FDD, 0x11FE0, kBidiET}, {0x11FE1, 0x11FF1, kBidiON},
+  {0x13440, 0x13440, kBidiNSM}, {0x13447, 0x13455, kBidiNSM}, {0x16AF0, 0x16AF4, kBidiNSM},
+  {0x16B30, 0x16B36, kBidiNSM}, {0x16F4F, 0x16F4F, kBidiNSM}, {0x16F8F, 0x16F92, kBidiNSM},
+  {0x16FE2, 0x16FE2, kBidiON}, {0x16FE4, 0x16FE4, kBidiNSM}, {0x1BC9D, 0x1BC9E, kBidiNSM}, {0x1BCA0, 0x1BCA3, kBidiBN},
+  {0x1CF00, 0x1CF2D, kBidiNSM}, {0x1CF30, 0x1CF46, kBidiNSM}, {0x1D167, 0x1D169, kBidiNSM},
+  {0x1D173, 0x1D17A, kBidiBN}, {0x1D17B, 0x1D182, kBidiNSM}, {0x1D185, 0x1D18B, kBidiNSM},
+  {0x1D1AA, 0x1D1AD, kBidiNSM}, {0x1D1E9, 0x1D1EA, kBidiON}, {0x1D200, 0x1D241, kBidiON}, {0x1D242, 0x1D244, kBidiNSM},
+  {0x1D245, 0x1D245, kBidiON}, {0x1D300, 0x1D356, kBidiON}, {0x1D6DB, 0x1D6DB, kBidiON}, {0x1D715, 0x1D715, kBidiON},
+  {0x1D74F, 0x1D74F, kBidiON}, {0x1D789, 0x1D789, kBidiON}, {0x1D7C3, 0x1D7C3, kBidiON}, {0x1D7CE, 0x1D7FF, kBidiEN},
+  {0x1DA00, 0x1DA36, kBidiNSM}, {0x1DA3B, 0x1DA6C, kBidiNSM}, {0x1DA75, 0x1DA75, kBidiNSM},
+  {0x1DA84, 0x1DA84, kBidiNSM}, {0x1DA9B, 0x1DA9F, kBidiNSM}, {0x1DAA1, 0x1DAAF, kBidiNSM},
+  {0x1E000, 0x1E006, kBidiNSM}, {0x1E008, 0x1E018, kBidiNSM}, {0x1E01B, 0x1E021, kBidiNSM},
+  {0x1E023, 0x1E024, kBidiNSM}, {0x1E026, 0x1E02A, kBidiNSM}, {0x1E08F, 0x1E08F, kBidiNSM},
+  {0x1E130, 0x1E136, kBidiNSM}, {0x1E2AE, 0x1E2AE, kBidiNSM}, {0x1E2EC, 0x1E2EF, kBidiNSM},
+  {0x1E2FF, 0x1E2FF, kBidiET}, {0x1E4EC, 0x1E4EF, kBidiNSM}, {0x1E800, 0x1E8C4, kBidiR}, {0x1E8C7, 0x1E8CF, kBidiR},
+  {0x1E8D0, 0x1E8D6, kBidiNSM}, {0x1E900, 0x1E943, kBidiR}, {0x1E944, 0x1E94A, kBidiNSM}, {0x1E94B, 0x1E94B, kBidiR},
+  {0x1E950, 0x1E959, kBidiR}, {0x1E95E, 0x1E95F, kBidiR}, {0x1EC71, 0x1ECB4, kBidiAL}, {0x1ED01, 0x1ED3D, kBidiAL},
+  {0x1EE00, 0x1EE03, kBidiAL}, {0x1EE05, 0x1EE1F, kBidiAL}, {0x1EE21, 0x1EE22, kBidiAL}, {0x1EE24, 0x1EE24, kBidiAL},
+  {0x1EE27, 0x1EE27, kBidiAL}, {0x1EE29, 0x1EE32, kBidiAL}, {0x1EE34, 0x1EE37, kBidiAL}, {0x1EE39, 0x1EE39, kBidiAL},
+  {0x1EE3B, 0x1EE3B, kBidiAL}, {0x1EE42, 0x1EE42, kBidiAL}, {0x1EE47, 0x1EE47, kBidiAL}, {0x1EE49, 0x1EE49, kBidiAL},
+  {0x1EE4B, 0x1EE4B, kBidiAL}, {0x1EE4D, 0x1EE4F, kBidiAL}, {0x1EE51, 0x1EE52, kBidiAL}, {0x1EE54, 0x1EE54, kBidiAL},
+  {0x1EE57, 0x1EE57, kBidiAL}, {0x1EE59, 0x1EE59, kBidiAL}, {0x1EE5B, 0x1EE5B, kBidiAL}, {0x1EE5D, 0x1EE5D, kBidiAL},
+  {0x1EE5F, 0x1EE5F, kBidiAL}, {0x1EE61, 0x1EE62, kBidiAL}, {0x1EE64, 0x1EE64, kBidiAL}, {0x1EE67, 0x1EE6A, kBidiAL},
+  {0x1EE6C, 0x1EE72, kBidiAL}, {0x1EE74, 0x1EE77, kBidiAL}, {0x1EE79, 0x1EE7C, kBidiAL}, {0x1EE7E, 0x1EE7E, kBidiAL},
+  {0x1EE80, 0x1EE89, kBidiAL}, {0x1EE8B, 0x1EE9B, kBidiAL}, {0x1EEA1, 0x1EEA3, kBidiAL}, {0x1EEA5, 0x1EEA9, kBidiAL},
+  {0x1EEAB, 0x1EEBB, kBidiAL}, {0x1EEF0, 0x1EEF1, kBidiON}, {0x1F000, 0x1F02B, kBidiON}, {0x1F030, 0x1F093, kBidiON},
+  {0x1F0A0, 0x1F0AE, kBidiON}, {0x1F0B1, 0x1F0BF, kBidiON}, {0x1F0C1, 0x1F0CF, kBidiON}, {0x1F0D1, 0x1F0F5, kBidiON},
+  {0x1F100, 0x1F10A, kBidiEN}, {0x1F10B, 0x1F10F, kBidiON}, {0x1F12F, 0x1F12F, kBidiON}, {0x1F16A, 0x1F16F, kBidiON},
+  {0x1F1AD, 0x1F1AD, kBidiON}, {0x1F260, 0x1F265, kBidiON}, {0x1F300, 0x1F6D7, kBidiON}, {0x1F6DC, 0x1F6EC, kBidiON},
+  {0x1F6F0, 0x1F6FC, kBidiON}, {0x1F700, 0x1F776, kBidiON}, {0x1F77B, 0x1F7D9, kBidiON}, {0x1F7E0, 0x1F7EB, kBidiON},
+  {0x1F7F0, 0x1F7F0, kBidiON}, {0x1F800, 0x1F80B, kBidiON}, {0x1F810, 0x1F847, kBidiON}, {0x1F850, 0x1F859, kBidiON},
+  {0x1F860, 0x1F887, kBidiON}, {0x1F890, 0x1F8AD, kBidiON}, {0x1F8B0, 0x1F8B1, kBidiON}, {0x1F900, 0x1FA53, kBidiON},
+  {0x1FA60, 0x1FA6D, kBidiON}, {0x1FA70, 0x1FA7C, kBidiON}, {0x1FA80, 0x1FA88, kBidiON}, {0x1FA90, 0x1FABD, kBidiON},
+  {0x1FABF, 0x1FAC5, kBidiON}, {0x1FACE, 0x1FADB, kBidiON}, {0x1FAE0, 0x1FAE8, kBidiON}, {0x1FAF0, 0x1FAF8, kBidiON},
+  {0x1FB00, 0x1FB92, kBidiON}, {0x1FB94, 0x1FBCA, kBidiON}, {0x1FBF0, 0x1FBF9, kBidiEN}, {0xE0001, 0xE0001, kBidiBN},
+  {0xE0020, 0xE007F, kBidiBN}, {0xE0100, 0xE01EF, kBidiNSM},
+};
+
+// Code points which are not listed are of joining type U.
+static const CodePointRange kJoiningTypes[] = {
+  {0xAD, 0xAD, kJoiningT}, {0x300, 0x36F, kJoiningT}, {0x483, 0x489, kJoiningT}, {0x591, 0x5BD, kJoiningT},
+  {0x5BF, 0x5BF, kJoiningT}, {0x5C1, 0x5C2, kJoiningT}, {0x5C4, 0x5C5, kJoiningT}, {0x5C7, 0x5C7, kJoiningT},
+  {0x610, 0x61A, kJoiningT}, {0x61C, 0x61C, kJoiningT}, {0x620, 0x620, kJoiningD}, {0x622, 0x625, kJoiningR},
+  {0x626, 0x626, kJoiningD}, {0x627, 0x627, kJoiningR}, {0x628, 0x628, kJoiningD}, {0x629, 0x629, kJoiningR},
+  {0x62A, 0x62E, kJoiningD}, {0x62F, 0x632, kJoiningR}, {0x633, 0x63F, kJoiningD}, {0x641, 0x647, kJoiningD},
+  {0x648, 0x648, kJoiningR}, {0x649, 0x64A, kJoiningD}, {0x64B, 0x65F, kJoiningT}, {0x66E, 0x66F, kJoiningD},
+  {0x670, 0x670, kJoiningT}, {0x671, 0x673, kJoiningR}, {0x675, 0x677, kJoiningR}, {0x678, 0x687, kJoiningD},
+  {0x688, 0x699, kJoiningR}, {0x69A, 0x6BF, kJoiningD}, {0x6C0, 0x6C0, kJoiningR}, {0x6C1, 0x6C2, kJoiningD},
+  {0x6C3, 0x6CB, kJoiningR}, {0x6CC, 0x6CC, kJoiningD}, {0x6CD, 0x6CD, kJoiningR}, {0x6CE, 0x6CE, kJoiningD},
+  {0x6CF, 0x6CF, kJoiningR}, {0x6D0, 0x6D1, kJoiningD}, {0x6D2, 0x6D3, kJoiningR}, {0x6D5, 0x6D5, kJoiningR},
+  {0x6D6, 0x6DC, kJoiningT}, {0x6DF, 0x6E4, kJoiningT}, {0x6E7, 0x6E8, kJoiningT}, {0x6EA, 0x6ED, kJoiningT},
+  {0x6EE, 0x6EF, kJoiningR}, {0x6FA, 0x6FC, kJoiningD}, {0x6FF, 0x6FF, kJoiningD}, {0x70F, 0x70F, kJoiningT},
+  {0x710, 0x710, kJoiningR}, {0x711, 0x711, kJoiningT}, {0x712, 0x714, kJoiningD}, {0x715, 0x719, kJoiningR},
+  {0x71A, 0x71D, kJoiningD}, {0x71E, 0x71E, kJoiningR}, {0x71F, 0x727, kJoiningD}, {0x728, 0x728, kJoiningR},
+  {0x729, 0x729, kJoiningD}, {0x72A, 0x72A, kJoiningR}, {0x72B, 0x72B, kJoiningD}, {0x72C, 0x72C, kJoiningR},
+  {0x72D, 0x72E, kJoiningD}, {0x72F, 0x72F, kJoiningR}, {0x730, 0x74A, kJoiningT}, {0x74D, 0x74D, kJoiningR},
+  {0x74E, 0x758, kJoiningD}, {0x759, 0x75B, kJoiningR}, {0x75C, 0x76A, kJoiningD}, {0x76B, 0x76C, kJoiningR},
+  {0x76D, 0x770, kJoiningD}, {0x771, 0x771, kJoiningR}, {0x772, 0x772, kJoiningD}, {0x773, 0x774, kJoiningR},
+  {0x775, 0x777, kJoiningD}, {0x778, 0x779, kJoiningR}, {0x77A, 0x77F, kJoiningD}, {0x7A6, 0x7B0, kJoiningT},
+  {0x7CA, 0x7EA, kJoiningD}, {0x7EB, 0x7F3, kJoiningT}, {0x7FD, 0x7FD, kJoiningT}, {0x816, 0x819, kJoiningT},
+  {0x81B, 0x823, kJoiningT}, {0x825, 0x827, kJoiningT}, {0x829, 0x82D, kJoiningT}, {0x840, 0x840, kJoiningR},
+  {0x841, 0x845, kJoiningD}, {0x846, 0x847, kJoiningR}, {0x848, 0x848, kJoiningD}, {0x849, 0x849, kJoiningR},
+  {0x84A, 0x853, kJoiningD}, {0x854, 0x854, kJoiningR}, {0x855, 0x855, kJoiningD}, {0x856, 0x858, kJoiningR},
+  {0x859, 0x85B, kJoiningT}, {0x860, 0x860, kJoiningD}, {0x862, 0x865, kJoiningD}, {0x867, 0x867, kJoiningR},
+  {0x868, 0x868, kJoiningD}, {0x869, 0x86A, kJoiningR}, {0x870, 0x882, kJoiningR}, {0x886, 0x886, kJoiningD},
+  {0x889, 0x88D, kJoiningD}, {0x88E, 0x88E, kJoiningR}, {0x898, 0x89F, kJoiningT}, {0x8A0, 0x8A9, kJoiningD},
+  {0x8AA, 0x8AC, kJoiningR}, {0x8AE, 0x8AE, kJoiningR}, {0x8AF, 0x8B0, kJoiningD}, {0x8B1, 0x8B2, kJoiningR},
+  {0x8B3, 0x8B8, kJoiningD}, {0x8B9, 0x8B9, kJoiningR}, {0x8BA, 0x8C8, kJoiningD}, {0x8CA, 0x8E1, kJoiningT},
+  {0x8E3, 0x902, kJoiningT}, {0x93A, 0x93A, kJoiningT}, {0x93C, 0x93C, kJoiningT}, {0x941, 0x948, kJoiningT},
+  {0x94D, 0x94D, kJoiningT}, {0x951, 0x957, kJoiningT}, {0x962, 0x963, kJoiningT}, {0x981, 0x981, kJoiningT},
+  {0x9BC, 0x9BC, kJoiningT}, {0x9C1, 0x9C4, kJoiningT}, {0x9CD, 0x9CD, kJoiningT}, {0x9E2, 0x9E3, kJoiningT},
+  {0x9FE, 0x9FE, kJoiningT}, {0xA01, 0xA02, kJoiningT}, {0xA3C, 0xA3C, kJoiningT}, {0xA41, 0xA42, kJoiningT},
+  {0xA47, 0xA48, kJoiningT}, {0xA4B, 0xA4D, kJoiningT}, {0xA51, 0xA51, kJoiningT}, {0xA70, 0xA71, kJoiningT},
+  {0xA75, 0xA75, kJoiningT}, {0xA81, 0xA82, kJoiningT}, {0xABC, 0xABC, kJoiningT}, {0xAC1, 0xAC5, kJoiningT},
+  {0xAC7, 0xAC8, kJoiningT}, {0xACD, 0xACD, kJoiningT}, {0xAE2, 0xAE3, kJoiningT}, {0xAFA, 0xAFF, kJoiningT},
+  {0xB01, 0xB01, kJoiningT}, {0xB3C, 0xB3C, kJoiningT}, {0xB3F, 0xB3F, kJoiningT}, {0xB41, 0xB44, kJoiningT},
+  {0xB4D, 0xB4D, kJoiningT}, {0xB55, 0xB56, kJoiningT}, {0xB62, 0xB63, kJoiningT}, {0xB82, 0xB82, kJoiningT},
+  {0xBC0, 0xBC0, kJoiningT}, {0xBCD, 0xBCD, kJoiningT}, {0xC00, 0xC00, kJoiningT}, {0xC04, 0xC04, kJoiningT},
+  {0xC3C, 0xC3C, kJoiningT}, {0xC3E, 0xC40, kJoiningT}, {0xC46, 0xC48, kJoiningT}, {0xC4A, 0xC4D, kJoiningT},
+  {0xC55, 0xC56, kJoiningT}, {0xC62, 0xC63, kJoiningT}, {0xC81, 0xC81, kJoiningT}, {0xCBC, 0xCBC, kJoiningT},
+  {0xCBF, 0xCBF, kJoiningT}, {0xCC6, 0xCC6, kJoiningT}, {0xCCC, 0xCCD, kJoiningT}, {0xCE2, 0xCE3, kJoiningT},
+  {0xD00, 0xD01, kJoiningT}, {0xD3B, 0xD3C, kJoiningT}, {0xD41, 0xD44, kJoiningT}, {0xD4D, 0xD4D, kJoiningT},
+  {0xD62, 0xD63, kJoiningT}, {0xD81, 0xD81, kJoiningT}, {0xDCA, 0xDCA, kJoiningT}, {0xDD2, 0xDD4, kJoiningT},
+  {0xDD6, 0xDD6, kJoiningT}, {0xE31, 0xE31, kJoiningT}, {0xE34, 0xE3A, kJoiningT}, {0xE47, 0xE4E, kJoiningT},
+  {0xEB1, 0xEB1, kJoiningT}, {0xEB4, 0xEBC, kJoiningT}, {0xEC8, 0xECE, kJoiningT}, {0xF18, 0xF19, kJoiningT},
+  {0xF35, 0xF35, kJoiningT}, {0xF37, 0xF37, kJoiningT}, {0xF39, 0xF39, kJoiningT}, {0xF71, 0xF7E, kJoiningT},
+  {0xF80, 0xF84, kJoiningT}, {0xF86, 0xF87, kJoiningT}, {0xF8D, 0xF97, kJoiningT}, {0xF99, 0xFBC, kJoiningT},
+  {0xFC6, 0xFC6, kJoiningT}, {0x102D, 0x1030, kJoiningT}, {0x1032, 0x1037, kJoiningT}, {0x1039, 0x103A, kJoiningT},
+  {0x103D, 0x103E, kJoiningT}, {0x1058, 0x1059, kJoiningT}, {0x105E, 0x1060, kJoiningT}, {0x1071, 0x1074, kJoiningT},
+  {0x1082, 0x1082, kJoiningT}, {0x1085, 0x1086, kJoiningT}, {0x108D, 0x108D, kJoiningT}, {0x109D, 0x109D, kJoiningT},
+  {0x135D, 0x135F, kJoiningT}, {0x1712, 0x1714, kJoiningT}, {0x1732, 0x1733, kJoiningT}, {0x1752, 0x1753, kJoiningT},
+  {0x1772, 0x1773, kJoiningT}, {0x17B4, 0x17B5, kJoiningT}, {0x17B7, 0x17BD, kJoiningT}, {0x17C6, 0x17C6, kJoiningT},
+  {0x17C9, 0x17D3, kJoiningT}, {0x17DD, 0x17DD, kJoiningT}, {0x1807, 0x1807, kJoiningD}, {0x180B, 0x180D, kJoiningT},
+  {0x180F, 0x180F, kJoiningT}, {0x1820, 0x1878, kJoiningD}, {0x1885, 0x1886, kJoiningT}, {0x1887, 0x18A8, kJoiningD},
+  {0x18A9, 0x18A9, kJoiningT}, {0x18AA, 0x18AA, kJoiningD}, {0x1920, 0x1922, kJoiningT}, {0x1927, 0x1928, kJoiningT},
+  {0x1932, 0x1932, kJoiningT}, {0x1939, 0x193B, kJoiningT}, {0x1A17, 0x1A18, kJoiningT}, {0x1A1B, 0x1A1B, kJoiningT},
+  {0x1A56, 0x1A56, kJoiningT}, {0x1A58, 0x1A5E, kJoiningT}, {0x1A60, 0x1A60, kJoiningT}, {0x1A62, 0x1A62, kJoiningT},
+  {0x1A65, 0x1A6C, kJoiningT}, {0x1A73, 0x1A7C, kJoiningT}, {0x1A7F, 0x1A7F, kJoiningT}, {0x1AB0, 0x1ACE, kJoiningT},
+  {0x1B00, 0x1B03, kJoiningT}, {0x1B34, 0x1B34, kJoiningT}, {0x1B36, 0x1B3A, kJoiningT}, {0x1B3C, 0x1B3C, kJoiningT},
+  {0x1B42, 0x1B42, kJoiningT}, {0x1B6B, 0x1B73, kJoiningT}, {0x1B80, 0x1B81, kJoiningT}, {0x1BA2, 0x1BA5, kJoiningT},
+  {0x1BA8, 0x1BA9, kJoiningT}, {0x1BAB, 0x1BAD, kJoiningT}, {0x1BE6, 0x1BE6, kJoiningT}, {0x1BE8, 0x1BE9, kJoiningT},
+  {0x1BED, 0x1BED, kJoiningT}, {0x1BEF, 0x1BF1, kJoiningT}, {0x1C2C, 0x1C33, kJoiningT}, {0x1C36, 0x1C37, kJoiningT},
+  {0x1CD0, 0x1CD2, kJoiningT}, {0x1CD4, 0x1CE0, kJoiningT}, {0x1CE2, 0x1CE8, kJoiningT}, {0x1CED, 0x1CED, kJoiningT},
+  {0x1CF4, 0x1CF4, kJoiningT}, {0x1CF8, 0x1CF9, kJoiningT}, {0x1DC0, 0x1DFF, kJoiningT}, {0x200B, 0x200B, kJoiningT},
+  {0x200E, 0x200F, kJoiningT}, {0x202A, 0x202E, kJoiningT}, {0x2060, 0x2064, kJoiningT}, {0x206A, 0x206F, kJoiningT},
+  {0x20D0, 0x20F0, kJoiningT}, {0x2CEF, 0x2CF1, kJoiningT}, {0x2D7F, 0x2D7F, kJoiningT}, {0x2DE0, 0x2DFF, kJoiningT},
+  {0x302A, 0x302D, kJoiningT}, {0x3099, 0x309A, kJoiningT}, {0xA66F, 0xA672, kJoiningT}, {0xA674, 0xA67D, kJoiningT},
+  {0xA69E, 0xA69F, kJoiningT}, {0xA6F0, 0xA6F1, kJoiningT}, {0xA802, 0xA802, kJoiningT}, {0xA806, 0xA806, kJoiningT},
+  {0xA80B, 0xA80B, kJoiningT}, {0xA825, 0xA826, kJoiningT}, {0xA82C, 0xA82C, kJoiningT}, {0xA840, 0xA871, kJoiningD},
+  {0xA872, 0xA872, kJoiningL}, {0xA8C4, 0xA8C5, kJoiningT}, {0xA8E0, 0xA8F1, kJoiningT}, {0xA8FF, 0xA8FF, kJoiningT},
+  {0xA926, 0xA92D, kJoiningT}, {0xA947, 0xA951, kJoiningT}, {0xA980, 0xA982, kJoiningT}, {0xA9B3, 0xA9B3, kJoiningT},
+  {0xA9B6, 0xA9B9, kJoiningT}, {0xA9BC, 0xA9BD, kJoiningT}, {0xA9E5, 0xA9E5, kJoiningT}, {0xAA29, 0xAA2E, kJoiningT},
+  {0xAA31, 0xAA32, kJoiningT}, {0xAA35, 0xAA36, kJoiningT}, {0xAA43, 0xAA43, kJoiningT}, {0xAA4C, 0xAA4C, kJoiningT},
+  {0xAA7C, 0xAA7C, kJoiningT}, {0xAAB0, 0xAAB0, kJoiningT}, {0xAAB2, 0xAAB4, kJoiningT}, {0xAAB7, 0xAAB8, kJoiningT},
+  {0xAABE, 0xAABF, kJoiningT}, {0xAAC1, 0xAAC1, kJoiningT}, {0xAAEC, 0xAAED, kJoiningT}, {0xAAF6, 0xAAF6, kJoiningT},
+  {0xABE5, 0xABE5, kJoiningT}, {0xABE8, 0xABE8, kJoiningT}, {0xABED, 0xABED, kJoiningT}, {0xFB1E, 0xFB1E, kJoiningT},
+  {0xFE00, 0xFE0F, kJoiningT}, {0xFE20, 0xFE2F, kJoiningT}, {0xFEFF, 0xFEFF, kJoiningT}, {0xFFF9, 0xFFFB, kJoiningT},
+  {0x101FD, 0x101FD, kJoiningT}, {0x102E0, 0x102E0, kJoiningT}, {0x10376, 0x1037A, kJoiningT},
+  {0x10A01, 0x10A03, kJoiningT}, {0x10A05, 0x10A06, kJoiningT}, {0x10A0C, 0x10A0F, kJoiningT},
+  {0x10A38, 0x10A3A, kJoiningT}, {0x10A3F, 0x10A3F, kJoiningT}, {0x10AC0, 0x10AC4, kJoiningD},
+  {0x10AC5, 0x10AC5, kJoiningR}, {0x10AC7, 0x10AC7, kJoiningR}, {0x10AC9, 0x10ACA, kJoiningR},
+  {0x10ACD, 0x10ACD, kJoiningL}, {0x10ACE, 0x10AD2, kJoiningR}, {0x10AD3, 0x10AD6, kJoiningD},
+  {0x10AD7, 0x10AD7, kJoiningL}, {0x10AD8, 0x10ADC, kJoiningD}, {0x10ADD, 0x10ADD, kJoiningR},
+  {0x10ADE, 0x10AE0, kJoiningD}, {0x10AE1, 0x10AE1, kJoiningR}, {0x10AE4, 0x10AE4, kJoiningR},
+  {0x10AE5, 0x10AE6, kJoiningT}, {0x10AEB, 0x10AEE, kJoiningD}, {0x10AEF, 0x10AEF, kJoiningR},
+  {0x10B80, 0x10B80, kJoiningD}, {0x10B81, 0x10B81, kJoiningR}, {0x10B82, 0x10B82, kJoiningD},
+  {0x10B83, 0x10B85, kJoiningR}, {0x10B86, 0x10B88, kJoiningD}, {0x10B89, 0x10B89, kJoiningR},
+  {0x10B8A, 0x10B8B, kJoiningD}, {0x10B8C, 0x10B8C, kJoiningR}, {0x10B8D, 0x10B8D, kJoiningD},
+  {0x10B8E, 0x10B8F, kJoiningR}, {0x10B90, 0x10B90, kJoiningD}, {0x10B91, 0x10B91, kJoiningR},
+  {0x10BA9, 0x10BAC, kJoiningR}, {0x10BAD, 0x10BAE, kJoiningD}, {0x10D00, 0x10D00, kJoiningL},
+  {0x10D01, 0x10D21, kJoiningD}, {0x10D22, 0x10D22, kJoiningR}, {0x10D23, 0x10D23, kJoiningD},
+  {0x10D24, 0x10D27, kJoiningT}, {0x10EAB, 0x10EAC, kJoiningT}, {0x10EFD, 0x10EFF, kJoiningT},
+  {0x10F30, 0x10F32, kJoiningD}, {0x10F33, 0x10F33, kJoiningR}, {0x10F34, 0x10F44, kJoiningD},
+  {0x10F46, 0x10F50, kJoiningT}, {0x10F51, 0x10F53, kJoiningD}, {0x10F54, 0x10F54, kJoiningR},
+  {0x10F70, 0x10F73, kJoiningD}, {0x10F74, 0x10F75, kJoiningR}, {0x10F76, 0x10F81, kJoiningD},
+  {0x10F82, 0x10F85, kJoiningT}, {0x10FB0, 0x10FB0, kJoiningD}, {0x10FB2, 0x10FB3, kJoiningD},
+  {0x10FB4, 0x10FB6, kJoiningR}, {0x10FB8, 0x10FB8, kJoiningD}, {0x10FB9, 0x10FBA, kJoiningR},
+  {0x10FBB, 0x10FBC, kJoiningD}, {0x10FBD, 0x10FBD, kJoiningR}, {0x10FBE, 0x10FBF, kJoiningD},
+  {0x10FC1, 0x10FC1, kJoiningD}, {0x10FC2, 0x10FC3, kJoiningR}, {0x10FC4, 0x10FC4, kJoiningD},
+  {0x10FC9, 0x10FC9, kJoiningR}, {0x10FCA, 0x10FCA, kJoiningD}, {0x10FCB, 0x10FCB, kJoiningL},
+  {0x11001, 0x11001, kJoiningT}, {0x11038, 0x11046, kJoiningT}, {0x11070, 0x11070, kJoiningT},
+  {0x11073, 0x11074, kJoiningT}, {0x1107F, 0x11081, kJoiningT}, {0x110B3, 0x110B6, kJoiningT},
+  {0x110B9, 0x110BA, kJoiningT}, {0x110C2, 0x110C2, kJoiningT}, {0x11100, 0x11102, kJoiningT},
+  {0x11127, 0x1112B, kJoiningT}, {0x1112D, 0x11134, kJoiningT}, {0x11173, 0x11173, kJoiningT},
+  {0x11180, 0x11181, kJoiningT}, {0x111B6, 0x111BE, kJoiningT}, {0x111C9, 0x111CC, kJoiningT},
+  {0x111CF, 0x111CF, kJoiningT}, {0x1122F, 0x11231, kJoiningT}, {0x11234, 0x11234, kJoiningT},
+  {0x11236, 0x11237, kJoiningT}, {0x1123E, 0x1123E, kJoiningT}, {0x11241, 0x11241, kJoiningT},
+  {0x112DF, 0x112DF, kJoiningT}, {0x112E3, 0x112EA, kJoiningT}, {0x11300, 0x11301, kJoiningT},
+  {0x1133B, 0x1133C, kJoiningT}, {0x11340, 0x11340, kJoiningT}, {0x11366, 0x1136C, kJoiningT},
+  {0x11370, 0x11374, kJoiningT}, {0x11438, 0x1143F, kJoiningT}, {0x11442, 0x11444, kJoiningT},
+  {0x11446, 0x11446, kJoiningT}, {0x1145E, 0x1145E, kJoiningT}, {0x114B3, 0x114B8, kJoiningT},
+  {0x114BA, 0x114BA, kJoiningT}, {0x114BF, 0x114C0, kJoiningT}, {0x114C2, 0x114C3, kJoiningT},
+  {0x115B2, 0x115B5, kJoiningT}, {0x115BC, 0x115BD, kJoiningT}, {0x115BF, 0x115C0, kJoiningT},
+  {0x115DC, 0x115DD, kJoiningT}, {0x11633, 0x1163A, kJoiningT}, {0x1163D, 0x1163D, kJoiningT},
+  {0x1163F, 0x11640, kJoiningT}, {0x116AB, 0x116AB, kJoiningT}, {0x116AD, 0x116AD, kJoiningT},
+  {0x116B0, 0x116B5, kJoiningT}, {0x116B7, 0x116B7, kJoiningT}, {0x1171D, 0x1171F, kJoiningT},
+  {0x11722, 0x11725, kJoiningT}, {0x11727, 0x1172B, kJoiningT}, {0x1182F, 0x11837, kJoiningT},
+  {0x11839, 0x1183A, kJoiningT}, {0x1193B, 0x1193C, kJoiningT}, {0x1193E, 0x1193E, kJoiningT},
+  {0x11943, 0x11943, kJoiningT}, {0x119D4, 0x119D7, kJoiningT}, {0x119DA, 0x119DB, kJoiningT},
+  {0x119E0, 0x119E0, kJoiningT}, {0x11A01, 0x11A0A, kJoiningT}, {0x11A33, 0x11A38, kJoiningT},
+  {0x11A3B, 0x11A3E, kJoiningT}, {0x11A47, 0x11A47, kJoiningT}, {0x11A51, 0x11A56, kJoiningT},
+  {0x11A59, 0x11A5B, kJoiningT}, {0x11A8A, 0x11A96, kJoiningT}, {0x11A98, 0x11A99, kJoiningT},
+  {0x11C30, 0x11C36, kJoiningT}, {0x11C38, 0x11C3D, kJoiningT}, {0x11C3F, 0x11C3F, kJoiningT},
+  {0x11C92, 0x11CA7, kJoiningT}, {0x11CAA, 0x11CB0, kJoiningT}, {0x11CB2, 0x11CB3, kJoiningT},
+  {0x11CB5, 0x11CB6, kJoiningT}, {0x11D31, 0x11D36, kJoiningT}, {0x11D3A, 0x11D3A, kJoiningT},
+  {0x11D3C, 0x11D3D, kJoiningT}, {0x11D3F, 0x11D45, kJoiningT}, {0x11D47, 0x11D47, kJoiningT},
+  {0x11D90, 0x11D91, kJoiningT}, {0x11D95, 0x11D95, kJoiningT}, {0x11D97, 0x11D97, kJoiningT},
+  {0x11EF3, 0x11EF4, kJoiningT}, {0x11F00, 0x11F01, kJoiningT}, {0x11F36, 0x11F3A, kJoiningT},
+  {0x11F40, 0x11F40, kJoiningT}, {0x11F42, 0x11F42, kJoiningT}, {0x13430, 0x13440, kJoiningT},
+  {0x13447, 0x13455, kJoiningT}, {0x16AF0, 0x16AF4, kJoiningT}, {0x16B30, 0x16B36, kJoiningT},
+  {0x16F4F, 0x16F4F, kJoiningT}, {0x16F8F, 0x16F92, kJoiningT}, {0x16FE4, 0x16FE4, kJoiningT},
+  {0x1BC9D, 0x1BC9E, kJoiningT}, {0x1BCA0, 0x1BCA3, kJoiningT}, {0x1CF00, 0x1CF2D, kJoiningT},
+  {0x1CF30, 0x1CF46, kJoiningT}, {0x1D167, 0x1D169, kJoiningT}, {0x1D173, 0x1D182, kJoiningT},
+  {0x1D185, 0x1D18B, kJoiningT}, {0x1D1AA, 0x1D1AD, kJoiningT}, {0x1D242, 0x1D244, kJoiningT},
+  {0x1DA00, 0x1DA36, kJoiningT}, {0x1DA3B, 0x1DA6C, kJoiningT}, {0x1DA75, 0x1DA75, kJoiningT},
+  {0x1DA84, 0x1DA84, kJoiningT}, {0x1DA9B, 0x1DA9F, kJoiningT}, {0x1DAA1, 0x1DAAF, kJoiningT},
+  {0x1E000, 0x1E006, kJoiningT}, {0x1E008, 0x1E018, kJoiningT}, {0x1E01B, 0x1E021, kJoiningT},
+  {0x1E023, 0x1E024, kJoiningT}, {0x1E026, 0x1E02A, kJoiningT}, {0x1E08F, 0x1E08F, kJoiningT},
+  {0x1E130, 0x1E136, kJoiningT}, {0x1E2AE, 0x1E2AE, kJoiningT}, {0x1E2EC, 0x1E2EF, kJoiningT},
+  {0x1E4EC, 0x1E4EF, kJoiningT}, {0x1E8D0, 0x1E8D6, kJoiningT}, {0x1E900, 0x1E943, kJoiningD},
+  {0x1E944, 0x1E94B, kJoiningT}, {0xE0001, 0xE0001, kJoiningT}, {0xE0020, 0xE007F, kJoiningT},
+  {0xE0100, 0xE01EF, kJoiningT},
+};
+
+// Full canonical decompositions, Hangul syllables are decomposed algorithmically.
+static const Decomposition kDecompositions[] = {
+  {0xC0, 0, 2}, {0xC1, 2, 2}, {0xC2, 4, 2}, {0xC3, 6, 2}, {0xC4, 8, 2}, {0xC5, 10, 2}, {0xC7, 12, 2}, {0xC8, 14, 2},
+  {0xC9, 16, 2}, {0xCA, 18, 2}, {0xCB, 20, 2}, {0xCC, 22, 2}, {0xCD, 24, 2}, {0xCE, 26, 2}, {0xCF, 28, 2},
+  {0xD1, 30, 2}, {0xD2, 32, 2}, {0xD3, 34, 2}, {0xD4, 36, 2}, {0xD5, 38, 2}, {0xD6, 40, 2}, {0xD9, 42, 2},
+  {0xDA, 44, 2}, {0xDB, 46, 2}, {0xDC, 48, 2}, {0xDD, 50, 2}, {0xE0, 52, 2}, {0xE1, 54, 2}, {0xE2, 56, 2},
+  {0xE3, 58, 2}, {0xE4, 60, 2}, {0xE5, 62, 2}, {0xE7, 64, 2}, {0xE8, 66, 2}, {0xE9, 68, 2}, {0xEA, 70, 2},
+  {0xEB, 72, 2}, {0xEC, 74, 2}, {0xED, 76, 2}, {0xEE, 78, 2}, {0xEF, 80, 2}, {0xF1, 82, 2}, {0xF2, 84, 2},
+  {0xF3, 86, 2}, {0xF4, 88, 2}, {0xF5, 90, 2}, {0xF6, 92, 2}, {0xF9, 94, 2}, {0xFA, 96, 2}, {0xFB, 98, 2},
+  {0xFC, 100, 2}, {0xFD, 102, 2}, {0xFF, 104, 2}, {0x100, 106, 2}, {0x101, 108, 2}, {0x102, 110, 2}, {0x103, 112, 2},
+  {0x104, 114, 2}, {0x105, 116, 2}, {0x106, 118, 2}, {0x107, 120, 2}, {0x108, 122, 2}, {0x109, 124, 2},
+  {0x10A, 126, 2}, {0x10B, 128, 2}, {0x10C, 130, 2}, {0x10D, 132, 2}, {0x10E, 134, 2}, {0x10F, 136, 2},
+  {0x112, 138, 2}, {0x113, 140, 2}, {0x114, 142, 2}, {0x115, 144, 2}, {0x116, 146, 2}, {0x117, 148, 2},
+  {0x118, 150, 2}, {0x119, 152, 2}, {0x11A, 154, 2}, {0x11B, 156, 2}, {0x11C, 158, 2}, {0x11D, 160, 2},
+  {0x11E, 162, 2}, {0x11F, 164, 2}, {0x120, 166, 2}, {0x121, 168, 2}, {0x122, 170, 2}, {0x123, 172, 2},
+  {0x124, 174, 2}, {0x125, 176, 2}, {0x128, 178, 2}, {0x129, 180, 2}, {0x12A, 182, 2}, {0x12B, 184, 2},
+  {0x12C, 186, 2}, {0x12D, 188, 2}, {0x12E, 190, 2}, {0x12F, 192, 2}, {0x130, 194, 2}, {0x134, 196, 2},
+  {0x135, 198, 2}, {0x136, 200, 2}, {0x137, 202, 2}, {0x139, 204, 2}, {0x13A, 206, 2}, {0x13B, 208, 2},
+  {0x13C, 210, 2}, {0x13D, 212, 2}, {0x13E, 214, 2}, {0x143, 216, 2}, {0x144, 218, 2}, {0x145, 220, 2},
+  {0x146, 222, 2}, {0x147, 224, 2}, {0x148, 226, 2}, {0x14C, 228, 2}, {0x14D, 230, 2}, {0x14E, 232, 2},
+  {0x14F, 234, 2}, {0x150, 236, 2}, {0x151, 238, 2}, {0x154, 240, 2}, {0x155, 242, 2}, {0x156, 244, 2},
+  {0x157, 246, 2}, {0x158, 248, 2}, {0x159, 250, 2}, {0x15A, 252, 2}, {0x15B, 254, 2}, {0x15C, 256, 2},
+  {0x15D, 258, 2}, {0x15E, 260, 2}, {0x15F, 262, 2}, {0x160, 264, 2}, {0x161, 266, 2}, {0x162, 268, 2},
+  {0x163, 270, 2}, {0x164, 272, 2}, {0x165, 274, 2}, {0x168, 276, 2}, {0x169, 278, 2}, {0x16A, 280, 2},
+  {0x16B, 282, 2}, {0x16C, 284, 2}, {0x16D, 286, 2}, {0x16E, 288, 2}, {0x16F, 290, 2}, {0x170, 292, 2},
+  {0x171, 294, 2}, {0x172, 296, 2}, {0x173, 298, 2}, {0x174, 300, 2}, {0x175, 302, 2}, {0x176, 304, 2},
+  {0x177, 306, 2}, {0x178, 308, 2}, {0x179, 310, 2}, {0x17A, 312, 2}, {0x17B, 314, 2}, {0x17C, 316, 2},
+  {0x17D, 318, 2}, {0x17E, 320, 2}, {0x1A0, 322, 2}, {0x1A1, 324, 2}, {0x1AF, 326, 2}, {0x1B0, 328, 2},
+  {0x1CD, 330, 2}, {0x1CE, 332, 2}, {0x1CF, 334, 2}, {0x1D0, 336, 2}, {0x1D1, 338, 2}, {0x1D2, 340, 2},
+  {0x1D3, 342, 2}, {0x1D4, 344, 2}, {0x1D5, 346, 3}, {0x1D6, 349, 3}, {0x1D7, 352, 3}, {0x1D8, 355, 3},
+  {0x1D9, 358, 3}, {0x1DA, 361, 3}, {0x1DB, 364, 3}, {0x1DC, 367, 3}, {0x1DE, 370, 3}, {0x1DF, 373, 3},
+  {0x1E0, 376, 3}, {0x1E1, 379, 3}, {0x1E2, 382, 2}, {0x1E3, 384, 2}, {0x1E6, 386, 2}, {0x1E7, 388, 2},
+  {0x1E8, 390, 2}, {0x1E9, 392, 2}, {0x1EA, 394, 2}, {0x1EB, 396, 2}, {0x1EC, 398, 3}, {0x1ED, 401, 3},
+  {0x1EE, 404, 2}, {0x1EF, 406, 2}, {0x1F0, 408, 2}, {0x1F4, 410, 2}, {0x1F5, 412, 2}, {0x1F8, 414, 2},
+  {0x1F9, 416, 2}, {0x1FA, 418, 3}, {0x1FB, 421, 3}, {0x1FC, 424, 2}, {0x1FD, 426, 2}, {0x1FE, 428, 2},
+  {0x1FF, 430, 2}, {0x200, 432, 2}, {0x201, 434, 2}, {0x202, 436, 2}, {0x203, 438, 2}, {0x204, 440, 2},
+  {0x205, 442, 2}, {0x206, 444, 2}, {0x207, 446, 2}, {0x208, 448, 2}, {0x209, 450, 2}, {0x20A, 452, 2},
+  {0x20B, 454, 2}, {0x20C, 456, 2}, {0x20D, 458, 2}, {0x20E, 460, 2}, {0x20F, 462, 2}, {0x210, 464, 2},
+  {0x211, 466, 2}, {0x212, 468, 2}, {0x213, 470, 2}, {0x214, 472, 2}, {0x215, 474, 2}, {0x216, 476, 2},
+  {0x217, 478, 2}, {0x218, 480, 2}, {0x219, 482, 2}, {0x21A, 484, 2}, {0x21B, 486, 2}, {0x21E, 488, 2},
+  {0x21F, 490, 2}, {0x226, 492, 2}, {0x227, 494, 2}, {0x228, 496, 2}, {0x229, 498, 2}, {0x22A, 500, 3},
+  {0x22B, 503, 3}, {0x22C, 506, 3}, {0x22D, 509, 3}, {0x22E, 512, 2}, {0x22F, 514, 2}, {0x230, 516, 3},
+  {0x231, 519, 3}, {0x232, 522, 2}, {0x233, 524, 2}, {0x340, 526, 1}, {0x341, 527, 1}, {0x343, 528, 1},
+  {0x344, 529, 2}, {0x374, 531, 1}, {0x37E, 532, 1}, {0x385, 533, 2}, {0x386, 535, 2}, {0x387, 537, 1},
+  {0x388, 538, 2}, {0x389, 540, 2}, {0x38A, 542, 2}, {0x38C, 544, 2}, {0x38E, 546, 2}, {0x38F, 548, 2},
+  {0x390, 550, 3}, {0x3AA, 553, 2}, {0x3AB, 555, 2}, {0x3AC, 557, 2}, {0x3AD, 559, 2}, {0x3AE, 561, 2},
+  {0x3AF, 563, 2}, {0x3B0, 565, 3}, {0x3CA, 568, 2}, {0x3CB, 570, 2}, {0x3CC, 572, 2}, {0x3CD, 574, 2},
+  {0x3CE, 576, 2}, {0x3D3, 578, 2}, {0x3D4, 580, 2}, {0x400, 582, 2}, {0x401, 584, 2}, {0x403, 586, 2},
+  {0x407, 588, 2}, {0x40C, 590, 2}, {0x40D, 592, 2}, {0x40E, 594, 2}, {0x419, 596, 2}, {0x439, 598, 2},
+  {0x450, 600, 2}, {0x451, 602, 2}, {0x453, 604, 2}, {0x457, 606, 2}, {0x45C, 608, 2}, {0x45D, 610, 2},
+  {0x45E, 612, 2}, {0x476, 614, 2}, {0x477, 616, 2}, {0x4C1, 618, 2}, {0x4C2, 620, 2}, {0x4D0, 622, 2},
+  {0x4D1, 624, 2}, {0x4D2, 626, 2}, {0x4D3, 628, 2}, {0x4D6, 630, 2}, {0x4D7, 632, 2}, {0x4DA, 634, 2},
+  {0x4DB, 636, 2}, {0x4DC, 638, 2}, {0x4DD, 640, 2}, {0x4DE, 642, 2}, {0x4DF, 644, 2}, {0x4E2, 646, 2},
+  {0x4E3, 648, 2}, {0x4E4, 650, 2}, {0x4E5, 652, 2}, {0x4E6, 654, 2}, {0x4E7, 656, 2}, {0x4EA, 658, 2},
+  {0x4EB, 660, 2}, {0x4EC, 662, 2}, {0x4ED, 664, 2}, {0x4EE, 666, 2}, {0x4EF, 668, 2}, {0x4F0, 670, 2},
+  {0x4F1, 672, 2}, {0x4F2, 674, 2}, {0x4F3, 676, 2}, {0x4F4, 678, 2}, {0x4F5, 680, 2}, {0x4F8, 682, 2},
+  {0x4F9, 684, 2}, {0x622, 686, 2}, {0x623, 688, 2}, {0x624, 690, 2}, {0x625, 692, 2}, {0x626, 694, 2},
+  {0x6C0, 696, 2}, {0x6C2, 698, 2}, {0x6D3, 700, 2}, {0x929, 702, 2}, {0x931, 704, 2}, {0x934, 706, 2},
+  {0x958, 708, 2}, {0x959, 710, 2}, {0x95A, 712, 2}, {0x95B, 714, 2}, {0x95C, 716, 2}, {0x95D, 718, 2},
+  {0x95E, 720, 2}, {0x95F, 722, 2}, {0x9CB, 724, 2}, {0x9CC, 726, 2}, {0x9DC, 728, 2}, {0x9DD, 730, 2},
+  {0x9DF, 732, 2}, {0xA33, 734, 2}, {0xA36, 736, 2}, {0xA59, 738, 2}, {0xA5A, 740, 2}, {0xA5B, 742, 2},
+  {0xA5E, 744, 2}, {0xB48, 746, 2}, {0xB4B, 748, 2}, {0xB4C, 750, 2}, {0xB5C, 752, 2}, {0xB5D, 754, 2},
+  {0xB94, 756, 2}, {0xBCA, 758, 2}, {0xBCB, 760, 2}, {0xBCC, 762, 2}, {0xC48, 764, 2}, {0xCC0, 766, 2},
+  {0xCC7, 768, 2}, {0xCC8, 770, 2}, {0xCCA, 772, 2}, {0xCCB, 774, 3}, {0xD4A, 777, 2}, {0xD4B, 779, 2},
+  {0xD4C, 781, 2}, {0xDDA, 783, 2}, {0xDDC, 785, 2}, {0xDDD, 787, 3}, {0xDDE, 790, 2}, {0xF43, 792, 2},
+  {0xF4D, 794, 2}, {0xF52, 796, 2}, {0xF57, 798, 2}, {0xF5C, 800, 2}, {0xF69, 802, 2}, {0xF73, 804, 2},
+  {0xF75, 806, 2}, {0xF76, 808, 2}, {0xF78, 810, 2}, {0xF81, 812, 2}, {0xF93, 814, 2}, {0xF9D, 816, 2},
+  {0xFA2, 818, 2}, {0xFA7, 820, 2}, {0xFAC, 822, 2}, {0xFB9, 824, 2}, {0x1026, 826, 2}, {0x1B06, 828, 2},
+  {0x1B08, 830, 2}, {0x1B0A, 832, 2}, {0x1B0C, 834, 2}, {0x1B0E, 836, 2}, {0x1B12, 838, 2}, {0x1B3B, 840, 2},
+  {0x1B3D, 842, 2}, {0x1B40, 844, 2}, {0x1B41, 846, 2}, {0x1B43, 848, 2}, {0x1E00, 850, 2}, {0x1E01, 852, 2},
+  {0x1E02, 854, 2}, {0x1E03, 856, 2}, {0x1E04, 858, 2}, {0x1E05, 860, 2}, {0x1E06, 862, 2}, {0x1E07, 864, 2},
+  {0x1E08, 866, 3}, {0x1E09, 869, 3}, {0x1E0A, 872, 2}, {0x1E0B, 874, 2}, {0x1E0C, 876, 2}, {0x1E0D, 878, 2},
+  {0x1E0E, 880, 2}, {0x1E0F, 882, 2}, {0x1E10, 884, 2}, {0x1E11, 886, 2}, {0x1E12, 888, 2}, {0x1E13, 890, 2},
+  {0x1E14, 892, 3}, {0x1E15, 895, 3}, {0x1E16, 898, 3}, {0x1E17, 901, 3}, {0x1E18, 904, 2}, {0x1E19, 906, 2},
+  {0x1E1A, 908, 2}, {0x1E1B, 910, 2}, {0x1E1C, 912, 3}, {0x1E1D, 915, 3}, {0x1E1E, 918, 2}, {0x1E1F, 920, 2},
+  {0x1E20, 922, 2}, {0x1E21, 924, 2}, {0x1E22, 926, 2}, {0x1E23, 928, 2}, {0x1E24, 930, 2}, {0x1E25, 932, 2},
+  {0x1E26, 934, 2}, {0x1E27, 936, 2}, {0x1E28, 938, 2}, {0x1E29, 940, 2}, {0x1E2A, 942, 2}, {0x1E2B, 944, 2},
+  {0x1E2C, 946, 2}, {0x1E2D, 948, 2}, {0x1E2E, 950, 3}, {0x1E2F, 953, 3}, {0x1E30, 956, 2}, {0x1E31, 958, 2},
+  {0x1E32, 960, 2}, {0x1E33, 962, 2}, {0x1E34, 964, 2}, {0x1E35, 966, 2}, {0x1E36, 968, 2}, {0x1E37, 970, 2},
+  {0x1E38, 972, 3}, {0x1E39, 975, 3}, {0x1E3A, 978, 2}, {0x1E3B, 980, 2}, {0x1E3C, 982, 2}, {0x1E3D, 984, 2},
+  {0x1E3E, 986, 2}, {0x1E3F, 988, 2}, {0x1E40, 990, 2}, {0x1E41, 992, 2}, {0x1E42, 994, 2}, {0x1E43, 996, 2},
+  {0x1E44, 998, 2}, {0x1E45, 1000, 2}, {0x1E46, 1002, 2}, {0x1E47, 1004, 2}, {0x1E48, 1006, 2}, {0x1E49, 1008, 2},
+  {0x1E4A, 1010, 2}, {0x1E4B, 1012, 2}, {0x1E4C, 1014, 3}, {0x1E4D, 1017, 3}, {0x1E4E, 1020, 3}, {0x1E4F, 1023, 3},
+  {0x1E50, 1026, 3}, {0x1E51, 1029, 3}, {0x1E52, 1032, 3}, {0x1E53, 1035, 3}, {0x1E54, 1038, 2}, {0x1E55, 1040, 2},
+  {0x1E56, 1042, 2}, {0x1E57, 1044, 2}, {0x1E58, 1046, 2}, {0x1E59, 1048, 2}, {0x1E5A, 1050, 2}, {0x1E5B, 1052, 2},
+  {0x1E5C, 1054, 3}, {0x1E5D, 1057, 3}, {0x1E5E, 1060, 2}, {0x1E5F, 1062, 2}, {0x1E60, 1064, 2}, {0x1E61, 1066, 2},
+  {0x1E62, 1068, 2}, {0x1E63, 1070, 2}, {0x1E64, 1072, 3}, {0x1E65, 1075, 3}, {0x1E66, 1078, 3}, {0x1E67, 1081, 3},
+  {0x1E68, 1084, 3}, {0x1E69, 1087, 3}, {0x1E6A, 1090, 2}, {0x1E6B, 1092, 2}, {0x1E6C, 1094, 2}, {0x1E6D, 1096, 2},
+  {0x1E6E, 1098, 2}, {0x1E6F, 1100, 2}, {0x1E70, 1102, 2}, {0x1E71, 1104, 2}, {0x1E72, 1106, 2}, {0x1E73, 1108, 2},
+  {0x1E74, 1110, 2}, {0x1E75, 1112, 2}, {0x1E76, 1114, 2}, {0x1E77, 1116, 2}, {0x1E78, 1118, 3}, {0x1E79, 1121, 3},
+  {0x1E7A, 1124, 3}, {0x1E7B, 1127, 3}, {0x1E7C, 1130, 2}, {0x1E7D, 1132, 2}, {0x1E7E, 1134, 2}, {0x1E7F, 1136, 2},
+  {0x1E80, 1138, 2}, {0x1E81, 1140, 2}, {0x1E82, 1142, 2}, {0x1E83, 1144, 2}, {0x1E84, 1146, 2}, {0x1E85, 1148, 2},
+  {0x1E86, 1150, 2}, {0x1E87, 1152, 2}, {0x1E88, 1154, 2}, {0x1E89, 1156, 2}, {0x1E8A, 1158, 2}, {0x1E8B, 1160, 2},
+  {0x1E8C, 1162, 2}, {0x1E8D, 1164, 2}, {0x1E8E, 1166, 2}, {0x1E8F, 1168, 2}, {0x1E90, 1170, 2}, {0x1E91, 1172, 2},
+  {0x1E92, 1174, 2}, {0x1E93, 1176, 2}, {0x1E94, 1178, 2}, {0x1E95, 1180, 2}, {0x1E96, 1182, 2}, {0x1E97, 1184, 2},
+  {0x1E98, 1186, 2}, {0x1E99, 1188, 2}, {0x1E9B, 1190, 2}, {0x1EA0, 1192, 2}, {0x1EA1, 1194, 2}, {0x1EA2, 1196, 2},
+  {0x1EA3, 1198, 2}, {0x1EA4, 1200, 3}, {0x1EA5, 1203, 3}, {0x1EA6, 1206, 3}, {0x1EA7, 1209, 3}, {0x1EA8, 1212, 3},
+  {0x1EA9, 1215, 3}, {0x1EAA, 1218, 3}, {0x1EAB, 1221, 3}, {0x1EAC, 1224, 3}, {0x1EAD, 1227, 3}, {0x1EAE, 1230, 3},
+  {0x1EAF, 1233, 3}, {0x1EB0, 1236, 3}, {0x1EB1, 1239, 3}, {0x1EB2, 1242, 3}, {0x1EB3, 1245, 3}, {0x1EB4, 1248, 3},
+  {0x1EB5, 1251, 3}, {0x1EB6, 1254, 3}, {0x1EB7, 1257, 3}, {0x1EB8, 1260, 2}, {0x1EB9, 1262, 2}, {0x1EBA, 1264, 2},
+  {0x1EBB, 1266, 2}, {0x1EBC, 1268, 2}, {0x1EBD, 1270, 2}, {0x1EBE, 1272, 3}, {0x1EBF, 1275, 3}, {0x1EC0, 1278, 3},
+  {0x1EC1, 1281, 3}, {0x1EC2, 1284, 3}, {0x1EC3, 1287, 3}, {0x1EC4, 1290, 3}, {0x1EC5, 1293, 3}, {0x1EC6, 1296, 3},
+  {0x1EC7, 1299, 3}, {0x1EC8, 1302, 2}, {0x1EC9, 1304, 2}, {0x1ECA, 1306, 2}, {0x1ECB, 1308, 2}, {0x1ECC, 1310, 2},
+  {0x1ECD, 1312, 2}, {0x1ECE, 1314, 2}, {0x1ECF, 1316, 2}, {0x1ED0, 1318, 3}, {0x1ED1, 1321, 3}, {0x1ED2, 1324, 3},
+  {0x1ED3, 1327, 3}, {0x1ED4, 1330, 3}, {0x1ED5, 1333, 3}, {0x1ED6, 1336, 3}, {0x1ED7, 1339, 3}, {0x1ED8, 1342, 3},
+  {0x1ED9, 1345, 3}, {0x1EDA, 1348, 3}, {0x1EDB, 1351, 3}, {0x1EDC, 1354, 3}, {0x1EDD, 1357, 3}, {0x1EDE, 1360, 3},
+  {0x1EDF, 1363, 3}, {0x1EE0, 1366, 3}, {0x1EE1, 1369, 3}, {0x1EE2, 1372, 3}, {0x1EE3, 1375, 3}, {0x1EE4, 1378, 2},
+  {0x1EE5, 1380, 2}, {0x1EE6, 1382, 2}, {0x1EE7, 1384, 2}, {0x1EE8, 1386, 3}, {0x1EE9, 1389, 3}, {0x1EEA, 1392, 3},
+  {0x1EEB, 1395, 3}, {0x1EEC, 1398, 3}, {0x1EED, 1401, 3}, {0x1EEE, 1404, 3}, {0x1EEF, 1407, 3}, {0x1EF0, 1410, 3},
+  {0x1EF1, 1413, 3}, {0x1EF2, 1416, 2}, {0x1EF3, 1418, 2}, {0x1EF4, 1420, 2}, {0x1EF5, 1422, 2}, {0x1EF6, 1424, 2},
+  {0x1EF7, 1426, 2}, {0x1EF8, 1428, 2}, {0x1EF9, 1430, 2}, {0x1F00, 1432, 2}, {0x1F01, 1434, 2}, {0x1F02, 1436, 3},
+  {0x1F03, 1439, 3}, {0x1F04, 1442, 3}, {0x1F05, 1445, 3}, {0x1F06, 1448, 3}, {0x1F07, 1451, 3}, {0x1F08, 1454, 2},
+  {0x1F09, 1456, 2}, {0x1F0A, 1458, 3}, {0x1F0B, 1461, 3}, {0x1F0C, 1464, 3}, {0x1F0D, 1467, 3}, {0x1F0E, 1470, 3},
+  {0x1F0F, 1473, 3}, {0x1F10, 1476, 2}, {0x1F11, 1478, 2}, {0x1F12, 1480, 3}, {0x1F13, 1483, 3}, {0x1F14, 1486, 3},
+  {0x1F15, 1489, 3}, {0x1F18, 1492, 2}, {0x1F19, 1494, 2}, {0x1F1A, 1496, 3}, {0x1F1B, 1499, 3}, {0x1F1C, 1502, 3},
+  {0x1F1D, 1505, 3}, {0x1F20, 1508, 2}, {0x1F21, 1510, 2}, {0x1F22, 1512, 3}, {0x1F23, 1515, 3}, {0x1F24, 1518, 3},
+  {0x1F25, 1521, 3}, {0x1F26, 1524, 3}, {0x1F27, 1527, 3}, {0x1F28, 1530, 2}, {0x1F29, 1532, 2}, {0x1F2A, 1534, 3},
+  {0x1F2B, 1537, 3}, {0x1F2C, 1540, 3}, {0x1F2D, 1543, 3}, {0x1F2E, 1546, 3}, {0x1F2F, 1549, 3}, {0x1F30, 1552, 2},
+  {0x1F31, 1554, 2}, {0x1F32, 1556, 3}, {0x1F33, 1559, 3}, {0x1F34, 1562, 3}, {0x1F35, 1565, 3}, {0x1F36, 1568, 3},
+  {0x1F37, 1571, 3}, {0x1F38, 1574, 2}, {0x1F39, 1576, 2}, {0x1F3A, 1578, 3}, {0x1F3B, 1581, 3}, {0x1F3C, 1584, 3},
+  {0x1F3D, 1587, 3}, {0x1F3E, 1590, 3}, {0x1F3F, 1593, 3}, {0x1F40, 1596, 2}, {0x1F41, 1598, 2}, {0x1F42, 1600, 3},
+  {0x1F43, 1603, 3}, {0x1F44, 1606, 3}, {0x1F45, 1609, 3}, {0x1F48, 1612, 2}, {0x1F49, 1614, 2}, {0x1F4A, 1616, 3},
+  {0x1F4B, 1619, 3}, {0x1F4C, 1622, 3}, {0x1F4D, 1625, 3}, {0x1F50, 1628, 2}, {0x1F51, 1630, 2}, {0x1F52, 1632, 3},
+  {0x1F53, 1635, 3}, {0x1F54, 1638, 3}, {0x1F55, 1641, 3}, {0x1F56, 1644, 3}, {0x1F57, 1647, 3}, {0x1F59, 1650, 2},
+  {0x1F5B, 1652, 3}, {0x1F5D, 1655, 3}, {0x1F5F, 1658, 3}, {0x1F60, 1661, 2}, {0x1F61, 1663, 2}, {0x1F62, 1665, 3},
+  {0x1F63, 1668, 3}, {0x1F64, 1671, 3}, {0x1F65, 1674, 3}, {0x1F66, 1677, 3}, {0x1F67, 1680, 3}, {0x1F68, 1683, 2},
+  {0x1F69, 1685, 2}, {0x1F6A, 1687, 3}, {0x1F6B, 1690, 3}, {0x1F6C, 1693, 3}, {0x1F6D, 1696, 3}, {0x1F6E, 1699, 3},
+  {0x1F6F, 1702, 3}, {0x1F70, 1705, 2}, {0x1F71, 1707, 2}, {0x1F72, 1709, 2}, {0x1F73, 1711, 2}, {0x1F74, 1713, 2},
+  {0x1F75, 1715, 2}, {0x1F76, 1717, 2}, {0x1F77, 1719, 2}, {0x1F78, 1721, 2}, {0x1F79, 1723, 2}, {0x1F7A, 1725, 2},
+  {0x1F7B, 1727, 2}, {0x1F7C, 1729, 2}, {0x1F7D, 1731, 2}, {0x1F80, 1733, 3}, {0x1F81, 1736, 3}, {0x1F82, 1739, 4},
+  {0x1F83, 1743, 4}, {0x1F84, 1747, 4}, {0x1F85, 1751, 4}, {0x1F86, 1755, 4}, {0x1F87, 1759, 4}, {0x1F88, 1763, 3},
+  {0x1F89, 1766, 3}, {0x1F8A, 1769, 4}, {0x1F8B, 1773, 4}, {0x1F8C, 1777, 4}, {0x1F8D, 1781, 4}, {0x1F8E, 1785, 4},
+  {0x1F8F, 1789, 4}, {0x1F90, 1793, 3}, {0x1F91, 1796, 3}, {0x1F92, 1799, 4}, {0x1F93, 1803, 4}, {0x1F94, 1807, 4},
+  {0x1F95, 1811, 4}, {0x1F96, 1815, 4}, {0x1F97, 1819, 4}, {0x1F98, 1823, 3}, {0x1F99, 1826, 3}, {0x1F9A, 1829, 4},
+  {0x1F9B, 1833, 4}, {0x1F9C, 1837, 4}, {0x1F9D, 1841, 4}, {0x1F9E, 1845, 4}, {0x1F9F, 1849, 4}, {0x1FA0, 1853, 3},
+  {0x1FA1, 1856, 3}, {0x1FA2, 1859, 4}, {0x1FA3, 1863, 4}, {0x1FA4, 1867, 4}, {0x1FA5, 1871, 4}, {0x1FA6, 1875, 4},
+  {0x1FA7, 1879, 4}, {0x1FA8, 1883, 3}, {0x1FA9, 1886, 3}, {0x1FAA, 1889, 4}, {0x1FAB, 1893, 4}, {0x1FAC, 1897, 4},
+  {0x1FAD, 1901, 4}, {0x1FAE, 1905, 4}, {0x1FAF, 1909, 4}, {0x1FB0, 1913, 2}, {0x1FB1, 1915, 2}, {0x1FB2, 1917, 3},
+  {0x1FB3, 1920, 2}, {0x1FB4, 1922, 3}, {0x1FB6, 1925, 2}, {0x1FB7, 1927, 3}, {0x1FB8, 1930, 2}, {0x1FB9, 1932, 2},
+  {0x1FBA, 1934, 2}, {0x1FBB, 1936, 2}, {0x1FBC, 1938, 2}, {0x1FBE, 1940, 1}, {0x1FC1, 1941, 2}, {0x1FC2, 1943, 3},
+  {0x1FC3, 1946, 2}, {0x1FC4, 1948, 3}, {0x1FC6, 1951, 2}, {0x1FC7, 1953, 3}, {0x1FC8, 1956, 2}, {0x1FC9, 1958, 2},
+  {0x1FCA, 1960, 2}, {0x1FCB, 1962, 2}, {0x1FCC, 1964, 2}, {0x1FCD, 1966, 2}, {0x1FCE, 1968, 2}, {0x1FCF, 1970, 2},
+  {0x1FD0, 1972, 2}, {0x1FD1, 1974, 2}, {0x1FD2, 1976, 3}, {0x1FD3, 1979, 3}, {0x1FD6, 1982, 2}, {0x1FD7, 1984, 3},
+  {0x1FD8, 1987, 2}, {0x1FD9, 1989, 2}, {0x1FDA, 1991, 2}, {0x1FDB, 1993, 2}, {0x1FDD, 1995, 2}, {0x1FDE, 1997, 2},
+  {0x1FDF, 1999, 2}, {0x1FE0, 2001, 2}, {0x1FE1, 2003, 2}, {0x1FE2, 2005, 3}, {0x1FE3, 2008, 3}, {0x1FE4, 2011, 2},
+  {0x1FE5, 2013, 2}, {0x1FE6, 2015, 2}, {0x1FE7, 2017, 3}, {0x1FE8, 2020, 2}, {0x1FE9, 2022, 2}, {0x1FEA, 2024, 2},
+  {0x1FEB, 2026, 2}, {0x1FEC, 2028, 2}, {0x1FED, 2030, 2}, {0x1FEE, 2032, 2}, {0x1FEF, 2034, 1}, {0x1FF2, 2035, 3},
+  {0x1FF3, 2038, 2}, {0x1FF4, 2040, 3}, {0x1FF6, 2043, 2}, {0x1FF7, 2045, 3}, {0x1FF8, 2048, 2}, {0x1FF9, 2050, 2},
+  {0x1FFA, 2052, 2}, {0x1FFB, 2054, 2}, {0x1FFC, 2056, 2}, {0x1FFD, 2058, 1}, {0x2000, 2059, 1}, {0x2001, 2060, 1},
+  {0x2126, 2061, 1}, {0x212A, 2062, 1}, {0x212B, 2063, 2}, {0x219A, 2065, 2}, {0x219B, 2067, 2}, {0x21AE, 2069, 2},
+  {0x21CD, 2071, 2}, {0x21CE, 2073, 2}, {0x21CF, 2075, 2}, {0x2204, 2077, 2}, {0x2209, 2079, 2}, {0x220C, 2081, 2},
+  {0x2224, 2083, 2}, {0x2226, 2085, 2}, {0x2241, 2087, 2}, {0x2244, 2089, 2}, {0x2247, 2091, 2}, {0x2249, 2093, 2},
+  {0x2260, 2095, 2}, {0x2262, 2097, 2}, {0x226D, 2099, 2}, {0x226E, 2101, 2}, {0x226F, 2103, 2}, {0x2270, 2105, 2},
+  {0x2271, 2107, 2}, {0x2274, 2109, 2}, {0x2275, 2111, 2}, {0x2278, 2113, 2}, {0x2279, 2115, 2}, {0x2280, 2117, 2},
+  {0x2281, 2119, 2}, {0x2284, 2121, 2}, {0x2285, 2123, 2}, {0x2288, 2125, 2}, {0x2289, 2127, 2}, {0x22AC, 2129, 2},
+  {0x22AD, 2131, 2}, {0x22AE, 2133, 2}, {0x22AF, 2135, 2}, {0x22E0, 2137, 2}, {0x22E1, 2139, 2}, {0x22E2, 2141, 2},
+  {0x22E3, 2143, 2}, {0x22EA, 2145, 2}, {0x22EB, 2147, 2}, {0x22EC, 2149, 2}, {0x22ED, 2151, 2}, {0x2329, 2153, 1},
+  {0x232A, 2154, 1}, {0x2ADC, 2155, 2}, {0x304C, 2157, 2}, {0x304E, 2159, 2}, {0x3050, 2161, 2}, {0x3052, 2163, 2},
+  {0x3054, 2165, 2}, {0x3056, 2167, 2}, {0x3058, 2169, 2}, {0x305A, 2171, 2}, {0x305C, 2173, 2}, {0x305E, 2175, 2},
+  {0x3060, 2177, 2}, {0x3062, 2179, 2}, {0x3065, 2181, 2}, {0x3067, 2183, 2}, {0x3069, 2185, 2}, {0x3070, 2187, 2},
+  {0x3071, 2189, 2}, {0x3073, 2191, 2}, {0x3074, 2193, 2}, {0x3076, 2195, 2}, {0x3077, 2197, 2}, {0x3079, 2199, 2},
+  {0x307A, 2201, 2}, {0x307C, 2203, 2}, {0x307D, 2205, 2}, {0x3094, 2207, 2}, {0x309E, 2209, 2}, {0x30AC, 2211, 2},
+  {0x30AE, 2213, 2}, {0x30B0, 2215, 2}, {0x30B2, 2217, 2}, {0x30B4, 2219, 2}, {0x30B6, 2221, 2}, {0x30B8, 2223, 2},
+  {0x30BA, 2225, 2}, {0x30BC, 2227, 2}, {0x30BE, 2229, 2}, {0x30C0, 2231, 2}, {0x30C2, 2233, 2}, {0x30C5, 2235, 2},
+  {0x30C7, 2237, 2}, {0x30C9, 2239, 2}, {0x30D0, 2241, 2}, {0x30D1, 2243, 2}, {0x30D3, 2245, 2}, {0x30D4, 2247, 2},
+  {0x30D6, 2249, 2}, {0x30D7, 2251, 2}, {0x30D9, 2253, 2}, {0x30DA, 2255, 2}, {0x30DC, 2257, 2}, {0x30DD, 2259, 2},
+  {0x30F4, 2261, 2}, {0x30F7, 2263, 2}, {0x30F8, 2265, 2}, {0x30F9, 2267, 2}, {0x30FA, 2269, 2}, {0x30FE, 2271, 2},
+  {0xF900, 2273, 1}, {0xF901, 2274, 1}, {0xF902, 2275, 1}, {0xF903, 2276, 1}, {0xF904, 2277, 1}, {0xF905, 2278, 1},
+  {0xF906, 2279, 1}, {0xF907, 2280, 1}, {0xF908, 2281, 1}, {0xF909, 2282, 1}, {0xF90A, 2283, 1}, {0xF90B, 2284, 1},
+  {0xF90C, 2285, 1}, {0xF90D, 2286, 1}, {0xF90E, 2287, 1}, {0xF90F, 2288, 1}, {0xF910, 2289, 1}, {0xF911, 2290, 1},
+  {0xF912, 2291, 1}, {0xF913, 2292, 1}, {0xF914, 2293, 1}, {0xF915, 2294, 1}, {0xF916, 2295, 1}, {0xF917, 2296, 1},
+  {0xF918, 2297, 1}, {0xF919, 2298, 1}, {0xF91A, 2299, 1}, {0xF91B, 2300, 1}, {0xF91C, 2301, 1}, {0xF91D, 2302, 1},
+  {0xF91E, 2303, 1}, {0xF91F, 2304, 1}, {0xF920, 2305, 1}, {0xF921, 2306, 1}, {0xF922, 2307, 1}, {0xF923, 2308, 1},
+  {0xF924, 2309, 1}, {0xF925, 2310, 1}, {0xF926, 2311, 1}, {0xF927, 2312, 1}, {0xF928, 2313, 1}, {0xF929, 2314, 1},
+  {0xF92A, 2315, 1}, {0xF92B, 2316, 1}, {0xF92C, 2317, 1}, {0xF92D, 2318, 1}, {0xF92E, 2319, 1}, {0xF92F, 2320, 1},
+  {0xF930, 2321, 1}, {0xF931, 2322, 1}, {0xF932, 2323, 1}, {0xF933, 2324, 1}, {0xF934, 2325, 1}, {0xF935, 2326, 1},
+  {0xF936, 2327, 1}, {0xF937, 2328, 1}, {0xF938, 2329, 1}, {0xF939, 2330, 1}, {0xF93A, 2331, 1}, {0xF93B, 2332, 1},
+  {0xF93C, 2333, 1}, {0xF93D, 2334, 1}, {0xF93E, 2335, 1}, {0xF93F, 2336, 1}, {0xF940, 2337, 1}, {0xF941, 2338, 1},
+  {0xF942, 2339, 1}, {0xF943, 2340, 1}, {0xF944, 2341, 1}, {0xF945, 2342, 1}, {0xF946, 2343, 1}, {0xF947, 2344, 1},
+  {0xF948, 2345, 1}, {0xF949, 2346, 1}, {0xF94A, 2347, 1}, {0xF94B, 2348, 1}, {0xF94C, 2349, 1}, {0xF94D, 2350, 1},
+  {0xF94E, 2351, 1}, {0xF94F, 2352, 1}, {0xF950, 2353, 1}, {0xF951, 2354, 1}, {0xF952, 2355, 1}, {0xF953, 2356, 1},
+  {0xF954, 2357, 1}, {0xF955, 2358, 1}, {0xF956, 2359, 1}, {0xF957, 2360, 1}, {0xF958, 2361, 1}, {0xF959, 2362, 1},
+  {0xF95A, 2363, 1}, {0xF95B, 2364, 1}, {0xF95C, 2365, 1}, {0xF95D, 2366, 1}, {0xF95E, 2367, 1}, {0xF95F, 2368, 1},
+  {0xF960, 2369, 1}, {0xF961, 2370, 1}, {0xF962, 2371, 1}, {0xF963, 2372, 1}, {0xF964, 2373, 1}, {0xF965, 2374, 1},
+  {0xF966, 2375, 1}, {0xF967, 2376, 1}, {0xF968, 2377, 1}, {0xF969, 2378, 1}, {0xF96A, 2379, 1}, {0xF96B, 2380, 1},
+  {0xF96C, 2381, 1}, {0xF96D, 2382, 1}, {0xF96E, 2383, 1}, {0xF96F, 2384, 1}, {0xF970, 2385, 1}, {0xF971, 2386, 1},
+  {0xF972, 2387, 1}, {0xF973, 2388, 1}, {0xF974, 2389, 1}, {0xF975, 2390, 1}, {0xF976, 2391, 1}, {0xF977, 2392, 1},
+  {0xF978, 2393, 1}, {0xF979, 2394, 1}, {0xF97A, 2395, 1}, {0xF97B, 2396, 1}, {0xF97C, 2397, 1}, {0xF97D, 2398, 1},
+  {0xF97E, 2399, 1}, {0xF97F, 2400, 1}, {0xF980, 2401, 1}, {0xF981, 2402, 1}, {0xF982, 2403, 1}, {0xF983, 2404, 1},
+  {0xF984, 2405, 1}, {0xF985, 2406, 1}, {0xF986, 2407, 1}, {0xF987, 2408, 1}, {0xF988, 2409, 1}, {0xF989, 2410, 1},
+  {0xF98A, 2411, 1}, {0xF98B, 2412, 1}, {0xF98C, 2413, 1}, {0xF98D, 2414, 1}, {0xF98E, 2415, 1}, {0xF98F, 2416, 1},
+  {0xF990, 2417, 1}, {0xF991, 2418, 1}, {0xF992, 2419, 1}, {0xF993, 2420, 1}, {0xF994, 2421, 1}, {0xF995, 2422, 1},
+  {0xF996, 2423, 1}, {0xF997, 2424, 1}, {0xF998, 2425, 1}, {0xF999, 2426, 1}, {0xF99A, 2427, 1}, {0xF99B, 2428, 1},
+  {0xF99C, 2429, 1}, {0xF99D, 2430, 1}, {0xF99E, 2431, 1}, {0xF99F, 2432, 1}, {0xF9A0, 2433, 1}, {0xF9A1, 2434, 1},
+  {0xF9A2, 2435, 1}, {0xF9A3, 2436, 1}, {0xF9A4, 2437, 1}, {0xF9A5, 2438, 1}, {0xF9A6, 2439, 1}, {0xF9A7, 2440, 1},
+  {0xF9A8, 2441, 1}, {0xF9A9, 2442, 1}, {0xF9AA, 2443, 1}, {0xF9AB, 2444, 1}, {0xF9AC, 2445, 1}, {0xF9AD, 2446, 1},
+  {0xF9AE, 2447, 1}, {0xF9AF, 2448, 1}, {0xF9B0, 2449, 1}, {0xF9B1, 2450, 1}, {0xF9B2, 2451, 1}, {0xF9B3, 2452, 1},
+  {0xF9B4, 2453, 1}, {0xF9B5, 2454, 1}, {0xF9B6, 2455, 1}, {0xF9B7, 2456, 1}, {0xF9B8, 2457, 1}, {0xF9B9, 2458, 1},
+  {0xF9BA, 2459, 1}, {0xF9BB, 2460, 1}, {0xF9BC, 2461, 1}, {0xF9BD, 2462, 1}, {0xF9BE, 2463, 1}, {0xF9BF, 2464, 1},
+  {0xF9C0, 2465, 1}, {0xF9C1, 2466, 1}, {0xF9C2, 2467, 1}, {0xF9C3, 2468, 1}, {0xF9C4, 2469, 1}, {0xF9C5, 2470, 1},
+  {0xF9C6, 2471, 1}, {0xF9C7, 2472, 1}, {0xF9C8, 2473, 1}, {0xF9C9, 2474, 1}, {0xF9CA, 2475, 1}, {0xF9CB, 2476, 1},
+  {0xF9CC, 2477, 1}, {0xF9CD, 2478, 1}, {0xF9CE, 2479, 1}, {0xF9CF, 2480, 1}, {0xF9D0, 2481, 1}, {0xF9D1, 2482, 1},
+  {0xF9D2, 2483, 1}, {0xF9D3, 2484, 1}, {0xF9D4, 2485, 1}, {0xF9D5, 2486, 1}, {0xF9D6, 2487, 1}, {0xF9D7, 2488, 1},
+  {0xF9D8, 2489, 1}, {0xF9D9, 2490, 1}, {0xF9DA, 2491, 1}, {0xF9DB, 2492, 1}, {0xF9DC, 2493, 1}, {0xF9DD, 2494, 1},
+  {0xF9DE, 2495, 1}, {0xF9DF, 2496, 1}, {0xF9E0, 2497, 1}, {0xF9E1, 2498, 1}, {0xF9E2, 2499, 1}, {0xF9E3, 2500, 1},
+  {0xF9E4, 2501, 1}, {0xF9E5, 2502, 1}, {0xF9E6, 2503, 1}, {0xF9E7, 2504, 1}, {0xF9E8, 2505, 1}, {0xF9E9, 2506, 1},
+  {0xF9EA, 2507, 1}, {0xF9EB, 2508, 1}, {0xF9EC, 2509, 1}, {0xF9ED, 2510, 1}, {0xF9EE, 2511, 1}, {0xF9EF, 2512, 1},
+  {0xF9F0, 2513, 1}, {0xF9F1, 2514, 1}, {0xF9F2, 2515, 1}, {0xF9F3, 2516, 1}, {0xF9F4, 2517, 1}, {0xF9F5, 2518, 1},
+  {0xF9F6, 2519, 1}, {0xF9F7, 2520, 1}, {0xF9F8, 2521, 1}, {0xF9F9, 2522, 1}, {0xF9FA, 2523, 1}, {0xF9FB, 2524, 1},
+  {0xF9FC, 2525, 1}, {0xF9FD, 2526, 1}, {0xF9FE, 2527, 1}, {0xF9FF, 2528, 1}, {0xFA00, 2529, 1}, {0xFA01, 2530, 1},
+  {0xFA02, 2531, 1}, {0xFA03, 2532, 1}, {0xFA04, 2533, 1}, {0xFA05, 2534, 1}, {0xFA06, 2535, 1}, {0xFA07, 2536, 1},
+  {0xFA08, 2537, 1}, {0xFA09, 2538, 1}, {0xFA0A, 2539, 1}, {0xFA0B, 2540, 1}, {0xFA0C, 2541, 1}, {0xFA0D, 2542, 1},
+  {0xFA10, 2543, 1}, {0xFA12, 2544, 1}, {0xFA15, 2545, 1}, {0xFA16, 2546, 1}, {0xFA17, 2547, 1}, {0xFA18, 2548, 1},
+  {0xFA19, 2549, 1}, {0xFA1A, 2550, 1}, {0xFA1B, 2551, 1}, {0xFA1C, 2552, 1}, {0xFA1D, 2553, 1}, {0xFA1E, 2554, 1},
+  {0xFA20, 2555, 1}, {0xFA22, 2556, 1}, {0xFA25, 2557, 1}, {0xFA26, 2558, 1}, {0xFA2A, 2559, 1}, {0xFA2B, 2560, 1},
+  {0xFA2C, 2561, 1}, {0xFA2D, 2562, 1}, {0xFA2E, 2563, 1}, {0xFA2F, 2564, 1}, {0xFA30, 2565, 1}, {0xFA31, 2566, 1},
+  {0xFA32, 2567, 1}, {0xFA33, 2568, 1}, {0xFA34, 2569, 1}, {0xFA35, 2570, 1}, {0xFA36, 2571, 1}, {0xFA37, 2572, 1},
+  {0xFA38, 2573, 1}, {0xFA39, 2574, 1}, {0xFA3A, 2575, 1}, {0xFA3B, 2576, 1}, {0xFA3C, 2577, 1}, {0xFA3D, 2578, 1},
+  {0xFA3E, 2579, 1}, {0xFA3F, 2580, 1}, {0xFA40, 2581, 1}, {0xFA41, 2582, 1}, {0xFA42, 2583, 1}, {0xFA43, 2584, 1},
+  {0xFA44, 2585, 1}, {0xFA45, 2586, 1}, {0xFA46, 2587, 1}, {0xFA47, 2588, 1}, {0xFA48, 2589, 1}, {0xFA49, 2590, 1},
+  {0xFA4A, 2591, 1}, {0xFA4B, 2592, 1}, {0xFA4C, 2593, 1}, {0xFA4D, 2594, 1}, {0xFA4E, 2595, 1}, {0xFA4F, 2596, 1},
+  {0xFA50, 2597, 1}, {0xFA51, 2598, 1}, {0xFA52, 2599, 1}, {0xFA53, 2600, 1}, {0xFA54, 2601, 1}, {0xFA55, 2602, 1},
+  {0xFA56, 2603, 1}, {0xFA57, 2604, 1}, {0xFA58, 2605, 1}, {0xFA59, 2606, 1}, {0xFA5A, 2607, 1}, {0xFA5B, 2608, 1},
+  {0xFA5C, 2609, 1}, {0xFA5D, 2610, 1}, {0xFA5E, 2611, 1}, {0xFA5F, 2612, 1}, {0xFA60, 2613, 1}, {0xFA61, 2614, 1},
+  {0xFA62, 2615, 1}, {0xFA63, 2616, 1}, {0xFA64, 2617, 1}, {0xFA65, 2618, 1}, {0xFA66, 2619, 1}, {0xFA67, 2620, 1},
+  {0xFA68, 2621, 1}, {0xFA69, 2622, 1}, {0xFA6A, 2623, 1}, {0xFA6B, 2624, 1}, {0xFA6C, 2625, 1}, {0xFA6D, 2626, 1},
+  {0xFA70, 2627, 1}, {0xFA71, 2628, 1}, {0xFA72, 2629, 1}, {0xFA73, 2630, 1}, {0xFA74, 2631, 1}, {0xFA75, 2632, 1},
+  {0xFA76, 2633, 1}, {0xFA77, 2634, 1}, {0xFA78, 2635, 1}, {0xFA79, 2636, 1}, {0xFA7A, 2637, 1}, {0xFA7B, 2638, 1},
+  {0xFA7C, 2639, 1}, {0xFA7D, 2640, 1}, {0xFA7E, 2641, 1}, {0xFA7F, 2642, 1}, {0xFA80, 2643, 1}, {0xFA81, 2644, 1},
+  {0xFA82, 2645, 1}, {0xFA83, 2646, 1}, {0xFA84, 2647, 1}, {0xFA85, 2648, 1}, {0xFA86, 2649, 1}, {0xFA87, 2650, 1},
+  {0xFA88, 2651, 1}, {0xFA89, 2652, 1}, {0xFA8A, 2653, 1}, {0xFA8B, 2654, 1}, {0xFA8C, 2655, 1}, {0xFA8D, 2656, 1},
+  {0xFA8E, 2657, 1}, {0xFA8F, 2658, 1}, {0xFA90, 2659, 1}, {0xFA91, 2660, 1}, {0xFA92, 2661, 1}, {0xFA93, 2662, 1},
+  {0xFA94, 2663, 1}, {0xFA95, 2664, 1}, {0xFA96, 2665, 1}, {0xFA97, 2666, 1}, {0xFA98, 2667, 1}, {0xFA99, 2668, 1},
+  {0xFA9A, 2669, 1}, {0xFA9B, 2670, 1}, {0xFA9C, 2671, 1}, {0xFA9D, 2672, 1}, {0xFA9E, 2673, 1}, {0xFA9F, 2674, 1},
+  {0xFAA0, 2675, 1}, {0xFAA1, 2676, 1}, {0xFAA2, 2677, 1}, {0xFAA3, 2678, 1}, {0xFAA4, 2679, 1}, {0xFAA5, 2680, 1},
+  {0xFAA6, 2681, 1}, {0xFAA7, 2682, 1}, {0xFAA8, 2683, 1}, {0xFAA9, 2684, 1}, {0xFAAA, 2685, 1}, {0xFAAB, 2686, 1},
+  {0xFAAC, 2687, 1}, {0xFAAD, 2688, 1}, {0xFAAE, 2689, 1}, {0xFAAF, 2690, 1}, {0xFAB0, 2691, 1}, {0xFAB1, 2692, 1},
+  {0xFAB2, 2693, 1}, {0xFAB3, 2694, 1}, {0xFAB4, 2695, 1}, {0xFAB5, 2696, 1}, {0xFAB6, 2697, 1}, {0xFAB7, 2698, 1},
+  {0xFAB8, 2699, 1}, {0xFAB9, 2700, 1}, {0xFABA, 2701, 1}, {0xFABB, 2702, 1}, {0xFABC, 2703, 1}, {0xFABD, 2704, 1},
+  {0xFABE, 2705, 1}, {0xFABF, 2706, 1}, {0xFAC0, 2707, 1}, {0xFAC1, 2708, 1}, {0xFAC2, 2709, 1}, {0xFAC3, 2710, 1},
+  {0xFAC4, 2711, 1}, {0xFAC5, 2712, 1}, {0xFAC6, 2713, 1}, {0xFAC7, 2714, 1}, {0xFAC8, 2715, 1}, {0xFAC9, 2716, 1},
+  {0xFACA, 2717, 1}, {0xFACB, 2718, 1}, {0xFACC, 2719, 1}, {0xFACD, 2720, 1}, {0xFACE, 2721, 1}, {0xFACF, 2722, 1},
+  {0xFAD0, 2723, 1}, {0xFAD1, 2724, 1}, {0xFAD2, 2725, 1}, {0xFAD3, 2726, 1}, {0xFAD4, 2727, 1}, {0xFAD5, 2728, 1},
+  {0xFAD6, 2729, 1}, {0xFAD7, 2730, 1}, {0xFAD8, 2731, 1}, {0xFAD9, 2732, 1}, {0xFB1D, 2733, 2}, {0xFB1F, 2735, 2},
+  {0xFB2A, 2737, 2}, {0xFB2B, 2739, 2}, {0xFB2C, 2741, 3}, {0xFB2D, 2744, 3}, {0xFB2E, 2747, 2}, {0xFB2F, 2749, 2},
+  {0xFB30, 2751, 2}, {0xFB31, 2753, 2}, {0xFB32, 2755, 2}, {0xFB33, 2757, 2}, {0xFB34, 2759, 2}, {0xFB35, 2761, 2},
+  {0xFB36, 2763, 2}, {0xFB38, 2765, 2}, {0xFB39, 2767, 2}, {0xFB3A, 2769, 2}, {0xFB3B, 2771, 2}, {0xFB3C, 2773, 2},
+  {0xFB3E, 2775, 2}, {0xFB40, 2777, 2}, {0xFB41, 2779, 2}, {0xFB43, 2781, 2}, {0xFB44, 2783, 2}, {0xFB46, 2785, 2},
+  {0xFB47, 2787, 2}, {0xFB48, 2789, 2}, {0xFB49, 2791, 2}, {0xFB4A, 2793, 2}, {0xFB4B, 2795, 2}, {0xFB4C, 2797, 2},
+  {0xFB4D, 2799, 2}, {0xFB4E, 2801, 2}, {0x1109A, 2803, 2}, {0x1109C, 2805, 2}, {0x110AB, 2807, 2}, {0x1112E, 2809, 2},
+  {0x1112F, 2811, 2}, {0x1134B, 2813, 2}, {0x1134C, 2815, 2}, {0x114BB, 2817, 2}, {0x114BC, 2819, 2},
+  {0x114BE, 2821, 2}, {0x115BA, 2823, 2}, {0x115BB, 2825, 2}, {0x11938, 2827, 2}, {0x1D15E, 2829, 2},
+  {0x1D15F, 2831, 2}, {0x1D160, 2833, 3}, {0x1D161, 2836, 3}, {0x1D162, 2839, 3}, {0x1D163, 2842, 3},
+  {0x1D164, 2845, 3}, {0x1D1BB, 2848, 2}, {0x1D1BC, 2850, 2}, {0x1D1BD, 2852, 3}, {0x1D1BE, 2855, 3},
+  {0x1D1BF, 2858, 3}, {0x1D1C0, 2861, 3}, {0x2F800, 2864, 1}, {0x2F801, 2865, 1}, {0x2F802, 2866, 1},
+  {0x2F803, 2867, 1}, {0x2F804, 2868, 1}, {0x2F805, 2869, 1}, {0x2F806, 2870, 1}, {0x2F807, 2871, 1},
+  {0x2F808, 2872, 1}, {0x2F809, 2873, 1}, {0x2F80A, 2874, 1}, {0x2F80B, 2875, 1}, {0x2F80C, 2876, 1},
+  {0x2F80D, 2877, 1}, {0x2F80E, 2878, 1}, {0x2F80F, 2879, 1}, {0x2F810, 2880, 1}, {0x2F811, 2881, 1},
+  {0x2F812, 2882, 1}, {0x2F813, 2883, 1}, {0x2F814, 2884, 1}, {0x2F815, 2885, 1}, {0x2F816, 2886, 1},
+  {0x2F817, 2887, 1}, {0x2F818, 2888, 1}, {0x2F819, 2889, 1}, {0x2F81A, 2890, 1}, {0x2F81B, 2891, 1},
+  {0x2F81C, 2892, 1}, {0x2F81D, 2893, 1}, {0x2F81E, 2894, 1}, {0x2F81F, 2895, 1}, {0x2F820, 2896, 1},
+  {0x2F821, 2897, 1}, {0x2F822, 2898, 1}, {0x2F823, 2899, 1}, {0x2F824, 2900, 1}, {0x2F825, 2901, 1},
+  {0x2F826, 2902, 1}, {0x2F827, 2903, 1}, {0x2F828, 2904, 1}, {0x2F829, 2905, 1}, {0x2F82A, 2906, 1},
+  {0x2F82B, 2907, 1}, {0x2F82C, 2908, 1}, {0x2F82D, 2909, 1}, {0x2F82E, 2910, 1}, {0x2F82F, 2911, 1},
+  {0x2F830, 2912, 1}, {0x2F831, 2913, 1}, {0x2F832, 2914, 1}, {0x2F833, 2915, 1}, {0x2F834, 2916, 1},
+  {0x2F835, 2917, 1}, {0x2F836, 2918, 1}, {0x2F837, 2919, 1}, {0x2F838, 2920, 1}, {0x2F839, 2921, 1},
+  {0x2F83A, 2922, 1}, {0x2F83B, 2923, 1}, {0x2F83C, 2924, 1}, {0x2F83D, 2925, 1}, {0x2F83E, 2926, 1},
+  {0x2F83F, 2927, 1}, {0x2F840, 2928, 1}, {0x2F841, 2929, 1}, {0x2F842, 2930, 1}, {0x2F843, 2931, 1},
+  {0x2F844, 2932, 1}, {0x2F845, 2933, 1}, {0x2F846, 2934, 1}, {0x2F847, 2935, 1}, {0x2F848, 2936, 1},
+  {0x2F849, 2937, 1}, {0x2F84A, 2938, 1}, {0x2F84B, 2939, 1}, {0x2F84C, 2940, 1}, {0x2F84D, 2941, 1},
+  {0x2F84E, 2942, 1}, {0x2F84F, 2943, 1}, {0x2F850, 2944, 1}, {0x2F851, 2945, 1}, {0x2F852, 2946, 1},
+  {0x2F853, 2947, 1}, {0x2F854, 2948, 1}, {0x2F855, 2949, 1}, {0x2F856, 2950, 1}, {0x2F857, 2951, 1},
+  {0x2F858, 2952, 1}, {0x2F859, 2953, 1}, {0x2F85A, 2954, 1}, {0x2F85B, 2955, 1}, {0x2F85C, 2956, 1},
+  {0x2F85D, 2957, 1}, {0x2F85E, 2958, 1}, {0x2F85F, 2959, 1}, {0x2F860, 2960, 1}, {0x2F861, 2961, 1},
+  {0x2F862, 2962, 1}, {0x2F863, 2963, 1}, {0x2F864, 2964, 1}, {0x2F865, 2965, 1}, {0x2F866, 2966, 1},
+  {0x2F867, 2967, 1}, {0x2F868, 2968, 1}, {0x2F869, 2969, 1}, {0x2F86A, 2970, 1}, {0x2F86B, 2971, 1},
+  {0x2F86C, 2972, 1}, {0x2F86D, 2973, 1}, {0x2F86E, 2974, 1}, {0x2F86F, 2975, 1}, {0x2F870, 2976, 1},
+  {0x2F871, 2977, 1}, {0x2F872, 2978, 1}, {0x2F873, 2979, 1}, {0x2F874, 2980, 1}, {0x2F875, 2981, 1},
+  {0x2F876, 2982, 1}, {0x2F877, 2983, 1}, {0x2F878, 2984, 1}, {0x2F879, 2985, 1}, {0x2F87A, 2986, 1},
+  {0x2F87B, 2987, 1}, {0x2F87C, 2988, 1}, {0x2F87D, 2989, 1}, {0x2F87E, 2990, 1}, {0x2F87F, 2991, 1},
+  {0x2F880, 2992, 1}, {0x2F881, 2993, 1}, {0x2F882, 2994, 1}, {0x2F883, 2995, 1}, {0x2F884, 2996, 1},
+  {0x2F885, 2997, 1}, {0x2F886, 2998, 1}, {0x2F887, 2999, 1}, {0x2F888, 3000, 1}, {0x2F889, 3001, 1},
+  {0x2F88A, 3002, 1}, {0x2F88B, 3003, 1}, {0x2F88C, 3004, 1}, {0x2F88D, 3005, 1}, {0x2F88E, 3006, 1},
+  {0x2F88F, 3007, 1}, {0x2F890, 3008, 1}, {0x2F891, 3009, 1}, {0x2F892, 3010, 1}, {0x2F893, 3011, 1},
+  {0x2F894, 3012, 1}, {0x2F895, 3013, 1}, {0x2F896, 3014, 1}, {0x2F897, 3015, 1}, {0x2F898, 3016, 1},
+  {0x2F899, 3017, 1}, {0x2F89A, 3018, 1}, {0x2F89B, 3019, 1}, {0x2F89C, 3020, 1}, {0x2F89D, 3021, 1},
+  {0x2F89E, 3022, 1}, {0x2F89F, 3023, 1}, {0x2F8A0, 3024, 1}, {0x2F8A1, 3025, 1}, {0x2F8A2, 3026, 1},
+  {0x2F8A3, 3027, 1}, {0x2F8A4, 3028, 1}, {0x2F8A5, 3029, 1}, {0x2F8A6, 3030, 1}, {0x2F8A7, 3031, 1},
+  {0x2F8A8, 3032, 1}, {0x2F8A9, 3033, 1}, {0x2F8AA, 3034, 1}, {0x2F8AB, 3035, 1}, {0x2F8AC, 3036, 1},
+  {0x2F8AD, 3037, 1}, {0x2F8AE, 3038, 1}, {0x2F8AF, 3039, 1}, {0x2F8B0, 3040, 1}, {0x2F8B1, 3041, 1},
+  {0x2F8B2, 3042, 1}, {0x2F8B3, 3043, 1}, {0x2F8B4, 3044, 1}, {0x2F8B5, 3045, 1}, {0x2F8B6, 3046, 1},
+  {0x2F8B7, 3047, 1}, {0x2F8B8, 3048, 1}, {0x2F8B9, 3049, 1}, {0x2F8BA, 3050, 1}, {0x2F8BB, 3051, 1},
+  {0x2F8BC, 3052, 1}, {0x2F8BD, 3053, 1}, {0x2F8BE, 3054, 1}, {0x2F8BF, 3055, 1}, {0x2F8C0, 3056, 1},
+  {0x2F8C1, 3057, 1}, {0x2F8C2, 3058, 1}, {0x2F8C3, 3059, 1}, {0x2F8C4, 3060, 1}, {0x2F8C5, 3061, 1},
+  {0x2F8C6, 3062, 1}, {0x2F8C7, 3063, 1}, {0x2F8C8, 3064, 1}, {0x2F8C9, 3065, 1}, {0x2F8CA, 3066, 1},
+  {0x2F8CB, 3067, 1}, {0x2F8CC, 3068, 1}, {0x2F8CD, 3069, 1}, {0x2F8CE, 3070, 1}, {0x2F8CF, 3071, 1},
+  {0x2F8D0, 3072, 1}, {0x2F8D1, 3073, 1}, {0x2F8D2, 3074, 1}, {0x2F8D3, 3075, 1}, {0x2F8D4, 3076, 1},
+  {0x2F8D5, 3077, 1}, {0x2F8D6, 3078, 1}, {0x2F8D7, 3079, 1}, {0x2F8D8, 3080, 1}, {0x2F8D9, 3081, 1},
+  {0x2F8DA, 3082, 1}, {0x2F8DB, 3083, 1}, {0x2F8DC, 3084, 1}, {0x2F8DD, 3085, 1}, {0x2F8DE, 3086, 1},
+  {0x2F8DF, 3087, 1}, {0x2F8E0, 3088, 1}, {0x2F8E1, 3089, 1}, {0x2F8E2, 3090, 1}, {0x2F8E3, 3091, 1},
+  {0x2F8E4, 3092, 1}, {0x2F8E5, 3093, 1}, {0x2F8E6, 3094, 1}, {0x2F8E7, 3095, 1}, {0x2F8E8, 3096, 1},
+  {0x2F8E9, 3097, 1}, {0x2F8EA, 3098, 1}, {0x2F8EB, 3099, 1}, {0x2F8EC, 3100, 1}, {0x2F8ED, 3101, 1},
+  {0x2F8EE, 3102, 1}, {0x2F8EF, 3103, 1}, {0x2F8F0, 3104, 1}, {0x2F8F1, 3105, 1}, {0x2F8F2, 3106, 1},
+  {0x2F8F3, 3107, 1}, {0x2F8F4, 3108, 1}, {0x2F8F5, 3109, 1}, {0x2F8F6, 3110, 1}, {0x2F8F7, 3111, 1},
+  {0x2F8F8, 3112, 1}, {0x2F8F9, 3113, 1}, {0x2F8FA, 3114, 1}, {0x2F8FB, 3115, 1}, {0x2F8FC, 3116, 1},
+  {0x2F8FD, 3117, 1}, {0x2F8FE, 3118, 1}, {0x2F8FF, 3119, 1}, {0x2F900, 3120, 1}, {0x2F901, 3121, 1},
+  {0x2F902, 3122, 1}, {0x2F903, 3123, 1}, {0x2F904, 3124, 1}, {0x2F905, 3125, 1}, {0x2F906, 3126, 1},
+  {0x2F907, 3127, 1}, {0x2F908, 3128, 1}, {0x2F909, 3129, 1}, {0x2F90A, 3130, 1}, {0x2F90B, 3131, 1},
+  {0x2F90C, 3132, 1}, {0x2F90D, 3133, 1}, {0x2F90E, 3134, 1}, {0x2F90F, 3135, 1}, {0x2F910, 3136, 1},
+  {0x2F911, 3137, 1}, {0x2F912, 3138, 1}, {0x2F913, 3139, 1}, {0x2F914, 3140, 1}, {0x2F915, 3141, 1},
+  {0x2F916, 3142, 1}, {0x2F917, 3143, 1}, {0x2F918, 3144, 1}, {0x2F919, 3145, 1}, {0x2F91A, 3146, 1},
+  {0x2F91B, 3147, 1}, {0x2F91C, 3148, 1}, {0x2F91D, 3149, 1}, {0x2F91E, 3150, 1}, {0x2F91F, 3151, 1},
+  {0x2F920, 3152, 1}, {0x2F921, 3153, 1}, {0x2F922, 3154, 1}, {0x2F923, 3155, 1}, {0x2F924, 3156, 1},
+  {0x2F925, 3157, 1}, {0x2F926, 3158, 1}, {0x2F927, 3159, 1}, {0x2F928, 3160, 1}, {0x2F929, 3161, 1},
+  {0x2F92A, 3162, 1}, {0x2F92B, 3163, 1}, {0x2F92C, 3164, 1}, {0x2F92D, 3165, 1}, {0x2F92E, 3166, 1},
+  {0x2F92F, 3167, 1}, {0x2F930, 3168, 1}, {0x2F931, 3169, 1}, {0x2F932, 3170, 1}, {0x2F933, 3171, 1},
+  {0x2F934, 3172, 1}, {0x2F935, 3173, 1}, {0x2F936, 3174, 1}, {0x2F937, 3175, 1}, {0x2F938, 3176, 1},
+  {0x2F939, 3177, 1}, {0x2F93A, 3178, 1}, {0x2F93B, 3179, 1}, {0x2F93C, 3180, 1}, {0x2F93D, 3181, 1},
+  {0x2F93E, 3182, 1}, {0x2F93F, 3183, 1}, {0x2F940, 3184, 1}, {0x2F941, 3185, 1}, {0x2F942, 3186, 1},
+  {0x2F943, 3187, 1}, {0x2F944, 3188, 1}, {0x2F945, 3189, 1}, {0x2F946, 3190, 1}, {0x2F947, 3191, 1},
+  {0x2F948, 3192, 1}, {0x2F949, 3193, 1}, {0x2F94A, 3194, 1}, {0x2F94B, 3195, 1}, {0x2F94C, 3196, 1},
+  {0x2F94D, 3197, 1}, {0x2F94E, 3198, 1}, {0x2F94F, 3199, 1}, {0x2F950, 3200, 1}, {0x2F951, 3201, 1},
+  {0x2F952, 3202, 1}, {0x2F953, 3203, 1}, {0x2F954, 3204, 1}, {0x2F955, 3205, 1}, {0x2F956, 3206, 1},
+  {0x2F957, 3207, 1}, {0x2F958, 3208, 1}, {0x2F959, 3209, 1}, {0x2F95A, 3210, 1}, {0x2F95B, 3211, 1},
+  {0x2F95C, 3212, 1}, {0x2F95D, 3213, 1}, {0x2F95E, 3214, 1}, {0x2F95F, 3215, 1}, {0x2F960, 3216, 1},
+  {0x2F961, 3217, 1}, {0x2F962, 3218, 1}, {0x2F963, 3219, 1}, {0x2F964, 3220, 1}, {0x2F965, 3221, 1},
+  {0x2F966, 3222, 1}, {0x2F967, 3223, 1}, {0x2F968, 3224, 1}, {0x2F969, 3225, 1}, {0x2F96A, 3226, 1},
+  {0x2F96B, 3227, 1}, {0x2F96C, 3228, 1}, {0x2F96D, 3229, 1}, {0x2F96E, 3230, 1}, {0x2F96F, 3231, 1},
+  {0x2F970, 3232, 1}, {0x2F971, 3233, 1}, {0x2F972, 3234, 1}, {0x2F973, 3235, 1}, {0x2F974, 3236, 1},
+  {0x2F975, 3237, 1}, {0x2F976, 3238, 1}, {0x2F977, 3239, 1}, {0x2F978, 3240, 1}, {0x2F979, 3241, 1},
+  {0x2F97A, 3242, 1}, {0x2F97B, 3243, 1}, {0x2F97C, 3244, 1}, {0x2F97D, 3245, 1}, {0x2F97E, 3246, 1},
+  {0x2F97F, 3247, 1}, {0x2F980, 3248, 1}, {0x2F981, 3249, 1}, {0x2F982, 3250, 1}, {0x2F983, 3251, 1},
+  {0x2F984, 3252, 1}, {0x2F985, 3253, 1}, {0x2F986, 3254, 1}, {0x2F987, 3255, 1}, {0x2F988, 3256, 1},
+  {0x2F989, 3257, 1}, {0x2F98A, 3258, 1}, {0x2F98B, 3259, 1}, {0x2F98C, 3260, 1}, {0x2F98D, 3261, 1},
+  {0x2F98E, 3262, 1}, {0x2F98F, 3263, 1}, {0x2F990, 3264, 1}, {0x2F991, 3265, 1}, {0x2F992, 3266, 1},
+  {0x2F993, 3267, 1}, {0x2F994, 3268, 1}, {0x2F995, 3269, 1}, {0x2F996, 3270, 1}, {0x2F997, 3271, 1},
+  {0x2F998, 3272, 1}, {0x2F999, 3273, 1}, {0x2F99A, 3274, 1}, {0x2F99B, 3275, 1}, {0x2F99C, 3276, 1},
+  {0x2F99D, 3277, 1}, {0x2F99E, 3278, 1}, {0x2F99F, 3279, 1}, {0x2F9A0, 3280, 1}, {0x2F9A1, 3281, 1},
+  {0x2F9A2, 3282, 1}, {0x2F9A3, 3283, 1}, {0x2F9A4, 3284, 1}, {0x2F9A5, 3285, 1}, {0x2F9A6, 3286, 1},
+  {0x2F9A7, 3287, 1}, {0x2F9A8, 3288, 1}, {0x2F9A9, 3289, 1}, {0x2F9AA, 3290, 1}, {0x2F9AB, 3291, 1},
+  {0x2F9AC, 3292, 1}, {0x2F9AD, 3293, 1}, {0x2F9AE, 3294, 1}, {0x2F9AF, 3295, 1}, {0x2F9B0, 3296, 1},
+  {0x2F9B1, 3297, 1}, {0x2F9B2, 3298, 1}, {0x2F9B3, 3299, 1}, {0x2F9B4, 3300, 1}, {0x2F9B5, 3301, 1},
+  {0x2F9B6, 3302, 1}, {0x2F9B7, 3303, 1}, {0x2F9B8, 3304, 1}, {0x2F9B9, 3305, 1}, {0x2F9BA, 3306, 1},
+  {0x2F9BB, 3307, 1}, {0x2F9BC, 3308, 1}, {0x2F9BD, 3309, 1}, {0x2F9BE, 3310, 1}, {0x2F9BF, 3311, 1},
+  {0x2F9C0, 3312, 1}, {0x2F9C1, 3313, 1}, {0x2F9C2, 3314, 1}, {0x2F9C3, 3315, 1}, {0x2F9C4, 3316, 1},
+  {0x2F9C5, 3317, 1}, {0x2F9C6, 3318, 1}, {0x2F9C7, 3319, 1}, {0x2F9C8, 3320, 1}, {0x2F9C9, 3321, 1},
+  {0x2F9CA, 3322, 1}, {0x2F9CB, 3323, 1}, {0x2F9CC, 3324, 1}, {0x2F9CD, 3325, 1}, {0x2F9CE, 3326, 1},
+  {0x2F9CF, 3327, 1}, {0x2F9D0, 3328, 1}, {0x2F9D1, 3329, 1}, {0x2F9D2, 3330, 1}, {0x2F9D3, 3331, 1},
+  {0x2F9D4, 3332, 1}, {0x2F9D5, 3333, 1}, {0x2F9D6, 3334, 1}, {0x2F9D7, 3335, 1}, {0x2F9D8, 3336, 1},
+  {0x2F9D9, 3337, 1}, {0x2F9DA, 3338, 1}, {0x2F9DB, 3339, 1}, {0x2F9DC, 3340, 1}, {0x2F9DD, 3341, 1},
+  {0x2F9DE, 3342, 1}, {0x2F9DF, 3343, 1}, {0x2F9E0, 3344, 1}, {0x2F9E1, 3345, 1}, {0x2F9E2, 3346, 1},
+  {0x2F9E3, 3347, 1}, {0x2F9E4, 3348, 1}, {0x2F9E5, 3349, 1}, {0x2F9E6, 3350, 1}, {0x2F9E7, 3351, 1},
+  {0x2F9E8, 3352, 1}, {0x2F9E9, 3353, 1}, {0x2F9EA, 3354, 1}, {0x2F9EB, 3355, 1}, {0x2F9EC, 3356, 1},
+  {0x2F9ED, 3357, 1}, {0x2F9EE, 3358, 1}, {0x2F9EF, 3359, 1}, {0x2F9F0, 3360, 1}, {0x2F9F1, 3361, 1},
+  {0x2F9F2, 3362, 1}, {0x2F9F3, 3363, 1}, {0x2F9F4, 3364, 1}, {0x2F9F5, 3365, 1}, {0x2F9F6, 3366, 1},
+  {0x2F9F7, 3367, 1}, {0x2F9F8, 3368, 1}, {0x2F9F9, 3369, 1}, {0x2F9FA, 3370, 1}, {0x2F9FB, 3371, 1},
+  {0x2F9FC, 3372, 1}, {0x2F9FD, 3373, 1}, {0x2F9FE, 3374, 1}, {0x2F9FF, 3375, 1}, {0x2FA00, 3376, 1},
+  {0x2FA01, 3377, 1}, {0x2FA02, 3378, 1}, {0x2FA03, 3379, 1}, {0x2FA04, 3380, 1}, {0x2FA05, 3381, 1},
+  {0x2FA06, 3382, 1}, {0x2FA07, 3383, 1}, {0x2FA08, 3384, 1}, {0x2FA09, 3385, 1}, {0x2FA0A, 3386, 1},
+  {0x2FA0B, 3387, 1}, {0x2FA0C, 3388, 1}, {0x2FA0D, 3389, 1}, {0x2FA0E, 3390, 1}, {0x2FA0F, 3391, 1},
+  {0x2FA10, 3392, 1}, {0x2FA11, 3393, 1}, {0x2FA12, 3394, 1}, {0x2FA13, 3395, 1}, {0x2FA14, 3396, 1},
+  {0x2FA15, 3397, 1}, {0x2FA16, 3398, 1}, {0x2FA17, 3399, 1}, {0x2FA18, 3400, 1}, {0x2FA19, 3401, 1},
+  {0x2FA1A, 3402, 1}, {0x2FA1B, 3403, 1}, {0x2FA1C, 3404, 1}, {0x2FA1D, 3405, 1},
+};
+
+static const char32_t kDecompositionData[] = {
+  0x41, 0x300, 0x41, 0x301, 0x41, 0x302, 0x41, 0x303, 0x41, 0x308, 0x41, 0x30A, 0x43, 0x327, 0x45, 0x300, 0x45, 0x301,
+  0x45, 0x302, 0x45, 0x308, 0x49, 0x300, 0x49, 0x301, 0x49, 0x302, 0x49, 0x308, 0x4E, 0x303, 0x4F, 0x300, 0x4F, 0x301,
+  0x4F, 0x302, 0x4F, 0x303, 0x4F, 0x308, 0x55, 0x300, 0x55, 0x301, 0x55, 0x302, 0x55, 0x308, 0x59, 0x301, 0x61, 0x300,
+  0x61, 0x301, 0x61, 0x302, 0x61, 0x303, 0x61, 0x308, 0x61, 0x30A, 0x63, 0x327, 0x65, 0x300, 0x65, 0x301, 0x65, 0x302,
+  0x65, 0x308, 0x69, 0x300, 0x69, 0x301, 0x69, 0x302, 0x69, 0x308, 0x6E, 0x303, 0x6F, 0x300, 0x6F, 0x301, 0x6F, 0x302,
+  0x6F, 0x303, 0x6F, 0x308, 0x75, 0x300, 0x75, 0x301, 0x75, 0x302, 0x75, 0x308, 0x79, 0x301, 0x79, 0x308, 0x41, 0x304,
+  0x61, 0x304, 0x41, 0x306, 0x61, 0x306, 0x41, 0x328, 0x61, 0x328, 0x43, 0x301, 0x63, 0x301, 0x43, 0x302, 0x63, 0x302,
+  0x43, 0x307, 0x63, 0x307, 0x43, 0x30C, 0x63, 0x30C, 0x44, 0x30C, 0x64, 0x30C, 0x45, 0x304, 0x65, 0x304, 0x45, 0x306,
+  0x65, 0x306, 0x45, 0x307, 0x65, 0x307, 0x45, 0x328, 0x65, 0x328, 0x45, 0x30C, 0x65, 0x30C, 0x47, 0x302, 0x67, 0x302,
+  0x47, 0x306, 0x67, 0x306, 0x47, 0x307, 0x67, 0x307, 0x47, 0x327, 0x67, 0x327, 0x48, 0x302, 0x68, 0x302, 0x49, 0x303,
+  0x69, 0x303, 0x49, 0x304, 0x69, 0x304, 0x49, 0x306, 0x69, 0x306, 0x49, 0x328, 0x69, 0x328, 0x49, 0x307, 0x4A, 0x302,
+  0x6A, 0x302, 0x4B, 0x327, 0x6B, 0x327, 0x4C, 0x301, 0x6C, 0x301, 0x4C, 0x327, 0x6C, 0x327, 0x4C, 0x30C, 0x6C, 0x30C,
+  0x4E, 0x301, 0x6E, 0x301, 0x4E, 0x327, 0x6E, 0x327, 0x4E, 0x30C, 0x6E, 0x30C, 0x4F, 0x304, 0x6F, 0x304, 0x4F, 0x306,
+  0x6F, 0x306, 0x4F, 0x30B, 0x6F, 0x30B, 0x52, 0x301, 0x72, 0x301, 0x52, 0x327, 0x72, 0x327, 0x52, 0x30C, 0x72, 0x30C,
+  0x53, 0x301, 0x73, 0x301, 0x53, 0x302, 0x73, 0x302, 0x53, 0x327, 0x73, 0x327, 0x53, 0x30C, 0x73, 0x30C, 0x54, 0x327,
+  0x74, 0x327, 0x54, 0x30C, 0x74, 0x30C, 0x55, 0x303, 0x75, 0x303, 0x55, 0x304, 0x75, 0x304, 0x55, 0x306, 0x75, 0x306,
+  0x55, 0x30A, 0x75, 0x30A, 0x55, 0x30B, 0x75, 0x30B, 0x55, 0x328, 0x75, 0x328, 0x57, 0x302, 0x77, 0x302, 0x59, 0x302,
+  0x79, 0x302, 0x59, 0x308, 0x5A, 0x301, 0x7A, 0x301, 0x5A, 0x307, 0x7A, 0x307, 0x5A, 0x30C, 0x7A, 0x30C, 0x4F, 0x31B,
+  0x6F, 0x31B, 0x55, 0x31B, 0x75, 0x31B, 0x41, 0x30C, 0x61, 0x30C, 0x49, 0x30C, 0x69, 0x30C, 0x4F, 0x30C, 0x6F, 0x30C,
+  0x55, 0x30C, 0x75, 0x30C, 0x55, 0x308, 0x304, 0x75, 0x308, 0x304, 0x55, 0x308, 0x301, 0x75, 0x308, 0x301, 0x55,
+  0x308, 0x30C, 0x75, 0x308, 0x30C, 0x55, 0x308, 0x300, 0x75, 0x308, 0x300, 0x41, 0x308, 0x304, 0x61, 0x308, 0x304,
+  0x41, 0x307, 0x304, 0x61, 0x307, 0x304, 0xC6, 0x304, 0xE6, 0x304, 0x47, 0x30C, 0x67, 0x30C, 0x4B, 0x30C, 0x6B, 0x30C,
+  0x4F, 0x328, 0x6F, 0x328, 0x4F, 0x328, 0x304, 0x6F, 0x328, 0x304, 0x1B7, 0x30C, 0x292, 0x30C, 0x6A, 0x30C, 0x47,
+  0x301, 0x67, 0x301, 0x4E, 0x300, 0x6E, 0x300, 0x41, 0x30A, 0x301, 0x61, 0x30A, 0x301, 0xC6, 0x301, 0xE6, 0x301, 0xD8,
+  0x301, 0xF8, 0x301, 0x41, 0x30F, 0x61, 0x30F, 0x41, 0x311, 0x61, 0x311, 0x45, 0x30F, 0x65, 0x30F, 0x45, 0x311, 0x65,
+  0x311, 0x49, 0x30F, 0x69, 0x30F, 0x49, 0x311, 0x69, 0x311, 0x4F, 0x30F, 0x6F, 0x30F, 0x4F, 0x311, 0x6F, 0x311, 0x52,
+  0x30F, 0x72, 0x30F, 0x52, 0x311, 0x72, 0x311, 0x55, 0x30F, 0x75, 0x30F, 0x55, 0x311, 0x75, 0x311, 0x53, 0x326, 0x73,
+  0x326, 0x54, 0x326, 0x74, 0x326, 0x48, 0x30C, 0x68, 0x30C, 0x41, 0x307, 0x61, 0x307, 0x45, 0x327, 0x65, 0x327, 0x4F,
+  0x308, 0x304, 0x6F, 0x308, 0x304, 0x4F, 0x303, 0x304, 0x6F, 0x303, 0x304, 0x4F, 0x307, 0x6F, 0x307, 0x4F, 0x307,
+  0x304, 0x6F, 0x307, 0x304, 0x59, 0x304, 0x79, 0x304, 0x300, 0x301, 0x313, 0x308, 0x301, 0x2B9, 0x3B, 0xA8, 0x301,
+  0x391, 0x301, 0xB7, 0x395, 0x301, 0x397, 0x301, 0x399, 0x301, 0x39F, 0x301, 0x3A5, 0x301, 0x3A9, 0x301, 0x3B9, 0x308,
+  0x301, 0x399, 0x308, 0x3A5, 0x308, 0x3B1, 0x301, 0x3B5, 0x301, 0x3B7, 0x301, 0x3B9, 0x301, 0x3C5, 0x308, 0x301,
+  0x3B9, 0x308, 0x3C5, 0x308, 0x3BF, 0x301, 0x3C5, 0x301, 0x3C9, 0x301, 0x3D2, 0x301, 0x3D2, 0x308, 0x415, 0x300,
+  0x415, 0x308, 0x413, 0x301, 0x406, 0x308, 0x41A, 0x301, 0x418, 0x300, 0x423, 0x306, 0x418, 0x306, 0x438, 0x306,
+  0x435, 0x300, 0x435, 0x308, 0x433, 0x301, 0x456, 0x308, 0x43A, 0x301, 0x438, 0x300, 0x443, 0x306, 0x474, 0x30F,
+  0x475, 0x30F, 0x416, 0x306, 0x436, 0x306, 0x410, 0x306, 0x430, 0x306, 0x410, 0x308, 0x430, 0x308, 0x415, 0x306,
+  0x435, 0x306, 0x4D8, 0x308, 0x4D9, 0x308, 0x416, 0x308, 0x436, 0x308, 0x417, 0x308, 0x437, 0x308, 0x418, 0x304,
+  0x438, 0x304, 0x418, 0x308, 0x438, 0x308, 0x41E, 0x308, 0x43E, 0x308, 0x4E8, 0x308, 0x4E9, 0x308, 0x42D, 0x308,
+  0x44D, 0x308, 0x423, 0x304, 0x443, 0x304, 0x423, 0x308, 0x443, 0x308, 0x423, 0x30B, 0x443, 0x30B, 0x427, 0x308,
+  0x447, 0x308, 0x42B, 0x308, 0x44B, 0x308, 0x627, 0x653, 0x627, 0x654, 0x648, 0x654, 0x627, 0x655, 0x64A, 0x654,
+  0x6D5, 0x654, 0x6C1, 0x654, 0x6D2, 0x654, 0x928, 0x93C, 0x930, 0x93C, 0x933, 0x93C, 0x915, 0x93C, 0x916, 0x93C,
+  0x917, 0x93C, 0x91C, 0x93C, 0x921, 0x93C, 0x922, 0x93C, 0x92B, 0x93C, 0x92F, 0x93C, 0x9C7, 0x9BE, 0x9C7, 0x9D7,
+  0x9A1, 0x9BC, 0x9A2, 0x9BC, 0x9AF, 0x9BC, 0xA32, 0xA3C, 0xA38, 0xA3C, 0xA16, 0xA3C, 0xA17, 0xA3C, 0xA1C, 0xA3C,
+  0xA2B, 0xA3C, 0xB47, 0xB56, 0xB47, 0xB3E, 0xB47, 0xB57, 0xB21, 0xB3C, 0xB22, 0xB3C, 0xB92, 0xBD7, 0xBC6, 0xBBE,
+  0xBC7, 0xBBE, 0xBC6, 0xBD7, 0xC46, 0xC56, 0xCBF, 0xCD5, 0xCC6, 0xCD5, 0xCC6, 0xCD6, 0xCC6, 0xCC2, 0xCC6, 0xCC2,
+  0xCD5, 0xD46, 0xD3E, 0xD47, 0xD3E, 0xD46, 0xD57, 0xDD9, 0xDCA, 0xDD9, 0xDCF, 0xDD9, 0xDCF, 0xDCA, 0xDD9, 0xDDF,
+  0xF42, 0xFB7, 0xF4C, 0xFB7, 0xF51, 0xFB7, 0xF56, 0xFB7, 0xF5B, 0xFB7, 0xF40, 0xFB5, 0xF71, 0xF72, 0xF71, 0xF74,
+  0xFB2, 0xF80, 0xFB3, 0xF80, 0xF71, 0xF80, 0xF92, 0xFB7, 0xF9C, 0xFB7, 0xFA1, 0xFB7, 0xFA6, 0xFB7, 0xFAB, 0xFB7,
+  0xF90, 0xFB5, 0x1025, 0x102E, 0x1B05, 0x1B35, 0x1B07, 0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11,
+  0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x41, 0x325, 0x61, 0x325,
+  0x42, 0x307, 0x62, 0x307, 0x42, 0x323, 0x62, 0x323, 0x42, 0x331, 0x62, 0x331, 0x43, 0x327, 0x301, 0x63, 0x327, 0x301,
+  0x44, 0x307, 0x64, 0x307, 0x44, 0x323, 0x64, 0x323, 0x44, 0x331, 0x64, 0x331, 0x44, 0x327, 0x64, 0x327, 0x44, 0x32D,
+  0x64, 0x32D, 0x45, 0x304, 0x300, 0x65, 0x304, 0x300, 0x45, 0x304, 0x301, 0x65, 0x304, 0x301, 0x45, 0x32D, 0x65,
+  0x32D, 0x45, 0x330, 0x65, 0x330, 0x45, 0x327, 0x306, 0x65, 0x327, 0x306, 0x46, 0x307, 0x66, 0x307, 0x47, 0x304, 0x67,
+  0x304, 0x48, 0x307, 0x68, 0x307, 0x48, 0x323, 0x68, 0x323, 0x48, 0x308, 0x68, 0x308, 0x48, 0x327, 0x68, 0x327, 0x48,
+  0x32E, 0x68, 0x32E, 0x49, 0x330, 0x69, 0x330, 0x49, 0x308, 0x301, 0x69, 0x308, 0x301, 0x4B, 0x301, 0x6B, 0x301, 0x4B,
+  0x323, 0x6B, 0x323, 0x4B, 0x331, 0x6B, 0x331, 0x4C, 0x323, 0x6C, 0x323, 0x4C, 0x323, 0x304, 0x6C, 0x323, 0x304, 0x4C,
+  0x331, 0x6C, 0x331, 0x4C, 0x32D, 0x6C, 0x32D, 0x4D, 0x301, 0x6D, 0x301, 0x4D, 0x307, 0x6D, 0x307, 0x4D, 0x323, 0x6D,
+  0x323, 0x4E, 0x307, 0x6E, 0x307, 0x4E, 0x323, 0x6E, 0x323, 0x4E, 0x331, 0x6E, 0x331, 0x4E, 0x32D, 0x6E, 0x32D, 0x4F,
+  0x303, 0x301, 0x6F, 0x303, 0x301, 0x4F, 0x303, 0x308, 0x6F, 0x303, 0x308, 0x4F, 0x304, 0x300, 0x6F, 0x304, 0x300,
+  0x4F, 0x304, 0x301, 0x6F, 0x304, 0x301, 0x50, 0x301, 0x70, 0x301, 0x50, 0x307, 0x70, 0x307, 0x52, 0x307, 0x72, 0x307,
+  0x52, 0x323, 0x72, 0x323, 0x52, 0x323, 0x304, 0x72, 0x323, 0x304, 0x52, 0x331, 0x72, 0x331, 0x53, 0x307, 0x73, 0x307,
+  0x53, 0x323, 0x73, 0x323, 0x53, 0x301, 0x307, 0x73, 0x301, 0x307, 0x53, 0x30C, 0x307, 0x73, 0x30C, 0x307, 0x53,
+  0x323, 0x307, 0x73, 0x323, 0x307, 0x54, 0x307, 0x74, 0x307, 0x54, 0x323, 0x74, 0x323, 0x54, 0x331, 0x74, 0x331, 0x54,
+  0x32D, 0x74, 0x32D, 0x55, 0x324, 0x75, 0x324, 0x55, 0x330, 0x75, 0x330, 0x55, 0x32D, 0x75, 0x32D, 0x55, 0x303, 0x301,
+  0x75, 0x303, 0x301, 0x55, 0x304, 0x308, 0x75, 0x304, 0x308, 0x56, 0x303, 0x76, 0x303, 0x56, 0x323, 0x76, 0x323, 0x57,
+  0x300, 0x77, 0x300, 0x57, 0x301, 0x77, 0x301, 0x57, 0x308, 0x77, 0x308, 0x57, 0x307, 0x77, 0x307, 0x57, 0x323, 0x77,
+  0x323, 0x58, 0x307, 0x78, 0x307, 0x58, 0x308, 0x78, 0x308, 0x59, 0x307, 0x79, 0x307, 0x5A, 0x302, 0x7A, 0x302, 0x5A,
+  0x323, 0x7A, 0x323, 0x5A, 0x331, 0x7A, 0x331, 0x68, 0x331, 0x74, 0x308, 0x77, 0x30A, 0x79, 0x30A, 0x17F, 0x307, 0x41,
+  0x323, 0x61, 0x323, 0x41, 0x309, 0x61, 0x309, 0x41, 0x302, 0x301, 0x61, 0x302, 0x301, 0x41, 0x302, 0x300, 0x61,
+  0x302, 0x300, 0x41, 0x302, 0x309, 0x61, 0x302, 0x309, 0x41, 0x302, 0x303, 0x61, 0x302, 0x303, 0x41, 0x323, 0x302,
+  0x61, 0x323, 0x302, 0x41, 0x306, 0x301, 0x61, 0x306, 0x301, 0x41, 0x306, 0x300, 0x61, 0x306, 0x300, 0x41, 0x306,
+  0x309, 0x61, 0x306, 0x309, 0x41, 0x306, 0x303, 0x61, 0x306, 0x303, 0x41, 0x323, 0x306, 0x61, 0x323, 0x306, 0x45,
+  0x323, 0x65, 0x323, 0x45, 0x309, 0x65, 0x309, 0x45, 0x303, 0x65, 0x303, 0x45, 0x302, 0x301, 0x65, 0x302, 0x301, 0x45,
+  0x302, 0x300, 0x65, 0x302, 0x300, 0x45, 0x302, 0x309, 0x65, 0x302, 0x309, 0x45, 0x302, 0x303, 0x65, 0x302, 0x303,
+  0x45, 0x323, 0x302, 0x65, 0x323, 0x302, 0x49, 0x309, 0x69, 0x309, 0x49, 0x323, 0x69, 0x323, 0x4F, 0x323, 0x6F, 0x323,
+  0x4F, 0x309, 0x6F, 0x309, 0x4F, 0x302, 0x301, 0x6F, 0x302, 0x301, 0x4F, 0x302, 0x300, 0x6F, 0x302, 0x300, 0x4F,
+  0x302, 0x309, 0x6F, 0x302, 0x309, 0x4F, 0x302, 0x303, 0x6F, 0x302, 0x303, 0x4F, 0x323, 0x302, 0x6F, 0x323, 0x302,
+  0x4F, 0x31B, 0x301, 0x6F, 0x31B, 0x301, 0x4F, 0x31B, 0x300, 0x6F, 0x31B, 0x300, 0x4F, 0x31B, 0x309, 0x6F, 0x31B,
+  0x309, 0x4F, 0x31B, 0x303, 0x6F, 0x31B, 0x303, 0x4F, 0x31B, 0x323, 0x6F, 0x31B, 0x323, 0x55, 0x323, 0x75, 0x323,
+  0x55, 0x309, 0x75, 0x309, 0x55, 0x31B, 0x301, 0x75, 0x31B, 0x301, 0x55, 0x31B, 0x300, 0x75, 0x31B, 0x300, 0x55,
+  0x31B, 0x309, 0x75, 0x31B, 0x309, 0x55, 0x31B, 0x303, 0x75, 0x31B, 0x303, 0x55, 0x31B, 0x323, 0x75, 0x31B, 0x323,
+  0x59, 0x300, 0x79, 0x300, 0x59, 0x323, 0x79, 0x323, 0x59, 0x309, 0x79, 0x309, 0x59, 0x303, 0x79, 0x303, 0x3B1, 0x313,
+  0x3B1, 0x314, 0x3B1, 0x313, 0x300, 0x3B1, 0x314, 0x300, 0x3B1, 0x313, 0x301, 0x3B1, 0x314, 0x301, 0x3B1, 0x313,
+  0x342, 0x3B1, 0x314, 0x342, 0x391, 0x313, 0x391, 0x314, 0x391, 0x313, 0x300, 0x391, 0x314, 0x300, 0x391, 0x313,
+  0x301, 0x391, 0x314, 0x301, 0x391, 0x313, 0x342, 0x391, 0x314, 0x342, 0x3B5, 0x313, 0x3B5, 0x314, 0x3B5, 0x313,
+  0x300, 0x3B5, 0x314, 0x300, 0x3B5, 0x313, 0x301, 0x3B5, 0x314, 0x301, 0x395, 0x313, 0x395, 0x314, 0x395, 0x313,
+  0x300, 0x395, 0x314, 0x300, 0x395, 0x313, 0x301, 0x395, 0x314, 0x301, 0x3B7, 0x313, 0x3B7, 0x314, 0x3B7, 0x313,
+  0x300, 0x3B7, 0x314, 0x300, 0x3B7, 0x313, 0x301, 0x3B7, 0x314, 0x301, 0x3B7, 0x313, 0x342, 0x3B7, 0x314, 0x342,
+  0x397, 0x313, 0x397, 0x314, 0x397, 0x313, 0x300, 0x397, 0x314, 0x300, 0x397, 0x313, 0x301, 0x397, 0x314, 0x301,
+  0x397, 0x313, 0x342, 0x397, 0x314, 0x342, 0x3B9, 0x313, 0x3B9, 0x314, 0x3B9, 0x313, 0x300, 0x3B9, 0x314, 0x300,
+  0x3B9, 0x313, 0x301, 0x3B9, 0x314, 0x301, 0x3B9, 0x313, 0x342, 0x3B9, 0x314, 0x342, 0x399, 0x313, 0x399, 0x314,
+  0x399, 0x313, 0x300, 0x399, 0x314, 0x300, 0x399, 0x313, 0x301, 0x399, 0x314, 0x301, 0x399, 0x313, 0x342, 0x399,
+  0x314, 0x342, 0x3BF, 0x313, 0x3BF, 0x314, 0x3BF, 0x313, 0x300, 0x3BF, 0x314, 0x300, 0x3BF, 0x313, 0x301, 0x3BF,
+  0x314, 0x301, 0x39F, 0x313, 0x39F, 0x314, 0x39F, 0x313, 0x300, 0x39F, 0x314, 0x300, 0x39F, 0x313, 0x301, 0x39F,
+  0x314, 0x301, 0x3C5, 0x313, 0x3C5, 0x314, 0x3C5, 0x313, 0x300, 0x3C5, 0x314, 0x300, 0x3C5, 0x313, 0x301, 0x3C5,
+  0x314, 0x301, 0x3C5, 0x313, 0x342, 0x3C5, 0x314, 0x342, 0x3A5, 0x314, 0x3A5, 0x314, 0x300, 0x3A5, 0x314, 0x301,
+  0x3A5, 0x314, 0x342, 0x3C9, 0x313, 0x3C9, 0x314, 0x3C9, 0x313, 0x300, 0x3C9, 0x314, 0x300, 0x3C9, 0x313, 0x301,
+  0x3C9, 0x314, 0x301, 0x3C9, 0x313, 0x342, 0x3C9, 0x314, 0x342, 0x3A9, 0x313, 0x3A9, 0x314, 0x3A9, 0x313, 0x300,
+  0x3A9, 0x314, 0x300, 0x3A9, 0x313, 0x301, 0x3A9, 0x314, 0x301, 0x3A9, 0x313, 0x342, 0x3A9, 0x314, 0x342, 0x3B1,
+  0x300, 0x3B1, 0x301, 0x3B5, 0x300, 0x3B5, 0x301, 0x3B7, 0x300, 0x3B7, 0x301, 0x3B9, 0x300, 0x3B9, 0x301, 0x3BF,
+  0x300, 0x3BF, 0x301, 0x3C5, 0x300, 0x3C5, 0x301, 0x3C9, 0x300, 0x3C9, 0x301, 0x3B1, 0x313, 0x345, 0x3B1, 0x314,
+  0x345, 0x3B1, 0x313, 0x300, 0x345, 0x3B1, 0x314, 0x300, 0x345, 0x3B1, 0x313, 0x301, 0x345, 0x3B1, 0x314, 0x301,
+  0x345, 0x3B1, 0x313, 0x342, 0x345, 0x3B1, 0x314, 0x342, 0x345, 0x391, 0x313, 0x345, 0x391, 0x314, 0x345, 0x391,
+  0x313, 0x300, 0x345, 0x391, 0x314, 0x300, 0x345, 0x391, 0x313, 0x301, 0x345, 0x391, 0x314, 0x301, 0x345, 0x391,
+  0x313, 0x342, 0x345, 0x391, 0x314, 0x342, 0x345, 0x3B7, 0x313, 0x345, 0x3B7, 0x314, 0x345, 0x3B7, 0x313, 0x300,
+  0x345, 0x3B7, 0x314, 0x300, 0x345, 0x3B7, 0x313, 0x301, 0x345, 0x3B7, 0x314, 0x301, 0x345, 0x3B7, 0x313, 0x342,
+  0x345, 0x3B7, 0x314, 0x342, 0x345, 0x397, 0x313, 0x345, 0x397, 0x314, 0x345, 0x397, 0x313, 0x300, 0x345, 0x397,
+  0x314, 0x300, 0x345, 0x397, 0x313, 0x301, 0x345, 0x397, 0x314, 0x301, 0x345, 0x397, 0x313, 0x342, 0x345, 0x397,
+  0x314, 0x342, 0x345, 0x3C9, 0x313, 0x345, 0x3C9, 0x314, 0x345, 0x3C9, 0x313, 0x300, 0x345, 0x3C9, 0x314, 0x300,
+  0x345, 0x3C9, 0x313, 0x301, 0x345, 0x3C9, 0x314, 0x301, 0x345, 0x3C9, 0x313, 0x342, 0x345, 0x3C9, 0x314, 0x342,
+  0x345, 0x3A9, 0x313, 0x345, 0x3A9, 0x314, 0x345, 0x3A9, 0x313, 0x300, 0x345, 0x3A9, 0x314, 0x300, 0x345, 0x3A9,
+  0x313, 0x301, 0x345, 0x3A9, 0x314, 0x301, 0x345, 0x3A9, 0x313, 0x342, 0x345, 0x3A9, 0x314, 0x342, 0x345, 0x3B1,
+  0x306, 0x3B1, 0x304, 0x3B1, 0x300, 0x345, 0x3B1, 0x345, 0x3B1, 0x301, 0x345, 0x3B1, 0x342, 0x3B1, 0x342, 0x345,
+  0x391, 0x306, 0x391, 0x304, 0x391, 0x300, 0x391, 0x301, 0x391, 0x345, 0x3B9, 0xA8, 0x342, 0x3B7, 0x300, 0x345, 0x3B7,
+  0x345, 0x3B7, 0x301, 0x345, 0x3B7, 0x342, 0x3B7, 0x342, 0x345, 0x395, 0x300, 0x395, 0x301, 0x397, 0x300, 0x397,
+  0x301, 0x397, 0x345, 0x1FBF, 0x300, 0x1FBF, 0x301, 0x1FBF, 0x342, 0x3B9, 0x306, 0x3B9, 0x304, 0x3B9, 0x308, 0x300,
+  0x3B9, 0x308, 0x301, 0x3B9, 0x342, 0x3B9, 0x308, 0x342, 0x399, 0x306, 0x399, 0x304, 0x399, 0x300, 0x399, 0x301,
+  0x1FFE, 0x300, 0x1FFE, 0x301, 0x1FFE, 0x342, 0x3C5, 0x306, 0x3C5, 0x304, 0x3C5, 0x308, 0x300, 0x3C5, 0x308, 0x301,
+  0x3C1, 0x313, 0x3C1, 0x314, 0x3C5, 0x342, 0x3C5, 0x308, 0x342, 0x3A5, 0x306, 0x3A5, 0x304, 0x3A5, 0x300, 0x3A5,
+  0x301, 0x3A1, 0x314, 0xA8, 0x300, 0xA8, 0x301, 0x60, 0x3C9, 0x300, 0x345, 0x3C9, 0x345, 0x3C9, 0x301, 0x345, 0x3C9,
+  0x342, 0x3C9, 0x342, 0x345, 0x39F, 0x300, 0x39F, 0x301, 0x3A9, 0x300, 0x3A9, 0x301, 0x3A9, 0x345, 0xB4, 0x2002,
+  0x2003, 0x3A9, 0x4B, 0x41, 0x30A, 0x2190, 0x338, 0x2192, 0x338, 0x2194, 0x338, 0x21D0, 0x338, 0x21D4, 0x338, 0x21D2,
+  0x338, 0x2203, 0x338, 0x2208, 0x338, 0x220B, 0x338, 0x2223, 0x338, 0x2225, 0x338, 0x223C, 0x338, 0x2243, 0x338,
+  0x2245, 0x338, 0x2248, 0x338, 0x3D, 0x338, 0x2261, 0x338, 0x224D, 0x338, 0x3C, 0x338, 0x3E, 0x338, 0x2264, 0x338,
+  0x2265, 0x338, 0x2272, 0x338, 0x2273, 0x338, 0x2276, 0x338, 0x2277, 0x338, 0x227A, 0x338, 0x227B, 0x338, 0x2282,
+  0x338, 0x2283, 0x338, 0x2286, 0x338, 0x2287, 0x338, 0x22A2, 0x338, 0x22A8, 0x338, 0x22A9, 0x338, 0x22AB, 0x338,
+  0x227C, 0x338, 0x227D, 0x338, 0x2291, 0x338, 0x2292, 0x338, 0x22B2, 0x338, 0x22B3, 0x338, 0x22B4, 0x338, 0x22B5,
+  0x338, 0x3008, 0x3009, 0x2ADD, 0x338, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099,
+  0x3055, 0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099, 0x305F, 0x3099, 0x3061, 0x3099,
+  0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A,
+  0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099,
+  0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099,
+  0x30B7, 0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099,
+  0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099,
+  0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099,
+  0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32,
+  0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F,
+  0x6A02, 0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50,
+  0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE,
+  0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0,
+  0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62,
+  0x6A13, 0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675,
+  0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D,
+  0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0,
+  0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5,
+  0x6FFE, 0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A,
+  0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8,
+  0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2,
+  0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA,
+  0x5BEE, 0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289, 0x677B, 0x67F3,
+  0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A,
+  0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2,
+  0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F,
+  0x6797, 0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6,
+  0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A, 0x6674,
+  0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD,
+  0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606,
+  0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77,
+  0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D, 0x798E,
+  0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996,
+  0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5,
+  0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954,
+  0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234, 0x63C4,
+  0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E,
+  0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A,
+  0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986,
+  0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276,
+  0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018,
+  0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x5D9, 0x5B4, 0x5F2, 0x5B7, 0x5E9, 0x5C1, 0x5E9, 0x5C2, 0x5E9,
+  0x5BC, 0x5C1, 0x5E9, 0x5BC, 0x5C2, 0x5D0, 0x5B7, 0x5D0, 0x5B8, 0x5D0, 0x5BC, 0x5D1, 0x5BC, 0x5D2, 0x5BC, 0x5D3,
+  0x5BC, 0x5D4, 0x5BC, 0x5D5, 0x5BC, 0x5D6, 0x5BC, 0x5D8, 0x5BC, 0x5D9, 0x5BC, 0x5DA, 0x5BC, 0x5DB, 0x5BC, 0x5DC,
+  0x5BC, 0x5DE, 0x5BC, 0x5E0, 0x5BC, 0x5E1, 0x5BC, 0x5E3, 0x5BC, 0x5E4, 0x5BC, 0x5E6, 0x5BC, 0x5E7, 0x5BC, 0x5E8,
+  0x5BC, 0x5E9, 0x5BC, 0x5EA, 0x5BC, 0x5D5, 0x5B9, 0x5D1, 0x5BF, 0x5DB, 0x5BF, 0x5E4, 0x5BF, 0x11099, 0x110BA, 0x1109B,
+  0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA,
+  0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158,
+  0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171,
+  0x1D158, 0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E,
+  0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB,
+  0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167,
+  0x518D, 0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5272,
+  0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373, 0x537D,
+  0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448,
+  0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606,
+  0x5717, 0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2,
+  0x58F7, 0x5906, 0x591A, 0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x36FC,
+  0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781,
+  0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD,
+  0x5E28, 0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331,
+  0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081,
+  0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF,
+  0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383,
+  0x63E4, 0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A,
+  0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9, 0x6717,
+  0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914,
+  0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F,
+  0x6BBA, 0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41,
+  0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E,
+  0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C,
+  0x243AB, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8,
+  0x3EB8, 0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92, 0x7570, 0x2219F, 0x7610,
+  0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F,
+  0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5,
+  0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9,
+  0x4227, 0x25C80, 0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334,
+  0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8,
+  0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204,
+  0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C, 0x82E5, 0x831D, 0x8363,
+  0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B, 0x84F1,
+  0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669,
+  0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863,
+  0x27667, 0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55,
+  0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38, 0x285D2,
+  0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B,
+  0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2,
+  0x29496, 0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12,
+  0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9, 0x9EFE,
+  0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+};
+
+// Sorted by first and second.
+static const Composition kCompositions[] = {
+  {0x3C, 0x338, 0x226E}, {0x3D, 0x338, 0x2260}, {0x3E, 0x338, 0x226F}, {0x41, 0x300, 0xC0}, {0x41, 0x301, 0xC1},
+  {0x41, 0x302, 0xC2}, {0x41, 0x303, 0xC3}, {0x41, 0x304, 0x100}, {0x41, 0x306, 0x102}, {0x41, 0x307, 0x226},
+  {0x41, 0x308, 0xC4}, {0x41, 0x309, 0x1EA2}, {0x41, 0x30A, 0xC5}, {0x41, 0x30C, 0x1CD}, {0x41, 0x30F, 0x200},
+  {0x41, 0x311, 0x202}, {0x41, 0x323, 0x1EA0}, {0x41, 0x325, 0x1E00}, {0x41, 0x328, 0x104}, {0x42, 0x307, 0x1E02},
+  {0x42, 0x323, 0x1E04}, {0x42, 0x331, 0x1E06}, {0x43, 0x301, 0x106}, {0x43, 0x302, 0x108}, {0x43, 0x307, 0x10A},
+  {0x43, 0x30C, 0x10C}, {0x43, 0x327, 0xC7}, {0x44, 0x307, 0x1E0A}, {0x44, 0x30C, 0x10E}, {0x44, 0x323, 0x1E0C},
+  {0x44, 0x327, 0x1E10}, {0x44, 0x32D, 0x1E12}, {0x44, 0x331, 0x1E0E}, {0x45, 0x300, 0xC8}, {0x45, 0x301, 0xC9},
+  {0x45, 0x302, 0xCA}, {0x45, 0x303, 0x1EBC}, {0x45, 0x304, 0x112}, {0x45, 0x306, 0x114}, {0x45, 0x307, 0x116},
+  {0x45, 0x308, 0xCB}, {0x45, 0x309, 0x1EBA}, {0x45, 0x30C, 0x11A}, {0x45, 0x30F, 0x204}, {0x45, 0x311, 0x206},
+  {0x45, 0x323, 0x1EB8}, {0x45, 0x327, 0x228}, {0x45, 0x328, 0x118}, {0x45, 0x32D, 0x1E18}, {0x45, 0x330, 0x1E1A},
+  {0x46, 0x307, 0x1E1E}, {0x47, 0x301, 0x1F4}, {0x47, 0x302, 0x11C}, {0x47, 0x304, 0x1E20}, {0x47, 0x306, 0x11E},
+  {0x47, 0x307, 0x120}, {0x47, 0x30C, 0x1E6}, {0x47, 0x327, 0x122}, {0x48, 0x302, 0x124}, {0x48, 0x307, 0x1E22},
+  {0x48, 0x308, 0x1E26}, {0x48, 0x30C, 0x21E}, {0x48, 0x323, 0x1E24}, {0x48, 0x327, 0x1E28}, {0x48, 0x32E, 0x1E2A},
+  {0x49, 0x300, 0xCC}, {0x49, 0x301, 0xCD}, {0x49, 0x302, 0xCE}, {0x49, 0x303, 0x128}, {0x49, 0x304, 0x12A},
+  {0x49, 0x306, 0x12C}, {0x49, 0x307, 0x130}, {0x49, 0x308, 0xCF}, {0x49, 0x309, 0x1EC8}, {0x49, 0x30C, 0x1CF},
+  {0x49, 0x30F, 0x208}, {0x49, 0x311, 0x20A}, {0x49, 0x323, 0x1ECA}, {0x49, 0x328, 0x12E}, {0x49, 0x330, 0x1E2C},
+  {0x4A, 0x302, 0x134}, {0x4B, 0x301, 0x1E30}, {0x4B, 0x30C, 0x1E8}, {0x4B, 0x323, 0x1E32}, {0x4B, 0x327, 0x136},
+  {0x4B, 0x331, 0x1E34}, {0x4C, 0x301, 0x139}, {0x4C, 0x30C, 0x13D}, {0x4C, 0x323, 0x1E36}, {0x4C, 0x327, 0x13B},
+  {0x4C, 0x32D, 0x1E3C}, {0x4C, 0x331, 0x1E3A}, {0x4D, 0x301, 0x1E3E}, {0x4D, 0x307, 0x1E40}, {0x4D, 0x323, 0x1E42},
+  {0x4E, 0x300, 0x1F8}, {0x4E, 0x301, 0x143}, {0x4E, 0x303, 0xD1}, {0x4E, 0x307, 0x1E44}, {0x4E, 0x30C, 0x147},
+  {0x4E, 0x323, 0x1E46}, {0x4E, 0x327, 0x145}, {0x4E, 0x32D, 0x1E4A}, {0x4E, 0x331, 0x1E48}, {0x4F, 0x300, 0xD2},
+  {0x4F, 0x301, 0xD3}, {0x4F, 0x302, 0xD4}, {0x4F, 0x303, 0xD5}, {0x4F, 0x304, 0x14C}, {0x4F, 0x306, 0x14E},
+  {0x4F, 0x307, 0x22E}, {0x4F, 0x308, 0xD6}, {0x4F, 0x309, 0x1ECE}, {0x4F, 0x30B, 0x150}, {0x4F, 0x30C, 0x1D1},
+  {0x4F, 0x30F, 0x20C}, {0x4F, 0x311, 0x20E}, {0x4F, 0x31B, 0x1A0}, {0x4F, 0x323, 0x1ECC}, {0x4F, 0x328, 0x1EA},
+  {0x50, 0x301, 0x1E54}, {0x50, 0x307, 0x1E56}, {0x52, 0x301, 0x154}, {0x52, 0x307, 0x1E58}, {0x52, 0x30C, 0x158},
+  {0x52, 0x30F, 0x210}, {0x52, 0x311, 0x212}, {0x52, 0x323, 0x1E5A}, {0x52, 0x327, 0x156}, {0x52, 0x331, 0x1E5E},
+  {0x53, 0x301, 0x15A}, {0x53, 0x302, 0x15C}, {0x53, 0x307, 0x1E60}, {0x53, 0x30C, 0x160}, {0x53, 0x323, 0x1E62},
+  {0x53, 0x326, 0x218}, {0x53, 0x327, 0x15E}, {0x54, 0x307, 0x1E6A}, {0x54, 0x30C, 0x164}, {0x54, 0x323, 0x1E6C},
+  {0x54, 0x326, 0x21A}, {0x54, 0x327, 0x162}, {0x54, 0x32D, 0x1E70}, {0x54, 0x331, 0x1E6E}, {0x55, 0x300, 0xD9},
+  {0x55, 0x301, 0xDA}, {0x55, 0x302, 0xDB}, {0x55, 0x303, 0x168}, {0x55, 0x304, 0x16A}, {0x55, 0x306, 0x16C},
+  {0x55, 0x308, 0xDC}, {0x55, 0x309, 0x1EE6}, {0x55, 0x30A, 0x16E}, {0x55, 0x30B, 0x170}, {0x55, 0x30C, 0x1D3},
+  {0x55, 0x30F, 0x214}, {0x55, 0x311, 0x216}, {0x55, 0x31B, 0x1AF}, {0x55, 0x323, 0x1EE4}, {0x55, 0x324, 0x1E72},
+  {0x55, 0x328, 0x172}, {0x55, 0x32D, 0x1E76}, {0x55, 0x330, 0x1E74}, {0x56, 0x303, 0x1E7C}, {0x56, 0x323, 0x1E7E},
+  {0x57, 0x300, 0x1E80}, {0x57, 0x301, 0x1E82}, {0x57, 0x302, 0x174}, {0x57, 0x307, 0x1E86}, {0x57, 0x308, 0x1E84},
+  {0x57, 0x323, 0x1E88}, {0x58, 0x307, 0x1E8A}, {0x58, 0x308, 0x1E8C}, {0x59, 0x300, 0x1EF2}, {0x59, 0x301, 0xDD},
+  {0x59, 0x302, 0x176}, {0x59, 0x303, 0x1EF8}, {0x59, 0x304, 0x232}, {0x59, 0x307, 0x1E8E}, {0x59, 0x308, 0x178},
+  {0x59, 0x309, 0x1EF6}, {0x59, 0x323, 0x1EF4}, {0x5A, 0x301, 0x179}, {0x5A, 0x302, 0x1E90}, {0x5A, 0x307, 0x17B},
+  {0x5A, 0x30C, 0x17D}, {0x5A, 0x323, 0x1E92}, {0x5A, 0x331, 0x1E94}, {0x61, 0x300, 0xE0}, {0x61, 0x301, 0xE1},
+  {0x61, 0x302, 0xE2}, {0x61, 0x303, 0xE3}, {0x61, 0x304, 0x101}, {0x61, 0x306, 0x103}, {0x61, 0x307, 0x227},
+  {0x61, 0x308, 0xE4}, {0x61, 0x309, 0x1EA3}, {0x61, 0x30A, 0xE5}, {0x61, 0x30C, 0x1CE}, {0x61, 0x30F, 0x201},
+  {0x61, 0x311, 0x203}, {0x61, 0x323, 0x1EA1}, {0x61, 0x325, 0x1E01}, {0x61, 0x328, 0x105}, {0x62, 0x307, 0x1E03},
+  {0x62, 0x323, 0x1E05}, {0x62, 0x331, 0x1E07}, {0x63, 0x301, 0x107}, {0x63, 0x302, 0x109}, {0x63, 0x307, 0x10B},
+  {0x63, 0x30C, 0x10D}, {0x63, 0x327, 0xE7}, {0x64, 0x307, 0x1E0B}, {0x64, 0x30C, 0x10F}, {0x64, 0x323, 0x1E0D},
+  {0x64, 0x327, 0x1E11}, {0x64, 0x32D, 0x1E13}, {0x64, 0x331, 0x1E0F}, {0x65, 0x300, 0xE8}, {0x65, 0x301, 0xE9},
+  {0x65, 0x302, 0xEA}, {0x65, 0x303, 0x1EBD}, {0x65, 0x304, 0x113}, {0x65, 0x306, 0x115}, {0x65, 0x307, 0x117},
+  {0x65, 0x308, 0xEB}, {0x65, 0x309, 0x1EBB}, {0x65, 0x30C, 0x11B}, {0x65, 0x30F, 0x205}, {0x65, 0x311, 0x207},
+  {0x65, 0x323, 0x1EB9}, {0x65, 0x327, 0x229}, {0x65, 0x328, 0x119}, {0x65, 0x32D, 0x1E19}, {0x65, 0x330, 0x1E1B},
+  {0x66, 0x307, 0x1E1F}, {0x67, 0x301, 0x1F5}, {0x67, 0x302, 0x11D}, {0x67, 0x304, 0x1E21}, {0x67, 0x306, 0x11F},
+  {0x67, 0x307, 0x121}, {0x67, 0x30C, 0x1E7}, {0x67, 0x327, 0x123}, {0x68, 0x302, 0x125}, {0x68, 0x307, 0x1E23},
+  {0x68, 0x308, 0x1E27}, {0x68, 0x30C, 0x21F}, {0x68, 0x323, 0x1E25}, {0x68, 0x327, 0x1E29}, {0x68, 0x32E, 0x1E2B},
+  {0x68, 0x331, 0x1E96}, {0x69, 0x300, 0xEC}, {0x69, 0x301, 0xED}, {0x69, 0x302, 0xEE}, {0x69, 0x303, 0x129},
+  {0x69, 0x304, 0x12B}, {0x69, 0x306, 0x12D}, {0x69, 0x308, 0xEF}, {0x69, 0x309, 0x1EC9}, {0x69, 0x30C, 0x1D0},
+  {0x69, 0x30F, 0x209}, {0x69, 0x311, 0x20B}, {0x69, 0x323, 0x1ECB}, {0x69, 0x328, 0x12F}, {0x69, 0x330, 0x1E2D},
+  {0x6A, 0x302, 0x135}, {0x6A, 0x30C, 0x1F0}, {0x6B, 0x301, 0x1E31}, {0x6B, 0x30C, 0x1E9}, {0x6B, 0x323, 0x1E33},
+  {0x6B, 0x327, 0x137}, {0x6B, 0x331, 0x1E35}, {0x6C, 0x301, 0x13A}, {0x6C, 0x30C, 0x13E}, {0x6C, 0x323, 0x1E37},
+  {0x6C, 0x327, 0x13C}, {0x6C, 0x32D, 0x1E3D}, {0x6C, 0x331, 0x1E3B}, {0x6D, 0x301, 0x1E3F}, {0x6D, 0x307, 0x1E41},
+  {0x6D, 0x323, 0x1E43}, {0x6E, 0x300, 0x1F9}, {0x6E, 0x301, 0x144}, {0x6E, 0x303, 0xF1}, {0x6E, 0x307, 0x1E45},
+  {0x6E, 0x30C, 0x148}, {0x6E, 0x323, 0x1E47}, {0x6E, 0x327, 0x146}, {0x6E, 0x32D, 0x1E4B}, {0x6E, 0x331, 0x1E49},
+  {0x6F, 0x300, 0xF2}, {0x6F, 0x301, 0xF3}, {0x6F, 0x302, 0xF4}, {0x6F, 0x303, 0xF5}, {0x6F, 0x304, 0x14D},
+  {0x6F, 0x306, 0x14F}, {0x6F, 0x307, 0x22F}, {0x6F, 0x308, 0xF6}, {0x6F, 0x309, 0x1ECF}, {0x6F, 0x30B, 0x151},
+  {0x6F, 0x30C, 0x1D2}, {0x6F, 0x30F, 0x20D}, {0x6F, 0x311, 0x20F}, {0x6F, 0x31B, 0x1A1}, {0x6F, 0x323, 0x1ECD},
+  {0x6F, 0x328, 0x1EB}, {0x70, 0x301, 0x1E55}, {0x70, 0x307, 0x1E57}, {0x72, 0x301, 0x155}, {0x72, 0x307, 0x1E59},
+  {0x72, 0x30C, 0x159}, {0x72, 0x30F, 0x211}, {0x72, 0x311, 0x213}, {0x72, 0x323, 0x1E5B}, {0x72, 0x327, 0x157},
+  {0x72, 0x331, 0x1E5F}, {0x73, 0x301, 0x15B}, {0x73, 0x302, 0x15D}, {0x73, 0x307, 0x1E61}, {0x73, 0x30C, 0x161},
+  {0x73, 0x323, 0x1E63}, {0x73, 0x326, 0x219}, {0x73, 0x327, 0x15F}, {0x74, 0x307, 0x1E6B}, {0x74, 0x308, 0x1E97},
+  {0x74, 0x30C, 0x165}, {0x74, 0x323, 0x1E6D}, {0x74, 0x326, 0x21B}, {0x74, 0x327, 0x163}, {0x74, 0x32D, 0x1E71},
+  {0x74, 0x331, 0x1E6F}, {0x75, 0x300, 0xF9}, {0x75, 0x301, 0xFA}, {0x75, 0x302, 0xFB}, {0x75, 0x303, 0x169},
+  {0x75, 0x304, 0x16B}, {0x75, 0x306, 0x16D}, {0x75, 0x308, 0xFC}, {0x75, 0x309, 0x1EE7}, {0x75, 0x30A, 0x16F},
+  {0x75, 0x30B, 0x171}, {0x75, 0x30C, 0x1D4}, {0x75, 0x30F, 0x215}, {0x75, 0x311, 0x217}, {0x75, 0x31B, 0x1B0},
+  {0x75, 0x323, 0x1EE5}, {0x75, 0x324, 0x1E73}, {0x75, 0x328, 0x173}, {0x75, 0x32D, 0x1E77}, {0x75, 0x330, 0x1E75},
+  {0x76, 0x303, 0x1E7D}, {0x76, 0x323, 0x1E7F}, {0x77, 0x300, 0x1E81}, {0x77, 0x301, 0x1E83}, {0x77, 0x302, 0x175},
+  {0x77, 0x307, 0x1E87}, {0x77, 0x308, 0x1E85}, {0x77, 0x30A, 0x1E98}, {0x77, 0x323, 0x1E89}, {0x78, 0x307, 0x1E8B},
+  {0x78, 0x308, 0x1E8D}, {0x79, 0x300, 0x1EF3}, {0x79, 0x301, 0xFD}, {0x79, 0x302, 0x177}, {0x79, 0x303, 0x1EF9},
+  {0x79, 0x304, 0x233}, {0x79, 0x307, 0x1E8F}, {0x79, 0x308, 0xFF}, {0x79, 0x309, 0x1EF7}, {0x79, 0x30A, 0x1E99},
+  {0x79, 0x323, 0x1EF5}, {0x7A, 0x301, 0x17A}, {0x7A, 0x302, 0x1E91}, {0x7A, 0x307, 0x17C}, {0x7A, 0x30C, 0x17E},
+  {0x7A, 0x323, 0x1E93}, {0x7A, 0x331, 0x1E95}, {0xA8, 0x300, 0x1FED}, {0xA8, 0x301, 0x385}, {0xA8, 0x342, 0x1FC1},
+  {0xC2, 0x300, 0x1EA6}, {0xC2, 0x301, 0x1EA4}, {0xC2, 0x303, 0x1EAA}, {0xC2, 0x309, 0x1EA8}, {0xC4, 0x304, 0x1DE},
+  {0xC5, 0x301, 0x1FA}, {0xC6, 0x301, 0x1FC}, {0xC6, 0x304, 0x1E2}, {0xC7, 0x301, 0x1E08}, {0xCA, 0x300, 0x1EC0},
+  {0xCA, 0x301, 0x1EBE}, {0xCA, 0x303, 0x1EC4}, {0xCA, 0x309, 0x1EC2}, {0xCF, 0x301, 0x1E2E}, {0xD4, 0x300, 0x1ED2},
+  {0xD4, 0x301, 0x1ED0}, {0xD4, 0x303, 0x1ED6}, {0xD4, 0x309, 0x1ED4}, {0xD5, 0x301, 0x1E4C}, {0xD5, 0x304, 0x22C},
+  {0xD5, 0x308, 0x1E4E}, {0xD6, 0x304, 0x22A}, {0xD8, 0x301, 0x1FE}, {0xDC, 0x300, 0x1DB}, {0xDC, 0x301, 0x1D7},
+  {0xDC, 0x304, 0x1D5}, {0xDC, 0x30C, 0x1D9}, {0xE2, 0x300, 0x1EA7}, {0xE2, 0x301, 0x1EA5}, {0xE2, 0x303, 0x1EAB},
+  {0xE2, 0x309, 0x1EA9}, {0xE4, 0x304, 0x1DF}, {0xE5, 0x301, 0x1FB}, {0xE6, 0x301, 0x1FD}, {0xE6, 0x304, 0x1E3},
+  {0xE7, 0x301, 0x1E09}, {0xEA, 0x300, 0x1EC1}, {0xEA, 0x301, 0x1EBF}, {0xEA, 0x303, 0x1EC5}, {0xEA, 0x309, 0x1EC3},
+  {0xEF, 0x301, 0x1E2F}, {0xF4, 0x300, 0x1ED3}, {0xF4, 0x301, 0x1ED1}, {0xF4, 0x303, 0x1ED7}, {0xF4, 0x309, 0x1ED5},
+  {0xF5, 0x301, 0x1E4D}, {0xF5, 0x304, 0x22D}, {0xF5, 0x308, 0x1E4F}, {0xF6, 0x304, 0x22B}, {0xF8, 0x301, 0x1FF},
+  {0xFC, 0x300, 0x1DC}, {0xFC, 0x301, 0x1D8}, {0xFC, 0x304, 0x1D6}, {0xFC, 0x30C, 0x1DA}, {0x102, 0x300, 0x1EB0},
+  {0x102, 0x301, 0x1EAE}, {0x102, 0x303, 0x1EB4}, {0x102, 0x309, 0x1EB2}, {0x103, 0x300, 0x1EB1},
+  {0x103, 0x301, 0x1EAF}, {0x103, 0x303, 0x1EB5}, {0x103, 0x309, 0x1EB3}, {0x112, 0x300, 0x1E14},
+  {0x112, 0x301, 0x1E16}, {0x113, 0x300, 0x1E15}, {0x113, 0x301, 0x1E17}, {0x14C, 0x300, 0x1E50},
+  {0x14C, 0x301, 0x1E52}, {0x14D, 0x300, 0x1E51}, {0x14D, 0x301, 0x1E53}, {0x15A, 0x307, 0x1E64},
+  {0x15B, 0x307, 0x1E65}, {0x160, 0x307, 0x1E66}, {0x161, 0x307, 0x1E67}, {0x168, 0x301, 0x1E78},
+  {0x169, 0x301, 0x1E79}, {0x16A, 0x308, 0x1E7A}, {0x16B, 0x308, 0x1E7B}, {0x17F, 0x307, 0x1E9B},
+  {0x1A0, 0x300, 0x1EDC}, {0x1A0, 0x301, 0x1EDA}, {0x1A0, 0x303, 0x1EE0}, {0x1A0, 0x309, 0x1EDE},
+  {0x1A0, 0x323, 0x1EE2}, {0x1A1, 0x300, 0x1EDD}, {0x1A1, 0x301, 0x1EDB}, {0x1A1, 0x303, 0x1EE1},
+  {0x1A1, 0x309, 0x1EDF}, {0x1A1, 0x323, 0x1EE3}, {0x1AF, 0x300, 0x1EEA}, {0x1AF, 0x301, 0x1EE8},
+  {0x1AF, 0x303, 0x1EEE}, {0x1AF, 0x309, 0x1EEC}, {0x1AF, 0x323, 0x1EF0}, {0x1B0, 0x300, 0x1EEB},
+  {0x1B0, 0x301, 0x1EE9}, {0x1B0, 0x303, 0x1EEF}, {0x1B0, 0x309, 0x1EED}, {0x1B0, 0x323, 0x1EF1},
+  {0x1B7, 0x30C, 0x1EE}, {0x1EA, 0x304, 0x1EC}, {0x1EB, 0x304, 0x1ED}, {0x226, 0x304, 0x1E0}, {0x227, 0x304, 0x1E1},
+  {0x228, 0x306, 0x1E1C}, {0x229, 0x306, 0x1E1D}, {0x22E, 0x304, 0x230}, {0x22F, 0x304, 0x231}, {0x292, 0x30C, 0x1EF},
+  {0x391, 0x300, 0x1FBA}, {0x391, 0x301, 0x386}, {0x391, 0x304, 0x1FB9}, {0x391, 0x306, 0x1FB8},
+  {0x391, 0x313, 0x1F08}, {0x391, 0x314, 0x1F09}, {0x391, 0x345, 0x1FBC}, {0x395, 0x300, 0x1FC8},
+  {0x395, 0x301, 0x388}, {0x395, 0x313, 0x1F18}, {0x395, 0x314, 0x1F19}, {0x397, 0x300, 0x1FCA}, {0x397, 0x301, 0x389},
+  {0x397, 0x313, 0x1F28}, {0x397, 0x314, 0x1F29}, {0x397, 0x345, 0x1FCC}, {0x399, 0x300, 0x1FDA},
+  {0x399, 0x301, 0x38A}, {0x399, 0x304, 0x1FD9}, {0x399, 0x306, 0x1FD8}, {0x399, 0x308, 0x3AA}, {0x399, 0x313, 0x1F38},
+  {0x399, 0x314, 0x1F39}, {0x39F, 0x300, 0x1FF8}, {0x39F, 0x301, 0x38C}, {0x39F, 0x313, 0x1F48},
+  {0x39F, 0x314, 0x1F49}, {0x3A1, 0x314, 0x1FEC}, {0x3A5, 0x300, 0x1FEA}, {0x3A5, 0x301, 0x38E},
+  {0x3A5, 0x304, 0x1FE9}, {0x3A5, 0x306, 0x1FE8}, {0x3A5, 0x308, 0x3AB}, {0x3A5, 0x314, 0x1F59},
+  {0x3A9, 0x300, 0x1FFA}, {0x3A9, 0x301, 0x38F}, {0x3A9, 0x313, 0x1F68}, {0x3A9, 0x314, 0x1F69},
+  {0x3A9, 0x345, 0x1FFC}, {0x3AC, 0x345, 0x1FB4}, {0x3AE, 0x345, 0x1FC4}, {0x3B1, 0x300, 0x1F70},
+  {0x3B1, 0x301, 0x3AC}, {0x3B1, 0x304, 0x1FB1}, {0x3B1, 0x306, 0x1FB0}, {0x3B1, 0x313, 0x1F00},
+  {0x3B1, 0x314, 0x1F01}, {0x3B1, 0x342, 0x1FB6}, {0x3B1, 0x345, 0x1FB3}, {0x3B5, 0x300, 0x1F72},
+  {0x3B5, 0x301, 0x3AD}, {0x3B5, 0x313, 0x1F10}, {0x3B5, 0x314, 0x1F11}, {0x3B7, 0x300, 0x1F74}, {0x3B7, 0x301, 0x3AE},
+  {0x3B7, 0x313, 0x1F20}, {0x3B7, 0x314, 0x1F21}, {0x3B7, 0x342, 0x1FC6}, {0x3B7, 0x345, 0x1FC3},
+  {0x3B9, 0x300, 0x1F76}, {0x3B9, 0x301, 0x3AF}, {0x3B9, 0x304, 0x1FD1}, {0x3B9, 0x306, 0x1FD0}, {0x3B9, 0x308, 0x3CA},
+  {0x3B9, 0x313, 0x1F30}, {0x3B9, 0x314, 0x1F31}, {0x3B9, 0x342, 0x1FD6}, {0x3BF, 0x300, 0x1F78},
+  {0x3BF, 0x301, 0x3CC}, {0x3BF, 0x313, 0x1F40}, {0x3BF, 0x314, 0x1F41}, {0x3C1, 0x313, 0x1FE4},
+  {0x3C1, 0x314, 0x1FE5}, {0x3C5, 0x300, 0x1F7A}, {0x3C5, 0x301, 0x3CD}, {0x3C5, 0x304, 0x1FE1},
+  {0x3C5, 0x306, 0x1FE0}, {0x3C5, 0x308, 0x3CB}, {0x3C5, 0x313, 0x1F50}, {0x3C5, 0x314, 0x1F51},
+  {0x3C5, 0x342, 0x1FE6}, {0x3C9, 0x300, 0x1F7C}, {0x3C9, 0x301, 0x3CE}, {0x3C9, 0x313, 0x1F60},
+  {0x3C9, 0x314, 0x1F61}, {0x3C9, 0x342, 0x1FF6}, {0x3C9, 0x345, 0x1FF3}, {0x3CA, 0x300, 0x1FD2},
+  {0x3CA, 0x301, 0x390}, {0x3CA, 0x342, 0x1FD7}, {0x3CB, 0x300, 0x1FE2}, {0x3CB, 0x301, 0x3B0}, {0x3CB, 0x342, 0x1FE7},
+  {0x3CE, 0x345, 0x1FF4}, {0x3D2, 0x301, 0x3D3}, {0x3D2, 0x308, 0x3D4}, {0x406, 0x308, 0x407}, {0x410, 0x306, 0x4D0},
+  {0x410, 0x308, 0x4D2}, {0x413, 0x301, 0x403}, {0x415, 0x300, 0x400}, {0x415, 0x306, 0x4D6}, {0x415, 0x308, 0x401},
+  {0x416, 0x306, 0x4C1}, {0x416, 0x308, 0x4DC}, {0x417, 0x308, 0x4DE}, {0x418, 0x300, 0x40D}, {0x418, 0x304, 0x4E2},
+  {0x418, 0x306, 0x419}, {0x418, 0x308, 0x4E4}, {0x41A, 0x301, 0x40C}, {0x41E, 0x308, 0x4E6}, {0x423, 0x304, 0x4EE},
+  {0x423, 0x306, 0x40E}, {0x423, 0x308, 0x4F0}, {0x423, 0x30B, 0x4F2}, {0x427, 0x308, 0x4F4}, {0x42B, 0x308, 0x4F8},
+  {0x42D, 0x308, 0x4EC}, {0x430, 0x306, 0x4D1}, {0x430, 0x308, 0x4D3}, {0x433, 0x301, 0x453}, {0x435, 0x300, 0x450},
+  {0x435, 0x306, 0x4D7}, {0x435, 0x308, 0x451}, {0x436, 0x306, 0x4C2}, {0x436, 0x308, 0x4DD}, {0x437, 0x308, 0x4DF},
+  {0x438, 0x300, 0x45D}, {0x438, 0x304, 0x4E3}, {0x438, 0x306, 0x439}, {0x438, 0x308, 0x4E5}, {0x43A, 0x301, 0x45C},
+  {0x43E, 0x308, 0x4E7}, {0x443, 0x304, 0x4EF}, {0x443, 0x306, 0x45E}, {0x443, 0x308, 0x4F1}, {0x443, 0x30B, 0x4F3},
+  {0x447, 0x308, 0x4F5}, {0x44B, 0x308, 0x4F9}, {0x44D, 0x308, 0x4ED}, {0x456, 0x308, 0x457}, {0x474, 0x30F, 0x476},
+  {0x475, 0x30F, 0x477}, {0x4D8, 0x308, 0x4DA}, {0x4D9, 0x308, 0x4DB}, {0x4E8, 0x308, 0x4EA}, {0x4E9, 0x308, 0x4EB},
+  {0x627, 0x653, 0x622}, {0x627, 0x654, 0x623}, {0x627, 0x655, 0x625}, {0x648, 0x654, 0x624}, {0x64A, 0x654, 0x626},
+  {0x6C1, 0x654, 0x6C2}, {0x6D2, 0x654, 0x6D3}, {0x6D5, 0x654, 0x6C0}, {0x928, 0x93C, 0x929}, {0x930, 0x93C, 0x931},
+  {0x933, 0x93C, 0x934}, {0x9C7, 0x9BE, 0x9CB}, {0x9C7, 0x9D7, 0x9CC}, {0xB47, 0xB3E, 0xB4B}, {0xB47, 0xB56, 0xB48},
+  {0xB47, 0xB57, 0xB4C}, {0xB92, 0xBD7, 0xB94}, {0xBC6, 0xBBE, 0xBCA}, {0xBC6, 0xBD7, 0xBCC}, {0xBC7, 0xBBE, 0xBCB},
+  {0xC46, 0xC56, 0xC48}, {0xCBF, 0xCD5, 0xCC0}, {0xCC6, 0xCC2, 0xCCA}, {0xCC6, 0xCD5, 0xCC7}, {0xCC6, 0xCD6, 0xCC8},
+  {0xCCA, 0xCD5, 0xCCB}, {0xD46, 0xD3E, 0xD4A}, {0xD46, 0xD57, 0xD4C}, {0xD47, 0xD3E, 0xD4B}, {0xDD9, 0xDCA, 0xDDA},
+  {0xDD9, 0xDCF, 0xDDC}, {0xDD9, 0xDDF, 0xDDE}, {0xDDC, 0xDCA, 0xDDD}, {0x1025, 0x102E, 0x1026},
+  {0x1B05, 0x1B35, 0x1B06}, {0x1B07, 0x1B35, 0x1B08}, {0x1B09, 0x1B35, 0x1B0A}, {0x1B0B, 0x1B35, 0x1B0C},
+  {0x1B0D, 0x1B35, 0x1B0E}, {0x1B11, 0x1B35, 0x1B12}, {0x1B3A, 0x1B35, 0x1B3B}, {0x1B3C, 0x1B35, 0x1B3D},
+  {0x1B3E, 0x1B35, 0x1B40}, {0x1B3F, 0x1B35, 0x1B41}, {0x1B42, 0x1B35, 0x1B43}, {0x1E36, 0x304, 0x1E38},
+  {0x1E37, 0x304, 0x1E39}, {0x1E5A, 0x304, 0x1E5C}, {0x1E5B, 0x304, 0x1E5D}, {0x1E62, 0x307, 0x1E68},
+  {0x1E63, 0x307, 0x1E69}, {0x1EA0, 0x302, 0x1EAC}, {0x1EA0, 0x306, 0x1EB6}, {0x1EA1, 0x302, 0x1EAD},
+  {0x1EA1, 0x306, 0x1EB7}, {0x1EB8, 0x302, 0x1EC6}, {0x1EB9, 0x302, 0x1EC7}, {0x1ECC, 0x302, 0x1ED8},
+  {0x1ECD, 0x302, 0x1ED9}, {0x1F00, 0x300, 0x1F02}, {0x1F00, 0x301, 0x1F04}, {0x1F00, 0x342, 0x1F06},
+  {0x1F00, 0x345, 0x1F80}, {0x1F01, 0x300, 0x1F03}, {0x1F01, 0x301, 0x1F05}, {0x1F01, 0x342, 0x1F07},
+  {0x1F01, 0x345, 0x1F81}, {0x1F02, 0x345, 0x1F82}, {0x1F03, 0x345, 0x1F83}, {0x1F04, 0x345, 0x1F84},
+  {0x1F05, 0x345, 0x1F85}, {0x1F06, 0x345, 0x1F86}, {0x1F07, 0x345, 0x1F87}, {0x1F08, 0x300, 0x1F0A},
+  {0x1F08, 0x301, 0x1F0C}, {0x1F08, 0x342, 0x1F0E}, {0x1F08, 0x345, 0x1F88}, {0x1F09, 0x300, 0x1F0B},
+  {0x1F09, 0x301, 0x1F0D}, {0x1F09, 0x342, 0x1F0F}, {0x1F09, 0x345, 0x1F89}, {0x1F0A, 0x345, 0x1F8A},
+  {0x1F0B, 0x345, 0x1F8B}, {0x1F0C, 0x345, 0x1F8C}, {0x1F0D, 0x345, 0x1F8D}, {0x1F0E, 0x345, 0x1F8E},
+  {0x1F0F, 0x345, 0x1F8F}, {0x1F10, 0x300, 0x1F12}, {0x1F10, 0x301, 0x1F14}, {0x1F11, 0x300, 0x1F13},
+  {0x1F11, 0x301, 0x1F15}, {0x1F18, 0x300, 0x1F1A}, {0x1F18, 0x301, 0x1F1C}, {0x1F19, 0x300, 0x1F1B},
+  {0x1F19, 0x301, 0x1F1D}, {0x1F20, 0x300, 0x1F22}, {0x1F20, 0x301, 0x1F24}, {0x1F20, 0x342, 0x1F26},
+  {0x1F20, 0x345, 0x1F90}, {0x1F21, 0x300, 0x1F23}, {0x1F21, 0x301, 0x1F25}, {0x1F21, 0x342, 0x1F27},
+  {0x1F21, 0x345, 0x1F91}, {0x1F22, 0x345, 0x1F92}, {0x1F23, 0x345, 0x1F93}, {0x1F24, 0x345, 0x1F94},
+  {0x1F25, 0x345, 0x1F95}, {0x1F26, 0x345, 0x1F96}, {0x1F27, 0x345, 0x1F97}, {0x1F28, 0x300, 0x1F2A},
+  {0x1F28, 0x301, 0x1F2C}, {0x1F28, 0x342, 0x1F2E}, {0x1F28, 0x345, 0x1F98}, {0x1F29, 0x300, 0x1F2B},
+  {0x1F29, 0x301, 0x1F2D}, {0x1F29, 0x342, 0x1F2F}, {0x1F29, 0x345, 0x1F99}, {0x1F2A, 0x345, 0x1F9A},
+  {0x1F2B, 0x345, 0x1F9B}, {0x1F2C, 0x345, 0x1F9C}, {0x1F2D, 0x345, 0x1F9D}, {0x1F2E, 0x345, 0x1F9E},
+  {0x1F2F, 0x345, 0x1F9F}, {0x1F30, 0x300, 0x1F32}, {0x1F30, 0x301, 0x1F34}, {0x1F30, 0x342, 0x1F36},
+  {0x1F31, 0x300, 0x1F33}, {0x1F31, 0x301, 0x1F35}, {0x1F31, 0x342, 0x1F37}, {0x1F38, 0x300, 0x1F3A},
+  {0x1F38, 0x301, 0x1F3C}, {0x1F38, 0x342, 0x1F3E}, {0x1F39, 0x300, 0x1F3B}, {0x1F39, 0x301, 0x1F3D},
+  {0x1F39, 0x342, 0x1F3F}, {0x1F40, 0x300, 0x1F42}, {0x1F40, 0x301, 0x1F44}, {0x1F41, 0x300, 0x1F43},
+  {0x1F41, 0x301, 0x1F45}, {0x1F48, 0x300, 0x1F4A}, {0x1F48, 0x301, 0x1F4C}, {0x1F49, 0x300, 0x1F4B},
+  {0x1F49, 0x301, 0x1F4D}, {0x1F50, 0x300, 0x1F52}, {0x1F50, 0x301, 0x1F54}, {0x1F50, 0x342, 0x1F56},
+  {0x1F51, 0x300, 0x1F53}, {0x1F51, 0x301, 0x1F55}, {0x1F51, 0x342, 0x1F57}, {0x1F59, 0x300, 0x1F5B},
+  {0x1F59, 0x301, 0x1F5D}, {0x1F59, 0x342, 0x1F5F}, {0x1F60, 0x300, 0x1F62}, {0x1F60, 0x301, 0x1F64},
+  {0x1F60, 0x342, 0x1F66}, {0x1F60, 0x345, 0x1FA0}, {0x1F61, 0x300, 0x1F63}, {0x1F61, 0x301, 0x1F65},
+  {0x1F61, 0x342, 0x1F67}, {0x1F61, 0x345, 0x1FA1}, {0x1F62, 0x345, 0x1FA2}, {0x1F63, 0x345, 0x1FA3},
+  {0x1F64, 0x345, 0x1FA4}, {0x1F65, 0x345, 0x1FA5}, {0x1F66, 0x345, 0x1FA6}, {0x1F67, 0x345, 0x1FA7},
+  {0x1F68, 0x300, 0x1F6A}, {0x1F68, 0x301, 0x1F6C}, {0x1F68, 0x342, 0x1F6E}, {0x1F68, 0x345, 0x1FA8},
+  {0x1F69, 0x300, 0x1F6B}, {0x1F69, 0x301, 0x1F6D}, {0x1F69, 0x342, 0x1F6F}, {0x1F69, 0x345, 0x1FA9},
+  {0x1F6A, 0x345, 0x1FAA}, {0x1F6B, 0x345, 0x1FAB}, {0x1F6C, 0x345, 0x1FAC}, {0x1F6D, 0x345, 0x1FAD},
+  {0x1F6E, 0x345, 0x1FAE}, {0x1F6F, 0x345, 0x1FAF}, {0x1F70, 0x345, 0x1FB2}, {0x1F74, 0x345, 0x1FC2},
+  {0x1F7C, 0x345, 0x1FF2}, {0x1FB6, 0x345, 0x1FB7}, {0x1FBF, 0x300, 0x1FCD}, {0x1FBF, 0x301, 0x1FCE},
+  {0x1FBF, 0x342, 0x1FCF}, {0x1FC6, 0x345, 0x1FC7}, {0x1FF6, 0x345, 0x1FF7}, {0x1FFE, 0x300, 0x1FDD},
+  {0x1FFE, 0x301, 0x1FDE}, {0x1FFE, 0x342, 0x1FDF}, {0x2190, 0x338, 0x219A}, {0x2192, 0x338, 0x219B},
+  {0x2194, 0x338, 0x21AE}, {0x21D0, 0x338, 0x21CD}, {0x21D2, 0x338, 0x21CF}, {0x21D4, 0x338, 0x21CE},
+  {0x2203, 0x338, 0x2204}, {0x2208, 0x338, 0x2209}, {0x220B, 0x338, 0x220C}, {0x2223, 0x338, 0x2224},
+  {0x2225, 0x338, 0x2226}, {0x223C, 0x338, 0x2241}, {0x2243, 0x338, 0x2244}, {0x2245, 0x338, 0x2247},
+  {0x2248, 0x338, 0x2249}, {0x224D, 0x338, 0x226D}, {0x2261, 0x338, 0x2262}, {0x2264, 0x338, 0x2270},
+  {0x2265, 0x338, 0x2271}, {0x2272, 0x338, 0x2274}, {0x2273, 0x338, 0x2275}, {0x2276, 0x338, 0x2278},
+  {0x2277, 0x338, 0x2279}, {0x227A, 0x338, 0x2280}, {0x227B, 0x338, 0x2281}, {0x227C, 0x338, 0x22E0},
+  {0x227D, 0x338, 0x22E1}, {0x2282, 0x338, 0x2284}, {0x2283, 0x338, 0x2285}, {0x2286, 0x338, 0x2288},
+  {0x2287, 0x338, 0x2289}, {0x2291, 0x338, 0x22E2}, {0x2292, 0x338, 0x22E3}, {0x22A2, 0x338, 0x22AC},
+  {0x22A8, 0x338, 0x22AD}, {0x22A9, 0x338, 0x22AE}, {0x22AB, 0x338, 0x22AF}, {0x22B2, 0x338, 0x22EA},
+  {0x22B3, 0x338, 0x22EB}, {0x22B4, 0x338, 0x22EC}, {0x22B5, 0x338, 0x22ED}, {0x3046, 0x3099, 0x3094},
+  {0x304B, 0x3099, 0x304C}, {0x304D, 0x3099, 0x304E}, {0x304F, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052},
+  {0x3053, 0x3099, 0x3054}, {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305A},
+  {0x305B, 0x3099, 0x305C}, {0x305D, 0x3099, 0x305E}, {0x305F, 0x3099, 0x3060}, {0x3061, 0x3099, 0x3062},
+  {0x3064, 0x3099, 0x3065}, {0x3066, 0x3099, 0x3067}, {0x3068, 0x3099, 0x3069}, {0x306F, 0x3099, 0x3070},
+  {0x306F, 0x309A, 0x3071}, {0x3072, 0x3099, 0x3073}, {0x3072, 0x309A, 0x3074}, {0x3075, 0x3099, 0x3076},
+  {0x3075, 0x309A, 0x3077}, {0x3078, 0x3099, 0x3079}, {0x3078, 0x309A, 0x307A}, {0x307B, 0x3099, 0x307C},
+  {0x307B, 0x309A, 0x307D}, {0x309D, 0x3099, 0x309E}, {0x30A6, 0x3099, 0x30F4}, {0x30AB, 0x3099, 0x30AC},
+  {0x30AD, 0x3099, 0x30AE}, {0x30AF, 0x3099, 0x30B0}, {0x30B1, 0x3099, 0x30B2}, {0x30B3, 0x3099, 0x30B4},
+  {0x30B5, 0x3099, 0x30B6}, {0x30B7, 0x3099, 0x30B8}, {0x30B9, 0x3099, 0x30BA}, {0x30BB, 0x3099, 0x30BC},
+  {0x30BD, 0x3099, 0x30BE}, {0x30BF, 0x3099, 0x30C0}, {0x30C1, 0x3099, 0x30C2}, {0x30C4, 0x3099, 0x30C5},
+  {0x30C6, 0x3099, 0x30C7}, {0x30C8, 0x3099, 0x30C9}, {0x30CF, 0x3099, 0x30D0}, {0x30CF, 0x309A, 0x30D1},
+  {0x30D2, 0x3099, 0x30D3}, {0x30D2, 0x309A, 0x30D4}, {0x30D5, 0x3099, 0x30D6}, {0x30D5, 0x309A, 0x30D7},
+  {0x30D8, 0x3099, 0x30D9}, {0x30D8, 0x309A, 0x30DA}, {0x30DB, 0x3099, 0x30DC}, {0x30DB, 0x309A, 0x30DD},
+  {0x30EF, 0x3099, 0x30F7}, {0x30F0, 0x3099, 0x30F8}, {0x30F1, 0x3099, 0x30F9}, {0x30F2, 0x3099, 0x30FA},
+  {0x30FD, 0x3099, 0x30FE}, {0x11099, 0x110BA, 0x1109A}, {0x1109B, 0x110BA, 0x1109C}, {0x110A5, 0x110BA, 0x110AB},
+  {0x11131, 0x11127, 0x1112E}, {0x11132, 0x11127, 0x1112F}, {0x11347, 0x1133E, 0x1134B}, {0x11347, 0x11357, 0x1134C},
+  {0x114B9, 0x114B0, 0x114BC}, {0x114B9, 0x114BA, 0x114BB}, {0x114B9, 0x114BD, 0x114BE}, {0x115B8, 0x115AF, 0x115BA},
+  {0x115B9, 0x115AF, 0x115BB}, {0x11935, 0x11930, 0x11938},
+};
+
+} // namespace foundation::idna_table
+
+#endif // KRAKENBRIDGE_IDNA_TABLE_H
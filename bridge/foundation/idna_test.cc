@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "idna.h"
+#include "gtest/gtest.h"
+
+using namespace foundation;
+
+TEST(NormalizeNFC, composesAndOrdersMarks) {
+  EXPECT_EQ(normalizeNFC(U"kraken"), U"kraken");
+  EXPECT_EQ(normalizeNFC(U"e\u0301"), U"\u00E9");
+  // Marks are reordered by combining class before composing, dot below (220) goes before the circumflex (230).
+  EXPECT_EQ(normalizeNFC(U"a\u0302\u0323"), U"\u1EAD");
+  // Marks never move across a starter.
+  EXPECT_EQ(normalizeNFC(U"\u0438\u0306\u0442"), U"\u0439\u0442");
+  // Composition exclusions and singletons stay decomposed.
+  EXPECT_EQ(normalizeNFC(U"\u0958"), U"\u0915\u093C");
+  EXPECT_EQ(normalizeNFC(U"\u212B"), U"\u00C5");
+  // Hangul is composed algorithmically.
+  EXPECT_EQ(normalizeNFC(U"\u1100\u1161\u11A8"), U"\uAC01");
+  EXPECT_EQ(normalizeNFC(U"\uAC00\u11A8"), U"\uAC01");
+}
+
+TEST(DomainToASCIIUTS46, mapsAndEncodes) {
+  EXPECT_EQ(domainToASCIIUTS46(U"ExAmPlE.com"), "example.com");
+  EXPECT_EQ(domainToASCIIUTS46(U"\uFF27\uFF2F.com"), "go.com");
+  // Nontransitional processing keeps deviations.
+  EXPECT_EQ(domainToASCIIUTS46(U"fa\u00DF.de"), "xn--fa-hia.de");
+  EXPECT_EQ(domainToASCIIUTS46(U"\u2163.example"), "iv.example");
+  EXPECT_EQ(domainToASCIIUTS46(U"a\u00ADb"), "ab");
+  EXPECT_EQ(domainToASCIIUTS46(U"\u0421\u0430\u0439\u0442.\u0440\u0444"), "xn--80aswg.xn--p1ai");
+  // Composed before encoding.
+  EXPECT_EQ(domainToASCIIUTS46(U"cafe\u0301"), "xn--caf-dma");
+  EXPECT_EQ(domainToASCIIUTS46(U"XN--caf-dma"), "xn--caf-dma");
+}
+
+TEST(DomainToASCIIUTS46, rejectsInvalidLabels) {
+  EXPECT_EQ(domainToASCIIUTS46(U"a\uFFFDb"), std::nullopt);
+  EXPECT_EQ(domainToASCIIUTS46(U"xn--"), std::nullopt);
+  EXPECT_EQ(domainToASCIIUTS46(U"xn--pokxncvks"), std::nullopt);
+  // Punycode which decodes to ASCII only.
+  EXPECT_EQ(domainToASCIIUTS46(U"xn--abc-"), std::nullopt);
+  // Decoded labels must be valid, U+00DF is valid, U+00C9 is mapped.
+  EXPECT_EQ(domainToASCIIUTS46(U"xn--fa-hia"), "xn--fa-hia");
+  EXPECT_EQ(domainToASCIIUTS46(U"xn--dca"), std::nullopt);
+  EXPECT_EQ(domainToASCIIUTS46(U"\u0301a"), std::nullopt);
+}
+
+TEST(DomainToASCIIUTS46, checksJoinersAndBidi) {
+  // ZWJ is only allowed after a virama, ZWNJ also between joining letters.
+  EXPECT_EQ(domainToASCIIUTS46(U"a\u200Db"), std::nullopt);
+  EXPECT_EQ(domainToASCIIUTS46(U"\u0915\u094D\u200D"), "xn--11b6iy14e");
+  EXPECT_EQ(domainToASCIIUTS46(U"\u0628\u200C\u0628"), "xn--ngba799q");
+  EXPECT_EQ(domainToASCIIUTS46(U"a\u200Cb"), std::nullopt);
+
+  // Every label of a domain with a right-to-left label must satisfy the Bidi Rule.
+  EXPECT_EQ(domainToASCIIUTS46(U"\u05D0\u05D1.example"), "xn--4dbc.example");
+  EXPECT_EQ(domainToASCIIUTS46(U"1example.\u05D0\u05D1"), std::nullopt);
+  EXPECT_EQ(domainToASCIIUTS46(U"1example.com"), "1example.com");
+  EXPECT_EQ(domainToASCIIUTS46(U"\u05D0a"), std::nullopt);
+  EXPECT_EQ(domainToASCIIUTS46(U"\u0627\u06611"), std::nullopt);
+}
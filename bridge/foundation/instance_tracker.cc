@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "instance_tracker.h"
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__has_include) && !defined(IS_ANDROID)
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define KRAKEN_HAS_BACKTRACE 1
+#endif
+#endif
+
+namespace foundation {
+
+namespace {
+
+constexpr int kMaxStackDepth = 24;
+
+std::mutex trackerMutex;
+std::unordered_multimap<const void *, InstanceTracker::Record> &records() {
+  static auto *map = new std::unordered_multimap<const void *, InstanceTracker::Record>();
+  return *map;
+}
+
+std::vector<void *> captureStack() {
+#if KRAKEN_HAS_BACKTRACE
+  void *frames[kMaxStackDepth];
+  int depth = backtrace(frames, kMaxStackDepth);
+  // Skip track() and captureStack().
+  int skipped = depth > 2 ? 2 : depth;
+  return std::vector<void *>(frames + skipped, frames + depth);
+#else
+  return {};
+#endif
+}
+
+} // namespace
+
+void InstanceTracker::track(const void *object, int32_t contextId, const std::string &kind) {
+  Record record{contextId, kind, captureStack()};
+  std::lock_guard<std::mutex> guard(trackerMutex);
+  records().emplace(object, std::move(record));
+}
+
+void InstanceTracker::untrack(const void *object) {
+  std::lock_guard<std::mutex> guard(trackerMutex);
+  auto it = records().find(object);
+  if (it != records().end()) records().erase(it);
+}
+
+std::vector<InstanceTracker::Record> InstanceTracker::survivors(int32_t contextId) {
+  std::vector<Record> result;
+  std::lock_guard<std::mutex> guard(trackerMutex);
+  for (auto &entry : records()) {
+    if (entry.second.contextId == contextId) result.emplace_back(entry.second);
+  }
+  return result;
+}
+
+std::string InstanceTracker::describe(const std::vector<Record> &records) {
+  std::string output;
+  for (auto &record : records) {
+    output += record.kind + " of context " + std::to_string(record.contextId) + " created at:\n";
+#if KRAKEN_HAS_BACKTRACE
+    char **symbols = backtrace_symbols(record.stack.data(), static_cast<int>(record.stack.size()));
+    for (size_t i = 0; symbols != nullptr && i < record.stack.size(); i++) {
+      output += "  ";
+      output += symbols[i];
+      output += "\n";
+    }
+    free(symbols);
+#else
+    output += "  <stack unavailable>\n";
+#endif
+  }
+  return output;
+}
+
+} // namespace foundation
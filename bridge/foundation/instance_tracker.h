@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_INSTANCE_TRACKER_H
+#define KRAKENBRIDGE_INSTANCE_TRACKER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Debug and test builds keep track of host objects and protected values, release builds compile the tracking out.
+#if !defined(NDEBUG) || defined(IS_TEST)
+#define KRAKEN_TRACK_INSTANCES 1
+#endif
+
+namespace foundation {
+
+// Host objects, values protected from the garbage collector and bridge callbacks of each context, recorded with the
+// native stack they were created on. Everything a context creates must be released when the context is disposed,
+// records left after that are leaks.
+class InstanceTracker {
+public:
+  struct Record {
+    int32_t contextId;
+    std::string kind;
+    // Return addresses of the creating stack, innermost first.
+    std::vector<void *> stack;
+  };
+
+  // The same object may be tracked more than once, each untrack() releases one of its records.
+  static void track(const void *object, int32_t contextId, const std::string &kind);
+  static void untrack(const void *object);
+
+  // Records of contextId which are alive.
+  static std::vector<Record> survivors(int32_t contextId);
+  // Kind and stack of every record, one frame per line.
+  static std::string describe(const std::vector<Record> &records);
+};
+
+} // namespace foundation
+
+#if KRAKEN_TRACK_INSTANCES
+#define KRAKEN_TRACK_INSTANCE(object, contextId, kind) ::foundation::InstanceTracker::track(object, contextId, kind)
+#define KRAKEN_UNTRACK_INSTANCE(object) ::foundation::InstanceTracker::untrack(object)
+#else
+#define KRAKEN_TRACK_INSTANCE(object, contextId, kind) ((void)0)
+#define KRAKEN_UNTRACK_INSTANCE(object) ((void)0)
+#endif
+
+#endif // KRAKENBRIDGE_INSTANCE_TRACKER_H
@@ -4,6 +4,9 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include "async_logger.h"
 #include "colors.h"
 #include "logging.h"
 
@@ -39,19 +42,13 @@ const char *StripPath(const char *path) {
     return path;
 }
 
-} // namespace
-
-LogMessage::LogMessage(LogSeverity severity, const char *file, int line, const char* condition)
-  : severity_(severity), file_(file), line_(line) {
-  if (condition)
-    stream_ << "Check failed: " << condition << ". ";
-}
+std::atomic<LogSeverity> minLogSeverity{LOG_VERBOSE};
 
-LogMessage::~LogMessage() {
+void writeLog(LogSeverity severity, const std::string &message) {
 #if defined(IS_ANDROID)
   android_LogPriority priority = ANDROID_LOG_VERBOSE;
 
-  switch (severity_) {
+  switch (severity) {
   case LOG_VERBOSE:
     priority = ANDROID_LOG_VERBOSE;
     break;
@@ -68,20 +65,74 @@ LogMessage::~LogMessage() {
     priority = ANDROID_LOG_ERROR;
     break;
   }
-  __android_log_write(priority, "KRAKEN_NATIVE_LOG", stream_.str().c_str());
+  __android_log_write(priority, "KRAKEN_NATIVE_LOG", message.c_str());
 #elif defined(IS_IOS)
-  syslog(LOG_ALERT, "%s", stream_.str().c_str());
+  syslog(LOG_ALERT, "%s", message.c_str());
 #else
-  if (severity_ == LOG_ERROR) {
-    std::cerr << stream_.str() << std::endl;
-    std::cerr.flush();
+  if (severity == LOG_ERROR) {
+    std::cerr << message << std::endl;
   } else {
-    std::cout << stream_.str() << std::endl;
-    std::cout.flush();
+    std::cout << message << std::endl;
   }
 #endif
 }
 
+// Never destroyed, so messages logged by static destructors are still accepted. The queued messages are written
+// when the process exits normally.
+AsyncLogger &getLogger() {
+  static AsyncLogger *logger = []() {
+    auto logger = new AsyncLogger(writeLog);
+    std::atexit([]() { getLogger().flush(); });
+    return logger;
+  }();
+  return *logger;
+}
+
+} // namespace
+
+LogMessage::LogMessage(LogSeverity severity, const char *file, int line, const char* condition)
+  : severity_(severity), file_(file), line_(line) {
+  if (condition)
+    stream_ << "Check failed: " << condition << ". ";
+}
+
+LogMessage::~LogMessage() {
+  // A fatal message may be the last one before the process goes away, write it with the queued ones right now.
+  if (severity_ >= LOG_FATAL) {
+    getLogger().flush();
+    writeLog(severity_, stream_.str());
+    return;
+  }
+  getLogger().post(severity_, stream_.str());
+}
+
+void setMinLogSeverity(LogSeverity severity) {
+  minLogSeverity.store(severity, std::memory_order_relaxed);
+}
+
+bool shouldLog(LogSeverity severity) {
+  return severity >= minLogSeverity.load(std::memory_order_relaxed);
+}
+
+LogSeverity getConsoleLogSeverity(const std::string &level) {
+  switch (level.empty() ? 'l' : level[0]) {
+  case 'i':
+    return LOG_INFO;
+  case 'd':
+    return LOG_DEBUG_;
+  case 'w':
+    return LOG_WARN;
+  case 'e':
+    return LOG_ERROR;
+  default:
+    return LOG_VERBOSE;
+  }
+}
+
+void flushLog() {
+  getLogger().flush();
+}
+
 void printLog(std::stringstream &stream, std::string level) {
 #ifdef ENABLE_DEBUGGER
     JSC::MessageLevel _log_level = JSC::MessageLevel::Log;
@@ -49,6 +49,15 @@ private:
 
 void printLog(std::stringstream &stream, std::string level);
 
+// Messages below the minimum severity are discarded before they are formatted, all messages are logged by default.
+void setMinLogSeverity(LogSeverity severity);
+bool shouldLog(LogSeverity severity);
+// Severity of a console method, such as "log" or "warn".
+LogSeverity getConsoleLogSeverity(const std::string &level);
+
+// Messages are written by a background thread, block until the messages logged before are written.
+void flushLog();
+
 } // namespace foundation
 
 #define KRAKEN_LOG_STREAM(severity) ::foundation::LogMessage(::foundation::LOG_##severity, __FILE__, __LINE__, nullptr).stream()
@@ -60,7 +69,8 @@ void printLog(std::stringstream &stream, std::string level);
     ? (void)0                                                                                                          \
     : ::foundation::LogMessageVoidify() & ::foundation::LogMessage(::foundation::LOG_FATAL, 0, 0, nullptr).stream()
 
-#define KRAKEN_LOG(severity) KRAKEN_LAZY_STREAM(KRAKEN_LOG_STREAM(severity), true)
+#define KRAKEN_LOG(severity)                                                                                           \
+  KRAKEN_LAZY_STREAM(KRAKEN_LOG_STREAM(severity), ::foundation::shouldLog(::foundation::LOG_##severity))
 
 #define KRAKEN_CHECK(condition)                                              \
   KRAKEN_LAZY_STREAM(                                                        \
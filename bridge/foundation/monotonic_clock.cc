@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "monotonic_clock.h"
+
+namespace foundation {
+
+using namespace std::chrono;
+
+namespace {
+
+inline int64_t toMicroseconds(steady_clock::time_point time) {
+  return duration_cast<microseconds>(time.time_since_epoch()).count();
+}
+
+} // namespace
+
+MonotonicClock::MonotonicClock(TimeSource source) : m_source(std::move(source)) {
+  resetTimeOrigin();
+}
+
+void MonotonicClock::resetTimeOrigin() {
+  m_timeOrigin = m_source();
+  m_wallTimeOrigin = system_clock::now();
+}
+
+void MonotonicClock::setTimeSource(TimeSource source) {
+  m_source = std::move(source);
+}
+
+double MonotonicClock::timeOriginSinceEpoch() const {
+  return duration_cast<microseconds>(m_wallTimeOrigin.time_since_epoch()).count() / 1000.0;
+}
+
+int64_t MonotonicClock::nowMicroseconds() const {
+  return toMicroseconds(m_source());
+}
+
+double MonotonicClock::now() const {
+  return toHighResTime(m_source());
+}
+
+double MonotonicClock::toHighResTime(int64_t time) const {
+  return (time - toMicroseconds(m_timeOrigin)) / 1000.0;
+}
+
+double MonotonicClock::toHighResTime(steady_clock::time_point time) const {
+  return duration_cast<microseconds>(time - m_timeOrigin).count() / 1000.0;
+}
+
+int64_t MonotonicClock::fromEpochMicroseconds(int64_t time) const {
+  int64_t wallTimeOrigin = duration_cast<microseconds>(m_wallTimeOrigin.time_since_epoch()).count();
+  return toMicroseconds(m_timeOrigin) + time - wallTimeOrigin;
+}
+
+} // namespace foundation
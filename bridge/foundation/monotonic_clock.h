@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_MONOTONIC_CLOCK_H
+#define KRAKENBRIDGE_MONOTONIC_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace foundation {
+
+// Time of a context, https://w3c.github.io/hr-time/#dfn-time-origin. Durations come from a monotonic time source so
+// they never go backwards when the wall clock is adjusted, the wall clock is only read when the time origin is set.
+class MonotonicClock {
+public:
+  using TimeSource = std::function<std::chrono::steady_clock::time_point()>;
+
+  explicit MonotonicClock(TimeSource source = std::chrono::steady_clock::now);
+
+  // Anchor the time origin at the current time.
+  void resetTimeOrigin();
+  // Replace the time source, the time origin is kept so tests can move time relative to it.
+  void setTimeSource(TimeSource source);
+
+  std::chrono::steady_clock::time_point timeOrigin() const {
+    return m_timeOrigin;
+  }
+  // Milliseconds since epoch of the time origin, with microsecond precision.
+  double timeOriginSinceEpoch() const;
+
+  // Current time of the time source in microseconds. Values are only comparable with each other, convert them with
+  // toHighResTime() before exposing them.
+  int64_t nowMicroseconds() const;
+  // DOMHighResTimeStamp of now, milliseconds since the time origin with microsecond precision.
+  double now() const;
+  double toHighResTime(int64_t time) const;
+  double toHighResTime(std::chrono::steady_clock::time_point time) const;
+  // Map a wall clock time reported by dart, in microseconds since epoch, to the time source.
+  int64_t fromEpochMicroseconds(int64_t time) const;
+
+private:
+  TimeSource m_source;
+  std::chrono::steady_clock::time_point m_timeOrigin;
+  std::chrono::system_clock::time_point m_wallTimeOrigin;
+};
+
+} // namespace foundation
+
+#endif // KRAKENBRIDGE_MONOTONIC_CLOCK_H
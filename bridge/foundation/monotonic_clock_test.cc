@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "monotonic_clock.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cmath>
+
+using namespace foundation;
+
+namespace {
+
+// Freeze clock at the given milliseconds since its time origin.
+void setTime(MonotonicClock &clock, double milliseconds) {
+  auto time = std::chrono::microseconds(std::llround(milliseconds * 1000));
+  auto timeOrigin = clock.timeOrigin();
+  clock.setTimeSource([timeOrigin, time]() { return timeOrigin + time; });
+}
+
+} // namespace
+
+TEST(MonotonicClock, nowKeepsSubMillisecondPrecision) {
+  MonotonicClock clock;
+  clock.resetTimeOrigin();
+  setTime(clock, 12.345);
+  EXPECT_EQ(clock.now(), 12.345);
+}
+
+TEST(MonotonicClock, timesAreRelativeToTheTimeOrigin) {
+  MonotonicClock clock;
+  clock.resetTimeOrigin();
+  setTime(clock, 10);
+  int64_t start = clock.nowMicroseconds();
+  setTime(clock, 25.5);
+  int64_t end = clock.nowMicroseconds();
+  EXPECT_EQ(end - start, 15500);
+  EXPECT_EQ(clock.toHighResTime(start), 10);
+  EXPECT_EQ(clock.toHighResTime(end), 25.5);
+}
+
+TEST(MonotonicClock, timeOriginIsCloseToTheWallClock) {
+  MonotonicClock clock;
+  clock.resetTimeOrigin();
+  auto epoch = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::system_clock::now().time_since_epoch());
+  double drift = clock.timeOriginSinceEpoch() + clock.now() - epoch.count() / 1000.0;
+  EXPECT_LT(std::abs(drift), 50);
+}
+
+TEST(MonotonicClock, mapsWallClockTimesToTheTimeSource) {
+  MonotonicClock clock;
+  clock.resetTimeOrigin();
+  setTime(clock, 0);
+  auto origin = static_cast<int64_t>(clock.timeOriginSinceEpoch() * 1000);
+  EXPECT_EQ(clock.toHighResTime(clock.fromEpochMicroseconds(origin + 42500)), 42.5);
+}
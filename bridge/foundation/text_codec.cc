@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "text_codec.h"
+#include <algorithm>
+#include <cstring>
+
+namespace foundation {
+
+namespace {
+
+// High bits of 8 bytes, or of 4 UTF-16 code units above U+007F, are checked at once to skip ASCII runs.
+constexpr uint64_t kASCIIByteMask = 0x8080808080808080ULL;
+constexpr uint64_t kASCIIUnitMask = 0xFF80FF80FF80FF80ULL;
+
+inline bool isLeadSurrogate(uint32_t unit) {
+  return unit >= 0xD800 && unit <= 0xDBFF;
+}
+
+inline bool isTrailSurrogate(uint32_t unit) {
+  return unit >= 0xDC00 && unit <= 0xDFFF;
+}
+
+inline void appendCodePoint(uint32_t codePoint, std::u16string &output) {
+  if (codePoint >= 0x10000) {
+    codePoint -= 0x10000;
+    output.push_back(static_cast<char16_t>(0xD800 + (codePoint >> 10)));
+    output.push_back(static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF)));
+  } else {
+    output.push_back(static_cast<char16_t>(codePoint));
+  }
+}
+
+inline size_t utf8Length(uint32_t codePoint) {
+  if (codePoint < 0x80) return 1;
+  if (codePoint < 0x800) return 2;
+  if (codePoint < 0x10000) return 3;
+  return 4;
+}
+
+inline size_t writeUTF8(uint32_t codePoint, uint8_t *output) {
+  if (codePoint < 0x80) {
+    output[0] = static_cast<uint8_t>(codePoint);
+    return 1;
+  }
+  if (codePoint < 0x800) {
+    output[0] = static_cast<uint8_t>(0xC0 | (codePoint >> 6));
+    output[1] = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+    return 2;
+  }
+  if (codePoint < 0x10000) {
+    output[0] = static_cast<uint8_t>(0xE0 | (codePoint >> 12));
+    output[1] = static_cast<uint8_t>(0x80 | ((codePoint >> 6) & 0x3F));
+    output[2] = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+    return 3;
+  }
+  output[0] = static_cast<uint8_t>(0xF0 | (codePoint >> 18));
+  output[1] = static_cast<uint8_t>(0x80 | ((codePoint >> 12) & 0x3F));
+  output[2] = static_cast<uint8_t>(0x80 | ((codePoint >> 6) & 0x3F));
+  output[3] = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+  return 4;
+}
+
+// Read a code point at index, lone surrogates are replaced with U+FFFD. Returns the number of code units read.
+inline size_t readCodePoint(const char16_t *input, size_t length, size_t index, uint32_t &codePoint) {
+  codePoint = input[index];
+  if (isLeadSurrogate(codePoint) && index + 1 < length && isTrailSurrogate(input[index + 1])) {
+    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (input[index + 1] - 0xDC00);
+    return 2;
+  }
+  if (isLeadSurrogate(codePoint) || isTrailSurrogate(codePoint)) codePoint = 0xFFFD;
+  return 1;
+}
+
+} // namespace
+
+bool getTextEncoding(std::string label, TextEncoding &encoding) {
+  auto isWhitespace = [](char c) { return c == '\t' || c == '\n' || c == '\f' || c == '\r' || c == ' '; };
+  label.erase(label.begin(), std::find_if_not(label.begin(), label.end(), isWhitespace));
+  label.erase(std::find_if_not(label.rbegin(), label.rend(), isWhitespace).base(), label.end());
+  std::transform(label.begin(), label.end(), label.begin(), [](unsigned char c) { return std::tolower(c); });
+
+  if (label == "utf-8" || label == "utf8" || label == "unicode-1-1-utf-8" || label == "unicode11utf8" ||
+      label == "unicode20utf8" || label == "x-unicode20utf8") {
+    encoding = TextEncoding::UTF8;
+    return true;
+  }
+
+  if (label == "utf-16le" || label == "utf-16" || label == "csunicode" || label == "iso-10646-ucs-2" ||
+      label == "ucs-2" || label == "unicode" || label == "unicodefeff") {
+    encoding = TextEncoding::UTF16LE;
+    return true;
+  }
+
+  return false;
+}
+
+const char *getTextEncodingName(TextEncoding encoding) {
+  return encoding == TextEncoding::UTF8 ? "utf-8" : "utf-16le";
+}
+
+TextDecoder::TextDecoder(TextEncoding encoding, bool fatal, bool ignoreBOM)
+  : m_encoding(encoding), m_fatal(fatal), m_ignoreBOM(ignoreBOM) {}
+
+void TextDecoder::reset() {
+  m_bomSeen = false;
+  m_codePoint = 0;
+  m_bytesSeen = 0;
+  m_bytesNeeded = 0;
+  m_lowerBoundary = 0x80;
+  m_upperBoundary = 0xBF;
+  m_leadByte = -1;
+  m_leadSurrogate = -1;
+}
+
+bool TextDecoder::decode(const uint8_t *bytes, size_t length, bool stream, std::u16string &output) {
+  size_t start = output.size();
+  output.reserve(start + length);
+
+  bool succeed = m_encoding == TextEncoding::UTF8 ? decodeUTF8(bytes, length, !stream, output)
+                                                   : decodeUTF16LE(bytes, length, !stream, output);
+  if (!succeed) {
+    reset();
+    return false;
+  }
+
+  // The BOM is only stripped at the beginning of a stream, which may be split into several chunks.
+  if (!m_ignoreBOM && !m_bomSeen && output.size() > start) {
+    m_bomSeen = true;
+    if (output[start] == 0xFEFF) output.erase(start, 1);
+  }
+
+  if (!stream) reset();
+  return true;
+}
+
+// https://encoding.spec.whatwg.org/#utf-8-decoder
+bool TextDecoder::decodeUTF8(const uint8_t *bytes, size_t length, bool flush, std::u16string &output) {
+  size_t i = 0;
+  while (i < length) {
+    if (m_bytesNeeded == 0) {
+      while (i + 8 <= length) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        if ((word & kASCIIByteMask) != 0) break;
+        for (size_t k = 0; k < 8; k++) output.push_back(bytes[i + k]);
+        i += 8;
+      }
+      if (i >= length) break;
+
+      uint8_t byte = bytes[i++];
+      if (byte < 0x80) {
+        output.push_back(byte);
+      } else if (byte >= 0xC2 && byte <= 0xDF) {
+        m_bytesNeeded = 1;
+        m_codePoint = byte & 0x1F;
+      } else if (byte >= 0xE0 && byte <= 0xEF) {
+        if (byte == 0xE0) m_lowerBoundary = 0xA0;
+        if (byte == 0xED) m_upperBoundary = 0x9F;
+        m_bytesNeeded = 2;
+        m_codePoint = byte & 0x0F;
+      } else if (byte >= 0xF0 && byte <= 0xF4) {
+        if (byte == 0xF0) m_lowerBoundary = 0x90;
+        if (byte == 0xF4) m_upperBoundary = 0x8F;
+        m_bytesNeeded = 3;
+        m_codePoint = byte & 0x07;
+      } else {
+        if (m_fatal) return false;
+        output.push_back(0xFFFD);
+      }
+      continue;
+    }
+
+    uint8_t byte = bytes[i];
+    if (byte < m_lowerBoundary || byte > m_upperBoundary) {
+      // The byte is not consumed, it starts the next sequence.
+      m_codePoint = 0;
+      m_bytesNeeded = 0;
+      m_bytesSeen = 0;
+      m_lowerBoundary = 0x80;
+      m_upperBoundary = 0xBF;
+      if (m_fatal) return false;
+      output.push_back(0xFFFD);
+      continue;
+    }
+
+    i++;
+    m_lowerBoundary = 0x80;
+    m_upperBoundary = 0xBF;
+    m_codePoint = (m_codePoint << 6) | (byte & 0x3F);
+    if (++m_bytesSeen < m_bytesNeeded) continue;
+
+    appendCodePoint(m_codePoint, output);
+    m_codePoint = 0;
+    m_bytesNeeded = 0;
+    m_bytesSeen = 0;
+  }
+
+  if (flush && m_bytesNeeded != 0) {
+    m_codePoint = 0;
+    m_bytesNeeded = 0;
+    m_bytesSeen = 0;
+    m_lowerBoundary = 0x80;
+    m_upperBoundary = 0xBF;
+    if (m_fatal) return false;
+    output.push_back(0xFFFD);
+  }
+
+  return true;
+}
+
+// https://encoding.spec.whatwg.org/#shared-utf-16-decoder
+bool TextDecoder::decodeUTF16LE(const uint8_t *bytes, size_t length, bool flush, std::u16string &output) {
+  for (size_t i = 0; i < length; i++) {
+    if (m_leadByte < 0) {
+      m_leadByte = bytes[i];
+      continue;
+    }
+
+    uint32_t unit = static_cast<uint32_t>(m_leadByte) | (static_cast<uint32_t>(bytes[i]) << 8);
+    m_leadByte = -1;
+
+    if (m_leadSurrogate >= 0) {
+      auto leadSurrogate = static_cast<char16_t>(m_leadSurrogate);
+      m_leadSurrogate = -1;
+      if (isTrailSurrogate(unit)) {
+        output.push_back(leadSurrogate);
+        output.push_back(static_cast<char16_t>(unit));
+        continue;
+      }
+      // The unpaired lead surrogate is an error, the current unit is decoded as usual.
+      if (m_fatal) return false;
+      output.push_back(0xFFFD);
+    }
+
+    if (isLeadSurrogate(unit)) {
+      m_leadSurrogate = static_cast<int32_t>(unit);
+    } else if (isTrailSurrogate(unit)) {
+      if (m_fatal) return false;
+      output.push_back(0xFFFD);
+    } else {
+      output.push_back(static_cast<char16_t>(unit));
+    }
+  }
+
+  if (flush && (m_leadByte >= 0 || m_leadSurrogate >= 0)) {
+    m_leadByte = -1;
+    m_leadSurrogate = -1;
+    if (m_fatal) return false;
+    output.push_back(0xFFFD);
+  }
+
+  return true;
+}
+
+void encodeUTF8(const char16_t *input, size_t length, std::string &output) {
+  output.reserve(output.size() + length);
+
+  size_t i = 0;
+  while (i < length) {
+    while (i + 4 <= length) {
+      uint64_t word;
+      memcpy(&word, input + i, sizeof(word));
+      if ((word & kASCIIUnitMask) != 0) break;
+      for (size_t k = 0; k < 4; k++) output.push_back(static_cast<char>(input[i + k]));
+      i += 4;
+    }
+    if (i >= length) break;
+
+    uint32_t codePoint;
+    i += readCodePoint(input, length, i, codePoint);
+    uint8_t buffer[4];
+    output.append(reinterpret_cast<char *>(buffer), writeUTF8(codePoint, buffer));
+  }
+}
+
+void encodeUTF8Into(const char16_t *input, size_t length, uint8_t *destination, size_t capacity, size_t &read,
+                    size_t &written) {
+  size_t i = 0;
+  written = 0;
+  while (i < length) {
+    uint32_t codePoint;
+    size_t units = readCodePoint(input, length, i, codePoint);
+    if (written + utf8Length(codePoint) > capacity) break;
+    written += writeUTF8(codePoint, destination + written);
+    i += units;
+  }
+  read = i;
+}
+
+} // namespace foundation
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_TEXT_CODEC_H
+#define KRAKENBRIDGE_TEXT_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace foundation {
+
+enum class TextEncoding { UTF8, UTF16LE };
+
+// Resolve an encoding label, https://encoding.spec.whatwg.org/#concept-encoding-get. Only UTF-8 and UTF-16LE
+// are supported, returns false for other labels.
+bool getTextEncoding(std::string label, TextEncoding &encoding);
+const char *getTextEncodingName(TextEncoding encoding);
+
+// A streaming decoder of https://encoding.spec.whatwg.org/#interface-textdecoder. Bytes of an incomplete sequence
+// at the end of a chunk are kept until the next chunk when stream is true.
+class TextDecoder {
+public:
+  TextDecoder(TextEncoding encoding, bool fatal, bool ignoreBOM);
+
+  // Decode bytes and append UTF-16 code units to output. Malformed sequences are replaced with U+FFFD, or fail the
+  // whole call in fatal mode, the decoder is reset after a failure or when stream is false.
+  bool decode(const uint8_t *bytes, size_t length, bool stream, std::u16string &output);
+  void reset();
+
+  TextEncoding encoding() const {
+    return m_encoding;
+  }
+  bool fatal() const {
+    return m_fatal;
+  }
+  bool ignoreBOM() const {
+    return m_ignoreBOM;
+  }
+
+private:
+  bool decodeUTF8(const uint8_t *bytes, size_t length, bool flush, std::u16string &output);
+  bool decodeUTF16LE(const uint8_t *bytes, size_t length, bool flush, std::u16string &output);
+
+  TextEncoding m_encoding;
+  bool m_fatal;
+  bool m_ignoreBOM;
+  bool m_bomSeen{false};
+
+  // UTF-8 state.
+  uint32_t m_codePoint{0};
+  uint8_t m_bytesSeen{0};
+  uint8_t m_bytesNeeded{0};
+  uint8_t m_lowerBoundary{0x80};
+  uint8_t m_upperBoundary{0xBF};
+
+  // UTF-16LE state, -1 for none.
+  int32_t m_leadByte{-1};
+  int32_t m_leadSurrogate{-1};
+};
+
+// Encode UTF-16 code units as UTF-8, lone surrogates are replaced with U+FFFD.
+void encodeUTF8(const char16_t *input, size_t length, std::string &output);
+
+// https://encoding.spec.whatwg.org/#dom-textencoder-encodeinto, encode as many code points as fit in destination.
+// read is the number of UTF-16 code units consumed and written the number of bytes written.
+void encodeUTF8Into(const char16_t *input, size_t length, uint8_t *destination, size_t capacity, size_t &read,
+                    size_t &written);
+
+} // namespace foundation
+
+#endif // KRAKENBRIDGE_TEXT_CODEC_H
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "trace_event.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace foundation {
+
+namespace {
+
+// Fields are written by the owner thread and may be read by an exporting thread at the same time, relaxed atomics
+// keep that well defined. A slot overwritten during export is detected by re-reading the write index, seqlock style.
+struct TraceSlot {
+  std::atomic<const char *> category{nullptr};
+  std::atomic<const char *> name{nullptr};
+  std::atomic<int64_t> start{0};
+  std::atomic<int64_t> duration{0};
+};
+
+struct TraceEvent {
+  const char *category;
+  const char *name;
+  int64_t start;
+  int64_t duration;
+};
+
+class ThreadTraceBuffer {
+public:
+  explicit ThreadTraceBuffer(int32_t tid) : m_tid(tid), m_slots(Tracing::kEventsPerThread) {}
+
+  // Only called by the owner thread.
+  void add(const char *category, const char *name, int64_t start, int64_t duration) {
+    uint64_t index = m_written.load(std::memory_order_relaxed);
+    TraceSlot &slot = m_slots[index % m_slots.size()];
+    slot.category.store(category, std::memory_order_relaxed);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.duration.store(duration, std::memory_order_relaxed);
+    m_written.store(index + 1, std::memory_order_release);
+  }
+
+  void clear() {
+    m_cleared.store(m_written.load(std::memory_order_acquire), std::memory_order_relaxed);
+  }
+
+  void collect(std::vector<TraceEvent> &events) const {
+    uint64_t end = m_written.load(std::memory_order_acquire);
+    uint64_t begin = firstReadable(end);
+    size_t offset = events.size();
+    for (uint64_t i = begin; i < end; i++) {
+      const TraceSlot &slot = m_slots[i % m_slots.size()];
+      events.push_back({slot.category.load(std::memory_order_relaxed), slot.name.load(std::memory_order_relaxed),
+                        slot.start.load(std::memory_order_relaxed), slot.duration.load(std::memory_order_relaxed)});
+    }
+
+    // Drop the slots which the owner thread may have overwritten while they were read. The owner writes the slot of
+    // index m_written before publishing it, so that slot is already being overwritten.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t overwritten = firstReadable(m_written.load(std::memory_order_relaxed) + 1);
+    if (overwritten > begin) {
+      auto stale = static_cast<size_t>(std::min(overwritten, end) - begin);
+      events.erase(events.begin() + offset, events.begin() + offset + stale);
+    }
+  }
+
+  int32_t tid() const {
+    return m_tid;
+  }
+
+private:
+  uint64_t firstReadable(uint64_t written) const {
+    uint64_t cleared = m_cleared.load(std::memory_order_relaxed);
+    uint64_t oldest = written > m_slots.size() ? written - m_slots.size() : 0;
+    return std::max(cleared, oldest);
+  }
+
+  int32_t m_tid;
+  std::vector<TraceSlot> m_slots;
+  std::atomic<uint64_t> m_written{0};
+  std::atomic<uint64_t> m_cleared{0};
+};
+
+// Buffers outlive their threads so spans of finished threads can still be exported. The lock is only taken when a
+// thread records its first span and when exporting.
+std::mutex bufferRegistryMutex;
+std::vector<std::shared_ptr<ThreadTraceBuffer>> &bufferRegistry() {
+  static auto *registry = new std::vector<std::shared_ptr<ThreadTraceBuffer>>();
+  return *registry;
+}
+
+ThreadTraceBuffer *currentThreadBuffer() {
+  thread_local ThreadTraceBuffer *buffer = nullptr;
+  if (buffer == nullptr) {
+    std::lock_guard<std::mutex> guard(bufferRegistryMutex);
+    auto &registry = bufferRegistry();
+    registry.emplace_back(std::make_shared<ThreadTraceBuffer>(static_cast<int32_t>(registry.size()) + 1));
+    buffer = registry.back().get();
+  }
+  return buffer;
+}
+
+void appendJSONString(std::string &output, const char *value) {
+  output.push_back('"');
+  for (const char *p = value; *p != '\0'; p++) {
+    auto c = static_cast<unsigned char>(*p);
+    if (c == '"' || c == '\\') {
+      output.push_back('\\');
+      output.push_back(static_cast<char>(c));
+    } else if (c < 0x20) {
+      static const char *hex = "0123456789abcdef";
+      output.append("\\u00");
+      output.push_back(hex[c >> 4]);
+      output.push_back(hex[c & 0xF]);
+    } else {
+      output.push_back(static_cast<char>(c));
+    }
+  }
+  output.push_back('"');
+}
+
+} // namespace
+
+std::atomic<bool> Tracing::s_enabled{false};
+
+void Tracing::setEnabled(bool enabled) {
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+int64_t Tracing::now() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+void Tracing::record(const char *category, const char *name, int64_t start, int64_t duration) {
+  currentThreadBuffer()->add(category, name, start, duration);
+}
+
+void Tracing::clear() {
+  std::lock_guard<std::mutex> guard(bufferRegistryMutex);
+  for (auto &buffer : bufferRegistry()) {
+    buffer->clear();
+  }
+}
+
+std::string Tracing::toJSON() {
+  std::string output = "{\"traceEvents\":[";
+  std::vector<TraceEvent> events;
+  bool first = true;
+
+  std::lock_guard<std::mutex> guard(bufferRegistryMutex);
+  for (auto &buffer : bufferRegistry()) {
+    events.clear();
+    buffer->collect(events);
+    // Spans are recorded when they end, so nested spans come before their parents. A parent starting in the same
+    // microsecond as its child is the longer one.
+    std::sort(events.begin(), events.end(), [](const TraceEvent &a, const TraceEvent &b) {
+      return a.start != b.start ? a.start < b.start : a.duration > b.duration;
+    });
+
+    for (auto &event : events) {
+      if (!first) output.push_back(',');
+      first = false;
+      output.append("{\"name\":");
+      appendJSONString(output, event.name);
+      output.append(",\"cat\":");
+      appendJSONString(output, event.category);
+      // The process id is only used to group threads, all spans come from this process.
+      output.append(",\"ph\":\"X\",\"pid\":1,\"tid\":");
+      output.append(std::to_string(buffer->tid()));
+      output.append(",\"ts\":");
+      output.append(std::to_string(event.start));
+      output.append(",\"dur\":");
+      output.append(std::to_string(event.duration));
+      output.push_back('}');
+    }
+  }
+
+  output.append("],\"displayTimeUnit\":\"ms\"}");
+  return output;
+}
+
+bool Tracing::writeJSON(const std::string &path) {
+  std::ofstream file(path, std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!file.is_open()) return false;
+  file << toJSON();
+  file.close();
+  return !file.fail();
+}
+
+} // namespace foundation
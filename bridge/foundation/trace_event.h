@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_TRACE_EVENT_H
+#define KRAKENBRIDGE_TRACE_EVENT_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace foundation {
+
+// Scoped spans exported as complete ("ph": "X") events of the Chrome trace event format, which can be loaded by
+// chrome://tracing or Perfetto. Every thread records into its own fixed size ring without taking a lock, the oldest
+// spans of a thread are overwritten when its ring is full. Names and categories must be string literals, only their
+// pointers are recorded.
+class Tracing {
+public:
+  static constexpr size_t kEventsPerThread = 16384;
+
+  static void setEnabled(bool enabled);
+  static bool isEnabled() {
+    return s_enabled.load(std::memory_order_relaxed);
+  }
+
+  // Microseconds of the steady clock, which is the time base of all spans.
+  static int64_t now();
+  static void record(const char *category, const char *name, int64_t start, int64_t duration);
+
+  // Drop the spans recorded so far by all threads.
+  static void clear();
+  // {"traceEvents": [...]} of the spans recorded by all threads, ordered by thread then start time.
+  static std::string toJSON();
+  static bool writeJSON(const std::string &path);
+
+private:
+  static std::atomic<bool> s_enabled;
+};
+
+class TraceScope {
+public:
+  TraceScope(const char *category, const char *name)
+    : m_category(category), m_name(name), m_start(Tracing::isEnabled() ? Tracing::now() : -1) {}
+  ~TraceScope() {
+    if (m_start >= 0) Tracing::record(m_category, m_name, m_start, Tracing::now() - m_start);
+  }
+
+  TraceScope(const TraceScope &) = delete;
+  TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+  const char *m_category;
+  const char *m_name;
+  int64_t m_start;
+};
+
+} // namespace foundation
+
+#define KRAKEN_TRACE_CONCAT_IMPL(a, b) a##b
+#define KRAKEN_TRACE_CONCAT(a, b) KRAKEN_TRACE_CONCAT_IMPL(a, b)
+
+// Trace the rest of the enclosing scope, costs a relaxed atomic load when tracing is disabled.
+#define TRACE_EVENT(category, name)                                                                                    \
+  ::foundation::TraceScope KRAKEN_TRACE_CONCAT(__kraken_trace_scope_, __LINE__)(category, name)
+
+#endif // KRAKENBRIDGE_TRACE_EVENT_H
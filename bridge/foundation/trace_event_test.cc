@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "trace_event.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <thread>
+
+using namespace foundation;
+
+namespace {
+
+size_t countOf(const std::string &json, const std::string &pattern) {
+  size_t count = 0;
+  for (size_t i = json.find(pattern); i != std::string::npos; i = json.find(pattern, i + 1)) count++;
+  return count;
+}
+
+class TracingTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    Tracing::clear();
+    Tracing::setEnabled(true);
+  }
+
+  void TearDown() override {
+    Tracing::setEnabled(false);
+    Tracing::clear();
+  }
+};
+
+} // namespace
+
+TEST_F(TracingTest, nestedSpansComeBeforeTheirChildren) {
+  std::thread([] {
+    Tracing::record("test", "child", 10, 1);
+    Tracing::record("test", "parent", 10, 5);
+  }).join();
+  std::string json = Tracing::toJSON();
+  EXPECT_LT(json.find("\"name\":\"parent\""), json.find("\"name\":\"child\""));
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+}
+
+TEST_F(TracingTest, disabledScopesRecordNothing) {
+  Tracing::setEnabled(false);
+  std::thread([] { TRACE_EVENT("test", "disabled"); }).join();
+  EXPECT_EQ(Tracing::toJSON().find("\"name\":\"disabled\""), std::string::npos);
+}
+
+TEST_F(TracingTest, fullRingKeepsTheNewestSpans) {
+  size_t overflow = 10;
+  std::thread([overflow] {
+    for (size_t i = 0; i < Tracing::kEventsPerThread + overflow; i++) {
+      Tracing::record("test", "ring", static_cast<int64_t>(i), 0);
+    }
+  }).join();
+  std::string json = Tracing::toJSON();
+  // The slot after the newest span counts as being overwritten, it can't be told apart from one the owner thread is
+  // writing right now.
+  EXPECT_EQ(countOf(json, "\"name\":\"ring\""), Tracing::kEventsPerThread - 1);
+  EXPECT_EQ(json.find("\"ts\":" + std::to_string(overflow) + ","), std::string::npos);
+  EXPECT_NE(json.find("\"ts\":" + std::to_string(overflow + 1) + ","), std::string::npos);
+}
+
+TEST_F(TracingTest, clearDropsRecordedSpans) {
+  std::thread([] { Tracing::record("test", "cleared", 1, 1); }).join();
+  Tracing::clear();
+  std::thread([] { Tracing::record("test", "kept", 2, 1); }).join();
+  std::string json = Tracing::toJSON();
+  EXPECT_EQ(json.find("\"name\":\"cleared\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"kept\""), std::string::npos);
+}
@@ -6,15 +6,62 @@
 #include "ui_command_queue.h"
 #include "dart_methods.h"
 #include "include/kraken_bridge.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
 
 namespace foundation {
 
+// 32k characters, large enough for most of the batches.
+static const size_t UI_COMMAND_ARENA_BLOCK_SIZE = 32 * 1024;
+
+UICommandArgsArena::~UICommandArgsArena() {
+  for (auto &block : blocks) {
+    delete[] block.data;
+  }
+}
+
+const uint16_t *UICommandArgsArena::copy(const uint16_t *string, size_t length) {
+  if (length == 0) return nullptr;
+
+  while (blockIndex < blocks.size() && offset + length > blocks[blockIndex].capacity) {
+    blockIndex++;
+    offset = 0;
+  }
+
+  if (blockIndex == blocks.size()) {
+    size_t capacity = std::max(length, UI_COMMAND_ARENA_BLOCK_SIZE);
+    blocks.emplace_back(Block{new uint16_t[capacity], capacity});
+    offset = 0;
+  }
+
+  uint16_t *target = blocks[blockIndex].data + offset;
+  std::memcpy(target, string, length * sizeof(uint16_t));
+  offset += length;
+  used += length * sizeof(uint16_t);
+  return target;
+}
+
+void UICommandArgsArena::reset() {
+  blockIndex = 0;
+  offset = 0;
+  used = 0;
+}
+
 UICommandTaskMessageQueue::UICommandTaskMessageQueue(int32_t contextId) : contextId(contextId) {}
 
+UICommandTaskMessageQueue::UICommandTaskMessageQueue(int32_t contextId, bool standby)
+  : contextId(contextId), standby(standby) {}
+
+void UICommandTaskMessageQueue::requestBatchUpdate() {
+  update_batched = true;
+  if (standby) return;
+  kraken::getDartMethod()->requestBatchUpdate(contextId);
+}
+
 void UICommandTaskMessageQueue::registerCommand(int32_t id, int32_t type, void *nativePtr, bool batchedUpdate) {
   if (batchedUpdate) {
-    kraken::getDartMethod()->requestBatchUpdate(contextId);
-    update_batched = true;
+    requestBatchUpdate();
   }
 
   UICommandItem item{id, type, nativePtr};
@@ -23,8 +70,7 @@ void UICommandTaskMessageQueue::registerCommand(int32_t id, int32_t type, void *
 
 void UICommandTaskMessageQueue::registerCommand(int32_t id, int32_t type, void *nativePtr) {
   if (!update_batched) {
-    kraken::getDartMethod()->requestBatchUpdate(contextId);
-    update_batched = true;
+    requestBatchUpdate();
   }
 
   UICommandItem item{id, type, nativePtr};
@@ -33,32 +79,68 @@ void UICommandTaskMessageQueue::registerCommand(int32_t id, int32_t type, void *
 
 void UICommandTaskMessageQueue::registerCommand(int32_t id, int32_t type, NativeString &args_01, void *nativePtr) {
   if (!update_batched) {
-    kraken::getDartMethod()->requestBatchUpdate(contextId);
-    update_batched = true;
+    requestBatchUpdate();
   }
 
-  UICommandItem item{id, type, args_01, nativePtr};
+  NativeString args{arena.copy(args_01.string, args_01.length), args_01.length};
+  UICommandItem item{id, type, args, nativePtr};
   queue.emplace_back(item);
 }
 
 void UICommandTaskMessageQueue::registerCommand(int32_t id, int32_t type, NativeString &args_01, NativeString &args_02,
                                                 void *nativePtr) {
   if (!update_batched) {
-    kraken::getDartMethod()->requestBatchUpdate(contextId);
-    update_batched = true;
+    requestBatchUpdate();
   }
-  UICommandItem item{id, type, args_01, args_02, nativePtr};
+  NativeString args1{arena.copy(args_01.string, args_01.length), args_01.length};
+  NativeString args2{arena.copy(args_02.string, args_02.length), args_02.length};
+  UICommandItem item{id, type, args1, args2, nativePtr};
   queue.emplace_back(item);
 }
 
-UICommandTaskMessageQueue *UICommandTaskMessageQueue::instance(int32_t contextId) {
-  static std::unordered_map<int32_t, UICommandTaskMessageQueue *> instanceMap;
+void UICommandTaskMessageQueue::append(UICommandTaskMessageQueue &other) {
+  if (other.queue.empty()) return;
+  if (!update_batched) {
+    requestBatchUpdate();
+  }
 
-  if (instanceMap.count(contextId) == 0) {
-    instanceMap[contextId] = new UICommandTaskMessageQueue(contextId);
+  queue.reserve(queue.size() + other.queue.size());
+  for (auto item : other.queue) {
+    item.string_01 = reinterpret_cast<int64_t>(
+      arena.copy(reinterpret_cast<const uint16_t *>(item.string_01), item.args_01_length));
+    item.string_02 = reinterpret_cast<int64_t>(
+      arena.copy(reinterpret_cast<const uint16_t *>(item.string_02), item.args_02_length));
+    queue.emplace_back(item);
   }
+  other.clear();
+}
+
+static std::mutex instance_map_mutex_;
+static std::unordered_map<int32_t, UICommandTaskMessageQueue *> instanceMap;
 
-  return instanceMap[contextId];
+UICommandTaskMessageQueue *UICommandTaskMessageQueue::instance(int32_t contextId) {
+  std::lock_guard<std::mutex> guard(instance_map_mutex_);
+  auto it = instanceMap.find(contextId);
+  if (it != instanceMap.end()) {
+    return it->second;
+  }
+
+  auto queue = new UICommandTaskMessageQueue(contextId);
+  instanceMap[contextId] = queue;
+  return queue;
+}
+
+void UICommandTaskMessageQueue::dispose(int32_t contextId) {
+  UICommandTaskMessageQueue *queue;
+  {
+    std::lock_guard<std::mutex> guard(instance_map_mutex_);
+    auto it = instanceMap.find(contextId);
+    if (it == instanceMap.end()) return;
+    queue = it->second;
+    instanceMap.erase(it);
+  }
+  queue->clear();
+  delete queue;
 }
 
 UICommandItem *UICommandTaskMessageQueue::data() {
@@ -69,12 +151,13 @@ int64_t UICommandTaskMessageQueue::size() {
   return queue.size();
 }
 
+int64_t UICommandTaskMessageQueue::pendingBytes() {
+  return queue.size() * sizeof(UICommandItem) + arena.usedBytes();
+}
+
 void UICommandTaskMessageQueue::clear() {
-  for (auto command : queue) {
-    delete[] reinterpret_cast<const uint16_t *>(command.string_01);
-    delete[] reinterpret_cast<const uint16_t *>(command.string_02);
-  }
   queue.clear();
+  arena.reset();
   update_batched = false;
 }
 
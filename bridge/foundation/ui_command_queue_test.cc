@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "ui_command_queue.h"
+#include "gtest/gtest.h"
+#include "test/dart_methods_stub.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace foundation;
+
+namespace {
+
+NativeString toNativeString(const std::u16string &string) {
+  return NativeString{reinterpret_cast<const uint16_t *>(string.c_str()), static_cast<int32_t>(string.size())};
+}
+
+std::u16string argsOf(const UICommandItem &item) {
+  return std::u16string(reinterpret_cast<const char16_t *>(item.string_01), item.args_01_length);
+}
+
+class UICommandQueueTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    kraken::test::initContextPoolWithStubs(1);
+  }
+};
+
+} // namespace
+
+TEST(UICommandArgsArena, reusesBlocksAfterReset) {
+  UICommandArgsArena arena;
+  std::u16string string = u"kraken";
+  auto first = arena.copy(reinterpret_cast<const uint16_t *>(string.c_str()), string.size());
+  arena.copy(reinterpret_cast<const uint16_t *>(string.c_str()), string.size());
+  EXPECT_EQ(arena.usedBytes(), 2 * string.size() * sizeof(uint16_t));
+
+  arena.reset();
+  EXPECT_EQ(arena.usedBytes(), 0);
+  // The next batch starts over in the first block instead of allocating.
+  EXPECT_EQ(arena.copy(reinterpret_cast<const uint16_t *>(string.c_str()), string.size()), first);
+}
+
+TEST(UICommandArgsArena, keepsStringsLargerThanABlock) {
+  UICommandArgsArena arena;
+  std::u16string small = u"div";
+  std::u16string large(64 * 1024, u'x');
+  auto smallCopy = arena.copy(reinterpret_cast<const uint16_t *>(small.c_str()), small.size());
+  auto largeCopy = arena.copy(reinterpret_cast<const uint16_t *>(large.c_str()), large.size());
+  EXPECT_EQ(std::u16string(reinterpret_cast<const char16_t *>(smallCopy), small.size()), small);
+  EXPECT_EQ(std::u16string(reinterpret_cast<const char16_t *>(largeCopy), large.size()), large);
+  EXPECT_EQ(arena.copy(nullptr, 0), nullptr);
+}
+
+TEST_F(UICommandQueueTest, argsOutliveTheCallerUntilClear) {
+  auto queue = UICommandTaskMessageQueue::instance(0);
+  {
+    std::u16string tagName = u"div";
+    NativeString args = toNativeString(tagName);
+    queue->registerCommand(1, UICommand::createElement, args, nullptr);
+  }
+  ASSERT_EQ(queue->size(), 1);
+  EXPECT_EQ(argsOf(queue->data()[0]), u"div");
+  EXPECT_EQ(queue->pendingBytes(), sizeof(UICommandItem) + 3 * sizeof(uint16_t));
+  EXPECT_EQ(kraken::test::batchUpdateRequests(), std::vector<int32_t>{0});
+
+  const int64_t firstArgs = queue->data()[0].string_01;
+  queue->clear();
+  EXPECT_EQ(queue->size(), 0);
+  EXPECT_EQ(queue->pendingBytes(), 0);
+
+  // A cleared queue reuses its arena and asks dart for the next batch again.
+  std::u16string tagName = u"img";
+  NativeString args = toNativeString(tagName);
+  queue->registerCommand(2, UICommand::createElement, args, nullptr);
+  EXPECT_EQ(queue->data()[0].string_01, firstArgs);
+  EXPECT_EQ(argsOf(queue->data()[0]), u"img");
+  EXPECT_EQ(kraken::test::batchUpdateRequests().size(), 2);
+  queue->clear();
+}
+
+TEST_F(UICommandQueueTest, contextsHaveIsolatedQueues) {
+  int32_t contextId = allocateNewContext();
+  auto queue = UICommandTaskMessageQueue::instance(0);
+  auto otherQueue = UICommandTaskMessageQueue::instance(contextId);
+  ASSERT_NE(queue, otherQueue);
+
+  std::u16string div = u"div";
+  std::u16string span = u"span";
+  NativeString divArgs = toNativeString(div);
+  NativeString spanArgs = toNativeString(span);
+  queue->registerCommand(1, UICommand::createElement, divArgs, nullptr);
+  otherQueue->registerCommand(2, UICommand::createElement, spanArgs, nullptr);
+  EXPECT_EQ(kraken::test::batchUpdateRequests(), (std::vector<int32_t>{0, contextId}));
+
+  queue->clear();
+  ASSERT_EQ(otherQueue->size(), 1);
+  EXPECT_EQ(otherQueue->data()[0].id, 2);
+  EXPECT_EQ(argsOf(otherQueue->data()[0]), u"span");
+
+  // Disposing a context releases its queue only.
+  queue->registerCommand(3, UICommand::createElement, divArgs, nullptr);
+  disposeContext(contextId);
+  EXPECT_EQ(UICommandTaskMessageQueue::instance(0)->size(), 1);
+  EXPECT_EQ(UICommandTaskMessageQueue::instance(contextId)->size(), 0);
+  UICommandTaskMessageQueue::dispose(contextId);
+  queue->clear();
+}
+
+// Cost of one batch of 10k commands as dart sees it: commands are registered by the bindings, read through
+// getUICommandItems() and cleared. Run with --gtest_also_run_disabled_tests.
+TEST_F(UICommandQueueTest, DISABLED_flushAndClearTenThousandCommands) {
+  constexpr int commandCount = 10000;
+  constexpr int batches = 100;
+  std::u16string tagName = u"div";
+  std::u16string property = u"backgroundColor";
+  std::u16string value = u"rgba(255, 255, 255, 0.5)";
+  NativeString tagNameArgs = toNativeString(tagName);
+  NativeString propertyArgs = toNativeString(property);
+  NativeString valueArgs = toNativeString(value);
+
+  using Clock = std::chrono::steady_clock;
+  Clock::duration registerTime{0};
+  Clock::duration flushTime{0};
+  Clock::duration clearTime{0};
+  int64_t checksum = 0;
+  for (int batch = 0; batch < batches; batch++) {
+    auto start = Clock::now();
+    auto queue = UICommandTaskMessageQueue::instance(0);
+    for (int i = 0; i < commandCount; i += 4) {
+      queue->registerCommand(i, UICommand::createElement, tagNameArgs, nullptr);
+      queue->registerCommand(i, UICommand::setStyle, propertyArgs, valueArgs, nullptr);
+      queue->registerCommand(i, UICommand::insertAdjacentNode, nullptr);
+      queue->registerCommand(i, UICommand::addEvent, tagNameArgs, nullptr);
+    }
+    auto registered = Clock::now();
+
+    UICommandItem *items = getUICommandItems(0);
+    int64_t size = getUICommandItemSize(0);
+    for (int64_t i = 0; i < size; i++) {
+      checksum += items[i].type + items[i].args_01_length + items[i].args_02_length;
+    }
+    auto flushed = Clock::now();
+
+    clearUICommandItems(0);
+    auto cleared = Clock::now();
+
+    registerTime += registered - start;
+    flushTime += flushed - registered;
+    clearTime += cleared - flushed;
+  }
+
+  auto perBatch = [](Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count() / batches;
+  };
+  std::cout << commandCount << " commands per batch, register: " << perBatch(registerTime)
+            << "us, flush: " << perBatch(flushTime) << "us, clear: " << perBatch(clearTime) << "us" << std::endl;
+  RecordProperty("registerMicroseconds", static_cast<int>(perBatch(registerTime)));
+  RecordProperty("flushMicroseconds", static_cast<int>(perBatch(flushTime)));
+  RecordProperty("clearMicroseconds", static_cast<int>(perBatch(clearTime)));
+  EXPECT_GT(checksum, 0);
+  EXPECT_EQ(UICommandTaskMessageQueue::instance(0)->size(), 0);
+}
@@ -5,28 +5,88 @@
 
 #include "ui_task_queue.h"
 #include "ref_ptr.h"
+#include <cstdint>
 #include <mutex>
 
 namespace foundation {
 
-void UITaskMessageQueue::registerTask(const Task &task, void* data) {
-  std::lock_guard<std::mutex> guard(queue_mutex_);
-  auto taskData = new TaskData(task, data);
-  queue.emplace_back(taskData);
+UITaskMessageQueue *UITaskMessageQueue::instance() {
+  static fml::RefPtr<UITaskMessageQueue> queue = fml::MakeRefCounted<UITaskMessageQueue>();
+  return queue.get();
 }
 
-void UITaskMessageQueue::flushTaskFromUIThread() {
-  std::lock_guard<std::mutex> guard(queue_mutex_);
-  auto begin = std::begin(queue);
-  auto end = std::end(queue);
-  TaskData *taskData;
-  while (begin != end) {
-    taskData = *begin;
-    taskData->task(taskData->data);
-    delete taskData;
-    ++begin;
+UITaskMessageQueue::UITaskMessageQueue() {
+  for (size_t i = 0; i < kCapacity; i++) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
   }
-  queue.clear();
 }
 
+bool UITaskMessageQueue::tryEnqueue(const TaskData &taskData) {
+  size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+  Slot *slot;
+  while (true) {
+    slot = &slots_[pos & (kCapacity - 1)];
+    size_t sequence = slot->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (diff < 0) {
+      // The ring is full.
+      return false;
+    } else {
+      pos = enqueuePos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  slot->taskData = taskData;
+  slot->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+bool UITaskMessageQueue::tryDequeue(TaskData &taskData) {
+  Slot &slot = slots_[dequeuePos_ & (kCapacity - 1)];
+  size_t sequence = slot.sequence.load(std::memory_order_acquire);
+  if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(dequeuePos_ + 1) < 0) return false;
+
+  taskData = slot.taskData;
+  slot.sequence.store(dequeuePos_ + kCapacity, std::memory_order_release);
+  dequeuePos_++;
+  return true;
+}
+
+void UITaskMessageQueue::registerTask(const Task &task, void *data) {
+  TaskData taskData{task, data};
+  if (!overflowed_.load(std::memory_order_acquire) && tryEnqueue(taskData)) return;
+
+  std::lock_guard<std::mutex> guard(overflow_mutex_);
+  overflowed_.store(true, std::memory_order_release);
+  overflow_.emplace_back(taskData);
+}
+
+void UITaskMessageQueue::flushTaskFromUIThread() {
+  // Tasks claiming a slot after this point run in the next flush, a task which registers itself again can't keep the
+  // UI thread busy.
+  size_t endPos = enqueuePos_.load(std::memory_order_acquire);
+  TaskData taskData;
+  while (dequeuePos_ != endPos && tryDequeue(taskData)) {
+    taskData.task(taskData.data);
+  }
+
+  // Overflow tasks are newer than the tasks in the ring, they wait while the ring isn't drained, which happens when a
+  // producer is still writing its slot.
+  if (!overflowed_.load(std::memory_order_acquire)) return;
+  if (dequeuePos_ != enqueuePos_.load(std::memory_order_acquire)) return;
+
+  // Swap out the overflow tasks and run them without holding the lock, tasks are free to register new tasks.
+  std::vector<TaskData> batch;
+  {
+    std::lock_guard<std::mutex> guard(overflow_mutex_);
+    batch.swap(overflow_);
+    overflowed_.store(false, std::memory_order_release);
+  }
+  for (auto &item : batch) {
+    item.task(item.data);
+  }
 }
+
+} // namespace foundation
@@ -9,40 +9,56 @@
 #include "closure.h"
 #include "ref_counter.h"
 #include "ref_ptr.h"
-#include <deque>
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 namespace foundation {
 
 using Task = void(*)(void*);
 
-class UITaskMessageQueue;
-
-static std::mutex ui_task_creation_mutex_;
-static fml::RefPtr<UITaskMessageQueue> instance_;
-
+// Tasks registered from any thread and flushed by UI thread.
+// Tasks are stored inline in a bounded lock-free ring, which allows multiple producers and a single consumer.
+// When the ring is full, tasks fall back to an overflow list guarded by mutex, and keep going there until the
+// next flush drained it, so tasks registered by the same thread still run in order.
 class UITaskMessageQueue : public fml::RefCountedThreadSafe<UITaskMessageQueue> {
 public:
-  static fml::RefPtr<UITaskMessageQueue> instance() {
-    std::lock_guard<std::mutex> guard(ui_task_creation_mutex_);
-    if (!instance_) {
-      instance_ = fml::MakeRefCounted<UITaskMessageQueue>();
-    }
-    return instance_;
-  };
+  // The queue lives as long as the process, it's created once and returned without locking.
+  static UITaskMessageQueue *instance();
 
   void registerTask(const Task& task, void* data);
+  // Runs the tasks registered before the flush started. Tasks registered by the running tasks wait for the next
+  // flush, so a task which keeps registering itself can't starve the UI thread.
   void flushTaskFromUIThread();
 
 private:
+  UITaskMessageQueue();
+
+  static constexpr size_t kCapacity = 1024;
+  static_assert((kCapacity & (kCapacity - 1)) == 0, "UITaskMessageQueue capacity must be power of 2.");
+
   struct TaskData {
-    TaskData(const Task &task, void *data): task(task), data(data) {};
-    Task task;
-    void *data;
+    Task task{nullptr};
+    void *data{nullptr};
   };
 
-  mutable std::mutex queue_mutex_;
-  std::deque<TaskData*> queue;
+  struct Slot {
+    std::atomic<size_t> sequence;
+    TaskData taskData;
+  };
+
+  bool tryEnqueue(const TaskData &taskData);
+  bool tryDequeue(TaskData &taskData);
+
+  std::array<Slot, kCapacity> slots_;
+  alignas(64) std::atomic<size_t> enqueuePos_{0};
+  // Only touched by UI thread.
+  alignas(64) size_t dequeuePos_{0};
+
+  std::atomic<bool> overflowed_{false};
+  std::mutex overflow_mutex_;
+  std::vector<TaskData> overflow_;
 
   FML_FRIEND_MAKE_REF_COUNTED(UITaskMessageQueue);
   FML_FRIEND_REF_COUNTED_THREAD_SAFE(UITaskMessageQueue);
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "ui_task_queue.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace foundation;
+
+namespace {
+
+struct Record {
+  int32_t producer;
+  int32_t sequence;
+};
+
+// Only touched by the flushing thread.
+std::vector<int32_t> lastSequences;
+int64_t executed = 0;
+int64_t outOfOrder = 0;
+
+void runRecord(void *data) {
+  auto record = static_cast<Record *>(data);
+  if (record->sequence != lastSequences[record->producer] + 1) outOfOrder++;
+  lastSequences[record->producer] = record->sequence;
+  executed++;
+}
+
+void reset(int32_t producers) {
+  UITaskMessageQueue::instance()->flushTaskFromUIThread();
+  lastSequences.assign(producers, -1);
+  executed = 0;
+  outOfOrder = 0;
+}
+
+int reRegisteredCount = 0;
+bool keepRegistering = true;
+
+void registerAgain(void *data) {
+  reRegisteredCount++;
+  if (keepRegistering) UITaskMessageQueue::instance()->registerTask(registerAgain, data);
+}
+
+} // namespace
+
+TEST(UITaskMessageQueue, multipleProducersKeepTheirOrder) {
+  const int32_t producerCount = 8;
+  // Much more than the ring holds, producers run into the overflow list while the UI thread is flushing.
+  const int32_t tasksPerProducer = 20000;
+  reset(producerCount);
+
+  std::vector<std::vector<Record>> records(producerCount);
+  for (int32_t p = 0; p < producerCount; p++) {
+    for (int32_t i = 0; i < tasksPerProducer; i++) {
+      records[p].emplace_back(Record{p, i});
+    }
+  }
+
+  std::atomic<int32_t> finished{0};
+  std::vector<std::thread> producers;
+  for (int32_t p = 0; p < producerCount; p++) {
+    producers.emplace_back([&records, &finished, p]() {
+      for (auto &record : records[p]) {
+        UITaskMessageQueue::instance()->registerTask(runRecord, &record);
+      }
+      finished++;
+    });
+  }
+
+  const int64_t total = static_cast<int64_t>(producerCount) * tasksPerProducer;
+  while (finished < producerCount || executed < total) {
+    UITaskMessageQueue::instance()->flushTaskFromUIThread();
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_EQ(executed, total);
+  EXPECT_EQ(outOfOrder, 0);
+  for (auto sequence : lastSequences) {
+    EXPECT_EQ(sequence, tasksPerProducer - 1);
+  }
+}
+
+TEST(UITaskMessageQueue, overflowedTasksRunAfterTheRing) {
+  reset(1);
+  std::vector<Record> records;
+  for (int32_t i = 0; i < 3000; i++) {
+    records.emplace_back(Record{0, i});
+  }
+  for (auto &record : records) {
+    UITaskMessageQueue::instance()->registerTask(runRecord, &record);
+  }
+
+  UITaskMessageQueue::instance()->flushTaskFromUIThread();
+  EXPECT_EQ(executed, 3000);
+  EXPECT_EQ(outOfOrder, 0);
+}
+
+TEST(UITaskMessageQueue, tasksRegisteredWhileFlushingWaitForTheNextFlush) {
+  reset(0);
+  reRegisteredCount = 0;
+  keepRegistering = true;
+  UITaskMessageQueue::instance()->registerTask(registerAgain, nullptr);
+
+  UITaskMessageQueue::instance()->flushTaskFromUIThread();
+  EXPECT_EQ(reRegisteredCount, 1);
+  UITaskMessageQueue::instance()->flushTaskFromUIThread();
+  EXPECT_EQ(reRegisteredCount, 2);
+
+  keepRegistering = false;
+  UITaskMessageQueue::instance()->flushTaskFromUIThread();
+  EXPECT_EQ(reRegisteredCount, 3);
+}
@@ -0,0 +1,1085 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "url_parser.h"
+#include "idna.h"
+#include <algorithm>
+#include <array>
+
+namespace foundation {
+
+namespace {
+
+constexpr char32_t kEOF = 0xFFFFFFFF;
+
+inline bool isASCIIAlpha(char32_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline bool isASCIIDigit(char32_t c) {
+  return c >= '0' && c <= '9';
+}
+
+inline bool isASCIIHexDigit(char32_t c) {
+  return isASCIIDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+inline bool isASCIIAlphanumeric(char32_t c) {
+  return isASCIIAlpha(c) || isASCIIDigit(c);
+}
+
+inline char32_t toASCIILower(char32_t c) {
+  return (c >= 'A' && c <= 'Z') ? c + 0x20 : c;
+}
+
+inline int hexValue(char32_t c) {
+  if (isASCIIDigit(c)) return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return c - 'A' + 10;
+}
+
+void appendUTF8(char32_t codePoint, std::string &output) {
+  if (codePoint < 0x80) {
+    output.push_back(static_cast<char>(codePoint));
+  } else if (codePoint < 0x800) {
+    output.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+    output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else if (codePoint < 0x10000) {
+    output.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+    output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  } else {
+    output.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+    output.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+    output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+    output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+  }
+}
+
+std::string encodeUTF8(const std::u32string &input) {
+  std::string output;
+  output.reserve(input.size());
+  for (char32_t c : input) appendUTF8(c, output);
+  return output;
+}
+
+bool inPercentEncodeSet(char32_t c, PercentEncodeSet set) {
+  if (c < 0x20 || c > 0x7E) return true;
+
+  switch (set) {
+  case PercentEncodeSet::C0Control:
+    return false;
+  case PercentEncodeSet::Fragment:
+    return c == ' ' || c == '"' || c == '<' || c == '>' || c == '`';
+  case PercentEncodeSet::Query:
+    return c == ' ' || c == '"' || c == '#' || c == '<' || c == '>';
+  case PercentEncodeSet::SpecialQuery:
+    return c == ' ' || c == '"' || c == '#' || c == '<' || c == '>' || c == '\'';
+  case PercentEncodeSet::Path:
+    return c == ' ' || c == '"' || c == '#' || c == '<' || c == '>' || c == '?' || c == '`' || c == '{' ||
+           c == '}';
+  case PercentEncodeSet::Userinfo:
+    return inPercentEncodeSet(c, PercentEncodeSet::Path) || c == '/' || c == ':' || c == ';' || c == '=' ||
+           c == '@' || (c >= '[' && c <= '^') || c == '|';
+  case PercentEncodeSet::Component:
+    return inPercentEncodeSet(c, PercentEncodeSet::Userinfo) || (c >= '$' && c <= '&') || c == '+' || c == ',';
+  case PercentEncodeSet::FormURLEncoded:
+    return inPercentEncodeSet(c, PercentEncodeSet::Component) || c == '!' || (c >= '\'' && c <= ')') || c == '~';
+  }
+
+  return false;
+}
+
+bool isForbiddenHostCodePoint(char32_t c) {
+  return c == 0x00 || c == '\t' || c == '\n' || c == '\r' || c == ' ' || c == '#' || c == '/' || c == ':' ||
+         c == '<' || c == '>' || c == '?' || c == '@' || c == '[' || c == '\\' || c == ']' || c == '^' || c == '|';
+}
+
+bool isForbiddenDomainCodePoint(char32_t c) {
+  return isForbiddenHostCodePoint(c) || c <= 0x1F || c == '%' || c == 0x7F;
+}
+
+bool isSpecialScheme(const std::string &scheme) {
+  return scheme == "ftp" || scheme == "file" || scheme == "http" || scheme == "https" || scheme == "ws" ||
+         scheme == "wss";
+}
+
+bool isWindowsDriveLetter(const std::u32string &input, bool normalized) {
+  return input.size() == 2 && isASCIIAlpha(input[0]) && (input[1] == ':' || (!normalized && input[1] == '|'));
+}
+
+bool isWindowsDriveLetter(const std::string &input, bool normalized) {
+  return input.size() == 2 && isASCIIAlpha(input[0]) && (input[1] == ':' || (!normalized && input[1] == '|'));
+}
+
+bool startsWithWindowsDriveLetter(const std::u32string &input, size_t from) {
+  if (input.size() < from + 2) return false;
+  if (!isWindowsDriveLetter(input.substr(from, 2), false)) return false;
+  if (input.size() == from + 2) return true;
+  char32_t c = input[from + 2];
+  return c == '/' || c == '\\' || c == '?' || c == '#';
+}
+
+bool isSingleDotSegment(const std::string &segment) {
+  if (segment == ".") return true;
+  if (segment.size() != 3) return false;
+  return segment[0] == '%' && segment[1] == '2' && (segment[2] == 'e' || segment[2] == 'E');
+}
+
+bool isDoubleDotSegment(const std::string &segment) {
+  if (segment == "..") return true;
+  std::string lower = segment;
+  std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+  return lower == ".%2e" || lower == "%2e." || lower == "%2e%2e";
+}
+
+void shortenPath(URLRecord &url) {
+  if (url.scheme == "file" && url.path.size() == 1 && isWindowsDriveLetter(url.path[0], true)) return;
+  if (!url.path.empty()) url.path.pop_back();
+}
+
+// https://url.spec.whatwg.org/#concept-domain-to-ascii
+std::optional<std::string> domainToASCII(const std::u32string &domain) {
+  // ASCII domains without punycode labels are only lowercased.
+  bool hasPunycodeLabel = false;
+  for (size_t i = 0; i + 4 <= domain.size() && !hasPunycodeLabel; i++) {
+    hasPunycodeLabel = (i == 0 || domain[i - 1] == '.') && toASCIILower(domain[i]) == 'x' &&
+                       toASCIILower(domain[i + 1]) == 'n' && domain[i + 2] == '-' && domain[i + 3] == '-';
+  }
+  std::optional<std::string> result;
+  if (!hasPunycodeLabel && std::all_of(domain.begin(), domain.end(), [](char32_t c) { return c < 0x80; })) {
+    result.emplace();
+    result->reserve(domain.size());
+    for (char32_t c : domain) {
+      result->push_back(static_cast<char>(toASCIILower(c)));
+    }
+  } else {
+    result = domainToASCIIUTS46(domain);
+  }
+
+  if (!result || result->empty()) return std::nullopt;
+  return result;
+}
+
+// https://url.spec.whatwg.org/#ipv4-number-parser
+std::optional<uint64_t> parseIPv4Number(std::string input) {
+  if (input.empty()) return std::nullopt;
+
+  int radix = 10;
+  if (input.size() >= 2 && input[0] == '0' && (input[1] == 'x' || input[1] == 'X')) {
+    input = input.substr(2);
+    radix = 16;
+  } else if (input.size() >= 2 && input[0] == '0') {
+    input = input.substr(1);
+    radix = 8;
+  }
+
+  if (input.empty()) return 0;
+
+  uint64_t value = 0;
+  for (char c : input) {
+    int digit;
+    if (radix == 16 && isASCIIHexDigit(c)) {
+      digit = hexValue(c);
+    } else if (radix == 10 && isASCIIDigit(c)) {
+      digit = c - '0';
+    } else if (radix == 8 && c >= '0' && c <= '7') {
+      digit = c - '0';
+    } else {
+      return std::nullopt;
+    }
+    // Saturate, any value this large is rejected by the IPv4 parser.
+    value = std::min<uint64_t>(value * radix + digit, 0x1FFFFFFFFULL);
+  }
+
+  return value;
+}
+
+std::vector<std::string> splitOnDot(const std::string &input) {
+  std::vector<std::string> parts;
+  size_t start = 0;
+  while (true) {
+    size_t end = input.find('.', start);
+    if (end == std::string::npos) {
+      parts.emplace_back(input.substr(start));
+      break;
+    }
+    parts.emplace_back(input.substr(start, end - start));
+    start = end + 1;
+  }
+  return parts;
+}
+
+// https://url.spec.whatwg.org/#ends-in-a-number-checker
+bool endsInANumber(const std::string &input) {
+  std::vector<std::string> parts = splitOnDot(input);
+  if (parts.back().empty()) {
+    if (parts.size() == 1) return false;
+    parts.pop_back();
+  }
+
+  const std::string &last = parts.back();
+  if (!last.empty() && std::all_of(last.begin(), last.end(), [](char c) { return isASCIIDigit(c); })) return true;
+  return parseIPv4Number(last).has_value();
+}
+
+// https://url.spec.whatwg.org/#concept-ipv4-parser
+std::optional<std::string> parseIPv4(const std::string &input) {
+  std::vector<std::string> parts = splitOnDot(input);
+  if (parts.back().empty() && parts.size() > 1) parts.pop_back();
+  if (parts.size() > 4) return std::nullopt;
+
+  std::vector<uint64_t> numbers;
+  for (auto &part : parts) {
+    auto number = parseIPv4Number(part);
+    if (!number) return std::nullopt;
+    numbers.push_back(*number);
+  }
+
+  for (size_t i = 0; i + 1 < numbers.size(); i++) {
+    if (numbers[i] > 255) return std::nullopt;
+  }
+  if (numbers.back() >= (1ULL << (8 * (5 - numbers.size())))) return std::nullopt;
+
+  uint64_t ipv4 = numbers.back();
+  for (size_t i = 0; i + 1 < numbers.size(); i++) {
+    ipv4 += numbers[i] << (8 * (3 - i));
+  }
+
+  std::string output;
+  for (int i = 3; i >= 0; i--) {
+    output += std::to_string((ipv4 >> (8 * i)) & 0xFF);
+    if (i != 0) output.push_back('.');
+  }
+  return output;
+}
+
+// https://url.spec.whatwg.org/#concept-ipv6-parser
+std::optional<std::string> parseIPv6(const std::u32string &input) {
+  std::array<uint16_t, 8> address{};
+  int pieceIndex = 0;
+  int compress = -1;
+  size_t pointer = 0;
+  auto at = [&input](size_t index) { return index < input.size() ? input[index] : kEOF; };
+
+  if (at(pointer) == ':') {
+    if (at(pointer + 1) != ':') return std::nullopt;
+    pointer += 2;
+    pieceIndex++;
+    compress = pieceIndex;
+  }
+
+  while (at(pointer) != kEOF) {
+    if (pieceIndex == 8) return std::nullopt;
+
+    if (at(pointer) == ':') {
+      if (compress != -1) return std::nullopt;
+      pointer++;
+      pieceIndex++;
+      compress = pieceIndex;
+      continue;
+    }
+
+    uint32_t value = 0;
+    size_t length = 0;
+    while (length < 4 && isASCIIHexDigit(at(pointer))) {
+      value = value * 0x10 + hexValue(at(pointer));
+      pointer++;
+      length++;
+    }
+
+    if (at(pointer) == '.') {
+      if (length == 0) return std::nullopt;
+      pointer -= length;
+      if (pieceIndex > 6) return std::nullopt;
+
+      int numbersSeen = 0;
+      while (at(pointer) != kEOF) {
+        int ipv4Piece = -1;
+        if (numbersSeen > 0) {
+          if (at(pointer) == '.' && numbersSeen < 4) {
+            pointer++;
+          } else {
+            return std::nullopt;
+          }
+        }
+        if (!isASCIIDigit(at(pointer))) return std::nullopt;
+        while (isASCIIDigit(at(pointer))) {
+          int number = at(pointer) - '0';
+          if (ipv4Piece == -1) {
+            ipv4Piece = number;
+          } else if (ipv4Piece == 0) {
+            return std::nullopt;
+          } else {
+            ipv4Piece = ipv4Piece * 10 + number;
+          }
+          if (ipv4Piece > 255) return std::nullopt;
+          pointer++;
+        }
+        address[pieceIndex] = address[pieceIndex] * 0x100 + ipv4Piece;
+        numbersSeen++;
+        if (numbersSeen == 2 || numbersSeen == 4) pieceIndex++;
+      }
+      if (numbersSeen != 4) return std::nullopt;
+      break;
+    } else if (at(pointer) == ':') {
+      pointer++;
+      if (at(pointer) == kEOF) return std::nullopt;
+    } else if (at(pointer) != kEOF) {
+      return std::nullopt;
+    }
+
+    address[pieceIndex] = value;
+    pieceIndex++;
+  }
+
+  if (compress != -1) {
+    int swaps = pieceIndex - compress;
+    pieceIndex = 7;
+    while (pieceIndex != 0 && swaps > 0) {
+      std::swap(address[pieceIndex], address[compress + swaps - 1]);
+      pieceIndex--;
+      swaps--;
+    }
+  } else if (pieceIndex != 8) {
+    return std::nullopt;
+  }
+
+  // Serialize, the first longest run of at least two zero pieces is compressed.
+  int compressIndex = -1;
+  int longest = 1;
+  for (int i = 0; i < 8;) {
+    if (address[i] != 0) {
+      i++;
+      continue;
+    }
+    int end = i;
+    while (end < 8 && address[end] == 0) end++;
+    if (end - i > longest) {
+      longest = end - i;
+      compressIndex = i;
+    }
+    i = end;
+  }
+
+  static const char *hexDigits = "0123456789abcdef";
+  std::string output = "[";
+  bool ignoreZero = false;
+  for (int i = 0; i < 8; i++) {
+    if (ignoreZero && address[i] == 0) continue;
+    ignoreZero = false;
+    if (compressIndex == i) {
+      output += i == 0 ? "::" : ":";
+      ignoreZero = true;
+      continue;
+    }
+    std::string piece;
+    uint16_t value = address[i];
+    do {
+      piece.insert(piece.begin(), hexDigits[value & 0xF]);
+      value >>= 4;
+    } while (value != 0);
+    output += piece;
+    if (i != 7) output.push_back(':');
+  }
+  output.push_back(']');
+  return output;
+}
+
+// https://url.spec.whatwg.org/#concept-opaque-host-parser
+std::optional<std::string> parseOpaqueHost(const std::u32string &input) {
+  for (char32_t c : input) {
+    if (isForbiddenHostCodePoint(c)) return std::nullopt;
+  }
+  return percentEncode(input, PercentEncodeSet::C0Control);
+}
+
+} // namespace
+
+void percentEncode(char32_t codePoint, PercentEncodeSet set, std::string &output) {
+  static const char *hexDigits = "0123456789ABCDEF";
+
+  if (set == PercentEncodeSet::FormURLEncoded && codePoint == ' ') {
+    output.push_back('+');
+    return;
+  }
+
+  if (!inPercentEncodeSet(codePoint, set)) {
+    output.push_back(static_cast<char>(codePoint));
+    return;
+  }
+
+  std::string bytes;
+  appendUTF8(codePoint, bytes);
+  for (unsigned char byte : bytes) {
+    output.push_back('%');
+    output.push_back(hexDigits[byte >> 4]);
+    output.push_back(hexDigits[byte & 0xF]);
+  }
+}
+
+std::string percentEncode(const std::u32string &input, PercentEncodeSet set) {
+  std::string output;
+  output.reserve(input.size());
+  for (char32_t c : input) percentEncode(c, set, output);
+  return output;
+}
+
+std::string percentDecode(const std::string &input) {
+  std::string output;
+  output.reserve(input.size());
+  for (size_t i = 0; i < input.size(); i++) {
+    if (input[i] == '%' && i + 2 < input.size() + 0 && isASCIIHexDigit(input[i + 1]) && isASCIIHexDigit(input[i + 2])) {
+      output.push_back(static_cast<char>(hexValue(input[i + 1]) * 0x10 + hexValue(input[i + 2])));
+      i += 2;
+    } else {
+      output.push_back(input[i]);
+    }
+  }
+  return output;
+}
+
+std::u32string toCodePoints(const char16_t *input, size_t length) {
+  std::u32string output;
+  output.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    char16_t c = input[i];
+    if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length && input[i + 1] >= 0xDC00 && input[i + 1] <= 0xDFFF) {
+      output.push_back(0x10000 + ((c - 0xD800) << 10) + (input[i + 1] - 0xDC00));
+      i++;
+    } else if (c >= 0xD800 && c <= 0xDFFF) {
+      output.push_back(0xFFFD);
+    } else {
+      output.push_back(c);
+    }
+  }
+  return output;
+}
+
+std::u16string toUTF16(const std::u32string &input) {
+  std::u16string output;
+  output.reserve(input.size());
+  for (char32_t c : input) {
+    if (c >= 0x10000) {
+      c -= 0x10000;
+      output.push_back(static_cast<char16_t>(0xD800 + (c >> 10)));
+      output.push_back(static_cast<char16_t>(0xDC00 + (c & 0x3FF)));
+    } else {
+      output.push_back(static_cast<char16_t>(c));
+    }
+  }
+  return output;
+}
+
+std::u32string decodeUTF8(const std::string &input) {
+  std::u32string output;
+  output.reserve(input.size());
+
+  size_t i = 0;
+  size_t length = input.size();
+  auto byteAt = [&input](size_t index) { return static_cast<uint8_t>(input[index]); };
+
+  while (i < length) {
+    uint8_t lead = byteAt(i);
+    if (lead < 0x80) {
+      output.push_back(lead);
+      i++;
+      continue;
+    }
+
+    size_t needed;
+    char32_t codePoint;
+    uint8_t lowerBoundary = 0x80;
+    uint8_t upperBoundary = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+      needed = 1;
+      codePoint = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      needed = 2;
+      codePoint = lead & 0x0F;
+      if (lead == 0xE0) lowerBoundary = 0xA0;
+      if (lead == 0xED) upperBoundary = 0x9F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      needed = 3;
+      codePoint = lead & 0x07;
+      if (lead == 0xF0) lowerBoundary = 0x90;
+      if (lead == 0xF4) upperBoundary = 0x8F;
+    } else {
+      output.push_back(0xFFFD);
+      i++;
+      continue;
+    }
+
+    size_t seen = 0;
+    i++;
+    while (seen < needed && i < length && byteAt(i) >= lowerBoundary && byteAt(i) <= upperBoundary) {
+      codePoint = (codePoint << 6) | (byteAt(i) & 0x3F);
+      lowerBoundary = 0x80;
+      upperBoundary = 0xBF;
+      seen++;
+      i++;
+    }
+
+    // The invalid byte is not consumed, it starts the next sequence.
+    output.push_back(seen < needed ? 0xFFFD : codePoint);
+  }
+
+  return output;
+}
+
+std::u16string decodeUTF8ToUTF16(const std::string &input) {
+  return toUTF16(decodeUTF8(input));
+}
+
+bool URLRecord::isSpecial() const {
+  return isSpecialScheme(scheme);
+}
+
+bool URLRecord::includesCredentials() const {
+  return !username.empty() || !password.empty();
+}
+
+bool URLRecord::cannotHaveUsernamePasswordPort() const {
+  return !host || host->empty() || scheme == "file";
+}
+
+std::string URLRecord::serializePath() const {
+  if (hasOpaquePath) return path.empty() ? "" : path[0];
+
+  std::string output;
+  for (auto &segment : path) {
+    output.push_back('/');
+    output += segment;
+  }
+  return output;
+}
+
+std::string URLRecord::serialize(bool excludeFragment) const {
+  std::string output = scheme + ":";
+
+  if (host) {
+    output += "//";
+    if (includesCredentials()) {
+      output += username;
+      if (!password.empty()) output += ":" + password;
+      output.push_back('@');
+    }
+    output += *host;
+    if (port) output += ":" + std::to_string(*port);
+  }
+
+  if (!host && !hasOpaquePath && path.size() > 1 && path[0].empty()) output += "/.";
+  output += serializePath();
+
+  if (query) output += "?" + *query;
+  if (!excludeFragment && fragment) output += "#" + *fragment;
+
+  return output;
+}
+
+std::string URLRecord::origin() const {
+  if (scheme == "blob") {
+    std::string pathString = serializePath();
+    URLRecord pathURL;
+    if (URLParser::parse(std::u32string(pathString.begin(), pathString.end()), nullptr, pathURL) &&
+        (pathURL.scheme == "http" || pathURL.scheme == "https")) {
+      return pathURL.origin();
+    }
+    return "null";
+  }
+
+  if (scheme == "ftp" || scheme == "http" || scheme == "https" || scheme == "ws" || scheme == "wss") {
+    std::string output = scheme + "://" + host.value_or("");
+    if (port) output += ":" + std::to_string(*port);
+    return output;
+  }
+
+  return "null";
+}
+
+std::optional<uint16_t> URLParser::defaultPort(const std::string &scheme) {
+  if (scheme == "ftp") return 21;
+  if (scheme == "http" || scheme == "ws") return 80;
+  if (scheme == "https" || scheme == "wss") return 443;
+  return std::nullopt;
+}
+
+std::optional<std::string> URLParser::parseHost(const std::u32string &input, bool isOpaque) {
+  if (!input.empty() && input[0] == '[') {
+    if (input.back() != ']') return std::nullopt;
+    return parseIPv6(input.substr(1, input.size() - 2));
+  }
+
+  if (isOpaque) return parseOpaqueHost(input);
+
+  std::u32string domain = decodeUTF8(percentDecode(encodeUTF8(input)));
+  auto asciiDomain = domainToASCII(domain);
+  if (!asciiDomain) return std::nullopt;
+
+  for (char c : *asciiDomain) {
+    if (isForbiddenDomainCodePoint(static_cast<unsigned char>(c))) return std::nullopt;
+  }
+
+  if (endsInANumber(*asciiDomain)) return parseIPv4(*asciiDomain);
+
+  return asciiDomain;
+}
+
+bool URLParser::parse(const std::u32string &rawInput, const URLRecord *base, URLRecord &url,
+                      URLParserState stateOverride) {
+  bool hasOverride = stateOverride != URLParserState::NoOverride;
+  std::u32string input;
+  input.reserve(rawInput.size());
+
+  size_t begin = 0;
+  size_t end = rawInput.size();
+  if (!hasOverride) {
+    while (begin < end && rawInput[begin] <= 0x20) begin++;
+    while (end > begin && rawInput[end - 1] <= 0x20) end--;
+  }
+  for (size_t i = begin; i < end; i++) {
+    char32_t c = rawInput[i];
+    if (c != '\t' && c != '\n' && c != '\r') input.push_back(c);
+  }
+
+  URLParserState state = hasOverride ? stateOverride : URLParserState::SchemeStart;
+  std::u32string buffer;
+  std::string pathBuffer;
+  bool atSignSeen = false;
+  bool insideBrackets = false;
+  bool passwordTokenSeen = false;
+
+  auto length = static_cast<ptrdiff_t>(input.size());
+  auto at = [&input, length](ptrdiff_t index) {
+    return index >= 0 && index < length ? input[index] : kEOF;
+  };
+  auto remainingStartsWith = [&at](ptrdiff_t pointer, char32_t c) { return at(pointer + 1) == c; };
+
+  for (ptrdiff_t pointer = 0;; pointer++) {
+    char32_t c = at(pointer);
+
+    switch (state) {
+    case URLParserState::SchemeStart:
+      if (isASCIIAlpha(c)) {
+        buffer.push_back(toASCIILower(c));
+        state = URLParserState::Scheme;
+      } else if (!hasOverride) {
+        state = URLParserState::NoScheme;
+        pointer--;
+      } else {
+        return false;
+      }
+      break;
+
+    case URLParserState::Scheme:
+      if (isASCIIAlphanumeric(c) || c == '+' || c == '-' || c == '.') {
+        buffer.push_back(toASCIILower(c));
+      } else if (c == ':') {
+        std::string scheme(buffer.begin(), buffer.end());
+        if (hasOverride) {
+          if (url.isSpecial() != isSpecialScheme(scheme)) return true;
+          if ((url.includesCredentials() || url.port) && scheme == "file") return true;
+          if (url.scheme == "file" && url.host && url.host->empty()) return true;
+        }
+        url.scheme = scheme;
+        if (hasOverride) {
+          if (url.port && url.port == defaultPort(url.scheme)) url.port = std::nullopt;
+          return true;
+        }
+        buffer.clear();
+        if (url.scheme == "file") {
+          state = URLParserState::File;
+        } else if (url.isSpecial() && base != nullptr && base->scheme == url.scheme) {
+          state = URLParserState::SpecialRelativeOrAuthority;
+        } else if (url.isSpecial()) {
+          state = URLParserState::SpecialAuthoritySlashes;
+        } else if (remainingStartsWith(pointer, '/')) {
+          state = URLParserState::PathOrAuthority;
+          pointer++;
+        } else {
+          url.path = {""};
+          url.hasOpaquePath = true;
+          state = URLParserState::OpaquePath;
+        }
+      } else if (!hasOverride) {
+        buffer.clear();
+        state = URLParserState::NoScheme;
+        pointer = -1;
+      } else {
+        return false;
+      }
+      break;
+
+    case URLParserState::NoScheme:
+      if (base == nullptr || (base->hasOpaquePath && c != '#')) {
+        return false;
+      } else if (base->hasOpaquePath && c == '#') {
+        url.scheme = base->scheme;
+        url.path = base->path;
+        url.hasOpaquePath = true;
+        url.query = base->query;
+        url.fragment = "";
+        state = URLParserState::Fragment;
+      } else if (base->scheme != "file") {
+        state = URLParserState::Relative;
+        pointer--;
+      } else {
+        state = URLParserState::File;
+        pointer--;
+      }
+      break;
+
+    case URLParserState::SpecialRelativeOrAuthority:
+      if (c == '/' && remainingStartsWith(pointer, '/')) {
+        state = URLParserState::SpecialAuthorityIgnoreSlashes;
+        pointer++;
+      } else {
+        state = URLParserState::Relative;
+        pointer--;
+      }
+      break;
+
+    case URLParserState::PathOrAuthority:
+      if (c == '/') {
+        state = URLParserState::Authority;
+      } else {
+        state = URLParserState::Path;
+        pointer--;
+      }
+      break;
+
+    case URLParserState::Relative:
+      url.scheme = base->scheme;
+      if (c == '/') {
+        state = URLParserState::RelativeSlash;
+      } else if (url.isSpecial() && c == '\\') {
+        state = URLParserState::RelativeSlash;
+      } else {
+        url.username = base->username;
+        url.password = base->password;
+        url.host = base->host;
+        url.port = base->port;
+        url.path = base->path;
+        url.query = base->query;
+        if (c == '?') {
+          url.query = "";
+          state = URLParserState::Query;
+        } else if (c == '#') {
+          url.fragment = "";
+          state = URLParserState::Fragment;
+        } else if (c != kEOF) {
+          url.query = std::nullopt;
+          shortenPath(url);
+          state = URLParserState::Path;
+          pointer--;
+        }
+      }
+      break;
+
+    case URLParserState::RelativeSlash:
+      if (url.isSpecial() && (c == '/' || c == '\\')) {
+        state = URLParserState::SpecialAuthorityIgnoreSlashes;
+      } else if (c == '/') {
+        state = URLParserState::Authority;
+      } else {
+        url.username = base->username;
+        url.password = base->password;
+        url.host = base->host;
+        url.port = base->port;
+        state = URLParserState::Path;
+        pointer--;
+      }
+      break;
+
+    case URLParserState::SpecialAuthoritySlashes:
+      if (c == '/' && remainingStartsWith(pointer, '/')) {
+        pointer++;
+      } else {
+        pointer--;
+      }
+      state = URLParserState::SpecialAuthorityIgnoreSlashes;
+      break;
+
+    case URLParserState::SpecialAuthorityIgnoreSlashes:
+      if (c != '/' && c != '\\') {
+        state = URLParserState::Authority;
+        pointer--;
+      }
+      break;
+
+    case URLParserState::Authority:
+      if (c == '@') {
+        if (atSignSeen) buffer.insert(0, U"%40");
+        atSignSeen = true;
+        for (char32_t codePoint : buffer) {
+          if (codePoint == ':' && !passwordTokenSeen) {
+            passwordTokenSeen = true;
+            continue;
+          }
+          percentEncode(codePoint, PercentEncodeSet::Userinfo, passwordTokenSeen ? url.password : url.username);
+        }
+        buffer.clear();
+      } else if (c == kEOF || c == '/' || c == '?' || c == '#' || (url.isSpecial() && c == '\\')) {
+        if (atSignSeen && buffer.empty()) return false;
+        pointer -= static_cast<ptrdiff_t>(buffer.size()) + 1;
+        buffer.clear();
+        state = URLParserState::Host;
+      } else {
+        buffer.push_back(c);
+      }
+      break;
+
+    case URLParserState::Host:
+    case URLParserState::Hostname:
+      if (hasOverride && url.scheme == "file") {
+        pointer--;
+        state = URLParserState::FileHost;
+      } else if (c == ':' && !insideBrackets) {
+        if (buffer.empty()) return false;
+        if (stateOverride == URLParserState::Hostname) return false;
+        auto host = parseHost(buffer, !url.isSpecial());
+        if (!host) return false;
+        url.host = host;
+        buffer.clear();
+        state = URLParserState::Port;
+      } else if (c == kEOF || c == '/' || c == '?' || c == '#' || (url.isSpecial() && c == '\\')) {
+        pointer--;
+        if (url.isSpecial() && buffer.empty()) return false;
+        if (hasOverride && buffer.empty() && (url.includesCredentials() || url.port)) return false;
+        auto host = parseHost(buffer, !url.isSpecial());
+        if (!host) return false;
+        url.host = host;
+        buffer.clear();
+        state = URLParserState::PathStart;
+        if (hasOverride) return true;
+      } else {
+        if (c == '[') insideBrackets = true;
+        if (c == ']') insideBrackets = false;
+        buffer.push_back(c);
+      }
+      break;
+
+    case URLParserState::Port:
+      if (isASCIIDigit(c)) {
+        buffer.push_back(c);
+      } else if (c == kEOF || c == '/' || c == '?' || c == '#' || (url.isSpecial() && c == '\\') || hasOverride) {
+        if (!buffer.empty()) {
+          uint32_t port = 0;
+          for (char32_t digit : buffer) {
+            port = port * 10 + (digit - '0');
+            if (port > 65535) return false;
+          }
+          if (defaultPort(url.scheme) == port) {
+            url.port = std::nullopt;
+          } else {
+            url.port = static_cast<uint16_t>(port);
+          }
+          buffer.clear();
+        }
+        if (hasOverride) return true;
+        state = URLParserState::PathStart;
+        pointer--;
+      } else {
+        return false;
+      }
+      break;
+
+    case URLParserState::File:
+      url.scheme = "file";
+      url.host = "";
+      if (c == '/' || c == '\\') {
+        state = URLParserState::FileSlash;
+      } else if (base != nullptr && base->scheme == "file") {
+        url.host = base->host;
+        url.path = base->path;
+        url.query = base->query;
+        if (c == '?') {
+          url.query = "";
+          state = URLParserState::Query;
+        } else if (c == '#') {
+          url.fragment = "";
+          state = URLParserState::Fragment;
+        } else if (c != kEOF) {
+          url.query = std::nullopt;
+          if (!startsWithWindowsDriveLetter(input, pointer)) {
+            shortenPath(url);
+          } else {
+            url.path.clear();
+          }
+          state = URLParserState::Path;
+          pointer--;
+        }
+      } else {
+        state = URLParserState::Path;
+        pointer--;
+      }
+      break;
+
+    case URLParserState::FileSlash:
+      if (c == '/' || c == '\\') {
+        state = URLParserState::FileHost;
+      } else {
+        if (base != nullptr && base->scheme == "file") {
+          url.host = base->host;
+          if (!startsWithWindowsDriveLetter(input, pointer) && !base->path.empty() &&
+              isWindowsDriveLetter(base->path[0], true)) {
+            url.path.push_back(base->path[0]);
+          }
+        }
+        state = URLParserState::Path;
+        pointer--;
+      }
+      break;
+
+    case URLParserState::FileHost:
+      if (c == kEOF || c == '/' || c == '\\' || c == '?' || c == '#') {
+        pointer--;
+        if (!hasOverride && isWindowsDriveLetter(buffer, false)) {
+          // The buffer is reused as the first path segment.
+          pathBuffer.assign(buffer.begin(), buffer.end());
+          buffer.clear();
+          state = URLParserState::Path;
+        } else if (buffer.empty()) {
+          url.host = "";
+          if (hasOverride) return true;
+          state = URLParserState::PathStart;
+        } else {
+          auto host = parseHost(buffer, !url.isSpecial());
+          if (!host) return false;
+          if (*host == "localhost") host = "";
+          url.host = host;
+          if (hasOverride) return true;
+          buffer.clear();
+          state = URLParserState::PathStart;
+        }
+      } else {
+        buffer.push_back(c);
+      }
+      break;
+
+    case URLParserState::PathStart:
+      if (url.isSpecial()) {
+        state = URLParserState::Path;
+        if (c != '/' && c != '\\') pointer--;
+      } else if (!hasOverride && c == '?') {
+        url.query = "";
+        state = URLParserState::Query;
+      } else if (!hasOverride && c == '#') {
+        url.fragment = "";
+        state = URLParserState::Fragment;
+      } else if (c != kEOF) {
+        state = URLParserState::Path;
+        if (c != '/') pointer--;
+      } else if (hasOverride && !url.host) {
+        url.path.emplace_back("");
+      }
+      break;
+
+    case URLParserState::Path:
+      if (c == kEOF || c == '/' || (url.isSpecial() && c == '\\') || (!hasOverride && (c == '?' || c == '#'))) {
+        bool isSlash = c == '/' || (url.isSpecial() && c == '\\');
+        if (isDoubleDotSegment(pathBuffer)) {
+          shortenPath(url);
+          if (!isSlash) url.path.emplace_back("");
+        } else if (isSingleDotSegment(pathBuffer) && !isSlash) {
+          url.path.emplace_back("");
+        } else if (!isSingleDotSegment(pathBuffer)) {
+          if (url.scheme == "file" && url.path.empty() && isWindowsDriveLetter(pathBuffer, false)) {
+            pathBuffer[1] = ':';
+          }
+          url.path.emplace_back(pathBuffer);
+        }
+        pathBuffer.clear();
+        if (c == '?') {
+          url.query = "";
+          state = URLParserState::Query;
+        } else if (c == '#') {
+          url.fragment = "";
+          state = URLParserState::Fragment;
+        }
+      } else {
+        percentEncode(c, PercentEncodeSet::Path, pathBuffer);
+      }
+      break;
+
+    case URLParserState::OpaquePath:
+      if (c == '?') {
+        url.query = "";
+        state = URLParserState::Query;
+      } else if (c == '#') {
+        url.fragment = "";
+        state = URLParserState::Fragment;
+      } else if (c != kEOF) {
+        percentEncode(c, PercentEncodeSet::C0Control, url.path[0]);
+      }
+      break;
+
+    case URLParserState::Query:
+      if ((!hasOverride && c == '#') || c == kEOF) {
+        if (c == '#') {
+          url.fragment = "";
+          state = URLParserState::Fragment;
+        }
+      } else {
+        if (!url.query) url.query = "";
+        percentEncode(c, url.isSpecial() ? PercentEncodeSet::SpecialQuery : PercentEncodeSet::Query, *url.query);
+      }
+      break;
+
+    case URLParserState::Fragment:
+      if (c != kEOF) {
+        if (!url.fragment) url.fragment = "";
+        percentEncode(c, PercentEncodeSet::Fragment, *url.fragment);
+      }
+      break;
+
+    case URLParserState::NoOverride:
+      return false;
+    }
+
+    if (pointer >= length) break;
+  }
+
+  return true;
+}
+
+FormURLEncodedList parseFormURLEncoded(const std::string &input) {
+  FormURLEncodedList list;
+  size_t start = 0;
+  while (start <= input.size()) {
+    size_t end = input.find('&', start);
+    if (end == std::string::npos) end = input.size();
+
+    std::string sequence = input.substr(start, end - start);
+    if (!sequence.empty()) {
+      std::string name = sequence;
+      std::string value;
+      size_t equals = sequence.find('=');
+      if (equals != std::string::npos) {
+        name = sequence.substr(0, equals);
+        value = sequence.substr(equals + 1);
+      }
+      std::replace(name.begin(), name.end(), '+', ' ');
+      std::replace(value.begin(), value.end(), '+', ' ');
+      list.emplace_back(decodeUTF8ToUTF16(percentDecode(name)), decodeUTF8ToUTF16(percentDecode(value)));
+    }
+
+    start = end + 1;
+  }
+  return list;
+}
+
+std::string serializeFormURLEncoded(const FormURLEncodedList &list) {
+  std::string output;
+  for (auto &pair : list) {
+    if (!output.empty()) output.push_back('&');
+    output += percentEncode(toCodePoints(pair.first.c_str(), pair.first.size()), PercentEncodeSet::FormURLEncoded);
+    output.push_back('=');
+    output += percentEncode(toCodePoints(pair.second.c_str(), pair.second.size()), PercentEncodeSet::FormURLEncoded);
+  }
+  return output;
+}
+
+} // namespace foundation
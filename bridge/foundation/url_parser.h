@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_URL_PARSER_H
+#define KRAKENBRIDGE_URL_PARSER_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace foundation {
+
+// A parsed URL as defined by https://url.spec.whatwg.org/#concept-url, every component is kept serialized
+// (percent-encoded ASCII) so reading them doesn't need to encode again.
+struct URLRecord {
+  std::string scheme;
+  std::string username;
+  std::string password;
+  std::optional<std::string> host;
+  std::optional<uint16_t> port;
+  // URL with opaque path, e.g. `mailto:` and `data:`, keeps the whole path in the first segment.
+  std::vector<std::string> path;
+  bool hasOpaquePath{false};
+  std::optional<std::string> query;
+  std::optional<std::string> fragment;
+
+  bool isSpecial() const;
+  bool includesCredentials() const;
+  bool cannotHaveUsernamePasswordPort() const;
+
+  std::string serialize(bool excludeFragment = false) const;
+  std::string serializePath() const;
+  std::string origin() const;
+};
+
+enum class URLParserState {
+  NoOverride,
+  SchemeStart,
+  Scheme,
+  NoScheme,
+  SpecialRelativeOrAuthority,
+  PathOrAuthority,
+  Relative,
+  RelativeSlash,
+  SpecialAuthoritySlashes,
+  SpecialAuthorityIgnoreSlashes,
+  Authority,
+  Host,
+  Hostname,
+  Port,
+  File,
+  FileSlash,
+  FileHost,
+  PathStart,
+  Path,
+  OpaquePath,
+  Query,
+  Fragment
+};
+
+class URLParser {
+public:
+  // The basic URL parser, https://url.spec.whatwg.org/#concept-basic-url-parser. Input are unicode code points.
+  // With a state override, url is modified in place and parsing stops at the end of the overridden component,
+  // the return value is false when the input is rejected, url may be partially modified in that case only for
+  // components which the spec also modifies.
+  static bool parse(const std::u32string &input, const URLRecord *base, URLRecord &url,
+                    URLParserState stateOverride = URLParserState::NoOverride);
+
+  // Host parser, returns the serialized host or nullopt on failure.
+  static std::optional<std::string> parseHost(const std::u32string &input, bool isOpaque);
+
+  static std::optional<uint16_t> defaultPort(const std::string &scheme);
+};
+
+enum class PercentEncodeSet { C0Control, Fragment, Query, SpecialQuery, Path, Userinfo, Component, FormURLEncoded };
+
+void percentEncode(char32_t codePoint, PercentEncodeSet set, std::string &output);
+std::string percentEncode(const std::u32string &input, PercentEncodeSet set);
+// Percent decode bytes, invalid escapes are kept as is.
+std::string percentDecode(const std::string &input);
+
+// Convert between UTF-16 code units and code points, lone surrogates are replaced with U+FFFD.
+std::u32string toCodePoints(const char16_t *input, size_t length);
+std::u16string toUTF16(const std::u32string &input);
+// Decode UTF-8 bytes into code points, invalid sequences are replaced with U+FFFD.
+std::u32string decodeUTF8(const std::string &input);
+std::u16string decodeUTF8ToUTF16(const std::string &input);
+
+using FormURLEncodedList = std::vector<std::pair<std::u16string, std::u16string>>;
+
+// https://url.spec.whatwg.org/#application/x-www-form-urlencoded
+FormURLEncodedList parseFormURLEncoded(const std::string &input);
+std::string serializeFormURLEncoded(const FormURLEncodedList &list);
+
+} // namespace foundation
+
+#endif // KRAKENBRIDGE_URL_PARSER_H
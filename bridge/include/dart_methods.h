@@ -20,10 +20,13 @@ struct Screen;
 
 using AsyncCallback = void (*)(void *callbackContext, int32_t contextId, const char *errmsg);
 using AsyncRAFCallback = void (*)(void *callbackContext, int32_t contextId, double result, const char *errmsg);
-using AsyncModuleCallback = void (*)(void *callbackContext, int32_t contextId, NativeString *errmsg, NativeString *json);
+// bytes is the binary payload of module response which is not encoded into json, length is -1 when there is no one.
+// The bridge takes the ownership of bytes, which must be allocated with malloc.
+using AsyncModuleCallback = void (*)(void *callbackContext, int32_t contextId, NativeString *errmsg, NativeString *json,
+                                     uint8_t *bytes, int32_t length);
 using AsyncBlobCallback = void (*)(void *callbackContext, int32_t contextId, const char *error, uint8_t *bytes,
                                    int32_t length);
-typedef NativeString *(*InvokeModule)(void *callbackContext, int32_t contextId, NativeString *moduleName, NativeString *method, NativeString *params, AsyncModuleCallback callback);
+typedef NativeString *(*InvokeModule)(void *callbackContext, int32_t contextId, NativeString *moduleName, NativeString *method, NativeString *params, uint8_t *bytes, int32_t length, AsyncModuleCallback callback);
 typedef void (*RequestBatchUpdate)(int32_t contextId);
 typedef void (*ReloadApp)(int32_t contextId);
 typedef int32_t (*SetTimeout)(void *callbackContext, int32_t contextId, AsyncCallback callback, int32_t timeout);
@@ -19,6 +19,8 @@
 #define KRAKEN_EXPORT_C extern "C" __attribute__((visibility("default"))) __attribute__((used))
 #define KRAKEN_EXPORT __attribute__((__visibility__("default")))
 
+// The bridge is released by disposeContext() and reloadJsContext() of any thread, the pointer is only safe to use by
+// the thread which owns contextId and never disposes it meanwhile.
 KRAKEN_EXPORT_C
 void *getJSContext(int32_t contextId);
 std::__thread_id getUIThreadId();
@@ -86,6 +88,8 @@ KRAKEN_EXPORT_C
 void disposeContext(int32_t contextId);
 KRAKEN_EXPORT_C
 int32_t allocateNewContext();
+KRAKEN_EXPORT_C
+void setContextPoolPrewarmSize(int32_t size);
 
 KRAKEN_EXPORT_C
 KrakenInfo *getKrakenInfo();
@@ -117,7 +121,40 @@ Screen *createScreen(double width, double height);
 KRAKEN_EXPORT_C
 void registerDartMethods(uint64_t *methodBytes, int32_t length);
 
+// Discard native and console logs below level, which is one of VERBOSE(0), INFO(1), WARN(2), DEBUG(3) and ERROR(4).
+KRAKEN_EXPORT_C
+void setLogLevel(int32_t level);
+
+// Trace spans of bridge internals, the spans are written to path as Chrome trace event JSON.
+KRAKEN_EXPORT_C
+void setTracingEnabled(int8_t enabled);
+KRAKEN_EXPORT_C
+void clearTrace();
+KRAKEN_EXPORT_C
+int8_t dumpTrace(const char *path);
+
+// Memory held by a context, sizes are in bytes. The JS heap is -1 on Apple platforms, where the JavaScriptCore linked
+// is the system one and its heap can't be read.
+struct ContextMemoryStats {
+  int64_t jsHeapSize;
+  int64_t jsHeapCapacity;
+  int64_t eventTargetCount;
+  int64_t nodeCount;
+  int64_t pendingUICommandBytes;
+  int64_t blobBytes;
+  int64_t bridgeCallbackCount;
+};
+
+// Returns 0 and leaves stats untouched when contextId is not a live context.
+KRAKEN_EXPORT_C
+int8_t getContextMemoryStats(int32_t contextId, ContextMemoryStats *stats);
+
 KRAKEN_EXPORT_C
 void registerPluginSource(NativeString* code, const char *pluginName);
 
+// Register a plugin precompiled by `js_to_c.js --plugin`, the bytes are copied. Only the QuickJS engine reads
+// bytecode, other engines log an error and ignore it.
+KRAKEN_EXPORT_C
+void registerPluginByteCode(const uint8_t *bytes, int32_t length, const char *pluginName);
+
 #endif // KRAKEN_BRIDGE_EXPORT_H
@@ -29,7 +29,7 @@
 #define assert_m(exp, msg) assert(((void)msg, exp))
 
 #define OBJECT_INSTANCE(NAME)                                                                                          \
-  static NAME *instance(JSContext *context) {                                                                          \
+  static NAME *instance(ScriptContext *context) {                                                                      \
     if (instanceMap.count(context) == 0) {                                                                             \
       instanceMap[context] = new NAME(context);                                                                        \
     }                                                                                                                  \
@@ -52,15 +52,6 @@
     context->handleException(exc);                                                                                     \
   }
 
-#define JSC_GLOBAL_BINDING_HOST_OBJECT(context, nameStr, hostObject)                                                   \
-  {                                                                                                                    \
-    JSObjectRef object = hostObject->jsObject;                                                                         \
-    JSValueProtect(context->context(), object);                                                                        \
-    JSStringRef name = JSStringCreateWithUTF8CString(nameStr);                                                         \
-    JSObjectSetProperty(context->context(), context->global(), name, object, kJSPropertyAttributeReadOnly, nullptr);   \
-    JSStringRelease(name);                                                                                             \
-  }
-
 #define JSC_SET_STRING_PROPERTY(context, object, name, valueRef)                                                       \
   {                                                                                                                    \
     JSStringRef keyRef = JSStringCreateWithUTF8CString(name);                                                          \
@@ -94,44 +85,6 @@
     JSStringRelease(stackStr);                                                                                         \
   }
 
-#define JSC_CREATE_HOST_OBJECT_DEFINITION(definition, name, classObject)                                               \
-  {                                                                                                                    \
-    definition.version = 0;                                                                                            \
-    definition.className = name;                                                                                       \
-    definition.attributes = kJSClassAttributeNoAutomaticPrototype;                                                     \
-    definition.finalize = classObject::proxyFinalize;                                                                  \
-    definition.getProperty = classObject::proxyGetProperty;                                                            \
-    definition.setProperty = classObject::proxySetProperty;                                                            \
-    definition.getPropertyNames = classObject::proxyGetPropertyNames;                                                  \
-  }
-
-#define JSC_CREATE_HOST_CLASS_INSTANCE_DEFINITION(definition, name, classObject, staticFunction)                       \
-  {                                                                                                                    \
-    definition.version = 0;                                                                                            \
-    definition.className = name;                                                                                       \
-    definition.attributes = kJSClassAttributeNoAutomaticPrototype;                                                     \
-    definition.finalize = classObject::proxyInstanceFinalize;                                                          \
-    definition.staticFunctions = staticFunction;                                                                       \
-    definition.getProperty = classObject::proxyInstanceGetProperty;                                                    \
-    definition.setProperty = classObject::proxyInstanceSetProperty;                                                    \
-    definition.getPropertyNames = classObject::proxyInstanceGetPropertyNames;                                          \
-  }
-
-#define JSC_CREATE_HOST_CLASS_DEFINITION(definition, parent, name, staticFunction, staticValue, HostClass)             \
-  {                                                                                                                    \
-    definition.version = 0;                                                                                            \
-    definition.parentClass = parent;                                                                                   \
-    definition.className = name;                                                                                       \
-    definition.attributes = kJSClassAttributeNoAutomaticPrototype;                                                     \
-    definition.staticFunctions = staticFunction;                                                                       \
-    definition.staticValues = staticValue;                                                                             \
-    definition.finalize = HostClass::proxyFinalize;                                                                    \
-    definition.hasInstance = HostClass::proxyHasInstance;                                                              \
-    definition.callAsConstructor = HostClass::proxyCallAsConstructor;                                                  \
-    definition.callAsFunction = HostClass::proxyCallAsFunction;                                                        \
-    definition.getProperty = HostClass::proxyGetProperty;                                                              \
-  }
-
 #define OBJECT_PROPERTY(name, ...)                                                                                     \
   name {                                                                                                               \
     __VA_ARGS__                                                                                                        \
@@ -929,7 +882,7 @@
     return prototypePropertyMap;                                                                                       \
   };
 
-#define OBJECT_PROPERTY_NAME(KEY) JSStringCreateWithUTF8CString(#KEY)
+#define OBJECT_PROPERTY_NAME(KEY) #KEY
 
 #define OBJECT_PROPERTY_NAME_1(_1) OBJECT_PROPERTY_NAME(_1),
 #define OBJECT_PROPERTY_NAME_2(_1, _2) OBJECT_PROPERTY_NAME(_1), OBJECT_PROPERTY_NAME(_2),
@@ -1363,14 +1316,14 @@
     OBJECT_PROPERTY_NAME(_49), OBJECT_PROPERTY_NAME(_50),
 
 #define OBJECT_PROPERTY_NAME_FUNCTION(NAME, ARGS_COUNT, ...)                                                           \
-  static std::vector<JSStringRef> &get##NAME##PropertyNames() {                                                        \
-    static std::vector<JSStringRef> propertyNames{OBJECT_PROPERTY_NAME_##ARGS_COUNT(__VA_ARGS__)};                     \
+  static std::vector<std::string> &get##NAME##PropertyNames() {                                                       \
+    static std::vector<std::string> propertyNames{OBJECT_PROPERTY_NAME_##ARGS_COUNT(__VA_ARGS__)};                    \
     return propertyNames;                                                                                              \
   }
 
 #define OBJECT_PROTOTYPE_PROPERTY_NAME_FUNCTION(NAME, ARGS_COUNT, ...)                                                 \
-  static std::vector<JSStringRef> &get##NAME##PrototypePropertyNames() {                                               \
-    static std::vector<JSStringRef> propertyNames{OBJECT_PROPERTY_NAME_##ARGS_COUNT(__VA_ARGS__)};                     \
+  static std::vector<std::string> &get##NAME##PrototypePropertyNames() {                                              \
+    static std::vector<std::string> propertyNames{OBJECT_PROPERTY_NAME_##ARGS_COUNT(__VA_ARGS__)};                    \
     return propertyNames;                                                                                              \
   }
 
@@ -22,4 +22,10 @@ void executeTest(int32_t contextId, ExecuteCallback executeCallback);
 KRAKEN_EXPORT_C
 void registerTestEnvDartMethods(uint64_t *methodBytes, int32_t length);
 
+// Host objects, protected values and bridge callbacks of the context which are still alive, each one is logged with
+// the stack it was created on. Call it after disposeContext(), anything counted then is leaked. Returns -1 when the
+// bridge is built without instance tracking.
+KRAKEN_EXPORT_C
+int32_t countContextSurvivors(int32_t contextId);
+
 #endif
@@ -36,11 +36,43 @@ private:
   std::vector<CallbackItem> queue;
 };
 
+// A bump allocator for the string payloads of ui command items. Strings of the same batch are freed together when
+// the batch is cleared, and the memory blocks are kept to be reused by the next batch.
+class UICommandArgsArena {
+public:
+  UICommandArgsArena() = default;
+  ~UICommandArgsArena();
+
+  const uint16_t *copy(const uint16_t *string, size_t length);
+  void reset();
+  // Bytes of the strings copied since the last reset.
+  size_t usedBytes() const {
+    return used;
+  }
+
+private:
+  struct Block {
+    uint16_t *data;
+    size_t capacity;
+  };
+
+  std::vector<Block> blocks;
+  size_t blockIndex{0};
+  size_t offset{0};
+  size_t used{0};
+  FML_DISALLOW_COPY_ASSIGN_AND_MOVE(UICommandArgsArena);
+};
+
 class UICommandTaskMessageQueue {
 public:
   UICommandTaskMessageQueue() = delete;
   explicit UICommandTaskMessageQueue(int32_t contextId);
+  // A standby queue collects the commands of a pre-warmed context. It's not registered in the instance map and never
+  // requests batch updates, dart doesn't know the context until it's activated.
+  UICommandTaskMessageQueue(int32_t contextId, bool standby);
   static KRAKEN_EXPORT UICommandTaskMessageQueue *instance(int32_t contextId);
+  // Release the queue of a disposed context, a tagged context id is not reused until its slot generation wraps.
+  static KRAKEN_EXPORT void dispose(int32_t contextId);
 
   KRAKEN_EXPORT void registerCommand(int32_t id, int32_t type, void *nativePtr, bool batchedUpdate);
   KRAKEN_EXPORT void registerCommand(int32_t id, int32_t type, void *nativePtr);
@@ -48,12 +80,21 @@ public:
   KRAKEN_EXPORT void registerCommand(int32_t id, int32_t type, NativeString &args_01, void *nativePtr);
   KRAKEN_EXPORT UICommandItem *data();
   KRAKEN_EXPORT int64_t size();
+  // Bytes of the commands and their string arguments waiting to be flushed.
+  KRAKEN_EXPORT int64_t pendingBytes();
   KRAKEN_EXPORT void clear();
+  // Move the commands of another queue behind the ones of this queue, their strings are copied into this arena and
+  // the other queue is left empty.
+  void append(UICommandTaskMessageQueue &other);
 
 private:
+  void requestBatchUpdate();
+
   int32_t contextId;
+  bool standby{false};
   std::atomic<bool> update_batched{false};
   std::vector<UICommandItem> queue;
+  UICommandArgsArena arena;
 };
 
 } // namespace foundation
@@ -6,6 +6,7 @@
 #include "kraken_bridge.h"
 #include "dart_methods.h"
 #include "foundation/logging.h"
+#include "foundation/trace_event.h"
 #include "foundation/ui_command_queue.h"
 #include "foundation/ui_task_queue.h"
 #include "foundation/ui_command_callback_queue.h"
@@ -14,10 +15,16 @@
 #include "bridge_jsa.h"
 #elif KRAKEN_JSC_ENGINE
 #include "bridge_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_qjs.h"
 #endif
 
 #include <atomic>
+#include <deque>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #if defined(_WIN32)
 #define SYSTEM_NAME "windows" // Windows
@@ -42,13 +49,41 @@
 #define SYSTEM_NAME "unknown"
 #endif
 
-// this is not thread safe
+// Context ids handed out to dart are tagged with the generation of their slot: the lower CONTEXT_SLOT_BITS bits
+// are the slot index in contextPool and the upper bits are the generation, which increases every time the slot is
+// disposed. A stale id of a disposed context can never resolve to the bridge which reuses its slot.
+constexpr int32_t CONTEXT_SLOT_BITS = 16;
+constexpr int32_t CONTEXT_SLOT_MASK = (1 << CONTEXT_SLOT_BITS) - 1;
+constexpr int32_t CONTEXT_GENERATION_MASK = 0x7fff;
+constexpr int32_t MAX_CONTEXT_POOL_SIZE = CONTEXT_SLOT_MASK + 1;
+
+struct ContextSlot {
+  kraken::JSBridge *bridge{nullptr};
+  // The slot was taken by a bridge which is still under construction or kept as a spare bridge.
+  bool reserved{false};
+  int32_t generation{0};
+};
+
+// All access to the registry below must hold contextPoolMutex, context lifecycle calls can come from any isolate thread.
+// The bindings keep per class registries shared by every context, so the exported calls which build, run or release
+// a bridge hold the mutex until they are done with it. A bridge they resolved can't be disposed by another thread
+// under them. Callbacks dart delivers on the UI thread, such as timers, enter a context without it.
+std::recursive_mutex contextPoolMutex;
 std::atomic<bool> inited{false};
-std::atomic<int32_t> poolIndex{0};
-int maxPoolSize = 0;
-kraken::JSBridge **contextPool;
+int32_t poolIndex{0};
+// Starts with the poolSize passed to initJSContextPool() and grows on demand. Disposed slots are reused instead of
+// being released, so their generation keeps rejecting stale ids.
+std::vector<ContextSlot> contextPool;
 Screen screen;
 
+// Pre-warmed bridges, only available when setContextPoolPrewarmSize() was called with a positive size.
+// spareContextList holds standby bridges built for reserved context ids which had not been handed out yet,
+// reloadContextMap holds one standby bridge for each allocated context id to be swapped in by reloadJsContext().
+int32_t prewarmSize = 0;
+std::deque<kraken::JSBridge *> spareContextList;
+std::unordered_map<int32_t, kraken::JSBridge *> reloadContextMap;
+bool refillScheduled = false;
+
 std::__thread_id uiThreadId;
 
 std::__thread_id getUIThreadId() {
@@ -64,96 +99,238 @@ void printError(int32_t contextId, const char* errmsg) {
 
 namespace {
 
+int32_t makeContextId(int32_t slot, int32_t generation) {
+  return (generation << CONTEXT_SLOT_BITS) | slot;
+}
+
+int32_t getContextSlot(int32_t contextId) {
+  return contextId & CONTEXT_SLOT_MASK;
+}
+
+int32_t getContextGeneration(int32_t contextId) {
+  return (contextId >> CONTEXT_SLOT_BITS) & CONTEXT_GENERATION_MASK;
+}
+
+int32_t getContextPoolSize() {
+  return static_cast<int32_t>(contextPool.size());
+}
+
+bool isContextIdMatched(int32_t contextId) {
+  if (contextId < 0) return false;
+  int32_t slot = getContextSlot(contextId);
+  return slot < getContextPoolSize() && contextPool[slot].generation == getContextGeneration(contextId);
+}
+
+kraken::JSBridge *resolveBridge(int32_t contextId) {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  if (!inited || !isContextIdMatched(contextId)) return nullptr;
+  return contextPool[getContextSlot(contextId)].bridge;
+}
+
+// Take an empty slot and mark it as reserved, the pool grows when every slot is in use.
+// Returns the tagged context id or -1 when the pool had reached MAX_CONTEXT_POOL_SIZE.
+int32_t reserveContextId() {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  int32_t poolSize = getContextPoolSize();
+  for (int i = 0; i < poolSize; i++) {
+    int32_t slot = (poolIndex + 1 + i) % poolSize;
+    auto &contextSlot = contextPool[slot];
+    if (contextSlot.bridge == nullptr && !contextSlot.reserved) {
+      contextSlot.reserved = true;
+      poolIndex = slot;
+      return makeContextId(slot, contextSlot.generation);
+    }
+  }
+
+  if (poolSize >= MAX_CONTEXT_POOL_SIZE) return -1;
+
+  contextPool.emplace_back();
+  contextPool[poolSize].reserved = true;
+  poolIndex = poolSize;
+  return makeContextId(poolSize, 0);
+}
+
+void publishBridge(kraken::JSBridge *bridge) {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  auto &contextSlot = contextPool[getContextSlot(bridge->contextId)];
+  contextSlot.bridge = bridge;
+  contextSlot.reserved = false;
+}
+
+void disposeSpareBridge() {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  for (auto bridge : spareContextList) {
+    int32_t contextId = bridge->contextId;
+    contextPool[getContextSlot(contextId)].reserved = false;
+    delete bridge;
+    foundation::UICommandTaskMessageQueue::dispose(contextId);
+  }
+  spareContextList.clear();
+  for (auto &entry : reloadContextMap) {
+    delete entry.second;
+  }
+  reloadContextMap.clear();
+}
+
 void disposeAllBridge() {
-  for (int i = 0; i <= poolIndex; i++) {
-    disposeContext(i);
+  disposeSpareBridge();
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  for (int i = 0; i < getContextPoolSize(); i++) {
+    if (contextPool[i].bridge != nullptr) {
+      disposeContext(contextPool[i].bridge->contextId);
+    }
   }
   poolIndex = 0;
   inited = false;
 }
 
-int32_t searchForAvailableContextId() {
-  for (int i = 0; i < maxPoolSize; i++) {
-    if (contextPool[i] == nullptr) {
-      return i;
+void refillContextPool(void *data) {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  refillScheduled = false;
+  if (!inited || prewarmSize <= 0) return;
+
+  while (static_cast<int32_t>(spareContextList.size()) < prewarmSize) {
+    int32_t contextId = reserveContextId();
+    if (contextId == -1) break;
+    spareContextList.emplace_back(new kraken::JSBridge(contextId, printError, true));
+  }
+
+  for (int i = 0; i < getContextPoolSize(); i++) {
+    auto bridge = contextPool[i].bridge;
+    if (bridge != nullptr && reloadContextMap.count(bridge->contextId) == 0) {
+      reloadContextMap[bridge->contextId] = new kraken::JSBridge(bridge->contextId, printError, true);
     }
   }
-  return -1;
+}
+
+// Building a bridge calls into dart methods which are only available in UI thread, so spare bridges are refilled
+// in the next flushBridgeTask() instead of blocking the caller which are waiting for a context.
+void scheduleContextPoolRefill() {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  if (prewarmSize <= 0 || refillScheduled) return;
+  refillScheduled = true;
+  foundation::UITaskMessageQueue::instance()->registerTask(refillContextPool, nullptr);
 }
 
 } // namespace
 
 void initJSContextPool(int poolSize) {
+  assert(poolSize > 0 && poolSize <= MAX_CONTEXT_POOL_SIZE);
   uiThreadId = std::this_thread::get_id();
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
   // When dart hot restarted, should dispose previous bridge and clear task message queue.
   if (inited) {
     disposeAllBridge();
     foundation::UICommandTaskMessageQueue::instance(0)->clear();
   };
-  contextPool = new kraken::JSBridge *[poolSize];
-  for (int i = 1; i < poolSize; i++) {
-    contextPool[i] = nullptr;
-  }
 
-  contextPool[0] = new kraken::JSBridge(0, printError);
+  contextPool.clear();
+  contextPool.resize(poolSize);
+  contextPool[0].reserved = true;
+
+  publishBridge(new kraken::JSBridge(0, printError));
   inited = true;
-  maxPoolSize = poolSize;
+  scheduleContextPoolRefill();
+}
+
+void setContextPoolPrewarmSize(int32_t size) {
+  {
+    std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+    prewarmSize = size;
+  }
+  if (size <= 0) {
+    disposeSpareBridge();
+    return;
+  }
+  if (inited) scheduleContextPoolRefill();
 }
 
 void disposeContext(int32_t contextId) {
-  assert(contextId < maxPoolSize);
-  if (contextPool[contextId] == nullptr) return;
-  auto context = static_cast<kraken::JSBridge *>(contextPool[contextId]);
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  if (!isContextIdMatched(contextId)) return;
+  auto &contextSlot = contextPool[getContextSlot(contextId)];
+  if (contextSlot.bridge == nullptr) return;
+  kraken::JSBridge *context = contextSlot.bridge;
+  if (reloadContextMap.count(contextId) > 0) {
+    delete reloadContextMap[contextId];
+    reloadContextMap.erase(contextId);
+  }
+  contextSlot.bridge = nullptr;
+  contextSlot.generation = (contextSlot.generation + 1) & CONTEXT_GENERATION_MASK;
+
   delete context;
-  contextPool[contextId] = nullptr;
+  foundation::UICommandTaskMessageQueue::dispose(contextId);
 }
 
 int32_t allocateNewContext() {
-  poolIndex++;
-  if (poolIndex >= maxPoolSize) {
-    poolIndex = searchForAvailableContextId();
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  kraken::JSBridge *spareContext = nullptr;
+  if (!spareContextList.empty()) {
+    spareContext = spareContextList.front();
+    spareContextList.pop_front();
   }
 
-  assert(contextPool[poolIndex] == nullptr && (std::string("can not allocate JSBridge at index") +
-                                               std::to_string(poolIndex) + std::string(": bridge have already exist."))
-                                                .c_str());
+  if (spareContext != nullptr) {
+    publishBridge(spareContext);
+    spareContext->activate();
+    scheduleContextPoolRefill();
+    return spareContext->contextId;
+  }
 
-  auto context = new kraken::JSBridge(poolIndex, printError);
-  contextPool[poolIndex] = context;
-  return poolIndex;
+  int32_t contextId = reserveContextId();
+  if (contextId == -1) return -1;
+
+  publishBridge(new kraken::JSBridge(contextId, printError));
+  scheduleContextPoolRefill();
+  return contextId;
 }
 
 void *getJSContext(int32_t contextId) {
-  assert(checkContext(contextId) && "getJSContext: contextId is not valid.");
-  return contextPool[contextId];
+  auto bridge = resolveBridge(contextId);
+  assert(bridge != nullptr && "getJSContext: contextId is not valid.");
+  return bridge;
 }
 
 bool checkContext(int32_t contextId) {
-  return inited && contextId < maxPoolSize && contextPool[contextId] != nullptr;
+  return resolveBridge(contextId) != nullptr;
 }
 
 bool checkContext(int32_t contextId, void *context) {
-  if (contextPool[contextId] == nullptr) return false;
-  auto bridge = static_cast<kraken::JSBridge *>(getJSContext(contextId));
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  auto bridge = resolveBridge(contextId);
+  if (bridge == nullptr) return false;
   return bridge->getContext().get() == context;
 }
 
 void evaluateScripts(int32_t contextId, NativeString *code, const char *bundleFilename, int startLine) {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
   assert(checkContext(contextId) && "evaluateScripts: contextId is not valid");
   auto context = static_cast<kraken::JSBridge *>(getJSContext(contextId));
   context->evaluateScript(code, bundleFilename, startLine);
 }
 
 void reloadJsContext(int32_t contextId) {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
   assert(checkContext(contextId) && "reloadJSContext: contextId is not valid");
-  auto bridgePtr = getJSContext(contextId);
-  auto context = static_cast<kraken::JSBridge *>(bridgePtr);
-  auto newContext = new kraken::JSBridge(contextId, printError);
+  if (resolveBridge(contextId) == nullptr) return;
+  kraken::JSBridge *newContext = nullptr;
+  if (reloadContextMap.count(contextId) > 0) {
+    newContext = reloadContextMap[contextId];
+    reloadContextMap.erase(contextId);
+  } else {
+    newContext = new kraken::JSBridge(contextId, printError);
+  }
+
+  auto &contextSlot = contextPool[getContextSlot(contextId)];
+  kraken::JSBridge *context = contextSlot.bridge;
+  contextSlot.bridge = newContext;
   delete context;
-  contextPool[contextId] = newContext;
+  newContext->activate();
+  scheduleContextPoolRefill();
 }
 
 void invokeModuleEvent(int32_t contextId, NativeString *moduleName, const char *eventType, void *event, NativeString *extra) {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
   assert(checkContext(contextId) && "invokeEventListener: contextId is not valid");
   auto context = static_cast<kraken::JSBridge *>(getJSContext(contextId));
   context->invokeModuleEvent(moduleName, eventType, event, extra);
@@ -194,6 +371,8 @@ KrakenInfo *getKrakenInfo() {
 }
 
 void flushBridgeTask() {
+  TRACE_EVENT("bridge", "flushBridgeTask");
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
   foundation::UITaskMessageQueue::instance()->flushTaskFromUIThread();
 }
 
@@ -210,9 +389,35 @@ void clearUICommandItems(int32_t contextId) {
 }
 
 void flushUICommandCallback() {
+  TRACE_EVENT("bridge", "flushUICommandCallback");
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
   foundation::UICommandCallbackQueue::instance()->flushCallbacks();
 }
 
+void setLogLevel(int32_t level) {
+  foundation::setMinLogSeverity(level);
+}
+
+void setTracingEnabled(int8_t enabled) {
+  foundation::Tracing::setEnabled(enabled != 0);
+}
+
+void clearTrace() {
+  foundation::Tracing::clear();
+}
+
+int8_t dumpTrace(const char *path) {
+  return foundation::Tracing::writeJSON(path) ? 1 : 0;
+}
+
+int8_t getContextMemoryStats(int32_t contextId, ContextMemoryStats *stats) {
+  std::lock_guard<std::recursive_mutex> guard(contextPoolMutex);
+  kraken::JSBridge *bridge = resolveBridge(contextId);
+  if (bridge == nullptr || stats == nullptr) return 0;
+  bridge->getMemoryStats(stats);
+  return 1;
+}
+
 void registerPluginSource(NativeString *code, const char *pluginName) {
   kraken::JSBridge::pluginSourceCode[pluginName] = NativeString{
     code->string,
@@ -220,6 +425,14 @@ void registerPluginSource(NativeString *code, const char *pluginName) {
   };
 }
 
+void registerPluginByteCode(const uint8_t *bytes, int32_t length, const char *pluginName) {
+#if KRAKEN_QUICK_JS_ENGINE
+  kraken::JSBridge::pluginByteCode[pluginName] = std::vector<uint8_t>(bytes, bytes + length);
+#else
+  KRAKEN_LOG(ERROR) << "Plugin " << pluginName << " is precompiled bytecode, which requires the QuickJS engine.";
+#endif
+}
+
 NativeString *NativeString::clone() {
   NativeString *newNativeString = new NativeString();
   uint16_t *newString = new uint16_t[length];
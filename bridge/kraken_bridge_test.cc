@@ -10,16 +10,16 @@
 #include "bridge_test_jsa.h"
 #elif KRAKEN_JSC_ENGINE
 #include "bridge_test_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_test_qjs.h"
 #endif
 #include <atomic>
+#include <unordered_map>
 
-kraken::JSBridgeTest **bridgeTestPool {nullptr};
+// Keyed by the tagged context id, slots of disposed contexts are reused with another id.
+std::unordered_map<int32_t, kraken::JSBridgeTest *> bridgeTestPool;
 
 void initTestFramework(int32_t contextId) {
-  if (bridgeTestPool == nullptr) {
-      bridgeTestPool = new kraken::JSBridgeTest*[10];
-  }
-
   auto bridge = static_cast<kraken::JSBridge *>(getJSContext(contextId));
   auto bridgeTest = new kraken::JSBridgeTest(bridge);
   bridgeTestPool[contextId] = bridgeTest;
@@ -2,13 +2,21 @@ const minimist = require('minimist');
 const argv = minimist(process.argv.slice(2));
 const path = require('path');
 const fs = require('fs');
+const { spawnSync } = require('child_process');
 
 if (argv.help) {
   process.stdout.write(`Convert Javascript Code into Cpp source code
-Usage: node js_to_c.js -s /path/to/source.js -o /path/to/dist.cc -n polyfill\n`);
+Usage: node js_to_c.js -s /path/to/source.js -o /path/to/dist.cc -n polyfill
+
+When KRAKEN_JS_ENGINE is quickjs, the source is precompiled into QuickJS bytecode.
+  --plugin           Write the bytecode into <name>.kbc for registerPluginByteCode() instead of Cpp source code.
+  --benchmark [n]    Compare evaluating the source with loading its bytecode in n new contexts.\n`);
   process.exit(0);
 }
 
+const QUICKJS_PATH = path.join(__dirname, '../../third_party/quickjs');
+const QUICKJS_SOURCES = ['quickjs.c', 'libregexp.c', 'libunicode.c', 'cutils.c'];
+
 const getPolyFillHeader = (outputName) => `/*
  * Copyright (C) 2020 Alibaba Inc. All rights reserved.
  * Author: Kraken Team.
@@ -20,10 +28,19 @@ const getPolyFillHeader = (outputName) => `/*
 #include "bridge_jsa.h"
 #elif KRAKEN_JSC_ENGINE
 #include "bridge_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_qjs.h"
 #endif
 
 void initKraken${outputName}(kraken::JSBridge *bridge);
 
+#if KRAKEN_QUICK_JS_ENGINE
+// QuickJS version the bytecode is compiled by and the bytecode itself.
+extern const char *kraken${outputName}ByteCodeVersion;
+extern const uint8_t kraken${outputName}ByteCode[];
+extern const size_t kraken${outputName}ByteCodeLength;
+#endif
+
 #endif // KRAKEN_${outputName.toUpperCase()}_H
 `;
 
@@ -41,9 +58,83 @@ void initKraken${outputName}(kraken::JSBridge *bridge) {
 }
 `;
 
+// The bytecode is checked against the QuickJS linked into the bridge at compile time, the source is not compiled in.
+// Bytecode QuickJS can't read, like bytecode of another configuration, is reported as an error of the context.
+const getPolyFillByteCodeSource = (bytes, version, outputName) => `/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "${outputName.toLowerCase()}.h"
+#include <string_view>
+
+static_assert(std::string_view(QUICKJS_VERSION) == "${version}",
+              "${outputName} is precompiled by QuickJS ${version}, rebuild it with the bundled QuickJS.");
+
+const char *kraken${outputName}ByteCodeVersion = "${version}";
+const uint8_t kraken${outputName}ByteCode[] = {
+${formatBytes(bytes)}
+};
+const size_t kraken${outputName}ByteCodeLength = sizeof(kraken${outputName}ByteCode);
+
+void initKraken${outputName}(kraken::JSBridge *bridge) {
+  bridge->evaluateByteCode(kraken${outputName}ByteCode, kraken${outputName}ByteCodeLength);
+}
+`;
+
+function formatBytes(bytes) {
+  let lines = [];
+  for (let i = 0; i < bytes.length; i += 16) {
+    let line = Array.from(bytes.slice(i, i + 16)).map(byte => '0x' + byte.toString(16).padStart(2, '0'));
+    lines.push('  ' + line.join(', ') + ',');
+  }
+  return lines.join('\n');
+}
+
+// Raw string literals end at )", which is split out of the source.
+function escapeRawString(code) {
+  return code.replace(/\)\"/g, '))") + std::u16string(uR"("');
+}
+
 function convertJSToCpp(code, outputName) {
-  code = code.replace(/\)\"/g, '))") + std::u16string(uR"("');
-  return getPolyFillSource(code, outputName);
+  return getPolyFillSource(escapeRawString(code), outputName);
+}
+
+function run(command, args) {
+  let result = spawnSync(command, args, { stdio: 'inherit' });
+  if (result.status !== 0) {
+    console.error(`${command} ${args.join(' ')} failed`);
+    process.exit(1);
+  }
+}
+
+// Build qjs_compiler with the bundled QuickJS and the definitions the bridge compiles it with, bytecode of another
+// QuickJS release or configuration can not be read by the bridge.
+function getQuickJSCompiler(outputPath) {
+  let compiler = path.join(outputPath, 'qjs_compiler');
+  let inputs = [path.join(__dirname, 'qjs_compiler.c'), path.join(QUICKJS_PATH, 'VERSION')]
+    .concat(QUICKJS_SOURCES.map(source => path.join(QUICKJS_PATH, source)));
+  if (fs.existsSync(compiler)) {
+    let builtTime = fs.statSync(compiler).mtimeMs;
+    if (inputs.every(input => fs.statSync(input).mtimeMs <= builtTime)) {
+      return compiler;
+    }
+  }
+
+  let version = fs.readFileSync(path.join(QUICKJS_PATH, 'VERSION'), { encoding: 'utf-8' }).trim();
+  run(process.env.CC || 'cc', [
+    '-O2', '-D_GNU_SOURCE', `-DCONFIG_VERSION="${version}"`, `-I${QUICKJS_PATH}`,
+    '-o', compiler
+  ].concat(inputs.filter(input => input.endsWith('.c')), ['-lm', '-lpthread']));
+  return compiler;
+}
+
+function compileByteCode(sourcePath, outputPath, outputName) {
+  let compiler = getQuickJSCompiler(outputPath);
+  let bytecodePath = path.join(outputPath, outputName.toLowerCase() + '.kbc');
+  run(compiler, ['compile', sourcePath, bytecodePath, 'internal://']);
+  let version = spawnSync(compiler, ['version'], { encoding: 'utf-8' }).stdout.trim();
+  return { bytecodePath, version };
 }
 
 let source = argv.s;
@@ -66,10 +157,28 @@ function getAbsolutePath(p) {
 let sourcePath = getAbsolutePath(source);
 let outputPath = getAbsolutePath(output);
 
-let jsCode = fs.readFileSync(sourcePath, {encoding: 'utf-8'});
+if (argv.benchmark) {
+  let iterations = typeof argv.benchmark === 'number' ? argv.benchmark : 20;
+  run(getQuickJSCompiler(outputPath), ['benchmark', sourcePath, String(iterations)]);
+  process.exit(0);
+}
+
+if (argv.plugin) {
+  compileByteCode(sourcePath, outputPath, outputName);
+  process.exit(0);
+}
 
 let headerSource = getPolyFillHeader(outputName);
-let ccSource = convertJSToCpp(jsCode, outputName);
+let ccSource;
+
+if (process.env.KRAKEN_JS_ENGINE === 'quickjs') {
+  let { bytecodePath, version } = compileByteCode(sourcePath, outputPath, outputName);
+  ccSource = getPolyFillByteCodeSource(fs.readFileSync(bytecodePath), version, outputName);
+  fs.unlinkSync(bytecodePath);
+} else {
+  let jsCode = fs.readFileSync(sourcePath, {encoding: 'utf-8'});
+  ccSource = convertJSToCpp(jsCode, outputName);
+}
 
 fs.writeFileSync(path.join(outputPath, outputName.toLowerCase() + '.h'), headerSource);
 fs.writeFileSync(path.join(outputPath, outputName.toLowerCase() + '.cc'), ccSource);
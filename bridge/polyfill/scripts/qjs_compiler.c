@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+// Host tool of js_to_c.js, which is built from the QuickJS bundled with the bridge. Bytecode can only be read by the
+// QuickJS version and configuration which wrote it, so it must not be replaced by the qjsc of another release.
+//
+// Usage:
+//   qjs_compiler version
+//   qjs_compiler compile <source.js> <output.bin> <sourceURL>
+//   qjs_compiler benchmark <source.js> [iterations]
+
+#include "quickjs.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static char *readFile(const char *path, size_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    fprintf(stderr, "can not open %s\n", path);
+    return NULL;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *buffer = malloc(size + 1);
+  if (fread(buffer, 1, size, file) != (size_t)size) {
+    fprintf(stderr, "can not read %s\n", path);
+    free(buffer);
+    fclose(file);
+    return NULL;
+  }
+  buffer[size] = '\0';
+  fclose(file);
+  *length = size;
+  return buffer;
+}
+
+static void printException(JSContext *ctx) {
+  JSValue error = JS_GetException(ctx);
+  const char *message = JS_ToCString(ctx, error);
+  fprintf(stderr, "%s\n", message == NULL ? "unknown error" : message);
+  if (JS_IsError(ctx, error)) {
+    JSValue stack = JS_GetPropertyStr(ctx, error, "stack");
+    const char *stackString = JS_ToCString(ctx, stack);
+    if (stackString != NULL) fprintf(stderr, "%s", stackString);
+    JS_FreeCString(ctx, stackString);
+    JS_FreeValue(ctx, stack);
+  }
+  JS_FreeCString(ctx, message);
+  JS_FreeValue(ctx, error);
+}
+
+// Compile the source as a global script, the same way JSContext::evaluateJavaScript evaluates it.
+static uint8_t *compile(JSContext *ctx, const char *source, size_t length, const char *sourceURL, size_t *size) {
+  JSValue function = JS_Eval(ctx, source, length, sourceURL, JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+  if (JS_IsException(function)) {
+    printException(ctx);
+    return NULL;
+  }
+  uint8_t *bytes = JS_WriteObject(ctx, size, function, JS_WRITE_OBJ_BYTECODE);
+  JS_FreeValue(ctx, function);
+  return bytes;
+}
+
+static double now() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+
+static int runCompile(const char *sourcePath, const char *outputPath, const char *sourceURL) {
+  size_t length;
+  char *source = readFile(sourcePath, &length);
+  if (source == NULL) return 1;
+
+  JSRuntime *runtime = JS_NewRuntime();
+  JSContext *ctx = JS_NewContext(runtime);
+  size_t size;
+  uint8_t *bytes = compile(ctx, source, length, sourceURL, &size);
+  free(source);
+
+  int result = 1;
+  if (bytes != NULL) {
+    FILE *output = fopen(outputPath, "wb");
+    if (output != NULL && fwrite(bytes, 1, size, output) == size) {
+      result = 0;
+    } else {
+      fprintf(stderr, "can not write %s\n", outputPath);
+    }
+    if (output != NULL) fclose(output);
+    js_free(ctx, bytes);
+  }
+
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+  return result;
+}
+
+// Globals the bridge binds before the polyfill is evaluated. While it's loaded the polyfill only keeps references to
+// them or calls them for values it doesn't check, functions which do nothing are enough to load it.
+static const char BRIDGE_STUBS[] =
+  "var window = globalThis;"
+  "function __kraken_stub__() { return ''; }"
+  "var __kraken_invoke_module__ = __kraken_stub__, __kraken_module_listener__ = __kraken_stub__,"
+  "  __kraken_flush_ui_command__ = __kraken_stub__, __kraken_print__ = __kraken_stub__,"
+  "  __kraken_format_log__ = __kraken_stub__, __kraken_format_dir__ = __kraken_stub__;"
+  "var __kraken_console__ = {}, __kraken__ = { userAgent: '' };";
+
+static JSContext *newBridgeContext(JSRuntime **runtime) {
+  *runtime = JS_NewRuntime();
+  JSContext *ctx = JS_NewContext(*runtime);
+  JSValue result = JS_Eval(ctx, BRIDGE_STUBS, strlen(BRIDGE_STUBS), "stub://", JS_EVAL_TYPE_GLOBAL);
+  JS_FreeValue(ctx, result);
+  return ctx;
+}
+
+static void freeBridgeContext(JSRuntime *runtime, JSContext *ctx) {
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+// Returns 0 and prints the error once when the script throws, the source and the bytecode stop at the same statement
+// so their times are still comparable.
+static int checkEvaluated(JSContext *ctx, JSValue result, int *reported) {
+  int succeed = !JS_IsException(result);
+  if (!succeed && !*reported) {
+    printException(ctx);
+    *reported = 1;
+  }
+  JS_FreeValue(ctx, result);
+  return succeed;
+}
+
+// Time what loading a script, usually the polyfill, adds to the initialization of a context: evaluating its source,
+// which parses it, or reading its bytecode and running that. Each way is measured on contexts of its own.
+static int runBenchmark(const char *sourcePath, int iterations) {
+  size_t length;
+  char *source = readFile(sourcePath, &length);
+  if (source == NULL) return 1;
+
+  JSRuntime *runtime = JS_NewRuntime();
+  JSContext *ctx = JS_NewContext(runtime);
+  size_t size;
+  uint8_t *bytes = compile(ctx, source, length, "internal://", &size);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+  if (bytes == NULL) {
+    free(source);
+    return 1;
+  }
+
+  double contextTime = 0;
+  double sourceTime = 0;
+  double byteCodeTime = 0;
+  int reported = 0;
+  int completed = 1;
+  for (int i = 0; i < iterations; i++) {
+    double start = now();
+    ctx = newBridgeContext(&runtime);
+    contextTime += now() - start;
+    start = now();
+    JSValue result = JS_Eval(ctx, source, length, "internal://", JS_EVAL_TYPE_GLOBAL);
+    sourceTime += now() - start;
+    completed &= checkEvaluated(ctx, result, &reported);
+    freeBridgeContext(runtime, ctx);
+
+    ctx = newBridgeContext(&runtime);
+    start = now();
+    JSValue function = JS_ReadObject(ctx, bytes, size, JS_READ_OBJ_BYTECODE);
+    result = JS_IsException(function) ? function : JS_EvalFunction(ctx, function);
+    byteCodeTime += now() - start;
+    completed &= checkEvaluated(ctx, result, &reported);
+    freeBridgeContext(runtime, ctx);
+  }
+
+  printf("source: %zu bytes, bytecode: %zu bytes, %d iterations%s\n", length, size, iterations,
+         completed ? "" : ", the script threw before it completed");
+  printf("new context:     %.3fms per context\n", contextTime / iterations);
+  printf("evaluate source: %.3fms per context\n", sourceTime / iterations);
+  printf("load bytecode:   %.3fms per context\n", byteCodeTime / iterations);
+
+  free(bytes);
+  free(source);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc == 2 && strcmp(argv[1], "version") == 0) {
+    printf("%s\n", CONFIG_VERSION);
+    return 0;
+  }
+  if (argc == 5 && strcmp(argv[1], "compile") == 0) {
+    return runCompile(argv[2], argv[3], argv[4]);
+  }
+  if ((argc == 3 || argc == 4) && strcmp(argv[1], "benchmark") == 0) {
+    int iterations = argc == 4 ? atoi(argv[3]) : 20;
+    return runBenchmark(argv[2], iterations > 0 ? iterations : 20);
+  }
+  fprintf(stderr, "Usage: qjs_compiler version | compile <source.js> <output.bin> <sourceURL> | "
+                  "benchmark <source.js> [iterations]\n");
+  return 1;
+}
@@ -20,11 +20,37 @@ export interface PrivateKraken {
 declare const __kraken__: PrivateKraken;
 export const privateKraken = __kraken__;
 
-declare const __kraken_invoke_module__: (module: string, method: string, params?: Object | null, fn?: (err: Error, data: any) => void) => string;
+declare const __kraken_invoke_module__: (module: string, method: string, params?: Object | null, fn?: ((err: Error, data: any, bytes?: ArrayBuffer) => void) | null, bytes?: ArrayBuffer | ArrayBufferView | Blob) => string;
 export const krakenInvokeModule = __kraken_invoke_module__;
 
-declare const __kraken_module_listener__: (fn: (moduleName: string, event: Event, extra: string) => void) => void;
+type KrakenModuleListener = (moduleName: string, event: Event, extra: any) => void;
+declare const __kraken_module_listener__: {
+  (fn: KrakenModuleListener): void;
+  (moduleName: string, fn: KrakenModuleListener): void;
+};
 export const addKrakenModuleListener = __kraken_module_listener__;
 
 declare const __kraken_print__: (log: string, level?: string) => void;
 export const krakenPrint = __kraken_print__;
+
+// console.log() and console.dir() formatting of arguments, https://console.spec.whatwg.org/#formatter.
+declare const __kraken_format_log__: (...args: any[]) => string;
+export const krakenFormatLog = __kraken_format_log__;
+
+declare const __kraken_format_dir__: (...args: any[]) => string;
+export const krakenFormatDir = __kraken_format_dir__;
+
+// console.time(), count(), group() and table() keep their state natively, per context.
+interface KrakenConsole {
+  time(label?: any): void;
+  timeLog(label?: any, ...data: any[]): void;
+  timeEnd(label?: any): void;
+  count(label?: any): void;
+  countReset(label?: any): void;
+  group(...data: any[]): void;
+  groupCollapsed(...data: any[]): void;
+  groupEnd(): void;
+  table(data: any, columns?: string[]): void;
+}
+declare const __kraken_console__: KrakenConsole;
+export const krakenConsole = __kraken_console__;
@@ -5,10 +5,7 @@ import { fetch, Request, Response, Headers } from './modules/fetch';
 import { matchMedia } from './kom/match-media';
 import { location } from './kom/location';
 import { navigator } from './kom/navigator';
-import { XMLHttpRequest } from './modules/xhr';
 import { asyncStorage } from './modules/async-storage';
-import { URLSearchParams } from './kom/url-search-params';
-import { URL } from './kom/url';
 import { kraken } from './kom/kraken';
 import { history } from './kom/history';
 
@@ -22,10 +19,7 @@ defineGlobalProperty('matchMedia', matchMedia);
 defineGlobalProperty('location', location);
 defineGlobalProperty('navigator', navigator);
 defineGlobalProperty('__history__', history);
-defineGlobalProperty('XMLHttpRequest', XMLHttpRequest);
 defineGlobalProperty('asyncStorage', asyncStorage);
-defineGlobalProperty('URLSearchParams', URLSearchParams);
-defineGlobalProperty('URL', URL);
 defineGlobalProperty('kraken', kraken);
 
 function defineGlobalProperty(key: string, value: any) {
@@ -3,26 +3,20 @@ import {methodChannel, triggerMethodCallHandler} from '../modules/method-channel
 import {dispatchConnectivityChangeEvent} from "../modules/connection";
 import {dispatchWebSocketEvent} from "../modules/websocket";
 
-function krakenModuleListener(moduleName: string, event: Event, data: any) {
-  switch (moduleName) {
-    case 'Connection': {
-      dispatchConnectivityChangeEvent(event);
-      break;
-    }
-    case 'MethodChannel': {
-      const method = data[0];
-      const args = data[1];
-      triggerMethodCallHandler(method, args);
-      break;
-    }
-    case 'WebSocket': {
-      dispatchWebSocketEvent(data, event as ErrorEvent);
-      break;
-    }
-  }
-}
+// Listeners are subscribed per module, so the bridge only calls into the module which the event belongs to.
+addKrakenModuleListener('Connection', (moduleName: string, event: Event) => {
+  dispatchConnectivityChangeEvent(event);
+});
 
-addKrakenModuleListener(krakenModuleListener);
+addKrakenModuleListener('MethodChannel', (moduleName: string, event: Event, data: any) => {
+  const method = data[0];
+  const args = data[1];
+  triggerMethodCallHandler(method, args);
+});
+
+addKrakenModuleListener('WebSocket', (moduleName: string, event: Event, data: any) => {
+  dispatchWebSocketEvent(data, event as ErrorEvent);
+});
 
 export const kraken = {
   ...privateKraken,
@@ -1,5 +1,4 @@
 import { krakenInvokeModule } from '../bridge';
-import { URL } from './url';
 import {kraken} from "./kraken";
 
 // @ts-ignore
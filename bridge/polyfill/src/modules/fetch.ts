@@ -80,6 +80,9 @@ export class Headers implements Headers {
 class Body {
   // TODO support readableStream
   _bodyInit: any;
+  // Binary bodies are kept as it is, and only decoded when text() or json() is called.
+  _bodyArrayBuffer: ArrayBuffer | null;
+  _bodyBlob: Blob | null;
   body: string | null;
   bodyUsed: boolean;
   headers: Headers;
@@ -90,11 +93,21 @@ class Body {
 
   _initBody(body: BodyInit | null) {
     this._bodyInit = body;
-    // only support string from now
+    this._bodyArrayBuffer = null;
+    this._bodyBlob = null;
     if (!body) {
       this.body = '';
     } else if (typeof body === 'string') {
       this.body = body;
+    } else if (body instanceof ArrayBuffer) {
+      this._bodyArrayBuffer = body;
+      this.body = null;
+    } else if (ArrayBuffer.isView(body)) {
+      this._bodyArrayBuffer = body.buffer.slice(body.byteOffset, body.byteOffset + body.byteLength);
+      this.body = null;
+    } else if (body instanceof Blob) {
+      this._bodyBlob = body;
+      this.body = null;
     } else {
       this.body = body = Object.prototype.toString.call(body);
     }
@@ -102,16 +115,40 @@ class Body {
     if (!this.headers.get('content-type')) {
       if (typeof body === 'string') {
         this.headers.set('content-type', 'text/plain;charset=UTF-8')
+      } else if (this._bodyBlob && this._bodyBlob.type) {
+        this.headers.set('content-type', this._bodyBlob.type);
       }
     }
   }
 
-  arrayBuffer(): Promise<ArrayBuffer> {
-    throw new Error('not supported');
+  _readAsBlob(): Blob {
+    if (this._bodyBlob) {
+      return this._bodyBlob;
+    }
+    let type = this.headers.get('content-type') || '';
+    if (this._bodyArrayBuffer) {
+      return new Blob([this._bodyArrayBuffer], {type});
+    }
+    return new Blob([this.body || ''], {type});
   }
 
-  blob(): Promise<Blob> {
-    throw new Error('not supported');
+  async arrayBuffer(): Promise<ArrayBuffer> {
+    let rejected = consumed(this);
+    if (rejected) {
+      return rejected;
+    }
+    if (this._bodyArrayBuffer) {
+      return this._bodyArrayBuffer;
+    }
+    return this._readAsBlob().arrayBuffer();
+  }
+
+  async blob(): Promise<Blob> {
+    let rejected = consumed(this);
+    if (rejected) {
+      return rejected;
+    }
+    return this._readAsBlob();
   }
 
   formData(): Promise<FormData> {
@@ -119,6 +156,10 @@ class Body {
   }
 
   async json(): Promise<any> {
+    if (this._bodyArrayBuffer || this._bodyBlob) {
+      return JSON.parse(await this.text());
+    }
+
     if (!this.body) {
       return {};
     }
@@ -132,7 +173,9 @@ class Body {
     if (rejected) {
       return rejected;
     }
-    this.bodyUsed = true;
+    if (this._bodyArrayBuffer || this._bodyBlob) {
+      return this._readAsBlob().text();
+    }
     return this.body || '';
   }
 }
@@ -162,6 +205,7 @@ export class Request extends Body {
       }
       this.method = input.method;
       this.mode = input.mode;
+      this.credentials = input.credentials;
       if (!body && input._bodyInit != null) {
         body = input._bodyInit;
         input.bodyUsed = true;
@@ -175,6 +219,7 @@ export class Request extends Body {
     }
     this.method = normalizeMethod(init.method || this.method || 'GET');
     this.mode = init.mode || this.mode || null;
+    this.credentials = init.credentials || this.credentials || 'same-origin';
 
     if ((this.method === 'GET' || this.method === 'HEAD') && body) {
       throw new TypeError('Body not allowed for GET or HEAD requests')
@@ -184,7 +229,6 @@ export class Request extends Body {
   }
 
   // readonly cache: RequestCache; // not supported
-  // readonly credentials: RequestCredentials; // not supported;
   // readonly destination: RequestDestination; // not supported
   // readonly integrity: string; // not supported
   // readonly isHistoryNavigation: boolean; // not supported
@@ -199,6 +243,7 @@ export class Request extends Body {
   readonly method: string;
   readonly headers: Headers;
   readonly mode: RequestMode;
+  readonly credentials: RequestCredentials;
 
   clone(): Request {
     return new Request(this, {body: this._bodyInit});
@@ -264,26 +309,29 @@ export function fetch(input: Request | string, init?: RequestInit) {
   return new Promise((resolve, reject) => {
       let url = typeof input === 'string' ? input : input.url;
       init = init || {method: 'GET'};
-      let headers = init.headers || new Headers();
-
-      if (!(headers instanceof Headers)) {
-        headers = new Headers(headers);
-      }
+      let headers = new Headers(init.headers);
+      let credentials = init.credentials || (typeof input === 'string' ? 'same-origin' : input.credentials);
 
+      // Cookie header is forbidden for page, the bridge takes it from the cookie jar and stores Set-Cookie headers
+      // of the response, following credentials.
       kraken.invokeModule('Fetch', url, ({
         ...init,
-        headers: (headers as Headers).map
-      }), (e, data) => {
+        credentials,
+        headers: headers.map
+      }), (e, data, bytes) => {
         if (e) return reject(e);
-        let [err, statusCode, body] = data;
+        let [err, statusCode, body, contentType] = data;
+
         // network error didn't have statusCode
         if (err && !statusCode) {
           reject(new Error(err));
           return;
         }
 
-        let res = new Response(body, {
-          status: statusCode
+        // Response body are handed over from dart as bytes without any encoding.
+        let res = new Response(bytes !== undefined ? bytes : body, {
+          status: statusCode,
+          headers: contentType ? {'content-type': contentType} : undefined
         });
 
         res.url = url;
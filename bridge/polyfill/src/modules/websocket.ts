@@ -56,6 +56,14 @@ export function dispatchWebSocketEvent(clientId: string, event: ErrorEvent) {
         break;
     }
     client.readyState = readyState;
+    // Binary frames arrive as ArrayBuffer, wrap them into Blob unless binaryType is arraybuffer.
+    if (event.type === 'message' && client.binaryType === BinaryType.blob) {
+      const messageEvent = event as unknown as MessageEvent;
+      if (messageEvent.data instanceof ArrayBuffer) {
+        // @ts-ignore
+        messageEvent.data = new Blob([messageEvent.data]);
+      }
+    }
     client.dispatchEvent(event);
   }
 }
@@ -97,9 +105,13 @@ export class WebSocket extends EventTarget {
     super.addEventListener(type, callback);
   }
 
-  // TODO add blob arrayBuffer ArrayBufferView format support
-  public send(message: string) {
-    kraken.invokeModule('WebSocket', 'send', ([this.id, message]))
+  public send(message: string | ArrayBuffer | ArrayBufferView | Blob) {
+    if (typeof message === 'string') {
+      kraken.invokeModule('WebSocket', 'send', ([this.id, message]));
+    } else {
+      // Binary message are handed over as raw bytes, the module receives [id, bytes].
+      kraken.invokeModule('WebSocket', 'send', ([this.id]), null, message);
+    }
   }
 
   public close(code: number, reason: string) {
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "foundation/bridge_callback.h"
+#include "foundation/instance_tracker.h"
+#include "test/bridge_fixture.h"
+
+#include <vector>
+
+using kraken::foundation::BridgeCallback;
+
+namespace {
+
+// Complete callbacks in the given order, the way Dart calls back into the bridge. A bridge callback of its own is
+// used, so tearing it down leaves the callbacks of the context alone.
+class BridgeCallbackTest : public kraken::test::BridgeFixture {
+protected:
+  std::vector<BridgeCallback::Handle> registerCallbacks(BridgeCallback &bridgeCallback, size_t count) {
+    std::vector<BridgeCallback::Handle> handles;
+    for (size_t i = 0; i < count; i++) {
+      auto callbackContext = std::make_unique<BridgeCallback::Context>(
+        *context(), kraken::binding::ScriptValue::null(context()).raw());
+      bridgeCallback.registerCallback<void>(
+        std::move(callbackContext),
+        [&handles](BridgeCallback::Handle handle, int32_t contextId) { handles.emplace_back(handle); });
+    }
+    return handles;
+  }
+};
+
+} // namespace
+
+TEST_F(BridgeCallbackTest, completeOutOfOrder) {
+  BridgeCallback bridgeCallback;
+  auto handles = registerCallbacks(bridgeCallback, 5);
+  for (size_t index : {3, 0, 4, 1, 2}) {
+    EXPECT_NE(bridgeCallback.getContext(handles[index]), nullptr);
+    bridgeCallback.freeBridgeCallbackContext(handles[index]);
+    EXPECT_EQ(bridgeCallback.getContext(handles[index]), nullptr);
+  }
+  EXPECT_EQ(bridgeCallback.contextCount(), 0);
+}
+
+TEST_F(BridgeCallbackTest, staleHandlesOfReusedSlotsResolveToNothing) {
+  BridgeCallback bridgeCallback;
+  auto freed = registerCallbacks(bridgeCallback, 1)[0];
+  bridgeCallback.freeBridgeCallbackContext(freed);
+
+  // The slot is taken by the next callback with another generation.
+  auto reused = registerCallbacks(bridgeCallback, 1)[0];
+  EXPECT_NE(reused, freed);
+  EXPECT_EQ(bridgeCallback.getContext(freed), nullptr);
+  bridgeCallback.freeBridgeCallbackContext(freed);
+  EXPECT_NE(bridgeCallback.getContext(reused), nullptr);
+  EXPECT_EQ(bridgeCallback.contextCount(), 1);
+}
+
+TEST_F(BridgeCallbackTest, handlesOfAnotherBridgeCallbackResolveToNothing) {
+  BridgeCallback bridgeCallback;
+  BridgeCallback anotherBridgeCallback;
+  auto handle = registerCallbacks(bridgeCallback, 1)[0];
+  registerCallbacks(anotherBridgeCallback, 1);
+  EXPECT_EQ(anotherBridgeCallback.getContext(handle), nullptr);
+  EXPECT_EQ(anotherBridgeCallback.getContext(nullptr), nullptr);
+  EXPECT_EQ(anotherBridgeCallback.getContext(reinterpret_cast<BridgeCallback::Handle>(0xdead)), nullptr);
+}
+
+TEST_F(BridgeCallbackTest, ignoreContextsFreedTwice) {
+  BridgeCallback bridgeCallback;
+  auto handles = registerCallbacks(bridgeCallback, 2);
+  bridgeCallback.freeBridgeCallbackContext(handles[1]);
+  bridgeCallback.freeBridgeCallbackContext(handles[1]);
+  EXPECT_EQ(bridgeCallback.contextCount(), 1);
+}
+
+TEST_F(BridgeCallbackTest, freePendingContextsOnTeardown) {
+  size_t tracked = ::foundation::InstanceTracker::survivors(contextId).size();
+  {
+    BridgeCallback bridgeCallback;
+    auto handles = registerCallbacks(bridgeCallback, 1000);
+    for (size_t index : {999, 500, 0}) {
+      bridgeCallback.freeBridgeCallbackContext(handles[index]);
+    }
+    EXPECT_EQ(bridgeCallback.contextCount(), 997);
+  }
+  // Contexts left pending are gone with the teardown, only tracked in debug builds.
+  EXPECT_EQ(::foundation::InstanceTracker::survivors(contextId).size(), tracked);
+}
+
+TEST_F(BridgeCallbackTest, timersFiredAfterDisposeAreDropped) {
+  evaluate(u"var fired = 0; setTimeout(function() { fired++; }); setTimeout(function() { fired++; });");
+  auto &timers = kraken::test::scheduledTimers();
+  ASSERT_EQ(timers.size(), 2);
+  EXPECT_NE(kraken::getBridgeCallbackContext(contextId, timers[0].callbackContext), nullptr);
+  timers[0].callback(timers[0].callbackContext, timers[0].contextId, nullptr);
+  // Fired already.
+  timers[0].callback(timers[0].callbackContext, timers[0].contextId, nullptr);
+  EXPECT_EQ(kraken::binding::globalObject(context()).getProperty("fired", nullptr).toNumber(), 1);
+
+  disposeContext(contextId);
+  EXPECT_EQ(kraken::getBridgeCallbackContext(contextId, timers[1].callbackContext), nullptr);
+  timers[1].callback(timers[1].callbackContext, timers[1].contextId, nullptr);
+}
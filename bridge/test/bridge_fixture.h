@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_TEST_BRIDGE_FIXTURE_H
+#define KRAKENBRIDGE_TEST_BRIDGE_FIXTURE_H
+
+#include "bindings/script/script_value.h"
+#include "gtest/gtest.h"
+#include "test/dart_methods_stub.h"
+
+#if KRAKEN_JSC_ENGINE
+#include "bridge_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_qjs.h"
+#endif
+
+#include <string>
+
+namespace kraken::test {
+
+// A page context allocated from the pool, the way dart opens a page. Errors the page reports fail the test, tests
+// which expect some take them from reportedErrors().
+class BridgeFixture : public ::testing::Test {
+protected:
+  void SetUp() override {
+    initContextPoolWithStubs(1);
+    contextId = allocateNewContext();
+    bridge = static_cast<kraken::JSBridge *>(getJSContext(contextId));
+  }
+
+  void TearDown() override {
+    for (auto &error : reportedErrors()) {
+      ADD_FAILURE() << error;
+    }
+    disposeContext(contextId);
+  }
+
+  binding::ScriptContext *context() {
+    return bridge->getContext().get();
+  }
+
+  void evaluate(const std::u16string &code) {
+    bridge->evaluateScript(code, "vm://", 0);
+  }
+
+  int32_t contextId;
+  kraken::JSBridge *bridge;
+};
+
+} // namespace kraken::test
+
+#endif // KRAKENBRIDGE_TEST_BRIDGE_FIXTURE_H
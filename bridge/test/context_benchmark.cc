@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+// Startup and memory cost of a page context, built with whichever engine the bridge is built with so the numbers of
+// JavaScriptCore and QuickJS can be compared side by side.
+//
+//   kraken_context_benchmark [contexts]
+
+#include "include/kraken_bridge.h"
+#include "test/dart_methods_stub.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if KRAKEN_JSC_ENGINE
+constexpr const char *ENGINE_NAME = "jsc";
+#elif KRAKEN_QUICK_JS_ENGINE
+constexpr const char *ENGINE_NAME = "quickjs";
+#endif
+
+// Resident set size of the process in bytes, -1 when it can't be read.
+int64_t residentBytes() {
+#if defined(__APPLE__)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) !=
+      KERN_SUCCESS) {
+    return -1;
+  }
+  return static_cast<int64_t>(info.resident_size);
+#else
+  FILE *statm = fopen("/proc/self/statm", "r");
+  if (statm == nullptr) return -1;
+  long pages = 0, resident = 0;
+  int fields = fscanf(statm, "%ld %ld", &pages, &resident);
+  fclose(statm);
+  return fields == 2 ? static_cast<int64_t>(resident) * sysconf(_SC_PAGESIZE) : -1;
+#endif
+}
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  int contexts = argc > 1 ? atoi(argv[1]) : 32;
+  if (contexts <= 0 || contexts > 1024) {
+    fprintf(stderr, "usage: %s [contexts, 1 to 1024]\n", argv[0]);
+    return 1;
+  }
+
+  int64_t processStart = residentBytes();
+  auto start = std::chrono::steady_clock::now();
+  kraken::test::initContextPoolWithStubs(1);
+  double firstContextMs = elapsedMilliseconds(start);
+  // Spare contexts would be built ahead of allocateNewContext(), every context is built while it's measured instead.
+  setContextPoolPrewarmSize(0);
+
+  std::vector<int32_t> contextIds;
+  int64_t heapBytes = 0;
+  int64_t residentBefore = residentBytes();
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < contexts; i++) {
+    contextIds.emplace_back(allocateNewContext());
+  }
+  double createMs = elapsedMilliseconds(start);
+  int64_t residentAfter = residentBytes();
+
+  for (int32_t contextId : contextIds) {
+    ContextMemoryStats stats{};
+    if (getContextMemoryStats(contextId, &stats) == 0 || stats.jsHeapSize < 0) {
+      heapBytes = -1;
+      break;
+    }
+    heapBytes += stats.jsHeapSize;
+  }
+
+  start = std::chrono::steady_clock::now();
+  for (int32_t contextId : contextIds) {
+    disposeContext(contextId);
+  }
+  double disposeMs = elapsedMilliseconds(start);
+
+  // A spare context is built by flushBridgeTask() ahead of the allocation which hands it out.
+  setContextPoolPrewarmSize(1);
+  double prewarmedMs = 0;
+  for (int i = 0; i < contexts; i++) {
+    flushBridgeTask();
+    start = std::chrono::steady_clock::now();
+    int32_t contextId = allocateNewContext();
+    prewarmedMs += elapsedMilliseconds(start);
+    disposeContext(contextId);
+  }
+  setContextPoolPrewarmSize(0);
+
+  printf("engine:                      %s\n", ENGINE_NAME);
+  printf("contexts:                    %d\n", contexts);
+  printf("first context (pool init):   %.3f ms\n", firstContextMs);
+  printf("create per context:          %.3f ms\n", createMs / contexts);
+  printf("dispose per context:         %.3f ms\n", disposeMs / contexts);
+  printf("pre-warmed create:           %.3f ms\n", prewarmedMs / contexts);
+  printf("resident after pool init:    %.1f KB\n", (residentBefore - processStart) / 1024.0);
+  printf("resident per context:        %.1f KB\n", (residentAfter - residentBefore) / 1024.0 / contexts);
+  if (heapBytes >= 0) {
+    printf("js heap per context:         %.1f KB\n", heapBytes / 1024.0 / contexts);
+  } else {
+    printf("js heap per context:         n/a\n");
+  }
+  return 0;
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "bindings/script/script_value.h"
+#include "foundation/trace_event.h"
+#include "foundation/ui_command_queue.h"
+#include "gtest/gtest.h"
+#include "include/kraken_bridge.h"
+#include "test/dart_methods_stub.h"
+
+#if KRAKEN_JSC_ENGINE
+#include "bridge_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_qjs.h"
+#endif
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using foundation::Tracing;
+
+namespace {
+
+// Bridges built while tracing was enabled.
+size_t countBridgeConstructions() {
+  std::string json = Tracing::toJSON();
+  std::string span = "\"name\":\"createBridge\",\"cat\":\"bridge\"";
+  size_t count = 0;
+  for (size_t pos = json.find(span); pos != std::string::npos; pos = json.find(span, pos + span.size())) {
+    count++;
+  }
+  return count;
+}
+
+class ContextPoolTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    kraken::test::initContextPoolWithStubs(2);
+  }
+
+  void TearDown() override {
+    Tracing::setEnabled(false);
+    Tracing::clear();
+    setContextPoolPrewarmSize(0);
+  }
+};
+
+} // namespace
+
+TEST_F(ContextPoolTest, growsWhenEverySlotIsTaken) {
+  std::vector<int32_t> contextIds{0};
+  for (int i = 0; i < 4; i++) {
+    contextIds.emplace_back(allocateNewContext());
+  }
+  for (size_t i = 0; i < contextIds.size(); i++) {
+    EXPECT_TRUE(checkContext(contextIds[i]));
+    for (size_t j = 0; j < i; j++) {
+      EXPECT_NE(getJSContext(contextIds[i]), getJSContext(contextIds[j]));
+    }
+  }
+}
+
+TEST_F(ContextPoolTest, recyclesSlotsWithNewIds) {
+  int32_t contextId = allocateNewContext();
+  disposeContext(contextId);
+  EXPECT_FALSE(checkContext(contextId));
+
+  int32_t recycledId = allocateNewContext();
+  EXPECT_NE(recycledId, contextId);
+  // The slot is reused, only the generation tag differs.
+  EXPECT_EQ(recycledId & 0xffff, contextId & 0xffff);
+  EXPECT_TRUE(checkContext(recycledId));
+}
+
+TEST_F(ContextPoolTest, rejectsStaleIds) {
+  int32_t contextId = allocateNewContext();
+  disposeContext(contextId);
+  int32_t recycledId = allocateNewContext();
+  void *recycled = getJSContext(recycledId);
+
+  ContextMemoryStats stats;
+  EXPECT_EQ(getContextMemoryStats(contextId, &stats), 0);
+  EXPECT_FALSE(checkContext(contextId, recycled));
+  // Disposing a stale id again must not dispose the context which took over its slot.
+  disposeContext(contextId);
+  EXPECT_TRUE(checkContext(recycledId));
+  EXPECT_EQ(getJSContext(recycledId), recycled);
+}
+
+TEST_F(ContextPoolTest, reloadKeepsContextId) {
+  int32_t contextId = allocateNewContext();
+  void *bridge = getJSContext(contextId);
+  reloadJsContext(contextId);
+  EXPECT_TRUE(checkContext(contextId));
+  EXPECT_NE(getJSContext(contextId), bridge);
+}
+
+TEST_F(ContextPoolTest, recycledContextCarriesNoScriptState) {
+  int32_t pageA = allocateNewContext();
+  auto bridgeA = static_cast<kraken::JSBridge *>(getJSContext(pageA));
+  bridgeA->evaluateScript(u"globalThis.pageA = 1;", "vm://", 0);
+  EXPECT_TRUE(kraken::binding::globalObject(bridgeA->getContext().get()).hasProperty("pageA"));
+  disposeContext(pageA);
+
+  int32_t pageB = allocateNewContext();
+  ASSERT_EQ(pageB & 0xffff, pageA & 0xffff);
+  auto bridgeB = static_cast<kraken::JSBridge *>(getJSContext(pageB));
+  EXPECT_FALSE(kraken::binding::globalObject(bridgeB->getContext().get()).hasProperty("pageA"));
+}
+
+// Timings of cold and pre-warmed allocation are printed by kraken_context_benchmark.
+TEST_F(ContextPoolTest, prewarmedAllocationSkipsBridgeConstruction) {
+  Tracing::setEnabled(true);
+  setContextPoolPrewarmSize(1);
+  flushBridgeTask();
+
+  Tracing::clear();
+  int32_t prewarmedId = allocateNewContext();
+  EXPECT_TRUE(checkContext(prewarmedId));
+  EXPECT_EQ(countBridgeConstructions(), 0);
+  auto prewarmed = static_cast<kraken::JSBridge *>(getJSContext(prewarmedId));
+  EXPECT_FALSE(prewarmed->getContext()->isStandby());
+
+  // With the spare handed out, the next allocation builds its bridge.
+  int32_t coldId = allocateNewContext();
+  EXPECT_TRUE(checkContext(coldId));
+  EXPECT_EQ(countBridgeConstructions(), 1);
+}
+
+// Each thread stands for the isolate of a kraken view: it allocates, uses and disposes contexts of its own while it
+// checks the ids of the other views, which are disposed and recycled under it.
+TEST_F(ContextPoolTest, concurrentLifecycleFromManyThreads) {
+  constexpr int threadCount = 8;
+  constexpr int rounds = 40;
+  std::vector<std::atomic<int32_t>> publishedIds(threadCount);
+  for (auto &id : publishedIds) {
+    id = -1;
+  }
+  std::atomic<int> registered{0};
+  std::atomic<int> failures{0};
+  std::u16string source = u"var div = document.createElement('div'); document.body.appendChild(div);";
+  NativeString code{reinterpret_cast<const uint16_t *>(source.c_str()), static_cast<int32_t>(source.size())};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; t++) {
+    threads.emplace_back([&, t]() {
+      kraken::test::registerDartMethodStubs();
+      registered++;
+      while (registered < threadCount) {
+        std::this_thread::yield();
+      }
+
+      for (int round = 0; round < rounds; round++) {
+        int32_t contextId = allocateNewContext();
+        if (contextId == -1 || !checkContext(contextId)) {
+          failures++;
+          continue;
+        }
+        evaluateScripts(contextId, &code, "vm://", 0);
+        auto bridge = static_cast<kraken::JSBridge *>(getJSContext(contextId));
+        if (!checkContext(contextId, bridge->getContext().get())) failures++;
+        publishedIds[t] = contextId;
+
+        for (auto &otherId : publishedIds) {
+          // The owner may dispose it at any time, the check must neither crash nor resolve a recycled slot to it.
+          checkContext(otherId);
+          checkContext(otherId, bridge->getContext().get());
+        }
+
+        disposeContext(contextId);
+        // The published id is stale from now on.
+        if (checkContext(contextId)) failures++;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(failures, 0);
+  for (auto &id : publishedIds) {
+    EXPECT_FALSE(checkContext(id));
+  }
+  // Every slot is free again, except the one of the context built by initJSContextPool().
+  std::vector<int32_t> contextIds;
+  for (int i = 0; i < threadCount; i++) {
+    contextIds.emplace_back(allocateNewContext());
+    EXPECT_TRUE(checkContext(contextIds.back()));
+  }
+  for (int32_t contextId : contextIds) {
+    disposeContext(contextId);
+  }
+}
+
+TEST_F(ContextPoolTest, activatedStandbyReplaysWarmUpCommands) {
+  int32_t contextId = allocateNewContext();
+  ASSERT_NE(contextId, -1);
+  auto liveQueue = foundation::UICommandTaskMessageQueue::instance(contextId);
+
+  // The standby twin shares the contextId of the running page, like the ones built for reloadJsContext().
+  auto standby = new kraken::JSBridge(contextId, [](int32_t contextId, const char *errmsg) {}, true);
+  auto standbyQueue = standby->getContext()->getUICommandQueue();
+  EXPECT_NE(standbyQueue, liveQueue);
+  std::u16string tagName = u"div";
+  NativeString args{reinterpret_cast<const uint16_t *>(tagName.c_str()), static_cast<int32_t>(tagName.size())};
+  standbyQueue->registerCommand(1, UICommand::createElement, args, nullptr);
+  EXPECT_EQ(standbyQueue->size(), 1);
+  EXPECT_EQ(liveQueue->size(), 0);
+  EXPECT_TRUE(kraken::test::batchUpdateRequests().empty());
+
+  // The running page's commands go first, the warm-up's follow them once the context is handed out.
+  liveQueue->registerCommand(2, UICommand::removeNode, nullptr);
+  standby->activate();
+  EXPECT_EQ(standby->getContext()->getUICommandQueue(), liveQueue);
+  ASSERT_EQ(liveQueue->size(), 2);
+  EXPECT_EQ(liveQueue->data()[0].id, 2);
+  auto replayed = liveQueue->data()[1];
+  EXPECT_EQ(replayed.id, 1);
+  EXPECT_EQ(replayed.type, UICommand::createElement);
+  ASSERT_EQ(replayed.args_01_length, 3);
+  EXPECT_EQ(std::u16string(reinterpret_cast<const char16_t *>(replayed.string_01), replayed.args_01_length), u"div");
+  EXPECT_EQ(kraken::test::batchUpdateRequests(), std::vector<int32_t>{contextId});
+  liveQueue->clear();
+
+  // Commands after the activation are the page's own.
+  standby->getContext()->getUICommandQueue()->registerCommand(3, UICommand::createElement, nullptr);
+  EXPECT_EQ(liveQueue->size(), 1);
+  liveQueue->clear();
+  delete standby;
+}
+
+TEST_F(ContextPoolTest, disposedStandbyLeavesNoCommands) {
+  int32_t contextId = allocateNewContext();
+  auto liveQueue = foundation::UICommandTaskMessageQueue::instance(contextId);
+  auto standby = new kraken::JSBridge(contextId, [](int32_t contextId, const char *errmsg) {}, true);
+  standby->getContext()->getUICommandQueue()->registerCommand(1, UICommand::createElement, nullptr);
+
+  // Finalizers of a twin which is never activated dispose their targets into the standby queue.
+  delete standby;
+  EXPECT_EQ(liveQueue->size(), 0);
+  EXPECT_TRUE(kraken::test::batchUpdateRequests().empty());
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "foundation/instance_tracker.h"
+#include "foundation/logging.h"
+#include "include/kraken_bridge_test.h"
+
+// Built into kraken_test for the integration tests and into kraken_unit_test, which can't link the former as it
+// brings its own copy of the bridge.
+int32_t countContextSurvivors(int32_t contextId) {
+#if KRAKEN_TRACK_INSTANCES
+  auto survivors = foundation::InstanceTracker::survivors(contextId);
+  if (!survivors.empty()) {
+    KRAKEN_LOG(ERROR) << survivors.size() << " instances of context " << contextId << " survived:\n"
+                      << foundation::InstanceTracker::describe(survivors);
+  }
+  return static_cast<int32_t>(survivors.size());
+#else
+  return -1;
+#endif
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "foundation/instance_tracker.h"
+#include "gtest/gtest.h"
+#include "include/kraken_bridge_test.h"
+#include "test/dart_methods_stub.h"
+
+#if KRAKEN_JSC_ENGINE
+#include "bridge_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_qjs.h"
+#endif
+
+TEST(ContextSurvivors, disposedContextLeavesNothingBehind) {
+  kraken::test::initContextPoolWithStubs(1);
+  int32_t contextId = allocateNewContext();
+  auto bridge = static_cast<kraken::JSBridge *>(getJSContext(contextId));
+  bridge->evaluateScript(u"setTimeout(function() {}, 1000);"
+                         u"setInterval(function() {}, 1000);"
+                         u"__kraken_module_listener__(function() {});",
+                         "vm://", 0);
+  bridge->evaluateScript(u"var div = document.createElement('div');"
+                         u"div.addEventListener('click', function() {});"
+                         u"div.onclick = function() {};"
+                         u"div.appendChild(document.createTextNode('kraken'));"
+                         u"document.body.appendChild(div);"
+                         u"var detached = document.createElement('span');"
+                         u"var blob = new Blob(['kraken']);",
+                         "vm://", 0);
+
+#if KRAKEN_TRACK_INSTANCES
+  // Timers hold bridge callbacks at least, countContextSurvivors() would log them all as leaks.
+  EXPECT_FALSE(foundation::InstanceTracker::survivors(contextId).empty());
+  disposeContext(contextId);
+  EXPECT_EQ(countContextSurvivors(contextId), 0);
+#else
+  disposeContext(contextId);
+  EXPECT_EQ(countContextSurvivors(contextId), -1);
+#endif
+}
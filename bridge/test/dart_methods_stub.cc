@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "dart_methods_stub.h"
+#include "dart_methods.h"
+#include "include/kraken_bridge.h"
+#include <mutex>
+
+namespace kraken::test {
+
+namespace {
+
+std::mutex stubsMutex;
+std::vector<int32_t> requests;
+std::vector<Timer> timers;
+std::vector<std::string> errors;
+
+void requestBatchUpdate(int32_t contextId) {
+  std::lock_guard<std::mutex> guard(stubsMutex);
+  requests.emplace_back(contextId);
+}
+
+void initNativePointer(int32_t contextId, void *nativePtr) {}
+
+// Timers only fire when a test calls them, their callbacks stay registered until then or the context is disposed.
+int32_t setTimer(void *callbackContext, int32_t contextId, AsyncCallback callback, int32_t timeout) {
+  std::lock_guard<std::mutex> guard(stubsMutex);
+  timers.emplace_back(Timer{callbackContext, contextId, callback});
+  return static_cast<int32_t>(timers.size());
+}
+
+void clearTimeout(int32_t contextId, int32_t timerId) {}
+
+void onJsError(int32_t contextId, const char *errmsg) {
+  std::lock_guard<std::mutex> guard(stubsMutex);
+  errors.emplace_back(errmsg);
+}
+
+} // namespace
+
+void registerDartMethodStubs() {
+  // Same order as registerDartMethods() reads them, methods not called without an app are left empty.
+  uint64_t methods[18] = {0};
+  methods[1] = reinterpret_cast<uint64_t>(requestBatchUpdate);
+  methods[3] = reinterpret_cast<uint64_t>(setTimer);
+  methods[4] = reinterpret_cast<uint64_t>(setTimer);
+  methods[5] = reinterpret_cast<uint64_t>(clearTimeout);
+  methods[13] = reinterpret_cast<uint64_t>(initNativePointer);
+  methods[14] = reinterpret_cast<uint64_t>(initNativePointer);
+  methods[15] = reinterpret_cast<uint64_t>(initNativePointer);
+  methods[17] = reinterpret_cast<uint64_t>(onJsError);
+  std::lock_guard<std::mutex> guard(stubsMutex);
+  registerDartMethods(methods, 18);
+}
+
+void initContextPoolWithStubs(int poolSize) {
+  registerDartMethodStubs();
+  initJSContextPool(poolSize);
+  requests.clear();
+  timers.clear();
+  errors.clear();
+}
+
+std::vector<int32_t> &batchUpdateRequests() {
+  return requests;
+}
+
+std::vector<Timer> &scheduledTimers() {
+  return timers;
+}
+
+std::vector<std::string> &reportedErrors() {
+  return errors;
+}
+
+} // namespace kraken::test
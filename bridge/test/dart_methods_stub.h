@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#ifndef KRAKENBRIDGE_TEST_DART_METHODS_STUB_H
+#define KRAKENBRIDGE_TEST_DART_METHODS_STUB_H
+
+#include "dart_methods.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace kraken::test {
+
+// Register the dart methods the bridge calls without a flutter app and (re)initialize the context pool. Dart methods
+// are only returned to the thread which initialized the pool, so fixtures call this in SetUp().
+void initContextPoolWithStubs(int poolSize);
+// Register the dart methods from another thread, which then allocates contexts like the isolate of a kraken view.
+void registerDartMethodStubs();
+
+// Context ids passed to requestBatchUpdate since the last initContextPoolWithStubs().
+std::vector<int32_t> &batchUpdateRequests();
+
+// Timers scheduled since the last initContextPoolWithStubs(), fire one by calling its callback the way dart does.
+struct Timer {
+  void *callbackContext;
+  int32_t contextId;
+  AsyncCallback callback;
+};
+std::vector<Timer> &scheduledTimers();
+
+// Errors contexts of the pool reported to dart since the last initContextPoolWithStubs().
+std::vector<std::string> &reportedErrors();
+
+} // namespace kraken::test
+
+#endif // KRAKENBRIDGE_TEST_DART_METHODS_STUB_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "gtest/gtest.h"
+#include "include/kraken_bridge.h"
+#include "test/dart_methods_stub.h"
+
+#if KRAKEN_JSC_ENGINE
+#include "bridge_jsc.h"
+#elif KRAKEN_QUICK_JS_ENGINE
+#include "bridge_qjs.h"
+#endif
+
+namespace {
+
+class ContextMemoryStatsTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    kraken::test::initContextPoolWithStubs(1);
+  }
+
+  static void evaluate(int32_t contextId, const std::u16string &code) {
+    static_cast<kraken::JSBridge *>(getJSContext(contextId))->evaluateScript(code, "vm://", 0);
+  }
+
+  static ContextMemoryStats stats(int32_t contextId) {
+    ContextMemoryStats stats{};
+    EXPECT_EQ(getContextMemoryStats(contextId, &stats), 1);
+    return stats;
+  }
+};
+
+} // namespace
+
+TEST_F(ContextMemoryStatsTest, reportsTheHeapOfTheContext) {
+  ContextMemoryStats created = stats(allocateNewContext());
+#if KRAKEN_QUICK_JS_ENGINE || defined(IS_ANDROID)
+  EXPECT_GT(created.jsHeapSize, 0);
+  EXPECT_GE(created.jsHeapCapacity, created.jsHeapSize);
+#else
+  EXPECT_EQ(created.jsHeapSize, -1);
+  EXPECT_EQ(created.jsHeapCapacity, -1);
+#endif
+}
+
+TEST_F(ContextMemoryStatsTest, countersStartOverAfterDispose) {
+  int32_t contextId = allocateNewContext();
+  ContextMemoryStats created = stats(contextId);
+  EXPECT_EQ(created.bridgeCallbackCount, 0);
+
+  evaluate(contextId, u"setTimeout(function() {}, 1000); setTimeout(function() {}, 1000);");
+  evaluate(contextId, u"var div = document.createElement('div');");
+  ContextMemoryStats used = stats(contextId);
+  EXPECT_EQ(used.bridgeCallbackCount, created.bridgeCallbackCount + 2);
+  EXPECT_EQ(used.eventTargetCount, created.eventTargetCount + 1);
+  EXPECT_EQ(used.nodeCount, created.nodeCount + 1);
+  EXPECT_GT(used.pendingUICommandBytes, created.pendingUICommandBytes);
+
+  disposeContext(contextId);
+  ContextMemoryStats disposed{};
+  EXPECT_EQ(getContextMemoryStats(contextId, &disposed), 0);
+
+  // The next context takes over the slot, nothing of the disposed one is counted for it.
+  int32_t recycledId = allocateNewContext();
+  ASSERT_EQ(recycledId & 0xffff, contextId & 0xffff);
+  ContextMemoryStats recycled = stats(recycledId);
+  EXPECT_EQ(recycled.bridgeCallbackCount, created.bridgeCallbackCount);
+  EXPECT_EQ(recycled.eventTargetCount, created.eventTargetCount);
+  EXPECT_EQ(recycled.nodeCount, created.nodeCount);
+  EXPECT_EQ(recycled.pendingUICommandBytes, created.pendingUICommandBytes);
+  EXPECT_EQ(recycled.blobBytes, created.blobBytes);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "test/bridge_fixture.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+NativeString toNativeString(const std::u16string &string) {
+  return NativeString{reinterpret_cast<const uint16_t *>(string.c_str()), static_cast<int32_t>(string.size())};
+}
+
+class ModuleEventTest : public kraken::test::BridgeFixture {
+protected:
+  void dispatch(const std::u16string &module) {
+    std::u16string extra = u"{}";
+    NativeString moduleName = toNativeString(module);
+    NativeString extraData = toNativeString(extra);
+    bridge->invokeModuleEvent(&moduleName, nullptr, nullptr, &extraData);
+  }
+
+  std::string calls() {
+    return kraken::binding::globalObject(context()).getProperty("calls", nullptr).toString();
+  }
+};
+
+} // namespace
+
+TEST_F(ModuleEventTest, throwingListenerDoesNotStopTheOthers) {
+  evaluate(u"var calls = [];"
+           u"__kraken_module_listener__('Geolocation', function() { calls.push('first'); throw new Error('oops'); });"
+           u"__kraken_module_listener__('Geolocation', function() { calls.push('second'); });"
+           u"__kraken_module_listener__(function(name) { calls.push('all:' + name); });");
+  dispatch(u"Geolocation");
+  EXPECT_EQ(calls(), "first,second,all:Geolocation");
+  auto &errors = kraken::test::reportedErrors();
+  ASSERT_EQ(errors.size(), 1);
+  EXPECT_NE(errors[0].find("oops"), std::string::npos);
+  errors.clear();
+}
+
+TEST_F(ModuleEventTest, listenersSubscribedWhileDispatchingWaitForTheNextEvent) {
+  evaluate(u"var calls = [];"
+           u"__kraken_module_listener__('Geolocation', function() {"
+           u"  calls.push('outer');"
+           u"  __kraken_module_listener__('Geolocation', function() { calls.push('inner'); });"
+           u"});");
+  dispatch(u"Geolocation");
+  EXPECT_EQ(calls(), "outer");
+  dispatch(u"Geolocation");
+  EXPECT_EQ(calls(), "outer,outer,inner");
+  dispatch(u"MethodChannel");
+  EXPECT_EQ(calls(), "outer,outer,inner");
+}
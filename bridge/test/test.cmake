@@ -2,6 +2,7 @@ list(APPEND KRAKEN_TEST_SOURCE
         include/kraken_bridge_test.h
         kraken_bridge_test.cc
         polyfill/dist/testframework.cc
+        test/context_survivors.cc
         )
 
 if ($ENV{KRAKEN_JS_ENGINE} MATCHES "jsc")
@@ -9,6 +10,11 @@ if ($ENV{KRAKEN_JS_ENGINE} MATCHES "jsc")
     bridge_test_jsc.cc
     bridge_test_jsc.h
   )
+elseif ($ENV{KRAKEN_JS_ENGINE} MATCHES "quickjs")
+  list(APPEND KRAKEN_TEST_SOURCE
+    bridge_test_qjs.cc
+    bridge_test_qjs.h
+  )
 endif()
 
 add_library(kraken_test SHARED ${KRAKEN_TEST_SOURCE})
@@ -21,6 +27,8 @@ target_include_directories(kraken_test PRIVATE
 
 if ($ENV{KRAKEN_JS_ENGINE} MATCHES "jsc")
   set_target_properties(kraken_test PROPERTIES OUTPUT_NAME kraken_test_jsc)
+elseif($ENV{KRAKEN_JS_ENGINE} MATCHES "quickjs")
+  set_target_properties(kraken_test PROPERTIES OUTPUT_NAME kraken_test_quickjs)
 elseif($ENV{KRAKEN_JS_ENGINE} MATCHES "v8")
   set_target_properties(kraken_test PROPERTIES OUTPUT_NAME kraken_test_v8)
 endif()
@@ -50,3 +58,42 @@ set(TEST_INCLUDE_DIR
         ./third_party/googletest/googlemock/include
         ${BRIDGE_INCLUDE}
         )
+
+### unit tests of the bindings, built against the engine the bridge is built with.
+enable_testing()
+list(APPEND KRAKEN_UNIT_TEST_SOURCE
+  bindings/script/script_value_test.cc
+  bindings/script/host_class_test.cc
+  bindings/script/KOM/console_test.cc
+  bindings/script/KOM/performance_observer_test.cc
+  bindings/script/KOM/performance_test.cc
+  foundation/async_logger_test.cc
+  foundation/cookie_jar_test.cc
+  foundation/idna_test.cc
+  foundation/monotonic_clock_test.cc
+  foundation/trace_event_test.cc
+  foundation/ui_command_queue_test.cc
+  foundation/ui_task_queue_test.cc
+  test/bridge_callback_test.cc
+  test/context_pool_test.cc
+  test/context_survivors_test.cc
+  test/memory_stats_test.cc
+  test/module_event_test.cc
+  test/trace_test.cc
+  test/context_survivors.cc
+  test/dart_methods_stub.cc
+  )
+if ($ENV{KRAKEN_JS_ENGINE} MATCHES "quickjs")
+  list(APPEND KRAKEN_UNIT_TEST_SOURCE
+    bindings/qjs/bytecode_test.cc
+    )
+endif()
+add_executable(kraken_unit_test ${KRAKEN_UNIT_TEST_SOURCE})
+target_include_directories(kraken_unit_test PRIVATE ${TEST_INCLUDE_DIR} ${CMAKE_CURRENT_SOURCE_DIR})
+target_link_libraries(kraken_unit_test kraken_static ${BRIDGE_LINK_LIBS} gtest gtest_main)
+add_test(NAME kraken_unit_test COMMAND kraken_unit_test)
+
+### startup and memory cost of a context, compared across engines by `npm run test:bridge`.
+add_executable(kraken_context_benchmark test/context_benchmark.cc test/dart_methods_stub.cc)
+target_include_directories(kraken_context_benchmark PRIVATE ${BRIDGE_INCLUDE} ${CMAKE_CURRENT_SOURCE_DIR})
+target_link_libraries(kraken_context_benchmark kraken_static ${BRIDGE_LINK_LIBS})
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+#include "foundation/trace_event.h"
+#include "test/bridge_fixture.h"
+
+#include <string>
+
+using foundation::Tracing;
+
+namespace {
+
+class TraceTest : public kraken::test::BridgeFixture {
+protected:
+  void SetUp() override {
+    BridgeFixture::SetUp();
+    Tracing::clear();
+    Tracing::setEnabled(true);
+  }
+
+  void TearDown() override {
+    // Leave tracing off for the other tests even if an expectation failed.
+    Tracing::setEnabled(false);
+    Tracing::clear();
+    BridgeFixture::TearDown();
+  }
+
+  // Spans are recorded when they end, read them after the traced code returned.
+  bool hasSpan(const std::string &category, const std::string &name) {
+    return Tracing::toJSON().find("\"name\":\"" + name + "\",\"cat\":\"" + category + "\"") != std::string::npos;
+  }
+};
+
+} // namespace
+
+TEST_F(TraceTest, evaluateScriptsSpans) {
+  evaluate(u"1 + 1;");
+  EXPECT_TRUE(hasSpan("bridge", "evaluateScripts"));
+}
+
+TEST_F(TraceTest, moduleEventSpans) {
+  std::u16string module = u"Geolocation";
+  std::u16string extra = u"{}";
+  NativeString moduleName{reinterpret_cast<const uint16_t *>(module.c_str()), static_cast<int32_t>(module.size())};
+  NativeString extraData{reinterpret_cast<const uint16_t *>(extra.c_str()), static_cast<int32_t>(extra.size())};
+  bridge->invokeModuleEvent(&moduleName, nullptr, nullptr, &extraData);
+  EXPECT_TRUE(hasSpan("module", "invokeModuleEvent"));
+}
+
+TEST_F(TraceTest, eventDispatchSpans) {
+  evaluate(u"var div = document.createElement('div');"
+           u"document.body.appendChild(div);"
+           u"div.addEventListener('click', function() {});");
+  Tracing::clear();
+  evaluate(u"div.dispatchEvent(new Event('click'));");
+  EXPECT_TRUE(hasSpan("event", "dispatchEvent"));
+}
+
+// Both engines collect when allocations cross a threshold, cycles make sure reference counting can't free them.
+TEST_F(TraceTest, collectionSpans) {
+  evaluate(u"for (var i = 0; i < 1000000; i++) { var a = {}; a.self = a; }");
+  EXPECT_TRUE(hasSpan("gc", "collect"));
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2019-present Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+import 'dart:async';
+import 'dart:typed_data';
+
+import 'package:kraken/dom.dart';
+import 'package:kraken/module.dart';
+
+// Connections to this host echo every message back, others go to the replaced WebSocket module.
+const String LOOPBACK_WEBSOCKET_HOST = 'websocket.loopback';
+
+class LoopbackWebSocketModule extends BaseModule {
+  @override
+  String get name => 'WebSocket';
+
+  static int _loopbackId = 0;
+
+  final ModuleCreator _delegateCreator;
+  BaseModule _delegate;
+  final Set<String> _loopbackClients = Set();
+
+  LoopbackWebSocketModule(ModuleManager moduleManager, this._delegateCreator) : super(moduleManager);
+
+  BaseModule get delegate {
+    if (_delegate == null) _delegate = _delegateCreator(moduleManager);
+    return _delegate;
+  }
+
+  void _emit(String id, Event event) {
+    // Loopback clients may be closed or disposed before the event been delivered.
+    if (!_loopbackClients.contains(id)) return;
+    moduleManager.emitModuleEvent(name, event: event, data: id);
+  }
+
+  @override
+  String invoke(String method, dynamic params, InvokeModuleCallback callback) {
+    if (method == 'init') {
+      if (Uri.parse(params).host != LOOPBACK_WEBSOCKET_HOST) {
+        return delegate.invoke(method, params, callback);
+      }
+      String id = 'loopback_${_loopbackId++}';
+      _loopbackClients.add(id);
+      scheduleMicrotask(() => _emit(id, Event(EVENT_OPEN)));
+      return id;
+    }
+
+    String id = params[0];
+    if (!_loopbackClients.contains(id)) {
+      return delegate.invoke(method, params, callback);
+    }
+
+    switch (method) {
+      case 'send':
+        dynamic message = params[1];
+        MessageEvent event = message is Uint8List ? MessageEvent('', bytes: message) : MessageEvent(message);
+        scheduleMicrotask(() => _emit(id, event));
+        break;
+      case 'burst':
+        // Emit a batch of message events back to back, used to measure the module event throughput.
+        int count = params[1];
+        String message = params[2];
+        scheduleMicrotask(() {
+          for (int i = 0; i < count; i++) {
+            _emit(id, MessageEvent(message));
+          }
+        });
+        break;
+      case 'close':
+        int code = params.length > 1 && params[1] != null ? params[1] : 1000;
+        String reason = params.length > 2 && params[2] != null ? params[2] : '';
+        scheduleMicrotask(() {
+          _emit(id, CloseEvent(code, reason, true));
+          _loopbackClients.remove(id);
+        });
+        break;
+    }
+    return '';
+  }
+
+  @override
+  void dispose() {
+    _loopbackClients.clear();
+    _delegate?.dispose();
+  }
+}
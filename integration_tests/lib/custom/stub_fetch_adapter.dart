@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2019-present Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+import 'dart:async';
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:dio/adapter.dart';
+import 'package:dio/dio.dart';
+
+import 'stub_xhr_adapter.dart';
+
+// Requests to this host are responded with fixed payloads, others go to the network.
+const String STUB_FETCH_HOST = 'fetch.stub';
+
+final Map<String, List<int>> _stubBodies = {
+  '/png': [137, 80, 78, 71, 13, 10, 26, 10, 0, 255],
+  '/text': utf8.encode('你好, kraken'),
+  '/json': utf8.encode('{"name":"kraken","version":1}'),
+  '/empty': [],
+};
+
+final Map<String, String> _stubContentTypes = {
+  '/png': 'image/png',
+  '/text': 'text/plain; charset=utf-8',
+  '/json': 'application/json',
+  '/empty': 'application/octet-stream',
+};
+
+class StubFetchAdapter extends HttpClientAdapter {
+  final DefaultHttpClientAdapter _defaultAdapter = DefaultHttpClientAdapter();
+  // Requests to the XMLHttpRequest stub host are served the same, so specs can share cookies between them.
+  final StubXHRAdapter _xhrAdapter = StubXHRAdapter();
+
+  @override
+  Future<ResponseBody> fetch(RequestOptions options, Stream<List<int>> requestStream, Future cancelFuture) async {
+    Uri uri = options.uri;
+    if (uri.host == STUB_XHR_HOST) {
+      return _xhrAdapter.fetch(options, requestStream, cancelFuture);
+    }
+    if (uri.host != STUB_FETCH_HOST) {
+      return _defaultAdapter.fetch(options, requestStream, cancelFuture);
+    }
+
+    if (!_stubBodies.containsKey(uri.path)) {
+      return ResponseBody.fromBytes(Uint8List(0), 404);
+    }
+
+    return ResponseBody.fromBytes(_stubBodies[uri.path], 200, headers: {
+      Headers.contentTypeHeader: [_stubContentTypes[uri.path]],
+    });
+  }
+
+  @override
+  void close({bool force = false}) {
+    _defaultAdapter.close(force: force);
+    _xhrAdapter.close(force: force);
+  }
+}
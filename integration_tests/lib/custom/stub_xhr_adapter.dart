@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2019-present Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+import 'dart:async';
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:dio/adapter.dart';
+import 'package:dio/dio.dart';
+
+// Requests to this host are responded by the stub transport, others go to the network.
+const String STUB_XHR_HOST = 'xhr.stub';
+
+// Size and count of chunks responded by /slow.
+const int _SLOW_CHUNK_SIZE = 1024;
+const int _SLOW_CHUNK_COUNT = 5;
+
+class StubXHRAdapter extends HttpClientAdapter {
+  final DefaultHttpClientAdapter _defaultAdapter = DefaultHttpClientAdapter();
+
+  @override
+  Future<ResponseBody> fetch(RequestOptions options, Stream<List<int>> requestStream, Future cancelFuture) async {
+    Uri uri = options.uri;
+    if (uri.host != STUB_XHR_HOST) {
+      return _defaultAdapter.fetch(options, requestStream, cancelFuture);
+    }
+
+    switch (uri.path) {
+      case '/text':
+        return _respond(utf8.encode('你好, kraken'), 'text/plain; charset=utf-8');
+      case '/json':
+        return _respond(utf8.encode('{"name":"kraken","version":1}'), 'application/json');
+      case '/bytes':
+        return _respond([0, 1, 2, 255], 'application/octet-stream');
+      case '/malformed':
+        return _respond([104, 105, 0xFF, 0xC3], 'text/plain');
+      case '/empty':
+        return _respond([], 'text/plain');
+      case '/headers':
+        return ResponseBody.fromBytes(Uint8List(0), 200, headers: {
+          'x-kraken': ['a', 'b'],
+          'X-Version': ['1'],
+          Headers.contentTypeHeader: ['text/plain'],
+        });
+      case '/echo':
+        // Respond the request body with the request method and content type in headers.
+        List<int> body = [];
+        if (requestStream != null) {
+          await for (List<int> chunk in requestStream) {
+            body.addAll(chunk);
+          }
+        }
+        return ResponseBody.fromBytes(body, 200, headers: {
+          Headers.contentTypeHeader: ['application/octet-stream'],
+          'x-request-method': [options.method],
+          'x-request-content-type': [options.contentType?.toString() ?? ''],
+        });
+      case '/cookie':
+        // Respond the Cookie header of request, and set cookies of every `set` query parameter.
+        String cookie = options.headers.entries
+            .firstWhere((entry) => entry.key.toLowerCase() == 'cookie', orElse: () => MapEntry('cookie', ''))
+            .value
+            .toString();
+        return ResponseBody.fromBytes(utf8.encode(cookie), 200, headers: {
+          Headers.contentTypeHeader: ['text/plain'],
+          'set-cookie': uri.queryParametersAll['set'] ?? [],
+        });
+      case '/slow':
+        return ResponseBody(_slowStream(), 200, headers: {
+          Headers.contentLengthHeader: ['${_SLOW_CHUNK_SIZE * _SLOW_CHUNK_COUNT}'],
+          Headers.contentTypeHeader: ['application/octet-stream'],
+        });
+      case '/hang':
+        // Headers are responded but the body never ends, the request could only be aborted or timeout.
+        StreamController<Uint8List> controller = StreamController();
+        controller.onCancel = () => controller.close();
+        return ResponseBody(controller.stream, 200, headers: {
+          Headers.contentTypeHeader: ['text/plain'],
+        });
+    }
+
+    if (uri.path.startsWith('/status/')) {
+      int status = int.parse(uri.path.substring('/status/'.length));
+      return ResponseBody.fromBytes(utf8.encode('$status'), status, statusMessage: 'Stub Status');
+    }
+
+    return ResponseBody.fromBytes(Uint8List(0), 404, statusMessage: 'Not Found');
+  }
+
+  ResponseBody _respond(List<int> body, String contentType) {
+    return ResponseBody.fromBytes(body, 200, statusMessage: 'OK', headers: {
+      Headers.contentTypeHeader: [contentType],
+      Headers.contentLengthHeader: ['${body.length}'],
+    });
+  }
+
+  Stream<Uint8List> _slowStream() async* {
+    for (int i = 0; i < _SLOW_CHUNK_COUNT; i++) {
+      await Future.delayed(Duration(milliseconds: 60));
+      yield Uint8List(_SLOW_CHUNK_SIZE)..fillRange(0, _SLOW_CHUNK_SIZE, i);
+    }
+  }
+
+  @override
+  void close({bool force = false}) {
+    _defaultAdapter.close(force: force);
+  }
+}
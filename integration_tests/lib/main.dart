@@ -11,6 +11,9 @@ import 'package:path/path.dart' as path;
 import 'bridge/from_native.dart';
 import 'bridge/to_native.dart';
 import 'custom/custom_object_element.dart';
+import 'custom/stub_fetch_adapter.dart';
+import 'custom/stub_xhr_adapter.dart';
+import 'custom/loopback_websocket_module.dart';
 import 'package:kraken/gesture.dart';
 import 'package:kraken_websocket/kraken_websocket.dart';
 import 'package:kraken_animation_player/kraken_animation_player.dart';
@@ -53,12 +56,15 @@ class NativeGestureClient implements GestureClient {
 // By CLI: `KRAKEN_ENABLE_TEST=true flutter run`
 void main() async {
   KrakenWebsocket.initialize();
+  ModuleManager.debugOverrideModule('WebSocket', (moduleManager, originalCreator) => LoopbackWebSocketModule(moduleManager, originalCreator));
   KrakenAnimationPlayer.initialize();
   KrakenVideoPlayer.initialize();
   KrakenWebView.initialize();
   // Set render font family AlibabaPuHuiTi to resolve rendering difference.
   CSSText.DEFAULT_FONT_FAMILY_FALLBACK = ['AlibabaPuHuiTi'];
   setObjectElementFactory(customObjectElementFactory);
+  FetchModule.debugHttpClientAdapter = StubFetchAdapter();
+  XMLHttpRequestModule.debugHttpClientAdapter = StubXHRAdapter();
 
   List<FileSystemEntity> specs = specsDirectory.listSync(recursive: true);
   List<Map<String, String>> mainTestPayload = [];
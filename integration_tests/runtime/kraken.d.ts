@@ -6,6 +6,7 @@ interface MethodChannel {
 
 interface Kraken {
     methodChannel: MethodChannel;
+    invokeModule(module: string, method: string, params?: any, fn?: ((err: Error, data: any) => void) | null, bytes?: ArrayBuffer | ArrayBufferView | Blob): string;
 }
 
 declare const kraken: Kraken;
@@ -35,6 +36,9 @@ type SimulatePointer = (list: [number, number, number][]) => void;
 type SimulateKeyPress = (chars: string) => void;
 declare const simulatePointer: SimulatePointer;
 declare const simulateKeyPress: SimulateKeyPress;
+// Native formatting of console.log() and console.dir() arguments.
+declare function __kraken_format_log__(...args: any[]): string;
+declare function __kraken_format_dir__(...args: any[]): string;
 
 interface Navigator {
   connection: {
@@ -43,6 +47,21 @@ interface Navigator {
   getDeviceInfo(): DeviceInfo;
 }
 
+interface Performance {
+  // Keep at most maxSize marks and measures, the oldest entries are dropped first.
+  setEntryBufferSize(maxSize: number): void;
+  // Objects and bytes held natively by this page, the JS heap sizes are -1 when the engine doesn't report them.
+  readonly memory: {
+    usedJSHeapSize: number;
+    totalJSHeapSize: number;
+    eventTargetCount: number;
+    nodeCount: number;
+    pendingUICommandBytes: number;
+    blobBytes: number;
+    bridgeCallbackCount: number;
+  };
+}
+
 interface HTMLDivElement {
     toBlob(devicePixelRatio: number): Promise<Blob>;
 }
@@ -0,0 +1,203 @@
+describe('Console format', () => {
+  // The JavaScript formatter which the polyfill used before formatting moved to native, kept to check the native
+  // output stays the same.
+  const INTERPOLATE = /%[sdifoO]/;
+  const INDENT = '  ';
+
+  function legacyFormatter(obj: any, limit: number, stack: Array<any>): string {
+    var type = typeof obj;
+    switch (type) {
+      case 'string':
+        return `'${obj}'`;
+      case 'function':
+        break;
+      case 'object':
+        if (obj === null) {
+          return 'null';
+        }
+        break;
+      default:
+        return '' + obj;
+    }
+
+    var kind = Object.prototype.toString.call(obj).slice(8, -1);
+    var prefix = kind == 'Object' ? '' : kind + ' ';
+    if (!limit) {
+      return prefix + '{...}';
+    }
+    var stackLength = stack.length;
+    for (var s = 0; s < stackLength; s++) {
+      if (stack[s] === obj) {
+        return '#';
+      }
+    }
+    stack[stackLength++] = obj;
+    var indent = INDENT.repeat(stackLength);
+    var keys = Object.getOwnPropertyNames(obj);
+
+    var result = prefix + '{';
+    if (!keys.length) {
+      return result + '}';
+    }
+
+    var items = [];
+    for (var n = 0; n < keys.length; n++) {
+      let key = keys[n];
+      var value = legacyFormatter(obj[key], limit - 1, [...stack]);
+      items.push('\n' + indent + key + ': ' + value);
+    }
+    return result + items.join(', ') + '\n' + INDENT.repeat(stackLength - 1) + '}';
+  }
+
+  function legacyInspect(obj: any, within?: boolean): string {
+    if (obj && obj.nodeType == 1) {
+      var result = '<' + obj.tagName.toLowerCase();
+      if (obj.childNodes && obj.childNodes.length === 0) {
+        result += '/';
+      }
+      return result + '>';
+    }
+
+    var kind = Object.prototype.toString.call(obj).slice(8, -1);
+    switch (kind) {
+      case 'Null':
+        return 'null';
+      case 'Undefined':
+        return 'undefined';
+      case 'String':
+        return within ? `'${obj}'` : obj;
+      case 'Function':
+        return 'ƒ ()';
+      case 'Number':
+      case 'Boolean':
+      case 'Date':
+      case 'RegExp':
+        return obj.toString();
+      case 'Array':
+        return '[' + obj.map((item: any) => legacyInspect(item, true)).join(', ') + ']';
+      default:
+        if (typeof obj === 'object') {
+          if (kind == 'Map') {
+            var entries = Array.from(obj.entries()).map((item: any) => item[0] + ' => ' + legacyInspect(item[1], true));
+            return 'Map {' + entries.join(', ') + '}';
+          } else if (kind == 'Set') {
+            return 'Set { ' + Array.from(obj).map((item: any) => legacyInspect(item, true)).join(', ') + '}';
+          }
+          var prefix = kind == 'Object' ? '' : kind + ' ';
+          if (within) {
+            return prefix + '{...}';
+          }
+          var keys = Object.getOwnPropertyNames(obj).sort();
+          if (!keys.length) {
+            return prefix + '{}';
+          }
+          var properties = [];
+          for (var n = 0; n < keys.length; n++) {
+            properties.push(keys[n] + ': ' + legacyInspect(obj[keys[n]], true));
+          }
+          return prefix + '{' + properties.join(', ') + '}';
+        }
+        return '' + obj;
+    }
+  }
+
+  function legacyLogger(...args: any[]) {
+    var firstArg = args[0];
+    var result = [];
+    if (typeof firstArg === 'string' && INTERPOLATE.test(firstArg)) {
+      args.shift();
+      result.push(firstArg.replace(/%[sdifoO]/g, function() {
+        return legacyInspect(args.shift());
+      }));
+    }
+    for (var i = 0; i < args.length; i++) {
+      result.push(legacyInspect(args[i]));
+    }
+    return result.join(' ');
+  }
+
+  function legacyDir(...args: any[]) {
+    return args.map(arg => legacyFormatter(arg, 3, [])).join(' ');
+  }
+
+  const div = document.createElement('div');
+  const parent = document.createElement('div');
+  parent.appendChild(document.createElement('span'));
+
+  const cyclic: any = { name: 'cyclic' };
+  cyclic.self = cyclic;
+
+  const logCases: any[][] = [
+    ['hello'],
+    [1, 1.5, -0, NaN, Infinity],
+    [true, null, undefined],
+    ['a', 'b', 3],
+    [[1, 'a', [2, [3, 'b']]]],
+    [{ b: 1, a: 'x', c: { d: 1 }, e: [1, 2] }],
+    [{}],
+    [[]],
+    [new Map<any, any>([['k', 1], ['j', { a: 1 }]])],
+    [new Set<any>([1, 'a', [2]])],
+    [function named() {}, () => 1],
+    [new Date(0), /a+b/g],
+    [new Number(1), new Boolean(false), [new String('s')]],
+    [div, parent, [div]],
+    [cyclic],
+    ['a %s b', 'x'],
+    ['%s and %o', 'str', { a: 1 }, 'rest'],
+    ['%d items', 42],
+    ['%O', [1, 2]],
+    ['no specifier %', 1],
+  ];
+
+  logCases.forEach((args, i) => {
+    it(`log matches the JavaScript formatter ${i}`, () => {
+      expect(__kraken_format_log__(...args)).toBe(legacyLogger(...args));
+    });
+  });
+
+  const dirCases: any[][] = [
+    ['str', 5, null, undefined],
+    [{ a: 1, b: { c: { d: { e: 1 } } } }],
+    [[1, 'two']],
+    [{}],
+    [cyclic],
+    [new Map(), new Set()],
+  ];
+
+  dirCases.forEach((args, i) => {
+    it(`dir matches the JavaScript formatter ${i}`, () => {
+      expect(__kraken_format_dir__(...args)).toBe(legacyDir(...args));
+    });
+  });
+
+  it('converts %d, %i and %f like parseInt and parseFloat', () => {
+    expect(__kraken_format_log__('%d %i %f', 1.5, '12px', '3.25em')).toBe('1 12 3.25');
+    expect(__kraken_format_log__('%d %f', 'abc', '-Infinity')).toBe('NaN -Infinity');
+  });
+
+  it('consumes %c without output', () => {
+    expect(__kraken_format_log__('%cred', 'color: red')).toBe('red');
+  });
+
+  it('keeps specifiers without an argument', () => {
+    expect(__kraken_format_log__('%s and %s', 'a')).toBe('a and %s');
+  });
+
+  it('marks cyclic arrays', () => {
+    const list: any[] = [1];
+    list.push(list);
+    expect(__kraken_format_log__(list)).toBe('[1, [Circular]]');
+  });
+
+  it('limits depth of nested arrays', () => {
+    expect(__kraken_format_log__([[[[[[[1]]]]]]])).toBe('[[[[[[[...]]]]]]]');
+  });
+
+  it('limits length of large arrays', () => {
+    const list = Array.from({ length: 150 }, (_, i) => i);
+    const output = __kraken_format_log__(list);
+    expect(output.startsWith('[0, 1, 2,')).toBe(true);
+    expect(output.endsWith('99, ... 50 more items]')).toBe(true);
+  });
+});
@@ -0,0 +1,141 @@
+describe('Cookie jar', () => {
+  function cookieNames() {
+    return document.cookie ? document.cookie.split('; ').map((pair) => pair.split('=')[0]) : [];
+  }
+
+  function clearCookies() {
+    document.cookie.split('; ').filter(Boolean).forEach((pair) => {
+      let index = pair.indexOf('=');
+      document.cookie = index < 0 ? `${pair}; Max-Age=0` : `${pair.slice(0, index)}=; Max-Age=0`;
+    });
+  }
+
+  beforeEach(clearCookies);
+  afterEach(clearCookies);
+
+  it('only the first name-value pair is used', () => {
+    document.cookie = ' a = 1 ; b=2';
+    expect(document.cookie).toBe('a=1');
+  });
+
+  it('cookie without name', () => {
+    document.cookie = 'novalue';
+    expect(document.cookie).toBe('novalue');
+    document.cookie = '=';
+    expect(document.cookie).toBe('novalue');
+  });
+
+  it('assignment replaces cookie with the same name', () => {
+    document.cookie = 'a=1';
+    document.cookie = 'b=2';
+    document.cookie = 'a=3';
+    expect(document.cookie).toBe('a=3; b=2');
+  });
+
+  it('Max-Age and Expires', () => {
+    document.cookie = 'a=1; Max-Age=100';
+    document.cookie = 'b=2; Expires=Thu, 01 Jan 1970 00:00:00 GMT';
+    // Max-Age takes precedence over Expires.
+    document.cookie = 'c=3; Expires=Thu, 01 Jan 1970 00:00:00 GMT; Max-Age=100';
+    // Malformed Max-Age is ignored.
+    document.cookie = 'd=4; Max-Age=1a';
+    expect(document.cookie).toBe('a=1; c=3; d=4');
+
+    document.cookie = 'a=; Max-Age=0';
+    document.cookie = 'c=; Max-Age=-1';
+    expect(document.cookie).toBe('d=4');
+  });
+
+  it('Path', () => {
+    document.cookie = 'a=1; Path=/foo';
+    document.cookie = 'b=2; Path=/';
+    // Relative path falls back to the default path.
+    document.cookie = 'c=3; Path=foo';
+    expect(cookieNames()).toEqual(['b', 'c']);
+    // Cookies out of the document path are not cleared by afterEach.
+    document.cookie = 'a=; Path=/foo; Max-Age=0';
+  });
+
+  it('Domain, Secure and HttpOnly which not allowed for document are ignored', () => {
+    document.cookie = 'a=1; Domain=example.com';
+    document.cookie = 'b=2; HttpOnly';
+    document.cookie = 'c=3; Secure';
+    document.cookie = 'd=4; SameSite=Lax; Unknown';
+    expect(document.cookie).toBe('d=4');
+  });
+
+});
+
+describe('Cookie jar with network', () => {
+  const STUB_URL = 'http://xhr.stub/cookie';
+
+  function request(query: string, withCredentials: boolean): Promise<XMLHttpRequest> {
+    return new Promise((resolve) => {
+      const xhr = new XMLHttpRequest();
+      xhr.open('GET', STUB_URL + query);
+      xhr.withCredentials = withCredentials;
+      xhr.onload = () => resolve(xhr);
+      xhr.send();
+    });
+  }
+
+  function set(cookie: string) {
+    return '?set=' + encodeURIComponent(cookie);
+  }
+
+  afterEach(async () => {
+    await request(set('a=; Max-Age=0') + '&set=' + encodeURIComponent('h=; Max-Age=0'), true);
+  });
+
+  it('XMLHttpRequest stores and sends cookies', async () => {
+    let xhr = await request(set('a=1') + '&set=' + encodeURIComponent('h=2; HttpOnly'), true);
+    expect(xhr.getResponseHeader('set-cookie')).toBe(null);
+    expect(xhr.getAllResponseHeaders().indexOf('set-cookie')).toBe(-1);
+
+    xhr = await request('', true);
+    expect(xhr.responseText).toBe('a=1; h=2');
+    // Cookies of other hosts are not visible to document.
+    expect(document.cookie.indexOf('a=1')).toBe(-1);
+  });
+
+  it('credentials are not included for cross origin requests by default', async () => {
+    await request(set('a=1'), false);
+    let xhr = await request('', true);
+    expect(xhr.responseText).toBe('');
+
+    await request(set('a=1'), true);
+    xhr = await request('', false);
+    expect(xhr.responseText).toBe('');
+  });
+
+  it('fetch shares cookies with XMLHttpRequest', async () => {
+    await fetch(STUB_URL + set('a=from-fetch'), { credentials: 'include' });
+    let xhr = await request('', true);
+    expect(xhr.responseText).toBe('a=from-fetch');
+
+    let response = await fetch(STUB_URL, { credentials: 'include' });
+    expect(await response.text()).toBe('a=from-fetch');
+    response = await fetch(STUB_URL, { credentials: 'omit' });
+    expect(await response.text()).toBe('');
+  });
+
+  it('page can neither read nor forge cookies of requests', async () => {
+    await request(set('h=2; HttpOnly'), true);
+    // @ts-ignore
+    expect(typeof __kraken_request_cookies__).toBe('undefined');
+    // @ts-ignore
+    expect(typeof __kraken_store_cookies__).toBe('undefined');
+
+    let response = await fetch(STUB_URL, { credentials: 'include', headers: { Cookie: 'forged=1' } });
+    expect(await response.text()).toBe('h=2');
+
+    let data: any[] = await new Promise((resolve) => {
+      let url = STUB_URL + set('b=3; HttpOnly');
+      kraken.invokeModule('Fetch', url, { credentials: 'include' }, (e, data) => resolve(data));
+    });
+    expect(data.length).toBe(4);
+    response = await fetch(STUB_URL, { credentials: 'include' });
+    expect(await response.text()).toBe('h=2; b=3');
+    await request(set('b=; Max-Age=0'), true);
+  });
+});
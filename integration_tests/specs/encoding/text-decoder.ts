@@ -0,0 +1,98 @@
+function bytes(...values: number[]) {
+  return new Uint8Array(values);
+}
+
+describe('TextDecoder', () => {
+  it('default encoding is utf-8', () => {
+    const decoder = new TextDecoder();
+    expect(decoder.encoding).toBe('utf-8');
+    expect(decoder.fatal).toBe(false);
+    expect(decoder.ignoreBOM).toBe(false);
+    expect(new TextDecoder(' UTF8 ').encoding).toBe('utf-8');
+    expect(new TextDecoder('utf-16').encoding).toBe('utf-16le');
+  });
+
+  it('invalid label throws RangeError', () => {
+    expect(() => new TextDecoder('latin2')).toThrowError(/RangeError/);
+  });
+
+  it('decode utf-8', () => {
+    const decoder = new TextDecoder();
+    expect(decoder.decode()).toBe('');
+    expect(decoder.decode(bytes(0x61, 0xc3, 0xa9, 0xe4, 0xb8, 0xad, 0xf0, 0x9f, 0x98, 0x80))).toBe('aé中😀');
+    expect(decoder.decode(bytes(0x61, 0x62).buffer)).toBe('ab');
+  });
+
+  it('malformed utf-8 sequences are replaced', () => {
+    const decoder = new TextDecoder();
+    // Truncated sequence.
+    expect(decoder.decode(bytes(0xe4, 0xb8))).toBe('�');
+    // Truncated sequence followed by ASCII, the ASCII byte is not consumed.
+    expect(decoder.decode(bytes(0xe4, 0x61))).toBe('�a');
+    // Overlong encoding.
+    expect(decoder.decode(bytes(0xc0, 0x80))).toBe('��');
+    expect(decoder.decode(bytes(0xe0, 0x80, 0x80))).toBe('���');
+    // Encoded surrogate.
+    expect(decoder.decode(bytes(0xed, 0xa0, 0x80))).toBe('���');
+    // Beyond U+10FFFF.
+    expect(decoder.decode(bytes(0xf4, 0x90, 0x80, 0x80))).toBe('����');
+    // Unexpected continuation byte.
+    expect(decoder.decode(bytes(0x80, 0x61))).toBe('�a');
+  });
+
+  it('fatal mode throws on malformed sequences', () => {
+    const decoder = new TextDecoder('utf-8', { fatal: true });
+    expect(decoder.fatal).toBe(true);
+    expect(() => decoder.decode(bytes(0xff))).toThrow();
+    expect(() => decoder.decode(bytes(0xe4, 0xb8))).toThrow();
+    // The decoder is usable after a failure.
+    expect(decoder.decode(bytes(0x61))).toBe('a');
+  });
+
+  it('stream keeps incomplete sequences', () => {
+    const decoder = new TextDecoder();
+    const emoji = bytes(0xf0, 0x9f, 0x98, 0x80);
+    let result = '';
+    for (let i = 0; i < emoji.length; i++) {
+      result += decoder.decode(emoji.subarray(i, i + 1), { stream: true });
+    }
+    result += decoder.decode();
+    expect(result).toBe('😀');
+
+    expect(decoder.decode(bytes(0xf0, 0x9f), { stream: true })).toBe('');
+    expect(decoder.decode()).toBe('�');
+  });
+
+  it('BOM is removed once at the beginning of stream', () => {
+    const decoder = new TextDecoder();
+    expect(decoder.decode(bytes(0xef, 0xbb), { stream: true })).toBe('');
+    expect(decoder.decode(bytes(0xbf, 0x61), { stream: true })).toBe('a');
+    expect(decoder.decode(bytes(0xef, 0xbb, 0xbf))).toBe('\ufeff');
+    expect(decoder.decode(bytes(0xef, 0xbb, 0xbf, 0x62))).toBe('b');
+
+    const keepBOM = new TextDecoder('utf-8', { ignoreBOM: true });
+    expect(keepBOM.decode(bytes(0xef, 0xbb, 0xbf, 0x62))).toBe('\ufeffb');
+  });
+
+  it('decode utf-16le', () => {
+    const decoder = new TextDecoder('utf-16le');
+    expect(decoder.decode(bytes(0xff, 0xfe, 0x61, 0x00, 0x3d, 0xd8, 0x00, 0xde))).toBe('a😀');
+    // Odd byte count.
+    expect(decoder.decode(bytes(0x61, 0x00, 0x62))).toBe('a�');
+    // Lone surrogates.
+    expect(decoder.decode(bytes(0x3d, 0xd8, 0x61, 0x00))).toBe('�a');
+    expect(decoder.decode(bytes(0x00, 0xde))).toBe('�');
+    expect(() => new TextDecoder('utf-16le', { fatal: true }).decode(bytes(0x00, 0xde))).toThrow();
+  });
+
+  it('decode utf-16le in stream', () => {
+    const decoder = new TextDecoder('utf-16le');
+    expect(decoder.decode(bytes(0x61), { stream: true })).toBe('');
+    expect(decoder.decode(bytes(0x00, 0x3d, 0xd8), { stream: true })).toBe('a');
+    expect(decoder.decode(bytes(0x00, 0xde))).toBe('😀');
+  });
+
+  it('rejects non buffer source', () => {
+    expect(() => new TextDecoder().decode('abc' as any)).toThrow();
+  });
+});
@@ -0,0 +1,39 @@
+describe('TextEncoder', () => {
+  it('encoding is utf-8', () => {
+    expect(new TextEncoder().encoding).toBe('utf-8');
+  });
+
+  it('encode', () => {
+    const encoder = new TextEncoder();
+    expect(Array.from(encoder.encode())).toEqual([]);
+    expect(Array.from(encoder.encode('abc'))).toEqual([0x61, 0x62, 0x63]);
+    expect(Array.from(encoder.encode('é中😀'))).toEqual([
+      0xc3, 0xa9, 0xe4, 0xb8, 0xad, 0xf0, 0x9f, 0x98, 0x80
+    ]);
+    expect(encoder.encode('abc') instanceof Uint8Array).toBe(true);
+  });
+
+  it('encode replaces lone surrogates', () => {
+    const encoder = new TextEncoder();
+    expect(Array.from(encoder.encode('a\ud800b'))).toEqual([0x61, 0xef, 0xbf, 0xbd, 0x62]);
+    expect(Array.from(encoder.encode('\udc00'))).toEqual([0xef, 0xbf, 0xbd]);
+  });
+
+  it('encodeInto stops before a code point which does not fit', () => {
+    const encoder = new TextEncoder();
+    const destination = new Uint8Array(5);
+    const result = encoder.encodeInto('ab😀', destination);
+    expect(result.read).toBe(2);
+    expect(result.written).toBe(2);
+
+    const large = new Uint8Array(6);
+    const another = encoder.encodeInto('ab😀', large);
+    expect(another.read).toBe(4);
+    expect(another.written).toBe(6);
+    expect(Array.from(large)).toEqual([0x61, 0x62, 0xf0, 0x9f, 0x98, 0x80]);
+  });
+
+  it('encodeInto requires Uint8Array', () => {
+    expect(() => new TextEncoder().encodeInto('a', new Int8Array(1) as any)).toThrow();
+  });
+});
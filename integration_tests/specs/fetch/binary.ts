@@ -0,0 +1,55 @@
+describe('fetch binary body', () => {
+  const STUB_URL = 'https://fetch.stub';
+
+  it('arrayBuffer keeps bytes as it is', async () => {
+    let response = await fetch(`${STUB_URL}/png`);
+    let buffer = await response.arrayBuffer();
+    expect(buffer instanceof ArrayBuffer).toBe(true);
+    expect(Array.from(new Uint8Array(buffer))).toEqual([137, 80, 78, 71, 13, 10, 26, 10, 0, 255]);
+    expect(response.bodyUsed).toBe(true);
+  });
+
+  it('blob carries bytes and content type', async () => {
+    let response = await fetch(`${STUB_URL}/png`);
+    let blob = await response.blob();
+    expect(blob.size).toBe(10);
+    expect(blob.type).toBe('image/png');
+    let buffer = await blob.arrayBuffer();
+    expect(new Uint8Array(buffer)[9]).toBe(255);
+  });
+
+  it('text decodes utf-8 bytes', async () => {
+    let response = await fetch(`${STUB_URL}/text`);
+    expect(await response.text()).toBe('你好, kraken');
+  });
+
+  it('json parses bytes', async () => {
+    let response = await fetch(`${STUB_URL}/json`);
+    let json = await response.json();
+    expect(json.name).toBe('kraken');
+    expect(json.version).toBe(1);
+  });
+
+  it('empty body', async () => {
+    let response = await fetch(`${STUB_URL}/empty`);
+    let buffer = await response.arrayBuffer();
+    expect(buffer.byteLength).toBe(0);
+  });
+
+  it('rejects reading body twice', async () => {
+    let response = await fetch(`${STUB_URL}/png`);
+    await response.arrayBuffer();
+    let error;
+    try {
+      await response.text();
+    } catch (e) {
+      error = e;
+    }
+    expect(error instanceof TypeError).toBe(true);
+  });
+
+  it('Response constructed with ArrayBuffer', async () => {
+    let response = new Response(new Uint8Array([104, 105]));
+    expect(await response.text()).toBe('hi');
+  });
+});
@@ -0,0 +1,73 @@
+describe('Performance entry buffer', () => {
+  afterEach(() => {
+    performance.clearMarks();
+    performance.clearMeasures();
+    performance.setEntryBufferSize(10000);
+  });
+
+  it('drops the oldest entries when full', () => {
+    performance.clearMarks();
+    performance.clearMeasures();
+    performance.setEntryBufferSize(3);
+    ['a', 'b', 'c', 'd', 'e'].forEach(name => performance.mark(name));
+
+    expect(performance.getEntries().map(entry => entry.name)).toEqual(['c', 'd', 'e']);
+    expect(performance.getEntriesByName('a').length).toBe(0);
+    expect(performance.getEntriesByType('mark').map(entry => entry.name)).toEqual(['c', 'd', 'e']);
+  });
+
+  it('shrinking keeps the newest entries', () => {
+    ['a', 'b', 'c'].forEach(name => performance.mark(name));
+    performance.setEntryBufferSize(2);
+    expect(performance.getEntriesByType('mark').map(entry => entry.name)).toEqual(['b', 'c']);
+  });
+
+  it('measures take room in the same buffer', () => {
+    performance.clearMarks();
+    performance.setEntryBufferSize(3);
+    performance.mark('start');
+    performance.mark('end');
+    performance.measure('cost', 'start', 'end');
+    performance.mark('next');
+
+    expect(performance.getEntriesByName('start').length).toBe(0);
+    expect(performance.getEntriesByName('cost', 'measure').length).toBe(1);
+    expect(performance.getEntriesByName('cost', 'mark').length).toBe(0);
+  });
+
+  it('clearMarks by name frees room for new entries', () => {
+    performance.setEntryBufferSize(2);
+    performance.mark('keep');
+    performance.mark('drop');
+    performance.clearMarks('drop');
+    performance.mark('new');
+
+    expect(performance.getEntries().map(entry => entry.name)).toEqual(['keep', 'new']);
+  });
+
+  it('clearMeasures by name keeps marks and other measures', () => {
+    performance.mark('start');
+    performance.mark('end');
+    performance.measure('first', 'start', 'end');
+    performance.measure('second', 'start', 'end');
+    performance.clearMeasures('first');
+
+    expect(performance.getEntriesByType('measure').map(entry => entry.name)).toEqual(['second']);
+    expect(performance.getEntriesByType('mark').length).toBe(2);
+  });
+
+  it('entries stay readable after they are dropped', () => {
+    performance.setEntryBufferSize(1);
+    performance.mark('first');
+    const entry = performance.getEntriesByName('first')[0];
+    performance.mark('second');
+
+    expect(performance.getEntriesByName('first').length).toBe(0);
+    expect(entry.name).toBe('first');
+    expect(entry.entryType).toBe('mark');
+  });
+
+  it('throws on a negative size', () => {
+    expect(() => performance.setEntryBufferSize(-1)).toThrowError();
+  });
+});
@@ -0,0 +1,67 @@
+describe('performance.memory', () => {
+  function memory() {
+    return performance.memory;
+  }
+
+  it('reports every counter', () => {
+    const stats = memory();
+    [
+      'usedJSHeapSize',
+      'totalJSHeapSize',
+      'eventTargetCount',
+      'nodeCount',
+      'pendingUICommandBytes',
+      'blobBytes',
+      'bridgeCallbackCount',
+    ].forEach(name => {
+      expect(typeof (stats as any)[name]).toBe('number');
+    });
+    expect(stats.nodeCount > 0).toBe(true);
+    expect(stats.eventTargetCount >= stats.nodeCount).toBe(true);
+  });
+
+  it('counts nodes and event targets when they are created', () => {
+    const before = memory();
+    const div = document.createElement('div');
+    const text = document.createTextNode('text');
+    const after = memory();
+    expect(after.nodeCount).toBe(before.nodeCount + 2);
+    expect(after.eventTargetCount).toBe(before.eventTargetCount + 2);
+    div.appendChild(text);
+  });
+
+  it('counts the bytes of blobs', () => {
+    const before = memory().blobBytes;
+    const blob = new Blob(['abcd', 'ef']);
+    expect(blob.size).toBe(6);
+    expect(memory().blobBytes).toBe(before + 6);
+  });
+
+  it('counts pending ui commands until they are flushed', (done) => {
+    const div = document.createElement('div');
+    div.setAttribute('id', 'memory');
+    document.body.appendChild(div);
+    expect(memory().pendingUICommandBytes > 0).toBe(true);
+
+    // The commands are flushed by the frame which runs the first callback.
+    requestAnimationFrame(() => {
+      requestAnimationFrame(() => {
+        expect(memory().pendingUICommandBytes).toBe(0);
+        done();
+      });
+    });
+  });
+
+  it('releases bridge callbacks after they are called', (done) => {
+    const before = memory().bridgeCallbackCount;
+    setTimeout(() => {
+      const during = memory().bridgeCallbackCount;
+      // The callback running now is released when it returns and the next one takes its place.
+      setTimeout(() => {
+        expect(memory().bridgeCallbackCount).toBe(during);
+        done();
+      });
+    });
+    expect(memory().bridgeCallbackCount).toBe(before + 1);
+  });
+});
@@ -0,0 +1,111 @@
+describe('PerformanceObserver', () => {
+  afterEach(() => {
+    performance.clearMarks();
+    performance.clearMeasures();
+  });
+
+  it('supportedEntryTypes', () => {
+    expect(PerformanceObserver.supportedEntryTypes).toEqual(['mark', 'measure']);
+  });
+
+  it('delivers entries of the same task in one callback', (done) => {
+    const calls: string[][] = [];
+    const observer = new PerformanceObserver((list, self) => {
+      expect(self).toBe(observer);
+      calls.push(list.getEntries().map(entry => entry.name));
+    });
+    observer.observe({ entryTypes: ['mark'] });
+
+    performance.mark('first');
+    performance.mark('second');
+    performance.mark('third');
+    expect(calls.length).toBe(0);
+
+    setTimeout(() => {
+      expect(calls).toEqual([['first', 'second', 'third']]);
+      observer.disconnect();
+      done();
+    });
+  });
+
+  it('only receives observed entry types', (done) => {
+    const observer = new PerformanceObserver((list) => {
+      expect(list.getEntries().map(entry => entry.entryType)).toEqual(['measure']);
+      expect(list.getEntriesByName('cost').length).toBe(1);
+      expect(list.getEntriesByType('mark').length).toBe(0);
+      observer.disconnect();
+      done();
+    });
+    observer.observe({ type: 'measure' });
+
+    performance.mark('start');
+    performance.mark('end');
+    performance.measure('cost', 'start', 'end');
+  });
+
+  it('notifies observers in registration order', (done) => {
+    const order: string[] = [];
+    const second = new PerformanceObserver(() => order.push('second'));
+    const first = new PerformanceObserver(() => order.push('first'));
+    second.observe({ entryTypes: ['mark'] });
+    first.observe({ entryTypes: ['mark'] });
+
+    performance.mark('order');
+
+    setTimeout(() => {
+      expect(order).toEqual(['second', 'first']);
+      first.disconnect();
+      second.disconnect();
+      done();
+    });
+  });
+
+  it('buffered observe delivers existing entries', (done) => {
+    performance.mark('before');
+    const observer = new PerformanceObserver((list) => {
+      expect(list.getEntries().map(entry => entry.name)).toEqual(['before', 'after']);
+      observer.disconnect();
+      done();
+    });
+    observer.observe({ type: 'mark', buffered: true });
+    performance.mark('after');
+  });
+
+  it('disconnect drops queued entries and stops notifications', (done) => {
+    let called = false;
+    const observer = new PerformanceObserver(() => {
+      called = true;
+    });
+    observer.observe({ entryTypes: ['mark'] });
+    performance.mark('dropped');
+    observer.disconnect();
+    performance.mark('ignored');
+
+    setTimeout(() => {
+      expect(called).toBe(false);
+      done();
+    });
+  });
+
+  it('takeRecords empties the queue', (done) => {
+    let called = false;
+    const observer = new PerformanceObserver(() => {
+      called = true;
+    });
+    observer.observe({ entryTypes: ['mark'] });
+    performance.mark('taken');
+
+    expect(observer.takeRecords().map(entry => entry.name)).toEqual(['taken']);
+    setTimeout(() => {
+      expect(called).toBe(false);
+      observer.disconnect();
+      done();
+    });
+  });
+
+  it('rejects invalid options', () => {
+    const observer = new PerformanceObserver(() => {});
+    expect(() => observer.observe({})).toThrowError();
+    expect(() => observer.observe({ entryTypes: ['mark'], type: 'mark' })).toThrowError();
+  });
+});
@@ -18,4 +18,9 @@ describe('Performance', () => {
   it('init startTime should less than 1000', () => {
     expect(startTime).toBeLessThan(1000);
   });
+
+  it('timeOrigin is close to Date.now', () => {
+    const drift = Math.abs(performance.timeOrigin + performance.now() - Date.now());
+    expect(drift).toBeLessThan(50);
+  });
 });
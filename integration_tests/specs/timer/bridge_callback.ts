@@ -0,0 +1,16 @@
+describe('Bridge callbacks', () => {
+  it('release timers which fire out of order', (done) => {
+    const before = performance.memory.bridgeCallbackCount;
+    const fired: number[] = [];
+    [30, 10, 20].forEach(timeout => {
+      setTimeout(() => fired.push(timeout), timeout);
+    });
+    expect(performance.memory.bridgeCallbackCount).toBe(before + 3);
+    setTimeout(() => {
+      expect(fired).toEqual([10, 20, 30]);
+      // Only this callback is still registered.
+      expect(performance.memory.bridgeCallbackCount).toBe(before + 1);
+      done();
+    }, 60);
+  });
+});
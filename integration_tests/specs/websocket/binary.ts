@@ -0,0 +1,97 @@
+describe('WebSocket binary', () => {
+  const LOOPBACK_URL = 'ws://websocket.loopback/echo';
+
+  it('binaryType defaults to blob', () => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    expect(ws.binaryType).toBe('blob');
+    ws.close();
+  });
+
+  it('send ArrayBuffer and receive Blob', (done) => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    ws.onopen = () => {
+      ws.send(new Uint8Array([1, 2, 3, 255]).buffer);
+    };
+    ws.onmessage = async (event) => {
+      expect(event.data instanceof Blob).toBe(true);
+      expect(event.data.size).toBe(4);
+      let buffer = await event.data.arrayBuffer();
+      expect(Array.from(new Uint8Array(buffer))).toEqual([1, 2, 3, 255]);
+      ws.close();
+      done();
+    };
+  });
+
+  it('send ArrayBufferView and receive ArrayBuffer', (done) => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    ws.binaryType = 'arraybuffer';
+    ws.onopen = () => {
+      ws.send(new Uint8Array([0, 10, 20, 30, 40]).subarray(1, 4));
+    };
+    ws.onmessage = (event) => {
+      expect(event.data instanceof ArrayBuffer).toBe(true);
+      expect(Array.from(new Uint8Array(event.data))).toEqual([10, 20, 30]);
+      ws.close();
+      done();
+    };
+  });
+
+  it('send Blob', (done) => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    ws.binaryType = 'arraybuffer';
+    ws.onopen = () => {
+      ws.send(new Blob(['kraken']));
+    };
+    ws.onmessage = (event) => {
+      expect(Array.from(new Uint8Array(event.data))).toEqual([107, 114, 97, 107, 101, 110]);
+      ws.close();
+      done();
+    };
+  });
+
+  it('send empty ArrayBuffer', (done) => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    ws.binaryType = 'arraybuffer';
+    ws.onopen = () => {
+      ws.send(new ArrayBuffer(0));
+    };
+    ws.onmessage = (event) => {
+      expect(event.data instanceof ArrayBuffer).toBe(true);
+      expect(event.data.byteLength).toBe(0);
+      ws.close();
+      done();
+    };
+  });
+
+  it('text message is kept as string', (done) => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    ws.binaryType = 'arraybuffer';
+    ws.onopen = () => {
+      ws.send('helloworld');
+    };
+    ws.onmessage = (event) => {
+      expect(event.data).toBe('helloworld');
+      ws.close();
+      done();
+    };
+  });
+
+  it('keep message order of mixed frames', (done) => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    ws.binaryType = 'arraybuffer';
+    let received: any[] = [];
+    ws.onopen = () => {
+      for (let i = 0; i < 100; i++) {
+        ws.send(i % 2 === 0 ? new Uint8Array([i]) : String(i));
+      }
+    };
+    ws.onmessage = (event) => {
+      received.push(typeof event.data === 'string' ? Number(event.data) : new Uint8Array(event.data)[0]);
+      if (received.length === 100) {
+        expect(received).toEqual(Array.from({ length: 100 }, (_, i) => i));
+        ws.close();
+        done();
+      }
+    };
+  });
+});
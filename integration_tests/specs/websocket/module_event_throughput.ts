@@ -0,0 +1,25 @@
+describe('WebSocket module event throughput', () => {
+  const LOOPBACK_URL = 'ws://websocket.loopback/burst';
+  const EVENT_COUNT = 10000;
+
+  it('dispatch 10k module events per second', (done) => {
+    let ws = new WebSocket(LOOPBACK_URL);
+    let received = 0;
+    let start = 0;
+    ws.onopen = () => {
+      start = performance.now();
+      // The loopback module emits EVENT_COUNT message events back to back through invokeModuleEvent.
+      kraken.invokeModule('WebSocket', 'burst', [ws['id'], EVENT_COUNT, '{"seq":1}']);
+    };
+    ws.onmessage = (event) => {
+      expect(event.data).toBe('{"seq":1}');
+      if (++received === EVENT_COUNT) {
+        let elapsed = performance.now() - start;
+        console.log(`module event throughput: ${Math.round(EVENT_COUNT / elapsed * 1000)} events/s`);
+        expect(elapsed).toBeLessThan(1000);
+        ws.close();
+        done();
+      }
+    };
+  });
+});
@@ -0,0 +1,132 @@
+describe('XMLHttpRequest events', () => {
+  const STUB_URL = 'http://xhr.stub';
+
+  it('download progress', (done) => {
+    const xhr = new XMLHttpRequest();
+    const loaded: number[] = [];
+    xhr.onprogress = (event: ProgressEvent) => {
+      expect(event.total).toBe(5120);
+      loaded.push(event.loaded);
+    };
+    xhr.onload = () => {
+      expect(loaded.length > 1).toBe(true);
+      expect(loaded[loaded.length - 1]).toBe(5120);
+      expect(loaded).toEqual(loaded.slice().sort((a, b) => a - b));
+      expect(xhr.response.length).toBe(5120);
+      done();
+    };
+    xhr.open('GET', STUB_URL + '/slow');
+    xhr.send();
+  });
+
+  it('upload events', (done) => {
+    const xhr = new XMLHttpRequest();
+    const events: string[] = [];
+    expect(xhr.upload instanceof XMLHttpRequestUpload).toBe(true);
+    ['loadstart', 'load', 'loadend'].forEach((type) => {
+      xhr.upload.addEventListener(type, () => events.push('upload.' + type));
+    });
+    xhr.addEventListener('loadstart', () => events.push('loadstart'));
+    xhr.addEventListener('loadend', () => {
+      expect(events).toEqual(['loadstart', 'upload.loadstart', 'upload.load', 'upload.loadend']);
+      done();
+    });
+    xhr.open('POST', STUB_URL + '/echo');
+    xhr.send('kraken');
+  });
+
+  it('no upload events without body', (done) => {
+    const xhr = new XMLHttpRequest();
+    let uploadEvents = 0;
+    xhr.upload.onloadstart = () => uploadEvents++;
+    xhr.onloadend = () => {
+      expect(uploadEvents).toBe(0);
+      done();
+    };
+    xhr.open('GET', STUB_URL + '/text');
+    xhr.send();
+  });
+
+  it('abort after headers received', (done) => {
+    const xhr = new XMLHttpRequest();
+    const events: string[] = [];
+    xhr.onreadystatechange = () => {
+      if (xhr.readyState === XMLHttpRequest.HEADERS_RECEIVED) xhr.abort();
+    };
+    xhr.onabort = () => events.push('abort');
+    xhr.onload = () => events.push('load');
+    xhr.onloadend = () => {
+      events.push('loadend');
+      setTimeout(() => {
+        expect(events).toEqual(['abort', 'loadend']);
+        expect(xhr.readyState).toBe(XMLHttpRequest.UNSENT);
+        expect(xhr.status).toBe(0);
+        done();
+      }, 100);
+    };
+    xhr.open('GET', STUB_URL + '/hang');
+    xhr.send();
+  });
+
+  it('abort before send does nothing', () => {
+    const xhr = new XMLHttpRequest();
+    let aborted = false;
+    xhr.onabort = () => (aborted = true);
+    xhr.abort();
+    xhr.open('GET', STUB_URL + '/text');
+    xhr.abort();
+    expect(aborted).toBe(false);
+    expect(xhr.readyState).toBe(XMLHttpRequest.OPENED);
+  });
+
+  it('abort upload', (done) => {
+    const xhr = new XMLHttpRequest();
+    const events: string[] = [];
+    xhr.upload.onabort = () => events.push('upload.abort');
+    xhr.upload.onloadend = () => events.push('upload.loadend');
+    xhr.onabort = () => events.push('abort');
+    xhr.onloadend = () => {
+      expect(events).toEqual(['upload.abort', 'upload.loadend', 'abort']);
+      done();
+    };
+    xhr.open('POST', STUB_URL + '/hang');
+    xhr.send('kraken');
+    xhr.abort();
+  });
+
+  it('timeout', (done) => {
+    const xhr = new XMLHttpRequest();
+    xhr.timeout = 100;
+    expect(xhr.timeout).toBe(100);
+    xhr.ontimeout = (event: ProgressEvent) => {
+      expect(event.type).toBe('timeout');
+      expect(xhr.readyState).toBe(XMLHttpRequest.DONE);
+      expect(xhr.status).toBe(0);
+      done();
+    };
+    xhr.onload = () => done.fail('should not load');
+    xhr.open('GET', STUB_URL + '/hang');
+    xhr.send();
+  });
+
+  it('network error', (done) => {
+    const xhr = new XMLHttpRequest();
+    xhr.onerror = () => {
+      expect(xhr.readyState).toBe(XMLHttpRequest.DONE);
+      expect(xhr.status).toBe(0);
+      expect(xhr.responseText).toBe('');
+      done();
+    };
+    xhr.open('GET', 'http://127.0.0.1:1/unreachable');
+    xhr.send();
+  });
+
+  it('request is kept alive without reference', (done) => {
+    (function() {
+      const xhr = new XMLHttpRequest();
+      xhr.onload = () => done();
+      xhr.open('GET', STUB_URL + '/slow');
+      xhr.send();
+    })();
+  });
+});
@@ -0,0 +1,107 @@
+describe('XMLHttpRequest readyState', () => {
+  const STUB_URL = 'http://xhr.stub';
+
+  it('constants', () => {
+    expect(XMLHttpRequest.UNSENT).toBe(0);
+    expect(XMLHttpRequest.OPENED).toBe(1);
+    expect(XMLHttpRequest.HEADERS_RECEIVED).toBe(2);
+    expect(XMLHttpRequest.LOADING).toBe(3);
+    expect(XMLHttpRequest.DONE).toBe(4);
+    const xhr = new XMLHttpRequest();
+    expect(xhr.DONE).toBe(4);
+    expect(xhr.readyState).toBe(XMLHttpRequest.UNSENT);
+  });
+
+  it('change in order', (done) => {
+    const xhr = new XMLHttpRequest();
+    const states: number[] = [];
+    xhr.onreadystatechange = () => {
+      states.push(xhr.readyState);
+      if (xhr.readyState === XMLHttpRequest.DONE) {
+        // readystatechange of LOADING may be fired with every chunk.
+        expect(states.filter((state, i) => states[i - 1] !== state)).toEqual([1, 2, 3, 4]);
+        expect(xhr.status).toBe(200);
+        expect(xhr.statusText).toBe('OK');
+        expect(xhr.responseURL).toBe(STUB_URL + '/text');
+        done();
+      }
+    };
+    xhr.open('GET', STUB_URL + '/text');
+    expect(xhr.readyState).toBe(XMLHttpRequest.OPENED);
+    xhr.send();
+  });
+
+  it('events are fired in order', (done) => {
+    const xhr = new XMLHttpRequest();
+    const events: string[] = [];
+    ['loadstart', 'progress', 'load', 'loadend'].forEach((type) => {
+      xhr.addEventListener(type, (event: ProgressEvent) => {
+        expect(event instanceof ProgressEvent).toBe(true);
+        if (events[events.length - 1] !== type) events.push(type);
+        if (type === 'loadend') {
+          expect(events).toEqual(['loadstart', 'progress', 'load', 'loadend']);
+          expect(event.loaded).toBe(4);
+          expect(event.total).toBe(4);
+          expect(event.lengthComputable).toBe(true);
+          done();
+        }
+      });
+    });
+    xhr.open('GET', STUB_URL + '/bytes');
+    xhr.send();
+  });
+
+  it('keep status of http error', (done) => {
+    const xhr = new XMLHttpRequest();
+    xhr.onload = () => {
+      expect(xhr.status).toBe(404);
+      expect(xhr.statusText).toBe('Stub Status');
+      expect(xhr.responseText).toBe('404');
+      done();
+    };
+    xhr.open('GET', STUB_URL + '/status/404');
+    xhr.send();
+  });
+
+  it('send before open throws', () => {
+    const xhr = new XMLHttpRequest();
+    expect(() => xhr.send()).toThrow();
+    expect(() => xhr.setRequestHeader('x-kraken', '1')).toThrow();
+  });
+
+  it('send twice throws', () => {
+    const xhr = new XMLHttpRequest();
+    xhr.open('GET', STUB_URL + '/hang');
+    xhr.send();
+    expect(() => xhr.send()).toThrow();
+    xhr.abort();
+  });
+
+  it('forbidden method throws', () => {
+    const xhr = new XMLHttpRequest();
+    expect(() => xhr.open('TRACE', STUB_URL + '/text')).toThrow();
+    expect(() => xhr.open('connect', STUB_URL + '/text')).toThrow();
+  });
+
+  it('synchronous request is not supported', () => {
+    const xhr = new XMLHttpRequest();
+    expect(() => xhr.open('GET', STUB_URL + '/text', false)).toThrow();
+  });
+
+  it('reopen drops the previous request', (done) => {
+    const xhr = new XMLHttpRequest();
+    let loads = 0;
+    xhr.onload = () => {
+      loads++;
+      expect(xhr.responseText).toBe('{"name":"kraken","version":1}');
+      setTimeout(() => {
+        expect(loads).toBe(1);
+        done();
+      }, 100);
+    };
+    xhr.open('GET', STUB_URL + '/text');
+    xhr.send();
+    xhr.open('GET', STUB_URL + '/json');
+    xhr.send();
+  });
+});
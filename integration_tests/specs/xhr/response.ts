@@ -0,0 +1,138 @@
+describe('XMLHttpRequest response', () => {
+  const STUB_URL = 'http://xhr.stub';
+
+  function request(path: string, responseType: XMLHttpRequestResponseType, callback: (xhr: XMLHttpRequest) => void) {
+    const xhr = new XMLHttpRequest();
+    xhr.open('GET', STUB_URL + path);
+    xhr.responseType = responseType;
+    xhr.onload = () => callback(xhr);
+    xhr.send();
+  }
+
+  it('responseType defaults to empty string', () => {
+    const xhr = new XMLHttpRequest();
+    expect(xhr.responseType).toBe('');
+    expect(xhr.response).toBe('');
+    expect(xhr.responseText).toBe('');
+    expect(xhr.responseXML).toBe(null);
+  });
+
+  it('text', (done) => {
+    request('/text', 'text', (xhr) => {
+      expect(xhr.response).toBe('你好, kraken');
+      expect(xhr.responseText).toBe('你好, kraken');
+      done();
+    });
+  });
+
+  it('malformed utf-8 text is replaced', (done) => {
+    request('/malformed', '', (xhr) => {
+      expect(xhr.responseText).toBe('hi��');
+      done();
+    });
+  });
+
+  it('json', (done) => {
+    request('/json', 'json', (xhr) => {
+      expect(xhr.response).toEqual({ name: 'kraken', version: 1 });
+      // The parsed object is cached.
+      expect(xhr.response).toBe(xhr.response);
+      expect(() => xhr.responseText).toThrow();
+      done();
+    });
+  });
+
+  it('invalid json is null', (done) => {
+    request('/text', 'json', (xhr) => {
+      expect(xhr.response).toBe(null);
+      done();
+    });
+  });
+
+  it('arraybuffer', (done) => {
+    request('/bytes', 'arraybuffer', (xhr) => {
+      expect(xhr.response instanceof ArrayBuffer).toBe(true);
+      expect(Array.from(new Uint8Array(xhr.response))).toEqual([0, 1, 2, 255]);
+      done();
+    });
+  });
+
+  it('blob', (done) => {
+    request('/bytes', 'blob', async (xhr) => {
+      expect(xhr.response instanceof Blob).toBe(true);
+      expect(xhr.response.size).toBe(4);
+      expect(xhr.response.type).toBe('application/octet-stream');
+      const buffer = await xhr.response.arrayBuffer();
+      expect(Array.from(new Uint8Array(buffer))).toEqual([0, 1, 2, 255]);
+      done();
+    });
+  });
+
+  it('overrideMimeType changes blob type', (done) => {
+    const xhr = new XMLHttpRequest();
+    xhr.open('GET', STUB_URL + '/bytes');
+    xhr.responseType = 'blob';
+    xhr.overrideMimeType('image/png');
+    xhr.onload = () => {
+      expect(xhr.response.type).toBe('image/png');
+      done();
+    };
+    xhr.send();
+  });
+
+  it('responseType can not be changed after done', (done) => {
+    request('/text', '', (xhr) => {
+      expect(() => {
+        xhr.responseType = 'json';
+      }).toThrow();
+      done();
+    });
+  });
+
+  it('response headers', (done) => {
+    request('/headers', '', (xhr) => {
+      expect(xhr.getResponseHeader('X-Kraken')).toBe('a, b');
+      expect(xhr.getResponseHeader('x-version')).toBe('1');
+      expect(xhr.getResponseHeader('x-unknown')).toBe(null);
+      expect(xhr.getAllResponseHeaders()).toBe(
+        'content-type: text/plain\r\nx-kraken: a, b\r\nx-version: 1\r\n'
+      );
+      done();
+    });
+  });
+
+  it('send string body', (done) => {
+    const xhr = new XMLHttpRequest();
+    xhr.open('post', STUB_URL + '/echo');
+    xhr.onload = () => {
+      expect(xhr.getResponseHeader('x-request-method')).toBe('POST');
+      expect(xhr.getResponseHeader('x-request-content-type')).toBe('text/plain;charset=UTF-8');
+      expect(xhr.responseText).toBe('hello kraken');
+      done();
+    };
+    xhr.send('hello kraken');
+  });
+
+  it('send binary body', (done) => {
+    const xhr = new XMLHttpRequest();
+    xhr.open('PUT', STUB_URL + '/echo');
+    xhr.responseType = 'arraybuffer';
+    xhr.onload = () => {
+      expect(Array.from(new Uint8Array(xhr.response))).toEqual([3, 4, 5]);
+      done();
+    };
+    xhr.send(new Uint8Array([1, 2, 3, 4, 5, 6]).subarray(2, 5));
+  });
+
+  it('combine request headers', (done) => {
+    const xhr = new XMLHttpRequest();
+    xhr.open('POST', STUB_URL + '/echo');
+    xhr.setRequestHeader('Content-Type', 'application/json');
+    xhr.setRequestHeader('content-type', 'charset=utf-8');
+    xhr.onload = () => {
+      expect(xhr.getResponseHeader('x-request-content-type')).toBe('application/json, charset=utf-8');
+      done();
+    };
+    xhr.send('{}');
+  });
+});
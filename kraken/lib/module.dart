@@ -14,3 +14,4 @@ export 'src/module/schedule_frame.dart';
 export 'src/module/timer.dart';
 export 'src/module/navigation.dart';
 export 'src/module/performance_timing.dart';
+export 'src/module/xhr.dart';
@@ -10,9 +10,13 @@ import 'from_native.dart';
 import 'to_native.dart';
 import 'package:flutter/scheduler.dart';
 
-/// the Kraken JS Bridge Size
+/// The initial size of Kraken JS Bridge pool, the pool grows on demand when all bridges are in use.
 int kKrakenJSBridgePoolSize = 8;
 
+/// The count of JS contexts which are built ahead of time to speed up opening new pages and reloading.
+/// Disabled by default, each pre-warmed context costs the memory of a whole JS context.
+int kKrakenJSBridgePrewarmSize = 0;
+
 bool _firstView = true;
 
 /// Init bridge
@@ -46,6 +50,7 @@ int initBridge() {
   }
 
   if (_firstView) {
+    setContextPoolPrewarmSize(kKrakenJSBridgePrewarmSize);
     initJSContextPool(kKrakenJSBridgePoolSize);
     _firstView = false;
     contextId = 0;
@@ -63,16 +63,18 @@ void freeNativeString(Pointer<NativeString> pointer) {
 // 6. Call from C.
 
 // Register InvokeModule
-typedef NativeAsyncModuleCallback = Void Function(
-    Pointer<JSCallbackContext> callbackContext, Int32 contextId, Pointer<NativeString> errmsg,  Pointer<NativeString> json);
-typedef DartAsyncModuleCallback = void Function(
-    Pointer<JSCallbackContext> callbackContext, int contextId, Pointer<NativeString> errmsg, Pointer<NativeString> json);
+typedef NativeAsyncModuleCallback = Void Function(Pointer<JSCallbackContext> callbackContext, Int32 contextId,
+    Pointer<NativeString> errmsg, Pointer<NativeString> json, Pointer<Uint8> bytes, Int32 length);
+typedef DartAsyncModuleCallback = void Function(Pointer<JSCallbackContext> callbackContext, int contextId,
+    Pointer<NativeString> errmsg, Pointer<NativeString> json, Pointer<Uint8> bytes, int length);
 
 typedef Native_InvokeModule = Pointer<NativeString> Function(Pointer<JSCallbackContext> callbackContext,
-    Int32 contextId, Pointer<NativeString> module, Pointer<NativeString> method, Pointer<NativeString> params, Pointer<NativeFunction<NativeAsyncModuleCallback>>);
+    Int32 contextId, Pointer<NativeString> module, Pointer<NativeString> method, Pointer<NativeString> params,
+    Pointer<Uint8> bytes, Int32 length, Pointer<NativeFunction<NativeAsyncModuleCallback>>);
 
 String invokeModule(
-    Pointer<JSCallbackContext> callbackContext, int contextId, String moduleName, String method, String params, DartAsyncModuleCallback callback) {
+    Pointer<JSCallbackContext> callbackContext, int contextId, String moduleName, String method, String params, DartAsyncModuleCallback callback,
+    [Uint8List bytes]) {
   KrakenController controller = KrakenController.getControllerOfJSContextId(contextId);
   String result = '';
 
@@ -80,34 +82,67 @@ String invokeModule(
     void invokeModuleCallback({String errmsg, dynamic data}) {
       if (errmsg != null) {
         Pointer<NativeString> errmsgPtr = stringToNativeString(errmsg);
-        callback(callbackContext, contextId, errmsgPtr, nullptr);
+        callback(callbackContext, contextId, errmsgPtr, nullptr, nullptr, -1);
         freeNativeString(errmsgPtr);
       } else {
+        // Binary payload in the result list are handed over as raw bytes instead of encoding into json.
+        Uint8List bytes;
+        if (data is List) {
+          int index = data.indexWhere((item) => item is Uint8List);
+          if (index != -1) {
+            bytes = data[index];
+            data = List.from(data)..[index] = null;
+          }
+        }
+
         Pointer<NativeString> dataPtr = stringToNativeString(jsonEncode(data));
-        callback(callbackContext, contextId, nullptr, dataPtr);
+        if (bytes == null) {
+          callback(callbackContext, contextId, nullptr, dataPtr, nullptr, -1);
+        } else {
+          // The bridge takes the bytes over and frees them with the ArrayBuffer it wraps them in.
+          Pointer<Uint8> bytesPtr = allocate<Uint8>(count: bytes.isEmpty ? 1 : bytes.length);
+          bytesPtr.asTypedList(bytes.length).setAll(0, bytes);
+          callback(callbackContext, contextId, nullptr, dataPtr, bytesPtr, bytes.length);
+        }
         freeNativeString(dataPtr);
       }
     }
-    result = controller.module.moduleManager.invokeModule(moduleName, method, (params != null && params != '""') ? jsonDecode(params) : null, invokeModuleCallback);
+    dynamic decodedParams = (params != null && params != '""') ? jsonDecode(params) : null;
+    // Binary payload is appended to the params list, modules receive it as an Uint8List.
+    if (bytes != null) {
+      if (decodedParams is List) {
+        decodedParams = List.from(decodedParams)..add(bytes);
+      } else {
+        decodedParams = decodedParams == null ? bytes : [decodedParams, bytes];
+      }
+    }
+    result = controller.module.moduleManager.invokeModule(moduleName, method, decodedParams, invokeModuleCallback);
   } catch (e, stack) {
     String errmsg = '$e\n$stack';
     // print module error on the dart side.
     print('$e\n$stack');
-    callback(callbackContext, contextId, stringToNativeString(errmsg), nullptr);
+    callback(callbackContext, contextId, stringToNativeString(errmsg), nullptr, nullptr, -1);
   }
 
   return result;
 }
 
 Pointer<NativeString> _invokeModule(Pointer<JSCallbackContext> callbackContext, int contextId,
-    Pointer<NativeString> module, Pointer<NativeString> method, Pointer<NativeString> params, Pointer<NativeFunction<NativeAsyncModuleCallback>> callback) {
+    Pointer<NativeString> module, Pointer<NativeString> method, Pointer<NativeString> params,
+    Pointer<Uint8> bytes, int length, Pointer<NativeFunction<NativeAsyncModuleCallback>> callback) {
+  // The bytes are owned by the JS value, copy them before returning to the bridge.
+  Uint8List data;
+  if (length >= 0) {
+    data = length == 0 ? Uint8List(0) : Uint8List.fromList(bytes.asTypedList(length));
+  }
   String result = invokeModule(
     callbackContext,
     contextId,
     nativeStringToString(module),
     nativeStringToString(method),
     params == nullptr ? null : nativeStringToString(params),
-    callback.asFunction()
+    callback.asFunction(),
+    data
   );
   return stringToNativeString(result);
 }
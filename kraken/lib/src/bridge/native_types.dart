@@ -60,6 +60,11 @@ class NativeMessageEvent extends Struct {
 
   Pointer<NativeString> data;
   Pointer<NativeString> origin;
+
+  Pointer<Uint8> bytes;
+
+  @Int32()
+  int length;
 }
 
 class NativeCustomEvent extends Struct {
@@ -160,6 +160,16 @@ int allocateNewContext() {
   return _allocateNewContext();
 }
 
+typedef Native_SetContextPoolPrewarmSize = Void Function(Int32 size);
+typedef Dart_SetContextPoolPrewarmSize = void Function(int size);
+
+final Dart_SetContextPoolPrewarmSize _setContextPoolPrewarmSize =
+    nativeDynamicLibrary.lookup<NativeFunction<Native_SetContextPoolPrewarmSize>>('setContextPoolPrewarmSize').asFunction();
+
+void setContextPoolPrewarmSize(int size) {
+  _setContextPoolPrewarmSize(size);
+}
+
 // Regisdster reloadJsContext
 typedef Native_ReloadJSContext = Void Function(Int32 contextId);
 typedef Dart_ReloadJSContext = void Function(int contextId);
@@ -4,6 +4,7 @@
  */
 import 'dart:convert';
 import 'dart:ffi';
+import 'dart:typed_data';
 
 import 'package:kraken/dom.dart';
 import 'package:kraken/bridge.dart';
@@ -290,7 +291,10 @@ class MessageEvent extends Event {
   /// A USVString representing the origin of the message emitter.
   final String origin;
 
-  MessageEvent(this.data, {this.origin = ''}) :
+  /// The binary data sent by the message emitter, [data] is ignored when present.
+  final Uint8List bytes;
+
+  MessageEvent(this.data, {this.origin = '', this.bytes}) :
         assert(data != null),
         super(EVENT_MESSAGE);
 
@@ -300,6 +304,16 @@ class MessageEvent extends Event {
     messageEvent.ref.nativeEvent = nativeEvent;
     messageEvent.ref.data = stringToNativeString(data);
     messageEvent.ref.origin = stringToNativeString(origin);
+    if (bytes != null) {
+      // Bytes are handed over to the bridge, which wraps them in an ArrayBuffer without copying.
+      Pointer<Uint8> bytesPtr = allocate<Uint8>(count: bytes.isEmpty ? 1 : bytes.length);
+      bytesPtr.asTypedList(bytes.length).setAll(0, bytes);
+      messageEvent.ref.bytes = bytesPtr;
+      messageEvent.ref.length = bytes.length;
+    } else {
+      messageEvent.ref.bytes = nullptr;
+      messageEvent.ref.length = 0;
+    }
     return messageEvent;
   }
 }
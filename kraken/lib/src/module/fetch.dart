@@ -5,6 +5,7 @@
 
 import 'dart:async';
 import 'dart:io';
+import 'dart:typed_data';
 
 import 'package:dio/dio.dart';
 import 'package:kraken/bridge.dart';
@@ -18,6 +19,9 @@ class FetchModule extends BaseModule {
 
   FetchModule(ModuleManager moduleManager) : super(moduleManager);
 
+  /// Replace the network transport of fetch, used by tests to respond fixed payloads.
+  static HttpClientAdapter debugHttpClientAdapter;
+
   @override
   void dispose() {}
 
@@ -27,10 +31,12 @@ class FetchModule extends BaseModule {
     Map<String, dynamic> options = params;
 
     _fetch(url, options).then((Response response) {
-      callback(data: ['', response.statusCode, response.data]);
+      // Response body are handed over to JS as bytes, decoding are up to Response.text()/json()/arrayBuffer()/blob().
+      String contentType = response.headers.value(HttpHeaders.contentTypeHeader);
+      callback(data: ['', response.statusCode, _toBytes(response.data), contentType, _setCookies(response)]);
     }).catchError((e, stack) {
       if (e is DioError && e.type == DioErrorType.RESPONSE) {
-        callback(data: [e.toString(), e.response.statusCode, EMPTY_STRING]);
+        callback(data: [e.toString(), e.response.statusCode, EMPTY_STRING, null, _setCookies(e.response)]);
       } else {
         callback(errmsg: '$e\n$stack');
       }
@@ -40,6 +46,17 @@ class FetchModule extends BaseModule {
   }
 }
 
+/// Set-Cookie headers are stored into the cookie jar of page by the bridge.
+List<String> _setCookies(Response response) {
+  return response.headers[HttpHeaders.setCookieHeader] ?? [];
+}
+
+Uint8List _toBytes(dynamic data) {
+  if (data == null) return Uint8List(0);
+  if (data is Uint8List) return data;
+  return Uint8List.fromList(data);
+}
+
 Future<Response> _fetch(String url, Map<String, dynamic> map) async {
   Future<Response> future;
   String method = map['method'] ?? 'GET';
@@ -54,26 +71,31 @@ Future<Response> _fetch(String url, Map<String, dynamic> map) async {
   }
 
   BaseOptions options =
-      BaseOptions(headers: headers, method: method, contentType: 'application/json', responseType: ResponseType.plain);
+      BaseOptions(headers: headers, method: method, contentType: 'application/json', responseType: ResponseType.bytes);
+
+  Dio dio = Dio(options);
+  if (FetchModule.debugHttpClientAdapter != null) {
+    dio.httpClientAdapter = FetchModule.debugHttpClientAdapter;
+  }
 
   switch (method) {
     case 'GET':
-      future = Dio(options).get(url);
+      future = dio.get(url);
       break;
     case 'POST':
-      future = Dio(options).post(url, data: map['body']);
+      future = dio.post(url, data: map['body']);
       break;
     case 'PUT':
-      future = Dio(options).put(url, data: map['body']);
+      future = dio.put(url, data: map['body']);
       break;
     case 'PATCH':
-      future = Dio(options).patch(url, data: map['body']);
+      future = dio.patch(url, data: map['body']);
       break;
     case 'DELETE':
-      future = Dio(options).delete(url, data: map['body']);
+      future = dio.delete(url, data: map['body']);
       break;
     case 'HEAD':
-      future = Dio(options).head(url);
+      future = dio.head(url);
       break;
   }
 
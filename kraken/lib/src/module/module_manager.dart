@@ -35,6 +35,7 @@ class ModuleManager {
       defineModule((moduleManager) => MethodChannelModule(moduleManager));
       defineModule((moduleManager) => NavigationModule(moduleManager));
       defineModule((moduleManager) => NavigatorModule(moduleManager));
+      defineModule((moduleManager) => XMLHttpRequestModule(moduleManager));
       inited = true;
     }
   }
@@ -48,6 +49,13 @@ class ModuleManager {
     _creatorMap[fakeModule.name] = moduleCreator;
   }
 
+  /// Replace a defined module for testing, [moduleCreator] receives the creator of the replaced module so the
+  /// override can delegate to it.
+  static void debugOverrideModule(String name, BaseModule Function(ModuleManager, ModuleCreator) moduleCreator) {
+    ModuleCreator originalCreator = _creatorMap[name];
+    _creatorMap[name] = (moduleManager) => moduleCreator(moduleManager, originalCreator);
+  }
+
   void emitModuleEvent(String moduleName, {Event event, Object data}) {
     bridge.emitModuleEvent(contextId, moduleName, event, jsonEncode(data));
   }
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2019-present Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:dio/dio.dart';
+import 'package:kraken/bridge.dart';
+import 'package:kraken/src/module/module_manager.dart';
+
+// Download progress are reported at most once in this duration.
+const int _PROGRESS_INTERVAL_MS = 50;
+
+class _XMLHttpRequestTask {
+  final CancelToken cancelToken = CancelToken();
+  StreamSubscription<Uint8List> subscription;
+  Timer timer;
+
+  void cancel() {
+    timer?.cancel();
+    subscription?.cancel();
+    if (!cancelToken.isCancelled) cancelToken.cancel();
+  }
+}
+
+/// Network transport of the native XMLHttpRequest, the readyState machine and events are handled in the bridge.
+///
+/// Request headers and progress are emitted as module events of `[id, 'headers', status, statusText, url, headers]`,
+/// `[id, 'progress', loaded, total]` and `[id, 'uploadprogress', sent, total]`, the final result is called back
+/// with `['load', bytes]`, `['error', message]` or `['timeout']`.
+class XMLHttpRequestModule extends BaseModule {
+  @override
+  String get name => 'XMLHttpRequest';
+
+  XMLHttpRequestModule(ModuleManager moduleManager) : super(moduleManager);
+
+  /// Replace the network transport of XMLHttpRequest, used by tests to respond fixed payloads.
+  static HttpClientAdapter debugHttpClientAdapter;
+
+  final Map<int, _XMLHttpRequestTask> _tasks = {};
+  final Map<int, InvokeModuleCallback> _callbacks = {};
+
+  @override
+  String invoke(String method, dynamic params, InvokeModuleCallback callback) {
+    switch (method) {
+      case 'send':
+        _send(params, callback);
+        break;
+      case 'abort':
+        int id = params[0];
+        _tasks.remove(id)?.cancel();
+        // Aborted requests are ignored by bridge, callback only to release the callback context.
+        _callbacks.remove(id)?.call(data: ['abort']);
+        break;
+    }
+    return '';
+  }
+
+  @override
+  void dispose() {
+    _tasks.forEach((id, task) => task.cancel());
+    _tasks.clear();
+    // Release the callback context hold by bridge.
+    _callbacks.forEach((id, callback) => callback(data: ['abort']));
+    _callbacks.clear();
+  }
+
+  void _emit(int id, List<dynamic> data) {
+    if (!_tasks.containsKey(id)) return;
+    moduleManager.emitModuleEvent(name, data: [id, ...data]);
+  }
+
+  void _finish(int id, List<dynamic> data) {
+    _XMLHttpRequestTask task = _tasks.remove(id);
+    InvokeModuleCallback callback = _callbacks.remove(id);
+    if (task == null || callback == null) return;
+    task.timer?.cancel();
+    callback(data: data);
+  }
+
+  Uri _resolveUrl(String url) {
+    Uri uri = Uri.parse(url);
+    String bundleURL = moduleManager.controller.bundleURL;
+    if (!uri.hasScheme && bundleURL != null) {
+      uri = Uri.parse(bundleURL).resolveUri(uri);
+    }
+    return uri;
+  }
+
+  void _send(List<dynamic> params, InvokeModuleCallback callback) {
+    int id = params[0];
+    String method = params[1];
+    Uri uri = _resolveUrl(params[2]);
+    Map<String, dynamic> headers = Map.from(params[3]);
+    num timeout = params[4];
+    dynamic body = params.length > 6 ? params[6] : null;
+
+    Iterable<String> headerNames = headers.keys.map((name) => name.toLowerCase());
+    if (!headerNames.contains(HttpHeaders.userAgentHeader)) {
+      headers[HttpHeaders.userAgentHeader] = getKrakenInfo().userAgent;
+    }
+    if (!headerNames.contains(HttpHeaders.acceptHeader)) {
+      headers[HttpHeaders.acceptHeader] = '*/*';
+    }
+
+    _XMLHttpRequestTask task = _XMLHttpRequestTask();
+    _tasks[id] = task;
+    _callbacks[id] = callback;
+
+    if (timeout > 0) {
+      task.timer = Timer(Duration(milliseconds: timeout.toInt()), () {
+        task.cancel();
+        _finish(id, ['timeout']);
+      });
+    }
+
+    // Body are sent as a stream of bytes to bypass the transformer of dio, which encodes string and list bodies
+    // according to content type.
+    Stream<List<int>> data;
+    if (body is String) body = Uint8List.fromList(utf8.encode(body));
+    if (body is Uint8List) {
+      data = Stream<List<int>>.fromIterable([body]);
+      headers[Headers.contentLengthHeader] = body.length;
+    }
+
+    Dio dio = Dio();
+    if (debugHttpClientAdapter != null) {
+      dio.httpClientAdapter = debugHttpClientAdapter;
+    }
+
+    dio.requestUri<ResponseBody>(
+      uri,
+      data: data,
+      cancelToken: task.cancelToken,
+      options: Options(
+        method: method,
+        headers: headers,
+        responseType: ResponseType.stream,
+        // Every status are delivered to page, only network failures are errors.
+        validateStatus: (_) => true,
+      ),
+      onSendProgress: (int sent, int total) => _emit(id, ['uploadprogress', sent, total > 0 ? total : 0]),
+    ).then((Response<ResponseBody> response) {
+      if (!_tasks.containsKey(id)) return;
+
+      List<List<String>> headerPairs = [];
+      response.headers.forEach((String name, List<String> values) {
+        values.forEach((value) => headerPairs.add([name, value]));
+      });
+      Uri responseUri = response.redirects != null && response.redirects.isNotEmpty
+          ? uri.resolveUri(response.redirects.last.location)
+          : uri;
+      _emit(id, ['headers', response.statusCode, response.statusMessage ?? '', responseUri.toString(), headerPairs]);
+
+      int total = int.tryParse(response.headers.value(Headers.contentLengthHeader) ?? '') ?? 0;
+      BytesBuilder builder = BytesBuilder(copy: false);
+      Stopwatch stopwatch;
+      task.subscription = response.data.stream.listen((Uint8List chunk) {
+        builder.add(chunk);
+        // The first chunk is reported immediately to switch the request to LOADING.
+        if (stopwatch == null || stopwatch.elapsedMilliseconds >= _PROGRESS_INTERVAL_MS) {
+          stopwatch = Stopwatch()..start();
+          _emit(id, ['progress', builder.length, total]);
+        }
+      }, onDone: () {
+        _finish(id, ['load', builder.takeBytes()]);
+      }, onError: (e) {
+        _finish(id, ['error', '$e']);
+      }, cancelOnError: true);
+    }).catchError((e) {
+      // Cancelled requests are finished by abort or timeout.
+      if (e is DioError && e.type == DioErrorType.CANCEL) return;
+      _finish(id, ['error', '$e']);
+    });
+  }
+}
@@ -0,0 +1,39 @@
+/**
+ * Print the output of kraken_context_benchmark of several engines as one markdown table.
+ * Usage: node scripts/compare_context_benchmarks.js jsc/context_benchmark.txt quickjs/context_benchmark.txt
+ */
+
+const { readFileSync } = require('fs');
+
+const files = process.argv.slice(2);
+if (files.length === 0) {
+  console.error('Pass the context_benchmark.txt of each engine.');
+  process.exit(1);
+}
+
+// Lines are `name: value`, the engine line names the column.
+const columns = files.map(file => {
+  let rows = new Map();
+  for (let line of readFileSync(file, { encoding: 'utf-8' }).split('\n')) {
+    let separator = line.indexOf(':');
+    if (separator < 0) continue;
+    rows.set(line.slice(0, separator).trim(), line.slice(separator + 1).trim());
+  }
+  return rows;
+});
+
+let names = [];
+for (let rows of columns) {
+  for (let name of rows.keys()) {
+    if (name !== 'engine' && names.indexOf(name) < 0) names.push(name);
+  }
+}
+
+let lines = [
+  `| | ${columns.map(rows => rows.get('engine') || '?').join(' | ')} |`,
+  `| --- |${columns.map(() => ' --- |').join('')}`
+];
+for (let name of names) {
+  lines.push(`| ${name} | ${columns.map(rows => rows.get(name) || 'n/a').join(' | ')} |`);
+}
+console.log(lines.join('\n'));
@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+# Generate bridge/foundation/idna_table.h, the Unicode data used by UTS #46 processing and NFC normalization of
+# domains. The IDNA mapping and joining types are read from the `idna` package, the rest from `unicodedata`, both
+# must be of the same Unicode version.
+#
+#   pip install idna && python3 scripts/generate_idna_table.py
+
+import os
+import sys
+import unicodedata
+
+import idna.idnadata
+import idna.uts46data
+
+MAX_CODE_POINT = 0x10FFFF
+SBASE, SCOUNT = 0xAC00, 11172
+OUTPUT = os.path.join(os.path.dirname(__file__), '..', 'bridge', 'foundation', 'idna_table.h')
+
+# Classes used by the Bidi Rule of RFC 5893, the rest are collapsed into Other.
+BIDI_CLASSES = ['L', 'R', 'AL', 'AN', 'EN', 'ES', 'CS', 'ET', 'ON', 'BN', 'NSM', 'Other']
+JOINING_TYPES = ['U', 'L', 'D', 'R', 'T']
+
+
+def idna_mapping():
+  # UseSTD3ASCIIRules and Transitional_Processing are false for URLs, so STD3 statuses and deviations collapse
+  # into valid and mapped, ignored code points are mapped to nothing.
+  entries = idna.uts46data.uts46data
+  ranges = []
+  for entry in entries:
+    start, status = entry[0], entry[1]
+    mapping = entry[2] if len(entry) > 2 else None
+    if status in ('V', 'D') or (status == '3' and mapping is None):
+      kind, mapping = 'kValid', ''
+    elif status == 'I':
+      kind, mapping = 'kMapped', ''
+    elif status in ('M', '3'):
+      kind = 'kMapped'
+    else:
+      kind, mapping = 'kDisallowed', ''
+    if ranges and ranges[-1][1] == kind and ranges[-1][2] == mapping:
+      continue
+    ranges.append((start, kind, mapping))
+  return ranges
+
+
+def range_table(value_of):
+  ranges = []
+  for code_point in range(MAX_CODE_POINT + 1):
+    value = value_of(code_point)
+    if ranges and ranges[-1][2] == value and ranges[-1][1] == code_point - 1:
+      ranges[-1][1] = code_point
+    elif value is not None:
+      ranges.append([code_point, code_point, value])
+  return ranges
+
+
+def bidi_class(name):
+  # L is the most common class, it's left out of the table. Unassigned code points are disallowed by IDNA, the
+  # class they default to doesn't matter.
+  if name in ('L', ''):
+    return None
+  return name if name in BIDI_CLASSES else 'Other'
+
+
+def canonical_decomposition(code_point):
+  decomposition = unicodedata.decomposition(chr(code_point))
+  if not decomposition or decomposition.startswith('<'):
+    return None
+  return [int(part, 16) for part in decomposition.split()]
+
+
+def full_decomposition(code_point):
+  parts = canonical_decomposition(code_point)
+  if parts is None:
+    return [code_point]
+  result = []
+  for part in parts:
+    result.extend(full_decomposition(part))
+  return result
+
+
+def format_rows(items, indent='  ', width=120):
+  lines, line = [], indent
+  for item in items:
+    if len(line) + len(item) + 1 > width and line.strip():
+      lines.append(line.rstrip())
+      line = indent
+    line += item + ' '
+  if line.strip():
+    lines.append(line.rstrip())
+  return '\n'.join(lines)
+
+
+def main():
+  if unicodedata.unidata_version != idna.idnadata.__version__:
+    sys.exit('unicodedata %s does not match idna %s' % (unicodedata.unidata_version, idna.idnadata.__version__))
+
+  mapping_data, mapping_offsets = [], {}
+  mapping_rows = []
+  for start, kind, mapping in idna_mapping():
+    if mapping not in mapping_offsets:
+      mapping_offsets[mapping] = len(mapping_data)
+      mapping_data.extend(ord(c) for c in mapping)
+    mapping_rows.append('{0x%X, %s, %d, %d},' % (start, kind, len(mapping), mapping_offsets[mapping]))
+  assert len(mapping_data) < 0x10000
+
+  combining_classes = range_table(lambda c: unicodedata.combining(chr(c)) or None)
+  marks = range_table(lambda c: 1 if unicodedata.category(chr(c)).startswith('M') else None)
+  bidi_classes = range_table(lambda c: bidi_class(unicodedata.bidirectional(chr(c))))
+  joining_types = range_table(lambda c: chr(idna.idnadata.joining_types[c])
+                              if c in idna.idnadata.joining_types and
+                              chr(idna.idnadata.joining_types[c]) in JOINING_TYPES[1:] else None)
+
+  decomposition_data, decomposition_rows = [], []
+  composition_rows = []
+  for code_point in range(MAX_CODE_POINT + 1):
+    if SBASE <= code_point < SBASE + SCOUNT:
+      continue
+    parts = canonical_decomposition(code_point)
+    if parts is None:
+      continue
+    full = full_decomposition(code_point)
+    decomposition_rows.append('{0x%X, %d, %d},' % (code_point, len(decomposition_data), len(full)))
+    decomposition_data.extend(full)
+    # Primary composites, singletons, non-starter decompositions and exclusions never compose.
+    if len(parts) == 2 and unicodedata.normalize('NFC', chr(parts[0]) + chr(parts[1])) == chr(code_point):
+      composition_rows.append((parts[0], parts[1], code_point))
+  composition_rows.sort()
+  assert len(decomposition_data) < 0x10000
+
+  with open(OUTPUT, 'w') as output:
+    output.write('''/*
+ * Copyright (C) 2020 Alibaba Inc. All rights reserved.
+ * Author: Kraken Team.
+ */
+
+// Generated by scripts/generate_idna_table.py from Unicode %(version)s, do not edit.
+
+#ifndef KRAKENBRIDGE_IDNA_TABLE_H
+#define KRAKENBRIDGE_IDNA_TABLE_H
+
+#include <cstdint>
+
+namespace foundation::idna_table {
+
+constexpr const char *kUnicodeVersion = "%(version)s";
+
+enum IDNAStatus : uint8_t { kValid, kMapped, kDisallowed };
+
+// A range starts at its code point and ends before the next one.
+struct IDNAMappingRange {
+  uint32_t start;
+  IDNAStatus status;
+  uint8_t mappingLength;
+  uint16_t mappingOffset;
+};
+
+struct CodePointRange {
+  uint32_t start;
+  uint32_t end;
+  uint8_t value;
+};
+
+struct Decomposition {
+  uint32_t codePoint;
+  uint16_t offset;
+  uint8_t length;
+};
+
+struct Composition {
+  uint32_t first;
+  uint32_t second;
+  uint32_t composite;
+};
+
+enum BidiClass : uint8_t {
+%(bidi)s
+};
+
+enum JoiningType : uint8_t { %(joining)s };
+
+static const IDNAMappingRange kIDNAMapping[] = {
+%(mapping)s
+};
+
+static const char32_t kIDNAMappingData[] = {
+%(mapping_data)s
+};
+
+static const CodePointRange kCombiningClasses[] = {
+%(combining)s
+};
+
+// General_Category=Mark, value is always 1.
+static const CodePointRange kMarks[] = {
+%(marks)s
+};
+
+// Code points which are not listed are of class L.
+static const CodePointRange kBidiClasses[] = {
+%(bidi_classes)s
+};
+
+// Code points which are not listed are of joining type U.
+static const CodePointRange kJoiningTypes[] = {
+%(joining_types)s
+};
+
+// Full canonical decompositions, Hangul syllables are decomposed algorithmically.
+static const Decomposition kDecompositions[] = {
+%(decompositions)s
+};
+
+static const char32_t kDecompositionData[] = {
+%(decomposition_data)s
+};
+
+// Sorted by first and second.
+static const Composition kCompositions[] = {
+%(compositions)s
+};
+
+} // namespace foundation::idna_table
+
+#endif // KRAKENBRIDGE_IDNA_TABLE_H
+''' % {
+      'version': unicodedata.unidata_version,
+      'bidi': format_rows('kBidi%s,' % name for name in BIDI_CLASSES),
+      'joining': ', '.join('kJoining' + name for name in JOINING_TYPES),
+      'mapping': format_rows(mapping_rows),
+      'mapping_data': format_rows('0x%X,' % c for c in mapping_data),
+      'combining': format_rows('{0x%X, 0x%X, %d},' % tuple(r) for r in combining_classes),
+      'marks': format_rows('{0x%X, 0x%X, 1},' % (r[0], r[1]) for r in marks),
+      'bidi_classes': format_rows('{0x%X, 0x%X, kBidi%s},' % tuple(r) for r in bidi_classes),
+      'joining_types': format_rows('{0x%X, 0x%X, kJoining%s},' % tuple(r) for r in joining_types),
+      'decompositions': format_rows(decomposition_rows),
+      'decomposition_data': format_rows('0x%X,' % c for c in decomposition_data),
+      'compositions': format_rows('{0x%X, 0x%X, 0x%X},' % r for r in composition_rows),
+    })
+
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,20 @@
+/**
+ * Bridge unit test script, pass --js-engine to pick the engine.
+ */
+
+require('./tasks');
+
+const { series } = require('gulp');
+const chalk = require('chalk');
+
+series(
+  'compile-polyfill',
+  'bridge-unit-test'
+)((err) => {
+  if (err) {
+    console.log(err);
+    process.exit(1);
+  } else {
+    console.log(chalk.green('Test Success.'));
+  }
+});
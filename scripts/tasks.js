@@ -11,7 +11,7 @@ const del = require('del');
 const os = require('os');
 
 program.
-option('-e, --js-engine <engine>', 'The JavaScript Engine kraken used', 'jsc')
+option('-e, --js-engine <engine>', 'The JavaScript Engine kraken used', process.env.KRAKEN_JS_ENGINE || 'jsc')
 .parse(process.argv);
 
 const SUPPORTED_JS_ENGINES = ['jsc', 'quickjs'];
@@ -250,6 +250,38 @@ task('integration-test', (done) => {
   });
 });
 
+// Unit tests and the context benchmark of the bridge, built with the engine of --js-engine.
+task('bridge-unit-test', (done) => {
+  const buildDir = path.join(paths.bridge, `cmake-build-unit-test-${program.jsEngine}`);
+  execSync(`cmake -DCMAKE_BUILD_TYPE=RelWithDebInfo -DENABLE_TEST=true -G "Unix Makefiles" -B ${buildDir} \
+    -S ${paths.bridge}`, {
+    cwd: paths.bridge,
+    stdio: 'inherit',
+    env: {
+      ...process.env,
+      KRAKEN_JS_ENGINE: program.jsEngine
+    }
+  });
+
+  execSync(`cmake --build ${buildDir} --target kraken_unit_test kraken_context_benchmark -- -j 12`, {
+    stdio: 'inherit'
+  });
+
+  const result = spawnSync('ctest', ['--output-on-failure'], {
+    cwd: buildDir,
+    stdio: 'inherit'
+  });
+  if (result.status !== 0) {
+    return done(new Error(`Bridge unit tests failed on ${program.jsEngine}.`));
+  }
+
+  // Kept next to the build, CI compares the numbers of both engines.
+  const benchmark = execSync(path.join(buildDir, 'kraken_context_benchmark'), { encoding: 'utf-8' });
+  process.stdout.write(benchmark);
+  writeFileSync(path.join(buildDir, 'context_benchmark.txt'), benchmark);
+  done();
+});
+
 task('sdk-clean', (done) => {
   execSync(`rm -rf ${paths.sdk}/build`, { stdio: 'inherit' });
   done();
@@ -279,6 +279,9 @@ struct JSRuntime {
 
     JSHostPromiseRejectionTracker *host_promise_rejection_tracker;
     void *host_promise_rejection_tracker_opaque;
+
+    JSGCObserver *gc_observer;
+    void *gc_observer_opaque;
     
     struct list_head job_list; /* list of JSJobEntry.link */
 
@@ -2343,6 +2346,13 @@ void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size)
     rt->stack_size = stack_size;
 }
 
+/* should be called when changing thread or when the runtime is entered
+   from a stack frame above the one it was created in */
+void JS_UpdateStackTop(JSRuntime *rt)
+{
+    rt->stack_top = js_get_stack_pointer();
+}
+
 static inline BOOL is_strict_mode(JSContext *ctx)
 {
     JSStackFrame *sf = ctx->rt->current_stack_frame;
@@ -5773,6 +5783,9 @@ static void gc_free_cycles(JSRuntime *rt)
 
 void JS_RunGC(JSRuntime *rt)
 {
+    if (rt->gc_observer)
+        rt->gc_observer(rt, FALSE, rt->gc_observer_opaque);
+
     /* decrement the reference of the children of each object. mark =
        1 after this pass. */
     gc_decref(rt);
@@ -5782,6 +5795,15 @@ void JS_RunGC(JSRuntime *rt)
 
     /* free the GC objects in a cycle */
     gc_free_cycles(rt);
+
+    if (rt->gc_observer)
+        rt->gc_observer(rt, TRUE, rt->gc_observer_opaque);
+}
+
+void JS_SetGCObserver(JSRuntime *rt, JSGCObserver *observer, void *opaque)
+{
+    rt->gc_observer = observer;
+    rt->gc_observer_opaque = opaque;
 }
 
 /* Return false if not an object or if the object has already been